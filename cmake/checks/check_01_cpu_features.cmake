@@ -28,6 +28,8 @@
 #   DEAL_II_HAVE_AVX512                  (*)
 #   DEAL_II_HAVE_ALTIVEC                 (*)
 #   DEAL_II_HAVE_ARM_NEON                (*)
+#   DEAL_II_HAVE_ARM_SVE                 (*)
+#   DEAL_II_HAVE_ARM_SVE_512             (*)
 #   DEAL_II_HAVE_OPENMP_SIMD             (*)
 #   DEAL_II_VECTORIZATION_WIDTH_IN_BITS
 #   DEAL_II_OPENMP_SIMD_PRAGMA
@@ -73,6 +75,7 @@ if(DEAL_II_ALLOW_PLATFORM_INTROSPECTION)
   #
   unset_if_changed(CHECK_CPU_FEATURES_FLAGS_SAVED "${CMAKE_REQUIRED_FLAGS}"
     DEAL_II_HAVE_SSE2 DEAL_II_HAVE_AVX DEAL_II_HAVE_AVX512 DEAL_II_HAVE_ALTIVEC DEAL_II_HAVE_ARM_NEON
+    DEAL_II_HAVE_ARM_SVE DEAL_II_HAVE_ARM_SVE_512
     )
 
   CHECK_CXX_SOURCE_RUNS(
@@ -279,6 +282,57 @@ if(DEAL_II_ALLOW_PLATFORM_INTROSPECTION)
       "
       DEAL_II_HAVE_ARM_NEON)
 
+    #
+    # SVE is only used with a vector length fixed at compile time via
+    # -msve-vector-bits of at least 256 bits, which must agree with the
+    # vector length of the hardware.
+    #
+    CHECK_CXX_SOURCE_RUNS(
+      "
+      #if !defined(__ARM_FEATURE_SVE_BITS) || __ARM_FEATURE_SVE_BITS < 256
+      #error No fixed-length SVE vectors of at least 256 bits
+      #endif
+      #include <arm_sve.h>
+      typedef svfloat64_t fixed_float64_t
+        __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+      int main()
+      {
+      const int n_vectors = __ARM_FEATURE_SVE_BITS / 64;
+      if (svcntd() != n_vectors)
+        return 1;
+      double ptr[n_vectors];
+      ptr[0] = static_cast<volatile double>(1.0);
+      for (int i=1; i<n_vectors; ++i)
+        ptr[i] = 0.0;
+      const svbool_t pg = svptrue_b64();
+      fixed_float64_t a = svld1(pg, ptr);
+      fixed_float64_t b = svdup_f64(static_cast<volatile double>(2.25));
+      fixed_float64_t c = svadd_x(pg, a, b);
+      fixed_float64_t d = svmul_x(pg, b, c);
+      svst1(pg, ptr, d);
+      int return_value = 0;
+      if (ptr[0] != 7.3125)
+        return_value = 1;
+      for (int i=1; i<n_vectors; ++i)
+        if (ptr[i] != 5.0625)
+          return_value = 1;
+      return return_value;
+      }
+      "
+      DEAL_II_HAVE_ARM_SVE)
+
+    CHECK_CXX_SOURCE_COMPILES(
+      "
+      #if !defined(__ARM_FEATURE_SVE_BITS) || __ARM_FEATURE_SVE_BITS < 512
+      #error No fixed-length SVE vectors of at least 512 bits
+      #endif
+      int main()
+      {
+      return 0;
+      }
+      "
+      DEAL_II_HAVE_ARM_SVE_512)
+
   #
   # OpenMP 4.0 can be used for vectorization. Only the vectorization
   # instructions are allowed, the threading must be done through TBB.
@@ -327,6 +381,14 @@ if(DEAL_II_HAVE_ARM_NEON)
   set(DEAL_II_VECTORIZATION_WIDTH_IN_BITS 128)
 endif()
 
+if(DEAL_II_HAVE_ARM_SVE)
+  if(DEAL_II_HAVE_ARM_SVE_512)
+    set(DEAL_II_VECTORIZATION_WIDTH_IN_BITS 512)
+  else()
+    set(DEAL_II_VECTORIZATION_WIDTH_IN_BITS 256)
+  endif()
+endif()
+
 #
 # We need to disable SIMD vectorization for CUDA device code.
 # Otherwise, nvcc compilers from version 9 on will emit an error message like:
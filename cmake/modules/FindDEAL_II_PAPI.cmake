@@ -0,0 +1,56 @@
+## ------------------------------------------------------------------------
+##
+## SPDX-License-Identifier: LGPL-2.1-or-later
+## Copyright (C) 2024 by the deal.II authors
+##
+## This file is part of the deal.II library.
+##
+## Part of the source code is dual licensed under Apache-2.0 WITH
+## LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+## governing the source code and code contributions can be found in
+## LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+##
+## ------------------------------------------------------------------------
+
+#
+# Try to find the PAPI library
+#
+# This module exports
+#
+#   PAPI_FOUND
+#   PAPI_LIBRARIES
+#   PAPI_INCLUDE_DIRS
+#   PAPI_VERSION
+#
+
+set(PAPI_DIR "" CACHE PATH "An optional hint to a PAPI installation")
+set_if_empty(PAPI_DIR "$ENV{PAPI_DIR}")
+
+deal_ii_find_library(PAPI_LIBRARY
+  NAMES papi
+  HINTS ${PAPI_DIR}
+  PATH_SUFFIXES lib${LIB_SUFFIX} lib64 lib
+  )
+
+deal_ii_find_path(PAPI_INCLUDE_DIR papi.h
+  HINTS ${PAPI_DIR}
+  PATH_SUFFIXES include
+  )
+
+if(EXISTS "${PAPI_INCLUDE_DIR}/papi.h")
+  file(STRINGS "${PAPI_INCLUDE_DIR}/papi.h" PAPI_VERSION_STRING_LINE
+    REGEX "^[ \t]*#[ \t]*define[ \t]+PAPI_VERSION[ \t]+PAPI_VERSION_NUMBER"
+    )
+  string(REGEX REPLACE
+    ".*PAPI_VERSION_NUMBER[ \t]*\\([ \t]*([0-9]+)[ \t]*,[ \t]*([0-9]+)[ \t]*,[ \t]*([0-9]+).*"
+    "\\1.\\2.\\3" PAPI_VERSION "${PAPI_VERSION_STRING_LINE}"
+    )
+endif()
+
+process_feature(PAPI
+  LIBRARIES
+    REQUIRED PAPI_LIBRARY
+  INCLUDE_DIRS
+    REQUIRED PAPI_INCLUDE_DIR
+  CLEAR PAPI_LIBRARY PAPI_INCLUDE_DIR
+  )
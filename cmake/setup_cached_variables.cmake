@@ -46,6 +46,7 @@
 #     DEAL_II_DEFINITIONS_DEBUG
 #     DEAL_II_DEFINITIONS_RELEASE
 #     DEAL_II_USE_VECTORIZATION_GATHER
+#     DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX
 #
 # Components and miscellaneous options:
 #
@@ -181,6 +182,16 @@ option(DEAL_II_USE_VECTORIZATION_GATHER
   )
 mark_as_advanced(DEAL_II_USE_VECTORIZATION_GATHER)
 
+set(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX "6" CACHE STRING
+  "The largest polynomial degree for which the matrix-free evaluation kernels used by FEEvaluation and FEFaceEvaluation with a polynomial degree of -1 (i.e., given at run time, e.g. in the hp-adaptive case) are pre-compiled with the degree as a compile-time constant. Larger values result in faster evaluation for more degrees at the cost of longer compile times and a larger library."
+  )
+mark_as_advanced(DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX)
+if(NOT "${DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX}" MATCHES "^[1-9][0-9]*$")
+  message(FATAL_ERROR
+    "DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX must be a positive integer, but is set to '${DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX}'."
+    )
+endif()
+
 
 ########################################################################
 #                                                                      #
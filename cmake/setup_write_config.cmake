@@ -100,6 +100,9 @@ endif()
 if(DEAL_II_HAVE_ARM_NEON)
   list(APPEND _instructions "arm_neon")
 endif()
+if(DEAL_II_HAVE_ARM_SVE)
+  list(APPEND _instructions "arm_sve")
+endif()
 if(NOT "${_instructions}" STREQUAL "")
   to_string(_string ${_instructions})
   _both(" (${_string})\n")
@@ -136,7 +136,7 @@ namespace ArborXWrappers
      */
     template <typename QueryType>
     std::pair<std::vector<int>, std::vector<int>>
-    query(const QueryType &queries);
+    query(const QueryType &queries) const;
 
   private:
     /**
@@ -163,7 +163,7 @@ namespace ArborXWrappers
 
   template <typename QueryType>
   std::pair<std::vector<int>, std::vector<int>>
-  BVH::query(const QueryType &queries)
+  BVH::query(const QueryType &queries) const
   {
     Kokkos::View<int *, Kokkos::HostSpace> indices("indices", 0);
 
@@ -0,0 +1,63 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_atomic_operations_h
+#define dealii_atomic_operations_h
+
+
+#include <deal.II/base/config.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <complex>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace internal
+{
+  /**
+   * Atomically add @p value to @p destination on the host, such that
+   * several threads can add into the same memory location without a data
+   * race. The implementation uses the atomics provided by Kokkos, which
+   * compile to a compare-and-swap loop for floating point numbers.
+   */
+  template <typename Number>
+  inline void
+  atomic_add(Number &destination, const Number value)
+  {
+    Kokkos::atomic_add(&destination, value);
+  }
+
+
+
+  /**
+   * Same as above for complex numbers. The real and imaginary parts are
+   * updated by two separate atomic operations, which is sufficient for
+   * summation and avoids the lock-based fallback Kokkos uses for types of
+   * twice the word size.
+   */
+  template <typename Number>
+  inline void
+  atomic_add(std::complex<Number> &destination,
+             const std::complex<Number> value)
+  {
+    Number *parts = reinterpret_cast<Number *>(&destination);
+    Kokkos::atomic_add(&parts[0], value.real());
+    Kokkos::atomic_add(&parts[1], value.imag());
+  }
+} // namespace internal
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
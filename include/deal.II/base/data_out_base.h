@@ -22,6 +22,7 @@
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/table.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/grid/reference_cell.h>
 
@@ -30,6 +31,7 @@
 // To be able to serialize XDMFEntry
 #include <boost/serialization/map.hpp>
 
+#include <functional>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -1223,6 +1225,22 @@ namespace DataOutBase
      */
     std::map<std::string, std::string> physical_units;
 
+    /**
+     * Flag determining whether nodes of different patches at the same
+     * location are written only once in VTU output, with all cells sharing
+     * them referring to the same node. Since every patch stores its own
+     * copy of the nodes on its boundary, this reduces the size of the output
+     * files considerably, in particular for many small patches. The data
+     * values written for a merged node are the ones of the first patch the
+     * node is part of, so this flag should only be set if all output
+     * fields are continuous across cell interfaces. Nodes are considered to
+     * be at the same location if their coordinates agree in single
+     * precision, which is the precision in which they are written.
+     *
+     * Default is <tt>false</tt>.
+     */
+    bool merge_duplicate_vertices;
+
     /**
      * Constructor. Initializes the member variables with names corresponding
      * to the argument names of this function.
@@ -1233,7 +1251,8 @@ namespace DataOutBase
       const bool             print_date_and_time = true,
       const CompressionLevel compression_level   = CompressionLevel::best_speed,
       const bool             write_higher_order_cells          = false,
-      const std::map<std::string, std::string> &physical_units = {});
+      const std::map<std::string, std::string> &physical_units = {},
+      const bool merge_duplicate_vertices                      = false);
   };
 
 
@@ -1546,7 +1565,7 @@ namespace DataOutBase
       }
     };
 
-    using Map3DPoint = std::multimap<Point<3>, unsigned int, Point3Comp>;
+    using Map3DPoint = std::map<Point<3>, unsigned int, Point3Comp>;
 
     /**
      * Flags used to specify filtering behavior.
@@ -1568,19 +1587,25 @@ namespace DataOutBase
     unsigned int num_cells;
 
     /**
-     * Map of points to an internal index.
+     * Map of points to an internal index. This map is only filled if
+     * duplicate vertices are filtered.
      */
     Map3DPoint existing_points;
 
     /**
-     * Map of actual point index to internal point index.
+     * The recorded points, indexed by their internal index.
+     */
+    std::vector<Point<3>> points;
+
+    /**
+     * Internal point index for each actual point index.
      */
-    std::map<unsigned int, unsigned int> filtered_points;
+    std::vector<unsigned int> filtered_points;
 
     /**
-     * Map of cells to the filtered points.
+     * Internal point index for each vertex of each cell.
      */
-    std::map<unsigned int, unsigned int> filtered_cells;
+    std::vector<unsigned int> filtered_cells;
 
     /**
      * Data set names.
@@ -2085,6 +2110,32 @@ namespace DataOutBase
     const VtkFlags &flags,
     std::ostream   &out);
 
+  /**
+   * Collective MPI call to write the given list of patches from all processes
+   * in @p comm to a single .vtu file @p filename on a shared file system. Each
+   * process contributes the piece generated from its own @p patches, placed
+   * in the file through MPI I/O at an offset computed by a prefix sum over the
+   * sizes of the pieces. Processes without patches do not write a piece.
+   *
+   * This is the function behind DataOutInterface::write_vtu_in_parallel()
+   * and GridOut::write_vtu_in_parallel(). Without MPI, it simply calls
+   * write_vtu() on a file stream.
+   */
+  template <int dim, int spacedim>
+  void
+  write_vtu_in_parallel(
+    const std::vector<Patch<dim, spacedim>> &patches,
+    const std::vector<std::string>          &data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+                      &nonscalar_data_ranges,
+    const VtkFlags    &flags,
+    const std::string &filename,
+    const MPI_Comm     comm);
+
   /**
    * Some visualization programs, such as ParaView, can read several separate
    * VTU files that all form part of the same simulation, in order to
@@ -2746,6 +2797,23 @@ public:
   void
   write_vtu_in_parallel(const std::string &filename, const MPI_Comm comm) const;
 
+  /**
+   * Like write_vtu(), but write the data to the file @p filename on a
+   * background task. The patches and all other data needed for the output
+   * are copied before this function returns, so the current object can be
+   * reused right away (e.g., by calling DataOut::build_patches() for the
+   * next time step), while the compression of the data and the file I/O run
+   * concurrently with the remaining computations of the program. Call
+   * Threads::Task::join() on the returned object to wait for the file to be
+   * complete; exceptions thrown while writing are passed on by that call.
+   *
+   * No MPI communication takes place on the background task. In parallel
+   * computations, this function is meant for the setup where each process
+   * writes its own file and one process groups them by write_pvtu_record().
+   */
+  Threads::Task<>
+  write_vtu_in_background(const std::string &filename) const;
+
   /**
    * Some visualization programs, such as ParaView and VisIt, can read several
    * separate VTU files that all form part of the same simulation, in order to
@@ -3108,6 +3176,20 @@ protected:
   void
   validate_dataset_names() const;
 
+  /**
+   * Write a VTU file consisting of several pieces to @p out, using the
+   * flags set for VTU output. The function @p generate_pieces is called
+   * with a function object as argument, which it is supposed to call
+   * whenever the patches returned by get_patches() represent the next
+   * piece of the output. This allows derived classes to generate and write
+   * the patches chunk by chunk without ever storing all of them.
+   */
+  void
+  write_vtu_in_pieces(
+    std::ostream                                             &out,
+    const std::function<void(const std::function<void()> &)> &generate_pieces)
+    const;
+
 
   /**
    * The default number of subdivisions for patches. This is filled by
@@ -1219,6 +1219,15 @@ namespace StandardExceptions
     "if deal.II was configured to use CGAL, but cmake did not "
     "find a valid CGAL library.");
 
+  /**
+   * This function requires support for the PAPI library.
+   */
+  DeclExceptionMsg(
+    ExcNeedsPAPI,
+    "You are attempting to use functionality that is only available "
+    "if deal.II was configured to use PAPI, but cmake did not "
+    "find a valid PAPI library.");
+
 #ifdef DEAL_II_WITH_MPI
   /**
    * Exception for MPI errors. This exception is only defined if
@@ -222,6 +222,25 @@ public:
   virtual RangeNumberType
   value(const Point<dim> &p, const unsigned int component = 0) const;
 
+  /**
+   * Return the values of the function at a batch of points stored in the
+   * SIMD layout used by FEEvaluation::quadrature_point(), i.e., one point
+   * per lane of VectorizedArray. This allows matrix-free code to evaluate
+   * functions, e.g. for right hand sides or initial conditions, without
+   * unpacking the points.
+   *
+   * The default implementation calls value() for each lane. Derived classes
+   * whose value can be computed with arithmetic operations on
+   * VectorizedArray should overload this function to evaluate all lanes at
+   * once. Since all lanes are evaluated, the points of unused lanes must be
+   * valid arguments for the function.
+   *
+   * This function is only implemented for real-valued functions.
+   */
+  virtual VectorizedArray<double>
+  vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                   const unsigned int component = 0) const;
+
   /**
    * Return all components of a vector-valued function at a given point.
    *
@@ -440,6 +459,10 @@ namespace Functions
     virtual RangeNumberType
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     virtual void
     vector_value(const Point<dim>        &p,
                  Vector<RangeNumberType> &return_value) const override;
@@ -21,6 +21,7 @@
 #include <deal.II/base/function.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor_function.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/vector.h>
 
@@ -69,6 +70,33 @@ Function<dim, RangeNumberType>::value(const Point<dim> &,
 }
 
 
+template <int dim, typename RangeNumberType>
+VectorizedArray<double>
+Function<dim, RangeNumberType>::vectorized_value(
+  const Point<dim, VectorizedArray<double>> &p,
+  const unsigned int                         component) const
+{
+  VectorizedArray<double> result = 0.;
+  if constexpr (numbers::NumberTraits<RangeNumberType>::is_complex)
+    {
+      (void)p;
+      (void)component;
+      Assert(false,
+             ExcMessage("The evaluation on VectorizedArray points is only "
+                        "available for real-valued functions."));
+    }
+  else
+    for (unsigned int v = 0; v < VectorizedArray<double>::size(); ++v)
+      {
+        Point<dim> point;
+        for (unsigned int d = 0; d < dim; ++d)
+          point[d] = p[d][v];
+        result[v] = this->value(point, component);
+      }
+  return result;
+}
+
+
 template <int dim, typename RangeNumberType>
 void
 Function<dim, RangeNumberType>::vector_value(const Point<dim>        &p,
@@ -379,6 +407,26 @@ namespace Functions
 
 
 
+  template <int dim, typename RangeNumberType>
+  VectorizedArray<double>
+  ConstantFunction<dim, RangeNumberType>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &,
+    const unsigned int component) const
+  {
+    AssertIndexRange(component, this->n_components);
+    if constexpr (numbers::NumberTraits<RangeNumberType>::is_complex)
+      {
+        Assert(false,
+               ExcMessage("The evaluation on VectorizedArray points is only "
+                          "available for real-valued functions."));
+        return VectorizedArray<double>();
+      }
+    else
+      return VectorizedArray<double>(function_value_vector[component]);
+  }
+
+
+
   template <int dim, typename RangeNumberType>
   void
   ConstantFunction<dim, RangeNumberType>::vector_value(
@@ -52,6 +52,9 @@ namespace Functions
   public:
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
     virtual void
     vector_value(const Point<dim> &p, Vector<double> &values) const override;
     virtual void
@@ -92,6 +95,10 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     virtual void
     value_list(const std::vector<Point<dim>> &points,
                std::vector<double>           &values,
@@ -163,6 +170,13 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * The values at a batch of points in SIMD layout.
+     */
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     /**
      * Values at multiple points.
      */
@@ -227,6 +241,10 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     virtual void
     value_list(const std::vector<Point<dim>> &points,
                std::vector<double>           &values,
@@ -338,6 +356,13 @@ namespace Functions
     virtual double
     value(const Point<dim> &p, const unsigned int component = 0) const override;
 
+    /**
+     * The values at a batch of points in SIMD layout.
+     */
+    virtual VectorizedArray<double>
+    vectorized_value(const Point<dim, VectorizedArray<double>> &p,
+                     const unsigned int component = 0) const override;
+
     /**
      * Values at multiple points.
      */
@@ -334,6 +334,29 @@ public:
              const ConstMap    &constants,
              const bool         time_dependent = false);
 
+  /**
+   * Try to compile the expressions given to initialize() into native code
+   * that is then used by value() and vector_value() instead of the
+   * interpreter of muParser. Evaluating compiled expressions is considerably
+   * faster, which matters if a function is evaluated in many points, for
+   * example as boundary values or right hand side. The compilation takes
+   * some time, so it should only be done once after initialize().
+   *
+   * The compilation uses the LLVM JIT compiler of SymEngine and is only
+   * available if deal.II has been configured with SymEngine built with LLVM
+   * support. In addition, SymEngine must be able to parse the expressions,
+   * which is not the case for several of the extensions of muParser listed
+   * above, such as <code>if(condition, then-value, else-value)</code>, the
+   * ternary operator, or <code>rand()</code>. If the expressions can not be
+   * compiled, they continue to be evaluated by muParser.
+   *
+   * A call to initialize() discards the compiled expressions.
+   *
+   * @return Whether the expressions have been compiled.
+   */
+  bool
+  compile_expressions();
+
   /**
    * A function that returns default names for variables, to be used in the
    * first argument of the initialize() functions: it returns "x" in 1d, "x,y"
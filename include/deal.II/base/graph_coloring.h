@@ -20,6 +20,7 @@
 #  include <deal.II/base/config.h>
 
 #  include <deal.II/base/thread_management.h>
+#  include <deal.II/base/types.h>
 
 #  include <algorithm>
 #  include <functional>
@@ -112,66 +113,53 @@ namespace GraphColoring
       const std::function<std::vector<types::global_dof_index>(
         const Iterator &)>                       &get_conflict_indices)
     {
-      // Number of iterators.
-      unsigned int n_iterators = 0;
-
-      // Create a map from conflict indices to iterators
-      std::unordered_map<types::global_dof_index, std::vector<Iterator>>
-        indices_to_iterators;
+      // Collect the iterators and their conflict indices, so that the
+      // (possibly expensive) user function is called only once per iterator
+      // and iterators can be identified by their position in the range
+      std::vector<Iterator>                             iterators;
+      std::vector<std::vector<types::global_dof_index>> conflict_indices;
       for (Iterator it = begin; it != end; ++it)
         {
-          const std::vector<types::global_dof_index> conflict_indices =
-            get_conflict_indices(it);
-          const unsigned int n_conflict_indices = conflict_indices.size();
-          for (unsigned int i = 0; i < n_conflict_indices; ++i)
-            indices_to_iterators[conflict_indices[i]].push_back(it);
-          ++n_iterators;
+          iterators.push_back(it);
+          conflict_indices.push_back(get_conflict_indices(it));
         }
+      const unsigned int n_iterators = iterators.size();
+
+      // Create a map from conflict indices to the positions of the iterators
+      std::unordered_map<types::global_dof_index, std::vector<unsigned int>>
+        indices_to_iterators;
+      for (unsigned int i = 0; i < n_iterators; ++i)
+        for (const types::global_dof_index index : conflict_indices[i])
+          indices_to_iterators[index].push_back(i);
 
       // create the very first zone which contains only the first
       // iterator. then create the other zones. keep track of all the
       // iterators that have already been assigned to a zone
-      std::vector<std::vector<Iterator>> zones(1,
-                                               std::vector<Iterator>(1, begin));
-      std::set<Iterator>                 used_it;
-      used_it.insert(begin);
-      while (used_it.size() != n_iterators)
+      std::vector<std::vector<unsigned int>> zones(
+        1, std::vector<unsigned int>(1, 0));
+      std::vector<bool> used_it(n_iterators, false);
+      used_it[0]                   = true;
+      unsigned int n_used          = 1;
+      unsigned int first_unused_it = 1;
+      while (n_used != n_iterators)
         {
           // loop over the elements of the previous zone. for each element of
           // the previous zone, get the conflict indices and from there get
           // those iterators that are conflicting with the current element
-          typename std::vector<Iterator>::iterator previous_zone_it(
-            zones.back().begin());
-          typename std::vector<Iterator>::iterator previous_zone_end(
-            zones.back().end());
-          std::vector<Iterator> new_zone;
-          for (; previous_zone_it != previous_zone_end; ++previous_zone_it)
-            {
-              const std::vector<types::global_dof_index> conflict_indices =
-                get_conflict_indices(*previous_zone_it);
-
-              const unsigned int n_conflict_indices(conflict_indices.size());
-              for (unsigned int i = 0; i < n_conflict_indices; ++i)
-                {
-                  const std::vector<Iterator> &conflicting_elements =
-                    indices_to_iterators[conflict_indices[i]];
-                  for (unsigned int j = 0; j < conflicting_elements.size(); ++j)
-                    {
-                      // check that the iterator conflicting with the current
-                      // one is not associated to a zone yet and if so, assign
-                      // it to the current zone. mark it as used
-                      //
-                      // we can shortcut this test if the conflicting iterator
-                      // is the current iterator
-                      if ((conflicting_elements[j] != *previous_zone_it) &&
-                          (used_it.count(conflicting_elements[j]) == 0))
-                        {
-                          new_zone.push_back(conflicting_elements[j]);
-                          used_it.insert(conflicting_elements[j]);
-                        }
-                    }
-                }
-            }
+          std::vector<unsigned int> new_zone;
+          for (const unsigned int previous : zones.back())
+            for (const types::global_dof_index index :
+                 conflict_indices[previous])
+              for (const unsigned int conflicting : indices_to_iterators[index])
+                // check that the iterator conflicting with the current
+                // one is not associated to a zone yet and if so, assign
+                // it to the current zone. mark it as used
+                if (used_it[conflicting] == false)
+                  {
+                    new_zone.push_back(conflicting);
+                    used_it[conflicting] = true;
+                    ++n_used;
+                  }
 
           // If there are iterators in the new zone, then the zone is added to
           // the partition. Otherwise, the graph is disconnected and we need to
@@ -179,18 +167,26 @@ namespace GraphColoring
           // process again with the first iterator that hasn't been assigned to
           // a zone yet
           if (new_zone.size() != 0)
-            zones.push_back(new_zone);
+            zones.push_back(std::move(new_zone));
           else
-            for (Iterator it = begin; it != end; ++it)
-              if (used_it.count(it) == 0)
-                {
-                  zones.push_back(std::vector<Iterator>(1, it));
-                  used_it.insert(it);
-                  break;
-                }
+            {
+              while (used_it[first_unused_it])
+                ++first_unused_it;
+              zones.emplace_back(1, first_unused_it);
+              used_it[first_unused_it] = true;
+              ++n_used;
+            }
         }
 
-      return zones;
+      std::vector<std::vector<Iterator>> partitioning(zones.size());
+      for (unsigned int z = 0; z < zones.size(); ++z)
+        {
+          partitioning[z].reserve(zones[z].size());
+          for (const unsigned int i : zones[z])
+            partitioning[z].push_back(iterators[i]);
+        }
+
+      return partitioning;
     }
 
 
@@ -230,84 +226,79 @@ namespace GraphColoring
       // Number of zones composing the partitioning.
       const unsigned int        partition_size(partition.size());
       std::vector<unsigned int> sorted_vertices(partition_size);
-      std::vector<int>          degrees(partition_size);
       std::vector<std::vector<types::global_dof_index>> conflict_indices(
         partition_size);
       std::vector<std::vector<unsigned int>> graph(partition_size);
 
-      // Get the conflict indices associated to each iterator. The
-      // conflict_indices have to be sorted so we can more easily find conflicts
-      // later on
+      // Get the conflict indices associated to each iterator and create a
+      // hash map from the conflict indices to the vertices using them. Two
+      // vertices are connected by an edge if they share a conflict index, so
+      // the edges can be found by looking up the conflict indices of each
+      // vertex in this map rather than by intersecting the conflict indices
+      // of all pairs of vertices
+      std::unordered_map<types::global_dof_index, std::vector<unsigned int>>
+        indices_to_vertices;
       for (unsigned int i = 0; i < partition_size; ++i)
         {
           conflict_indices[i] = get_conflict_indices(partition[i]);
           std::sort(conflict_indices[i].begin(), conflict_indices[i].end());
+          conflict_indices[i].erase(std::unique(conflict_indices[i].begin(),
+                                                conflict_indices[i].end()),
+                                    conflict_indices[i].end());
+          for (const types::global_dof_index index : conflict_indices[i])
+            indices_to_vertices[index].push_back(i);
         }
 
-      // Compute the degree of each vertex of the graph using the
-      // intersection of the conflict indices.
-      for (unsigned int i = 0; i < partition_size; ++i)
-        for (unsigned int j = i + 1; j < partition_size; ++j)
-          // If the two iterators share indices then we increase the degree of
-          // the vertices and create an ''edge'' in the graph.
-          if (have_nonempty_intersection(conflict_indices[i],
-                                         conflict_indices[j]))
-            {
-              ++degrees[i];
-              ++degrees[j];
-              graph[i].push_back(j);
-              graph[j].push_back(i);
-            }
-
-      // Sort the vertices by decreasing degree.
-      std::vector<int>::iterator degrees_it;
+      // Create the edges of the graph. A vertex may share several conflict
+      // indices with a neighbor, so mark the neighbors already found
+      std::vector<unsigned int> last_marked(partition_size,
+                                            numbers::invalid_unsigned_int);
       for (unsigned int i = 0; i < partition_size; ++i)
         {
-          // Find the largest element.
-          degrees_it         = std::max_element(degrees.begin(), degrees.end());
-          sorted_vertices[i] = degrees_it - degrees.begin();
-          // Put the largest element to -1 so it cannot be chosen again.
-          *degrees_it = -1;
+          last_marked[i] = i;
+          for (const types::global_dof_index index : conflict_indices[i])
+            for (const unsigned int j : indices_to_vertices[index])
+              if (last_marked[j] != i)
+                {
+                  last_marked[j] = i;
+                  graph[i].push_back(j);
+                }
         }
 
-      // Color the graph.
-      std::vector<std::unordered_set<unsigned int>> colors_used;
+      // Sort the vertices by decreasing degree, keeping the vertices of
+      // equal degree in their original order.
       for (unsigned int i = 0; i < partition_size; ++i)
+        sorted_vertices[i] = i;
+      std::stable_sort(sorted_vertices.begin(),
+                       sorted_vertices.end(),
+                       [&graph](const unsigned int a, const unsigned int b) {
+                         return graph[a].size() > graph[b].size();
+                       });
+
+      // Color the graph. Each vertex is assigned the lowest numbered color
+      // not used by any of the vertices linked to it.
+      std::vector<unsigned int> vertex_colors(partition_size,
+                                              numbers::invalid_unsigned_int);
+      std::vector<unsigned int> color_marked;
+      for (const unsigned int current_vertex : sorted_vertices)
         {
-          const unsigned int current_vertex(sorted_vertices[i]);
-          bool               new_color(true);
-          // Try to use an existing color, i.e., try to find a color which is
-          // not associated to one of the vertices linked to current_vertex.
-          // Loop over the color.
-          for (unsigned int j = 0; j < partition_coloring.size(); ++j)
-            {
-              // Loop on the vertices linked to current_vertex. If one vertex
-              // linked to current_vertex is already using the color j, this
-              // color cannot be used anymore.
-              bool unused_color(true);
-              for (const auto adjacent_vertex : graph[current_vertex])
-                if (colors_used[j].count(adjacent_vertex) == 1)
-                  {
-                    unused_color = false;
-                    break;
-                  }
-              if (unused_color)
-                {
-                  partition_coloring[j].push_back(partition[current_vertex]);
-                  colors_used[j].insert(current_vertex);
-                  new_color = false;
-                  break;
-                }
-            }
+          for (const auto adjacent_vertex : graph[current_vertex])
+            if (vertex_colors[adjacent_vertex] != numbers::invalid_unsigned_int)
+              color_marked[vertex_colors[adjacent_vertex]] = current_vertex;
+
+          unsigned int color = 0;
+          while (color < partition_coloring.size() &&
+                 color_marked[color] == current_vertex)
+            ++color;
+
           // Add a new color.
-          if (new_color)
+          if (color == partition_coloring.size())
             {
-              partition_coloring.push_back(
-                std::vector<Iterator>(1, partition[current_vertex]));
-              std::unordered_set<unsigned int> tmp;
-              tmp.insert(current_vertex);
-              colors_used.push_back(tmp);
+              partition_coloring.emplace_back();
+              color_marked.push_back(numbers::invalid_unsigned_int);
             }
+          partition_coloring[color].push_back(partition[current_vertex]);
+          vertex_colors[current_vertex] = color;
         }
     }
 
@@ -519,6 +510,12 @@ namespace GraphColoring
    * conflict indicator sets have overlap will not be assigned to the same
    * color.
    *
+   * The conflicts are found through hash maps from the conflict indicators
+   * to the iterators using them, so that the cost of this function grows
+   * essentially linearly with the number of iterators for meshes with a
+   * bounded number of neighbors per cell. The user-provided function is
+   * called twice for each iterator.
+   *
    * @note The algorithm used in this function is described in a paper by
    * Turcksin, Kronbichler and Bangerth, see
    * @ref workstream_paper.
@@ -23,6 +23,8 @@
 #include <deal.II/base/mutex.h>
 
 #include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <type_traits>
@@ -294,6 +296,82 @@ private:
   mutable Threads::Mutex initialization_mutex;
 };
 
+
+/**
+ * A thread-safe registry of objects of type `T` that are created on first
+ * request and shared by all later requests with the same key. This is useful
+ * for expensive tables that only depend on a few parameters, such as the
+ * polynomial degree of a finite element: rather than letting every object
+ * compute its own copy of such a table, all objects with the same parameters
+ * obtain it from a registry with static storage duration:
+ * ```
+ * const FullMatrix<double> &
+ * get_embedding_table(const unsigned int degree)
+ * {
+ *   static LazyRegistry<unsigned int, FullMatrix<double>> registry;
+ *   return *registry.get_or_create(degree, [&]() {
+ *     // Some expensive operation computing the table for the given degree
+ *   });
+ * }
+ * ```
+ *
+ * The registry is only locked while the entry for a key is looked up. The
+ * creation of the object itself is protected by a Lazy<T> object per key, so
+ * that objects for different keys can be created concurrently, and threads
+ * asking for the same key wait for the one creating it.
+ *
+ * By default, objects are never removed from the registry except by clear().
+ * This is appropriate if there are only few distinct keys, such as
+ * polynomial degrees. If the keys are arbitrary user data, for example
+ * quadrature formulas, the registry can instead be told to release the
+ * objects that are no longer used by anyone: such objects are then removed
+ * whenever a new object is added to the registry, so that the registry does
+ * not grow beyond the objects still referenced by callers and those released
+ * since the last insertion. In either case, the returned pointers keep the
+ * objects alive even after they have been removed from the registry.
+ */
+template <typename Key, typename T>
+class LazyRegistry
+{
+public:
+  /**
+   * Constructor. If @p release_unused_objects is true, objects to which no
+   * pointer returned by get_or_create() exists any more are removed from the
+   * registry when a new object is added.
+   */
+  explicit LazyRegistry(const bool release_unused_objects = false);
+
+  /**
+   * Return the object stored for @p key. If there is none yet, call
+   * `creator()` to create it.
+   */
+  template <typename Callable>
+  std::shared_ptr<const T>
+  get_or_create(const Key &key, const Callable &creator);
+
+  /**
+   * Remove all objects from the registry.
+   */
+  void
+  clear();
+
+private:
+  /**
+   * Whether to remove objects that are no longer used, see the constructor.
+   */
+  const bool release_unused_objects;
+
+  /**
+   * A mutex protecting the map of objects.
+   */
+  Threads::Mutex mutex;
+
+  /**
+   * The objects, each wrapped into a Lazy object for its initialization.
+   */
+  std::map<Key, std::shared_ptr<Lazy<T>>> objects;
+};
+
 /**
  * @}
  */
@@ -525,5 +603,58 @@ std::size_t Lazy<T>::memory_consumption() const
 }
 
 
+
+template <typename Key, typename T>
+template <typename Callable>
+inline std::shared_ptr<const T>
+LazyRegistry<Key, T>::get_or_create(const Key &key, const Callable &creator)
+{
+  std::shared_ptr<Lazy<T>> object;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto                  it = objects.find(key);
+    if (it != objects.end())
+      object = it->second;
+    else
+      {
+        // the pointers handed out by this function share ownership with the
+        // entries of the map, and new pointers are only created under the
+        // lock, so an entry that is only owned by the map is unused
+        if (release_unused_objects)
+          {
+            for (auto entry = objects.begin(); entry != objects.end();)
+              if (entry->second.use_count() == 1)
+                entry = objects.erase(entry);
+              else
+                ++entry;
+          }
+
+        object = std::make_shared<Lazy<T>>();
+        objects.emplace(key, object);
+      }
+  }
+
+  object->ensure_initialized(creator);
+  return std::shared_ptr<const T>(object, &object->value());
+}
+
+
+
+template <typename Key, typename T>
+inline LazyRegistry<Key, T>::LazyRegistry(const bool release_unused_objects)
+  : release_unused_objects(release_unused_objects)
+{}
+
+
+
+template <typename Key, typename T>
+inline void
+LazyRegistry<Key, T>::clear()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  objects.clear();
+}
+
+
 DEAL_II_NAMESPACE_CLOSE
 #endif
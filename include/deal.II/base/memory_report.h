@@ -0,0 +1,237 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_memory_report_h
+#define dealii_memory_report_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/types.h>
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A class that collects the memory consumption of the objects of a program
+ * and prints an aggregated view of it, with the minimum, average, and
+ * maximum over all MPI processes as well as the total number of bytes per
+ * degree of freedom of each component. This information is useful to
+ * estimate the memory needed for larger problems, or to identify the data
+ * structures that dominate the memory consumption.
+ *
+ * The report is a list of named components, each of which stores the number
+ * of bytes on the current process. Components are added with add_bytes(),
+ * or with add() for objects whose size is determined with
+ * MemoryConsumption::memory_consumption(), i.e., any object with a
+ * <code>memory_consumption()</code> member function such as Triangulation,
+ * DoFHandler, AffineConstraints, SparseMatrix, or Particles::ParticleHandler.
+ * Some objects are split into several components by dedicated functions,
+ * add_matrix_free() and add_mg_level_object():
+ * @code
+ * MemoryReport report(MPI_COMM_WORLD);
+ * report.add("triangulation", triangulation);
+ * report.add("dof_handler", dof_handler);
+ * report.add("constraints", constraints);
+ * report.add_matrix_free("matrix_free", matrix_free);
+ * report.add_mg_level_object("mg_matrices", mg_matrices);
+ * report.add("particles", particle_handler);
+ * report.set_n_dofs(dof_handler.n_dofs());
+ * report.print(pcout.get_stream());
+ * @endcode
+ * which prints a table like
+ * @code
+ * component         min [MB]   avg [MB]   max [MB]  total [MB]  bytes/DoF
+ * triangulation       12.345     13.012     14.201     416.384     41.638
+ * ...
+ * @endcode
+ *
+ * The numbers are the estimates returned by the memory_consumption()
+ * functions of the respective classes, which do not include the overhead of
+ * the memory allocator and may miss some data that is not owned directly,
+ * e.g., memory shared between objects.
+ *
+ * @ingroup utilities
+ */
+class MemoryReport
+{
+public:
+  /**
+   * Constructor. The statistics are computed over the processes of
+   * @p mpi_communicator.
+   */
+  explicit MemoryReport(const MPI_Comm mpi_communicator = MPI_COMM_SELF);
+
+  /**
+   * Add a component named @p name that uses @p bytes bytes on the current
+   * process.
+   */
+  void
+  add_bytes(const std::string &name, const std::size_t bytes);
+
+  /**
+   * Add a component named @p name for @p object, whose memory consumption is
+   * determined with MemoryConsumption::memory_consumption().
+   */
+  template <typename T>
+  void
+  add(const std::string &name, const T &object);
+
+  /**
+   * Add the memory consumption of @p matrix_free, a MatrixFree object,
+   * split into the index data of each DoFHandler (DoFInfo), the geometry
+   * data (MappingInfo), the task partitioning data (TaskInfo), and the
+   * remaining data, i.e., the shape functions (ShapeInfo), the connectivity
+   * of the faces, and the weights of the constraints. The components are
+   * named with @p name as prefix.
+   */
+  template <typename MatrixFreeType>
+  void
+  add_matrix_free(const std::string &name, const MatrixFreeType &matrix_free);
+
+  /**
+   * Add one component for each level of @p objects, named with @p name as
+   * prefix.
+   */
+  template <typename Object>
+  void
+  add_mg_level_object(const std::string           &name,
+                      const MGLevelObject<Object> &objects);
+
+  /**
+   * Set the total number of degrees of freedom of the problem, which is used
+   * to print the number of bytes per degree of freedom.
+   */
+  void
+  set_n_dofs(const types::global_dof_index n_dofs);
+
+  /**
+   * Return the components added so far, i.e., their names and their memory
+   * consumption on the current process in bytes.
+   */
+  const std::vector<std::pair<std::string, std::size_t>> &
+  get_components() const;
+
+  /**
+   * Return the sum of the memory consumption of all components on the
+   * current process, in bytes.
+   */
+  std::size_t
+  get_local_total() const;
+
+  /**
+   * Print a table with the minimum, average, and maximum over all
+   * processes, the sum over all processes, and, if set_n_dofs() has been
+   * called, the sum per degree of freedom of each component and of all
+   * components together. The table is only printed on the process with rank
+   * zero.
+   *
+   * This function needs to be called on all processes of the communicator
+   * given to the constructor, and all processes need to have added the same
+   * components in the same order.
+   */
+  void
+  print(std::ostream &out) const;
+
+  /**
+   * Remove all components.
+   */
+  void
+  clear();
+
+private:
+  /**
+   * The communicator over which the statistics are computed.
+   */
+  MPI_Comm mpi_communicator;
+
+  /**
+   * The names and sizes of the components.
+   */
+  std::vector<std::pair<std::string, std::size_t>> components;
+
+  /**
+   * The number of degrees of freedom, or zero if not set.
+   */
+  types::global_dof_index n_dofs;
+};
+
+
+
+/* ---------------------- template functions --------------------------- */
+
+#ifndef DOXYGEN
+
+template <typename T>
+void
+MemoryReport::add(const std::string &name, const T &object)
+{
+  add_bytes(name, MemoryConsumption::memory_consumption(object));
+}
+
+
+
+template <typename MatrixFreeType>
+void
+MemoryReport::add_matrix_free(const std::string    &name,
+                              const MatrixFreeType &matrix_free)
+{
+  const std::size_t total     = matrix_free.memory_consumption();
+  std::size_t       accounted = 0;
+
+  for (unsigned int c = 0; c < matrix_free.n_components(); ++c)
+    {
+      const std::size_t bytes =
+        matrix_free.get_dof_info(c).memory_consumption();
+      add_bytes(name + "/dof_info " + std::to_string(c), bytes);
+      accounted += bytes;
+    }
+
+  const std::size_t mapping_bytes =
+    matrix_free.get_mapping_info().memory_consumption();
+  add_bytes(name + "/mapping_info", mapping_bytes);
+  accounted += mapping_bytes;
+
+  const std::size_t task_bytes =
+    matrix_free.get_task_info().memory_consumption();
+  add_bytes(name + "/task_info", task_bytes);
+  accounted += task_bytes;
+
+  add_bytes(name + "/shape_info and other",
+            total > accounted ? total - accounted : 0);
+}
+
+
+
+template <typename Object>
+void
+MemoryReport::add_mg_level_object(const std::string           &name,
+                                  const MGLevelObject<Object> &objects)
+{
+  for (unsigned int level = objects.min_level(); level <= objects.max_level();
+       ++level)
+    add(name + "/level " + std::to_string(level), objects[level]);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
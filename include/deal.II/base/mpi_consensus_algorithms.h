@@ -935,6 +935,136 @@ namespace Utilities
 
 
 
+      /**
+       * This class implements a concrete algorithm for the
+       * ConsensusAlgorithms::Interface base class that remembers the
+       * communication graph, i.e., the processes a process sends requests to
+       * and the processes it receives requests from, between calls to run().
+       *
+       * The first time run() is called, and whenever the targets of any
+       * process differ from the ones passed to the previous call, the
+       * communication partners are discovered by the Selector class. In
+       * addition, two distributed graph communicators are set up, one
+       * with edges from the requesting processes to their targets and one
+       * with the reverse edges. As long as all processes pass the same
+       * targets again, run() skips the discovery and exchanges the requests
+       * and answers with the MPI neighborhood collectives
+       * MPI_Neighbor_alltoall() and MPI_Neighbor_alltoallv() on these
+       * communicators. Whether the targets are unchanged is determined with a
+       * single reduction over all processes.
+       *
+       * This is useful if the same exchange pattern is executed repeatedly,
+       * for example if an object of this class is kept alongside a data
+       * structure whose update requires a consensus algorithm each time it is
+       * called with the same layout.
+       *
+       * @note All processes of the communicator have to call run() on their
+       *   respective object of this class the same number of times, with the
+       *   same communicator.
+       *
+       * @tparam RequestType The type of the elements of the vector to be sent.
+       * @tparam AnswerType The type of the elements of the vector to be received.
+       */
+      template <typename RequestType, typename AnswerType>
+      class CommunicationGraph : public Interface<RequestType, AnswerType>
+      {
+      public:
+        /**
+         * Default constructor.
+         */
+        CommunicationGraph() = default;
+
+        /**
+         * Do not allow making copies, since this class owns the MPI
+         * communicators of the cached graph.
+         */
+        CommunicationGraph(const CommunicationGraph &) = delete;
+
+        /**
+         * Destructor. Frees the communicators of the cached graph.
+         */
+        virtual ~CommunicationGraph() override;
+
+        /**
+         * Do not allow assignment of this class.
+         */
+        CommunicationGraph &
+        operator=(const CommunicationGraph &) = delete;
+
+        // Import the declarations from the base class.
+        using Interface<RequestType, AnswerType>::run;
+
+        /**
+         * @copydoc Interface::run()
+         *
+         * @note If the communication graph has not been set up yet or the
+         *   targets have changed on any process, the function call is
+         *   delegated to the Selector class.
+         */
+        virtual std::vector<unsigned int>
+        run(
+          const std::vector<unsigned int>                      &targets,
+          const std::function<RequestType(const unsigned int)> &create_request,
+          const std::function<AnswerType(const unsigned int,
+                                         const RequestType &)> &answer_request,
+          const std::function<void(const unsigned int, const AnswerType &)>
+                        &process_answer,
+          const MPI_Comm comm) override;
+
+        /**
+         * Forget the cached communication graph, so that the next call to
+         * run() discovers the communication partners again.
+         */
+        void
+        clear();
+
+      private:
+        /**
+         * The communicator passed to the call of run() that set up the
+         * cached graph.
+         */
+        MPI_Comm cached_comm = MPI_COMM_NULL;
+
+        /**
+         * The targets passed to the call of run() that set up the cached
+         * graph.
+         */
+        std::vector<unsigned int> cached_targets;
+
+        /**
+         * The processes that sent requests to this process in the call of
+         * run() that set up the cached graph.
+         */
+        std::vector<unsigned int> requesting_processes;
+
+#ifdef DEAL_II_WITH_MPI
+        /**
+         * Distributed graph communicator with edges from the requesting
+         * processes to the targets, used to send the requests.
+         */
+        MPI_Comm request_comm = MPI_COMM_NULL;
+
+        /**
+         * Distributed graph communicator with edges from the targets to the
+         * requesting processes, used to send the answers.
+         */
+        MPI_Comm answer_comm = MPI_COMM_NULL;
+
+        /**
+         * Exchange the given buffers with the neighbors of the distributed
+         * graph communicator @p graph_comm, with @p send_buffers ordered
+         * like the destinations and the received buffers ordered like the
+         * sources of the graph.
+         */
+        static std::vector<std::vector<char>>
+        neighbor_exchange(const std::vector<std::vector<char>> &send_buffers,
+                          const unsigned int                    n_sources,
+                          const MPI_Comm                        graph_comm);
+#endif
+      };
+
+
+
       /**
        * This function implements a concrete algorithm for the
        * consensus algorithms problem (see the documentation of the
@@ -2155,6 +2285,236 @@ namespace Utilities
       }
 
 
+
+      template <typename RequestType, typename AnswerType>
+      CommunicationGraph<RequestType, AnswerType>::~CommunicationGraph()
+      {
+        clear();
+      }
+
+
+
+      template <typename RequestType, typename AnswerType>
+      void
+      CommunicationGraph<RequestType, AnswerType>::clear()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (request_comm != MPI_COMM_NULL)
+          Utilities::MPI::free_communicator(request_comm);
+        if (answer_comm != MPI_COMM_NULL)
+          Utilities::MPI::free_communicator(answer_comm);
+        request_comm = MPI_COMM_NULL;
+        answer_comm  = MPI_COMM_NULL;
+#  endif
+        cached_comm = MPI_COMM_NULL;
+        cached_targets.clear();
+        requesting_processes.clear();
+      }
+
+
+
+      template <typename RequestType, typename AnswerType>
+      std::vector<unsigned int>
+      CommunicationGraph<RequestType, AnswerType>::run(
+        const std::vector<unsigned int>                      &targets,
+        const std::function<RequestType(const unsigned int)> &create_request,
+        const std::function<AnswerType(const unsigned int, const RequestType &)>
+          &answer_request,
+        const std::function<void(const unsigned int, const AnswerType &)>
+                      &process_answer,
+        const MPI_Comm comm)
+      {
+        Assert(has_unique_elements(targets),
+               ExcMessage("The consensus algorithms expect that each process "
+                          "only sends a single message to another process, "
+                          "but the targets provided include duplicates."));
+
+        const unsigned int n_procs = (Utilities::MPI::job_supports_mpi() ?
+                                        Utilities::MPI::n_mpi_processes(comm) :
+                                        1);
+
+        // There is nothing to discover on a single process
+        if (n_procs == 1)
+          return Serial<RequestType, AnswerType>().run(
+            targets, create_request, answer_request, process_answer, comm);
+
+#  ifdef DEAL_II_WITH_MPI
+        // The cached graph can only be used if the targets are unchanged
+        // on all processes, since a process' requesting processes depend
+        // on the targets of the others
+        const bool targets_are_unchanged =
+          (comm == cached_comm) && (targets == cached_targets);
+        const bool graph_is_valid =
+          Utilities::MPI::min(static_cast<unsigned int>(targets_are_unchanged),
+                              comm) == 1;
+
+        if (graph_is_valid == false)
+          {
+            clear();
+
+            requesting_processes = Selector<RequestType, AnswerType>().run(
+              targets, create_request, answer_request, process_answer, comm);
+            std::sort(requesting_processes.begin(),
+                      requesting_processes.end());
+
+            cached_comm    = comm;
+            cached_targets = targets;
+
+            const std::vector<int> sources(requesting_processes.begin(),
+                                           requesting_processes.end());
+            const std::vector<int> destinations(targets.begin(),
+                                                targets.end());
+
+            int ierr = MPI_Dist_graph_create_adjacent(comm,
+                                                      sources.size(),
+                                                      sources.data(),
+                                                      MPI_UNWEIGHTED,
+                                                      destinations.size(),
+                                                      destinations.data(),
+                                                      MPI_UNWEIGHTED,
+                                                      MPI_INFO_NULL,
+                                                      false,
+                                                      &request_comm);
+            AssertThrowMPI(ierr);
+
+            ierr = MPI_Dist_graph_create_adjacent(comm,
+                                                  destinations.size(),
+                                                  destinations.data(),
+                                                  MPI_UNWEIGHTED,
+                                                  sources.size(),
+                                                  sources.data(),
+                                                  MPI_UNWEIGHTED,
+                                                  MPI_INFO_NULL,
+                                                  false,
+                                                  &answer_comm);
+            AssertThrowMPI(ierr);
+
+            return requesting_processes;
+          }
+
+        try
+          {
+            // 1) Send the requests along the edges of the cached graph
+            std::vector<std::vector<char>> send_buffers(targets.size());
+            for (unsigned int i = 0; i < targets.size(); ++i)
+              send_buffers[i] =
+                (create_request ?
+                   Utilities::pack(create_request(targets[i]), false) :
+                   std::vector<char>());
+
+            const std::vector<std::vector<char>> request_buffers =
+              neighbor_exchange(send_buffers,
+                                requesting_processes.size(),
+                                request_comm);
+
+            // 2) Answer the requests and send the answers back along the
+            //    reverse edges
+            send_buffers.clear();
+            send_buffers.resize(requesting_processes.size());
+            for (unsigned int i = 0; i < requesting_processes.size(); ++i)
+              {
+                const RequestType request =
+                  Utilities::unpack<RequestType>(request_buffers[i], false);
+                send_buffers[i] =
+                  (answer_request ?
+                     Utilities::pack(
+                       answer_request(requesting_processes[i], request),
+                       false) :
+                     std::vector<char>());
+              }
+
+            const std::vector<std::vector<char>> answer_buffers =
+              neighbor_exchange(send_buffers, targets.size(), answer_comm);
+
+            // 3) Process the answers
+            if (process_answer)
+              for (unsigned int i = 0; i < targets.size(); ++i)
+                process_answer(
+                  targets[i],
+                  Utilities::unpack<AnswerType>(answer_buffers[i], false));
+          }
+        catch (...)
+          {
+            handle_exception(std::current_exception(), comm);
+          }
+
+        return requesting_processes;
+#  else
+        DEAL_II_ASSERT_UNREACHABLE();
+        return {};
+#  endif
+      }
+
+
+
+#  ifdef DEAL_II_WITH_MPI
+      template <typename RequestType, typename AnswerType>
+      std::vector<std::vector<char>>
+      CommunicationGraph<RequestType, AnswerType>::neighbor_exchange(
+        const std::vector<std::vector<char>> &send_buffers,
+        const unsigned int                    n_sources,
+        const MPI_Comm                        graph_comm)
+      {
+        // Exchange the sizes of the messages first
+        std::size_t total_send_size = 0;
+        for (const auto &buffer : send_buffers)
+          total_send_size += buffer.size();
+        AssertThrow(total_send_size <=
+                      static_cast<std::size_t>(std::numeric_limits<int>::max()),
+                    ExcMessage("The messages are too large to be exchanged "
+                               "with MPI neighborhood collectives."));
+
+        std::vector<int> send_counts(send_buffers.size());
+        std::vector<int> send_displacements(send_buffers.size() + 1, 0);
+        for (unsigned int i = 0; i < send_buffers.size(); ++i)
+          {
+            send_counts[i]            = send_buffers[i].size();
+            send_displacements[i + 1] = send_displacements[i] + send_counts[i];
+          }
+
+        std::vector<int> recv_counts(n_sources);
+        int              ierr = MPI_Neighbor_alltoall(send_counts.data(),
+                                         1,
+                                         MPI_INT,
+                                         recv_counts.data(),
+                                         1,
+                                         MPI_INT,
+                                         graph_comm);
+        AssertThrowMPI(ierr);
+
+        std::vector<int> recv_displacements(n_sources + 1, 0);
+        for (unsigned int i = 0; i < n_sources; ++i)
+          recv_displacements[i + 1] = recv_displacements[i] + recv_counts[i];
+
+        // Then the messages themselves, contiguous in memory
+        std::vector<char> send_data(send_displacements.back());
+        for (unsigned int i = 0; i < send_buffers.size(); ++i)
+          std::copy(send_buffers[i].begin(),
+                    send_buffers[i].end(),
+                    send_data.begin() + send_displacements[i]);
+
+        std::vector<char> recv_data(recv_displacements.back());
+        ierr = MPI_Neighbor_alltoallv(send_data.data(),
+                                      send_counts.data(),
+                                      send_displacements.data(),
+                                      MPI_CHAR,
+                                      recv_data.data(),
+                                      recv_counts.data(),
+                                      recv_displacements.data(),
+                                      MPI_CHAR,
+                                      graph_comm);
+        AssertThrowMPI(ierr);
+
+        std::vector<std::vector<char>> recv_buffers(n_sources);
+        for (unsigned int i = 0; i < n_sources; ++i)
+          recv_buffers[i].assign(recv_data.begin() + recv_displacements[i],
+                                 recv_data.begin() + recv_displacements[i + 1]);
+
+        return recv_buffers;
+      }
+#  endif
+
+
     } // namespace ConsensusAlgorithms
   }   // end of namespace MPI
 } // end of namespace Utilities
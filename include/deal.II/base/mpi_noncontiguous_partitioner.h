@@ -90,6 +90,13 @@ namespace Utilities
        *   update_values_finish() in sequence. Users can call these two
        *   functions separately and hereby overlap communication and
        *   computation.
+       *
+       * @note This function uses buffers owned by this object. The MPI
+       *   requests for sending and receiving from these buffers are set up
+       *   as persistent requests at the first call and are only started in
+       *   subsequent calls with the same @p Number type, which avoids
+       *   the setup cost of the point-to-point messages when the same
+       *   exchange is performed many times.
        */
       template <typename Number>
       void
@@ -172,6 +179,10 @@ namespace Utilities
        * @note In contrast to the functions in
        *   Utilities::MPI::Partitioner, this function expects that
        *   locally_owned_storage is empty.
+       *
+       * @note As the export_to_ghosted_array() function with two arguments,
+       *   this function uses persistent MPI requests on buffers owned by
+       *   this object.
        */
       template <typename Number>
       void
@@ -327,6 +338,61 @@ namespace Utilities
        * @note Only allocated if not provided externally by user.
        */
       mutable std::vector<MPI_Request> requests;
+
+#ifdef DEAL_II_WITH_MPI
+      /**
+       * A set of persistent MPI requests on the internal buffers, together
+       * with the data type and the address of the buffer they have been set
+       * up for. Copies of this object do not share the requests but set up
+       * their own ones when needed.
+       */
+      struct PersistentRequests
+      {
+        PersistentRequests() = default;
+
+        PersistentRequests(const PersistentRequests &);
+
+        PersistentRequests &
+        operator=(const PersistentRequests &);
+
+        ~PersistentRequests();
+
+        /**
+         * Free the MPI requests.
+         */
+        void
+        clear();
+
+        std::vector<MPI_Request> requests;
+        MPI_Datatype             datatype = MPI_DATATYPE_NULL;
+        const void              *buffer   = nullptr;
+      };
+
+      /**
+       * Persistent requests for the export_to_ghosted_array() function that
+       * uses the internal buffers.
+       */
+      mutable PersistentRequests persistent_export_requests;
+
+      /**
+       * Persistent requests for the import_from_ghosted_array() function that
+       * uses the internal buffers.
+       */
+      mutable PersistentRequests persistent_import_requests;
+
+      /**
+       * Make sure that @p persistent_requests are set up for exchanging
+       * data of type @p Number via the internal buffers, in the direction of
+       * export_to_ghosted_array() if @p export_direction is true and of
+       * import_from_ghosted_array() otherwise. The requests are ordered
+       * as expected by export_to_ghosted_array_finish() and
+       * import_from_ghosted_array_finish(), respectively.
+       */
+      template <typename Number>
+      void
+      setup_persistent_requests(PersistentRequests &persistent_requests,
+                                const bool          export_direction) const;
+#endif
     };
 
   } // namespace MPI
@@ -31,27 +31,116 @@ namespace Utilities
 {
   namespace MPI
   {
+#ifdef DEAL_II_WITH_MPI
+    template <typename Number>
+    void
+    NoncontiguousPartitioner::setup_persistent_requests(
+      PersistentRequests &persistent_requests,
+      const bool          export_direction) const
+    {
+      if (this->buffers.size() != send_ptr.back() * sizeof(Number))
+        this->buffers.resize(this->temporary_storage_size() * sizeof(Number));
+
+      Number *buffer = reinterpret_cast<Number *>(this->buffers.data());
+
+      const MPI_Datatype datatype =
+        Utilities::MPI::mpi_type_id_for_type<Number>;
+      if (persistent_requests.datatype == datatype &&
+          persistent_requests.buffer == buffer &&
+          persistent_requests.requests.size() ==
+            send_ranks.size() + recv_ranks.size())
+        return;
+
+      persistent_requests.clear();
+      persistent_requests.requests.resize(send_ranks.size() +
+                                          recv_ranks.size());
+
+      const int tag =
+        internal::Tags::noncontiguous_partitioner_update_ghost_values_start;
+
+      const auto init_request = [&](const bool         send,
+                                    Number            *data,
+                                    const unsigned int count,
+                                    const unsigned int rank,
+                                    MPI_Request       &request) {
+        const int ierr =
+          send ?
+            MPI_Send_init(
+              data, count, datatype, rank, tag, communicator, &request) :
+            MPI_Recv_init(
+              data, count, datatype, rank, tag, communicator, &request);
+        AssertThrowMPI(ierr);
+      };
+
+      // the requests for the data sent to or received from send_ranks come
+      // first, followed by the ones of recv_ranks
+      for (types::global_dof_index i = 0; i < send_ranks.size(); ++i)
+        init_request(export_direction,
+                     buffer + send_ptr[i],
+                     send_ptr[i + 1] - send_ptr[i],
+                     send_ranks[i],
+                     persistent_requests.requests[i]);
+
+      for (types::global_dof_index i = 0; i < recv_ranks.size(); ++i)
+        init_request(!export_direction,
+                     buffer + recv_ptr[i],
+                     recv_ptr[i + 1] - recv_ptr[i],
+                     recv_ranks[i],
+                     persistent_requests.requests[i + send_ranks.size()]);
+
+      persistent_requests.datatype = datatype;
+      persistent_requests.buffer   = buffer;
+    }
+#endif
+
+
+
     template <typename Number>
     void
     NoncontiguousPartitioner::export_to_ghosted_array(
       const ArrayView<const Number> &src,
       const ArrayView<Number>       &dst) const
     {
-      // allocate internal memory since needed
-      if (requests.size() != send_ranks.size() + recv_ranks.size())
-        requests.resize(send_ranks.size() + recv_ranks.size());
+#ifndef DEAL_II_WITH_MPI
+      (void)src;
+      (void)dst;
+      Assert(false, ExcNeedsMPI());
+#else
+      setup_persistent_requests<Number>(persistent_export_requests, true);
 
-      if (this->buffers.size() != send_ptr.back() * sizeof(Number))
-        this->buffers.resize(this->temporary_storage_size() * sizeof(Number));
+      auto &persistent_requests = persistent_export_requests.requests;
+      const ArrayView<Number> buffers(
+        reinterpret_cast<Number *>(this->buffers.data()), send_ptr.back());
+
+      // start the receives
+      if (recv_ranks.size() > 0)
+        {
+          const int ierr =
+            MPI_Startall(recv_ranks.size(),
+                         persistent_requests.data() + send_ranks.size());
+          AssertThrowMPI(ierr);
+        }
 
-      // perform actual exchange
-      this->template export_to_ghosted_array<Number>(
-        0,
-        src,
-        ArrayView<Number>(reinterpret_cast<Number *>(this->buffers.data()),
-                          send_ptr.back()),
-        dst,
-        this->requests);
+      // collect the data to be sent and start the sends
+      for (types::global_dof_index i = 0, k = 0; i < send_ranks.size(); ++i)
+        for (types::global_dof_index j = send_ptr[i]; j < send_ptr[i + 1];
+             j++)
+          {
+            AssertIndexRange(k, send_indices.size());
+            buffers[j] = src[send_indices[k]];
+            ++k;
+          }
+
+      if (send_ranks.size() > 0)
+        {
+          const int ierr =
+            MPI_Startall(send_ranks.size(), persistent_requests.data());
+          AssertThrowMPI(ierr);
+        }
+
+      this->template export_to_ghosted_array_finish<Number>(
+        buffers, dst, persistent_requests);
+#endif
     }
 
 
@@ -196,22 +285,44 @@ namespace Utilities
       const ArrayView<Number>      &src,
       const ArrayView<Number>      &dst) const
     {
-      // allocate internal memory since needed
-      if (requests.size() != send_ranks.size() + recv_ranks.size())
-        requests.resize(send_ranks.size() + recv_ranks.size());
+#ifndef DEAL_II_WITH_MPI
+      (void)vector_operation;
+      (void)src;
+      (void)dst;
+      Assert(false, ExcNeedsMPI());
+#else
+      setup_persistent_requests<Number>(persistent_import_requests, false);
 
-      if (this->buffers.size() != send_ptr.back() * sizeof(Number))
-        this->buffers.resize(this->temporary_storage_size() * sizeof(Number));
+      auto &persistent_requests = persistent_import_requests.requests;
+      const ArrayView<Number> buffers(
+        reinterpret_cast<Number *>(this->buffers.data()), send_ptr.back());
 
-      // perform actual exchange
-      this->template import_from_ghosted_array<Number>(
-        vector_operation,
-        0,
-        src,
-        ArrayView<Number>(reinterpret_cast<Number *>(this->buffers.data()),
-                          send_ptr.back()),
-        dst,
-        this->requests);
+      // start the receives
+      if (send_ranks.size() > 0)
+        {
+          const int ierr =
+            MPI_Startall(send_ranks.size(), persistent_requests.data());
+          AssertThrowMPI(ierr);
+        }
+
+      // collect the data to be sent and start the sends
+      for (types::global_dof_index i = 0; i < recv_ranks.size(); ++i)
+        for (types::global_dof_index j = recv_ptr[i], c = 0;
+             j < recv_ptr[i + 1];
+             j++)
+          buffers[recv_ptr[i] + c++] = src[recv_indices[j]];
+
+      if (recv_ranks.size() > 0)
+        {
+          const int ierr =
+            MPI_Startall(recv_ranks.size(),
+                         persistent_requests.data() + send_ranks.size());
+          AssertThrowMPI(ierr);
+        }
+
+      this->template import_from_ghosted_array_finish<Number>(
+        vector_operation, buffers, dst, persistent_requests);
+#endif
     }
 
 
@@ -183,6 +183,33 @@ namespace Utilities
              const Triangulation<dim, spacedim>                        &tria,
              const Mapping<dim, spacedim> &mapping);
 
+      /**
+       * Update the internal data structures for new positions @p points of
+       * the points passed to the last call of reinit(), e.g., for points on
+       * an interface that moves by a fraction of a cell per time step.
+       *
+       * The new positions are sent to the processes that evaluate the
+       * points, which try to locate them in the same cells as before. If
+       * this succeeds for all points, only the reference points are updated
+       * and the communication pattern is kept, which avoids the global
+       * search of reinit(). Otherwise, i.e., if any point has left its cell,
+       * if not all points had been found before, or if the number of points
+       * has changed, the function falls back to calling reinit() with
+       * @p cache and @p points.
+       *
+       * @return The number of point-cell pairs, summed over all processes,
+       *   for which the point has left its cell. Zero means that the fast
+       *   path has been taken. If the fallback is taken for a reason other
+       *   than a point having left its cell, the total number of points is
+       *   returned.
+       *
+       * @warning This is a collective call that needs to be executed by all
+       *   processors in the communicator.
+       */
+      unsigned int
+      update_points(const GridTools::Cache<dim, spacedim> &cache,
+                    const std::vector<Point<spacedim>>    &points);
+
       /**
        * Helper class to store and to access data of points positioned in
        * processed cells.
@@ -316,6 +343,22 @@ namespace Utilities
                   &evaluation_function,
         const bool sort_data = true) const;
 
+      /**
+       * Same as the first function above, but with the number of components
+       * @p n_components only known at run time. This allows to evaluate
+       * several fields, e.g., all vectors to be written in a postprocessing
+       * step, with a single round of communication.
+       */
+      template <typename T>
+      void
+      evaluate_and_process(
+        std::vector<T> &output,
+        std::vector<T> &buffer,
+        const std::function<void(const ArrayView<T> &, const CellData &)>
+                          &evaluation_function,
+        const unsigned int n_components,
+        const bool         sort_data = true) const;
+
       /**
        * This method is the inverse of the method evaluate_and_process(). It
        * makes the data at the points, provided by @p input, available in the
@@ -713,11 +756,29 @@ namespace Utilities
                 &evaluation_function,
       const bool sort_data) const
     {
+      this->evaluate_and_process<T>(
+        output, buffer, evaluation_function, n_components, sort_data);
+    }
+
+
+
+    template <int dim, int spacedim>
+    template <typename T>
+    void
+    RemotePointEvaluation<dim, spacedim>::evaluate_and_process(
+      std::vector<T> &output,
+      std::vector<T> &buffer,
+      const std::function<void(const ArrayView<T> &, const CellData &)>
+                        &evaluation_function,
+      const unsigned int n_components,
+      const bool         sort_data) const
+    {
 #ifndef DEAL_II_WITH_MPI
       Assert(false, ExcNeedsMPI());
       (void)output;
       (void)buffer;
       (void)evaluation_function;
+      (void)n_components;
       (void)sort_data;
 #else
       static CollectiveMutex      mutex;
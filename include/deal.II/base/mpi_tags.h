@@ -152,6 +152,12 @@ namespace Utilities
           affine_constraints_make_consistent_in_parallel_0,
           affine_constraints_make_consistent_in_parallel_1,
 
+          // LinearAlgebra::StreamedMatrixAssembly
+          streamed_matrix_assembly,
+
+          // TimeStepping::Parareal
+          parareal,
+
         };
       } // namespace Tags
     }   // namespace internal
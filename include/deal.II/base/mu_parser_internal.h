@@ -116,6 +116,25 @@ namespace internal
       virtual ~muParserBase() = default;
     };
 
+    /**
+     * Base class for expressions that have been compiled to native code, see
+     * ParserImplementation::compile_expressions(). As for muParser, the
+     * compiler that is used is a purely internal dependency that is hidden
+     * with the PIMPL idiom.
+     */
+    class CompiledExpressionsBase
+    {
+    public:
+      virtual ~CompiledExpressionsBase() = default;
+
+      /**
+       * Return the value of the expression of component @p component for the
+       * values @p variables of the variables.
+       */
+      virtual double
+      evaluate(const unsigned int component, const double *variables) const = 0;
+    };
+
     /**
      * Class containing the mutable state required by muParser.
      *
@@ -179,6 +198,14 @@ namespace internal
       void
       init_muparser() const;
 
+      /**
+       * Try to compile the expressions into native code. This is the same as
+       * the inheriting class method - see
+       * FunctionParser::compile_expressions() for more information.
+       */
+      bool
+      compile_expressions();
+
       /**
        * Compute the value of a single component.
        */
@@ -209,6 +236,14 @@ namespace internal
       mutable Threads::ThreadLocalStorage<internal::FunctionParser::ParserData>
         parser_data;
 
+      /**
+       * The expressions compiled to native code, or a null pointer if
+       * compile_expressions() has not been called or has not succeeded. The
+       * compiled functions do not have any mutable state and can hence be
+       * shared between threads.
+       */
+      std::unique_ptr<const CompiledExpressionsBase> compiled_expressions;
+
       /**
        * An array to keep track of all the constants, required to initialize fp
        * in each thread.
@@ -122,6 +122,25 @@ public:
   static void
   initialize_multithreading();
 
+  /**
+   * Pin every thread that takes part in task-based parallel work to one of
+   * the cores the program is allowed to run on, going through the cores in
+   * order. Together with the affinity partitioners used by the thread
+   * parallel vector operations and by the MatrixFree loops, this makes sure
+   * that a given range of data is repeatedly worked on by the same thread,
+   * and thus resides in the caches and in the NUMA domain of that thread's
+   * core after it has been touched first. This is useful for hybrid MPI and
+   * thread parallel runs with one MPI rank per socket or node, where the
+   * operating system would otherwise be free to migrate threads between
+   * sockets.
+   *
+   * Threads are pinned when they next enter the TBB scheduler and remain
+   * pinned for the rest of the program. This function only has an effect
+   * on Linux systems and if deal.II was configured with TBB.
+   */
+  static void
+  pin_threads();
+
 
 #  ifdef DEAL_II_WITH_TASKFLOW
   /**
@@ -129,6 +129,12 @@ namespace internal
       8;
 #elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__SSE2__)
       4;
+#elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 512 && \
+  defined(__ARM_FEATURE_SVE_BITS)
+      16;
+#elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256 && \
+  defined(__ARM_FEATURE_SVE_BITS)
+      8;
 #elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__ARM_NEON)
       4;
 #else
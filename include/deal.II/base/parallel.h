@@ -695,6 +695,30 @@ namespace parallel
       Threads::Mutex mutex;
 #endif
     };
+
+
+
+    /**
+     * Like parallel::apply_to_subranges(), but use the affinity partitioner
+     * stored in @p partitioner to split the range <code>[begin,end)</code>.
+     * The affinity partitioner records which thread worked on which subrange
+     * and tries to assign the same subranges to the same threads in
+     * subsequent calls with the same partitioner. If the first loop over the
+     * range is the one that initializes (first touches) some memory, then
+     * this means that subsequent loops run on the threads in whose NUMA
+     * domain the memory has been placed.
+     *
+     * If @p partitioner is a null pointer, this function falls back to
+     * parallel::apply_to_subranges().
+     */
+    template <typename Function>
+    void
+    apply_to_subranges_with_affinity(
+      const std::size_t                      begin,
+      const std::size_t                      end,
+      const Function                        &f,
+      const unsigned int                     grainsize,
+      const std::shared_ptr<TBBPartitioner> &partitioner);
   } // namespace internal
 } // namespace parallel
 
@@ -761,6 +785,49 @@ namespace parallel
 #endif
   }
 
+
+
+  namespace internal
+  {
+    template <typename Function>
+    void
+    apply_to_subranges_with_affinity(
+      const std::size_t                      begin,
+      const std::size_t                      end,
+      const Function                        &f,
+      const unsigned int                     grainsize,
+      const std::shared_ptr<TBBPartitioner> &partitioner)
+    {
+#ifndef DEAL_II_WITH_TBB
+      // make sure we don't get compiler
+      // warnings about unused arguments
+      (void)grainsize;
+      (void)partitioner;
+
+      if (begin < end)
+        f(begin, end);
+#else
+      if (partitioner.get() == nullptr)
+        {
+          ::dealii::parallel::apply_to_subranges(begin, end, f, grainsize);
+          return;
+        }
+
+      std::shared_ptr<tbb::affinity_partitioner> tbb_partitioner =
+        partitioner->acquire_one_partitioner();
+      parallel_for(
+        begin,
+        end,
+        [&f](const tbb::blocked_range<std::size_t> &range) {
+          f(range.begin(), range.end());
+        },
+        grainsize,
+        tbb_partitioner);
+      partitioner->release_one_partitioner(tbb_partitioner);
+#endif
+    }
+  } // namespace internal
+
 } // end of namespace parallel
 
 DEAL_II_NAMESPACE_CLOSE
@@ -30,6 +30,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -449,6 +450,21 @@ class MultipleParameterLoop;
  * classes should call the <tt>BaseClass::get_parameters</tt> function.
  *
  *
+ * <h3>Repeated access to parameter values</h3>
+ *
+ * Every call to get() and its typed variants looks up the entry in the tree
+ * of all parameters and converts the stored string to the requested type.
+ * Programs that query parameters many times, for example in every time step,
+ * can instead call create_snapshot() once after the input has been read. The
+ * returned ParameterHandler::Snapshot object stores the values of all
+ * entries together with their conversions to integers, floating point
+ * numbers, and booleans, and gives access to them through a hash table or,
+ * in constant time, through the index of an entry. Since it never changes
+ * after its construction, it can be read from several threads concurrently
+ * without any synchronization. Later changes to the ParameterHandler object
+ * are not reflected in the snapshot.
+ *
+ *
  * <h3>Experience with large parameter lists</h3>
  *
  * Experience has shown that in programs defining larger numbers of parameters
@@ -1378,6 +1394,16 @@ public:
   get_bool(const std::vector<std::string> &entry_subsection_path,
            const std::string              &entry_string) const;
 
+  class Snapshot;
+
+  /**
+   * Return a read-only copy of the current values of all entries, with the
+   * values already converted to the types of the typed get functions. See
+   * the documentation of the Snapshot class.
+   */
+  Snapshot
+  create_snapshot() const;
+
   /**
    * Change the value presently stored for <tt>entry_name</tt> to the one
    * given in the second argument.
@@ -1860,6 +1886,174 @@ private:
   friend class MultipleParameterLoop;
 };
 
+
+/**
+ * A read-only copy of the values of all entries of a ParameterHandler
+ * object, as returned by ParameterHandler::create_snapshot().
+ *
+ * In contrast to the ParameterHandler class, which stores its entries as
+ * strings in a tree and looks them up and converts them on every access,
+ * this class converts each value once, upon construction, to an integer,
+ * a floating point number, and a boolean, wherever the value allows for it.
+ * Entries are found through a hash table from the path of the entry. In
+ * addition, each entry has an index, obtained from entry_index(), through
+ * which its value can be accessed in constant time. This makes the class
+ * suitable for querying parameters in the innermost loops of a program:
+ *   @code
+ *     const ParameterHandler::Snapshot parameters = prm.create_snapshot();
+ *     const unsigned int viscosity_index =
+ *       parameters.entry_index({"Physics"}, "Viscosity");
+ *
+ *     for (...)
+ *       {
+ *         const double viscosity = parameters.get_double(viscosity_index);
+ *         ...
+ *       }
+ *   @endcode
+ *
+ * Paths of entries are always given relative to the top level, independent
+ * of the subsection that the ParameterHandler object was in when the
+ * snapshot was created. Aliases declared by
+ * ParameterHandler::declare_alias() refer to the same entry as the entry
+ * they stand for.
+ *
+ * Since objects of this class are not modified after their construction,
+ * all member functions can be called from several threads concurrently.
+ */
+class ParameterHandler::Snapshot
+{
+public:
+  /**
+   * Constructor. Copy and convert the current values of all entries of
+   * @p prm.
+   */
+  explicit Snapshot(const ParameterHandler &prm);
+
+  /**
+   * Return the number of entries, i.e., one more than the largest index
+   * returned by entry_index().
+   */
+  unsigned int
+  n_entries() const;
+
+  /**
+   * Return the index of the entry @p entry_string in the subsection given
+   * by @p entry_subsection_path, which is a path from the top level (with an
+   * empty path denoting an entry at the top level). An exception of type
+   * ParameterHandler::ExcEntryUndeclared is thrown if there is no such
+   * entry.
+   */
+  unsigned int
+  entry_index(const std::vector<std::string> &entry_subsection_path,
+              const std::string              &entry_string) const;
+
+  /**
+   * Return the value of the entry with index @p index.
+   */
+  const std::string &
+  get(const unsigned int index) const;
+
+  /**
+   * Return the value of the entry @p entry_string in the subsection given
+   * by @p entry_subsection_path.
+   */
+  const std::string &
+  get(const std::vector<std::string> &entry_subsection_path,
+      const std::string              &entry_string) const;
+
+  /**
+   * Return the value of the entry with index @p index as
+   * <code>long int</code>. An exception is thrown if the value can not be
+   * converted.
+   */
+  long int
+  get_integer(const unsigned int index) const;
+
+  /**
+   * Return the value of the entry @p entry_string in the subsection given
+   * by @p entry_subsection_path as <code>long int</code>.
+   */
+  long int
+  get_integer(const std::vector<std::string> &entry_subsection_path,
+              const std::string              &entry_string) const;
+
+  /**
+   * Return the value of the entry with index @p index as @p double. An
+   * exception is thrown if the value can not be converted.
+   */
+  double
+  get_double(const unsigned int index) const;
+
+  /**
+   * Return the value of the entry @p entry_string in the subsection given
+   * by @p entry_subsection_path as @p double.
+   */
+  double
+  get_double(const std::vector<std::string> &entry_subsection_path,
+             const std::string              &entry_string) const;
+
+  /**
+   * Return the value of the entry with index @p index as @p bool, where
+   * "true" and "yes" stand for @p true, and "false" and "no" for
+   * @p false. An exception is thrown if the value is none of these.
+   */
+  bool
+  get_bool(const unsigned int index) const;
+
+  /**
+   * Return the value of the entry @p entry_string in the subsection given
+   * by @p entry_subsection_path as @p bool.
+   */
+  bool
+  get_bool(const std::vector<std::string> &entry_subsection_path,
+           const std::string              &entry_string) const;
+
+private:
+  /**
+   * The value of an entry together with its conversions.
+   */
+  struct Entry
+  {
+    /**
+     * The full path of the entry, used in error messages.
+     */
+    std::string name;
+
+    /**
+     * The value as stored in the ParameterHandler object.
+     */
+    std::string value;
+
+    /**
+     * Whether the value can be converted to an integer, a floating point
+     * number, and a boolean, respectively.
+     */
+    bool is_integer;
+    bool is_double;
+    bool is_bool;
+
+    /**
+     * The converted values, valid if the respective flag is set.
+     */
+    long int integer_value;
+    double   double_value;
+    bool     bool_value;
+  };
+
+  /**
+   * The entries, in the order in which they appear in the tree of the
+   * ParameterHandler object.
+   */
+  std::vector<Entry> entries;
+
+  /**
+   * A map from the path of each entry and alias, mangled and joined as in
+   * the ParameterHandler class, to the index of the entry.
+   */
+  std::unordered_map<std::string, unsigned int> entry_indices;
+};
+
+
 /**
  * Global operator which returns an object in which all bits are set which are
  * either set in the first or the second argument. This operator exists since
@@ -2364,6 +2558,62 @@ ParameterHandler::add_parameter(const std::string           &entry,
   add_action(entry, action, false);
 }
 
+
+inline unsigned int
+ParameterHandler::Snapshot::n_entries() const
+{
+  return entries.size();
+}
+
+
+
+inline const std::string &
+ParameterHandler::Snapshot::get(const unsigned int index) const
+{
+  AssertIndexRange(index, entries.size());
+  return entries[index].value;
+}
+
+
+
+inline long int
+ParameterHandler::Snapshot::get_integer(const unsigned int index) const
+{
+  AssertIndexRange(index, entries.size());
+  const Entry &entry = entries[index];
+  AssertThrow(entry.is_integer,
+              ExcMessage("Can't convert the parameter value <" + entry.value +
+                         "> for entry <" + entry.name + "> to an integer."));
+  return entry.integer_value;
+}
+
+
+
+inline double
+ParameterHandler::Snapshot::get_double(const unsigned int index) const
+{
+  AssertIndexRange(index, entries.size());
+  const Entry &entry = entries[index];
+  AssertThrow(entry.is_double,
+              ExcMessage("Can't convert the parameter value <" + entry.value +
+                         "> for entry <" + entry.name +
+                         "> to a double precision variable."));
+  return entry.double_value;
+}
+
+
+
+inline bool
+ParameterHandler::Snapshot::get_bool(const unsigned int index) const
+{
+  AssertIndexRange(index, entries.size());
+  const Entry &entry = entries[index];
+  AssertThrow(entry.is_bool,
+              ExcMessage("Can't convert the parameter value <" + entry.value +
+                         "> for entry <" + entry.name + "> to a boolean."));
+  return entry.bool_value;
+}
+
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
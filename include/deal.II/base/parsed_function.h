@@ -183,6 +183,16 @@ namespace Functions
     void
     parse_parameters(ParameterHandler &prm);
 
+    /**
+     * Try to compile the expression read by parse_parameters() into native
+     * code. See FunctionParser::compile_expressions() for details. A
+     * subsequent call to parse_parameters() discards the compiled expression.
+     *
+     * @return Whether the expression has been compiled.
+     */
+    bool
+    compile_expressions();
+
     /**
      * Return all components of a vector-valued function at the given point @p
      * p.
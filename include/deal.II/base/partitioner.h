@@ -284,6 +284,28 @@ namespace Utilities
       set_ghost_indices(const IndexSet &ghost_indices,
                         const IndexSet &larger_ghost_index_set = IndexSet());
 
+      /**
+       * Same as the function above, but with the ranks of the processes
+       * owning the ghost indices already known, e.g. from another
+       * Partitioner object whose ghost indices are a superset of the given
+       * ones. @p ghost_owners contains the owning rank for each element of
+       * @p ghost_indices in ascending order of the indices, without the
+       * locally owned indices.
+       *
+       * This skips the lookup of the owners via the dictionary-based
+       * consensus algorithm of Utilities::MPI::compute_index_owner(), which
+       * needs several rounds of communication. The only communication
+       * needed is to inform the owners about the indices they have to send,
+       * which is done with a single sparse exchange.
+       *
+       * @note This function is collective, and all processes need to call it
+       * (rather than the function above) at the same time.
+       */
+      void
+      set_ghost_indices(const IndexSet                  &ghost_indices,
+                        const std::vector<unsigned int> &ghost_owners,
+                        const IndexSet &larger_ghost_index_set = IndexSet());
+
       /**
        * Return the global size.
        */
@@ -668,12 +690,24 @@ namespace Utilities
 
     private:
       /**
-       * Initialize import_indices_plain_dev from import_indices_data. This
-       * function is only used when using @ref GlossDevice "device"-aware MPI.
+       * Initialize import_indices_plain_dev and import_indices_all_plain_dev
+       * from import_indices_data. This function is only used when using
+       * @ref GlossDevice "device"-aware MPI.
        */
       void
       initialize_import_indices_plain_dev() const;
 
+      /**
+       * Implementation of the set_ghost_indices() functions. If
+       * @p ghost_owners is a null pointer, the owners of the ghost indices
+       * are determined by a consensus algorithm.
+       */
+      void
+      set_ghost_indices_and_owners(
+        const IndexSet                  &ghost_indices,
+        const std::vector<unsigned int> *ghost_owners,
+        const IndexSet                  &larger_ghost_index_set);
+
       /**
        * The global size of the vector over all processors
        */
@@ -729,6 +763,16 @@ namespace Utilities
         Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>>
         import_indices_plain_dev;
 
+      /**
+       * The same indices as in import_indices_plain_dev, but concatenated
+       * over all import targets in the order in which the data is sent. This
+       * allows to pack the data for all targets with a single kernel launch.
+       * This variable is only used when using
+       * @ref GlossDevice "device"-aware MPI.
+       */
+      mutable Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        import_indices_all_plain_dev;
+
       /**
        * A variable caching the number of ghost indices. It would be expensive
        * to compute it by iterating over the import indices and accumulate them.
@@ -19,6 +19,7 @@
 
 #include <deal.II/base/mpi_tags.h>
 #include <deal.II/base/partitioner.h>
+#include <deal.II/base/trace.h>
 
 #include <deal.II/lac/la_parallel_vector.h>
 
@@ -45,6 +46,9 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType>       &ghost_array,
       std::vector<MPI_Request>                       &requests) const
     {
+      const Trace::Scope trace_scope(
+        "Partitioner::export_to_ghosted_array_start");
+
       AssertDimension(temporary_storage.size(), n_import_indices());
       AssertIndexRange(communication_channel, 200);
       Assert(ghost_array.size() == n_ghost_indices() ||
@@ -113,31 +117,36 @@ namespace Utilities
       if ((std::is_same_v<MemorySpaceType, MemorySpace::Default>)&&(
             import_indices_plain_dev.empty()))
         initialize_import_indices_plain_dev();
+
+      // Pack the data for all import targets with a single kernel, such that
+      // we only need to wait once for the device before handing the device
+      // pointers to MPI
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
+        if (n_import_targets > 0)
+          {
+            const auto n_indices = import_indices_all_plain_dev.size();
+            using IndexType      = decltype(n_indices);
+
+            auto import_indices           = import_indices_all_plain_dev;
+            auto locally_owned_array_data = locally_owned_array.data();
+            MemorySpace::Default::kokkos_space::execution_space exec;
+            Kokkos::parallel_for(
+              "dealii::fill temp_array_ptr",
+              Kokkos::RangePolicy<
+                MemorySpace::Default::kokkos_space::execution_space>(
+                exec, 0, n_indices),
+              KOKKOS_LAMBDA(IndexType idx) {
+                temp_array_ptr[idx] =
+                  locally_owned_array_data[import_indices[idx]];
+              });
+            exec.fence();
+          }
 #    endif
 
       for (unsigned int i = 0; i < n_import_targets; ++i)
         {
 #    if defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
-          if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
-            {
-              const auto chunk_size = import_indices_plain_dev[i].size();
-              using IndexType       = decltype(chunk_size);
-
-              auto import_indices           = import_indices_plain_dev[i];
-              auto locally_owned_array_data = locally_owned_array.data();
-              MemorySpace::Default::kokkos_space::execution_space exec;
-              Kokkos::parallel_for(
-                "dealii::fill temp_array_ptr",
-                Kokkos::RangePolicy<
-                  MemorySpace::Default::kokkos_space::execution_space>(
-                  exec, 0, chunk_size),
-                KOKKOS_LAMBDA(IndexType idx) {
-                  temp_array_ptr[idx] =
-                    locally_owned_array_data[import_indices[idx]];
-                });
-              exec.fence();
-            }
-          else
+          if constexpr (!std::is_same_v<MemorySpaceType, MemorySpace::Default>)
 #    endif
             {
               // copy the data to be sent to the import_data field
@@ -184,6 +193,9 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType> &ghost_array,
       std::vector<MPI_Request>                 &requests) const
     {
+      const Trace::Scope trace_scope(
+        "Partitioner::export_to_ghosted_array_finish");
+
       Assert(ghost_array.size() == n_ghost_indices() ||
                ghost_array.size() == n_ghost_indices_in_larger_set,
              ExcGhostIndexArrayHasWrongSize(ghost_array.size(),
@@ -296,6 +308,9 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType> &temporary_storage,
       std::vector<MPI_Request>                 &requests) const
     {
+      const Trace::Scope trace_scope(
+        "Partitioner::import_from_ghosted_array_start");
+
       AssertDimension(temporary_storage.size(), n_import_indices());
       AssertIndexRange(communication_channel, 200);
       Assert(ghost_array.size() == n_ghost_indices() ||
@@ -536,6 +551,9 @@ namespace Utilities
       const ArrayView<Number, MemorySpaceType>       &ghost_array,
       std::vector<MPI_Request>                       &requests) const
     {
+      const Trace::Scope trace_scope(
+        "Partitioner::import_from_ghosted_array_finish");
+
       AssertDimension(temporary_storage.size(), n_import_indices());
       Assert(ghost_array.size() == n_ghost_indices() ||
                ghost_array.size() == n_ghost_indices_in_larger_set,
@@ -184,6 +184,15 @@ public:
   Number
   value(const Point<dim> &point) const;
 
+  /**
+   * Evaluate the polynomial at a point whose coordinates are of type
+   * @p Number2, e.g., VectorizedArray<double> to evaluate the polynomial at
+   * a batch of points at once.
+   */
+  template <typename Number2>
+  Number2
+  value(const Point<dim, Number2> &point) const;
+
   /**
    * Return an estimate, in bytes, of the memory usage of the object.
    */
@@ -196,6 +205,14 @@ protected:
    */
   Table<dim + 1, Number> coefficients;
 
+  /**
+   * Implementation of the value() functions, accumulating in the type
+   * @p ResultType.
+   */
+  template <typename ResultType, typename Number2>
+  ResultType
+  compute_value(const Point<dim, Number2> &point) const;
+
   /**
    * Utility function for barycentric polynomials: it is convenient to loop
    * over all the indices at once in a dimension-independent way, but we also
@@ -663,13 +680,35 @@ template <int dim, typename Number>
 Number
 BarycentricPolynomial<dim, Number>::value(const Point<dim> &point) const
 {
-  // TODO: this is probably not numerically stable for higher order.
-  // We really need some version of Horner's method.
-  Number result = {};
+  return compute_value<Number>(point);
+}
+
+
+
+template <int dim, typename Number>
+template <typename Number2>
+Number2
+BarycentricPolynomial<dim, Number>::value(
+  const Point<dim, Number2> &point) const
+{
+  return compute_value<Number2>(point);
+}
+
+
+
+template <int dim, typename Number>
+template <typename ResultType, typename Number2>
+ResultType
+BarycentricPolynomial<dim, Number>::compute_value(
+  const Point<dim, Number2> &point) const
+{
+  ResultType result = {};
+  if (coefficients.n_elements() == 0)
+    return result;
 
   // Begin by converting point (which is in Cartesian coordinates) to
   // barycentric coordinates:
-  std::array<Number, dim + 1> b_point;
+  std::array<Number2, dim + 1> b_point;
   b_point[0] = 1.0;
   for (unsigned int d = 0; d < dim; ++d)
     {
@@ -677,18 +716,33 @@ BarycentricPolynomial<dim, Number>::value(const Point<dim> &point) const
       b_point[d + 1] = point[d];
     }
 
-  // Now evaluate the polynomial at the computed barycentric point:
-  for (std::size_t i = 0; i < coefficients.n_elements(); ++i)
+  // Now evaluate the polynomial at the computed barycentric point. The
+  // coefficients with the same exponents in all but the last barycentric
+  // coordinate are stored contiguously, so we evaluate each of these rows
+  // with Horner's scheme in the last coordinate and multiply the result by
+  // the powers of the other coordinates.
+  const auto         extents = coefficients.size();
+  const unsigned int n_last  = extents[dim];
+  for (std::size_t row = 0; row < coefficients.n_elements(); row += n_last)
     {
-      const auto indices = index_to_indices(i, coefficients.size());
-      const auto coef    = coefficients(indices);
-      if (coef == Number())
+      auto indices = index_to_indices(row, extents);
+
+      bool       row_is_zero = true;
+      ResultType row_value   = {};
+      for (unsigned int i = n_last; i-- > 0;)
+        {
+          indices[dim]    = i;
+          const auto coef = coefficients(indices);
+          row_is_zero     = row_is_zero && (coef == Number());
+          row_value       = row_value * b_point[dim] + coef;
+        }
+      if (row_is_zero)
         continue;
 
-      auto temp = Number(1);
-      for (unsigned int d = 0; d < dim + 1; ++d)
-        temp *= Utilities::pow(b_point[d], indices[d]);
-      result += coef * temp;
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int e = 0; e < indices[d]; ++e)
+          row_value *= b_point[d];
+      result += row_value;
     }
 
   return result;
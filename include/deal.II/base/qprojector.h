@@ -23,6 +23,8 @@
 
 #include <deal.II/hp/q_collection.h>
 
+#include <memory>
+
 DEAL_II_NAMESPACE_OPEN
 
 #ifndef DOXYGEN
@@ -225,6 +227,46 @@ public:
   project_to_all_subfaces(const ReferenceCell &reference_cell,
                           const SubQuadrature &quadrature);
 
+  /**
+   * Like project_to_all_faces(), but return an object that is shared among
+   * all callers asking for the projection of the same quadrature formulas to
+   * the same reference cell. The projection is only computed upon the first
+   * such request and is then kept in a global table as long as some caller
+   * still holds a pointer to it. Projections that are no longer used are
+   * released, so that creating FEFaceValues objects with many different
+   * quadrature formulas, e.g., one per cut face in NonMatching::FEValues,
+   * does not accumulate memory.
+   *
+   * Finite elements and mappings use this function when they set up the
+   * data of FEFaceValues objects. These objects are often created many times
+   * with the same quadrature formula, for example once per thread in the
+   * scratch data of WorkStream::run(), and then all access the points of
+   * single faces in the same projected formula via the offsets provided by
+   * DataSetDescriptor.
+   *
+   * This function is thread-safe.
+   */
+  static std::shared_ptr<const Quadrature<dim>>
+  project_to_all_faces_shared(const ReferenceCell            &reference_cell,
+                              const hp::QCollection<dim - 1> &quadrature);
+
+  /**
+   * Like the above function, applying the same face quadrature formula on all
+   * faces.
+   */
+  static std::shared_ptr<const Quadrature<dim>>
+  project_to_all_faces_shared(const ReferenceCell       &reference_cell,
+                              const Quadrature<dim - 1> &quadrature);
+
+  /**
+   * Like project_to_all_subfaces(), but return an object that is shared
+   * among all callers asking for the same projection. See
+   * project_to_all_faces_shared() for more information.
+   */
+  static std::shared_ptr<const Quadrature<dim>>
+  project_to_all_subfaces_shared(const ReferenceCell &reference_cell,
+                                 const SubQuadrature &quadrature);
+
   /**
    * Project a given quadrature formula to a child of a cell. You may want to
    * use this function in case you want to extend an integral only over the
@@ -483,6 +525,18 @@ Quadrature<dim> inline QProjector<dim>::project_to_all_faces(
 }
 
 
+
+template <int dim>
+inline std::shared_ptr<const Quadrature<dim>>
+QProjector<dim>::project_to_all_faces_shared(
+  const ReferenceCell       &reference_cell,
+  const Quadrature<dim - 1> &quadrature)
+{
+  return project_to_all_faces_shared(reference_cell,
+                                     hp::QCollection<dim - 1>(quadrature));
+}
+
+
 /* -------------- declaration of explicit specializations ------------- */
 
 #ifndef DOXYGEN
@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/quadrature.h>
 #include <deal.II/base/subscriptor.h>
 
@@ -254,6 +256,183 @@ private:
 };
 
 
+/**
+ * A class for storing at each locally owned active cell represented by
+ * iterators of type @p CellIteratorType a vector of objects of type
+ * @p DataType, in a layout that is more efficient to access than the one of
+ * CellDataStorage.
+ *
+ * CellDataStorage stores a separately allocated object for each quadrature
+ * point, accessed through shared pointers, in a std::map keyed by the CellId
+ * of the cells. This allows to store objects of different derived classes on
+ * different cells, but accessing the data of a cell during assembly requires
+ * a lookup in the map, the creation of a vector of shared pointers, and
+ * following a pointer for each quadrature point. In contrast, this class
+ * stores the objects of all cells by value in a single contiguous array,
+ * where the objects of the quadrature points of one cell are adjacent and
+ * the cells are ordered by their CellAccessor::active_cell_index(). Finding
+ * the data of a cell is then a simple index computation, and get_data()
+ * returns an ArrayView into the array. In particular, the data of the cells
+ * can be accessed from several threads, e.g., within WorkStream::run() or
+ * MatrixFree::cell_loop(), without any synchronization, as long as
+ * different threads work on different cells.
+ *
+ * The price for this is that all objects have to be of the same type
+ * @p DataType, and that the data is tied to the numbering of the active
+ * cells: Once the triangulation has changed, the object has to be set up
+ * anew with initialize(). Data can be carried over to the new mesh using
+ * parallel::distributed::ContinuousQuadratureDataTransfer if @p DataType is
+ * derived from TransferableQuadraturePointData, in the same way as for
+ * CellDataStorage:
+ * @code
+ * ContiguousCellDataStorage<typename Triangulation<dim>::cell_iterator,
+ *                           MyQData> data_storage;
+ * data_storage.initialize(triangulation.begin_active(),
+ *                         triangulation.end(),
+ *                         n_q_points);
+ * ...
+ * parallel::distributed::ContinuousQuadratureDataTransfer<dim, MyQData>
+ *   data_transfer(FE_Q<dim>(2), QGauss<dim>(3), QGauss<dim>(4));
+ * data_transfer.prepare_for_coarsening_and_refinement(triangulation,
+ *                                                     data_storage);
+ * triangulation.execute_coarsening_and_refinement();
+ * data_storage.initialize(triangulation.begin_active(),
+ *                         triangulation.end(),
+ *                         n_q_points);
+ * data_transfer.interpolate();
+ * @endcode
+ *
+ * @pre @p DataType needs to be default constructible.
+ */
+template <typename CellIteratorType, typename DataType>
+class ContiguousCellDataStorage : public Subscriptor
+{
+public:
+  /**
+   * Default constructor.
+   */
+  ContiguousCellDataStorage() = default;
+
+  /**
+   * Default destructor.
+   */
+  ~ContiguousCellDataStorage() override = default;
+
+  /**
+   * Initialize data for @p number_of_data_points_per_cell default constructed
+   * objects of type @p DataType on all locally owned active cells of the
+   * range of iterators starting at @p cell_start until, but not including,
+   * @p cell_end. All data previously stored in this object is discarded, so
+   * this function has to be called with all cells on which data is to be
+   * stored at once, and again after each change of the triangulation.
+   *
+   * @note This function stores a SmartPointer to the Triangulation object
+   * that owns the cells. The other member functions expect their cell
+   * arguments to be from the same triangulation.
+   */
+  void
+  initialize(
+    const CellIteratorType                                          &cell_start,
+    const typename std_cxx20::type_identity<CellIteratorType>::type &cell_end,
+    const unsigned int number_of_data_points_per_cell);
+
+  /**
+   * Clear all the data stored in this object.
+   */
+  void
+  clear();
+
+  /**
+   * Get a view to the data located at @p cell.
+   *
+   * @pre Data must have been initialized on @p cell, and @p cell must be
+   * from the same Triangulation that is used to initialize() the cell data.
+   */
+  ArrayView<DataType>
+  get_data(const CellIteratorType &cell);
+
+  /**
+   * Get a view to the constant data located at @p cell.
+   *
+   * @pre Data must have been initialized on @p cell, and @p cell must be
+   * from the same Triangulation that is used to initialize() the cell data.
+   */
+  ArrayView<const DataType>
+  get_data(const CellIteratorType &cell) const;
+
+  /**
+   * Returns a std::optional indicating whether @p cell contains an
+   * associated data or not. If data is available, dereferencing the
+   * std::optional reveals a view to the data at the quadrature points.
+   *
+   * @pre @p cell must be from the same Triangulation that is used to
+   * initialize() the cell data.
+   */
+  std::optional<ArrayView<DataType>>
+  try_get_data(const CellIteratorType &cell);
+
+  /**
+   * Returns a std::optional indicating whether @p cell contains an
+   * associated data or not. If data is available, dereferencing the
+   * std::optional reveals a view to the constant data at the quadrature
+   * points.
+   *
+   * @pre @p cell must be from the same Triangulation that is used to
+   * initialize() the cell data.
+   */
+  std::optional<ArrayView<const DataType>>
+  try_get_data(const CellIteratorType &cell) const;
+
+  /**
+   * Return an estimate for the memory consumption (in bytes) of this object,
+   * not counting memory allocated by the objects of type @p DataType
+   * themselves.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Number of dimensions
+   */
+  static constexpr unsigned int dimension =
+    CellIteratorType::AccessorType::dimension;
+
+  /**
+   * Number of space dimensions
+   */
+  static constexpr unsigned int space_dimension =
+    CellIteratorType::AccessorType::space_dimension;
+
+  /**
+   * The triangulation whose active cells index the stored data.
+   */
+  SmartPointer<const Triangulation<dimension, space_dimension>,
+               ContiguousCellDataStorage<CellIteratorType, DataType>>
+    tria;
+
+  /**
+   * The position of the data of each active cell within the @p data array,
+   * indexed by the active cell index. The data of a cell ranges from
+   * <code>cell_offsets[c]</code> to <code>cell_offsets[c+1]</code>, which is
+   * an empty range for cells without data.
+   */
+  std::vector<std::size_t> cell_offsets;
+
+  /**
+   * The data of all cells.
+   */
+  std::vector<DataType> data;
+
+  /**
+   * @addtogroup Exceptions
+   */
+  DeclExceptionMsg(
+    ExcTriangulationMismatch,
+    "The provided cell iterator does not belong to the triangulation that corresponds to the ContiguousCellDataStorage object.");
+};
+
+
 /**
  * An abstract class which specifies requirements for data on
  * a single quadrature point to be transferable during refinement or
@@ -478,6 +657,18 @@ namespace parallel
         parallel::distributed::Triangulation<dim>   &tria,
         CellDataStorage<CellIteratorType, DataType> &data_storage);
 
+      /**
+       * Same as above, for data stored in a ContiguousCellDataStorage object.
+       * Since the data of such an object is tied to the numbering of the
+       * active cells, it has to be set up anew with
+       * ContiguousCellDataStorage::initialize() after the mesh has changed
+       * and before interpolate() is called.
+       */
+      void
+      prepare_for_coarsening_and_refinement(
+        parallel::distributed::Triangulation<dim>             &tria,
+        ContiguousCellDataStorage<CellIteratorType, DataType> &data_storage);
+
       /**
        * Interpolate the data previously stored in this object before the mesh
        * was refined or coarsened onto the quadrature points of the currently
@@ -574,6 +765,14 @@ namespace parallel
        */
       CellDataStorage<CellIteratorType, DataType> *data_storage;
 
+      /**
+       * A pointer to the ContiguousCellDataStorage class whose data will be
+       * transferred, if that one was provided instead of a CellDataStorage
+       * object.
+       */
+      ContiguousCellDataStorage<CellIteratorType, DataType>
+        *contiguous_data_storage;
+
       /**
        * A pointer to the distributed triangulation to which cell data is
        * attached.
@@ -804,6 +1003,132 @@ CellDataStorage<CellIteratorType, DataType>::try_get_data(
     }
 }
 
+//--------------------------------------------------------------------
+//                    ContiguousCellDataStorage
+//--------------------------------------------------------------------
+
+template <typename CellIteratorType, typename DataType>
+inline void
+ContiguousCellDataStorage<CellIteratorType, DataType>::initialize(
+  const CellIteratorType                                          &cell_start,
+  const typename std_cxx20::type_identity<CellIteratorType>::type &cell_end,
+  const unsigned int                                               number)
+{
+  clear();
+  if (cell_start == cell_end)
+    return;
+
+  tria = &cell_start->get_triangulation();
+
+  // first count the data points of each cell, then convert the counts into
+  // offsets and allocate all objects at once
+  cell_offsets.resize(tria->n_active_cells() + 1, 0);
+  for (CellIteratorType it = cell_start; it != cell_end; ++it)
+    if (it->is_locally_owned())
+      {
+        Assert(&it->get_triangulation() == tria, ExcTriangulationMismatch());
+        Assert(it->is_active(),
+               ExcMessage("Data can only be stored on active cells."));
+        cell_offsets[it->active_cell_index() + 1] = number;
+      }
+  for (unsigned int c = 0; c < tria->n_active_cells(); ++c)
+    cell_offsets[c + 1] += cell_offsets[c];
+
+  data.resize(cell_offsets.back());
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline void
+ContiguousCellDataStorage<CellIteratorType, DataType>::clear()
+{
+  tria = nullptr;
+  cell_offsets.clear();
+  data.clear();
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline ArrayView<DataType>
+ContiguousCellDataStorage<CellIteratorType, DataType>::get_data(
+  const CellIteratorType &cell)
+{
+  const auto result = try_get_data(cell);
+  Assert(result, ExcMessage("Could not find data for the cell"));
+  return *result;
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline ArrayView<const DataType>
+ContiguousCellDataStorage<CellIteratorType, DataType>::get_data(
+  const CellIteratorType &cell) const
+{
+  const auto result = try_get_data(cell);
+  Assert(result, ExcMessage("Could not find data for the cell"));
+  return *result;
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline std::optional<ArrayView<DataType>>
+ContiguousCellDataStorage<CellIteratorType, DataType>::try_get_data(
+  const CellIteratorType &cell)
+{
+  Assert(&cell->get_triangulation() == tria, ExcTriangulationMismatch());
+
+  if (cell->is_active() == false)
+    return {};
+
+  const unsigned int index = cell->active_cell_index();
+  AssertIndexRange(index + 1, cell_offsets.size());
+  const std::size_t n_data = cell_offsets[index + 1] - cell_offsets[index];
+  if (n_data == 0)
+    return {};
+
+  return {make_array_view(data.data() + cell_offsets[index],
+                          data.data() + cell_offsets[index + 1])};
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline std::optional<ArrayView<const DataType>>
+ContiguousCellDataStorage<CellIteratorType, DataType>::try_get_data(
+  const CellIteratorType &cell) const
+{
+  Assert(&cell->get_triangulation() == tria, ExcTriangulationMismatch());
+
+  if (cell->is_active() == false)
+    return {};
+
+  const unsigned int index = cell->active_cell_index();
+  AssertIndexRange(index + 1, cell_offsets.size());
+  const std::size_t n_data = cell_offsets[index + 1] - cell_offsets[index];
+  if (n_data == 0)
+    return {};
+
+  return {make_array_view(data.data() + cell_offsets[index],
+                          data.data() + cell_offsets[index + 1])};
+}
+
+
+
+template <typename CellIteratorType, typename DataType>
+inline std::size_t
+ContiguousCellDataStorage<CellIteratorType, DataType>::memory_consumption()
+  const
+{
+  return sizeof(*this) +
+         MemoryConsumption::memory_consumption(cell_offsets) +
+         data.capacity() * sizeof(DataType);
+}
+
+
 //--------------------------------------------------------------------
 //                    ContinuousQuadratureDataTransfer
 //--------------------------------------------------------------------
@@ -880,6 +1205,75 @@ unpack_to_cell_data(const CellIteratorType                      &cell,
 }
 
 
+/*
+ * Same as above, for data stored in a ContiguousCellDataStorage object.
+ */
+template <typename CellIteratorType, typename DataType>
+inline void
+pack_cell_data(
+  const CellIteratorType                                      &cell,
+  const ContiguousCellDataStorage<CellIteratorType, DataType> *data_storage,
+  FullMatrix<double>                                          &matrix_data)
+{
+  static_assert(std::is_base_of_v<TransferableQuadraturePointData, DataType>,
+                "User's DataType class should be derived from QPData");
+
+  if (const auto qpd = data_storage->try_get_data(cell))
+    {
+      const unsigned int m = qpd->size();
+      Assert(m > 0, ExcInternalError());
+      const unsigned int n = (*qpd)[0].number_of_values();
+      matrix_data.reinit(m, n);
+
+      std::vector<double> single_qp_data(n);
+      for (unsigned int q = 0; q < m; ++q)
+        {
+          (*qpd)[q].pack_values(single_qp_data);
+          AssertDimension(single_qp_data.size(), n);
+
+          for (unsigned int i = 0; i < n; ++i)
+            matrix_data(q, i) = single_qp_data[i];
+        }
+    }
+  else
+    {
+      matrix_data.reinit({0, 0});
+    }
+}
+
+
+
+/*
+ * Same as above, for data stored in a ContiguousCellDataStorage object.
+ */
+template <typename CellIteratorType, typename DataType>
+inline void
+unpack_to_cell_data(
+  const CellIteratorType                                &cell,
+  const FullMatrix<double>                              &values_at_qp,
+  ContiguousCellDataStorage<CellIteratorType, DataType> *data_storage)
+{
+  static_assert(std::is_base_of_v<TransferableQuadraturePointData, DataType>,
+                "User's DataType class should be derived from QPData");
+
+  if (const auto qpd = data_storage->try_get_data(cell))
+    {
+      const unsigned int n = values_at_qp.n();
+      AssertDimension((*qpd)[0].number_of_values(), n);
+
+      std::vector<double> single_qp_data(n);
+      AssertDimension(qpd->size(), values_at_qp.m());
+
+      for (unsigned int q = 0; q < qpd->size(); ++q)
+        {
+          for (unsigned int i = 0; i < n; ++i)
+            single_qp_data[i] = values_at_qp(q, i);
+          (*qpd)[q].unpack_values(single_qp_data);
+        }
+    }
+}
+
+
 #  ifdef DEAL_II_WITH_P4EST
 
 namespace parallel
@@ -899,6 +1293,7 @@ namespace parallel
       , project_to_qp_matrix(n_q_points, projection_fe->n_dofs_per_cell())
       , handle(numbers::invalid_unsigned_int)
       , data_storage(nullptr)
+      , contiguous_data_storage(nullptr)
       , triangulation(nullptr)
     {
       Assert(
@@ -925,7 +1320,7 @@ namespace parallel
         parallel::distributed::Triangulation<dim>   &tr_,
         CellDataStorage<CellIteratorType, DataType> &data_storage_)
     {
-      Assert(data_storage == nullptr,
+      Assert(data_storage == nullptr && contiguous_data_storage == nullptr,
              ExcMessage("This function can be called only once"));
       triangulation = &tr_;
       data_storage  = &data_storage_;
@@ -941,6 +1336,29 @@ namespace parallel
 
 
 
+    template <int dim, typename DataType>
+    inline void
+    ContinuousQuadratureDataTransfer<dim, DataType>::
+      prepare_for_coarsening_and_refinement(
+        parallel::distributed::Triangulation<dim>             &tr_,
+        ContiguousCellDataStorage<CellIteratorType, DataType> &data_storage_)
+    {
+      Assert(data_storage == nullptr && contiguous_data_storage == nullptr,
+             ExcMessage("This function can be called only once"));
+      triangulation           = &tr_;
+      contiguous_data_storage = &data_storage_;
+
+      handle = triangulation->register_data_attach(
+        [this](const typename parallel::distributed::Triangulation<
+                 dim>::cell_iterator &cell,
+               const CellStatus       status) {
+          return this->pack_function(cell, status);
+        },
+        /*returns_variable_size_data=*/true);
+    }
+
+
+
     template <int dim, typename DataType>
     inline void
     ContinuousQuadratureDataTransfer<dim, DataType>::interpolate()
@@ -956,8 +1374,9 @@ namespace parallel
         });
 
       // invalidate the pointers
-      data_storage  = nullptr;
-      triangulation = nullptr;
+      data_storage            = nullptr;
+      contiguous_data_storage = nullptr;
+      triangulation           = nullptr;
     }
 
 
@@ -969,7 +1388,10 @@ namespace parallel
         &cell,
       const CellStatus /*status*/)
     {
-      pack_cell_data(cell, data_storage, matrix_quadrature);
+      if (contiguous_data_storage != nullptr)
+        pack_cell_data(cell, contiguous_data_storage, matrix_quadrature);
+      else
+        pack_cell_data(cell, data_storage, matrix_quadrature);
 
       // project to FE
       const unsigned int number_of_values = matrix_quadrature.n();
@@ -1023,10 +1445,15 @@ namespace parallel
                 project_to_qp_matrix.mmult(matrix_quadrature,
                                            matrix_dofs_child);
 
-                // finally, put back into the map:
-                unpack_to_cell_data(cell->child(child),
-                                    matrix_quadrature,
-                                    data_storage);
+                // finally, put back into the data storage:
+                if (contiguous_data_storage != nullptr)
+                  unpack_to_cell_data(cell->child(child),
+                                      matrix_quadrature,
+                                      contiguous_data_storage);
+                else
+                  unpack_to_cell_data(cell->child(child),
+                                      matrix_quadrature,
+                                      data_storage);
               }
         }
       else
@@ -1035,8 +1462,13 @@ namespace parallel
           // rhs_quadrature points.
           project_to_qp_matrix.mmult(matrix_quadrature, matrix_dofs);
 
-          // finally, put back into the map:
-          unpack_to_cell_data(cell, matrix_quadrature, data_storage);
+          // finally, put back into the data storage:
+          if (contiguous_data_storage != nullptr)
+            unpack_to_cell_data(cell,
+                                matrix_quadrature,
+                                contiguous_data_storage);
+          else
+            unpack_to_cell_data(cell, matrix_quadrature, data_storage);
         }
     }
 
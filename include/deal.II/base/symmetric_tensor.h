@@ -3107,6 +3107,10 @@ enum struct SymmetricTensorEigenvectorMethod
  * The specialized algorithms utilized in computing the eigenvectors are
  * presented in @cite Kopp2008.
  *
+ * For tensors with entries of type VectorizedArray, an overload that
+ * processes all lanes at once is declared in
+ * deal.II/base/symmetric_tensor_vectorized.h.
+ *
  * @relatesalso SymmetricTensor
  */
 template <int dim, typename Number>
@@ -3118,6 +3122,7 @@ eigenvectors(const SymmetricTensor<2, dim, Number> &T,
 
 
 
+
 /**
  * Return the transpose of the given symmetric tensor. Since we are working
  * with symmetric objects, the transpose is of course the same as the original
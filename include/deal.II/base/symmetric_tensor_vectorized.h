@@ -0,0 +1,240 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_symmetric_tensor_vectorized_h
+#define dealii_symmetric_tensor_vectorized_h
+
+// This file contains overloads of functions operating on SymmetricTensor
+// objects with entries of type VectorizedArray. They are not part of
+// symmetric_tensor.h to avoid that every file using SymmetricTensor needs
+// to include vectorization.h.
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <array>
+#include <utility>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * Return the eigenvalues and eigenvectors of a real-valued rank-2 symmetric
+ * tensor $\mathbf T$ whose entries are of type VectorizedArray, i.e., of
+ * several tensors at once. The array of matched eigenvalue and eigenvector
+ * pairs is sorted in descending order of the eigenvalues in each lane.
+ *
+ * All lanes are processed together with the Jacobi algorithm, where the
+ * decisions of the scalar implementation are replaced by masks, so that the
+ * result in each lane is the one of eigenvectors() with
+ * SymmetricTensorEigenvectorMethod::jacobi applied to the tensor of that
+ * lane. The iteration continues until all lanes have converged. The argument
+ * @p method is ignored, since the other algorithms take different branches
+ * in different lanes and hence do not vectorize.
+ *
+ * @relatesalso SymmetricTensor
+ */
+template <int dim, typename Number, std::size_t width>
+std::array<std::pair<VectorizedArray<Number, width>,
+                     Tensor<1, dim, VectorizedArray<Number, width>>>,
+           std::integral_constant<int, dim>::value>
+eigenvectors(const SymmetricTensor<2, dim, VectorizedArray<Number, width>> &T,
+             const SymmetricTensorEigenvectorMethod method =
+               SymmetricTensorEigenvectorMethod::jacobi)
+{
+  (void)method;
+  using VectorizedNumber = VectorizedArray<Number, width>;
+
+  SymmetricTensor<2, dim, VectorizedNumber> A = T;
+  Tensor<2, dim, VectorizedNumber>          Q(
+    unit_symmetric_tensor<dim, VectorizedNumber>());
+  std::array<VectorizedNumber, dim> w;
+  for (unsigned int i = 0; i < dim; ++i)
+    w[i] = A[i][i];
+
+  const VectorizedNumber zero = 0.;
+  const VectorizedNumber one  = 1.;
+
+  const unsigned int max_n_it  = 50;
+  const unsigned int n_it_skip = 4;
+  for (unsigned int it = 0; it <= max_n_it; ++it)
+    {
+      // Test for convergence in all lanes
+      VectorizedNumber so = 0.;
+      for (unsigned int p = 0; p < dim; ++p)
+        for (unsigned int q = p + 1; q < dim; ++q)
+          so += std::abs(A[p][q]);
+      bool converged = true;
+      for (unsigned int v = 0; v < width; ++v)
+        if (so[v] != Number())
+          converged = false;
+      if (converged)
+        break;
+
+      AssertThrow(it < max_n_it,
+                  ExcMessage("No convergence in iterative Jacobi "
+                             "eigenvector algorithm."));
+
+      const VectorizedNumber thresh =
+        it < n_it_skip ? VectorizedNumber(0.2 / (dim * dim)) * so : zero;
+
+      for (unsigned int p = 0; p < dim; ++p)
+        for (unsigned int q = p + 1; q < dim; ++q)
+          {
+            const VectorizedNumber a     = A[p][q];
+            const VectorizedNumber abs_a = std::abs(a);
+            const VectorizedNumber g     = 100. * abs_a;
+            const VectorizedNumber h     = w[q] - w[p];
+            const VectorizedNumber abs_h = std::abs(h);
+
+            // The surrogate for tan(phi) of the scalar algorithm, computed
+            // with divisors replaced by one in the lanes where they vanish
+            // and the result is not used
+            const VectorizedNumber theta =
+              0.5 * h /
+              compare_and_apply_mask<SIMDComparison::equal>(a, zero, one, a);
+            const VectorizedNumber t_theta =
+              compare_and_apply_mask<SIMDComparison::less_than>(theta,
+                                                                zero,
+                                                                -one,
+                                                                one) /
+              (std::sqrt(1. + theta * theta) + std::abs(theta));
+            const VectorizedNumber t_small_theta =
+              a /
+              compare_and_apply_mask<SIMDComparison::equal>(h, zero, one, h);
+            VectorizedNumber t =
+              compare_and_apply_mask<SIMDComparison::equal>(abs_h + g,
+                                                            abs_h,
+                                                            t_small_theta,
+                                                            t_theta);
+
+            // Lanes without rotation get t = 0, i.e., the identity
+            t = compare_and_apply_mask<SIMDComparison::greater_than>(abs_a,
+                                                                     thresh,
+                                                                     t,
+                                                                     zero);
+            VectorizedNumber new_a =
+              compare_and_apply_mask<SIMDComparison::greater_than>(abs_a,
+                                                                   thresh,
+                                                                   zero,
+                                                                   a);
+            if (it > n_it_skip)
+              {
+                // Skip the rotation and drop the off-diagonal element if it
+                // is negligible compared to both diagonal elements
+                const VectorizedNumber abs_wp = std::abs(w[p]);
+                const VectorizedNumber abs_wq = std::abs(w[q]);
+                const VectorizedNumber negligible =
+                  compare_and_apply_mask<SIMDComparison::equal>(
+                    abs_wp + g,
+                    abs_wp,
+                    compare_and_apply_mask<SIMDComparison::equal>(abs_wq + g,
+                                                                  abs_wq,
+                                                                  one,
+                                                                  zero),
+                    zero);
+                t = compare_and_apply_mask<SIMDComparison::equal>(negligible,
+                                                                  one,
+                                                                  zero,
+                                                                  t);
+                new_a =
+                  compare_and_apply_mask<SIMDComparison::equal>(negligible,
+                                                                one,
+                                                                zero,
+                                                                new_a);
+              }
+
+            const VectorizedNumber c = 1. / std::sqrt(1. + t * t);
+            const VectorizedNumber s = t * c;
+            const VectorizedNumber z = t * a;
+
+            A[p][q] = new_a;
+            w[p] -= z;
+            w[q] += z;
+            for (unsigned int r = 0; r < p; ++r)
+              {
+                const VectorizedNumber tmp = A[r][p];
+                A[r][p]                    = c * tmp - s * A[r][q];
+                A[r][q]                    = s * tmp + c * A[r][q];
+              }
+            for (unsigned int r = p + 1; r < q; ++r)
+              {
+                const VectorizedNumber tmp = A[p][r];
+                A[p][r]                    = c * tmp - s * A[r][q];
+                A[r][q]                    = s * tmp + c * A[r][q];
+              }
+            for (unsigned int r = q + 1; r < dim; ++r)
+              {
+                const VectorizedNumber tmp = A[p][r];
+                A[p][r]                    = c * tmp - s * A[q][r];
+                A[q][r]                    = s * tmp + c * A[q][r];
+              }
+            for (unsigned int r = 0; r < dim; ++r)
+              {
+                const VectorizedNumber tmp = Q[r][p];
+                Q[r][p]                    = c * tmp - s * Q[r][q];
+                Q[r][q]                    = s * tmp + c * Q[r][q];
+              }
+          }
+    }
+
+  std::array<std::pair<VectorizedNumber, Tensor<1, dim, VectorizedNumber>>,
+             dim>
+    eig_vals_vecs;
+  for (unsigned int e = 0; e < dim; ++e)
+    {
+      eig_vals_vecs[e].first = w[e];
+      for (unsigned int a = 0; a < dim; ++a)
+        eig_vals_vecs[e].second[a] = Q[a][e];
+      eig_vals_vecs[e].second /= eig_vals_vecs[e].second.norm();
+    }
+
+  // Sort in descending order in each lane with a sorting network
+  const auto compare_and_swap = [&](const unsigned int i,
+                                    const unsigned int j) {
+    auto                  &lhs       = eig_vals_vecs[i];
+    auto                  &rhs       = eig_vals_vecs[j];
+    const VectorizedNumber lhs_value = lhs.first;
+    const VectorizedNumber rhs_value = rhs.first;
+    lhs.first                        = std::max(lhs_value, rhs_value);
+    rhs.first                        = std::min(lhs_value, rhs_value);
+    for (unsigned int d = 0; d < dim; ++d)
+      {
+        const VectorizedNumber lhs_entry = lhs.second[d];
+        lhs.second[d] =
+          compare_and_apply_mask<SIMDComparison::less_than>(lhs_value,
+                                                            rhs_value,
+                                                            rhs.second[d],
+                                                            lhs_entry);
+        rhs.second[d] =
+          compare_and_apply_mask<SIMDComparison::less_than>(lhs_value,
+                                                            rhs_value,
+                                                            lhs_entry,
+                                                            rhs.second[d]);
+      }
+  };
+  for (unsigned int i = 0; i + 1 < dim; ++i)
+    for (unsigned int j = 0; j + 1 < dim - i; ++j)
+      compare_and_swap(j, j + 1);
+
+  return eig_vals_vecs;
+}
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
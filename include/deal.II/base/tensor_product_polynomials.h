@@ -25,6 +25,7 @@
 #include <deal.II/base/scalar_polynomials_base.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/vectorization.h>
 
 #include <vector>
 
@@ -135,6 +136,23 @@ public:
            std::vector<Tensor<3, dim>> &third_derivatives,
            std::vector<Tensor<4, dim>> &fourth_derivatives) const override;
 
+  /**
+   * Compute the value and the first derivatives of each tensor product
+   * polynomial at a batch of points, given as a point with
+   * VectorizedArray entries that holds one point per lane. This is
+   * equivalent to calling evaluate() once per lane, but evaluates the
+   * one-dimensional polynomials with SIMD instructions, which is useful
+   * when setting up the shape functions at many points at once.
+   *
+   * The size of the vectors must either be equal 0 or equal n(). In the
+   * first case, the function will not compute these values.
+   */
+  void
+  vectorized_evaluate(
+    const Point<dim, VectorizedArray<double>>            &unit_points,
+    std::vector<VectorizedArray<double>>                 &values,
+    std::vector<Tensor<1, dim, VectorizedArray<double>>> &grads) const;
+
   /**
    * Compute the value of the <tt>i</tt>th tensor product polynomial at
    * <tt>unit_point</tt>. Here <tt>i</tt> is given in tensor product
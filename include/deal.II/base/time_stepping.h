@@ -18,9 +18,11 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/signaling_nan.h>
 
 #include <functional>
+#include <utility>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -469,6 +471,43 @@ namespace TimeStepping
       VectorType &vec_ri,
       VectorType &vec_ki);
 
+    /**
+     * Same as above, but leaving the complete work of a stage to the
+     * function @p perform_stage, which is called as
+     * @code
+     * perform_stage(stage_time, factor_solution, factor_ai,
+     *               current_ri, vec_ki, solution, next_ri);
+     * @endcode
+     * and must compute <code>vec_ki = f(stage_time, current_ri)</code>,
+     * followed by the updates <code>next_ri = solution + factor_ai *
+     * vec_ki</code> and <code>solution += factor_solution * vec_ki</code>.
+     * The update of <code>next_ri</code> is skipped in the last stage, where
+     * @p factor_ai is zero. Note that @p current_ri and @p next_ri refer to
+     * the same vector except in the first stage, where @p current_ri is the
+     * solution vector.
+     *
+     * This variant allows to merge the vector updates into the evaluation of
+     * the operator, so that each stage reads and writes the vectors only
+     * once, rather than once for the operator evaluation and once more for
+     * the updates. For operators implemented with MatrixFree, the function
+     * MatrixFreeTools::perform_low_storage_runge_kutta_stage() implements
+     * such a stage; see also step-67.
+     */
+    double
+    evolve_one_time_step(
+      const std::function<void(const double,
+                               const double,
+                               const double,
+                               const VectorType &,
+                               VectorType &,
+                               VectorType &,
+                               VectorType &)> &perform_stage,
+      double                                   t,
+      double                                   delta_t,
+      VectorType                              &solution,
+      VectorType                              &vec_ri,
+      VectorType                              &vec_ki);
+
     /**
      * Get the coefficients of the scheme.
      * Note that here vector @p a is not the conventional definition in terms of a
@@ -856,6 +895,212 @@ namespace TimeStepping
      */
     Status status;
   };
+
+
+
+  /**
+   * The parareal algorithm by Lions, Maday, and Turinici (@cite Lions2001)
+   * for the parallel-in-time integration of $ \frac{\partial y}{\partial t}
+   * = f(t,y) $. Once the parallel efficiency of the spatial discretization
+   * saturates, e.g., for long time intervals on many nodes, the time interval
+   * $[t_\text{begin}, t_\text{end}]$ can additionally be split into $N$
+   * time slices that are integrated concurrently by different groups of
+   * processes.
+   *
+   * The algorithm needs two propagators that advance the solution from the
+   * beginning to the end of a time slice: an accurate but expensive fine
+   * propagator $\mathcal F$, for example many steps of a Runge-Kutta method,
+   * and a cheap coarse propagator $\mathcal G$, for example a single step of
+   * an implicit method. Both can be built from the Runge-Kutta methods of
+   * this namespace with make_propagator(). Starting from a sequential coarse
+   * integration, each iteration $k$ applies the fine propagator to all
+   * slices in parallel, followed by a sequential sweep of the coarse
+   * propagator that corrects the initial values of the slices:
+   * @f[
+   *   y_{n+1}^{k+1} = \mathcal G(y_n^{k+1}) + \mathcal F(y_n^k) -
+   *   \mathcal G(y_n^k).
+   * @f]
+   * After $k$ iterations, the first $k$ slices coincide with the sequential
+   * fine integration, so the algorithm terminates after at most $N$
+   * iterations. In practice, a few iterations reduce the difference to the
+   * fine solution below the discretization error, and the parallel speedup
+   * in time is bounded by $N/K$ for $K$ iterations if the coarse propagator
+   * is cheap. In the terminology of multigrid-reduction-in-time (MGRIT),
+   * this is the two-level method with F-relaxation.
+   *
+   * <h3>Distribution of the time slices</h3>
+   *
+   * Each time slice is assigned to one group of processes that holds a copy
+   * of the spatial discretization, e.g., a parallel::distributed::Triangulation
+   * with MatrixFree operators, partitioned in the same way on each group.
+   * The function split_communicator_for_parallel_in_time() splits a
+   * communicator into the communicators for space and time: the
+   * triangulation of a group is created on its space communicator, and the
+   * time communicator connects the processes with the same rank in the
+   * space communicators of the different groups. The rank of a process in
+   * the time communicator is the index of its time slice. As the vectors of
+   * all groups are partitioned in the same way, the locally owned entries of
+   * a vector are exchanged directly between neighbors in the time
+   * communicator. Consequently, the `VectorType` must provide contiguous
+   * access to its locally owned entries via `begin()` and
+   * `locally_owned_size()`, as Vector and LinearAlgebra::distributed::Vector
+   * do.
+   *
+   * The initial value of the time slice of the present process after the
+   * last iteration is kept in this object, see get_slice_initial_value(),
+   * such that the fine solution within the slice can be recomputed later,
+   * e.g., for output, or be written to a checkpoint from which the
+   * integration of the slice can be restarted.
+   */
+  template <typename VectorType>
+  class Parareal
+  {
+  public:
+    /**
+     * The type of a propagator that advances the vector given as third
+     * argument from the time given by the first argument to the time given
+     * by the second argument.
+     */
+    using Propagator =
+      std::function<void(const double, const double, VectorType &)>;
+
+    /**
+     * Standardized data struct to pipe additional data to the solver.
+     */
+    struct AdditionalData
+    {
+      /**
+       * Constructor.
+       */
+      explicit AdditionalData(const unsigned int max_iterations = 10,
+                              const double       tolerance      = 1e-8);
+
+      /**
+       * The maximal number of parareal iterations. The number of iterations
+       * is also bounded by the number of time slices, after which the result
+       * coincides with the sequential fine integration.
+       */
+      unsigned int max_iterations;
+
+      /**
+       * The iteration stops once the largest change of the values at the
+       * ends of the time slices in an iteration, measured in the $l_2$ norm
+       * relative to the norm of the values, is below this tolerance.
+       */
+      double tolerance;
+    };
+
+    /**
+     * Constructor. The rank of the present process in @p time_communicator
+     * determines its time slice.
+     */
+    Parareal(const MPI_Comm        time_communicator,
+             const AdditionalData &additional_data = AdditionalData());
+
+    /**
+     * Integrate from @p t_begin to @p t_end with the initial value @p y,
+     * which only needs to be set on the processes of the first time slice.
+     * On return, @p y holds the solution at the end of the time slice of the
+     * present process, i.e., the solution at @p t_end on the processes of the
+     * last time slice. The function returns the end time of the slice.
+     */
+    double
+    solve(const Propagator &coarse_propagator,
+          const Propagator &fine_propagator,
+          const double      t_begin,
+          const double      t_end,
+          VectorType       &y);
+
+    /**
+     * Return the number of iterations performed in the last call to solve().
+     */
+    unsigned int
+    n_iterations() const;
+
+    /**
+     * Return the beginning and the end of the time slice of the present
+     * process in the last call to solve().
+     */
+    std::pair<double, double>
+    get_slice_interval() const;
+
+    /**
+     * Return the initial value of the time slice of the present process
+     * after the last iteration of solve().
+     */
+    const VectorType &
+    get_slice_initial_value() const;
+
+    /**
+     * Return a propagator that performs @p n_time_steps equidistant steps of
+     * the Runge-Kutta method @p method, with @p f and
+     * @p id_minus_tau_J_inverse as in RungeKutta::evolve_one_time_step().
+     * The method is captured by reference and must outlive the propagator.
+     */
+    static Propagator
+    make_propagator(
+      RungeKutta<VectorType>                                          &method,
+      const std::function<VectorType(const double, const VectorType &)> &f,
+      const std::function<
+        VectorType(const double, const double, const VectorType &)>
+                        &id_minus_tau_J_inverse,
+      const unsigned int n_time_steps);
+
+  private:
+    /**
+     * Send the locally owned entries of @p vector to the next time slice.
+     */
+    void
+    send_to_next_slice(const VectorType &vector) const;
+
+    /**
+     * Receive the locally owned entries of @p vector from the previous time
+     * slice.
+     */
+    void
+    receive_from_previous_slice(VectorType &vector) const;
+
+    /**
+     * The communicator connecting the time slices.
+     */
+    MPI_Comm time_communicator;
+
+    /**
+     * Additional parameters.
+     */
+    AdditionalData additional_data;
+
+    /**
+     * The number of iterations performed in the last call to solve().
+     */
+    unsigned int n_performed_iterations;
+
+    /**
+     * The time slice of the present process.
+     */
+    std::pair<double, double> slice_interval;
+
+    /**
+     * The initial value of the time slice of the present process.
+     */
+    VectorType slice_initial_value;
+  };
+
+
+
+  /**
+   * Split @p communicator into @p n_time_slices groups of consecutive
+   * processes for the use with Parareal. The number of processes must be
+   * divisible by @p n_time_slices. The first communicator of the returned
+   * pair is the space communicator of the group of the present process, on
+   * which the spatial discretization is to be set up. The second one is the
+   * time communicator that connects the processes with the same rank in the
+   * space communicators of all groups. Both communicators need to be freed
+   * with Utilities::MPI::free_communicator() by the caller.
+   */
+  std::pair<MPI_Comm, MPI_Comm>
+  split_communicator_for_parallel_in_time(const MPI_Comm     communicator,
+                                          const unsigned int n_time_slices);
 } // namespace TimeStepping
 
 DEAL_II_NAMESPACE_CLOSE
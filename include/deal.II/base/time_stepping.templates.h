@@ -18,8 +18,11 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_tags.h>
 #include <deal.II/base/time_stepping.h>
 
+#include <algorithm>
 #include <functional>
 
 DEAL_II_NAMESPACE_OPEN
@@ -394,31 +397,71 @@ namespace TimeStepping
     VectorType                                                        &solution,
     VectorType                                                        &vec_ri,
     VectorType                                                        &vec_ki)
+  {
+    return evolve_one_time_step(
+      [&](const double      stage_time,
+          const double      factor_solution,
+          const double      factor_ai,
+          const VectorType &current_ri,
+          VectorType       &vec_ki,
+          VectorType       &solution,
+          VectorType       &next_ri) {
+        compute_one_stage(f,
+                          stage_time,
+                          factor_solution,
+                          factor_ai,
+                          current_ri,
+                          vec_ki,
+                          solution,
+                          next_ri);
+      },
+      t,
+      delta_t,
+      solution,
+      vec_ri,
+      vec_ki);
+  }
+
+
+
+  template <typename VectorType>
+  double
+  LowStorageRungeKutta<VectorType>::evolve_one_time_step(
+    const std::function<void(const double,
+                             const double,
+                             const double,
+                             const VectorType &,
+                             VectorType &,
+                             VectorType &,
+                             VectorType &)> &perform_stage,
+    double                                   t,
+    double                                   delta_t,
+    VectorType                              &solution,
+    VectorType                              &vec_ri,
+    VectorType                              &vec_ki)
   {
     Assert(status.method != runge_kutta_method::invalid, ExcNoMethodSelected());
 
-    compute_one_stage(f,
-                      t,
-                      this->b[0] * delta_t,
-                      this->a[0][0] * delta_t,
-                      solution,
-                      vec_ki,
-                      solution,
-                      vec_ri);
+    perform_stage(t,
+                  this->b[0] * delta_t,
+                  this->a[0][0] * delta_t,
+                  solution,
+                  vec_ki,
+                  solution,
+                  vec_ri);
 
     for (unsigned int stage = 1; stage < this->n_stages; ++stage)
       {
         const double c_i = this->c[stage];
         const double factor_ai =
           (stage == this->n_stages - 1 ? 0 : this->a[0][stage] * delta_t);
-        compute_one_stage(f,
-                          t + c_i * delta_t,
-                          this->b[stage] * delta_t,
-                          factor_ai,
-                          vec_ri,
-                          vec_ki,
-                          solution,
-                          vec_ri);
+        perform_stage(t + c_i * delta_t,
+                      this->b[stage] * delta_t,
+                      factor_ai,
+                      vec_ri,
+                      vec_ki,
+                      solution,
+                      vec_ri);
       }
     return (t + delta_t);
   }
@@ -1151,6 +1194,217 @@ namespace TimeStepping
         f_stages[i] = f(t + this->c[i] * delta_t, Y);
       }
   }
+
+
+
+  // ----------------------------------------------------------------------
+  // Parareal
+  // ----------------------------------------------------------------------
+
+  template <typename VectorType>
+  Parareal<VectorType>::AdditionalData::AdditionalData(
+    const unsigned int max_iterations,
+    const double       tolerance)
+    : max_iterations(max_iterations)
+    , tolerance(tolerance)
+  {}
+
+
+
+  template <typename VectorType>
+  Parareal<VectorType>::Parareal(const MPI_Comm        time_communicator,
+                                 const AdditionalData &additional_data)
+    : time_communicator(time_communicator)
+    , additional_data(additional_data)
+    , n_performed_iterations(0)
+    , slice_interval(0., 0.)
+  {}
+
+
+
+  template <typename VectorType>
+  double
+  Parareal<VectorType>::solve(const Propagator &coarse_propagator,
+                              const Propagator &fine_propagator,
+                              const double      t_begin,
+                              const double      t_end,
+                              VectorType       &y)
+  {
+    const unsigned int slice =
+      Utilities::MPI::this_mpi_process(time_communicator);
+    const unsigned int n_slices =
+      Utilities::MPI::n_mpi_processes(time_communicator);
+
+    const double slice_length = (t_end - t_begin) / n_slices;
+    slice_interval.first      = t_begin + slice * slice_length;
+    slice_interval.second =
+      (slice + 1 == n_slices) ? t_end : t_begin + (slice + 1) * slice_length;
+
+    // the values at the beginning and the end of the slice in the current
+    // iteration, and the coarse and fine propagation of the value at the
+    // beginning of the slice in the previous iteration
+    VectorType &start_value = slice_initial_value;
+    VectorType  end_value, coarse_value, fine_value, difference;
+    start_value.reinit(y, true);
+    end_value.reinit(y, true);
+    coarse_value.reinit(y, true);
+    fine_value.reinit(y, true);
+    difference.reinit(y, true);
+
+    // the initial guess is a sequential coarse integration
+    if (slice == 0)
+      start_value = y;
+    else
+      receive_from_previous_slice(start_value);
+    coarse_value = start_value;
+    coarse_propagator(slice_interval.first,
+                      slice_interval.second,
+                      coarse_value);
+    end_value = coarse_value;
+    if (slice + 1 < n_slices)
+      send_to_next_slice(end_value);
+
+    n_performed_iterations = 0;
+    const unsigned int max_iterations =
+      std::min(additional_data.max_iterations, n_slices);
+    while (n_performed_iterations < max_iterations)
+      {
+        // fine propagation of all slices in parallel. After k iterations,
+        // the initial values of the first k+1 slices are those of the
+        // sequential fine integration, so the fine propagation of the slices
+        // that were already exact in the previous iteration can be reused
+        if (slice >= n_performed_iterations)
+          {
+            fine_value = start_value;
+            fine_propagator(slice_interval.first,
+                            slice_interval.second,
+                            fine_value);
+          }
+
+        // sequential correction y_{n+1} = G(y_n) + F(y_n^old) - G(y_n^old)
+        if (slice > 0)
+          receive_from_previous_slice(start_value);
+        difference = end_value;
+        end_value  = fine_value;
+        end_value -= coarse_value;
+        coarse_value = start_value;
+        coarse_propagator(slice_interval.first,
+                          slice_interval.second,
+                          coarse_value);
+        end_value += coarse_value;
+        if (slice + 1 < n_slices)
+          send_to_next_slice(end_value);
+
+        ++n_performed_iterations;
+
+        difference -= end_value;
+        const double norm = end_value.l2_norm();
+        const double relative_change =
+          Utilities::MPI::max(norm > 0. ? difference.l2_norm() / norm :
+                                          difference.l2_norm(),
+                              time_communicator);
+        if (relative_change < additional_data.tolerance)
+          break;
+      }
+
+    y = end_value;
+    return slice_interval.second;
+  }
+
+
+
+  template <typename VectorType>
+  unsigned int
+  Parareal<VectorType>::n_iterations() const
+  {
+    return n_performed_iterations;
+  }
+
+
+
+  template <typename VectorType>
+  std::pair<double, double>
+  Parareal<VectorType>::get_slice_interval() const
+  {
+    return slice_interval;
+  }
+
+
+
+  template <typename VectorType>
+  const VectorType &
+  Parareal<VectorType>::get_slice_initial_value() const
+  {
+    return slice_initial_value;
+  }
+
+
+
+  template <typename VectorType>
+  typename Parareal<VectorType>::Propagator
+  Parareal<VectorType>::make_propagator(
+    RungeKutta<VectorType>                                            &method,
+    const std::function<VectorType(const double, const VectorType &)> &f,
+    const std::function<
+      VectorType(const double, const double, const VectorType &)>
+                      &id_minus_tau_J_inverse,
+    const unsigned int n_time_steps)
+  {
+    Assert(n_time_steps > 0, ExcMessage("Need at least one time step."));
+    return [&method, f, id_minus_tau_J_inverse, n_time_steps](
+             const double t_begin, const double t_end, VectorType &y) {
+      const double delta_t = (t_end - t_begin) / n_time_steps;
+      double       t       = t_begin;
+      for (unsigned int step = 0; step < n_time_steps; ++step)
+        t = method.evolve_one_time_step(
+          f, id_minus_tau_J_inverse, t, delta_t, y);
+    };
+  }
+
+
+
+  template <typename VectorType>
+  void
+  Parareal<VectorType>::send_to_next_slice(const VectorType &vector) const
+  {
+#ifdef DEAL_II_WITH_MPI
+    using Number = typename VectorType::value_type;
+    const int ierr =
+      MPI_Send(vector.begin(),
+               vector.locally_owned_size(),
+               Utilities::MPI::mpi_type_id_for_type<Number>,
+               Utilities::MPI::this_mpi_process(time_communicator) + 1,
+               Utilities::MPI::internal::Tags::parareal,
+               time_communicator);
+    AssertThrowMPI(ierr);
+#else
+    (void)vector;
+    DEAL_II_NOT_IMPLEMENTED();
+#endif
+  }
+
+
+
+  template <typename VectorType>
+  void
+  Parareal<VectorType>::receive_from_previous_slice(VectorType &vector) const
+  {
+#ifdef DEAL_II_WITH_MPI
+    using Number = typename VectorType::value_type;
+    const int ierr =
+      MPI_Recv(vector.begin(),
+               vector.locally_owned_size(),
+               Utilities::MPI::mpi_type_id_for_type<Number>,
+               Utilities::MPI::this_mpi_process(time_communicator) - 1,
+               Utilities::MPI::internal::Tags::parareal,
+               time_communicator,
+               MPI_STATUS_IGNORE);
+    AssertThrowMPI(ierr);
+#else
+    (void)vector;
+    DEAL_II_NOT_IMPLEMENTED();
+#endif
+  }
 } // namespace TimeStepping
 
 DEAL_II_NAMESPACE_CLOSE
@@ -25,6 +25,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -543,6 +544,28 @@ private:
  * taken by the 10\% of the slowest and fastest ranks, respectively, to get
  * additional insight into the statistical distribution.
  *
+ * <h3>Hardware performance counters</h3>
+ *
+ * If deal.II was configured with the PAPI library, the sections can also
+ * record hardware performance counters, e.g., the number of floating point
+ * operations or of cache misses, to relate the time of a section to the
+ * work performed in it:
+ * @code
+ *   TimerOutput timer (pcout,
+ *                      TimerOutput::never,
+ *                      TimerOutput::wall_times);
+ *   timer.enable_hardware_counters({"PAPI_DP_OPS", "PAPI_L3_TCM"});
+ *   ...
+ *   timer.print_wall_time_statistics(MPI_COMM_WORLD);
+ * @endcode
+ * The counters accumulated in each section are printed by
+ * print_wall_time_statistics() in terms of their minimum, average, and
+ * maximum over the MPI ranks, together with the average rate per second of
+ * wall time. The events can be any PAPI preset or native event available on
+ * the machine (see the output of <code>papi_avail</code> and
+ * <code>papi_native_avail</code>); the memory bandwidth, for example, can be
+ * derived from the uncore events counting memory reads and writes.
+ *
  * @ingroup utilities
  */
 class TimerOutput
@@ -797,6 +820,24 @@ public:
   print_wall_time_statistics(const MPI_Comm mpi_comm,
                              const double   print_quantile = 0.) const;
 
+  /**
+   * Record the hardware performance counters given by @p event_names in
+   * all sections entered from now on, using the PAPI library. The names
+   * can be PAPI preset events such as "PAPI_DP_OPS" or native events of the
+   * processor. The accumulated counts are printed by
+   * print_wall_time_statistics().
+   *
+   * The counters are read on the thread that calls this function, and
+   * sections should only be entered and left on this thread. No section may
+   * be active when this function is called. Calling this function again
+   * replaces the set of events and resets the counts of all sections.
+   *
+   * @note This function throws an exception if deal.II was not configured
+   * with PAPI.
+   */
+  void
+  enable_hardware_counters(const std::vector<std::string> &event_names);
+
   /**
    * By calling this function, all output can be disabled. This function
    * together with enable_output() can be useful if one wants to control the
@@ -845,10 +886,12 @@ private:
    */
   struct Section
   {
-    Timer        timer;
-    double       total_cpu_time;
-    double       total_wall_time;
-    unsigned int n_calls;
+    Timer                      timer;
+    double                     total_cpu_time;
+    double                     total_wall_time;
+    unsigned int               n_calls;
+    std::vector<long long int> counter_start;
+    std::vector<long long int> total_counters;
   };
 
   /**
@@ -880,6 +923,17 @@ private:
    */
   MPI_Comm mpi_communicator;
 
+  /**
+   * The names of the hardware counters recorded in each section, see
+   * enable_hardware_counters().
+   */
+  std::vector<std::string> hardware_counter_names;
+
+  /**
+   * The handle of the PAPI event set of the hardware counters.
+   */
+  int hardware_counter_event_set;
+
   /**
    * A lock that makes sure that this class gives reasonable results even when
    * used with several threads.
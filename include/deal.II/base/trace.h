@@ -0,0 +1,233 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_trace_h
+#define dealii_trace_h
+
+#include <deal.II/base/config.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A lightweight facility to record a timeline of the work done in a
+ * program, in the form of events that can be inspected with the trace
+ * viewers of the Chrome browser (<code>chrome://tracing</code>) or of
+ * Perfetto (<code>https://ui.perfetto.dev</code>).
+ *
+ * In contrast to TimerOutput, which accumulates the total times of sections
+ * explicitly set up by the user, this facility records every single event
+ * with its start time and duration, and on which thread it happened. This
+ * allows to see the interplay of computations and communication, load
+ * imbalances between threads, or the time spent between iterations of a
+ * solver. Several places in deal.II record events if tracing is enabled:
+ * WorkStream::run(), the loops of MatrixFree, the ghost exchanges of
+ * Utilities::MPI::Partitioner, the iterations of the solvers derived from
+ * SolverBase, and DataOut::build_patches() as well as
+ * DataOutInterface::write_vtu_in_parallel(). User code can add events with
+ * Trace::Scope objects:
+ * @code
+ * Trace::enable();
+ * ...
+ * {
+ *   Trace::Scope scope("assemble");
+ *   ... assemble the system ...
+ * }
+ * ...
+ * std::ofstream out("trace-" + std::to_string(rank) + ".json");
+ * Trace::write_chrome_trace(out, rank);
+ * @endcode
+ *
+ * The events are stored in thread-local ring buffers of fixed size, so
+ * that recording an event neither allocates memory nor synchronizes the
+ * threads. If a buffer is full, the oldest events of that thread are
+ * overwritten. When tracing is disabled, which is the default, an event
+ * costs a single check of a flag.
+ *
+ * @note The names of the events are stored as pointers, not copied. They
+ * must hence point to strings that live until the trace is written, e.g.,
+ * string literals.
+ *
+ * @note The functions enable(), disable(), clear(), and
+ * write_chrome_trace() must not be called while other threads record
+ * events.
+ *
+ * @ingroup utilities
+ */
+namespace Trace
+{
+  /**
+   * Start recording events, using buffers of @p buffer_size events per
+   * thread. All previously recorded events are discarded.
+   */
+  void
+  enable(const unsigned int buffer_size = 65536);
+
+  /**
+   * Stop recording events. The recorded events are kept and can still be
+   * written with write_chrome_trace().
+   */
+  void
+  disable();
+
+  /**
+   * Return whether events are currently recorded.
+   */
+  bool
+  is_enabled();
+
+  /**
+   * Discard all recorded events.
+   */
+  void
+  clear();
+
+  /**
+   * Record an event without duration named @p name, e.g., to mark the
+   * iterations of a solver.
+   */
+  void
+  instant(const char *name);
+
+  /**
+   * Write all recorded events to @p out in the JSON trace event format
+   * understood by Chrome and Perfetto. The argument @p process_id is used
+   * as process identifier of the events, so that the traces of several MPI
+   * processes, written to separate files, can be told apart when they are
+   * loaded together.
+   */
+  void
+  write_chrome_trace(std::ostream &out, const unsigned int process_id = 0);
+
+  /**
+   * A class recording an event that lasts from the construction to the
+   * destruction of the object.
+   */
+  class Scope
+  {
+  public:
+    /**
+     * Constructor. Start the event named @p name if tracing is enabled.
+     */
+    explicit Scope(const char *name);
+
+    /**
+     * Destructor. Record the event.
+     */
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+
+    Scope &
+    operator=(const Scope &) = delete;
+
+  private:
+    /**
+     * The name of the event, or a null pointer if tracing was disabled at
+     * construction.
+     */
+    const char *name;
+
+    /**
+     * The time at construction, in nanoseconds.
+     */
+    std::uint64_t start_time;
+  };
+} // namespace Trace
+
+
+
+namespace internal
+{
+  namespace Trace
+  {
+    /**
+     * Whether events are recorded.
+     */
+    extern std::atomic<bool> enabled;
+
+    /**
+     * Return the current time in nanoseconds.
+     */
+    inline std::uint64_t
+    now()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+    }
+
+    /**
+     * Store an event in the buffer of the calling thread.
+     */
+    void
+    record(const char         *name,
+           const std::uint64_t start_time,
+           const std::uint64_t end_time,
+           const bool          is_instant);
+  } // namespace Trace
+} // namespace internal
+
+
+
+/* ---------------------- inline functions --------------------------- */
+
+#ifndef DOXYGEN
+
+namespace Trace
+{
+  inline bool
+  is_enabled()
+  {
+    return internal::Trace::enabled.load(std::memory_order_relaxed);
+  }
+
+
+
+  inline void
+  instant(const char *name)
+  {
+    if (is_enabled())
+      {
+        const std::uint64_t time = internal::Trace::now();
+        internal::Trace::record(name, time, time, true);
+      }
+  }
+
+
+
+  inline Scope::Scope(const char *name)
+    : name(is_enabled() ? name : nullptr)
+    , start_time(this->name != nullptr ? internal::Trace::now() : 0)
+  {}
+
+
+
+  inline Scope::~Scope()
+  {
+    if (name != nullptr)
+      internal::Trace::record(name, start_time, internal::Trace::now(), false);
+  }
+} // namespace Trace
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -545,6 +545,16 @@ namespace Utilities
    *   followed by a bit-by-bit copy of the contents of the vector. A
    *   similar process is used for vectors of vectors of objects whose type
    *   `T` satisfies `std::is_trivially_copyable`.
+   * - If no compression is requested, the same bit-by-bit copy is also used
+   *   for arbitrarily nested combinations of std::vector, std::pair, and
+   *   std::tuple whose innermost types satisfy
+   *   `std::is_trivially_copyable`, such as
+   *   `std::vector<std::pair<unsigned int, Point<dim>>>`, as well as for
+   *   objects of such types that are larger than 256 bytes. Each vector
+   *   is stored as its length followed by its elements.
+   * - If compression is requested, the data is compressed with the fastest
+   *   compression level of ZLIB, favoring speed over the size of the
+   *   buffer.
    * - Finally, if the type `T` of the object to be packed is std::tuple<>
    *   (i.e., a tuple without any elements as indicated by the empty argument
    *   list) and if no compression is requested, then this
@@ -856,6 +866,27 @@ namespace Utilities
     std::string
     get_current_vectorization_level();
 
+    /**
+     * Return the widest SIMD register width in bits, among the ones used by
+     * VectorizedArray, that is supported by the processor the program is
+     * currently running on, as detected at run time. The possible return
+     * values are 0, 128, 256, and 512, following the table in
+     * get_current_vectorization_level(). On platforms where no run-time
+     * detection is available, the width the library was compiled for,
+     * DEAL_II_VECTORIZATION_WIDTH_IN_BITS, is returned.
+     *
+     * Since the width of VectorizedArray is a compile-time property that
+     * determines the data layout of, e.g., MatrixFree, the kernels of the
+     * library cannot switch to wider registers at run time. This function
+     * allows applications deployed with several builds of the library on
+     * heterogeneous clusters to select the build matching the current node,
+     * or to report that the present build does not use the full width of the
+     * hardware, by comparing the result against
+     * DEAL_II_VECTORIZATION_WIDTH_IN_BITS.
+     */
+    unsigned int
+    get_supported_vectorization_width_in_bits();
+
     /**
      * Structure that hold information about memory usage in kB. Used by
      * get_memory_stats(). See man 5 proc entry /status for details.
@@ -1372,6 +1403,267 @@ namespace Utilities
              ExcMessage("The given buffer has the wrong size."));
     }
 
+
+
+
+    /**
+     * A structure that is used to identify whether an object of type T can
+     * be serialized bit by bit, i.e., whether T satisfies
+     * std::is_trivially_copyable_v<T> == true (but is not bool), or is a
+     * std::vector, std::pair, or std::tuple of such types, with an
+     * arbitrary level of nesting.
+     */
+    template <typename T>
+    struct IsBitwiseSerializable
+    {
+      static constexpr bool value =
+        std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>;
+    };
+
+
+
+    template <typename T1, typename T2>
+    struct IsBitwiseSerializable<std::pair<T1, T2>>
+    {
+      static constexpr bool value = IsBitwiseSerializable<T1>::value &&
+                                    IsBitwiseSerializable<T2>::value;
+    };
+
+
+
+    template <typename... Ts>
+    struct IsBitwiseSerializable<std::tuple<Ts...>>
+    {
+      static constexpr bool value = (IsBitwiseSerializable<Ts>::value && ...);
+    };
+
+
+
+    template <typename T>
+    struct IsBitwiseSerializable<std::vector<T>>
+    {
+      static constexpr bool value = IsBitwiseSerializable<T>::value;
+    };
+
+
+
+    /**
+     * Append the contents of an object of type T that satisfies
+     * IsBitwiseSerializable<T>::value == true bit for bit to a character
+     * array. Vectors are written as their length followed by their
+     * elements, and pairs and tuples as the sequence of their members.
+     *
+     * If the type does not satisfy IsBitwiseSerializable, then the function
+     * throws an exception.
+     */
+    template <typename T>
+    inline void
+    append_bitwise_serializable_to_buffer(const T           &object,
+                                          std::vector<char> &dest_buffer);
+
+    template <typename T1, typename T2>
+    inline void
+    append_bitwise_serializable_to_buffer(const std::pair<T1, T2> &object,
+                                          std::vector<char> &dest_buffer);
+
+    template <typename... Ts>
+    inline void
+    append_bitwise_serializable_to_buffer(const std::tuple<Ts...> &object,
+                                          std::vector<char> &dest_buffer);
+
+    template <typename T>
+    inline void
+    append_bitwise_serializable_to_buffer(const std::vector<T> &object,
+                                          std::vector<char>    &dest_buffer);
+
+
+
+    template <typename T>
+    inline void
+    append_bitwise_serializable_to_buffer(const T           &object,
+                                          std::vector<char> &dest_buffer)
+    {
+      if constexpr (IsBitwiseSerializable<T>::value)
+        dest_buffer.insert(dest_buffer.end(),
+                           reinterpret_cast<const char *>(&object),
+                           reinterpret_cast<const char *>(&object + 1));
+      else
+        {
+          (void)object;
+          (void)dest_buffer;
+
+          // We shouldn't get here:
+          DEAL_II_ASSERT_UNREACHABLE();
+        }
+    }
+
+
+
+    template <typename T1, typename T2>
+    inline void
+    append_bitwise_serializable_to_buffer(const std::pair<T1, T2> &object,
+                                          std::vector<char> &dest_buffer)
+    {
+      append_bitwise_serializable_to_buffer(object.first, dest_buffer);
+      append_bitwise_serializable_to_buffer(object.second, dest_buffer);
+    }
+
+
+
+    template <typename... Ts>
+    inline void
+    append_bitwise_serializable_to_buffer(const std::tuple<Ts...> &object,
+                                          std::vector<char> &dest_buffer)
+    {
+      std::apply(
+        [&dest_buffer](const Ts &...elements) {
+          (append_bitwise_serializable_to_buffer(elements, dest_buffer), ...);
+        },
+        object);
+    }
+
+
+
+    template <typename T>
+    inline void
+    append_bitwise_serializable_to_buffer(const std::vector<T> &object,
+                                          std::vector<char>    &dest_buffer)
+    {
+      const typename std::vector<T>::size_type vector_size = object.size();
+      dest_buffer.insert(dest_buffer.end(),
+                         reinterpret_cast<const char *>(&vector_size),
+                         reinterpret_cast<const char *>(&vector_size + 1));
+
+      // Copy the elements en bloc if possible, and one by one otherwise
+      if constexpr (std::is_trivially_copyable_v<T> &&
+                    !std::is_same_v<T, bool>)
+        {
+          if (vector_size > 0)
+            dest_buffer.insert(dest_buffer.end(),
+                               reinterpret_cast<const char *>(object.data()),
+                               reinterpret_cast<const char *>(object.data() +
+                                                              vector_size));
+        }
+      else if constexpr (IsBitwiseSerializable<T>::value)
+        {
+          for (const auto &element : object)
+            append_bitwise_serializable_to_buffer(element, dest_buffer);
+        }
+      else
+        {
+          // We shouldn't get here:
+          DEAL_II_ASSERT_UNREACHABLE();
+        }
+    }
+
+
+
+    /**
+     * Restore an object of type T that has been written by
+     * append_bitwise_serializable_to_buffer() from the character array
+     * starting at @p position, and advance @p position past the data read.
+     *
+     * If the type does not satisfy IsBitwiseSerializable, then the function
+     * throws an exception.
+     */
+    template <typename T>
+    inline void
+    read_bitwise_serializable_from_buffer(const char *&position, T &object);
+
+    template <typename T1, typename T2>
+    inline void
+    read_bitwise_serializable_from_buffer(const char        *&position,
+                                          std::pair<T1, T2> &object);
+
+    template <typename... Ts>
+    inline void
+    read_bitwise_serializable_from_buffer(const char        *&position,
+                                          std::tuple<Ts...> &object);
+
+    template <typename T>
+    inline void
+    read_bitwise_serializable_from_buffer(const char    *&position,
+                                          std::vector<T> &object);
+
+
+
+    template <typename T>
+    inline void
+    read_bitwise_serializable_from_buffer(const char *&position, T &object)
+    {
+      // As in create_vector_of_trivially_copyable_from_buffer(), use
+      // memcpy to not rely on the alignment of the data in the buffer.
+      if constexpr (IsBitwiseSerializable<T>::value)
+        {
+          std::memcpy(&object, position, sizeof(T));
+          position += sizeof(T);
+        }
+      else
+        {
+          (void)position;
+          (void)object;
+
+          // We shouldn't get here:
+          DEAL_II_ASSERT_UNREACHABLE();
+        }
+    }
+
+
+
+    template <typename T1, typename T2>
+    inline void
+    read_bitwise_serializable_from_buffer(const char        *&position,
+                                          std::pair<T1, T2> &object)
+    {
+      read_bitwise_serializable_from_buffer(position, object.first);
+      read_bitwise_serializable_from_buffer(position, object.second);
+    }
+
+
+
+    template <typename... Ts>
+    inline void
+    read_bitwise_serializable_from_buffer(const char        *&position,
+                                          std::tuple<Ts...> &object)
+    {
+      std::apply(
+        [&position](Ts &...elements) {
+          (read_bitwise_serializable_from_buffer(position, elements), ...);
+        },
+        object);
+    }
+
+
+
+    template <typename T>
+    inline void
+    read_bitwise_serializable_from_buffer(const char    *&position,
+                                          std::vector<T> &object)
+    {
+      typename std::vector<T>::size_type vector_size;
+      std::memcpy(&vector_size, position, sizeof(vector_size));
+      position += sizeof(vector_size);
+
+      object.resize(vector_size);
+      if constexpr (std::is_trivially_copyable_v<T> &&
+                    !std::is_same_v<T, bool>)
+        {
+          if (vector_size > 0)
+            std::memcpy(object.data(), position, vector_size * sizeof(T));
+          position += vector_size * sizeof(T);
+        }
+      else if constexpr (IsBitwiseSerializable<T>::value)
+        {
+          for (auto &element : object)
+            read_bitwise_serializable_from_buffer(position, element);
+        }
+      else
+        {
+          // We shouldn't get here:
+          DEAL_II_ASSERT_UNREACHABLE();
+        }
+    }
+
   } // namespace internal
 
 
@@ -1422,18 +1714,36 @@ namespace Utilities
         internal::append_vector_of_trivially_copyable_to_buffer(object,
                                                                 dest_buffer);
 
+        size = dest_buffer.size() - previous_size;
+      }
+    // Next try nested vectors, pairs, and tuples of trivially copyable
+    // objects, as well as trivially copyable objects that are too large
+    // for the first case. Again, we only do this if we are not asked to
+    // compress the data.
+    else if (internal::IsBitwiseSerializable<T>::value &&
+             (allow_compression == false))
+      {
+        const std::size_t previous_size = dest_buffer.size();
+
+        internal::append_bitwise_serializable_to_buffer(object, dest_buffer);
+
         size = dest_buffer.size() - previous_size;
       }
     else
       {
         // use buffer as the target of a compressing
-        // stream into which we serialize the current object
+        // stream into which we serialize the current object. the data
+        // is compressed with the fastest level of zlib, as the buffers
+        // are typically sent or written right away and the time for the
+        // compression would otherwise dominate
         const std::size_t previous_size = dest_buffer.size();
         {
           boost::iostreams::filtering_ostreambuf fosb;
 #ifdef DEAL_II_WITH_ZLIB
           if (allow_compression)
-            fosb.push(boost::iostreams::gzip_compressor());
+            fosb.push(boost::iostreams::gzip_compressor(
+              boost::iostreams::gzip_params(
+                boost::iostreams::gzip::best_speed)));
 #else
           (void)allow_compression;
 #endif
@@ -1510,6 +1820,19 @@ namespace Utilities
                                                                   object);
         return object;
       }
+    // Next try nested vectors, pairs, and tuples of trivially copyable
+    // objects, see the pack() function.
+    else if (internal::IsBitwiseSerializable<T>::value &&
+             (allow_compression == false))
+      {
+        T           object;
+        const char *position = &*cbegin;
+        internal::read_bitwise_serializable_from_buffer(position, object);
+
+        Assert(position == &*cbegin + (cend - cbegin),
+               ExcMessage("The given buffer has the wrong size."));
+        return object;
+      }
     else
       {
         // decompress the buffer section into the object
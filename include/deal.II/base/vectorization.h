@@ -58,6 +58,12 @@
 #    error \
       "Mismatch in vectorization capabilities: AVX-512F was detected during configuration of deal.II and switched on, but it is apparently not available for the file you are trying to compile at the moment. Check compilation flags controlling the instruction set, such as -march=native."
 #  endif
+#  if defined(DEAL_II_HAVE_ARM_SVE) &&    \
+    (!defined(__ARM_FEATURE_SVE_BITS) || \
+     __ARM_FEATURE_SVE_BITS != DEAL_II_VECTORIZATION_WIDTH_IN_BITS)
+#    error \
+      "Mismatch in vectorization capabilities: SVE with a fixed vector length was detected during configuration of deal.II and switched on, but it is apparently not available with the same vector length for the file you are trying to compile at the moment. Check compilation flags controlling the instruction set, such as -march=native and -msve-vector-bits."
+#  endif
 
 #  ifdef _MSC_VER
 #    include <intrin.h>
@@ -71,6 +77,9 @@
 #    undef bool
 #  elif defined(__ARM_NEON)
 #    include <arm_neon.h>
+#    if defined(__ARM_FEATURE_SVE_BITS)
+#      include <arm_sve.h>
+#    endif
 #  elif defined(__x86_64__)
 #    include <x86intrin.h>
 #  endif
@@ -417,6 +426,13 @@ public:
  *  - VectorizedArray<double, 2> // SSE2
  *  - VectorizedArray<double, 4> // AVX (default)
  *
+ * and for ARM processors with SVE and a vector length of 512 bits fixed with
+ * `-msve-vector-bits=512`, such as Fujitsu A64FX:
+ *  - VectorizedArray<double, 1> // no vectorization (auto-optimization)
+ *  - VectorizedArray<double, 2> // NEON
+ *  - VectorizedArray<double, 4> // SVE, lower half of the registers
+ *  - VectorizedArray<double, 8> // SVE (default)
+ *
  * and for processors with AltiVec support:
  *  - VectorizedArray<double, 1>
  *  - VectorizedArray<double, 2>
@@ -1572,6 +1588,494 @@ private:
 };
 
 
+#  endif
+
+#  if defined(DEAL_II_HAVE_ARM_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+
+namespace internal
+{
+  /**
+   * Fixed-length variants of the SVE data types with the vector length set
+   * by the compiler flag -msve-vector-bits, which, as opposed to the
+   * sizeless SVE types, can be used as class members.
+   */
+  typedef svfloat64_t sve_fixed_float64_t
+    __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+  typedef svfloat32_t sve_fixed_float32_t
+    __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+
+  /**
+   * The SVE types and intrinsics that depend on the scalar type.
+   */
+  template <typename Number>
+  struct SVETraits;
+
+  template <>
+  struct SVETraits<double>
+  {
+    using vector_type = svfloat64_t;
+
+    using index_type = svuint64_t;
+
+    using fixed_vector_type = sve_fixed_float64_t;
+
+    static svbool_t
+    predicate(const std::size_t width)
+    {
+      return svwhilelt_b64(std::uint64_t(0), std::uint64_t(width));
+    }
+
+    static svfloat64_t
+    duplicate(const double x)
+    {
+      return svdup_f64(x);
+    }
+
+    static svuint64_t
+    load_indices(const svbool_t pg, const unsigned int *offsets)
+    {
+      return svld1uw_u64(pg, offsets);
+    }
+  };
+
+  template <>
+  struct SVETraits<float>
+  {
+    using vector_type = svfloat32_t;
+
+    using index_type = svuint32_t;
+
+    using fixed_vector_type = sve_fixed_float32_t;
+
+    static svbool_t
+    predicate(const std::size_t width)
+    {
+      return svwhilelt_b32(std::uint32_t(0), std::uint32_t(width));
+    }
+
+    static svfloat32_t
+    duplicate(const float x)
+    {
+      return svdup_f32(x);
+    }
+
+    static svuint32_t
+    load_indices(const svbool_t pg, const unsigned int *offsets)
+    {
+      return svld1_u32(pg, offsets);
+    }
+  };
+
+  /**
+   * The data type stored by VectorizedArraySVE: The fixed-length SVE type if
+   * the array fills a complete SVE register, and a generic vector type of
+   * the same size otherwise, which is loaded into SVE registers with a
+   * predicate for the active lanes.
+   */
+  template <typename Number,
+            std::size_t width,
+            bool        fills_register =
+              (width * sizeof(Number) * 8 == __ARM_FEATURE_SVE_BITS)>
+  struct SVEStorage
+  {
+    typedef Number type __attribute__((vector_size(width * sizeof(Number))));
+  };
+
+  template <typename Number, std::size_t width>
+  struct SVEStorage<Number, width, true>
+  {
+    using type = typename SVETraits<Number>::fixed_vector_type;
+  };
+
+
+
+  /**
+   * Implementation of VectorizedArray for ARM SVE with a vector length fixed
+   * at compile time, shared between the specializations for double and
+   * float. Arrays of @p width smaller than the SVE register operate on the
+   * lower lanes of the registers only.
+   */
+  template <typename Number, std::size_t width>
+  class VectorizedArraySVE
+    : public VectorizedArrayBase<VectorizedArray<Number, width>, width>
+  {
+  public:
+    /**
+     * This gives the type of the array elements.
+     */
+    using value_type = Number;
+
+    /**
+     * Record the fact that the given specialization of VectorizedArray is
+     * indeed implemented.
+     */
+    static constexpr bool is_implemented = true;
+
+    /**
+     * Default empty constructor, leaving the data in an uninitialized state
+     * similar to float/double.
+     */
+    VectorizedArraySVE() = default;
+
+    /**
+     * Construct an array with the given scalar broadcast to all lanes.
+     */
+    VectorizedArraySVE(const Number scalar)
+    {
+      this->operator=(scalar);
+    }
+
+    /**
+     * Construct an array with the given initializer list.
+     */
+    template <typename U>
+    VectorizedArraySVE(const std::initializer_list<U> &list)
+      : VectorizedArrayBase<VectorizedArray<Number, width>, width>(list)
+    {}
+
+    /**
+     * This function can be used to set all data fields to a given scalar.
+     */
+    VectorizedArray<Number, width> &
+    operator=(const Number x) &
+    {
+      set(SVETraits<Number>::duplicate(x));
+      return derived();
+    }
+
+    /**
+     * Assign a scalar to the current object. This overload is used for
+     * rvalue references; because it does not make sense to assign
+     * something to a temporary, the function is deleted.
+     */
+    VectorizedArray<Number, width> &
+    operator=(const Number scalar) && = delete;
+
+    /**
+     * Access operator.
+     */
+    Number &
+    operator[](const unsigned int comp)
+    {
+      return *(reinterpret_cast<Number *>(&data) + comp);
+    }
+
+    /**
+     * Constant access operator.
+     */
+    const Number &
+    operator[](const unsigned int comp) const
+    {
+      return *(reinterpret_cast<const Number *>(&data) + comp);
+    }
+
+    /**
+     * Element-wise addition of two arrays of numbers.
+     */
+    VectorizedArray<Number, width> &
+    operator+=(const VectorizedArraySVE &vec)
+    {
+      set(svadd_x(predicate(), get(), vec.get()));
+      return derived();
+    }
+
+    /**
+     * Element-wise subtraction of two arrays of numbers.
+     */
+    VectorizedArray<Number, width> &
+    operator-=(const VectorizedArraySVE &vec)
+    {
+      set(svsub_x(predicate(), get(), vec.get()));
+      return derived();
+    }
+
+    /**
+     * Element-wise multiplication of two arrays of numbers.
+     */
+    VectorizedArray<Number, width> &
+    operator*=(const VectorizedArraySVE &vec)
+    {
+      set(svmul_x(predicate(), get(), vec.get()));
+      return derived();
+    }
+
+    /**
+     * Element-wise division of two arrays of numbers.
+     */
+    VectorizedArray<Number, width> &
+    operator/=(const VectorizedArraySVE &vec)
+    {
+      set(svdiv_x(predicate(), get(), vec.get()));
+      return derived();
+    }
+
+    /**
+     * Load @p size() from memory into the calling class, starting at
+     * the given address. The memory need not be aligned.
+     */
+    void
+    load(const Number *ptr)
+    {
+      set(svld1(predicate(), ptr));
+    }
+
+    /**
+     * Load @p size() from memory of a different number type into the calling
+     * class, starting at the given address.
+     */
+    template <typename OtherNumber>
+    void
+    load(const OtherNumber *ptr)
+    {
+      for (unsigned int i = 0; i < width; ++i)
+        this->operator[](i) = ptr[i];
+    }
+
+    /**
+     * Write the content of the calling class into memory in form of @p
+     * size() to the given address. The memory need not be aligned.
+     */
+    void
+    store(Number *ptr) const
+    {
+      svst1(predicate(), ptr, get());
+    }
+
+    /**
+     * Write the content of the calling class into memory of a different
+     * number type in form of @p size() to the given address.
+     */
+    template <typename OtherNumber>
+    void
+    store(OtherNumber *ptr) const
+    {
+      for (unsigned int i = 0; i < width; ++i)
+        ptr[i] = this->operator[](i);
+    }
+
+    /**
+     * @copydoc VectorizedArray<Number>::streaming_store()
+     */
+    void
+    streaming_store(Number *ptr) const
+    {
+      svstnt1(predicate(), ptr, get());
+    }
+
+    /**
+     * Load @p size() from memory into the calling class, starting at
+     * the given address and with given offsets, each entry from the offset
+     * providing one element of the vectorized array.
+     *
+     * This operation corresponds to the following code:
+     * @code
+     * for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+     *   this->operator[](v) = base_ptr[offsets[v]];
+     * @endcode
+     */
+    void
+    gather(const Number *base_ptr, const unsigned int *offsets)
+    {
+      const svbool_t pg = predicate();
+      set(svld1_gather_index(pg,
+                             base_ptr,
+                             SVETraits<Number>::load_indices(pg, offsets)));
+    }
+
+    /**
+     * Write the content of the calling class into memory in form of @p
+     * size() to the given address and the given offsets, filling the
+     * elements of the vectorized array into each offset.
+     *
+     * This operation corresponds to the following code:
+     * @code
+     * for (unsigned int v=0; v<VectorizedArray<Number>::size(); ++v)
+     *   base_ptr[offsets[v]] = this->operator[](v);
+     * @endcode
+     */
+    void
+    scatter(const unsigned int *offsets, Number *base_ptr) const
+    {
+      const svbool_t pg = predicate();
+      svst1_scatter_index(pg,
+                          base_ptr,
+                          SVETraits<Number>::load_indices(pg, offsets),
+                          get());
+    }
+
+    /**
+     * Returns sum over entries of the data field, $\sum_{i=1}^{\text{size}()}
+     * this->data[i]$.
+     */
+    Number
+    sum() const
+    {
+      return svaddv(predicate(), get());
+    }
+
+    /**
+     * Actual data field. To be consistent with the standard layout type and
+     * to enable interaction with external SIMD functionality, this member is
+     * declared public.
+     */
+    mutable typename SVEStorage<Number, width>::type data;
+
+    /**
+     * Return the data field as a sizeless SVE vector. Not for use in user
+     * code.
+     */
+    typename SVETraits<Number>::vector_type
+    get() const
+    {
+      if constexpr (width * sizeof(Number) * 8 == __ARM_FEATURE_SVE_BITS)
+        return data;
+      else
+        return svld1(predicate(), reinterpret_cast<const Number *>(&data));
+    }
+
+    /**
+     * Set the data field from a sizeless SVE vector. Not for use in user
+     * code.
+     */
+    void
+    set(const typename SVETraits<Number>::vector_type value)
+    {
+      if constexpr (width * sizeof(Number) * 8 == __ARM_FEATURE_SVE_BITS)
+        data = value;
+      else
+        svst1(predicate(), reinterpret_cast<Number *>(&data), value);
+    }
+
+    /**
+     * Return the predicate selecting the active lanes. Not for use in user
+     * code.
+     */
+    static svbool_t
+    predicate()
+    {
+      return SVETraits<Number>::predicate(width);
+    }
+
+    /**
+     * Return the square root of this field. Not for use in user code. Use
+     * sqrt(x) instead.
+     */
+    VectorizedArray<Number, width>
+    get_sqrt() const
+    {
+      VectorizedArray<Number, width> res;
+      res.set(svsqrt_x(predicate(), get()));
+      return res;
+    }
+
+    /**
+     * Return the absolute value of this field. Not for use in user code. Use
+     * abs(x) instead.
+     */
+    VectorizedArray<Number, width>
+    get_abs() const
+    {
+      VectorizedArray<Number, width> res;
+      res.set(svabs_x(predicate(), get()));
+      return res;
+    }
+
+    /**
+     * Return the component-wise maximum of this field and another one. Not
+     * for use in user code. Use max(x,y) instead.
+     */
+    VectorizedArray<Number, width>
+    get_max(const VectorizedArraySVE &other) const
+    {
+      VectorizedArray<Number, width> res;
+      res.set(svmax_x(predicate(), get(), other.get()));
+      return res;
+    }
+
+    /**
+     * Return the component-wise minimum of this field and another one. Not
+     * for use in user code. Use min(x,y) instead.
+     */
+    VectorizedArray<Number, width>
+    get_min(const VectorizedArraySVE &other) const
+    {
+      VectorizedArray<Number, width> res;
+      res.set(svmin_x(predicate(), get(), other.get()));
+      return res;
+    }
+
+  private:
+    /**
+     * Return a reference to the derived class.
+     */
+    VectorizedArray<Number, width> &
+    derived()
+    {
+      return static_cast<VectorizedArray<Number, width> &>(*this);
+    }
+  };
+} // namespace internal
+
+
+
+/**
+ * Specialization for double and ARM SVE with 256-bit vectors, or the lower
+ * half of 512-bit vectors.
+ */
+template <>
+class VectorizedArray<double, 4>
+  : public internal::VectorizedArraySVE<double, 4>
+{
+public:
+  using internal::VectorizedArraySVE<double, 4>::VectorizedArraySVE;
+  using internal::VectorizedArraySVE<double, 4>::operator=;
+};
+
+
+
+/**
+ * Specialization for float and ARM SVE with 256-bit vectors, or the lower
+ * half of 512-bit vectors.
+ */
+template <>
+class VectorizedArray<float, 8>
+  : public internal::VectorizedArraySVE<float, 8>
+{
+public:
+  using internal::VectorizedArraySVE<float, 8>::VectorizedArraySVE;
+  using internal::VectorizedArraySVE<float, 8>::operator=;
+};
+
+#    if __ARM_FEATURE_SVE_BITS >= 512
+
+/**
+ * Specialization for double and ARM SVE with 512-bit vectors.
+ */
+template <>
+class VectorizedArray<double, 8>
+  : public internal::VectorizedArraySVE<double, 8>
+{
+public:
+  using internal::VectorizedArraySVE<double, 8>::VectorizedArraySVE;
+  using internal::VectorizedArraySVE<double, 8>::operator=;
+};
+
+
+
+/**
+ * Specialization for float and ARM SVE with 512-bit vectors.
+ */
+template <>
+class VectorizedArray<float, 16>
+  : public internal::VectorizedArraySVE<float, 16>
+{
+public:
+  using internal::VectorizedArraySVE<float, 16>::VectorizedArraySVE;
+  using internal::VectorizedArraySVE<float, 16>::operator=;
+};
+
+#    endif
+
 #  endif
 
 #  if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(__SSE2__)
@@ -6394,6 +6898,110 @@ compare_and_apply_mask(const VectorizedArray<double, 2> &left,
   return result;
 }
 
+#  endif
+
+#  if defined(DEAL_II_HAVE_ARM_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+
+namespace internal
+{
+  template <SIMDComparison predicate, typename Number, std::size_t width>
+  DEAL_II_ALWAYS_INLINE inline VectorizedArray<Number, width>
+  sve_compare_and_apply_mask(const VectorizedArray<Number, width> &left,
+                             const VectorizedArray<Number, width> &right,
+                             const VectorizedArray<Number, width> &true_values,
+                             const VectorizedArray<Number, width> &false_values)
+  {
+    const svbool_t pg = VectorizedArray<Number, width>::predicate();
+    svbool_t       mask;
+    switch (predicate)
+      {
+        case SIMDComparison::equal:
+          mask = svcmpeq(pg, left.get(), right.get());
+          break;
+        case SIMDComparison::not_equal:
+          mask = svcmpne(pg, left.get(), right.get());
+          break;
+        case SIMDComparison::less_than:
+          mask = svcmplt(pg, left.get(), right.get());
+          break;
+        case SIMDComparison::less_than_or_equal:
+          mask = svcmple(pg, left.get(), right.get());
+          break;
+        case SIMDComparison::greater_than:
+          mask = svcmpgt(pg, left.get(), right.get());
+          break;
+        case SIMDComparison::greater_than_or_equal:
+          mask = svcmpge(pg, left.get(), right.get());
+          break;
+      }
+
+    VectorizedArray<Number, width> result;
+    result.set(svsel(mask, true_values.get(), false_values.get()));
+    return result;
+  }
+} // namespace internal
+
+
+
+template <SIMDComparison predicate>
+DEAL_II_ALWAYS_INLINE inline VectorizedArray<double, 4>
+compare_and_apply_mask(const VectorizedArray<double, 4> &left,
+                       const VectorizedArray<double, 4> &right,
+                       const VectorizedArray<double, 4> &true_values,
+                       const VectorizedArray<double, 4> &false_values)
+{
+  return internal::sve_compare_and_apply_mask<predicate>(left,
+                                                         right,
+                                                         true_values,
+                                                         false_values);
+}
+
+
+
+template <SIMDComparison predicate>
+DEAL_II_ALWAYS_INLINE inline VectorizedArray<float, 8>
+compare_and_apply_mask(const VectorizedArray<float, 8> &left,
+                       const VectorizedArray<float, 8> &right,
+                       const VectorizedArray<float, 8> &true_values,
+                       const VectorizedArray<float, 8> &false_values)
+{
+  return internal::sve_compare_and_apply_mask<predicate>(left,
+                                                         right,
+                                                         true_values,
+                                                         false_values);
+}
+
+#    if __ARM_FEATURE_SVE_BITS >= 512
+
+template <SIMDComparison predicate>
+DEAL_II_ALWAYS_INLINE inline VectorizedArray<double, 8>
+compare_and_apply_mask(const VectorizedArray<double, 8> &left,
+                       const VectorizedArray<double, 8> &right,
+                       const VectorizedArray<double, 8> &true_values,
+                       const VectorizedArray<double, 8> &false_values)
+{
+  return internal::sve_compare_and_apply_mask<predicate>(left,
+                                                         right,
+                                                         true_values,
+                                                         false_values);
+}
+
+
+
+template <SIMDComparison predicate>
+DEAL_II_ALWAYS_INLINE inline VectorizedArray<float, 16>
+compare_and_apply_mask(const VectorizedArray<float, 16> &left,
+                       const VectorizedArray<float, 16> &right,
+                       const VectorizedArray<float, 16> &true_values,
+                       const VectorizedArray<float, 16> &false_values)
+{
+  return internal::sve_compare_and_apply_mask<predicate>(left,
+                                                         right,
+                                                         true_values,
+                                                         false_values);
+}
+
+#    endif
 #  endif
 #endif // DOXYGEN
 
@@ -25,6 +25,7 @@
 #  include <deal.II/base/template_constraints.h>
 #  include <deal.II/base/thread_local_storage.h>
 #  include <deal.II/base/thread_management.h>
+#  include <deal.II/base/trace.h>
 
 #  ifdef DEAL_II_WITH_TBB
 #    ifdef DEAL_II_TBB_WITH_ONEAPI
@@ -34,9 +35,18 @@
 #    endif
 #  endif
 
+#  ifdef DEAL_II_WITH_TASKFLOW
+#    include <taskflow/taskflow.hpp>
+#  endif
+
+#  include <algorithm>
+#  include <chrono>
 #  include <functional>
 #  include <iterator>
+#  include <map>
 #  include <memory>
+#  include <mutex>
+#  include <thread>
 #  include <utility>
 #  include <vector>
 
@@ -158,12 +168,177 @@ DEAL_II_NAMESPACE_OPEN
  */
 namespace WorkStream
 {
+  /**
+   * A structure with optional settings for the WorkStream::run() function
+   * taking an AdditionalData argument.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(
+      const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
+      const unsigned int chunk_size   = 8,
+      const bool         copier_is_commutative = false,
+      const bool         adaptive_chunk_size   = false)
+      : queue_length(queue_length)
+      , chunk_size(chunk_size)
+      , copier_is_commutative(copier_is_commutative)
+      , adaptive_chunk_size(adaptive_chunk_size)
+    {}
+
+    /**
+     * The number of items that can be live at any given time, see the
+     * documentation of WorkStream::run().
+     */
+    unsigned int queue_length;
+
+    /**
+     * The number of elements of the input stream that are worked on by the
+     * worker and copier functions one after the other on the same thread.
+     */
+    unsigned int chunk_size;
+
+    /**
+     * Set this flag if the order in which the copier is applied to the
+     * results of the worker does not matter, i.e., if the copier operations
+     * commute, as it is the case when adding local contributions into global
+     * matrices and vectors up to round-off. The copier is then still never
+     * run concurrently with itself, but may process a chunk as soon as its
+     * worker has finished instead of waiting for all previous chunks.
+     */
+    bool copier_is_commutative;
+
+    /**
+     * Set this flag if the cost of the worker varies strongly between the
+     * elements of the input stream, as in hp-adaptive or cut-cell
+     * assembly. The chunk_size is then only an upper bound: the chunks
+     * handed out get smaller towards the end of the range, so that all
+     * threads run out of work at about the same time, and they get smaller
+     * where the measured time per element of the most recent chunks is
+     * larger than the average over all elements processed so far.
+     */
+    bool adaptive_chunk_size;
+  };
+
+
+
+  /**
+   * A structure into which WorkStream::run() can record the time spent in
+   * the individual stages of the algorithm.
+   */
+  struct Statistics
+  {
+    /**
+     * The wall time in seconds spent in the whole call to WorkStream::run().
+     */
+    double wall_time = 0.;
+
+    /**
+     * The time in seconds spent in the worker, summed over all threads.
+     */
+    double worker_time = 0.;
+
+    /**
+     * The time in seconds spent in the copier.
+     */
+    double copier_time = 0.;
+
+    /**
+     * For each of the MultithreadInfo::n_threads() threads, the time in
+     * seconds during the call to WorkStream::run() in which the thread ran
+     * neither the worker nor the copier. Large values for some of the
+     * threads indicate that the work was not well balanced between them.
+     * The threads are not ordered in any particular way.
+     */
+    std::vector<double> idle_time_per_thread;
+  };
+
+
+
   /**
    * The nested namespaces contain various implementations of the workstream
    * algorithms.
    */
   namespace internal
   {
+    /**
+     * Return the number of elements of the next chunk to be handed out when
+     * WorkStream::AdditionalData::adaptive_chunk_size is set. This is a
+     * fraction of the @p n_remaining elements still to be worked on, so
+     * that the chunks get smaller towards the end of the range, scaled by
+     * the ratio of the average time per element over all elements processed
+     * so far to the time per element of the most recent ones, and limited
+     * by @p max_chunk_size.
+     */
+    inline unsigned int
+    get_adaptive_chunk_size(const std::size_t  n_remaining,
+                            const unsigned int max_chunk_size,
+                            const double       average_cost = 0.,
+                            const double       recent_cost  = 0.)
+    {
+      double chunk_size =
+        static_cast<double>(n_remaining) / (2 * MultithreadInfo::n_threads());
+      if (average_cost > 0. && recent_cost > 0.)
+        chunk_size *= average_cost / recent_cost;
+      return static_cast<unsigned int>(
+        std::max(1., std::min<double>(chunk_size, max_chunk_size)));
+    }
+
+
+
+    /**
+     * A class that accumulates the time each thread spends in the worker
+     * and copier functions, to fill WorkStream::Statistics.
+     */
+    class ThreadTimes
+    {
+    public:
+      /**
+       * Add the time since @p start to @p total_time and to the busy time of
+       * the calling thread.
+       */
+      void
+      add(double                                     &total_time,
+          const std::chrono::steady_clock::time_point start)
+      {
+        const double elapsed =
+          std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                        start)
+            .count();
+        std::lock_guard<std::mutex> lock(mutex);
+        total_time += elapsed;
+        busy_time[std::this_thread::get_id()] += elapsed;
+      }
+
+      /**
+       * Fill Statistics::idle_time_per_thread from the busy times recorded
+       * so far and the given wall time.
+       */
+      void
+      fill_idle_times(Statistics &statistics, const double wall_time) const
+      {
+        statistics.idle_time_per_thread.assign(
+          std::max<std::size_t>(MultithreadInfo::n_threads(),
+                                busy_time.size()),
+          wall_time);
+        unsigned int thread = 0;
+        for (const auto &[id, time] : busy_time)
+          {
+            (void)id;
+            statistics.idle_time_per_thread[thread++] =
+              std::max(0., wall_time - time);
+          }
+      }
+
+    private:
+      std::mutex                         mutex;
+      std::map<std::thread::id, double> busy_time;
+    };
+
+
+
 #  ifdef DEAL_II_WITH_TBB
     /**
      * A namespace for the implementation of details of the WorkStream pattern
@@ -300,6 +475,12 @@ namespace WorkStream
            */
           bool currently_in_use;
 
+          /**
+           * The time in seconds the worker took for the elements of this
+           * item, if the chunk size is adapted to the cost of the worker.
+           */
+          double worker_time;
+
 
           /**
            * Default constructor. Initialize everything that doesn't have a
@@ -310,6 +491,7 @@ namespace WorkStream
             , scratch_data(nullptr)
             , sample_scratch_data(nullptr)
             , currently_in_use(false)
+            , worker_time(0.)
           {}
         };
 
@@ -324,12 +506,22 @@ namespace WorkStream
                                   const unsigned int buffer_size,
                                   const unsigned int chunk_size,
                                   const ScratchData &sample_scratch_data,
-                                  const CopyData    &sample_copy_data)
+                                  const CopyData    &sample_copy_data,
+                                  const bool adaptive_chunk_size = false)
           : remaining_iterator_range(begin, end)
           , item_buffer(buffer_size)
           , sample_scratch_data(sample_scratch_data)
           , chunk_size(chunk_size)
+          , adaptive_chunk_size(adaptive_chunk_size)
+          , n_remaining(0)
+          , n_measured(0)
+          , measured_time(0.)
+          , recent_cost(0.)
         {
+          if (adaptive_chunk_size)
+            for (Iterator it = begin; it != end; ++it)
+              ++n_remaining;
+
           // initialize the elements of the ring buffer
           for (auto &item : item_buffer)
             {
@@ -376,13 +568,36 @@ namespace WorkStream
           Assert(current_item != nullptr,
                  ExcMessage("This can't be. There must be a free item!"));
 
+          // if the chunk size is adapted, the item we reuse holds the
+          // time its worker took the last time around. blend it into the
+          // cost estimates before deciding how much to put into the item
+          unsigned int next_chunk_size = chunk_size;
+          if (adaptive_chunk_size)
+            {
+              if (current_item->n_iterators > 0)
+                {
+                  const double cost =
+                    current_item->worker_time / current_item->n_iterators;
+                  recent_cost =
+                    (n_measured == 0 ? cost : 0.5 * (recent_cost + cost));
+                  measured_time += current_item->worker_time;
+                  n_measured += current_item->n_iterators;
+                }
+              next_chunk_size = get_adaptive_chunk_size(
+                n_remaining,
+                chunk_size,
+                n_measured > 0 ? measured_time / n_measured : 0.,
+                recent_cost);
+            }
+
           // initialize the next item. it may
-          // consist of at most chunk_size
+          // consist of at most next_chunk_size
           // elements
           current_item->n_iterators = 0;
+          current_item->worker_time = 0.;
           while ((remaining_iterator_range.first !=
                   remaining_iterator_range.second) &&
-                 (current_item->n_iterators < chunk_size))
+                 (current_item->n_iterators < next_chunk_size))
             {
               current_item->iterators[current_item->n_iterators] =
                 remaining_iterator_range.first;
@@ -390,6 +605,8 @@ namespace WorkStream
               ++remaining_iterator_range.first;
               ++current_item->n_iterators;
             }
+          if (adaptive_chunk_size)
+            n_remaining -= current_item->n_iterators;
 
           if (current_item->n_iterators == 0)
             // there were no items
@@ -456,8 +673,35 @@ namespace WorkStream
          * work on sequentially; a large number makes sure that each thread
          * gets a significant amount of work before the next task switch
          * happens, whereas a small number is better for load balancing.
+         * If the chunk size is adapted, this is the upper bound.
          */
         const unsigned int chunk_size;
+
+        /**
+         * Whether the number of elements per item is adapted to the
+         * measured cost of the worker.
+         */
+        const bool adaptive_chunk_size;
+
+        /**
+         * The number of elements in remaining_iterator_range, only computed
+         * if the chunk size is adapted.
+         */
+        std::size_t n_remaining;
+
+        /**
+         * The number of elements and the total time of the items whose
+         * worker times have been taken into account so far.
+         */
+        std::size_t n_measured;
+        double      measured_time;
+
+        /**
+         * An estimate of the time per element of the most recently finished
+         * items, as an average that gives the most recent item the largest
+         * weight.
+         */
+        double recent_cost;
       };
 
 
@@ -475,7 +719,9 @@ namespace WorkStream
           const ScratchData                          &sample_scratch_data,
           const CopyData                             &sample_copy_data,
           const unsigned int                          queue_length,
-          const unsigned int                          chunk_size)
+          const unsigned int                          chunk_size,
+          const bool copier_is_commutative = false,
+          const bool adaptive_chunk_size   = false)
       {
         using ItemType = typename IteratorRangeToItemStream<Iterator,
                                                             ScratchData,
@@ -494,7 +740,8 @@ namespace WorkStream
                                         queue_length,
                                         chunk_size,
                                         sample_scratch_data,
-                                        sample_copy_data);
+                                        sample_copy_data,
+                                        adaptive_chunk_size);
         auto item_generator = [&](tbb::flow_control &fc) -> ItemType * {
           if (const auto item = iterator_range_to_item_stream.get_item())
             return item;
@@ -515,8 +762,8 @@ namespace WorkStream
              std::function<void(const Iterator &, ScratchData &, CopyData &)>(
                worker),
            copier_exists =
-             static_cast<bool>(std::function<void(const CopyData &)>(copier))](
-            ItemType *current_item) {
+             static_cast<bool>(std::function<void(const CopyData &)>(copier)),
+           adaptive_chunk_size](ItemType *current_item) {
             // we need to find an unused scratch data object in the list that
             // corresponds to the current thread and then mark it as used. if
             // we can't find one, create one
@@ -555,6 +802,7 @@ namespace WorkStream
             // were given. since these worker functions are called on separate
             // threads, nothing good can happen if they throw an exception and
             // we are best off catching it and showing an error message
+            const auto start = std::chrono::steady_clock::now();
             for (unsigned int i = 0; i < current_item->n_iterators; ++i)
               {
                 try
@@ -573,6 +821,11 @@ namespace WorkStream
                     Threads::internal::handle_unknown_exception();
                   }
               }
+            if (adaptive_chunk_size)
+              current_item->worker_time =
+                std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
 
             // finally mark the scratch object as unused again. as above, there
             // is no need to lock anything here since the object we work on
@@ -646,11 +899,16 @@ namespace WorkStream
 #    endif
           item_worker);
 
+        // If the copier operations commute, the items need not be copied in
+        // the order in which they were generated, which avoids that a slow
+        // item holds back all the ones behind it.
         auto tbb_copier_filter = tbb::make_filter<ItemType *, void>(
 #    ifdef DEAL_II_TBB_WITH_ONEAPI
-          tbb::filter_mode::serial_in_order,
+          copier_is_commutative ? tbb::filter_mode::serial_out_of_order :
+                                  tbb::filter_mode::serial_in_order,
 #    else
-          tbb::filter::serial,
+          copier_is_commutative ? tbb::filter::serial_out_of_order :
+                                  tbb::filter::serial_in_order,
 #    endif
           item_copier);
 
@@ -758,6 +1016,155 @@ namespace WorkStream
 
 
 
+#  ifdef DEAL_II_WITH_TASKFLOW
+    /**
+     * An implementation of the WorkStream pattern on top of the taskflow
+     * library. Rather than a pipeline, it builds a task graph with one worker
+     * task per chunk of the input range and one copier task per chunk that
+     * depends on the corresponding worker task. The copier tasks are chained
+     * to preserve the order of the input range, unless the copier is
+     * declared commutative, in which case they only exclude each other.
+     */
+    namespace taskflow
+    {
+      template <typename Worker,
+                typename Copier,
+                typename Iterator,
+                typename ScratchData,
+                typename CopyData>
+      void
+      run(const Iterator                             &begin,
+          const std_cxx20::type_identity_t<Iterator> &end,
+          Worker                                      worker,
+          Copier                                      copier,
+          const ScratchData                          &sample_scratch_data,
+          const CopyData                             &sample_copy_data,
+          const unsigned int                          chunk_size,
+          const bool                                  copier_is_commutative,
+          const bool                                  adaptive_chunk_size,
+          Statistics                                 *statistics,
+          ThreadTimes                                &thread_times)
+      {
+        const std::function<void(const Iterator &, ScratchData &, CopyData &)>
+          worker_function = worker;
+        const std::function<void(const CopyData &)> copier_function = copier;
+
+        // all tasks are created up front, so the chunk size can not take
+        // the measured cost of the worker into account. if requested, the
+        // chunks only get smaller towards the end of the range
+        std::size_t n_remaining = 0;
+        if (adaptive_chunk_size)
+          for (Iterator it = begin; it != end; ++it)
+            ++n_remaining;
+
+        std::vector<std::vector<Iterator>> chunks;
+        for (Iterator it = begin; it != end;)
+          {
+            const unsigned int size =
+              adaptive_chunk_size ?
+                get_adaptive_chunk_size(n_remaining, chunk_size) :
+                chunk_size;
+            chunks.emplace_back();
+            chunks.back().reserve(size);
+            for (unsigned int i = 0; i < size && it != end; ++i, ++it)
+              chunks.back().push_back(it);
+            if (adaptive_chunk_size)
+              n_remaining -= chunks.back().size();
+          }
+
+        // every thread of the executor gets its own scratch object. it is
+        // created the first time the thread runs a worker task, so that with
+        // the usual first-touch policy its memory resides in the NUMA domain
+        // of the thread using it
+        Threads::ThreadLocalStorage<std::unique_ptr<ScratchData>>
+                                           scratch_data;
+        std::vector<std::vector<CopyData>> copy_data(chunks.size());
+
+        std::mutex copier_mutex;
+        const auto add_time =
+          [&](double &time, const std::chrono::steady_clock::time_point start) {
+            if (statistics != nullptr)
+              thread_times.add(time, start);
+          };
+        double worker_time = 0., copier_time = 0.;
+
+        tf::Taskflow taskflow;
+        tf::Task     previous_copier_task;
+        for (std::size_t c = 0; c < chunks.size(); ++c)
+          {
+            tf::Task worker_task = taskflow.emplace([&, c]() {
+              const auto start = std::chrono::steady_clock::now();
+              try
+                {
+                  std::unique_ptr<ScratchData> &scratch = scratch_data.get();
+                  if (scratch == nullptr)
+                    scratch = std::make_unique<ScratchData>(sample_scratch_data);
+
+                  copy_data[c].resize(chunks[c].size(), sample_copy_data);
+                  if (worker_function)
+                    for (unsigned int i = 0; i < chunks[c].size(); ++i)
+                      worker_function(chunks[c][i], *scratch, copy_data[c][i]);
+                }
+              catch (const std::exception &exc)
+                {
+                  Threads::internal::handle_std_exception(exc);
+                }
+              catch (...)
+                {
+                  Threads::internal::handle_unknown_exception();
+                }
+              add_time(worker_time, start);
+            });
+
+            if (copier_function)
+              {
+                tf::Task copier_task = taskflow.emplace([&, c]() {
+                  std::unique_lock<std::mutex> lock(copier_mutex,
+                                                    std::defer_lock);
+                  if (copier_is_commutative)
+                    lock.lock();
+
+                  const auto start = std::chrono::steady_clock::now();
+                  try
+                    {
+                      for (const CopyData &data : copy_data[c])
+                        copier_function(data);
+                    }
+                  catch (const std::exception &exc)
+                    {
+                      Threads::internal::handle_std_exception(exc);
+                    }
+                  catch (...)
+                    {
+                      Threads::internal::handle_unknown_exception();
+                    }
+                  add_time(copier_time, start);
+
+                  // release the memory of this chunk right away
+                  std::vector<CopyData>().swap(copy_data[c]);
+                });
+
+                worker_task.precede(copier_task);
+                if (copier_is_commutative == false &&
+                    previous_copier_task.empty() == false)
+                  previous_copier_task.precede(copier_task);
+                previous_copier_task = copier_task;
+              }
+          }
+
+        MultithreadInfo::get_taskflow_executor().run(taskflow).wait();
+
+        if (statistics != nullptr)
+          {
+            statistics->worker_time = worker_time;
+            statistics->copier_time = copier_time;
+          }
+      }
+    } // namespace taskflow
+#  endif // DEAL_II_WITH_TASKFLOW
+
+
+
 #  ifdef DEAL_II_WITH_TBB
     /**
      * A namespace for the implementation of details of the WorkStream pattern
@@ -1130,6 +1537,8 @@ namespace WorkStream
       const unsigned int queue_length = 2 * MultithreadInfo::n_threads(),
       const unsigned int chunk_size   = 8)
   {
+    const Trace::Scope trace_scope("WorkStream::run");
+
     Assert(queue_length > 0,
            ExcMessage("The queue length must be at least one, and preferably "
                       "larger than the number of processors on this system."));
@@ -1198,6 +1607,139 @@ namespace WorkStream
 
 
 
+  /**
+   * Same as the function above, but with the parameters collected in an
+   * AdditionalData object, which additionally allows to declare the copier
+   * commutative, and with optional timing of the individual stages.
+   *
+   * If deal.II was configured with taskflow, this function uses a task-graph
+   * implementation that runs on the executor returned by
+   * MultithreadInfo::get_taskflow_executor(). It keeps one ScratchData object
+   * per thread instead of one per queue element, and ignores
+   * AdditionalData::queue_length. Since all tasks are created before the
+   * first one runs, AdditionalData::adaptive_chunk_size then only makes the
+   * chunks smaller towards the end of the range, without taking the
+   * measured cost of the worker into account. Otherwise, it uses the same
+   * implementation as the function above.
+   *
+   * If @p statistics is not a null pointer, the wall time of the call, the
+   * time spent in the worker and copier functions, and the idle time of
+   * each thread are recorded in it.
+   */
+  template <typename Worker,
+            typename Copier,
+            typename Iterator,
+            typename ScratchData,
+            typename CopyData>
+  void
+  run(const Iterator                             &begin,
+      const std_cxx20::type_identity_t<Iterator> &end,
+      Worker                                      worker,
+      Copier                                      copier,
+      const ScratchData                          &sample_scratch_data,
+      const CopyData                             &sample_copy_data,
+      const AdditionalData                       &additional_data,
+      Statistics                                 *statistics = nullptr)
+  {
+    const Trace::Scope trace_scope("WorkStream::run");
+
+    Assert(additional_data.queue_length > 0,
+           ExcMessage("The queue length must be at least one, and preferably "
+                      "larger than the number of processors on this system."));
+    Assert(additional_data.chunk_size > 0,
+           ExcMessage("The chunk_size must be at least one."));
+
+    const auto start = std::chrono::steady_clock::now();
+    if (statistics != nullptr)
+      *statistics = Statistics();
+
+    if (!(begin != end))
+      return;
+
+    internal::ThreadTimes thread_times;
+    const auto            finalize_statistics = [&]() {
+      if (statistics != nullptr)
+        {
+          statistics->wall_time =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          start)
+              .count();
+          thread_times.fill_idle_times(*statistics, statistics->wall_time);
+        }
+    };
+
+#  ifdef DEAL_II_WITH_TASKFLOW
+    if (MultithreadInfo::n_threads() > 1)
+      {
+        internal::taskflow::run(begin,
+                                end,
+                                worker,
+                                copier,
+                                sample_scratch_data,
+                                sample_copy_data,
+                                additional_data.chunk_size,
+                                additional_data.copier_is_commutative,
+                                additional_data.adaptive_chunk_size,
+                                statistics,
+                                thread_times);
+        finalize_statistics();
+        return;
+      }
+#  endif
+
+    std::function<void(const Iterator &, ScratchData &, CopyData &)>
+                                          worker_function = worker;
+    std::function<void(const CopyData &)> copier_function = copier;
+
+    // wrap the functions into timers if requested. the busy time of each
+    // thread is recorded as well, to determine how long threads were idle
+    if (statistics != nullptr)
+      {
+        if (worker_function)
+          worker_function = [&, function = worker_function](const Iterator &it,
+                                                            ScratchData &scratch,
+                                                            CopyData &copy) {
+            const auto worker_start = std::chrono::steady_clock::now();
+            function(it, scratch, copy);
+            thread_times.add(statistics->worker_time, worker_start);
+          };
+        if (copier_function)
+          copier_function = [&, function = copier_function](
+                              const CopyData &copy) {
+            const auto copier_start = std::chrono::steady_clock::now();
+            function(copy);
+            thread_times.add(statistics->copier_time, copier_start);
+          };
+      }
+
+#  ifdef DEAL_II_WITH_TBB
+    if (MultithreadInfo::n_threads() > 1 && copier_function)
+      internal::tbb_no_coloring::run(begin,
+                                     end,
+                                     worker_function,
+                                     copier_function,
+                                     sample_scratch_data,
+                                     sample_copy_data,
+                                     additional_data.queue_length,
+                                     additional_data.chunk_size,
+                                     additional_data.copier_is_commutative,
+                                     additional_data.adaptive_chunk_size);
+    else
+#  endif
+      run(begin,
+          end,
+          worker_function,
+          copier_function,
+          sample_scratch_data,
+          sample_copy_data,
+          additional_data.queue_length,
+          additional_data.chunk_size);
+
+    finalize_statistics();
+  }
+
+
+
   /**
    * Same as the function above, but for iterator ranges and C-style arrays.
    * A class that fulfills the requirements of an iterator range defines the
@@ -1277,6 +1819,8 @@ namespace WorkStream
       const unsigned int                        queue_length,
       const unsigned int                        chunk_size)
   {
+    const Trace::Scope trace_scope("WorkStream::run");
+
     Assert(queue_length > 0,
            ExcMessage("The queue length must be at least one, and preferably "
                       "larger than the number of processors on this system."));
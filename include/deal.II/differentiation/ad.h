@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/differentiation/ad/ad_batched_helpers.h>
 #include <deal.II/differentiation/ad/ad_helpers.h>
 #include <deal.II/differentiation/ad/ad_number_traits.h>
 #include <deal.II/differentiation/ad/ad_number_types.h>
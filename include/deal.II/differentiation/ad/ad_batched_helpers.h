@@ -0,0 +1,1103 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_differentiation_ad_ad_batched_helpers_h
+#define dealii_differentiation_ad_ad_batched_helpers_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Differentiation
+{
+  namespace AD
+  {
+    /**
+     * A number type for forward-mode automatic differentiation with respect
+     * to a fixed number of independent variables. An object stores a value
+     * and its derivatives with respect to all independent variables, and the
+     * arithmetic operations and elementary functions propagate both by the
+     * chain rule.
+     *
+     * In contrast to the number types of the libraries wrapped in this
+     * namespace, the underlying type @p Number can be VectorizedArray, in
+     * which case the operations act on the data of several quadrature points
+     * at once. Since the number of derivatives is a template argument, no
+     * memory is allocated. Nesting the class, i.e., using
+     * <tt>DualNumber<n, DualNumber<n, Number>></tt>, gives second
+     * derivatives.
+     *
+     * The class does not provide comparison operators, since the result of a
+     * comparison of VectorizedArray objects is not a single boolean. Branches
+     * need to be written in terms of the value(), e.g., with
+     * compare_and_apply_mask().
+     *
+     * This class is usually not used directly but through
+     * BatchedEnergyFunctional and BatchedResidualLinearization.
+     *
+     * @ingroup auto_symb_diff
+     */
+    template <int n_independent_variables, typename Number>
+    class DualNumber
+    {
+    public:
+      /**
+       * The type of the value and the derivatives.
+       */
+      using value_type = Number;
+
+      /**
+       * Constructor. Set the value and all derivatives to zero.
+       */
+      DualNumber();
+
+      /**
+       * Constructor for a constant, i.e., a number with all derivatives
+       * zero.
+       */
+      DualNumber(const Number &value);
+
+      /**
+       * Constructor for a constant given as an arithmetic type.
+       */
+      template <typename OtherNumber,
+                typename = std::enable_if_t<std::is_arithmetic_v<OtherNumber>>>
+      DualNumber(const OtherNumber &value);
+
+      /**
+       * Return the value.
+       */
+      const Number &
+      value() const;
+
+      /**
+       * Return a writable reference to the value.
+       */
+      Number &
+      value();
+
+      /**
+       * Return the derivative with respect to the independent variable
+       * @p i.
+       */
+      const Number &
+      derivative(const unsigned int i) const;
+
+      /**
+       * Return a writable reference to the derivative with respect to the
+       * independent variable @p i.
+       */
+      Number &
+      derivative(const unsigned int i);
+
+      /**
+       * Add another number.
+       */
+      DualNumber &
+      operator+=(const DualNumber &other);
+
+      /**
+       * Subtract another number.
+       */
+      DualNumber &
+      operator-=(const DualNumber &other);
+
+      /**
+       * Multiply by another number.
+       */
+      DualNumber &
+      operator*=(const DualNumber &other);
+
+      /**
+       * Divide by another number.
+       */
+      DualNumber &
+      operator/=(const DualNumber &other);
+
+      /**
+       * Add a constant.
+       */
+      template <typename Scalar>
+      std::enable_if_t<!std::is_same_v<Scalar, DualNumber>, DualNumber &>
+      operator+=(const Scalar &scalar);
+
+      /**
+       * Subtract a constant.
+       */
+      template <typename Scalar>
+      std::enable_if_t<!std::is_same_v<Scalar, DualNumber>, DualNumber &>
+      operator-=(const Scalar &scalar);
+
+      /**
+       * Multiply by a constant.
+       */
+      template <typename Scalar>
+      std::enable_if_t<!std::is_same_v<Scalar, DualNumber>, DualNumber &>
+      operator*=(const Scalar &scalar);
+
+      /**
+       * Divide by a constant.
+       */
+      template <typename Scalar>
+      std::enable_if_t<!std::is_same_v<Scalar, DualNumber>, DualNumber &>
+      operator/=(const Scalar &scalar);
+
+    private:
+      /**
+       * The value.
+       */
+      Number val;
+
+      /**
+       * The derivatives with respect to the independent variables.
+       */
+      std::array<Number, n_independent_variables> derivatives;
+    };
+
+
+
+    /**
+     * A helper class to compute the first and second derivatives of an
+     * energy functional, e.g., a strain energy function, with respect to a
+     * fixed number of independent variables, for several quadrature points at
+     * once. The interface follows the one of EnergyFunctional, but the
+     * derivatives are computed with DualNumber in forward mode, and the
+     * values are of type @p Number, typically VectorizedArray<double>, which
+     * allows to use the class in matrix-free operators:
+     * @code
+     * BatchedEnergyFunctional<1> ad_helper;
+     * ...
+     * for (const unsigned int q : phi.quadrature_point_indices())
+     *   {
+     *     Tensor<1, 1, VectorizedArray<double>> u;
+     *     u[0] = phi.get_value(q);
+     *     ad_helper.register_independent_variables(u);
+     *
+     *     const auto &x      = ad_helper.get_sensitive_variables();
+     *     const auto  energy = 0.5 * x[0] * x[0] + std::exp(x[0]);
+     *     ad_helper.register_energy_functional(energy);
+     *
+     *     const Tensor<1, 1, VectorizedArray<double>> residual =
+     *       ad_helper.compute_residual();
+     *     const Tensor<2, 1, VectorizedArray<double>> linearization =
+     *       ad_helper.compute_linearization();
+     *     ...
+     *   }
+     * @endcode
+     *
+     * The cost of the evaluation of the energy grows quadratically with the
+     * number of independent variables, like for the nested forward-mode
+     * number types of Sacado.
+     *
+     * @ingroup auto_symb_diff
+     */
+    template <int n_independent_variables,
+              typename Number = VectorizedArray<double>>
+    class BatchedEnergyFunctional
+    {
+    public:
+      /**
+       * The type of the sensitive variables and of the energy.
+       */
+      using ad_type =
+        DualNumber<n_independent_variables,
+                   DualNumber<n_independent_variables, Number>>;
+
+      /**
+       * Set the values of the independent variables at which the energy and
+       * its derivatives are to be evaluated.
+       */
+      void
+      register_independent_variables(
+        const Tensor<1, n_independent_variables, Number> &values);
+
+      /**
+       * Return the independent variables in the form of sensitive variables,
+       * which are used to compute the energy.
+       */
+      const std::array<ad_type, n_independent_variables> &
+      get_sensitive_variables() const;
+
+      /**
+       * Register the energy computed from the sensitive variables.
+       */
+      void
+      register_energy_functional(const ad_type &energy);
+
+      /**
+       * Return the value of the energy.
+       */
+      Number
+      compute_energy() const;
+
+      /**
+       * Return the gradient of the energy with respect to the independent
+       * variables.
+       */
+      Tensor<1, n_independent_variables, Number>
+      compute_residual() const;
+
+      /**
+       * Return the Hessian of the energy with respect to the independent
+       * variables.
+       */
+      Tensor<2, n_independent_variables, Number>
+      compute_linearization() const;
+
+    private:
+      /**
+       * The sensitive variables.
+       */
+      std::array<ad_type, n_independent_variables> sensitive_variables;
+
+      /**
+       * The registered energy.
+       */
+      ad_type energy;
+    };
+
+
+
+    /**
+     * A helper class to compute the linearization of a residual vector with
+     * respect to the same number of independent variables, for several
+     * quadrature points at once. The interface follows the one of
+     * ResidualLinearization, but the derivatives are computed with DualNumber
+     * in forward mode, and the values are of type @p Number, typically
+     * VectorizedArray<double>.
+     *
+     * @ingroup auto_symb_diff
+     */
+    template <int n_independent_variables,
+              typename Number = VectorizedArray<double>>
+    class BatchedResidualLinearization
+    {
+    public:
+      /**
+       * The type of the sensitive variables and of the components of the
+       * residual.
+       */
+      using ad_type = DualNumber<n_independent_variables, Number>;
+
+      /**
+       * Set the values of the independent variables at which the residual
+       * and its linearization are to be evaluated.
+       */
+      void
+      register_independent_variables(
+        const Tensor<1, n_independent_variables, Number> &values);
+
+      /**
+       * Return the independent variables in the form of sensitive variables,
+       * which are used to compute the residual.
+       */
+      const std::array<ad_type, n_independent_variables> &
+      get_sensitive_variables() const;
+
+      /**
+       * Register the residual computed from the sensitive variables.
+       */
+      void
+      register_residual_vector(
+        const std::array<ad_type, n_independent_variables> &residual);
+
+      /**
+       * Return the values of the residual.
+       */
+      Tensor<1, n_independent_variables, Number>
+      compute_residual() const;
+
+      /**
+       * Return the linearization of the residual, where the entry
+       * <tt>(i,j)</tt> is the derivative of the component @p i of the
+       * residual with respect to the independent variable @p j.
+       */
+      Tensor<2, n_independent_variables, Number>
+      compute_linearization() const;
+
+    private:
+      /**
+       * The sensitive variables.
+       */
+      std::array<ad_type, n_independent_variables> sensitive_variables;
+
+      /**
+       * The registered residual.
+       */
+      std::array<ad_type, n_independent_variables> residual;
+    };
+
+
+
+    namespace internal
+    {
+      /**
+       * Whether @p T is a DualNumber.
+       */
+      template <typename T>
+      struct IsDualNumber : std::false_type
+      {};
+
+      template <int n_independent_variables, typename Number>
+      struct IsDualNumber<DualNumber<n_independent_variables, Number>>
+        : std::true_type
+      {};
+    } // namespace internal
+  }   // namespace AD
+} // namespace Differentiation
+
+/* ---------------------- inline functions --------------------------- */
+
+#ifndef DOXYGEN
+
+namespace Differentiation
+{
+  namespace AD
+  {
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number>::DualNumber()
+      : DualNumber(Number(0.))
+    {}
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number>::DualNumber(
+      const Number &value)
+      : val(value)
+    {
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        derivatives[i] = Number(0.);
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    template <typename OtherNumber, typename>
+    inline DualNumber<n_independent_variables, Number>::DualNumber(
+      const OtherNumber &value)
+      : DualNumber(Number(value))
+    {}
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline const Number &
+    DualNumber<n_independent_variables, Number>::value() const
+    {
+      return val;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline Number &
+    DualNumber<n_independent_variables, Number>::value()
+    {
+      return val;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline const Number &
+    DualNumber<n_independent_variables, Number>::derivative(
+      const unsigned int i) const
+    {
+      AssertIndexRange(i, n_independent_variables);
+      return derivatives[i];
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline Number &
+    DualNumber<n_independent_variables, Number>::derivative(
+      const unsigned int i)
+    {
+      AssertIndexRange(i, n_independent_variables);
+      return derivatives[i];
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number> &
+    DualNumber<n_independent_variables, Number>::operator+=(
+      const DualNumber &other)
+    {
+      val += other.val;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        derivatives[i] += other.derivatives[i];
+      return *this;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number> &
+    DualNumber<n_independent_variables, Number>::operator-=(
+      const DualNumber &other)
+    {
+      val -= other.val;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        derivatives[i] -= other.derivatives[i];
+      return *this;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number> &
+    DualNumber<n_independent_variables, Number>::operator*=(
+      const DualNumber &other)
+    {
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        derivatives[i] =
+          derivatives[i] * other.val + val * other.derivatives[i];
+      val *= other.val;
+      return *this;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number> &
+    DualNumber<n_independent_variables, Number>::operator/=(
+      const DualNumber &other)
+    {
+      const Number inverse  = 1. / other.val;
+      const Number quotient = val * inverse;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        derivatives[i] =
+          (derivatives[i] - quotient * other.derivatives[i]) * inverse;
+      val = quotient;
+      return *this;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    template <typename Scalar>
+    inline std::enable_if_t<
+      !std::is_same_v<Scalar, DualNumber<n_independent_variables, Number>>,
+      DualNumber<n_independent_variables, Number> &>
+    DualNumber<n_independent_variables, Number>::operator+=(
+      const Scalar &scalar)
+    {
+      val += scalar;
+      return *this;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    template <typename Scalar>
+    inline std::enable_if_t<
+      !std::is_same_v<Scalar, DualNumber<n_independent_variables, Number>>,
+      DualNumber<n_independent_variables, Number> &>
+    DualNumber<n_independent_variables, Number>::operator-=(
+      const Scalar &scalar)
+    {
+      val -= scalar;
+      return *this;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    template <typename Scalar>
+    inline std::enable_if_t<
+      !std::is_same_v<Scalar, DualNumber<n_independent_variables, Number>>,
+      DualNumber<n_independent_variables, Number> &>
+    DualNumber<n_independent_variables, Number>::operator*=(
+      const Scalar &scalar)
+    {
+      val *= scalar;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        derivatives[i] *= scalar;
+      return *this;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    template <typename Scalar>
+    inline std::enable_if_t<
+      !std::is_same_v<Scalar, DualNumber<n_independent_variables, Number>>,
+      DualNumber<n_independent_variables, Number> &>
+    DualNumber<n_independent_variables, Number>::operator/=(
+      const Scalar &scalar)
+    {
+      val /= scalar;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        derivatives[i] /= scalar;
+      return *this;
+    }
+
+
+
+    /**
+     * Unary minus operator.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number>
+    operator-(const DualNumber<n_independent_variables, Number> &x)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result *= -1.;
+      return result;
+    }
+
+
+
+    /**
+     * Addition operator.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number>
+    operator+(const DualNumber<n_independent_variables, Number> &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result += y;
+      return result;
+    }
+
+
+
+    /**
+     * Subtraction operator.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number>
+    operator-(const DualNumber<n_independent_variables, Number> &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result -= y;
+      return result;
+    }
+
+
+
+    /**
+     * Multiplication operator.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number>
+    operator*(const DualNumber<n_independent_variables, Number> &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result *= y;
+      return result;
+    }
+
+
+
+    /**
+     * Division operator.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables, typename Number>
+    inline DualNumber<n_independent_variables, Number>
+    operator/(const DualNumber<n_independent_variables, Number> &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result /= y;
+      return result;
+    }
+
+
+
+    /**
+     * Addition of a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator+(const DualNumber<n_independent_variables, Number> &x,
+              const Scalar                                      &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result += y;
+      return result;
+    }
+
+
+
+    /**
+     * Addition to a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator+(const Scalar                                      &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      return y + x;
+    }
+
+
+
+    /**
+     * Subtraction of a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator-(const DualNumber<n_independent_variables, Number> &x,
+              const Scalar                                      &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result -= y;
+      return result;
+    }
+
+
+
+    /**
+     * Subtraction from a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator-(const Scalar                                      &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      DualNumber<n_independent_variables, Number> result = -y;
+      result += x;
+      return result;
+    }
+
+
+
+    /**
+     * Multiplication by a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator*(const DualNumber<n_independent_variables, Number> &x,
+              const Scalar                                      &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result *= y;
+      return result;
+    }
+
+
+
+    /**
+     * Multiplication of a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator*(const Scalar                                      &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      return y * x;
+    }
+
+
+
+    /**
+     * Division by a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator/(const DualNumber<n_independent_variables, Number> &x,
+              const Scalar                                      &y)
+    {
+      DualNumber<n_independent_variables, Number> result = x;
+      result /= y;
+      return result;
+    }
+
+
+
+    /**
+     * Division of a constant.
+     *
+     * @relatesalso DualNumber
+     */
+    template <int n_independent_variables,
+              typename Number,
+              typename Scalar,
+              typename = std::enable_if_t<!internal::IsDualNumber<
+                Scalar>::value>>
+    inline DualNumber<n_independent_variables, Number>
+    operator/(const Scalar                                      &x,
+              const DualNumber<n_independent_variables, Number> &y)
+    {
+      DualNumber<n_independent_variables, Number> result{Number(x)};
+      result /= y;
+      return result;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline void
+    BatchedEnergyFunctional<n_independent_variables, Number>::
+      register_independent_variables(
+        const Tensor<1, n_independent_variables, Number> &values)
+    {
+      using inner_type = DualNumber<n_independent_variables, Number>;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        {
+          inner_type value(values[i]);
+          value.derivative(i) = Number(1.);
+          sensitive_variables[i]               = ad_type(value);
+          sensitive_variables[i].derivative(i) = inner_type(1.);
+        }
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline const std::array<
+      typename BatchedEnergyFunctional<n_independent_variables,
+                                       Number>::ad_type,
+      n_independent_variables> &
+    BatchedEnergyFunctional<n_independent_variables,
+                            Number>::get_sensitive_variables() const
+    {
+      return sensitive_variables;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline void
+    BatchedEnergyFunctional<n_independent_variables, Number>::
+      register_energy_functional(const ad_type &energy)
+    {
+      this->energy = energy;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline Number
+    BatchedEnergyFunctional<n_independent_variables, Number>::compute_energy()
+      const
+    {
+      return energy.value().value();
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline Tensor<1, n_independent_variables, Number>
+    BatchedEnergyFunctional<n_independent_variables,
+                            Number>::compute_residual() const
+    {
+      Tensor<1, n_independent_variables, Number> residual;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        residual[i] = energy.derivative(i).value();
+      return residual;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline Tensor<2, n_independent_variables, Number>
+    BatchedEnergyFunctional<n_independent_variables,
+                            Number>::compute_linearization() const
+    {
+      Tensor<2, n_independent_variables, Number> linearization;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        for (unsigned int j = 0; j < n_independent_variables; ++j)
+          linearization[i][j] = energy.derivative(i).derivative(j);
+      return linearization;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline void
+    BatchedResidualLinearization<n_independent_variables, Number>::
+      register_independent_variables(
+        const Tensor<1, n_independent_variables, Number> &values)
+    {
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        {
+          sensitive_variables[i]               = ad_type(values[i]);
+          sensitive_variables[i].derivative(i) = Number(1.);
+        }
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline const std::array<
+      typename BatchedResidualLinearization<n_independent_variables,
+                                            Number>::ad_type,
+      n_independent_variables> &
+    BatchedResidualLinearization<n_independent_variables,
+                                 Number>::get_sensitive_variables() const
+    {
+      return sensitive_variables;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline void
+    BatchedResidualLinearization<n_independent_variables, Number>::
+      register_residual_vector(
+        const std::array<ad_type, n_independent_variables> &residual)
+    {
+      this->residual = residual;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline Tensor<1, n_independent_variables, Number>
+    BatchedResidualLinearization<n_independent_variables,
+                                 Number>::compute_residual() const
+    {
+      Tensor<1, n_independent_variables, Number> values;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        values[i] = residual[i].value();
+      return values;
+    }
+
+
+
+    template <int n_independent_variables, typename Number>
+    inline Tensor<2, n_independent_variables, Number>
+    BatchedResidualLinearization<n_independent_variables,
+                                 Number>::compute_linearization() const
+    {
+      Tensor<2, n_independent_variables, Number> linearization;
+      for (unsigned int i = 0; i < n_independent_variables; ++i)
+        for (unsigned int j = 0; j < n_independent_variables; ++j)
+          linearization[i][j] = residual[i].derivative(j);
+      return linearization;
+    }
+  } // namespace AD
+} // namespace Differentiation
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+
+/**
+ * Implementation of elementary functions for DualNumber. As for
+ * VectorizedArray, they are put into namespace std so that code written for
+ * the built-in types, e.g., <tt>std::exp(x)</tt>, can be used with
+ * DualNumber as well.
+ */
+namespace std
+{
+#ifndef DOXYGEN
+  // Declare all functions up front, since they call each other for nested
+  // dual numbers.
+  template <int n_independent_variables, typename Number>
+  ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+  sin(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                      Number> &x);
+
+  template <int n_independent_variables, typename Number>
+  ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+  cos(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                      Number> &x);
+#endif
+
+
+
+  /**
+   * Compute the square root of a dual number.
+   *
+   * @relatesalso dealii::Differentiation::AD::DualNumber
+   */
+  template <int n_independent_variables, typename Number>
+  inline ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                   Number>
+  sqrt(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                       Number> &x)
+  {
+    ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+                 result = x;
+    const Number root   = std::sqrt(x.value());
+    const Number factor = 0.5 / root;
+    result *= factor;
+    result.value() = root;
+    return result;
+  }
+
+
+
+  /**
+   * Compute the exponential of a dual number.
+   *
+   * @relatesalso dealii::Differentiation::AD::DualNumber
+   */
+  template <int n_independent_variables, typename Number>
+  inline ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                   Number>
+  exp(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                      Number> &x)
+  {
+    ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+                 result = x;
+    const Number value  = std::exp(x.value());
+    result *= value;
+    result.value() = value;
+    return result;
+  }
+
+
+
+  /**
+   * Compute the natural logarithm of a dual number.
+   *
+   * @relatesalso dealii::Differentiation::AD::DualNumber
+   */
+  template <int n_independent_variables, typename Number>
+  inline ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                   Number>
+  log(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                      Number> &x)
+  {
+    ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+      result = x;
+    result /= x.value();
+    result.value() = std::log(x.value());
+    return result;
+  }
+
+
+
+  /**
+   * Raise a dual number to the power @p p.
+   *
+   * @relatesalso dealii::Differentiation::AD::DualNumber
+   */
+  template <int n_independent_variables, typename Number>
+  inline ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                   Number>
+  pow(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                      Number> &x,
+      const double                                             p)
+  {
+    ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+      result = x;
+    result *= p * std::pow(x.value(), p - 1.);
+    result.value() = std::pow(x.value(), p);
+    return result;
+  }
+
+
+
+  /**
+   * Compute the sine of a dual number.
+   *
+   * @relatesalso dealii::Differentiation::AD::DualNumber
+   */
+  template <int n_independent_variables, typename Number>
+  inline ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                   Number>
+  sin(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                      Number> &x)
+  {
+    ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+      result = x;
+    result *= std::cos(x.value());
+    result.value() = std::sin(x.value());
+    return result;
+  }
+
+
+
+  /**
+   * Compute the cosine of a dual number.
+   *
+   * @relatesalso dealii::Differentiation::AD::DualNumber
+   */
+  template <int n_independent_variables, typename Number>
+  inline ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                   Number>
+  cos(const ::dealii::Differentiation::AD::DualNumber<n_independent_variables,
+                                                      Number> &x)
+  {
+    ::dealii::Differentiation::AD::DualNumber<n_independent_variables, Number>
+      result = x;
+    result *= -std::sin(x.value());
+    result.value() = std::cos(x.value());
+    return result;
+  }
+} // namespace std
+
+#endif
@@ -21,6 +21,8 @@
 
 #include <deal.II/dofs/dof_handler.h>
 
+#include <deal.II/lac/vector.h>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -201,6 +203,34 @@ namespace parallel
     static WeightingFunction
     ndofs_weighting(const std::vector<std::pair<float, float>> &coefficients);
 
+    /**
+     * Determine the weight $w_K$ of each cell $K$ from a measured cost $c_K$
+     * of the work done on it, e.g., the time in seconds spent on the cell as
+     * recorded by MatrixFreeTools::CellCostRecorder, in the following way:
+     * \f[ w_K = a \, c_K \frac{n_K^\text{future}}{n_K} \f]
+     * Here, $a$ is the scaling @p factor that converts the measured costs into
+     * integer weights, and the ratio between the number of degrees of freedom
+     * of the future and the present finite element on the cell gives an
+     * estimate of how the cost changes when the polynomial degree is changed
+     * in the course of hp-adaptation. When cells are refined, each child
+     * gets the corresponding fraction of the cost of its parent, and when
+     * cells are coarsened, the costs of the children are summed up.
+     *
+     * The vector @p cost_per_active_cell is indexed by
+     * CellAccessor::active_cell_index() of the cells at the time of the
+     * repartitioning and is copied into the returned function. It only needs
+     * to hold meaningful values for the locally owned cells. Since the
+     * costs are measured on the mesh they are valid for, a new weighting
+     * function needs to be connected via reinit() once new measurements are
+     * available.
+     *
+     * The right hand side will be rounded to the nearest integer since cell
+     * weights are required to be integers.
+     */
+    static WeightingFunction
+    measured_cost_weighting(const Vector<float> &cost_per_active_cell,
+                            const float          factor);
+
     /**
      * @}
      */
@@ -177,6 +177,48 @@ namespace RepartitioningPolicyTools
       weighting_function;
   };
 
+  /**
+   * A policy that orders the active cells along a Hilbert space-filling
+   * curve through their centers and splits the resulting sequence into
+   * pieces of equal weight, one per process. Compared to the z-order of
+   * the cells in the triangulation, the Hilbert curve has no jumps
+   * between distant parts of the domain, so the pieces are more compact
+   * and have fewer faces shared with other processes.
+   *
+   * The curve is constructed in a bounding box of all cells with equal
+   * extent in all coordinate directions, so that distances along the
+   * curve reflect physical distances also for strongly elongated domains.
+   * The split points along the curve are determined by a parallel
+   * bisection, which requires a number of collective reductions
+   * proportional to the number of bits of the curve index, but no global
+   * sort of the cells.
+   */
+  template <int dim, int spacedim = dim>
+  class HilbertCurvePolicy : public Base<dim, spacedim>
+  {
+  public:
+    /**
+     * Constructor taking an optional function that gives a weight to each
+     * cell. If no function is given, all cells have the same weight.
+     */
+    HilbertCurvePolicy(
+      const std::function<unsigned int(
+        const typename Triangulation<dim, spacedim>::cell_iterator &,
+        const CellStatus)> &weighting_function = {});
+
+    virtual LinearAlgebra::distributed::Vector<double>
+    partition(const Triangulation<dim, spacedim> &tria_in) const override;
+
+  private:
+    /**
+     * A function that gives a weight to each cell.
+     */
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)>
+      weighting_function;
+  };
+
 } // namespace RepartitioningPolicyTools
 
 DEAL_II_NAMESPACE_CLOSE
@@ -433,6 +433,32 @@ namespace parallel
         const typename dealii::internal::p4est::types<dim>::gloidx
           *previous_global_first_quadrant);
 
+      /**
+       * Start the non-blocking part of execute_transfer(), i.e., the
+       * transfer of the fixed size data and of the sizes of the variable
+       * size data. Since the transfer only depends on the forest, but not on
+       * the deal.II triangulation, the latter can be rebuilt while the data
+       * is in flight. The transfer has to be completed by end_transfer()
+       * with the same arguments, which need to stay valid until then.
+       */
+      void
+      begin_transfer(
+        const typename dealii::internal::p4est::types<dim>::forest
+          *parallel_forest,
+        const typename dealii::internal::p4est::types<dim>::gloidx
+          *previous_global_first_quadrant);
+
+      /**
+       * Finish the transfer started by begin_transfer() and transfer the
+       * variable size data.
+       */
+      void
+      end_transfer(
+        const typename dealii::internal::p4est::types<dim>::forest
+          *parallel_forest,
+        const typename dealii::internal::p4est::types<dim>::gloidx
+          *previous_global_first_quadrant);
+
       /**
        * Implementation of the same function as in the base class.
        *
@@ -529,6 +555,8 @@ namespace parallel
        * The usage of the `weight` signal is identical in both cases, if a
        * function is connected to the signal it will be used to balance the
        * calculated weights, otherwise the number of cells is balanced.
+       * Alternatively, set_repartitioning_threshold() lets this function
+       * repartition the mesh only if the load has become too unbalanced.
        */
       virtual void
       execute_coarsening_and_refinement() override;
@@ -591,6 +619,51 @@ namespace parallel
       void
       repartition();
 
+      /**
+       * Make execute_coarsening_and_refinement() repartition the mesh only if
+       * the load imbalance between the processes exceeds
+       * @p imbalance_threshold. The load imbalance is measured as the ratio
+       * of the maximal to the average load of the processes, where the load
+       * of a process is the sum of the weights of its cells after refinement
+       * and coarsening (see the `weight` signal), or the number of its cells
+       * if no function is connected to that signal. If a measured work has
+       * been provided with set_measured_work(), the load of each process is
+       * additionally scaled by the measured work per cell, so that processes
+       * that turned out to be slower than expected for their number of cells
+       * are considered more loaded.
+       *
+       * Skipping the repartitioning avoids both the cost of the partitioning
+       * in p4est and the cost of moving cells and the data attached to them
+       * between the processes, which usually outweighs the small gain in
+       * efficiency of a perfectly balanced mesh.
+       *
+       * A threshold of zero, which is the default, restores the behavior of
+       * always repartitioning the mesh. A threshold of 1.1, for example,
+       * tolerates that the most loaded process does 10% more work than the
+       * average one. The setting has no effect if the triangulation was
+       * created with the @p no_automatic_repartitioning flag, and it does
+       * not affect explicit calls of repartition().
+       *
+       * This function has to be called on all processes with the same value.
+       */
+      void
+      set_repartitioning_threshold(const double imbalance_threshold);
+
+      /**
+       * Provide the work, e.g., the wall time of assembly and solve, that
+       * the calling process spent on its locally owned cells since the last
+       * change of the mesh. This information is used to estimate the load
+       * imbalance for the decision whether to repartition the mesh, see
+       * set_repartitioning_threshold(). The value is normalized by the number
+       * of locally owned active cells at the time of the call and is used
+       * until this function is called again. A negative value discards a
+       * previously provided measurement.
+       *
+       * If this function is called, it has to be called on all processes.
+       */
+      void
+      set_measured_work(const double local_work);
+
       /**
        * Return the local memory consumption in bytes.
        */
@@ -759,6 +832,27 @@ namespace parallel
        */
       typename dealii::internal::p4est::types<dim>::ghost *parallel_ghost;
 
+      /**
+       * The load imbalance below which execute_coarsening_and_refinement()
+       * does not repartition the mesh, see set_repartitioning_threshold().
+       */
+      double repartitioning_threshold;
+
+      /**
+       * The work per locally owned active cell provided with
+       * set_measured_work(), or a negative value if none was provided.
+       */
+      double measured_work_per_cell;
+
+      /**
+       * The contexts of the non-blocking transfers of fixed size data and of
+       * the sizes of the variable size data started by begin_transfer().
+       */
+      typename dealii::internal::p4est::types<dim>::transfer_context
+        *transfer_context_fixed;
+      typename dealii::internal::p4est::types<dim>::transfer_context
+        *transfer_context_sizes;
+
       /**
        * Go through all p4est trees and record the relations between locally
        * owned p4est quadrants and active deal.II cells in the private member
@@ -847,6 +941,19 @@ namespace parallel
       std::vector<unsigned int>
       get_cell_weights() const;
 
+      /**
+       * Return whether the load imbalance of the refined or coarsened but not
+       * yet repartitioned forest exceeds the threshold set with
+       * set_repartitioning_threshold(). The argument @p cell_weights holds
+       * the weights returned by get_cell_weights(), or is empty if no
+       * function is connected to the `weight` signal.
+       *
+       * This is a collective operation.
+       */
+      bool
+      is_repartitioning_needed(
+        const std::vector<unsigned int> &cell_weights) const;
+
       /**
        * This method returns a bit vector of length tria.n_vertices()
        * indicating the locally active vertices on a level, i.e., the vertices
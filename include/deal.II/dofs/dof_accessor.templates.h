@@ -1301,6 +1301,41 @@ namespace internal
 
 
 
+      /**
+       * Copy the DoF indices of an active cell from the cache set up by
+       * DoFHandler::set_cell_dof_indices_caching(). Return false without
+       * touching @p dof_indices if there is no cache or if the cached
+       * range does not match the size of the output array.
+       */
+      template <int dim,
+                int spacedim,
+                bool level_dof_access,
+                typename DoFIndicesType>
+      static bool
+      get_cached_cell_dof_indices(
+        const dealii::DoFCellAccessor<dim, spacedim, level_dof_access>
+                       &accessor,
+        DoFIndicesType &dof_indices)
+      {
+        const auto &dof_handler = accessor.get_dof_handler();
+        if (dof_handler.cell_dof_cache_ptr.empty())
+          return false;
+
+        const unsigned int index = accessor.active_cell_index();
+        AssertIndexRange(index + 1, dof_handler.cell_dof_cache_ptr.size());
+        const auto begin = dof_handler.cell_dof_cache_ptr[index];
+        const auto end   = dof_handler.cell_dof_cache_ptr[index + 1];
+        if (end - begin != dof_indices.size())
+          return false;
+
+        std::copy(dof_handler.cell_dof_cache_indices.data() + begin,
+                  dof_handler.cell_dof_cache_indices.data() + end,
+                  dof_indices.begin());
+        return true;
+      }
+
+
+
       template <int dim, int spacedim, bool level_dof_access, int structdim>
       static void
       set_dof_indices(
@@ -775,6 +775,27 @@ public:
   void
   clear();
 
+  /**
+   * Enable or disable a cache of the DoF indices of all active cells.
+   *
+   * If enabled, the DoF indices of every active cell are stored in one
+   * contiguous array, indexed by the active cell index, whenever
+   * distribute_dofs() or renumber_dofs() has run. DoFCellAccessor::
+   * get_dof_indices() and the functions that read or write vector entries
+   * on cells then copy the indices from this array instead of collecting
+   * them from the vertices, lines, quads, and hexes of the cell, which is
+   * considerably cheaper for elements with degrees of freedom on several
+   * kinds of objects and in hp-mode. The cache costs one index per degree of
+   * freedom on each cell and is discarded whenever the underlying
+   * triangulation changes; it is rebuilt the next time degrees of freedom
+   * are distributed.
+   *
+   * If degrees of freedom have already been distributed when the cache is
+   * enabled, it is filled right away. By default, the cache is disabled.
+   */
+  void
+  set_cell_dof_indices_caching(const bool enable);
+
   /**
    * Renumber degrees of freedom based on a list of new DoF indices for each
    * of the degrees of freedom.
@@ -1557,6 +1578,25 @@ private:
   mutable std::vector<std::array<std::vector<offset_type>, dim + 1>>
     object_dof_ptr;
 
+  /**
+   * Whether the DoF indices of the active cells are to be cached in
+   * cell_dof_cache_indices, see set_cell_dof_indices_caching().
+   */
+  bool cell_dof_cache_enabled;
+
+  /**
+   * DoF indices of all active cells, stored contiguously in the order of
+   * the active cell index. The range belonging to a cell is identified via
+   * cell_dof_cache_ptr (CRS scheme). Artificial cells have empty ranges.
+   * Both vectors are empty if the cache is disabled or not up to date.
+   */
+  std::vector<types::global_dof_index> cell_dof_cache_indices;
+
+  /**
+   * Pointer to the first cached DoF index of each active cell.
+   */
+  std::vector<offset_type> cell_dof_cache_ptr;
+
   /**
    * Active FE indices of each geometric object. Identification
    * of the appropriate position of a cell in the vectors is done via
@@ -1632,6 +1672,14 @@ private:
   void
   clear_mg_space();
 
+  /**
+   * Fill cell_dof_cache_indices and cell_dof_cache_ptr from the DoF indices
+   * currently stored on the geometric objects, or clear them if the cache is
+   * disabled.
+   */
+  void
+  update_cell_dof_indices_cache();
+
   /**
    * Set up DoFHandler policy.
    */
@@ -2125,6 +2173,8 @@ void DoFHandler<dim, spacedim>::load(Archive &ar, const unsigned int)
                     "DoFHandler previously stored (" +
                     policy_name + ")."));
     }
+
+  this->update_cell_dof_indices_cache();
 }
 
 
@@ -1312,7 +1312,8 @@ namespace DoFRenumbering
    *
    * @note This functions can compute a new order both on the active cells and
    * the level cells, using information in the MatrixFree::get_mg_level()
-   * function.
+   * function. The effect of the renumbering can be quantified with
+   * compute_matrix_free_index_spread().
    */
   template <int dim,
             int spacedim,
@@ -1367,6 +1368,28 @@ namespace DoFRenumbering
     const AffineConstraints<Number> &constraints,
     const AdditionalDataType        &matrix_free_additional_data);
 
+  /**
+   * Compute the average spread of the vector indices accessed by the cell
+   * batches of @p matrix_free for the given @p dof_handler, i.e., the
+   * difference between the largest and the smallest locally owned index of a
+   * cell batch plus one, averaged over all cell batches. Ghost indices are
+   * not taken into account. Small values indicate that the vector entries of
+   * a cell batch are close in memory, so this number allows to assess the
+   * effect of matrix_free_data_locality() or other renumberings on the data
+   * locality of matrix-free loops by comparing the values computed before
+   * and after renumbering (with the MatrixFree object set up again in
+   * between). If the MatrixFree object was set up on a multigrid level, the
+   * level indices are evaluated.
+   */
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  double
+  compute_matrix_free_index_spread(
+    const DoFHandler<dim, spacedim>                    &dof_handler,
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free);
+
   /**
    * @}
    */
@@ -40,6 +40,7 @@ DEAL_II_NAMESPACE_OPEN
 // Forward declarations
 #ifndef DOXYGEN
 class BlockMask;
+class ChunkSparsityPattern;
 template <int dim, typename RangeNumberType>
 class Function;
 template <int dim, int spacedim>
@@ -427,6 +428,30 @@ namespace DoFTools
     const bool                       keep_constrained_dofs = true,
     const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id);
 
+  /**
+   * Like the previous function, but fill a ChunkSparsityPattern. The entries
+   * are first collected in a DynamicSparsityPattern, which is then copied
+   * into @p sparsity_pattern with the chunk size returned by
+   * compute_node_block_size(). For elements of the form FESystem(fe, n), as
+   * used for example in elasticity, the chunks then coincide with the
+   * couplings between the @p n components of two nodes, and a
+   * ChunkSparseMatrix built on the pattern stores and multiplies these blocks
+   * as small dense matrices. For other elements or numberings, the chunk size
+   * is one.
+   *
+   * The previous content of @p sparsity_pattern is discarded.
+   *
+   * @ingroup constraints
+   */
+  template <int dim, int spacedim, typename number = double>
+  void
+  make_sparsity_pattern(
+    const DoFHandler<dim, spacedim> &dof_handler,
+    ChunkSparsityPattern            &sparsity_pattern,
+    const AffineConstraints<number> &constraints           = {},
+    const bool                       keep_constrained_dofs = true,
+    const types::subdomain_id subdomain_id = numbers::invalid_subdomain_id);
+
   /**
    * Compute which entries of a matrix built on the given @p dof_handler may
    * possibly be nonzero, and create a sparsity pattern object that represents
@@ -2107,6 +2132,27 @@ namespace DoFTools
                           const std::vector<unsigned int> &target_block =
                             std::vector<unsigned int>());
 
+  /**
+   * Return the size of the groups of consecutive degrees of freedom that
+   * belong to the same node, i.e., the same support point, in the numbering
+   * of @p dof_handler. This is the natural chunk size of a
+   * ChunkSparsityPattern built on @p dof_handler.
+   *
+   * Nodes are only detected for elements of the form FESystem(fe, n), i.e.,
+   * elements composed of @p n copies of a single scalar element, as is
+   * typical for elasticity problems. The function then checks that on every
+   * locally owned cell the @p n degrees of freedom of each node are numbered
+   * consecutively in the order of the vector components, starting at a
+   * multiple of @p n. This is the case for the numbering created by
+   * DoFHandler::distribute_dofs() and by DoFRenumbering::support_point_wise(),
+   * but not, for example, after DoFRenumbering::component_wise() or a
+   * renumbering of the individual degrees of freedom. If all checks pass on
+   * all processes, @p n is returned, otherwise one.
+   */
+  template <int dim, int spacedim>
+  unsigned int
+  compute_node_block_size(const DoFHandler<dim, spacedim> &dof_handler);
+
   /**
    * For each active cell of a DoFHandler, extract the active finite element
    * index and fill the vector given as second argument. This vector is assumed
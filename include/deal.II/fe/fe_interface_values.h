@@ -26,6 +26,10 @@
 #include <deal.II/hp/fe_values.h>
 #include <deal.II/hp/q_collection.h>
 
+#include <algorithm>
+#include <array>
+#include <tuple>
+
 DEAL_II_NAMESPACE_OPEN
 
 #ifndef DOXYGEN
@@ -2068,6 +2072,16 @@ private:
    */
   std::vector<std::array<unsigned int, 2>> dofmap;
 
+  /**
+   * Scratch arrays for the DoF indices of the two cells and their sorted
+   * union, used in reinit() to compute interface_dof_indices and dofmap.
+   * They are kept between calls to avoid memory allocation for every face.
+   */
+  std::vector<types::global_dof_index> cell_dof_indices;
+  std::vector<types::global_dof_index> neighbor_dof_indices;
+  std::vector<std::pair<types::global_dof_index, unsigned int>>
+    sorted_dof_indices;
+
   /**
    * Pointer to internal_fe_face_values or internal_fe_subface_values,
    * respectively as determined in reinit().
@@ -2141,6 +2155,27 @@ private:
   std::unique_ptr<hp::FESubfaceValues<dim, spacedim>>
     internal_hp_fe_subface_values_neighbor;
 
+  /**
+   * Whether the internal FEFaceValues and FESubfaceValues objects of the two
+   * sides are set up in the same way, so that their roles can be exchanged.
+   */
+  const bool sides_are_interchangeable;
+
+  /**
+   * The triangulation, level, index, face number, and subface number of the
+   * two sides of the interface given to the previous call to reinit(). They
+   * are used to detect when the same interface is visited again from the
+   * other side, in which case the internal objects of the two sides are
+   * exchanged so that they do not need to recompute their data.
+   */
+  std::array<std::tuple<const Triangulation<dim, spacedim> *,
+                        int,
+                        int,
+                        unsigned int,
+                        unsigned int>,
+             2>
+    present_sides;
+
   /**
    * Exception used when a certain feature doesn't make sense when
    * FEInterfaceValues does has hp-capabilities enabled.
@@ -2208,6 +2243,7 @@ FEInterfaceValues<dim, spacedim>::FEInterfaceValues(
                                                        fe,
                                                        quadrature,
                                                        update_flags))
+  , sides_are_interchangeable(true)
 {}
 
 
@@ -2255,6 +2291,7 @@ FEInterfaceValues<dim, spacedim>::FEInterfaceValues(
                                                        fe,
                                                        quadrature[0],
                                                        update_flags))
+  , sides_are_interchangeable(quadrature.size() == 1)
 {}
 
 
@@ -2290,6 +2327,7 @@ FEInterfaceValues<dim, spacedim>::FEInterfaceValues(
         fe_collection,
         quadrature_collection,
         update_flags))
+  , sides_are_interchangeable(false)
 {
   AssertDimension(dim, spacedim);
 }
@@ -2341,6 +2379,33 @@ FEInterfaceValues<dim, spacedim>::reinit(
 
   if (internal_fe_face_values)
     {
+      // If this is the interface of the previous call seen from the other
+      // side, exchange the internal objects of the two sides. They are then
+      // reinitialized on the faces they already hold, for which
+      // FEFaceValues::reinit() does not recompute the data.
+      if (sides_are_interchangeable)
+        {
+          const decltype(present_sides) sides = {
+            {{&cell->get_triangulation(),
+              cell->level(),
+              cell->index(),
+              face_no,
+              sub_face_no},
+             {&cell_neighbor->get_triangulation(),
+              cell_neighbor->level(),
+              cell_neighbor->index(),
+              face_no_neighbor,
+              sub_face_no_neighbor}}};
+          if (sides[0] == present_sides[1] && sides[1] == present_sides[0])
+            {
+              std::swap(internal_fe_face_values,
+                        internal_fe_face_values_neighbor);
+              std::swap(internal_fe_subface_values,
+                        internal_fe_subface_values_neighbor);
+            }
+          present_sides = sides;
+        }
+
       if (sub_face_no == numbers::invalid_unsigned_int)
         {
           internal_fe_face_values->reinit(cell, face_no);
@@ -2511,43 +2576,42 @@ FEInterfaceValues<dim, spacedim>::reinit(
   if constexpr (is_dof_cell_accessor_neighbor && is_dof_cell_accessor)
     {
       // Get dof indices first:
-      std::vector<types::global_dof_index> v(
-        fe_face_values->get_fe().n_dofs_per_cell());
-      cell->get_active_or_mg_dof_indices(v);
-      std::vector<types::global_dof_index> v2(
+      cell_dof_indices.resize(fe_face_values->get_fe().n_dofs_per_cell());
+      cell->get_active_or_mg_dof_indices(cell_dof_indices);
+      neighbor_dof_indices.resize(
         fe_face_values_neighbor->get_fe().n_dofs_per_cell());
-      cell_neighbor->get_active_or_mg_dof_indices(v2);
-
-      // Fill a map from the global dof index to the left and right
-      // local index.
-      std::map<types::global_dof_index, std::pair<unsigned int, unsigned int>>
-                                            tempmap;
-      std::pair<unsigned int, unsigned int> invalid_entry(
-        numbers::invalid_unsigned_int, numbers::invalid_unsigned_int);
-
-      for (unsigned int i = 0; i < v.size(); ++i)
+      cell_neighbor->get_active_or_mg_dof_indices(neighbor_dof_indices);
+
+      // Sort the global dof indices of both cells together with their local
+      // index, where the local indices of the neighbor are shifted by the
+      // number of dofs on the cell.
+      const unsigned int n_cell_dofs = cell_dof_indices.size();
+      sorted_dof_indices.clear();
+      for (unsigned int i = 0; i < n_cell_dofs; ++i)
+        sorted_dof_indices.emplace_back(cell_dof_indices[i], i);
+      for (unsigned int i = 0; i < neighbor_dof_indices.size(); ++i)
+        sorted_dof_indices.emplace_back(neighbor_dof_indices[i],
+                                        n_cell_dofs + i);
+      std::sort(sorted_dof_indices.begin(), sorted_dof_indices.end());
+
+      // Transfer to the std::vectors, merging the entries with the same
+      // global index into one interface dof with the left and right local
+      // index.
+      interface_dof_indices.clear();
+      dofmap.clear();
+      for (const auto &[dof_index, local_index] : sorted_dof_indices)
         {
-          // If not already existing, add an invalid entry:
-          auto result = tempmap.insert(std::make_pair(v[i], invalid_entry));
-          result.first->second.first = i;
-        }
-
-      for (unsigned int i = 0; i < v2.size(); ++i)
-        {
-          // If not already existing, add an invalid entry:
-          auto result = tempmap.insert(std::make_pair(v2[i], invalid_entry));
-          result.first->second.second = i;
-        }
-
-      // Transfer from the map to the sorted std::vectors.
-      dofmap.resize(tempmap.size());
-      interface_dof_indices.resize(tempmap.size());
-      unsigned int idx = 0;
-      for (auto &x : tempmap)
-        {
-          interface_dof_indices[idx] = x.first;
-          dofmap[idx]                = {{x.second.first, x.second.second}};
-          ++idx;
+          if (interface_dof_indices.empty() ||
+              interface_dof_indices.back() != dof_index)
+            {
+              interface_dof_indices.push_back(dof_index);
+              dofmap.push_back({{numbers::invalid_unsigned_int,
+                                 numbers::invalid_unsigned_int}});
+            }
+          if (local_index < n_cell_dofs)
+            dofmap.back()[0] = local_index;
+          else
+            dofmap.back()[1] = local_index - n_cell_dofs;
         }
     }
 }
@@ -24,6 +24,8 @@
 #include <deal.II/base/table.h>
 #include <deal.II/base/table_indices.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/thread_local_storage.h>
+#include <deal.II/base/utilities.h>
 
 #include <deal.II/hp/fe_collection.h>
 #include <deal.II/hp/q_collection.h>
@@ -33,6 +35,8 @@
 
 #include <deal.II/numerics/vector_tools_common.h>
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -118,6 +122,12 @@ namespace FESeries
      * Calculate @p fourier_coefficients of the cell vector field given by
      * @p local_dof_values corresponding to FiniteElement with
      * @p cell_active_fe_index .
+     *
+     * For finite elements whose shape functions are tensor products of
+     * one-dimensional polynomials, such as FE_Q and FE_DGQ, together with a
+     * tensor-product quadrature formula, the expansion is computed by sum
+     * factorization with one-dimensional transformation matrices. This
+     * function may be called concurrently from several threads.
      */
     template <typename Number>
     void
@@ -140,7 +150,9 @@ namespace FESeries
      * stored for recurring purposes. Usually, this operation consumes a lot of
      * workload. With this function, all matrices will be calculated in advance.
      * This way, we can separate their costly generation from the actual
-     * application.
+     * application. For elements with a tensor-product structure, only the
+     * one-dimensional factors of the transformation are set up, which is
+     * cheap.
      */
     void
     precalculate_all_transformation_matrices();
@@ -152,7 +164,8 @@ namespace FESeries
      * Since any of its transformation matrices has to be generated only once
      * for a given scenario, it is common practice to determine them in advance
      * calling precalculate_all_transformation_matrices() and keep them via
-     * serialization.
+     * serialization. The one-dimensional factors used for elements with a
+     * tensor-product structure are not stored, but recomputed on demand.
      */
     template <class Archive>
     void
@@ -200,9 +213,33 @@ namespace FESeries
     std::vector<FullMatrix<CoefficientType>> fourier_transform_matrices;
 
     /**
-     * Auxiliary vector to store unrolled coefficients.
+     * For each FiniteElement with a tensor-product structure, the
+     * one-dimensional transformation matrices in each coordinate direction,
+     * whose Kronecker product is the transformation matrix. Empty for all
+     * other elements, which use fourier_transform_matrices instead.
+     */
+    std::vector<std::vector<FullMatrix<CoefficientType>>>
+      fourier_transform_matrices_1d;
+
+    /**
+     * For each FiniteElement in fourier_transform_matrices_1d, the position
+     * of each degree of freedom in the tensor-product ordering used by the sum
+     * factorization.
      */
-    std::vector<CoefficientType> unrolled_coefficients;
+    std::vector<std::vector<unsigned int>> tensor_product_dof_positions;
+
+    /**
+     * Auxiliary vector to store unrolled coefficients, one per thread.
+     */
+    Threads::ThreadLocalStorage<std::vector<CoefficientType>>
+      unrolled_coefficients;
+
+    /**
+     * Auxiliary vector for the intermediate results of the sum factorization,
+     * one per thread.
+     */
+    Threads::ThreadLocalStorage<std::vector<CoefficientType>>
+      tensor_product_scratch;
 
     /**
      * Which component of FiniteElement should be used to calculate the
@@ -288,6 +325,12 @@ namespace FESeries
      * Calculate @p legendre_coefficients of the cell vector field given by
      * @p local_dof_values corresponding to FiniteElement with
      * @p cell_active_fe_index .
+     *
+     * For finite elements whose shape functions are tensor products of
+     * one-dimensional polynomials, such as FE_Q and FE_DGQ, together with a
+     * tensor-product quadrature formula, the expansion is computed by sum
+     * factorization with one-dimensional transformation matrices. This
+     * function may be called concurrently from several threads.
      */
     template <typename Number>
     void
@@ -310,7 +353,9 @@ namespace FESeries
      * stored for recurring purposes. Usually, this operation consumes a lot of
      * workload. With this function, all matrices will be calculated in advance.
      * This way, we can separate their costly generation from the actual
-     * application.
+     * application. For elements with a tensor-product structure, only the
+     * one-dimensional factors of the transformation are set up, which is
+     * cheap.
      */
     void
     precalculate_all_transformation_matrices();
@@ -322,7 +367,8 @@ namespace FESeries
      * Since any of its transformation matrices has to be generated only once
      * for a given scenario, it is common practice to determine them in advance
      * calling precalculate_all_transformation_matrices() and keep them via
-     * serialization.
+     * serialization. The one-dimensional factors used for elements with a
+     * tensor-product structure are not stored, but recomputed on demand.
      */
     template <class Archive>
     void
@@ -365,9 +411,33 @@ namespace FESeries
     std::vector<FullMatrix<CoefficientType>> legendre_transform_matrices;
 
     /**
-     * Auxiliary vector to store unrolled coefficients.
+     * For each FiniteElement with a tensor-product structure, the
+     * one-dimensional transformation matrices in each coordinate direction,
+     * whose Kronecker product is the transformation matrix. Empty for all
+     * other elements, which use legendre_transform_matrices instead.
      */
-    std::vector<CoefficientType> unrolled_coefficients;
+    std::vector<std::vector<FullMatrix<CoefficientType>>>
+      legendre_transform_matrices_1d;
+
+    /**
+     * For each FiniteElement in legendre_transform_matrices_1d, the position
+     * of each degree of freedom in the tensor-product ordering used by the sum
+     * factorization.
+     */
+    std::vector<std::vector<unsigned int>> tensor_product_dof_positions;
+
+    /**
+     * Auxiliary vector to store unrolled coefficients, one per thread.
+     */
+    Threads::ThreadLocalStorage<std::vector<CoefficientType>>
+      unrolled_coefficients;
+
+    /**
+     * Auxiliary vector for the intermediate results of the sum factorization,
+     * one per thread.
+     */
+    Threads::ThreadLocalStorage<std::vector<CoefficientType>>
+      tensor_product_scratch;
 
     /**
      * Which component of FiniteElement should be used to calculate the
@@ -521,6 +591,113 @@ namespace internal
                     "complex-valued coefficients and VectorTools::mean norm."));
       return std::abs(value);
     }
+
+
+
+    /**
+     * Compute the matrix that maps the degrees of freedom of @p fe to the
+     * coefficients of the expansion of its component @p component into the
+     * tensor-product basis whose one-dimensional factors are given by
+     * @p basis_function, scaled such that integration with @p quadrature
+     * yields the coefficients. The rows are numbered in the order of
+     * Table::fill().
+     */
+    template <int dim, int spacedim, typename CoefficientType>
+    void
+    compute_transformation_matrix(
+      const FiniteElement<dim, spacedim> &fe,
+      const Quadrature<dim>              &quadrature,
+      const unsigned int                  component,
+      const unsigned int                  n_coefficients_per_direction,
+      const std::function<CoefficientType(const unsigned int, const double)>
+                                  &basis_function,
+      FullMatrix<CoefficientType> &transformation_matrix);
+
+
+
+    /**
+     * If @p fe is a scalar element whose shape functions are tensor products
+     * of one-dimensional polynomials and @p quadrature is a tensor-product
+     * formula, the matrix computed by compute_transformation_matrix() is the
+     * Kronecker product of one-dimensional matrices. In that case, compute
+     * these matrices for each coordinate direction into @p matrices_1d along
+     * with the position of each degree of freedom in the ordering used by
+     * apply_tensor_product_transformation(), and return true. Otherwise,
+     * return false and leave the output arguments untouched.
+     */
+    template <int dim, int spacedim, typename CoefficientType>
+    bool
+    compute_tensor_product_transformation(
+      const FiniteElement<dim, spacedim> &fe,
+      const Quadrature<dim>              &quadrature,
+      const unsigned int                  n_coefficients_per_direction,
+      const std::function<CoefficientType(const unsigned int, const double)>
+                                               &basis_function,
+      std::vector<FullMatrix<CoefficientType>> &matrices_1d,
+      std::vector<unsigned int>                &dof_positions);
+
+
+
+    /**
+     * Apply the transformation set up by
+     * compute_tensor_product_transformation() to @p local_dof_values by sum
+     * factorization, one coordinate direction at a time, and write the
+     * coefficients to @p coefficients in the order of Table::fill().
+     */
+    template <typename Number, typename CoefficientType>
+    void
+    apply_tensor_product_transformation(
+      const std::vector<FullMatrix<CoefficientType>> &matrices_1d,
+      const std::vector<unsigned int>                &dof_positions,
+      const Vector<Number>                           &local_dof_values,
+      std::vector<CoefficientType>                   &scratch,
+      std::vector<CoefficientType>                   &coefficients)
+    {
+      const unsigned int dim               = matrices_1d.size();
+      const unsigned int n_coefficients_1d = matrices_1d[0].m();
+      const unsigned int n_dofs_1d         = matrices_1d[0].n();
+      AssertDimension(local_dof_values.size(), dof_positions.size());
+
+      // The intermediate results consist of the transformed directions with
+      // n_coefficients_1d and the remaining ones with n_dofs_1d entries. We
+      // alternate between the two arrays such that the last step writes into
+      // the output array.
+      const unsigned int max_size =
+        Utilities::pow(std::max(n_coefficients_1d, n_dofs_1d), dim);
+      scratch.resize(max_size);
+      coefficients.resize(max_size);
+      CoefficientType *in =
+        (dim % 2 == 1) ? scratch.data() : coefficients.data();
+      CoefficientType *out =
+        (dim % 2 == 1) ? coefficients.data() : scratch.data();
+
+      for (unsigned int i = 0; i < dof_positions.size(); ++i)
+        in[dof_positions[i]] = CoefficientType(local_dof_values[i]);
+
+      // Each step contracts the fastest running index, which belongs to
+      // direction d, and appends the new index as the slowest running one.
+      // Starting with the last direction running fastest, the coefficients
+      // thus end up with the first direction running slowest.
+      unsigned int n_other = Utilities::pow(n_dofs_1d, dim - 1);
+      for (unsigned int d = dim; d-- > 0;)
+        {
+          const FullMatrix<CoefficientType> &matrix = matrices_1d[d];
+          for (unsigned int k = 0; k < n_coefficients_1d; ++k)
+            for (unsigned int r = 0; r < n_other; ++r)
+              {
+                const CoefficientType *in_r = in + r * n_dofs_1d;
+                CoefficientType        sum  = 0.;
+                for (unsigned int a = 0; a < n_dofs_1d; ++a)
+                  sum += matrix(k, a) * in_r[a];
+                out[r + n_other * k] = sum;
+              }
+          if (d > 0)
+            n_other = n_other / n_dofs_1d * n_coefficients_1d;
+          std::swap(in, out);
+        }
+
+      coefficients.resize(Utilities::pow(n_coefficients_1d, dim));
+    }
   } // namespace FESeriesImplementation
 } // namespace internal
 
@@ -141,6 +141,35 @@ public:
   const Quadrature<dim> &
   get_quadrature() const;
 
+  /**
+   * Let the functions get_function_values() and get_function_gradients()
+   * for scalar finite element functions use sum factorization, i.e., the
+   * tensor product structure of the shape functions and of the quadrature
+   * formula, instead of a sum over the tabulated values of all shape
+   * functions in each quadrature point. For elements of degree $p$, this
+   * reduces the cost of these functions per cell from
+   * $\mathcal O(p^{2d})$ to $\mathcal O(d^2 p^{d+1})$ operations, which
+   * pays off for degrees of about three and higher. The gradients are
+   * computed on the unit cell and transformed with the mapping afterwards.
+   *
+   * The evaluation with sum factorization is only possible if the finite
+   * element is scalar and the tensor product of the same one-dimensional
+   * polynomials in each direction, as for example FE_Q or FE_DGQ, and if
+   * the quadrature formula is the tensor product of the same
+   * one-dimensional formula in each direction, as for example QGauss. If
+   * this is not the case, or if @p enable is false, the default evaluation
+   * is used. The results of the two evaluations are the same up to
+   * round-off.
+   *
+   * The functions of the FEValuesViews classes, the functions taking
+   * vector-valued arguments, and the higher derivatives are not affected by
+   * this setting.
+   *
+   * @return Whether the evaluation with sum factorization is used.
+   */
+  bool
+  enable_tensor_product_evaluation(const bool enable = true);
+
   /**
    * Determine an estimate for the memory consumption (in bytes) of this
    * object.
@@ -464,6 +493,20 @@ private:
    */
   void
   do_reinit(const unsigned int face_no);
+
+  /**
+   * Return whether the data of this object was computed by the previous
+   * call to reinit() on face @p face_no of @p cell and is still valid, in
+   * which case reinit() need not compute it again. This is the case if the
+   * triangulation has not changed since then and the mapping does not move
+   * the vertices, i.e., the data only depends on the geometry of the cell.
+   * This situation occurs for example in FEInterfaceValues when assembling
+   * the terms of an interior face from both sides.
+   */
+  bool
+  is_present_face(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const unsigned int                                          face_no) const;
 };
 
 
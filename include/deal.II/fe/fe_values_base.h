@@ -51,6 +51,18 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declaration
+#ifndef DOXYGEN
+namespace internal
+{
+  namespace FEValuesImplementation
+  {
+    template <int dim, int spacedim>
+    class TensorProductEvaluator;
+  } // namespace FEValuesImplementation
+} // namespace internal
+#endif
+
 /**
  * FEValues, FEFaceValues and FESubfaceValues objects are interfaces to finite
  * element and mapping classes on the one hand side, to cells and quadrature
@@ -1740,6 +1752,26 @@ protected:
                                                                      spacedim>
     finite_element_output;
 
+  /**
+   * An object that evaluates finite element functions at the quadrature
+   * points with sum factorization, see
+   * FEValues::enable_tensor_product_evaluation(). A null pointer if the
+   * evaluation through the tabulated shape functions is used.
+   */
+  std::unique_ptr<const dealii::internal::FEValuesImplementation::
+                    TensorProductEvaluator<dim, spacedim>>
+    tensor_product_evaluator;
+
+  /**
+   * Set up tensor_product_evaluator for the given quadrature formula if
+   * @p enable is true and the finite element and the quadrature formula
+   * allow for an evaluation with sum factorization, and reset it otherwise.
+   * Return whether it has been set up.
+   */
+  bool
+  initialize_tensor_product_evaluator(const Quadrature<dim> &quadrature,
+                                      const bool             enable);
+
 
   /**
    * Original update flags handed to the constructor of FEValues.
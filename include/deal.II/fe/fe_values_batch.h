@@ -0,0 +1,342 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_fe_values_batch_h
+#define dealii_fe_values_batch_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe.h>
+#include <deal.II/fe/fe_update_flags.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping.h>
+
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * Finite element evaluated in the quadrature points of a batch of cells.
+ *
+ * This class holds one FEValues object per lane of @p VectorizedArrayType.
+ * After a call to reinit() with up to VectorizedArrayType::size() cells, the
+ * shape function values and gradients, as well as the JxW values, of all
+ * cells of the batch are available as tables of VectorizedArrayType, in
+ * the layout expected by BatchedFullMatrix::add_weighted_product(). This
+ * allows to compute the local matrices of several cells at once in
+ * assembly loops that otherwise follow the usual FEValues-based pattern:
+ * @code
+ * FEValuesBatch<dim> fe_batch(fe, quadrature,
+ *                             update_gradients | update_JxW_values);
+ * BatchedFullMatrix<VectorizedArray<double>> cell_matrix;
+ * for (batch of cells)
+ *   {
+ *     fe_batch.reinit(cells);
+ *     cell_matrix.reinit(fe.n_dofs_per_cell(), fe.n_dofs_per_cell());
+ *     cell_matrix.add_weighted_product(fe_batch.get_shape_gradients(),
+ *                                      fe_batch.get_JxW_values(),
+ *                                      fe_batch.get_shape_gradients(),
+ *                                      dim);
+ *     for (unsigned int v = 0; v < fe_batch.n_filled_lanes(); ++v)
+ *       {
+ *         cell_matrix.extract_lane(v, local_matrix);
+ *         cells[v]->get_dof_indices(local_dof_indices);
+ *         constraints.distribute_local_to_global(local_matrix, ...);
+ *       }
+ *   }
+ * @endcode
+ *
+ * Only primitive finite elements are supported, i.e., the shape values are
+ * scalars.
+ *
+ * @ingroup feaccess
+ */
+template <int dim,
+          typename Number              = double,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class FEValuesBatch
+{
+public:
+  static_assert(
+    std::is_same_v<Number, typename VectorizedArrayType::value_type>,
+    "Type of Number and of VectorizedArrayType do not match.");
+
+  /**
+   * Constructor. Set up one FEValues object per lane with the given
+   * arguments.
+   */
+  FEValuesBatch(const Mapping<dim>       &mapping,
+                const FiniteElement<dim> &fe,
+                const Quadrature<dim>    &quadrature,
+                const UpdateFlags         update_flags);
+
+  /**
+   * Like the function above, but taking the mapping from
+   * ReferenceCell::get_default_linear_mapping().
+   */
+  FEValuesBatch(const FiniteElement<dim> &fe,
+                const Quadrature<dim>    &quadrature,
+                const UpdateFlags         update_flags);
+
+  /**
+   * Reinitialize the data for the given cells. The number of cells must not
+   * exceed VectorizedArrayType::size(); unused lanes are filled with the data
+   * of the first cell.
+   */
+  void
+  reinit(const std::vector<typename DoFHandler<dim>::active_cell_iterator>
+           &cells);
+
+  /**
+   * Return the number of lanes filled by the last call to reinit().
+   */
+  unsigned int
+  n_filled_lanes() const;
+
+  /**
+   * Return the shape function values, indexed by the shape function and the
+   * quadrature point. Requires update_values.
+   */
+  const Table<2, VectorizedArrayType> &
+  get_shape_values() const;
+
+  /**
+   * Return the shape function gradients, indexed by the shape function and
+   * the combined index <tt>q * dim + d</tt> of quadrature point @p q and
+   * direction @p d. Requires update_gradients.
+   */
+  const Table<2, VectorizedArrayType> &
+  get_shape_gradients() const;
+
+  /**
+   * Return the JxW values in the quadrature points. Requires
+   * update_JxW_values.
+   */
+  const AlignedVector<VectorizedArrayType> &
+  get_JxW_values() const;
+
+  /**
+   * Return the FEValues object of lane @p lane, e.g. to access the
+   * quadrature points of the cell.
+   */
+  const FEValues<dim> &
+  get_fe_values(const unsigned int lane) const;
+
+private:
+  /**
+   * Allocate the tables.
+   */
+  void
+  initialize();
+
+  /**
+   * One FEValues object per lane.
+   */
+  std::vector<std::unique_ptr<FEValues<dim>>> fe_values;
+
+  /**
+   * The update flags passed to the constructor.
+   */
+  const UpdateFlags update_flags;
+
+  /**
+   * Number of cells given to the last reinit() call.
+   */
+  unsigned int n_lanes_filled;
+
+  /**
+   * Batched shape function values.
+   */
+  Table<2, VectorizedArrayType> shape_values;
+
+  /**
+   * Batched shape function gradients.
+   */
+  Table<2, VectorizedArrayType> shape_gradients;
+
+  /**
+   * Batched JxW values.
+   */
+  AlignedVector<VectorizedArrayType> JxW_values;
+};
+
+
+
+/*---------------------------- Inline functions -----------------------------*/
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number, typename VectorizedArrayType>
+FEValuesBatch<dim, Number, VectorizedArrayType>::FEValuesBatch(
+  const Mapping<dim>       &mapping,
+  const FiniteElement<dim> &fe,
+  const Quadrature<dim>    &quadrature,
+  const UpdateFlags         update_flags)
+  : update_flags(update_flags)
+  , n_lanes_filled(0)
+{
+  for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+    fe_values.emplace_back(
+      std::make_unique<FEValues<dim>>(mapping, fe, quadrature, update_flags));
+  initialize();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+FEValuesBatch<dim, Number, VectorizedArrayType>::FEValuesBatch(
+  const FiniteElement<dim> &fe,
+  const Quadrature<dim>    &quadrature,
+  const UpdateFlags         update_flags)
+  : update_flags(update_flags)
+  , n_lanes_filled(0)
+{
+  for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+    fe_values.emplace_back(
+      std::make_unique<FEValues<dim>>(fe, quadrature, update_flags));
+  initialize();
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+FEValuesBatch<dim, Number, VectorizedArrayType>::initialize()
+{
+  const FiniteElement<dim> &fe = fe_values[0]->get_fe();
+  Assert(fe.is_primitive(),
+         ExcMessage("FEValuesBatch only supports primitive elements."));
+
+  const unsigned int dofs_per_cell = fe.n_dofs_per_cell();
+  const unsigned int n_q_points    = fe_values[0]->n_quadrature_points;
+
+  if (update_flags & update_values)
+    shape_values.reinit(dofs_per_cell, n_q_points);
+  if (update_flags & update_gradients)
+    shape_gradients.reinit(dofs_per_cell, n_q_points * dim);
+  if (update_flags & update_JxW_values)
+    JxW_values.resize(n_q_points);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+FEValuesBatch<dim, Number, VectorizedArrayType>::reinit(
+  const std::vector<typename DoFHandler<dim>::active_cell_iterator> &cells)
+{
+  Assert(cells.size() > 0, ExcMessage("At least one cell must be given."));
+  AssertIndexRange(cells.size(), VectorizedArrayType::size() + 1);
+
+  n_lanes_filled = cells.size();
+  for (unsigned int v = 0; v < n_lanes_filled; ++v)
+    fe_values[v]->reinit(cells[v]);
+
+  const unsigned int dofs_per_cell = fe_values[0]->dofs_per_cell;
+  const unsigned int n_q_points    = fe_values[0]->n_quadrature_points;
+
+  // copy the data of the filled lanes and duplicate the first cell into the
+  // remaining ones, so that the unused lanes contain valid numbers
+  for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+    {
+      const FEValues<dim> &fe_val = *fe_values[v < n_lanes_filled ? v : 0];
+
+      if (update_flags & update_values)
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            shape_values(i, q)[v] = fe_val.shape_value(i, q);
+
+      if (update_flags & update_gradients)
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              const Tensor<1, dim> &grad = fe_val.shape_grad(i, q);
+              for (unsigned int d = 0; d < dim; ++d)
+                shape_gradients(i, q * dim + d)[v] = grad[d];
+            }
+
+      if (update_flags & update_JxW_values)
+        for (unsigned int q = 0; q < n_q_points; ++q)
+          JxW_values[q][v] = fe_val.JxW(q);
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline unsigned int
+FEValuesBatch<dim, Number, VectorizedArrayType>::n_filled_lanes() const
+{
+  return n_lanes_filled;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const Table<2, VectorizedArrayType> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::get_shape_values() const
+{
+  Assert(update_flags & update_values,
+         ExcMessage("The update flags must contain update_values."));
+  return shape_values;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const Table<2, VectorizedArrayType> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::get_shape_gradients() const
+{
+  Assert(update_flags & update_gradients,
+         ExcMessage("The update flags must contain update_gradients."));
+  return shape_gradients;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const AlignedVector<VectorizedArrayType> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::get_JxW_values() const
+{
+  Assert(update_flags & update_JxW_values,
+         ExcMessage("The update flags must contain update_JxW_values."));
+  return JxW_values;
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const FEValues<dim> &
+FEValuesBatch<dim, Number, VectorizedArrayType>::get_fe_values(
+  const unsigned int lane) const
+{
+  AssertIndexRange(lane, fe_values.size());
+  return *fe_values[lane];
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
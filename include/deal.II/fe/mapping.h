@@ -456,6 +456,20 @@ public:
     const typename Triangulation<dim, spacedim>::cell_iterator &cell,
     const Point<dim>                                           &p) const = 0;
 
+  /**
+   * Map multiple points from reference locations to the real @p cell. The
+   * functionality is the same as looping over all points and calling
+   * transform_unit_to_real_cell() for each point individually, but it can be
+   * much faster for mappings that implement a more specialized version such
+   * as MappingQ, which computes the geometry of the cell only once and
+   * transforms several points at a time with vectorized arithmetic.
+   */
+  virtual void
+  transform_points_unit_to_real_cell(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const ArrayView<const Point<dim>>                          &unit_points,
+    const ArrayView<Point<spacedim>> &real_points) const;
+
   /**
    * Map the point @p p on the real @p cell to the corresponding point on the
    * unit cell, and return its coordinates. This function provides the inverse
@@ -18,11 +18,13 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/qprojector.h>
 
 #include <deal.II/fe/mapping.h>
 
 #include <cmath>
+#include <memory>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -218,6 +220,13 @@ public:
      */
     InternalData(const Quadrature<dim> &quadrature);
 
+    /**
+     * Constructor that initializes the object with a quadrature that may be
+     * shared with other objects, as returned by
+     * QProjector::project_to_all_faces_shared().
+     */
+    InternalData(const std::shared_ptr<const Quadrature<dim>> &quadrature);
+
     // Documentation see Mapping::InternalDataBase.
     virtual void
     reinit(const UpdateFlags      update_flags,
@@ -251,8 +260,17 @@ public:
      * Location of quadrature points of faces or subfaces in 3d with all
      * possible orientations. Can be accessed with the correct offset provided
      * via QProjector::DataSetDescriptor. Not needed/used for cells.
+     *
+     * The points are stored in @p face_quadrature.
+     */
+    ArrayView<const Point<dim>> quadrature_points;
+
+    /**
+     * The quadrature formula projected to all faces or subfaces whose points
+     * @p quadrature_points refer to. This object may be shared among all
+     * InternalData objects set up with the same face quadrature formula.
      */
-    std::vector<Point<dim>> quadrature_points;
+    std::shared_ptr<const Quadrature<dim>> face_quadrature;
   };
 
 private:
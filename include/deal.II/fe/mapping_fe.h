@@ -464,7 +464,28 @@ protected:
   compute_mapping_support_points(
     const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
 
+  /**
+   * Set @p points to the support points of the mapping on @p cell as
+   * computed by compute_mapping_support_points(). Unless that function is
+   * overridden by a derived class, the points are written into the memory
+   * already held by @p points, so that the repeated evaluation of the
+   * mapping by FEValues::reinit() does not allocate memory.
+   */
+  void
+  fill_mapping_support_points(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    std::vector<Point<spacedim>>                               &points) const;
+
 private:
+  /**
+   * The implementation of compute_mapping_support_points(), which writes the
+   * support points into @p mapping_support_points.
+   */
+  void
+  do_compute_mapping_support_points(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    std::vector<Point<spacedim>> &mapping_support_points) const;
+
   Table<2, double> mapping_support_point_weights;
 };
 
@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/derivative_form.h>
 #include <deal.II/base/polynomial.h>
 #include <deal.II/base/quadrature_lib.h>
@@ -167,6 +168,13 @@ public:
     const typename Triangulation<dim, spacedim>::cell_iterator &cell,
     const Point<dim> &p) const override;
 
+  // for documentation, see the Mapping base class
+  virtual void
+  transform_points_unit_to_real_cell(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    const ArrayView<const Point<dim>>                          &unit_points,
+    const ArrayView<Point<spacedim>> &real_points) const override;
+
   // for documentation, see the Mapping base class
   virtual Point<dim>
   transform_real_to_unit_cell(
@@ -324,6 +332,17 @@ public:
                     const Quadrature<dim> &quadrature,
                     const unsigned int     n_original_q_points);
 
+    /**
+     * Like the previous function, but take a quadrature formula that may be
+     * shared with other objects, as returned by
+     * QProjector::project_to_all_faces_shared(), instead of storing a copy
+     * of its points.
+     */
+    void
+    initialize_face(const UpdateFlags                             update_flags,
+                    const std::shared_ptr<const Quadrature<dim>> &quadrature,
+                    const unsigned int n_original_q_points);
+
     /**
      * Return an estimate (in bytes) for the memory consumption of this object.
      */
@@ -334,8 +353,17 @@ public:
      * Location of quadrature points of faces or subfaces in 3d with all
      * possible orientations. Can be accessed with the correct offset provided
      * via QProjector::DataSetDescriptor. Not needed/used for cells.
+     *
+     * The points are stored in @p face_quadrature.
+     */
+    ArrayView<const Point<dim>> quadrature_points;
+
+    /**
+     * The quadrature formula projected to all faces or subfaces whose points
+     * @p quadrature_points refer to. This object may be shared among all
+     * InternalData objects set up with the same face quadrature formula.
      */
-    std::vector<Point<dim>> quadrature_points;
+    std::shared_ptr<const Quadrature<dim>> face_quadrature;
 
     /**
      * Unit tangential vectors. Used for the computation of boundary forms and
@@ -628,6 +656,27 @@ protected:
   compute_mapping_support_points(
     const typename Triangulation<dim, spacedim>::cell_iterator &cell) const;
 
+  /**
+   * Set @p points to the support points of the mapping on @p cell as
+   * computed by compute_mapping_support_points(). Unless that function is
+   * overridden by a derived class, the points are written into the memory
+   * already held by @p points, so that the repeated evaluation of the
+   * mapping by FEValues::reinit() does not allocate memory.
+   */
+  void
+  fill_mapping_support_points(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    std::vector<Point<spacedim>>                               &points) const;
+
+  /**
+   * The implementation of compute_mapping_support_points(), which writes the
+   * support points into @p a.
+   */
+  void
+  do_compute_mapping_support_points(
+    const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+    std::vector<Point<spacedim>>                               &a) const;
+
   /**
    * Transform the point @p p on the real cell to the corresponding point on
    * the unit cell @p cell by a Newton iteration.
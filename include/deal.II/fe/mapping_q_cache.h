@@ -191,6 +191,36 @@ public:
              const MGLevelObject<VectorType> &vectors,
              const bool vector_describes_relative_displacement);
 
+  /**
+   * Move the cached support points of all active non-artificial cells by
+   * the displacement field given by @p dof_handler and @p displacement,
+   * in place. This is meant for arbitrary Lagrangian-Eulerian (ALE) and
+   * similar methods where the mesh moves in every time step: rather than
+   * recomputing all points with one of the initialize() functions, which
+   * evaluates the original mapping again and allocates the whole cache,
+   * only the displacement of the current step, i.e., the difference between
+   * the new and the old displacement field, is added to the points already
+   * stored.
+   *
+   * The finite element of @p dof_handler must be an FESystem with @p spacedim
+   * components of FE_Q or FE_DGQ of the same degree as this mapping, so that
+   * the displacement of the support points can be read off the vector
+   * without interpolation.
+   *
+   * Since the cache is shared between the copies of this object created
+   * with clone() or the copy constructor, the points of these copies are
+   * moved as well. After calling this function, the cells on the levels of
+   * the triangulation that are not active must not be used with this
+   * mapping any more, as their points are not updated.
+   *
+   * @note The cache must have been set up with one of the initialize()
+   * functions before, and this function runs in parallel like these.
+   */
+  template <typename VectorType>
+  void
+  add_displacement(const DoFHandler<dim, spacedim> &dof_handler,
+                   const VectorType                &displacement);
+
   /**
    * @copydoc Mapping::get_vertices()
    */
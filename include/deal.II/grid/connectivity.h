@@ -19,11 +19,18 @@
 
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/ndarray.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/grid/reference_cell.h>
 #include <deal.II/grid/tria_description.h>
 #include <deal.II/grid/tria_objects_orientations.h>
 
+#ifdef DEAL_II_WITH_TBB
+#  include <tbb/parallel_sort.h>
+#endif
+
+#include <algorithm>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -987,6 +994,23 @@ namespace internal
 
 
 
+    /**
+     * Sort the range [begin, end) with several threads if TBB is available,
+     * and with std::sort otherwise.
+     */
+    template <typename Iterator>
+    void
+    sort_in_parallel(const Iterator &begin, const Iterator &end)
+    {
+#ifdef DEAL_II_WITH_TBB
+      tbb::parallel_sort(begin, end);
+#else
+      std::sort(begin, end);
+#endif
+    }
+
+
+
     /**
      * Build entities of dimension d (with 0<d<dim). Entities are described by
      * a set of vertices.
@@ -1022,12 +1046,16 @@ namespace internal
       ptr_0 = {};
       col_0 = {};
 
-      unsigned int n_entities = 0;
+      // determine the offset of the entities of each cell
+      ptr_d.resize(cell_types_index.size() + 1);
+      ptr_d[0] = 0;
+      for (unsigned int c = 0; c < cell_types_index.size(); ++c)
+        ptr_d[c + 1] =
+          ptr_d[c] + cell_types[static_cast<types::geometric_entity_type>(
+                                  cell_types_index[c])]
+                       ->n_entities(face_dimensionality);
 
-      for (const auto &c : cell_types_index)
-        n_entities +=
-          cell_types[static_cast<types::geometric_entity_type>(c)]->n_entities(
-            face_dimensionality);
+      const unsigned int n_entities = ptr_d.back();
 
       // step 1: store each d-dimensional entity of a cell (described by their
       // vertices) into a vector and create a key for them
@@ -1036,72 +1064,77 @@ namespace internal
       // than to have two vectors (sorting becomes inefficient)
       std::vector<
         std::tuple<std::array<unsigned int, max_n_vertices>, unsigned int>>
-        keys; // key (sorted vertices), cell-entity index
-
-      std::vector<std::array<unsigned int, max_n_vertices>> ad_entity_vertices;
-      std::vector<ReferenceCell>                            ad_entity_types;
-      std::vector<std::array<unsigned int, max_n_vertices>> ad_compatibility;
+        keys(n_entities); // key (sorted vertices), cell-entity index
 
-      keys.reserve(n_entities);
-      ad_entity_vertices.reserve(n_entities);
-      ad_entity_types.reserve(n_entities);
-      ad_compatibility.reserve(n_entities);
-
-      ptr_d.resize(cell_types_index.size() + 1);
-      ptr_d[0] = 0;
+      std::vector<std::array<unsigned int, max_n_vertices>> ad_entity_vertices(
+        n_entities);
+      std::vector<ReferenceCell> ad_entity_types(n_entities);
+      std::vector<std::array<unsigned int, max_n_vertices>> ad_compatibility(
+        compatibility_mode ? n_entities : 0);
 
       static const unsigned int offset = 1;
 
-      // loop over all cells
-      for (unsigned int c = 0, counter = 0; c < cell_types_index.size(); ++c)
-        {
-          const auto &cell_type =
-            cell_types[static_cast<types::geometric_entity_type>(
-              cell_types_index[c])];
-          ptr_d[c + 1] = ptr_d[c] + cell_type->n_entities(face_dimensionality);
-
-          // ... collect vertices of cell
-          const dealii::ArrayView<const unsigned int> cell_vertice(
-            cell_vertices.data() + cell_ptr[c], cell_ptr[c + 1] - cell_ptr[c]);
-
-          // ... loop over all its entities
-          for (unsigned int e = 0;
-               e < cell_type->n_entities(face_dimensionality);
-               ++e)
+      // loop over all cells; the entities of different cells are independent
+      // of each other, so work on them in parallel
+      dealii::parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(cell_types_index.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int c = begin; c < end; ++c)
             {
-              // ... determine global entity vertices
-              const auto &local_entity_vertices =
-                cell_type->vertices_of_entity(face_dimensionality, e);
+              const auto &cell_type =
+                cell_types[static_cast<types::geometric_entity_type>(
+                  cell_types_index[c])];
+
+              // ... collect vertices of cell
+              const dealii::ArrayView<const unsigned int> cell_vertice(
+                cell_vertices.data() + cell_ptr[c],
+                cell_ptr[c + 1] - cell_ptr[c]);
+
+              // ... loop over all its entities
+              for (unsigned int e = 0;
+                   e < cell_type->n_entities(face_dimensionality);
+                   ++e)
+                {
+                  const unsigned int counter = ptr_d[c] + e;
+
+                  // ... determine global entity vertices
+                  const auto &local_entity_vertices =
+                    cell_type->vertices_of_entity(face_dimensionality, e);
 
-              std::array<unsigned int, max_n_vertices> entity_vertices;
-              std::fill(entity_vertices.begin(), entity_vertices.end(), 0);
+                  std::array<unsigned int, max_n_vertices> entity_vertices;
+                  std::fill(entity_vertices.begin(), entity_vertices.end(), 0);
 
-              for (unsigned int i = 0; i < local_entity_vertices.size(); ++i)
-                entity_vertices[i] =
-                  cell_vertice[local_entity_vertices[i]] + offset;
+                  for (unsigned int i = 0; i < local_entity_vertices.size();
+                       ++i)
+                    entity_vertices[i] =
+                      cell_vertice[local_entity_vertices[i]] + offset;
 
-              // ... create key
-              std::array<unsigned int, max_n_vertices> key = entity_vertices;
-              std::sort(key.begin(), key.end());
-              keys.emplace_back(key, counter++);
+                  // ... create key
+                  std::array<unsigned int, max_n_vertices> key =
+                    entity_vertices;
+                  std::sort(key.begin(), key.end());
+                  keys[counter] = {key, counter};
 
-              ad_entity_vertices.emplace_back(entity_vertices);
+                  ad_entity_vertices[counter] = entity_vertices;
 
-              ad_entity_types.emplace_back(
-                cell_type->type_of_entity(face_dimensionality, e));
+                  ad_entity_types[counter] =
+                    cell_type->type_of_entity(face_dimensionality, e);
 
-              if (compatibility_mode)
-                ad_compatibility.emplace_back(
-                  second_key_function(entity_vertices, cell_type, c, e));
+                  if (compatibility_mode)
+                    ad_compatibility[counter] =
+                      second_key_function(entity_vertices, cell_type, c, e);
+                }
             }
-        }
+        },
+        1000);
 
       col_d.resize(keys.size());
       orientations.reinit(keys.size());
 
       // step 2: sort according to key so that entities with same key can be
       // merged
-      std::sort(keys.begin(), keys.end());
+      sort_in_parallel(keys.begin(), keys.end());
 
 
       if (compatibility_mode)
@@ -1131,7 +1164,7 @@ namespace internal
               std::get<0>(keys[i]) = new_key;
             }
 
-          std::sort(keys.begin(), keys.end());
+          sort_in_parallel(keys.begin(), keys.end());
 
           ptr_0.reserve(n_unique_entities + 1);
           col_0.reserve(n_unique_entity_vertices);
@@ -1139,8 +1172,13 @@ namespace internal
 
 
       std::array<unsigned int, max_n_vertices> ref_key;
-      std::array<unsigned int, max_n_vertices> ref_indices;
       std::fill(ref_key.begin(), ref_key.end(), 0);
+      unsigned int ref_offset = 0;
+
+      // pairs of an entity whose key has been seen before and the entity of
+      // its first occurrence
+      std::vector<std::pair<unsigned int, unsigned int>> duplicate_entities;
+      duplicate_entities.reserve(keys.size());
 
       unsigned int counter = dealii::numbers::invalid_unsigned_int;
       for (unsigned int i = 0; i < keys.size(); i++)
@@ -1151,8 +1189,8 @@ namespace internal
             {
               // new key: default orientation is correct
               ++counter;
-              ref_key     = std::get<0>(keys[i]);
-              ref_indices = ad_entity_vertices[offset_i];
+              ref_key    = std::get<0>(keys[i]);
+              ref_offset = offset_i;
 
               ptr_0.push_back(col_0.size());
               for (const auto j : ad_entity_vertices[offset_i])
@@ -1160,23 +1198,35 @@ namespace internal
                   col_0.push_back(j - offset);
             }
           else
+            duplicate_entities.emplace_back(offset_i, ref_offset);
+          col_d[offset_i] = counter;
+        }
+      ptr_0.push_back(col_0.size());
+
+      // step 3: set the orientation of previously seen keys relative to the
+      // first occurrence, which can be done independently for each entity
+      dealii::parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(duplicate_entities.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
             {
-              // previously seen key: set orientation relative to the first
-              // occurrence
+              const auto [offset_i, offset_ref] = duplicate_entities[i];
+              const unsigned int n_vertices =
+                ad_entity_types[offset_i].n_vertices();
               orientations.set_combined_orientation(
                 offset_i,
                 ad_entity_types[offset_i]
                   .template get_combined_orientation<unsigned int>(
                     make_array_view(ad_entity_vertices[offset_i].begin(),
                                     ad_entity_vertices[offset_i].begin() +
-                                      ad_entity_types[offset_i].n_vertices()),
-                    make_array_view(ref_indices.begin(),
-                                    ref_indices.begin() +
-                                      ad_entity_types[offset_i].n_vertices())));
+                                      n_vertices),
+                    make_array_view(ad_entity_vertices[offset_ref].begin(),
+                                    ad_entity_vertices[offset_ref].begin() +
+                                      n_vertices)));
             }
-          col_d[offset_i] = counter;
-        }
-      ptr_0.push_back(col_0.size());
+        },
+        1000);
     }
 
 
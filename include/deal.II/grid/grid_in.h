@@ -516,6 +516,10 @@ public:
    * Read grid data from an msh file. The %Gmsh formats are documented at
    * http://www.gmsh.info/.
    *
+   * Besides ASCII files, this function can read binary files in the %Gmsh
+   * format version 4.1, which are considerably faster to read for large
+   * meshes. In that case, @p in needs to be opened in binary mode.
+   *
    * Also see
    * @ref simplex "Simplex support".
    */
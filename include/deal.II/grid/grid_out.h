@@ -1341,6 +1341,23 @@ public:
   void
   write_vtu(const Triangulation<dim, spacedim> &tria, std::ostream &out) const;
 
+  /**
+   * Collective MPI call to write the triangulation from all processes in
+   * @p comm to a single .vtu file @p filename on a shared file system, using
+   * MPI I/O in the same way as DataOutInterface::write_vtu_in_parallel().
+   * Each process writes the piece that holds its locally owned active cells
+   * if @p tria is a parallel triangulation, and an equally sized range of
+   * the active cells otherwise. The output contains the same cell data as
+   * write_vtu() and follows the GridOutFlags::Vtu flags, for example
+   * regarding compression, except that
+   * GridOutFlags::Vtu::serialize_triangulation is not supported.
+   */
+  template <int dim, int spacedim>
+  void
+  write_vtu_in_parallel(const Triangulation<dim, spacedim> &tria,
+                        const std::string                  &filename,
+                        const MPI_Comm                      comm) const;
+
   /**
    * Write triangulation in VTU format for each processor, and add a .pvtu file
    * for visualization in VisIt or Paraview that describes the collection of VTU
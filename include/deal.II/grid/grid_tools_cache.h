@@ -31,6 +31,10 @@
 
 #include <deal.II/numerics/rtree.h>
 
+#ifdef DEAL_II_WITH_ARBORX
+#  include <deal.II/arborx/bvh.h>
+#endif
+
 #include <boost/signals2.hpp>
 
 #include <atomic>
@@ -41,6 +45,112 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
 {
+  /**
+   * A snapshot of frequently used data of all active cells of a
+   * Triangulation, stored in contiguous arrays indexed by
+   * CellAccessor::active_cell_index() (structure-of-arrays layout).
+   *
+   * Accessing the same data through the iterators of the Triangulation
+   * involves several indirections through the per-level data structures
+   * for each cell, which results in many cache misses when iterating over
+   * large meshes. Loops that only need the data stored here can instead run
+   * over the index range of the arrays:
+   * @code
+   * const auto &cell_data = cache.get_active_cell_data();
+   * for (unsigned int c = 0; c < cell_data.n_active_cells(); ++c)
+   *   if (cell_data.material_ids[c] == 1)
+   *     for (unsigned int v = cell_data.vertex_offsets[c];
+   *          v < cell_data.vertex_offsets[c + 1];
+   *          ++v)
+   *       do_something(cell_data.vertex_indices[v]);
+   * @endcode
+   * The iterator to a cell is obtained by cell(), which does not need to
+   * walk through the hierarchy of the mesh.
+   *
+   * An object of this class is returned by Cache::get_active_cell_data(),
+   * which rebuilds it whenever the triangulation has changed, e.g. after
+   * Triangulation::execute_coarsening_and_refinement(). Data that can be
+   * changed without notification of the triangulation, such as refinement
+   * flags or user data, is not part of the snapshot.
+   */
+  template <int dim, int spacedim = dim>
+  struct ActiveCellData
+  {
+    /**
+     * Return the number of active cells in the snapshot.
+     */
+    unsigned int
+    n_active_cells() const;
+
+    /**
+     * Return an iterator to the active cell with the given index.
+     */
+    typename Triangulation<dim, spacedim>::active_cell_iterator
+    cell(const unsigned int active_cell_index) const;
+
+    /**
+     * The triangulation the data has been extracted from.
+     */
+    const Triangulation<dim, spacedim> *triangulation = nullptr;
+
+    /**
+     * The level of each cell.
+     */
+    std::vector<int> levels;
+
+    /**
+     * The index of each cell within its level.
+     */
+    std::vector<int> indices;
+
+    /**
+     * The vertex indices of all cells, stored one cell after the other. The
+     * vertices of cell @p c are found in the range
+     * <tt>[vertex_offsets[c], vertex_offsets[c+1])</tt>, which allows for
+     * meshes with different reference cells.
+     */
+    std::vector<unsigned int> vertex_indices;
+
+    /**
+     * Offsets into vertex_indices, with one entry more than the number of
+     * cells.
+     */
+    std::vector<unsigned int> vertex_offsets;
+
+    /**
+     * For each face of each cell, the active cell index of the neighbor
+     * across the face, stored one cell after the other with the ranges given
+     * by face_offsets. If the face is at the boundary or the neighbor is
+     * further refined, numbers::invalid_unsigned_int is stored. For
+     * neighbors that are coarser than the present cell, the index of the
+     * coarser cell is stored.
+     */
+    std::vector<unsigned int> neighbor_indices;
+
+    /**
+     * Offsets into neighbor_indices, with one entry more than the number of
+     * cells.
+     */
+    std::vector<unsigned int> face_offsets;
+
+    /**
+     * The material id of each cell.
+     */
+    std::vector<types::material_id> material_ids;
+
+    /**
+     * The manifold id of each cell.
+     */
+    std::vector<types::manifold_id> manifold_ids;
+
+    /**
+     * The subdomain id of each cell.
+     */
+    std::vector<types::subdomain_id> subdomain_ids;
+  };
+
+
+
   /**
    * A class that caches computationally intensive information about a
    * Triangulation.
@@ -53,14 +163,18 @@ namespace GridTools
    *
    * Notice that this class only notices if the underlying Triangulation has
    * changed due to a Triangulation::Signals::any_change() signal being
-   * triggered.
+   * triggered. If the vertices have only been moved, as signaled by
+   * Triangulation::Signals::mesh_movement (e.g., by GridTools::transform()),
+   * only the objects flagged by #update_geometry are recomputed, while
+   * the objects that depend on the connectivity of the mesh alone are kept.
    *
    * If the triangulation changes for other reasons, for example because you
    * use it in conjunction with a MappingQEulerian object that sees the
    * vertices through its own transformation, or because you manually change
    * some vertex locations, then some of the structures in this class become
    * obsolete, and you will have to mark them as outdated, by calling the
-   * method mark_for_update() manually.
+   * method mark_for_update() manually. For vertex motion, calling
+   * mark_for_update() with #update_geometry is sufficient.
    */
   template <int dim, int spacedim = dim>
   class Cache : public Subscriptor
@@ -159,6 +273,26 @@ namespace GridTools
                 typename Triangulation<dim, spacedim>::active_cell_iterator>> &
     get_locally_owned_cell_bounding_boxes_rtree() const;
 
+#ifdef DEAL_II_WITH_ARBORX
+    /**
+     * Return the cached ArborXWrappers::BVH object of the bounding boxes of
+     * the locally owned active cells, the same bounding boxes as stored in
+     * the object returned by get_locally_owned_cell_bounding_boxes_rtree(),
+     * together with the cells in the order of the primitives of the BVH,
+     * i.e., the index returned by a query identifies the cell in the second
+     * member of the pair.
+     *
+     * As opposed to the RTree, which is queried point by point, the BVH
+     * answers all queries of a set of points or bounding boxes at once in a
+     * single call to ArborX, which runs the search in parallel.
+     */
+    std::pair<
+      const ArborXWrappers::BVH &,
+      const std::vector<
+        typename Triangulation<dim, spacedim>::active_cell_iterator> &>
+    get_locally_owned_cell_bounding_boxes_bvh() const;
+#endif
+
 
     /**
      * Returns the vector of set of integer containing the subdomain id
@@ -220,6 +354,13 @@ namespace GridTools
     const RTree<std::pair<BoundingBox<spacedim>, unsigned int>> &
     get_covering_rtree(const unsigned int level = 0) const;
 
+    /**
+     * Return a snapshot of frequently used data of all active cells in
+     * contiguous arrays, see ActiveCellData.
+     */
+    const ActiveCellData<dim, spacedim> &
+    get_active_cell_data() const;
+
   private:
     /**
      * Keep track of what needs to be updated every time the triangulation
@@ -311,6 +452,20 @@ namespace GridTools
                        locally_owned_cell_bounding_boxes_rtree;
     mutable std::mutex locally_owned_cell_bounding_boxes_rtree_mutex;
 
+#ifdef DEAL_II_WITH_ARBORX
+    /**
+     * Store an ArborXWrappers::BVH object, containing the bounding boxes of
+     * the locally owned cells of the triangulation, and the cells associated
+     * with the primitives of the BVH.
+     */
+    mutable std::unique_ptr<ArborXWrappers::BVH>
+      locally_owned_cell_bounding_boxes_bvh;
+    mutable std::vector<
+      typename Triangulation<dim, spacedim>::active_cell_iterator>
+                       locally_owned_cells_in_bvh;
+    mutable std::mutex locally_owned_cell_bounding_boxes_bvh_mutex;
+#endif
+
     /**
      * Store an std::vector of std::set of integer containing the id of all
      * subdomain to which a vertex is connected to.
@@ -327,14 +482,41 @@ namespace GridTools
     mutable std::mutex vertices_with_ghost_neighbors_mutex;
 
     /**
-     * Storage for the status of the triangulation signal.
+     * Store the snapshot of the active cells.
      */
-    boost::signals2::connection tria_signal;
+    mutable ActiveCellData<dim, spacedim> active_cell_data;
+    mutable std::mutex                    active_cell_data_mutex;
+
+    /**
+     * Storage for the status of the triangulation signals.
+     */
+    std::vector<boost::signals2::connection> tria_signals;
   };
 
 
 
   // Inline functions
+  template <int dim, int spacedim>
+  inline unsigned int
+  ActiveCellData<dim, spacedim>::n_active_cells() const
+  {
+    return levels.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline typename Triangulation<dim, spacedim>::active_cell_iterator
+  ActiveCellData<dim, spacedim>::cell(
+    const unsigned int active_cell_index) const
+  {
+    AssertIndexRange(active_cell_index, levels.size());
+    return typename Triangulation<dim, spacedim>::active_cell_iterator(
+      triangulation, levels[active_cell_index], indices[active_cell_index]);
+  }
+
+
+
   template <int dim, int spacedim>
   inline const Triangulation<dim, spacedim> &
   Cache<dim, spacedim>::get_triangulation() const
@@ -89,6 +89,31 @@ namespace GridTools
      */
     update_vertex_with_ghost_neighbors = 0x200,
 
+    /**
+     * Update the contiguous snapshot of the active cells returned by
+     * Cache::get_active_cell_data().
+     */
+    update_active_cell_data = 0x400,
+
+    /**
+     * Update the ArborX bounding volume hierarchy of locally owned cell
+     * bounding boxes.
+     */
+    update_locally_owned_cell_bounding_boxes_bvh = 0x800,
+
+    /**
+     * Update all objects that depend on the location of the vertices, but
+     * not those that only depend on the connectivity of the mesh, such as
+     * the vertex_to_cell_map or the active cell data. This is what needs to
+     * be updated if the vertices of the triangulation have been moved, see
+     * Triangulation::Signals::mesh_movement.
+     */
+    update_geometry = 0x002 | update_used_vertices |
+                      update_used_vertices_rtree |
+                      update_cell_bounding_boxes_rtree | update_covering_rtree |
+                      update_locally_owned_cell_bounding_boxes_rtree |
+                      update_locally_owned_cell_bounding_boxes_bvh,
+
     /**
      * Update all objects.
      */
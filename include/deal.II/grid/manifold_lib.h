@@ -20,9 +20,13 @@
 
 #include <deal.II/base/function.h>
 #include <deal.II/base/function_parser.h>
+#include <deal.II/base/mutex.h>
 
 #include <deal.II/grid/manifold.h>
 
+#include <array>
+#include <map>
+
 DEAL_II_NAMESPACE_OPEN
 
 // forward declaration
@@ -957,6 +961,13 @@ private:
  * current implementation by a pre-identification of relevant cells with
  * axis-aligned bounding boxes.
  *
+ * During the refinement of the triangulation, the chart points of the new
+ * vertices computed by get_new_point() are remembered until the refinement is
+ * complete. Since the new vertices on lines serve as surrounding points of
+ * the new vertices on quads and hexes, and those on quads as surrounding
+ * points of the ones on hexes, most of the costly inversions of the
+ * transfinite interpolation by Newton iterations can be skipped.
+ *
  * @ingroup manifold
  */
 template <int dim, int spacedim = dim>
@@ -1155,6 +1166,37 @@ private:
    * this class goes out of scope.
    */
   boost::signals2::connection clear_signal;
+
+  /**
+   * The connections to Triangulation::signals::pre_refinement and
+   * Triangulation::signals::post_refinement that switch the cache of chart
+   * points on and off, and that must be reset once this class goes out of
+   * scope.
+   */
+  boost::signals2::connection pre_refinement_signal;
+  boost::signals2::connection post_refinement_signal;
+
+  /**
+   * Whether the triangulation is currently being refined, in which case the
+   * chart points of the new points computed by get_new_point() are stored
+   * in @p chart_point_cache.
+   */
+  bool cache_chart_points;
+
+  /**
+   * The chart points of the new vertices created during the current
+   * refinement, keyed by the index of the coarse cell whose chart they
+   * refer to and the coordinates of the vertex.
+   */
+  mutable std::map<std::pair<unsigned int, std::array<double, spacedim>>,
+                   Point<dim>>
+    chart_point_cache;
+
+  /**
+   * A mutex to guard @p chart_point_cache, since the new vertices are
+   * computed in parallel.
+   */
+  mutable Threads::Mutex chart_point_cache_mutex;
 };
 
 DEAL_II_NAMESPACE_CLOSE
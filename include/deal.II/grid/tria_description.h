@@ -710,6 +710,59 @@ namespace TriangulationDescription
       const TriangulationDescription::Settings setting =
         TriangulationDescription::Settings::default_setting);
 
+    /**
+     * Construct a TriangulationDescription::Description from a coarse mesh
+     * whose vertices and cells are distributed among the processes of
+     * @p comm, without any process ever holding the whole mesh. This is the
+     * function of choice for meshes that are too large to be read by a
+     * single process: each process reads a contiguous chunk of the vertices
+     * and of the cells of the mesh file (e.g., with collective MPI-IO) and
+     * passes them to this function, which sets up the locally relevant
+     * part of the mesh for each process through point-to-point
+     * communication only.
+     *
+     * The vertices of all processes are numbered globally in the order of
+     * the ranks, i.e., the vertices given on rank $p$ have the global
+     * indices from the sum of the number of vertices on ranks $0,\ldots,p-1$
+     * on. The vertex indices in @p local_cells refer to this global
+     * numbering. The cells are numbered in the same way, which gives the
+     * coarse cell ids of the resulting triangulation.
+     *
+     * @param local_vertices The chunk of vertices read on this process.
+     * @param local_cells The chunk of cells read on this process, with
+     *   global vertex indices. The vertices have to be given in the
+     *   ordering deal.II expects, as no reordering takes place.
+     * @param comm MPI communicator.
+     * @param local_boundary_ids Either empty, or for each cell in
+     *   @p local_cells the list of face numbers and boundary ids of its
+     *   faces at the boundary of the domain. Boundary faces not listed get
+     *   the boundary id zero.
+     * @param local_cell_owners Either empty, in which case each cell is
+     *   owned by the process that passed it in, or the rank of the future
+     *   owner of each cell in @p local_cells. This allows to prescribe a
+     *   partition computed from the chunks, e.g., along a space-filling
+     *   curve through the cell centers.
+     * @param smoothing Mesh smoothing type.
+     * @param setting See the description of the Settings enumerator.
+     * @return Description to be used to set up a Triangulation.
+     *
+     * @note The manifold ids of the lines and faces of the cells are set to
+     *   numbers::flat_manifold_id.
+     */
+    template <int dim, int spacedim = dim>
+    Description<dim, spacedim>
+    create_description_from_distributed_cells(
+      const std::vector<Point<spacedim>>       &local_vertices,
+      const std::vector<dealii::CellData<dim>> &local_cells,
+      const MPI_Comm                            comm,
+      const std::vector<std::vector<std::pair<unsigned int, types::boundary_id>>>
+                                      &local_boundary_ids = {},
+      const std::vector<unsigned int> &local_cell_owners  = {},
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing =
+        dealii::Triangulation<dim, spacedim>::none,
+      const TriangulationDescription::Settings setting =
+        TriangulationDescription::Settings::default_setting);
+
   } // namespace Utilities
 
 
@@ -30,6 +30,7 @@
 #include <deal.II/hp/q_collection.h>
 
 #include <memory>
+#include <optional>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -151,6 +152,17 @@ namespace hp
     void
     precalculate_fe_values();
 
+    /**
+     * Call FEValuesBase::always_allow_check_for_cell_similarity() with the
+     * argument @p allow on all FE*Values objects, those already created as
+     * well as those that will be created later. Each of these objects then
+     * detects if the current cell is a translation of the last cell it has
+     * been reinitialized with, and skips the transformation of the shape
+     * function derivatives in that case. See there for the implications.
+     */
+    void
+    always_allow_check_for_cell_similarity(const bool allow);
+
     /**
      * Get a reference to the collection of finite element objects used
      * here.
@@ -230,6 +242,15 @@ namespace hp
     const std::vector<QCollection<q_dim>> q_collections;
 
   private:
+    /**
+     * Create the FE*Values object for the given FE, mapping, and quadrature
+     * indices.
+     */
+    std::unique_ptr<FEValuesType>
+    create_fe_values(const unsigned int fe_index,
+                     const unsigned int mapping_index,
+                     const unsigned int q_index) const;
+
     /**
      * A table in which we store pointers to fe_values objects for different
      * finite element, mapping, and quadrature objects from our collection.
@@ -253,6 +274,13 @@ namespace hp
      * Values of the update flags as given to the constructor.
      */
     const UpdateFlags update_flags;
+
+    /**
+     * The argument of the last call to
+     * always_allow_check_for_cell_similarity(), if any, to be applied to
+     * the FE*Values objects created later.
+     */
+    std::optional<bool> check_for_cell_similarity_allowed;
   };
 
 } // namespace hp
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <set>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -402,6 +403,19 @@ namespace internal
        * Data array for reorder row/column indices.
        */
       GlobalRowsFromLocal<number> global_columns;
+
+      /**
+       * Temporary array of (global row, cell, local row) triplets used by
+       * the batched variant of distribute_local_to_global.
+       */
+      std::vector<std::tuple<size_type, unsigned int, unsigned int>>
+        batch_rows;
+
+      /**
+       * Temporary array of (global column, value) pairs used by the batched
+       * variant of distribute_local_to_global.
+       */
+      std::vector<std::pair<size_type, number>> batch_entries;
     };
   } // namespace AffineConstraints
 } // namespace internal
@@ -1605,7 +1619,8 @@ public:
    * simultaneous access and the access is not to rows with the same global
    * index at the same time. This needs to be made sure from the caller's
    * site. There is no locking mechanism inside this method to prevent data
-   * races.
+   * races. For SparseMatrix, simultaneous access to the same rows can be
+   * enabled by SparseMatrix::set_concurrent_add().
    */
   template <typename MatrixType>
   void
@@ -1613,6 +1628,30 @@ public:
                              const std::vector<size_type> &local_dof_indices,
                              MatrixType                   &global_matrix) const;
 
+  /**
+   * Batched version of the function above: distribute the local matrices of
+   * several cells, e.g., the cells of one chunk of a WorkStream loop, into
+   * the global matrix. The local matrix <tt>local_matrices[c]</tt> belongs to
+   * the indices <tt>local_dof_indices[c]</tt>.
+   *
+   * For all cells without constrained degrees of freedom, the contributions
+   * are sorted by global row first and then merged by column, so that every
+   * affected row of @p global_matrix is written only once by a single call to
+   * its <tt>add()</tt> function with sorted column indices. Cells that
+   * contain constrained degrees of freedom are handed to the function above
+   * one by one. The result is the same as calling the function above for
+   * every cell, up to round-off due to the different summation order.
+   *
+   * @note The same restrictions regarding thread-safety as in the function
+   * above apply.
+   */
+  template <typename MatrixType>
+  void
+  distribute_local_to_global(
+    const std::vector<FullMatrix<number>>     &local_matrices,
+    const std::vector<std::vector<size_type>> &local_dof_indices,
+    MatrixType                                &global_matrix) const;
+
   /**
    * This function does almost the same as the function above but can treat
    * general rectangular matrices. The main difference to achieve this is that
@@ -1689,7 +1728,10 @@ public:
    * for simultaneous access and the access is not to rows with the same
    * global index at the same time. This needs to be made sure from the
    * caller's site. There is no locking mechanism inside this method to
-   * prevent data races.
+   * prevent data races. For SparseMatrix and Vector, simultaneous access to
+   * the same rows can be enabled by SparseMatrix::set_concurrent_add() and
+   * Vector::set_concurrent_add(), as long as @p use_inhomogeneities_for_rhs
+   * is false.
    */
   template <typename MatrixType, typename VectorType>
   void
@@ -2136,9 +2178,9 @@ private:
   std::vector<ConstraintLine> lines;
 
   /**
-   * A list of size_type that contains the position of the ConstraintLine of a
-   * constrained degree of freedom, or numbers::invalid_size_type if the
-   * degree of freedom is not constrained. The numbers::invalid_size_type
+   * A list that contains the position of the ConstraintLine of a
+   * constrained degree of freedom, or numbers::invalid_unsigned_int if the
+   * degree of freedom is not constrained. The numbers::invalid_unsigned_int
    * return value returns thus whether there is a constraint line for a given
    * degree of freedom index. Note that this class has no notion of how many
    * degrees of freedom there really are, so if we check whether there is a
@@ -2166,8 +2208,16 @@ private:
    * needs random access to the constraints as in all the functions that apply
    * constraints on the fly while add cell contributions into vectors and
    * matrices.
+   *
+   * Since this vector has one entry for each locally stored degree of
+   * freedom, whereas the number of constraints is usually much smaller, it
+   * often dominates the memory consumption of this class. The positions are
+   * therefore stored as 32-bit integers even if 64-bit global indices are
+   * enabled, which halves this memory and the traffic in functions such as
+   * is_constrained() or distribute(). This limits the number of constraints
+   * stored in one object, but not the size of the index space.
    */
-  std::vector<size_type> lines_cache;
+  std::vector<unsigned int> lines_cache;
 
   /**
    * This IndexSet denotes the set of locally owned DoFs (or, more correctly,
@@ -2349,9 +2399,12 @@ AffineConstraints<number>::add_line(const size_type line_n)
   if (line_index >= lines_cache.size())
     lines_cache.resize(std::max(2 * static_cast<size_type>(lines_cache.size()),
                                 line_index + 1),
-                       numbers::invalid_size_type);
+                       numbers::invalid_unsigned_int);
 
   // push a new line to the end of the list
+  Assert(lines.size() < numbers::invalid_unsigned_int,
+         ExcMessage("The number of constraints exceeds the number of "
+                    "positions that can be stored in lines_cache."));
   lines.emplace_back();
   lines.back().index         = line_n;
   lines.back().inhomogeneity = 0.;
@@ -2382,7 +2435,7 @@ AffineConstraints<number>::add_entry(const size_type constrained_dof_index,
   //
   // in any case: exit the function if an entry for this column already
   // exists, since we don't want to enter it twice
-  Assert(lines_cache[line_index] != numbers::invalid_size_type,
+  Assert(lines_cache[line_index] != numbers::invalid_unsigned_int,
          ExcInternalError());
   Assert(!local_lines.size() || local_lines.is_element(column),
          ExcColumnNotStoredHere(constrained_dof_index, column));
@@ -2410,7 +2463,7 @@ AffineConstraints<number>::set_inhomogeneity(
 {
   const size_type line_index = calculate_line_index(constrained_dof_index);
   Assert(line_index < lines_cache.size() &&
-           lines_cache[line_index] != numbers::invalid_size_type,
+           lines_cache[line_index] != numbers::invalid_unsigned_int,
          ExcMessage("call add_line() before calling set_inhomogeneity()"));
   Assert(lines_cache[line_index] < lines.size(), ExcInternalError());
   ConstraintLine *line_ptr = &lines[lines_cache[line_index]];
@@ -2472,7 +2525,7 @@ AffineConstraints<number>::is_constrained(const size_type index) const
 
   const size_type line_index = calculate_line_index(index);
   return ((line_index < lines_cache.size()) &&
-          (lines_cache[line_index] != numbers::invalid_size_type));
+          (lines_cache[line_index] != numbers::invalid_unsigned_int));
 }
 
 template <typename number>
@@ -2484,7 +2537,7 @@ AffineConstraints<number>::is_inhomogeneously_constrained(
   // that means computing the line index twice
   const size_type line_index = calculate_line_index(line_n);
   if (line_index >= lines_cache.size() ||
-      lines_cache[line_index] == numbers::invalid_size_type)
+      lines_cache[line_index] == numbers::invalid_unsigned_int)
     return false;
   else
     {
@@ -2504,7 +2557,7 @@ AffineConstraints<number>::get_constraint_entries(const size_type line_n) const
   // that means computing the line index twice
   const size_type line_index = calculate_line_index(line_n);
   if (line_index >= lines_cache.size() ||
-      lines_cache[line_index] == numbers::invalid_size_type)
+      lines_cache[line_index] == numbers::invalid_unsigned_int)
     return nullptr;
   else
     return &lines[lines_cache[line_index]].entries;
@@ -2518,7 +2571,7 @@ AffineConstraints<number>::get_inhomogeneity(const size_type line_n) const
   // that means computing the line index twice
   const size_type line_index = calculate_line_index(line_n);
   if (line_index >= lines_cache.size() ||
-      lines_cache[line_index] == numbers::invalid_size_type)
+      lines_cache[line_index] == numbers::invalid_unsigned_int)
     return 0;
   else
     return lines[lines_cache[line_index]].inhomogeneity;
@@ -2846,7 +2899,7 @@ AffineConstraints<number>::merge(
     // cheap to adjust it along the way.
     std::fill(lines_cache.begin(),
               lines_cache.end(),
-              numbers::invalid_size_type);
+              numbers::invalid_unsigned_int);
 
     // reset lines_cache for our own constraints
     size_type index = 0;
@@ -2854,7 +2907,7 @@ AffineConstraints<number>::merge(
       {
         const size_type local_line_no = calculate_line_index(line.index);
         if (local_line_no >= lines_cache.size())
-          lines_cache.resize(local_line_no + 1, numbers::invalid_size_type);
+          lines_cache.resize(local_line_no + 1, numbers::invalid_unsigned_int);
         lines_cache[local_line_no] = index++;
       }
 
@@ -2864,14 +2917,15 @@ AffineConstraints<number>::merge(
         const size_type local_line_no = calculate_line_index(line.index);
         if (local_line_no >= lines_cache.size())
           {
-            lines_cache.resize(local_line_no + 1, numbers::invalid_size_type);
+            lines_cache.resize(local_line_no + 1,
+                               numbers::invalid_unsigned_int);
             lines.emplace_back(line.index,
                                typename ConstraintLine::Entries(
                                  line.entries.begin(), line.entries.end()),
                                line.inhomogeneity);
             lines_cache[local_line_no] = index++;
           }
-        else if (lines_cache[local_line_no] == numbers::invalid_size_type)
+        else if (lines_cache[local_line_no] == numbers::invalid_unsigned_int)
           {
             // there are no constraints for that line yet
             lines.emplace_back(line.index,
@@ -2912,7 +2966,7 @@ AffineConstraints<number>::merge(
 
     // check that we set the pointers correctly
     for (size_type i = 0; i < lines_cache.size(); ++i)
-      if (lines_cache[i] != numbers::invalid_size_type)
+      if (lines_cache[i] != numbers::invalid_unsigned_int)
         Assert(i == calculate_line_index(lines[lines_cache[i]].index),
                ExcInternalError());
   }
@@ -125,10 +125,13 @@ AffineConstraints<number>::add_constraint(
   if (line_index >= lines_cache.size())
     lines_cache.resize(std::max(2 * static_cast<size_type>(lines_cache.size()),
                                 line_index + 1),
-                       numbers::invalid_size_type);
+                       numbers::invalid_unsigned_int);
 
   // Push a new line to the end of the list and fill it with the
   // provided information:
+  Assert(lines.size() < numbers::invalid_unsigned_int,
+         ExcMessage("The number of constraints exceeds the number of "
+                    "positions that can be stored in lines_cache."));
   ConstraintLine &constraint = lines.emplace_back();
   constraint.index           = constrained_dof;
   constraint.entries.reserve(dependencies.size());
@@ -142,7 +145,7 @@ AffineConstraints<number>::add_constraint(
   constraint.inhomogeneity = inhomogeneity;
 
   // Record the new constraint in the cache:
-  Assert(lines_cache[line_index] == numbers::invalid_size_type,
+  Assert(lines_cache[line_index] == numbers::invalid_unsigned_int,
          ExcInternalError());
   lines_cache[line_index] = lines.size() - 1;
 }
@@ -167,11 +170,11 @@ AffineConstraints<number>::constrain_dof_to_zero(
   if (line_index >= lines_cache.size())
     lines_cache.resize(std::max(2 * static_cast<size_type>(lines_cache.size()),
                                 line_index + 1),
-                       numbers::invalid_size_type);
+                       numbers::invalid_unsigned_int);
 
   // Let's check whether the DoF is already constrained. This is only allowed
   // if it had previously been constrained to zero, and only then.
-  if (lines_cache[line_index] != numbers::invalid_size_type)
+  if (lines_cache[line_index] != numbers::invalid_unsigned_int)
     {
       Assert(lines[lines_cache[line_index]].entries.empty() &&
                (lines[lines_cache[line_index]].inhomogeneity == number(0.)),
@@ -183,12 +186,15 @@ AffineConstraints<number>::constrain_dof_to_zero(
     {
       // Push a new line to the end of the list and fill it with the
       // provided information:
+      Assert(lines.size() < numbers::invalid_unsigned_int,
+             ExcMessage("The number of constraints exceeds the number of "
+                        "positions that can be stored in lines_cache."));
       ConstraintLine &constraint = lines.emplace_back();
       constraint.index           = constrained_dof;
       constraint.inhomogeneity   = 0.;
 
       // Record the new constraint in the cache:
-      Assert(lines_cache[line_index] == numbers::invalid_size_type,
+      Assert(lines_cache[line_index] == numbers::invalid_unsigned_int,
              ExcInternalError());
       lines_cache[line_index] = lines.size() - 1;
     }
@@ -219,7 +225,7 @@ AffineConstraints<number>::is_consistent_in_parallel(
   auto get_line = [&](const size_type line_n) -> ConstraintLine {
     const size_type line_index = calculate_line_index(line_n);
     if (line_index >= lines_cache.size() ||
-        lines_cache[line_index] == numbers::invalid_size_type)
+        lines_cache[line_index] == numbers::invalid_unsigned_int)
       {
         const ConstraintLine empty = {line_n, {}, 0.0};
         return empty;
@@ -348,34 +354,88 @@ namespace internal
     constrained_indices.add_indices(constrained_indices_temp.begin(),
                                     constrained_indices_temp.end());
 
-    // step 1: identify owners of constraints
-    std::vector<unsigned int> constrained_indices_owners(
-      constrained_indices.n_elements());
+    // step 1: identify the owners of the constrained indices and of the
+    // locally relevant dofs in a single consensus algorithm. every process
+    // exchanges data with the owners of the indices it has looked up and
+    // with the processes that have looked up some of its indices in both of
+    // the following steps, possibly without any content, so that each
+    // process knows how many messages to expect.
+    IndexSet indices_to_look_up = constrained_indices;
+    indices_to_look_up.add_indices(locally_relevant_dofs);
+    indices_to_look_up.subtract_set(locally_owned_dofs);
+
+    std::vector<unsigned int> indices_owners(indices_to_look_up.n_elements());
     Utilities::MPI::internal::ComputeIndexOwner::ConsensusAlgorithmsPayload
-      constrained_indices_process(locally_owned_dofs,
-                                  constrained_indices,
-                                  mpi_communicator,
-                                  constrained_indices_owners,
-                                  true);
+      indices_process(locally_owned_dofs,
+                      indices_to_look_up,
+                      mpi_communicator,
+                      indices_owners,
+                      true);
 
     Utilities::MPI::ConsensusAlgorithms::Selector<
       std::vector<std::pair<types::global_dof_index, types::global_dof_index>>,
       std::vector<unsigned int>>
       consensus_algorithm;
-    consensus_algorithm.run(constrained_indices_process, mpi_communicator);
+    consensus_algorithm.run(indices_process, mpi_communicator);
+
+    const auto indices_by_ranks = indices_process.get_requesters();
+
+    std::set<unsigned int> owner_ranks(indices_owners.begin(),
+                                       indices_owners.end());
+    owner_ranks.erase(my_rank);
+
+    unsigned int n_requester_ranks = 0;
+    for (const auto &i : indices_by_ranks)
+      if (i.first != my_rank)
+        ++n_requester_ranks;
+
+    // helper function receiving the given number of messages with
+    // constraints sent with the given tag and appending the constraints
+    // selected by the predicate to locally_relevant_constraints
+    const auto receive_constraints = [&](const unsigned int n_messages,
+                                         const int          tag,
+                                         const auto        &select) {
+      for (unsigned int counter = 0; counter < n_messages; ++counter)
+        {
+          MPI_Status status;
+          int ierr = MPI_Probe(MPI_ANY_SOURCE, tag, mpi_communicator, &status);
+          AssertThrowMPI(ierr);
 
-    // step 2: collect all locally owned constraints
-    const auto constrained_indices_by_ranks =
-      constrained_indices_process.get_requesters();
+          int message_length;
+          ierr = MPI_Get_count(&status, MPI_CHAR, &message_length);
+          AssertThrowMPI(ierr);
+
+          std::vector<char> buffer(message_length);
+
+          ierr = MPI_Recv(buffer.data(),
+                          buffer.size(),
+                          MPI_CHAR,
+                          status.MPI_SOURCE,
+                          tag,
+                          mpi_communicator,
+                          MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+
+          const auto data =
+            Utilities::unpack<std::vector<ConstraintType>>(buffer, false);
+
+          for (const auto &constraint : data)
+            if (select(constraint))
+              locally_relevant_constraints.push_back(constraint);
+        }
+    };
 
+    // step 2: collect all locally owned constraints
     {
       const unsigned int tag = Utilities::MPI::internal::Tags::
         affine_constraints_make_consistent_in_parallel_0;
 
       // ... collect data and sort according to owner
       std::map<unsigned int, std::vector<ConstraintType>> send_data_temp;
+      for (const unsigned int rank : owner_ranks)
+        send_data_temp[rank];
 
-      for (unsigned int i = 0; i < constrained_indices_owners.size(); ++i)
+      for (unsigned int i = 0; i < constrained_indices.n_elements(); ++i)
         {
           ConstraintType entry;
 
@@ -391,10 +451,12 @@ namespace internal
                 constraints_in.get_constraint_entries(index))
             entry.entries = *constraints;
 
-          if (constrained_indices_owners[i] == my_rank)
+          if (locally_owned_dofs.is_element(index))
             locally_relevant_constraints.push_back(entry);
           else
-            send_data_temp[constrained_indices_owners[i]].push_back(entry);
+            send_data_temp[indices_owners[indices_to_look_up.index_within_set(
+                             index)]]
+              .push_back(entry);
         }
 
       std::map<unsigned int, std::vector<char>> send_data;
@@ -424,39 +486,9 @@ namespace internal
         }
 
       // ... receive data
-      unsigned int n_rec_ranks = 0;
-
-      for (const auto &i : constrained_indices_by_ranks)
-        if (i.first != my_rank)
-          ++n_rec_ranks;
-
-      for (unsigned int i = 0; i < n_rec_ranks; ++i)
-        {
-          MPI_Status status;
-          int ierr = MPI_Probe(MPI_ANY_SOURCE, tag, mpi_communicator, &status);
-          AssertThrowMPI(ierr);
-
-          int message_length;
-          ierr = MPI_Get_count(&status, MPI_CHAR, &message_length);
-          AssertThrowMPI(ierr);
-
-          std::vector<char> buffer(message_length);
-
-          ierr = MPI_Recv(buffer.data(),
-                          buffer.size(),
-                          MPI_CHAR,
-                          status.MPI_SOURCE,
-                          tag,
-                          mpi_communicator,
-                          MPI_STATUS_IGNORE);
-          AssertThrowMPI(ierr);
-
-          const auto data =
-            Utilities::unpack<std::vector<ConstraintType>>(buffer, false);
-
-          for (const auto &i : data)
-            locally_relevant_constraints.push_back(i);
-        }
+      receive_constraints(n_requester_ranks, tag, [](const auto &) {
+        return true;
+      });
 
       const int ierr =
         MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
@@ -471,36 +503,13 @@ namespace internal
       const unsigned int tag = Utilities::MPI::internal::Tags::
         affine_constraints_make_consistent_in_parallel_1;
 
-      // ... determine owners of locally relevant dofs
-      IndexSet locally_relevant_dofs_non_local = locally_relevant_dofs;
-      locally_relevant_dofs_non_local.subtract_set(locally_owned_dofs);
-
-      std::vector<unsigned int> locally_relevant_dofs_owners(
-        locally_relevant_dofs_non_local.n_elements());
-      Utilities::MPI::internal::ComputeIndexOwner::ConsensusAlgorithmsPayload
-        locally_relevant_dofs_process(locally_owned_dofs,
-                                      locally_relevant_dofs_non_local,
-                                      mpi_communicator,
-                                      locally_relevant_dofs_owners,
-                                      true);
-
-      Utilities::MPI::ConsensusAlgorithms::Selector<
-        std::vector<
-          std::pair<types::global_dof_index, types::global_dof_index>>,
-        std::vector<unsigned int>>
-        consensus_algorithm;
-      consensus_algorithm.run(locally_relevant_dofs_process, mpi_communicator);
-
-      const auto locally_relevant_dofs_by_ranks =
-        locally_relevant_dofs_process.get_requesters();
-
       std::map<unsigned int, std::vector<char>> send_data;
 
       std::vector<MPI_Request> requests;
-      requests.reserve(send_data.size());
+      requests.reserve(indices_by_ranks.size());
 
       // ... send data
-      for (const auto &rank_and_indices : locally_relevant_dofs_by_ranks)
+      for (const auto &rank_and_indices : indices_by_ranks)
         {
           Assert(rank_and_indices.first != my_rank, ExcInternalError());
 
@@ -509,14 +518,17 @@ namespace internal
           for (const auto index : rank_and_indices.second)
             {
               // note: at this stage locally_relevant_constraints still
-              // contains only locally owned constraints
+              // contains only locally owned constraints, sorted by their
+              // index
               const auto ptr =
-                std::find_if(locally_relevant_constraints.begin(),
-                             locally_relevant_constraints.end(),
-                             [index](const auto &a) {
-                               return a.index == index;
-                             });
-              if (ptr != locally_relevant_constraints.end())
+                std::lower_bound(locally_relevant_constraints.begin(),
+                                 locally_relevant_constraints.end(),
+                                 index,
+                                 [](const auto &a, const auto b) {
+                                   return a.index < b;
+                                 });
+              if (ptr != locally_relevant_constraints.end() &&
+                  ptr->index == index)
                 data.push_back(*ptr);
             }
 
@@ -534,49 +546,15 @@ namespace internal
           AssertThrowMPI(ierr);
         }
 
-      // ... receive data
-      const unsigned int n_rec_ranks = [&]() {
-        // count number of ranks from where data will be received from
-        // by looping locally_relevant_dofs_owners and identifying unique
-        // rank (ignoring the current rank)
-
-        std::set<unsigned int> rec_ranks;
-
-        for (const unsigned int rank : locally_relevant_dofs_owners)
-          if (rank != my_rank)
-            rec_ranks.insert(rank);
-
-        return rec_ranks.size();
-      }();
-
-      for (unsigned int counter = 0; counter < n_rec_ranks; ++counter)
-        {
-          MPI_Status status;
-          int ierr = MPI_Probe(MPI_ANY_SOURCE, tag, mpi_communicator, &status);
-          AssertThrowMPI(ierr);
-
-          int message_length;
-          ierr = MPI_Get_count(&status, MPI_CHAR, &message_length);
-          AssertThrowMPI(ierr);
-
-          std::vector<char> buffer(message_length);
-
-          ierr = MPI_Recv(buffer.data(),
-                          buffer.size(),
-                          MPI_CHAR,
-                          status.MPI_SOURCE,
+      // ... receive data, keeping only the constraints of the locally
+      // relevant dofs since the owners also return the constraints of the
+      // other indices looked up in step 1
+      receive_constraints(owner_ranks.size(),
                           tag,
-                          mpi_communicator,
-                          MPI_STATUS_IGNORE);
-          AssertThrowMPI(ierr);
-
-          const auto received_locally_relevant_constrain =
-            Utilities::unpack<std::vector<ConstraintType>>(buffer, false);
-
-          for (const auto &locally_relevant_constrain :
-               received_locally_relevant_constrain)
-            locally_relevant_constraints.push_back(locally_relevant_constrain);
-        }
+                          [&](const ConstraintType &constraint) {
+                            return locally_relevant_dofs.is_element(
+                              constraint.index);
+                          });
 
       const int ierr =
         MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
@@ -750,9 +728,9 @@ AffineConstraints<number>::close()
   // update list of pointers and give the vector a sharp size since we
   // won't modify the size any more after this point.
   {
-    std::vector<size_type> new_lines(lines_cache.size(),
-                                     numbers::invalid_size_type);
-    size_type              counter = 0;
+    std::vector<unsigned int> new_lines(lines_cache.size(),
+                                        numbers::invalid_unsigned_int);
+    unsigned int              counter = 0;
     for (const ConstraintLine &line : lines)
       {
         new_lines[calculate_line_index(line.index)] = counter;
@@ -763,7 +741,7 @@ AffineConstraints<number>::close()
 
   // in debug mode: check whether we really set the pointers correctly.
   for (size_type i = 0; i < lines_cache.size(); ++i)
-    if (lines_cache[i] != numbers::invalid_size_type)
+    if (lines_cache[i] != numbers::invalid_unsigned_int)
       Assert(i == calculate_line_index(lines[lines_cache[i]].index),
              ExcInternalError());
 
@@ -792,173 +770,133 @@ AffineConstraints<number>::close()
 
 
 
-#ifdef DEBUG
-  // In debug mode we are computing an estimate for the maximum number
-  // of constraints so that we can bail out if there is a cycle in the
-  // constraints (which is easier than searching for cycles in the graph).
+  // replace references to dofs that are themselves constrained. because we
+  // may replace references to other dofs that may themselves be constrained
+  // to third ones, we first compute the depth of each line in the graph of
+  // constraints, i.e., the length of the longest chain of constraints
+  // starting at it. lines of depth zero only refer to unconstrained dofs and
+  // are final already. lines of larger depth only refer to lines of smaller
+  // depth, so that we can resolve all lines of the same depth in parallel,
+  // once the lines of the smaller depths have been resolved.
   //
-  // Let us figure out the largest dof index. This is an upper bound for the
-  // number of constraints because it is an approximation for the number of dofs
-  // in our system.
-  size_type largest_idx = 0;
-  for (const ConstraintLine &line : lines)
-    for (const std::pair<size_type, number> &entry : line.entries)
-      largest_idx = std::max(largest_idx, entry.first);
-#endif
-
-      // replace references to dofs that are themselves constrained. note that
-      // because we may replace references to other dofs that may themselves be
-      // constrained to third ones, we have to iterate over all this until we
-      // replace no chains of constraints any more
-      //
-      // the iteration replaces references to constrained degrees of freedom by
-      // second-order references. for example if x3=x0/2+x2/2 and x2=x0/2+x1/2,
-      // then the new list will be x3=x0/2+x0/4+x1/4. note that x0 appear
-      // twice. we will throw this duplicate out in the following step, where
-      // we sort the list so that throwing out duplicates becomes much more
-      // efficient. also, we have to do it only once, rather than in each
-      // iteration
-#ifdef DEBUG
-  size_type iteration = 0;
-#endif
-  bool              chained_constraint_replaced = false;
-  std::vector<bool> line_finalized(lines.size(), false);
-  do
-    {
-      chained_constraint_replaced = false;
-      for (unsigned int line_index = 0; line_index < lines.size(); ++line_index)
-        if (line_finalized[line_index] == false)
-          {
-            ConstraintLine &line = lines[line_index];
+  // for example if x3=x0/2+x2/2 and x2=x0/2+x1/2, then x2 has depth one and
+  // x3 depth two, and the new list for x3 will be x3=x0/2+x0/4+x1/4. note
+  // that x0 appears twice. we will throw this duplicate out in the following
+  // step, where we sort the list so that throwing out duplicates becomes
+  // much more efficient.
+  const auto constraint_line_of = [&](const size_type dof_index) {
+    const size_type line_index = calculate_line_index(dof_index);
+    return line_index < lines_cache.size() ? lines_cache[line_index] :
+                                             numbers::invalid_unsigned_int;
+  };
 
-#ifdef DEBUG
-            // we need to keep track of how many replacements we do in this
-            // line, because we can end up in a cycle A->B->C->A without the
-            // number of entries growing.
-            size_type n_replacements = 0;
-#endif
+  // compute the depths by a depth-first search without recursion, since the
+  // chains can be long
+  const unsigned int        unknown_depth = numbers::invalid_unsigned_int;
+  const unsigned int        in_progress   = numbers::invalid_unsigned_int - 1;
+  std::vector<unsigned int> depths(lines.size(), unknown_depth);
+  unsigned int              max_depth = 0;
+  {
+    std::vector<std::pair<size_type, size_type>> stack;
+    for (size_type start = 0; start < lines.size(); ++start)
+      if (depths[start] == unknown_depth)
+        {
+          depths[start] = in_progress;
+          stack.emplace_back(start, 0);
+          while (stack.empty() == false)
+            {
+              const size_type line_index = stack.back().first;
+              const auto     &entries    = lines[line_index].entries;
+              if (stack.back().second < entries.size())
+                {
+                  const unsigned int other =
+                    constraint_line_of(entries[stack.back().second].first);
+                  ++stack.back().second;
+                  if (other != numbers::invalid_unsigned_int)
+                    {
+                      Assert(depths[other] != in_progress,
+                             ExcMessage("Cycle in constraints detected!"));
+                      if (depths[other] == unknown_depth)
+                        {
+                          depths[other] = in_progress;
+                          stack.emplace_back(other, 0);
+                        }
+                    }
+                }
+              else
+                {
+                  unsigned int depth = 0;
+                  for (const auto &entry : entries)
+                    {
+                      const unsigned int other =
+                        constraint_line_of(entry.first);
+                      if (other != numbers::invalid_unsigned_int &&
+                          depths[other] < in_progress)
+                        depth = std::max(depth, depths[other] + 1);
+                    }
+                  depths[line_index] = depth;
+                  max_depth          = std::max(max_depth, depth);
+                  stack.pop_back();
+                }
+            }
+        }
+  }
 
-            // loop over all entries of this line (including ones that we
-            // have appended in this go around) and see whether they are
-            // further constrained. ignore elements that we don't store on
-            // the current processor.
-            const unsigned int n_original_entries  = line.entries.size();
-            bool               has_sub_constraints = false;
-            const size_type    lines_cache_size    = lines_cache.size();
-            for (unsigned int entry = 0; entry < n_original_entries; ++entry)
+  if (max_depth > 0)
+    {
+      std::vector<std::vector<size_type>> lines_by_depth(max_depth + 1);
+      for (size_type line_index = 0; line_index < lines.size(); ++line_index)
+        lines_by_depth[depths[line_index]].push_back(line_index);
+
+      for (unsigned int depth = 1; depth <= max_depth; ++depth)
+        parallel::apply_to_subranges(
+          lines_by_depth[depth].cbegin(),
+          lines_by_depth[depth].cend(),
+          [&](const typename std::vector<size_type>::const_iterator begin,
+              const typename std::vector<size_type>::const_iterator end) {
+            typename ConstraintLine::Entries new_entries;
+            for (auto it = begin; it != end; ++it)
               {
-                const size_type dof_index =
-                  calculate_line_index(line.entries[entry].first);
+                ConstraintLine &line = lines[*it];
 
-                if (dof_index < lines_cache_size &&
-                    lines_cache[dof_index] != numbers::invalid_size_type)
+                new_entries.clear();
+                for (const auto &entry : line.entries)
                   {
-                    // Now we found an index that is further constrained, so
-                    // we need to resolve the entries.  We may replace some of
-                    // them, and we may add some, but we only walk through the
-                    // original entries (and also don't touch the
-                    // replacements) even though in principle we could also do
-                    // the ones we have added or replaced. There is no harm in
-                    // doing so: we will simply treat those in the next round
-                    // around of the outer iteration.
-                    has_sub_constraints = true;
-
-                    const number weight = line.entries[entry].second;
-                    Assert(line.entries[entry].first != line.index,
+                    Assert(entry.first != line.index,
                            ExcMessage("Cycle in constraints detected!"));
 
-                    const ConstraintLine &constrained_line =
-                      lines[lines_cache[dof_index]];
-                    Assert(constrained_line.index == line.entries[entry].first,
-                           ExcInternalError());
-
-                    // now we have to replace an entry by its expansion. we do
-                    // that by overwriting the entry by the first entry of the
-                    // expansion and adding the remaining ones to the end,
-                    // where we will later process them once more
-                    //
-                    // we can of course only do that if the DoF that we are
-                    // currently handling is constrained by a linear combination
-                    // of other dofs:
-                    if (constrained_line.entries.size() > 0)
-                      {
-                        for (size_type i = 0;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          Assert(line.entries[entry].first !=
-                                   constrained_line.entries[i].first,
-                                 ExcMessage("Cycle in constraints detected!"));
-
-                        // replace first entry, then tack the rest to the end
-                        // of the list
-                        line.entries[entry] = std::pair<size_type, number>(
-                          constrained_line.entries[0].first,
-                          constrained_line.entries[0].second * weight);
-
-                        for (size_type i = 1;
-                             i < constrained_line.entries.size();
-                             ++i)
-                          line.entries.emplace_back(
-                            constrained_line.entries[i].first,
-                            constrained_line.entries[i].second * weight);
-
-#ifdef DEBUG
-                        // keep track of how many entries we replace in this
-                        // line. If we do more than there are constraints or
-                        // dofs in our system, we must have a cycle.
-                        ++n_replacements;
-                        Assert(n_replacements / 2 < largest_idx,
-                               ExcMessage("Cycle in constraints detected!"));
-#endif
-                      }
+                    const unsigned int other = constraint_line_of(entry.first);
+                    if (other == numbers::invalid_unsigned_int)
+                      new_entries.push_back(entry);
                     else
-                      // the DoF that we encountered is not constrained by a
-                      // linear combination of other dofs but is equal to just
-                      // the inhomogeneity (i.e. its chain of entries is
-                      // empty). in that case, we can't just overwrite the
-                      // current entry, but we have to actually eliminate
-                      // it. we do not want to change the loop length above we
-                      // do so by setting the 'first' entry to
-                      // invalid_size_type here to finally remove entries in a
-                      // second loop
                       {
-                        line.entries[entry].first = numbers::invalid_size_type;
+                        // the DoF is constrained by a line that has been
+                        // resolved already. replace the entry by the
+                        // expansion of that line, which is empty if the DoF
+                        // is equal to just the inhomogeneity
+                        const ConstraintLine &constrained_line = lines[other];
+                        Assert(constrained_line.index == entry.first,
+                               ExcInternalError());
+                        for (const auto &constrained_entry :
+                             constrained_line.entries)
+                          {
+                            Assert(constrained_entry.first != line.index,
+                                   ExcMessage(
+                                     "Cycle in constraints detected!"));
+                            new_entries.emplace_back(constrained_entry.first,
+                                                     constrained_entry.second *
+                                                       entry.second);
+                          }
+
+                        line.inhomogeneity +=
+                          constrained_line.inhomogeneity * entry.second;
                       }
-
-                    line.inhomogeneity +=
-                      constrained_line.inhomogeneity * weight;
                   }
+                line.entries.swap(new_entries);
               }
-
-            // If none of the entries in the current line refer to DoFs that are
-            // themselves constrained, then we can move on:
-            if (has_sub_constraints == false)
-              line_finalized[line_index] = true;
-            else
-              {
-                chained_constraint_replaced = true;
-
-                // Now delete the elements we have marked for deletion.
-                auto remaining_entries = line.entries.begin();
-                for (const auto &entry : line.entries)
-                  if (entry.first != numbers::invalid_size_type)
-                    {
-                      *remaining_entries = entry;
-                      ++remaining_entries;
-                    }
-                line.entries.erase(remaining_entries, line.entries.end());
-              }
-          }
-
-#ifdef DEBUG
-      // increase iteration count. note that we should not iterate more
-      // times than there are constraints, since this puts a natural upper
-      // bound on the length of constraint chains
-      ++iteration;
-      Assert(iteration <= lines.size() + 1, ExcInternalError());
-#endif
+          },
+          /* grainsize = */ 100);
     }
-  while (chained_constraint_replaced == true);
 
   // Finally sort the entries and re-scale them if necessary. in this step,
   // we also throw out duplicates as mentioned above. moreover, as some
@@ -1154,7 +1092,9 @@ void
 AffineConstraints<number>::shift(const size_type offset)
 {
   if (local_lines.size() == 0)
-    lines_cache.insert(lines_cache.begin(), offset, numbers::invalid_size_type);
+    lines_cache.insert(lines_cache.begin(),
+                       offset,
+                       numbers::invalid_unsigned_int);
   else
     {
       // shift local_lines
@@ -1174,7 +1114,7 @@ AffineConstraints<number>::shift(const size_type offset)
   // make sure that lines, lines_cache and local_lines
   // are still linked correctly
   for (size_type index = 0; index < lines_cache.size(); ++index)
-    Assert(lines_cache[index] == numbers::invalid_size_type ||
+    Assert(lines_cache[index] == numbers::invalid_unsigned_int ||
              calculate_line_index(lines[lines_cache[index]].index) == index,
            ExcInternalError());
 #endif
@@ -1259,7 +1199,7 @@ AffineConstraints<number>::clear()
   }
 
   {
-    std::vector<size_type> tmp;
+    std::vector<unsigned int> tmp;
     lines_cache.swap(tmp);
   }
 
@@ -4232,8 +4172,14 @@ AffineConstraints<number>::distribute_local_to_global(
   // calling the other function above.
   const bool use_vectors =
     (local_vector.size() == 0 && global_vector.size() == 0) ? false : true;
+  SparseMatrix<number> *sparse_matrix =
+    dynamic_cast<SparseMatrix<number> *>(&global_matrix);
+  // the shortcut for deal.II matrices writes into the matrix rows directly
+  // rather than through add(), so it must not be used if the matrix is set
+  // up for concurrent additions
   const bool use_dealii_matrix =
-    std::is_same_v<MatrixType, SparseMatrix<number>>;
+    std::is_same_v<MatrixType, SparseMatrix<number>> &&
+    sparse_matrix->get_concurrent_add() == false;
 
   AssertDimension(local_matrix.n(), local_dof_indices.size());
   AssertDimension(local_matrix.m(), local_dof_indices.size());
@@ -4272,8 +4218,6 @@ AffineConstraints<number>::distribute_local_to_global(
     scratch_data->vector_values;
   vector_indices.resize(n_actual_dofs);
   vector_values.resize(n_actual_dofs);
-  SparseMatrix<number> *sparse_matrix =
-    dynamic_cast<SparseMatrix<number> *>(&global_matrix);
   if (use_dealii_matrix == false)
     {
       cols.resize(n_actual_dofs);
@@ -4390,8 +4334,17 @@ AffineConstraints<number>::distribute_local_to_global(
 {
   const bool use_vectors =
     (local_vector.size() == 0 && global_vector.size() == 0) ? false : true;
-  const bool use_dealii_matrix =
+  bool use_dealii_matrix =
     std::is_same_v<MatrixType, BlockSparseMatrix<number>>;
+  // as in the non-block case, blocks set up for concurrent additions must be
+  // written through their add() functions
+  if (use_dealii_matrix)
+    for (unsigned int r = 0; r < global_matrix.n_block_rows(); ++r)
+      for (unsigned int c = 0; c < global_matrix.n_block_cols(); ++c)
+        if (const auto *block = dynamic_cast<const SparseMatrix<number> *>(
+              &global_matrix.block(r, c)))
+          if (block->get_concurrent_add())
+            use_dealii_matrix = false;
 
   AssertDimension(local_matrix.n(), local_dof_indices.size());
   AssertDimension(local_matrix.m(), local_dof_indices.size());
@@ -4513,6 +4466,113 @@ AffineConstraints<number>::distribute_local_to_global(
 
 
 
+template <typename number>
+template <typename MatrixType>
+void
+AffineConstraints<number>::distribute_local_to_global(
+  const std::vector<FullMatrix<number>>     &local_matrices,
+  const std::vector<std::vector<size_type>> &local_dof_indices,
+  MatrixType                                &global_matrix) const
+{
+  AssertDimension(local_matrices.size(), local_dof_indices.size());
+  Assert(lines.empty() || sorted == true, ExcMatrixNotClosed());
+
+  // cells touching constrained DoFs are rare (they sit at boundaries and
+  // hanging nodes), so we collect them here and send them through the
+  // single-cell function once the scratch data is released again
+  std::vector<unsigned int> constrained_cells;
+
+  {
+    typename internal::AffineConstraints::ScratchDataAccessor<number>
+      scratch_data(this->scratch_data);
+
+    // collect the rows of all unconstrained cells and sort them by their
+    // global index, such that contributions of different cells to the same
+    // row end up next to each other
+    std::vector<std::tuple<size_type, unsigned int, unsigned int>> &rows =
+      scratch_data->batch_rows;
+    rows.clear();
+    for (unsigned int c = 0; c < local_matrices.size(); ++c)
+      {
+        const std::vector<size_type> &indices = local_dof_indices[c];
+        AssertDimension(local_matrices[c].m(), indices.size());
+        AssertDimension(local_matrices[c].n(), indices.size());
+
+        bool has_constraints = false;
+        if (lines.empty() == false)
+          for (const size_type index : indices)
+            if (is_constrained(index))
+              {
+                has_constraints = true;
+                break;
+              }
+
+        if (has_constraints)
+          constrained_cells.push_back(c);
+        else
+          for (unsigned int i = 0; i < indices.size(); ++i)
+            rows.emplace_back(indices[i], c, i);
+      }
+    std::sort(rows.begin(), rows.end());
+
+    // go through the rows, merge the entries of all cells by column, and
+    // write each row at once
+    std::vector<std::pair<size_type, number>> &entries =
+      scratch_data->batch_entries;
+    std::vector<size_type> &cols = scratch_data->columns;
+    std::vector<number>    &vals = scratch_data->values;
+    for (std::size_t begin = 0; begin < rows.size();)
+      {
+        const size_type row = std::get<0>(rows[begin]);
+
+        entries.clear();
+        std::size_t end = begin;
+        for (; end < rows.size() && std::get<0>(rows[end]) == row; ++end)
+          {
+            const unsigned int            c = std::get<1>(rows[end]);
+            const unsigned int            i = std::get<2>(rows[end]);
+            const std::vector<size_type> &indices = local_dof_indices[c];
+            for (unsigned int j = 0; j < indices.size(); ++j)
+              entries.emplace_back(indices[j], local_matrices[c](i, j));
+          }
+        begin = end;
+
+        std::sort(entries.begin(),
+                  entries.end(),
+                  [](const std::pair<size_type, number> &a,
+                     const std::pair<size_type, number> &b) {
+                    return a.first < b.first;
+                  });
+
+        cols.clear();
+        vals.clear();
+        for (const auto &entry : entries)
+          if (cols.empty() == false && cols.back() == entry.first)
+            vals.back() += entry.second;
+          else
+            {
+              cols.push_back(entry.first);
+              vals.push_back(entry.second);
+            }
+
+        if (cols.empty() == false)
+          global_matrix.add(row,
+                            cols.size(),
+                            cols.data(),
+                            vals.data(),
+                            /* elide zero additions */ false,
+                            /* sorted by column index */ true);
+      }
+  }
+
+  for (const unsigned int c : constrained_cells)
+    distribute_local_to_global(local_matrices[c],
+                               local_dof_indices[c],
+                               global_matrix);
+}
+
+
+
 template <typename number>
 template <typename MatrixType>
 void
@@ -0,0 +1,384 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_batched_full_matrix_h
+#define dealii_batched_full_matrix_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/full_matrix.h>
+
+#include <array>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A batch of dense matrices of equal size, stored with one matrix per lane of
+ * a VectorizedArray. This is the data structure of choice to compute the
+ * local matrices of VectorizedArrayType::size() cells at once in classical
+ * assembly loops, as every arithmetic operation then acts on all cells of the
+ * batch with a single SIMD instruction.
+ *
+ * The central operation is add_weighted_product(), which computes
+ * $C_{ij} \mathrel{+}= \sum_p A_{ip} w_p B_{jp}$, the structure of all
+ * bilinear forms that are evaluated by quadrature: the index $p$ runs over
+ * the quadrature points (and possibly the components of a gradient), $A$ and
+ * $B$ hold the test and trial functions, and $w$ the quadrature weights
+ * times coefficients. FEValuesBatch fills shape function tables in this
+ * layout. Once computed, the matrix of an individual cell is extracted with
+ * extract_lane().
+ */
+template <typename VectorizedArrayType>
+class BatchedFullMatrix : public Table<2, VectorizedArrayType>
+{
+public:
+  /**
+   * The scalar type of the entries of the individual matrices.
+   */
+  using value_type = typename VectorizedArrayType::value_type;
+
+  /**
+   * Declare type for container size.
+   */
+  using size_type = std::size_t;
+
+  /**
+   * Constructor. Set the size of the matrices to @p m times @p n and all
+   * entries to zero.
+   */
+  BatchedFullMatrix(const size_type m = 0, const size_type n = 0);
+
+  /**
+   * Set the size of the matrices to @p m times @p n and all entries to
+   * zero.
+   */
+  void
+  reinit(const size_type m, const size_type n);
+
+  /**
+   * Number of rows of the matrices.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Number of columns of the matrices.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Compute $C_{ij} \mathrel{+}= \sum_p A_{ip} w_{p/c} B_{jp}$ for all
+   * matrices of the batch, where $c$ is @p n_points_per_weight. The tables
+   * @p A and @p B are indexed by the row or column of this matrix first and
+   * by the point index $p$ second, so that the sum over $p$ runs over
+   * contiguous memory. Passing $c$ equal to the space dimension allows to
+   * use one weight per quadrature point for tables of gradients, whose
+   * point index is $p = q \cdot \text{dim} + d$.
+   *
+   * If @p A and @p B are the same object, the symmetry of the result is
+   * exploited.
+   */
+  void
+  add_weighted_product(const Table<2, VectorizedArrayType>        &A,
+                       const AlignedVector<VectorizedArrayType>   &weights,
+                       const Table<2, VectorizedArrayType>        &B,
+                       const unsigned int n_points_per_weight = 1);
+
+  /**
+   * Invert all matrices of the batch in place, using the same Gauss-Jordan
+   * algorithm with partial pivoting as FullMatrix::gauss_jordan(). The
+   * elimination acts on all matrices at once, and only the pivot search and
+   * the row interchanges are done lane by lane. For the small matrices of
+   * block preconditioners or local element inverses, this is considerably
+   * faster than inverting the matrices one after the other.
+   *
+   * All matrices of the batch need to be square and regular, including the
+   * ones in lanes not used by the caller, which should e.g. be filled with
+   * the identity matrix.
+   */
+  void
+  invert();
+
+  /**
+   * Compute the matrix-vector products $dst = M src$ for all matrices $M$ of
+   * the batch, where lane $l$ of the vectors belongs to the matrix in lane
+   * $l$. Together with invert(), this solves many small linear systems at
+   * once.
+   */
+  void
+  vmult(AlignedVector<VectorizedArrayType>       &dst,
+        const AlignedVector<VectorizedArrayType> &src) const;
+
+  /**
+   * Copy @p matrix into lane @p lane of the batch. The size of @p matrix must
+   * equal the one of the matrices in the batch.
+   */
+  template <typename number>
+  void
+  insert_lane(const unsigned int lane, const FullMatrix<number> &matrix);
+
+  /**
+   * Copy the matrix in lane @p lane of the batch into @p matrix, which is
+   * resized if necessary.
+   */
+  template <typename number>
+  void
+  extract_lane(const unsigned int lane, FullMatrix<number> &matrix) const;
+};
+
+
+
+/*---------------------------- Inline functions -----------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename VectorizedArrayType>
+inline BatchedFullMatrix<VectorizedArrayType>::BatchedFullMatrix(
+  const size_type m,
+  const size_type n)
+  : Table<2, VectorizedArrayType>(m, n)
+{}
+
+
+
+template <typename VectorizedArrayType>
+inline void
+BatchedFullMatrix<VectorizedArrayType>::reinit(const size_type m,
+                                               const size_type n)
+{
+  Table<2, VectorizedArrayType>::reinit(m, n);
+}
+
+
+
+template <typename VectorizedArrayType>
+inline typename BatchedFullMatrix<VectorizedArrayType>::size_type
+BatchedFullMatrix<VectorizedArrayType>::m() const
+{
+  return this->n_rows();
+}
+
+
+
+template <typename VectorizedArrayType>
+inline typename BatchedFullMatrix<VectorizedArrayType>::size_type
+BatchedFullMatrix<VectorizedArrayType>::n() const
+{
+  return this->n_cols();
+}
+
+
+
+template <typename VectorizedArrayType>
+void
+BatchedFullMatrix<VectorizedArrayType>::add_weighted_product(
+  const Table<2, VectorizedArrayType>      &A,
+  const AlignedVector<VectorizedArrayType> &weights,
+  const Table<2, VectorizedArrayType>      &B,
+  const unsigned int                        n_points_per_weight)
+{
+  AssertDimension(A.size(0), m());
+  AssertDimension(B.size(0), n());
+  AssertDimension(A.size(1), B.size(1));
+  AssertDimension(A.size(1), weights.size() * n_points_per_weight);
+
+  const unsigned int n_points  = A.size(1);
+  const bool         symmetric = (&A == &B);
+
+  // scale the rows of B by the weights once, so that the innermost loop
+  // below is a plain dot product over contiguous memory
+  AlignedVector<VectorizedArrayType> weighted_B(n() * n_points);
+  for (unsigned int j = 0; j < n(); ++j)
+    {
+      const VectorizedArrayType *b = &B(j, 0);
+      VectorizedArrayType       *c = weighted_B.begin() + j * n_points;
+      for (unsigned int p = 0; p < n_points; ++p)
+        c[p] = b[p] * weights[p / n_points_per_weight];
+    }
+
+  for (unsigned int i = 0; i < m(); ++i)
+    {
+      const VectorizedArrayType *a = &A(i, 0);
+      for (unsigned int j = (symmetric ? i : 0); j < n(); ++j)
+        {
+          const VectorizedArrayType *b = weighted_B.begin() + j * n_points;
+
+          VectorizedArrayType sum = 0.;
+          for (unsigned int p = 0; p < n_points; ++p)
+            sum += a[p] * b[p];
+
+          (*this)(i, j) += sum;
+          if (symmetric && j > i)
+            (*this)(j, i) += sum;
+        }
+    }
+}
+
+
+
+template <typename VectorizedArrayType>
+void
+BatchedFullMatrix<VectorizedArrayType>::invert()
+{
+  Assert(m() == n(), ExcNotQuadratic());
+
+  constexpr unsigned int n_lanes = VectorizedArrayType::size();
+  const unsigned int     N       = m();
+
+  // estimate of the size of the diagonal elements of each matrix, to check
+  // whether the pivots are large enough
+  std::array<value_type, n_lanes> typical_diagonal_element;
+  for (unsigned int l = 0; l < n_lanes; ++l)
+    {
+      value_type diagonal_sum = 0;
+      for (unsigned int i = 0; i < N; ++i)
+        diagonal_sum += std::abs((*this)(i, i)[l]);
+      typical_diagonal_element[l] = diagonal_sum / N;
+    }
+  (void)typical_diagonal_element;
+
+  // the permutations of each lane found during the pivot search
+  Table<2, unsigned int> p(n_lanes, N);
+  for (unsigned int l = 0; l < n_lanes; ++l)
+    for (unsigned int i = 0; i < N; ++i)
+      p(l, i) = i;
+
+  for (unsigned int j = 0; j < N; ++j)
+    {
+      // pivot search and row interchange, separately for each lane
+      for (unsigned int l = 0; l < n_lanes; ++l)
+        {
+          value_type   max = std::abs((*this)(j, j)[l]);
+          unsigned int r   = j;
+          for (unsigned int i = j + 1; i < N; ++i)
+            if (std::abs((*this)(i, j)[l]) > max)
+              {
+                max = std::abs((*this)(i, j)[l]);
+                r   = i;
+              }
+
+          Assert(max > 1.e-16 * typical_diagonal_element[l],
+                 typename FullMatrix<value_type>::ExcNotRegular(max));
+
+          if (r > j)
+            {
+              for (unsigned int k = 0; k < N; ++k)
+                std::swap((*this)(j, k)[l], (*this)(r, k)[l]);
+              std::swap(p(l, j), p(l, r));
+            }
+        }
+
+      // transformation, for all lanes at once
+      const VectorizedArrayType hr = VectorizedArrayType(1.) / (*this)(j, j);
+      for (unsigned int i = 0; i < N; ++i)
+        {
+          if (i == j)
+            continue;
+          const VectorizedArrayType factor = (*this)(i, j) * hr;
+          for (unsigned int k = 0; k < N; ++k)
+            if (k != j)
+              (*this)(i, k) -= factor * (*this)(j, k);
+        }
+      for (unsigned int i = 0; i < N; ++i)
+        {
+          (*this)(i, j) *= hr;
+          (*this)(j, i) *= -hr;
+        }
+      (*this)(j, j) = hr;
+    }
+
+  // column interchange
+  std::vector<value_type> hv(N);
+  for (unsigned int l = 0; l < n_lanes; ++l)
+    for (unsigned int i = 0; i < N; ++i)
+      {
+        for (unsigned int k = 0; k < N; ++k)
+          hv[p(l, k)] = (*this)(i, k)[l];
+        for (unsigned int k = 0; k < N; ++k)
+          (*this)(i, k)[l] = hv[k];
+      }
+}
+
+
+
+template <typename VectorizedArrayType>
+void
+BatchedFullMatrix<VectorizedArrayType>::vmult(
+  AlignedVector<VectorizedArrayType>       &dst,
+  const AlignedVector<VectorizedArrayType> &src) const
+{
+  AssertDimension(dst.size(), m());
+  AssertDimension(src.size(), n());
+
+  for (unsigned int i = 0; i < m(); ++i)
+    {
+      const VectorizedArrayType *row = &(*this)(i, 0);
+
+      VectorizedArrayType sum = 0.;
+      for (unsigned int j = 0; j < n(); ++j)
+        sum += row[j] * src[j];
+      dst[i] = sum;
+    }
+}
+
+
+
+template <typename VectorizedArrayType>
+template <typename number>
+void
+BatchedFullMatrix<VectorizedArrayType>::insert_lane(
+  const unsigned int        lane,
+  const FullMatrix<number> &matrix)
+{
+  AssertIndexRange(lane, VectorizedArrayType::size());
+  AssertDimension(matrix.m(), m());
+  AssertDimension(matrix.n(), n());
+
+  for (unsigned int i = 0; i < m(); ++i)
+    for (unsigned int j = 0; j < n(); ++j)
+      (*this)(i, j)[lane] = matrix(i, j);
+}
+
+
+
+template <typename VectorizedArrayType>
+template <typename number>
+void
+BatchedFullMatrix<VectorizedArrayType>::extract_lane(
+  const unsigned int  lane,
+  FullMatrix<number> &matrix) const
+{
+  AssertIndexRange(lane, VectorizedArrayType::size());
+
+  if (matrix.m() != m() || matrix.n() != n())
+    matrix.reinit(m(), n());
+
+  for (unsigned int i = 0; i < m(); ++i)
+    for (unsigned int j = 0; j < n(); ++j)
+      matrix(i, j) = (*this)(i, j)[lane];
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
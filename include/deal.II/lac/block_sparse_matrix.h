@@ -215,6 +215,11 @@ public:
   /**
    * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
    * matrix.
+   *
+   * The products of all blocks run in a single parallel loop over the rows
+   * of the whole matrix. On each range of rows, the blocks of a block row
+   * are applied one after the other, so that matrices with many small
+   * blocks do not start a separate parallel loop for each of them.
    */
   template <typename block_number>
   void
@@ -392,17 +397,6 @@ BlockSparseMatrix<number>::operator=(const double d)
 
 
 
-template <typename number>
-template <typename block_number>
-inline void
-BlockSparseMatrix<number>::vmult(BlockVector<block_number>       &dst,
-                                 const BlockVector<block_number> &src) const
-{
-  BaseClass::vmult_block_block(dst, src);
-}
-
-
-
 template <typename number>
 template <typename block_number, typename nonblock_number>
 inline void
@@ -19,8 +19,10 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/lac/block_sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix.templates.h>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -196,6 +198,56 @@ BlockSparseMatrix<number>::print_formatted(std::ostream      &out,
 
 
 
+template <typename number>
+template <typename block_number>
+void
+BlockSparseMatrix<number>::vmult(BlockVector<block_number>       &dst,
+                                 const BlockVector<block_number> &src) const
+{
+  Assert(dst.n_blocks() == this->n_block_rows(),
+         ExcDimensionMismatch(dst.n_blocks(), this->n_block_rows()));
+  Assert(src.n_blocks() == this->n_block_cols(),
+         ExcDimensionMismatch(src.n_blocks(), this->n_block_cols()));
+  Assert(!PointerComparison::equal(&src, &dst),
+         typename SparseMatrix<number>::ExcSourceEqualsDestination());
+
+  const BlockIndices &row_indices = this->get_row_indices();
+
+  // split the global rows into ranges, which may extend over several block
+  // rows, and apply all blocks of a block row to the part of a range within
+  // that block row while the entries of dst are still in cache
+  parallel::apply_to_subranges(
+    size_type(0),
+    row_indices.total_size(),
+    [&](const size_type begin, const size_type end) {
+      size_type row = begin;
+      while (row < end)
+        {
+          const std::pair<unsigned int, size_type> block_and_index =
+            row_indices.global_to_local(row);
+          const unsigned int block_row = block_and_index.first;
+          const size_type    local_begin = block_and_index.second;
+          const size_type    local_end =
+            std::min(row_indices.block_size(block_row),
+                     local_begin + (end - row));
+
+          for (unsigned int block_col = 0; block_col < this->n_block_cols();
+               ++block_col)
+            this->block(block_row, block_col)
+              .vmult_on_subrange(local_begin,
+                                 local_end,
+                                 dst.block(block_row),
+                                 src.block(block_col),
+                                 block_col > 0);
+
+          row += local_end - local_begin;
+        }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+}
+
+
+
 template <typename number>
 std::size_t
 BlockSparseMatrix<number>::memory_consumption() const
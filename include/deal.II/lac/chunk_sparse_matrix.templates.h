@@ -31,6 +31,7 @@
 #include <iomanip>
 #include <numeric>
 #include <ostream>
+#include <type_traits>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -78,6 +79,40 @@ namespace internal
 
 
 
+    /**
+     * Like the previous function, but for a chunk size known at compile
+     * time. This allows the compiler to completely unroll the loops and
+     * vectorize the small dense matrix-vector products, which is used for
+     * the chunk sizes of vector-valued problems with two to four components.
+     */
+    template <int chunk_size,
+              typename MatrixIterator,
+              typename SrcIterator,
+              typename DstIterator>
+    inline void
+    chunk_vmult_add(const std::integral_constant<int, chunk_size>,
+                    const MatrixIterator matrix,
+                    const SrcIterator    src,
+                    DstIterator          dst)
+    {
+      typename std::iterator_traits<DstIterator>::value_type
+        src_values[chunk_size];
+      for (int j = 0; j < chunk_size; ++j)
+        src_values[j] = src[j];
+
+      for (int i = 0; i < chunk_size; ++i)
+        {
+          typename std::iterator_traits<DstIterator>::value_type sum = 0;
+
+          for (int j = 0; j < chunk_size; ++j)
+            sum += matrix[i * chunk_size + j] * src_values[j];
+
+          dst[i] += sum;
+        }
+    }
+
+
+
     /**
      * Like the previous function, but subtract. We need this for computing
      * the residual.
@@ -203,30 +238,51 @@ namespace internal
       const number *val_ptr =
         &values[rowstart[begin_row] * chunk_size * chunk_size];
       const size_type *colnum_ptr = &colnums[rowstart[begin_row]];
-      for (unsigned int chunk_row = begin_row; chunk_row < last_regular_row;
-           ++chunk_row)
-        {
-          const number *const val_end_of_row =
-            &values[rowstart[chunk_row + 1] * chunk_size * chunk_size];
-          while (val_ptr != val_end_of_row)
-            {
-              if (*colnum_ptr != irregular_col)
-                chunk_vmult_add(chunk_size,
-                                val_ptr,
-                                src.begin() + *colnum_ptr * chunk_size,
-                                dst_ptr);
-              else
-                // we're at a chunk column that has padding
-                for (size_type r = 0; r < chunk_size; ++r)
-                  for (size_type c = 0; c < n_filled_last_cols; ++c)
-                    dst_ptr[r] += (val_ptr[r * chunk_size + c] *
-                                   src(*colnum_ptr * chunk_size + c));
 
-              ++colnum_ptr;
-              val_ptr += chunk_size * chunk_size;
-            }
+      // the chunk rows without padding. the argument is either the chunk
+      // size or, for the small chunk sizes of vector-valued problems, a
+      // compile-time constant that selects the unrolled kernel
+      const auto vmult_add_regular_rows = [&](const auto chunk_size_kernel) {
+        for (unsigned int chunk_row = begin_row; chunk_row < last_regular_row;
+             ++chunk_row)
+          {
+            const number *const val_end_of_row =
+              &values[rowstart[chunk_row + 1] * chunk_size * chunk_size];
+            while (val_ptr != val_end_of_row)
+              {
+                if (*colnum_ptr != irregular_col)
+                  chunk_vmult_add(chunk_size_kernel,
+                                  val_ptr,
+                                  src.begin() + *colnum_ptr * chunk_size,
+                                  dst_ptr);
+                else
+                  // we're at a chunk column that has padding
+                  for (size_type r = 0; r < chunk_size; ++r)
+                    for (size_type c = 0; c < n_filled_last_cols; ++c)
+                      dst_ptr[r] += (val_ptr[r * chunk_size + c] *
+                                     src(*colnum_ptr * chunk_size + c));
+
+                ++colnum_ptr;
+                val_ptr += chunk_size * chunk_size;
+              }
 
-          dst_ptr += chunk_size;
+            dst_ptr += chunk_size;
+          }
+      };
+
+      switch (chunk_size)
+        {
+          case 2:
+            vmult_add_regular_rows(std::integral_constant<int, 2>());
+            break;
+          case 3:
+            vmult_add_regular_rows(std::integral_constant<int, 3>());
+            break;
+          case 4:
+            vmult_add_regular_rows(std::integral_constant<int, 4>());
+            break;
+          default:
+            vmult_add_regular_rows(chunk_size);
         }
 
       // now deal with last chunk row if necessary
@@ -18,6 +18,12 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/identity_matrix.h>
+#include <deal.II/lac/lapack_full_matrix.h>
 #include <deal.II/lac/linear_operator.h>
 #include <deal.II/lac/precondition.h>
 #include <deal.II/lac/solver.h>
@@ -27,11 +33,27 @@
 #include <deal.II/lac/solver_minres.h>
 #include <deal.II/lac/vector_memory.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
+// forward declaration
+#ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+#endif
+
 
 /**
  * @addtogroup Solvers
@@ -188,6 +210,120 @@ protected:
   AdditionalData additional_data;
 };
 
+
+/**
+ * Locally optimal block preconditioned conjugate gradient method (LOBPCG)
+ * for a few extremal eigenvalues of a symmetric eigenvalue problem.
+ *
+ * This class computes the smallest (or, see
+ * AdditionalData::largest_eigenvalues, the largest) eigenvalues $\lambda_i$
+ * and the corresponding eigenvectors $x_i$ of the generalized eigenvalue
+ * problem $A x = \lambda M x$ with a symmetric matrix $A$ and a symmetric
+ * positive definite matrix $M$, using the method of Knyazev
+ * (@cite Knyazev2001). The number of computed eigenpairs is the number of
+ * start vectors passed to solve(). In each iteration, the preconditioned
+ * residuals $W = P(AX - MX\Lambda)$ of the block of current approximations
+ * $X$ are computed, and the new approximations are the Ritz vectors of the
+ * space spanned by $X$, $W$, and the previous search directions.
+ *
+ * In contrast to ArpackSolver and the SLEPc wrappers, the matrices and the
+ * preconditioner only need to provide a <code>vmult(dst, src)</code>
+ * function. Matrix-free operators and multigrid preconditioners
+ * (PreconditionMG) can hence be used directly, and the vectors can be of any
+ * vector type including vectors in device memory. The products of $A$ and
+ * $M$ with $X$ and the search directions are updated by linear combinations,
+ * so that each iteration applies the preconditioner, $A$, and $M$ once to
+ * every vector of the block.
+ *
+ * The Rayleigh-Ritz procedure only needs the Gram matrices $S^T A S$ and
+ * $S^T M S$ of the basis $S$ of the search space. The basis is
+ * orthonormalized with respect to $M$ within this small dense problem,
+ * discarding directions that are numerically linearly dependent, which
+ * avoids the breakdown of the original method once the residuals become
+ * small.
+ *
+ * <h3>Optimized operations for LinearAlgebra::distributed::Vector</h3>
+ *
+ * If the `VectorType` is LinearAlgebra::distributed::Vector on the host, all
+ * entries of the two Gram matrices are computed in one sweep over the
+ * vectors and summed over all MPI processes in a single global reduction, as
+ * are the norms of all residuals. The linear combinations of the blocks of
+ * vectors are computed in one sweep as well. Other vector types use the
+ * generic vector interface with one inner product per entry of the Gram
+ * matrices.
+ *
+ * The iteration stops when the largest $l_2$ norm of the residuals
+ * $A x_i - \lambda_i M x_i$ of the $M$-normalized approximations falls
+ * below the tolerance of the SolverControl object.
+ */
+template <typename VectorType = Vector<double>>
+class EigenLOBPCG : private SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Compute the largest instead of the smallest eigenvalues.
+     */
+    bool largest_eigenvalues;
+
+    /**
+     * Constructor.
+     */
+    AdditionalData(const bool largest_eigenvalues = false)
+      : largest_eigenvalues(largest_eigenvalues)
+    {}
+  };
+
+  /**
+   * Constructor.
+   */
+  EigenLOBPCG(SolverControl            &cn,
+              VectorMemory<VectorType> &mem,
+              const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Compute the eigenpairs of the generalized eigenvalue problem
+   * $A x = \lambda M x$, using @p preconditioner as an approximation of the
+   * inverse of $A$ (or of $A$ shifted by a multiple of $M$).
+   *
+   * On input, @p eigenvectors contains linearly independent start vectors,
+   * whose number determines the number of computed eigenpairs. On output,
+   * @p eigenvalues contains the eigenvalues in ascending order (in descending
+   * order if AdditionalData::largest_eigenvalues is set), and
+   * @p eigenvectors the corresponding eigenvectors, orthonormal with respect
+   * to $M$.
+   */
+  template <typename MatrixType,
+            typename MassMatrixType,
+            typename PreconditionerType>
+  void
+  solve(const MatrixType         &A,
+        const MassMatrixType     &M,
+        const PreconditionerType &preconditioner,
+        std::vector<double>      &eigenvalues,
+        std::vector<VectorType>  &eigenvectors);
+
+  /**
+   * Same as above for the standard eigenvalue problem $A x = \lambda x$.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve(const MatrixType         &A,
+        const PreconditionerType &preconditioner,
+        std::vector<double>      &eigenvalues,
+        std::vector<VectorType>  &eigenvectors);
+
+protected:
+  /**
+   * Flags for execution.
+   */
+  AdditionalData additional_data;
+};
+
 /** @} */
 //---------------------------------------------------------------------------
 
@@ -388,6 +524,479 @@ EigenInverse<VectorType>::solve(double           &value,
   // otherwise exit as normal
 }
 
+//---------------------------------------------------------------------------
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace EigenLOBPCGImplementation
+  {
+    // Operations on blocks of vectors through the generic vector interface.
+    template <typename VectorType>
+    struct BlockOperations
+    {
+      // Compute the Gram matrices with entries a_gram(i,j) = s_i^T (A s_j)
+      // and m_gram(i,j) = s_i^T (M s_j) from the vectors s_i and their
+      // products with A and M.
+      static void
+      compute_gram_matrices(const std::vector<VectorType *> &basis,
+                            const std::vector<VectorType *> &a_basis,
+                            const std::vector<VectorType *> &m_basis,
+                            FullMatrix<double>              &a_gram,
+                            FullMatrix<double>              &m_gram)
+      {
+        const unsigned int n = basis.size();
+        a_gram.reinit(n, n);
+        m_gram.reinit(n, n);
+        for (unsigned int i = 0; i < n; ++i)
+          for (unsigned int j = i; j < n; ++j)
+            {
+              a_gram(i, j) = a_gram(j, i) = (*basis[i]) * (*a_basis[j]);
+              m_gram(i, j) = m_gram(j, i) = (*basis[i]) * (*m_basis[j]);
+            }
+      }
+
+      // Compute the residuals r_i = A x_i - lambda_i M x_i and return the
+      // largest of their l2 norms.
+      static double
+      compute_residuals(const std::vector<VectorType *> &a_x,
+                        const std::vector<VectorType *> &m_x,
+                        const std::vector<double>       &eigenvalues,
+                        const std::vector<VectorType *> &residuals)
+      {
+        double max_norm = 0.;
+        for (unsigned int i = 0; i < residuals.size(); ++i)
+          {
+            *residuals[i] = *a_x[i];
+            residuals[i]->add(-eigenvalues[i], *m_x[i]);
+            max_norm = std::max<double>(max_norm, residuals[i]->l2_norm());
+          }
+        return max_norm;
+      }
+
+      // Add the linear combinations of the vectors src_j with the
+      // coefficients in the rows first_row, first_row + 1, ... of the given
+      // matrix to the vectors dst_i, one for each column of the matrix.
+      static void
+      add_linear_combinations(const std::vector<VectorType *> &src,
+                              const FullMatrix<double>        &coefficients,
+                              const unsigned int               first_row,
+                              const std::vector<VectorType *> &dst)
+      {
+        for (unsigned int i = 0; i < dst.size(); ++i)
+          for (unsigned int j = 0; j < src.size(); ++j)
+            dst[i]->add(coefficients(first_row + j, i), *src[j]);
+      }
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::Vector, where we compute
+    // all inner products in a single sweep over the vectors followed by a
+    // single global reduction, and all linear combinations in another single
+    // sweep.
+    template <typename Number>
+    struct BlockOperations<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+    {
+      using VectorType =
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>;
+
+      // Number of vector entries processed at once, such that the entries of
+      // all vectors of the basis stay in cache while all combinations of
+      // them are formed.
+      static constexpr unsigned int chunk_size = 256;
+
+      static void
+      compute_gram_matrices(const std::vector<VectorType *> &basis,
+                            const std::vector<VectorType *> &a_basis,
+                            const std::vector<VectorType *> &m_basis,
+                            FullMatrix<double>              &a_gram,
+                            FullMatrix<double>              &m_gram)
+      {
+        const unsigned int n          = basis.size();
+        const unsigned int local_size = basis[0]->locally_owned_size();
+
+        // The upper triangles of both matrices, row by row
+        std::vector<double> sums(n * (n + 1));
+        for (unsigned int begin = 0; begin < local_size; begin += chunk_size)
+          {
+            const unsigned int end = std::min(begin + chunk_size, local_size);
+            unsigned int       index = 0;
+            for (unsigned int i = 0; i < n; ++i)
+              {
+                const Number *s_ptr = basis[i]->begin();
+                for (unsigned int j = i; j < n; ++j, index += 2)
+                  {
+                    const Number *as_ptr = a_basis[j]->begin();
+                    const Number *ms_ptr = m_basis[j]->begin();
+                    double        a_sum = 0., m_sum = 0.;
+                    DEAL_II_OPENMP_SIMD_PRAGMA
+                    for (unsigned int l = begin; l < end; ++l)
+                      {
+                        a_sum += s_ptr[l] * as_ptr[l];
+                        m_sum += s_ptr[l] * ms_ptr[l];
+                      }
+                    sums[index] += a_sum;
+                    sums[index + 1] += m_sum;
+                  }
+              }
+          }
+        Utilities::MPI::sum(ArrayView<const double>(sums),
+                            basis[0]->get_mpi_communicator(),
+                            make_array_view(sums));
+
+        a_gram.reinit(n, n);
+        m_gram.reinit(n, n);
+        unsigned int index = 0;
+        for (unsigned int i = 0; i < n; ++i)
+          for (unsigned int j = i; j < n; ++j, index += 2)
+            {
+              a_gram(i, j) = a_gram(j, i) = sums[index];
+              m_gram(i, j) = m_gram(j, i) = sums[index + 1];
+            }
+      }
+
+      static double
+      compute_residuals(const std::vector<VectorType *> &a_x,
+                        const std::vector<VectorType *> &m_x,
+                        const std::vector<double>       &eigenvalues,
+                        const std::vector<VectorType *> &residuals)
+      {
+        const unsigned int local_size = residuals[0]->locally_owned_size();
+
+        std::vector<double> norms(residuals.size());
+        for (unsigned int i = 0; i < residuals.size(); ++i)
+          {
+            const Number *ax_ptr = a_x[i]->begin();
+            const Number *mx_ptr = m_x[i]->begin();
+            Number       *r_ptr  = residuals[i]->begin();
+            const Number  lambda = eigenvalues[i];
+            double        sum    = 0.;
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int l = 0; l < local_size; ++l)
+              {
+                r_ptr[l] = ax_ptr[l] - lambda * mx_ptr[l];
+                sum += r_ptr[l] * r_ptr[l];
+              }
+            norms[i] = sum;
+          }
+        Utilities::MPI::sum(ArrayView<const double>(norms),
+                            residuals[0]->get_mpi_communicator(),
+                            make_array_view(norms));
+
+        return std::sqrt(*std::max_element(norms.begin(), norms.end()));
+      }
+
+      static void
+      add_linear_combinations(const std::vector<VectorType *> &src,
+                              const FullMatrix<double>        &coefficients,
+                              const unsigned int               first_row,
+                              const std::vector<VectorType *> &dst)
+      {
+        const unsigned int local_size = dst[0]->locally_owned_size();
+        for (unsigned int begin = 0; begin < local_size; begin += chunk_size)
+          {
+            const unsigned int end = std::min(begin + chunk_size, local_size);
+            for (unsigned int i = 0; i < dst.size(); ++i)
+              {
+                Number *d_ptr = dst[i]->begin();
+                for (unsigned int j = 0; j < src.size(); ++j)
+                  {
+                    const Number *s_ptr = src[j]->begin();
+                    const Number  factor(coefficients(first_row + j, i));
+                    DEAL_II_OPENMP_SIMD_PRAGMA
+                    for (unsigned int l = begin; l < end; ++l)
+                      d_ptr[l] += factor * s_ptr[l];
+                  }
+              }
+          }
+      }
+    };
+
+
+
+    // Rayleigh-Ritz procedure on the space spanned by the vectors s_j with
+    // the given Gram matrices. Returns the coefficients of the selected Ritz
+    // vectors in terms of the s_j (one column per Ritz vector) and the
+    // corresponding Ritz values.
+    inline void
+    rayleigh_ritz(const FullMatrix<double> &a_gram,
+                  const FullMatrix<double> &m_gram,
+                  const unsigned int        n_eigenpairs,
+                  const bool                largest_eigenvalues,
+                  FullMatrix<double>       &coefficients,
+                  std::vector<double>      &ritz_values)
+    {
+      const unsigned int n = a_gram.m();
+
+      // Scale the vectors to unit M-norm, such that the truncation below
+      // does not depend on the scaling of the individual vectors, and
+      // compute an M-orthonormal basis of their span from the eigenvalue
+      // decomposition of the scaled Gram matrix. Directions with tiny
+      // eigenvalues are numerically linearly dependent and get dropped.
+      std::vector<double> scaling(n);
+      for (unsigned int i = 0; i < n; ++i)
+        scaling[i] = m_gram(i, i) > 0. ? 1. / std::sqrt(m_gram(i, i)) : 0.;
+
+      LAPACKFullMatrix<double> scaled_m_gram(n, n);
+      for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n; ++j)
+          scaled_m_gram(i, j) = scaling[i] * m_gram(i, j) * scaling[j];
+
+      Vector<double>     m_eigenvalues;
+      FullMatrix<double> m_eigenvectors;
+      scaled_m_gram.compute_eigenvalues_symmetric(
+        -std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::max(),
+        0.,
+        m_eigenvalues,
+        m_eigenvectors);
+
+      const double tolerance = 100. * n *
+                               std::numeric_limits<double>::epsilon() *
+                               m_eigenvalues(m_eigenvalues.size() - 1);
+      std::vector<unsigned int> kept_directions;
+      for (unsigned int c = 0; c < m_eigenvalues.size(); ++c)
+        if (m_eigenvalues(c) > tolerance)
+          kept_directions.push_back(c);
+      const unsigned int n_kept = kept_directions.size();
+      AssertThrow(n_kept >= n_eigenpairs,
+                  ExcMessage("The search space of the LOBPCG method has "
+                             "become smaller than the number of requested "
+                             "eigenpairs. Make sure that the start vectors "
+                             "are linearly independent."));
+
+      FullMatrix<double> basis(n, n_kept);
+      for (unsigned int c = 0; c < n_kept; ++c)
+        {
+          const unsigned int d = kept_directions[c];
+          const double       factor = 1. / std::sqrt(m_eigenvalues(d));
+          for (unsigned int i = 0; i < n; ++i)
+            basis(i, c) = scaling[i] * m_eigenvectors(i, d) * factor;
+        }
+
+      // Project A onto the M-orthonormal basis and solve the resulting
+      // standard eigenvalue problem
+      FullMatrix<double> a_times_basis(n, n_kept), projected_a(n_kept, n_kept);
+      a_gram.mmult(a_times_basis, basis);
+      basis.Tmmult(projected_a, a_times_basis);
+
+      LAPACKFullMatrix<double> projected_matrix(n_kept, n_kept);
+      projected_matrix = projected_a;
+      Vector<double>     values;
+      FullMatrix<double> vectors;
+      projected_matrix.compute_eigenvalues_symmetric(
+        -std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::max(),
+        0.,
+        values,
+        vectors);
+      AssertDimension(values.size(), n_kept);
+
+      coefficients.reinit(n, n_eigenpairs);
+      ritz_values.resize(n_eigenpairs);
+      for (unsigned int e = 0; e < n_eigenpairs; ++e)
+        {
+          const unsigned int c = largest_eigenvalues ? n_kept - 1 - e : e;
+          ritz_values[e]       = values(c);
+          for (unsigned int i = 0; i < n; ++i)
+            {
+              double sum = 0.;
+              for (unsigned int k = 0; k < n_kept; ++k)
+                sum += basis(i, k) * vectors(k, c);
+              coefficients(i, e) = sum;
+            }
+        }
+    }
+  } // namespace EigenLOBPCGImplementation
+} // namespace internal
+
+#endif
+
+
+
+template <typename VectorType>
+EigenLOBPCG<VectorType>::EigenLOBPCG(SolverControl            &cn,
+                                     VectorMemory<VectorType> &mem,
+                                     const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+template <typename MatrixType,
+          typename MassMatrixType,
+          typename PreconditionerType>
+void
+EigenLOBPCG<VectorType>::solve(const MatrixType         &A,
+                               const MassMatrixType     &M,
+                               const PreconditionerType &preconditioner,
+                               std::vector<double>      &eigenvalues,
+                               std::vector<VectorType>  &eigenvectors)
+{
+  using Operations =
+    internal::EigenLOBPCGImplementation::BlockOperations<VectorType>;
+
+  LogStream::Prefix prefix("LOBPCG");
+
+  const unsigned int n_eigenpairs = eigenvectors.size();
+  Assert(n_eigenpairs > 0,
+         ExcMessage("At least one start vector needs to be given."));
+
+  // For the standard eigenvalue problem, the products with M are the
+  // vectors themselves.
+  constexpr bool         identity_mass = std::is_same_v<MassMatrixType,
+                                                        IdentityMatrix>;
+  constexpr unsigned int n_families    = identity_mass ? 2 : 3;
+  constexpr unsigned int m_family      = identity_mass ? 0 : 2;
+
+  // Allocate the blocks of the current approximations x, the preconditioned
+  // residuals w, the search directions p, and the next approximations and
+  // search directions, each of them in the families of the vectors
+  // themselves and their products with A and M.
+  std::vector<typename VectorMemory<VectorType>::Pointer> storage;
+  const auto allocate_blocks = [&]() {
+    std::array<std::vector<VectorType *>, 3> blocks;
+    for (unsigned int f = 0; f < n_families; ++f)
+      for (unsigned int i = 0; i < n_eigenpairs; ++i)
+        {
+          storage.emplace_back(this->memory);
+          storage.back()->reinit(eigenvectors[0]);
+          blocks[f].push_back(storage.back().get());
+        }
+    return blocks;
+  };
+  std::array<std::vector<VectorType *>, 3> x     = allocate_blocks();
+  std::array<std::vector<VectorType *>, 3> w     = allocate_blocks();
+  std::array<std::vector<VectorType *>, 3> p     = allocate_blocks();
+  std::array<std::vector<VectorType *>, 3> x_new = allocate_blocks();
+  std::array<std::vector<VectorType *>, 3> p_new = allocate_blocks();
+
+  const auto apply_operators = [&](std::array<std::vector<VectorType *>, 3>
+                                     &block) {
+    for (unsigned int i = 0; i < n_eigenpairs; ++i)
+      {
+        A.vmult(*block[1][i], *block[0][i]);
+        if constexpr (!identity_mass)
+          M.vmult(*block[2][i], *block[0][i]);
+      }
+  };
+
+  FullMatrix<double> a_gram, m_gram, coefficients;
+
+  // Rayleigh-Ritz procedure on the start vectors
+  for (unsigned int i = 0; i < n_eigenpairs; ++i)
+    *x[0][i] = eigenvectors[i];
+  apply_operators(x);
+  Operations::compute_gram_matrices(
+    x[0], x[1], x[m_family], a_gram, m_gram);
+  internal::EigenLOBPCGImplementation::rayleigh_ritz(
+    a_gram,
+    m_gram,
+    n_eigenpairs,
+    additional_data.largest_eigenvalues,
+    coefficients,
+    eigenvalues);
+  for (unsigned int f = 0; f < n_families; ++f)
+    {
+      for (VectorType *v : x_new[f])
+        *v = 0.;
+      Operations::add_linear_combinations(x[f], coefficients, 0, x_new[f]);
+      std::swap(x[f], x_new[f]);
+    }
+
+  // The residuals are stored in the vectors of the next approximations,
+  // which are not needed at this point
+  double residual =
+    Operations::compute_residuals(x[1], x[m_family], eigenvalues, x_new[0]);
+  SolverControl::State conv = this->iteration_status(0, residual, *x[0][0]);
+
+  // Main loop
+  unsigned int iter = 0;
+  while (conv == SolverControl::iterate)
+    {
+      for (unsigned int i = 0; i < n_eigenpairs; ++i)
+        preconditioner.vmult(*w[0][i], *x_new[0][i]);
+      apply_operators(w);
+
+      // The search space is spanned by x, w, and, except in the first
+      // iteration, p. The new search directions are the part of the new
+      // approximations spanned by w and p.
+      std::array<std::vector<VectorType *>, 3> basis, directions;
+      for (unsigned int f = 0; f < n_families; ++f)
+        {
+          directions[f] = w[f];
+          if (iter > 0)
+            directions[f].insert(directions[f].end(), p[f].begin(), p[f].end());
+          basis[f] = x[f];
+          basis[f].insert(basis[f].end(),
+                          directions[f].begin(),
+                          directions[f].end());
+        }
+
+      Operations::compute_gram_matrices(
+        basis[0], basis[1], basis[m_family], a_gram, m_gram);
+      internal::EigenLOBPCGImplementation::rayleigh_ritz(
+        a_gram,
+        m_gram,
+        n_eigenpairs,
+        additional_data.largest_eigenvalues,
+        coefficients,
+        eigenvalues);
+
+      for (unsigned int f = 0; f < n_families; ++f)
+        {
+          for (VectorType *v : p_new[f])
+            *v = 0.;
+          Operations::add_linear_combinations(directions[f],
+                                              coefficients,
+                                              n_eigenpairs,
+                                              p_new[f]);
+          for (unsigned int i = 0; i < n_eigenpairs; ++i)
+            *x_new[f][i] = *p_new[f][i];
+          Operations::add_linear_combinations(x[f], coefficients, 0, x_new[f]);
+          std::swap(x[f], x_new[f]);
+          std::swap(p[f], p_new[f]);
+        }
+
+      ++iter;
+      residual =
+        Operations::compute_residuals(x[1], x[m_family], eigenvalues, x_new[0]);
+      conv = this->iteration_status(iter, residual, *x[0][0]);
+    }
+
+  for (unsigned int i = 0; i < n_eigenpairs; ++i)
+    eigenvectors[i] = *x[0][i];
+
+  // in case of failure: throw exception
+  AssertThrow(conv == SolverControl::success,
+              SolverControl::NoConvergence(iter, residual));
+  // otherwise exit as normal
+}
+
+
+
+template <typename VectorType>
+template <typename MatrixType, typename PreconditionerType>
+void
+EigenLOBPCG<VectorType>::solve(const MatrixType         &A,
+                               const PreconditionerType &preconditioner,
+                               std::vector<double>      &eigenvalues,
+                               std::vector<VectorType>  &eigenvectors)
+{
+  Assert(eigenvectors.size() > 0,
+         ExcMessage("At least one start vector needs to be given."));
+  solve(A,
+        IdentityMatrix(eigenvectors[0].size()),
+        preconditioner,
+        eigenvalues,
+        eigenvectors);
+}
+
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
@@ -28,8 +28,10 @@
 
 #include <deal.II/lac/read_vector.h>
 #include <deal.II/lac/vector_operation.h>
+#include <deal.II/lac/vector_operations_internal.h>
 #include <deal.II/lac/vector_type_traits.h>
 
+#include <array>
 #include <iomanip>
 #include <memory>
 
@@ -52,6 +54,17 @@ namespace LinearAlgebra
   class ReadWriteVector;
 } // namespace LinearAlgebra
 
+namespace internal
+{
+  namespace MatrixFreeFunctions
+  {
+    namespace VectorDataExchange
+    {
+      class Base;
+    }
+  } // namespace MatrixFreeFunctions
+} // namespace internal
+
 #  ifdef DEAL_II_WITH_PETSC
 namespace PETScWrappers
 {
@@ -244,6 +257,26 @@ namespace LinearAlgebra
      *   MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
      *                       &comm_sm);
      * @endcode
+     *
+     * For vectors with `double` or `float` entries that are set up with a
+     * Utilities::MPI::Partitioner and a shared-memory communicator,
+     * update_ghost_values() and compress() with VectorOperation::add also use
+     * the shared-memory domain. Ghost values
+     * owned by processes on the same domain are then read directly from the
+     * memory of the owning process, and contributions to those entries are
+     * added directly from the memory of the other process. Only the entries
+     * associated with processes outside the shared-memory domain are sent
+     * through MPI messages. This is the same data exchange as used by
+     * MatrixFree loops with MatrixFree::AdditionalData::communicator_sm, and
+     * applies to all vectors created that way, e.g., via
+     * MatrixFree::initialize_dof_vector() or by calling reinit() with another
+     * vector. Setting up the data structures for this exchange requires
+     * communication among the processes, so it is only done in reinit() when
+     * the partitioner or the shared-memory communicator changes. Other
+     * variants of compress() use the regular MPI path. Since the processes
+     * access each other's memory, the finish stages of these operations
+     * synchronize all processes of the shared-memory communicator before
+     * returning.
      */
     template <typename Number, typename MemorySpace = MemorySpace::Host>
     class Vector : public ::dealii::ReadVector<Number>, public Subscriptor
@@ -619,6 +652,26 @@ namespace LinearAlgebra
       void
       compress_finish(VectorOperation::values operation);
 
+      /**
+       * Select whether compress() with VectorOperation::add sends the
+       * contributions in the ghost entries to their owners in single
+       * precision. This halves the volume of the messages at the cost of
+       * rounding each contribution to the accuracy of `float`, which is
+       * acceptable where the vector only needs to be accurate to that level,
+       * for example for residuals that are restricted to a coarser multigrid
+       * level or for intermediate iterates of a smoother. The other
+       * operations of compress() and update_ghost_values() are not affected.
+       *
+       * The setting only has an effect for vectors of type `double` in
+       * MemorySpace::Host whose ghost entries are exchanged by MPI, not within
+       * a shared-memory domain. Since the sending and the receiving process
+       * have to agree on the format of the messages, all processes have to
+       * select the same setting. It is kept by reinit() and copied by the copy
+       * constructor and the assignment operators.
+       */
+      void
+      set_single_precision_compress(const bool single_precision);
+
       /**
        * Initiates communication for the @p update_ghost_values() function
        * with non-blocking communication. This function does not wait for the
@@ -891,6 +944,86 @@ namespace LinearAlgebra
                   const Vector<Number, MemorySpace> &V,
                   const Vector<Number, MemorySpace> &W);
 
+      /**
+       * Run a user-defined operation on the locally owned range of this
+       * vector (and other vectors with the same layout) in a single sweep
+       * through memory. This allows to merge several vector updates, e.g. in
+       * iterative solvers, that would otherwise each read and write the full
+       * vectors. The @p operation is called as `operation(begin, end)` for
+       * contiguous subranges of local indices that together cover the range
+       * `[0, locally_owned_size())`, possibly in parallel from several
+       * threads. A typical use is
+       * @code
+       *   Number *x_ptr = x.begin();
+       *   Number *r_ptr = r.begin();
+       *   const Number *p_ptr = p.begin();
+       *   const Number *v_ptr = v.begin();
+       *   x.fused_operation([&](const unsigned int begin,
+       *                         const unsigned int end) {
+       *     DEAL_II_OPENMP_SIMD_PRAGMA
+       *     for (unsigned int i = begin; i < end; ++i)
+       *       {
+       *         x_ptr[i] += alpha * p_ptr[i];
+       *         r_ptr[i] -= alpha * v_ptr[i];
+       *       }
+       *   });
+       * @endcode
+       *
+       * The subranges and their assignment to threads are the same as the
+       * ones used by the other vector operations of this class, such that
+       * the operation accesses memory that is likely placed close to the
+       * respective threads. Since the operation is only applied to the
+       * locally owned range, the ghost values of vectors modified by it are
+       * not updated. Call update_ghost_values() or zero_out_ghost_values()
+       * on those vectors afterwards if they are in ghosted state.
+       *
+       * This function is only available for vectors in
+       * MemorySpace::Host.
+       */
+      template <typename Operation>
+      void
+      fused_operation(const Operation &operation) const;
+
+      /**
+       * Like fused_operation(), but the @p operation additionally computes
+       * @p n_sums partial sums over the given subrange, e.g. for inner
+       * products or norms, and returns them as a `std::array<Number,
+       * n_sums>`. This function adds the partial sums of all subranges and
+       * then over all MPI processes with a single global reduction, and
+       * returns the result. For example, the following code computes
+       * $x = x + \alpha p$, $r = r - \alpha v$, and returns the square of
+       * the norm of the updated $r$ in the first entry as well as the inner
+       * product $(r,z)$ in the second entry:
+       * @code
+       *   const std::array<Number, 2> sums =
+       *     x.fused_reduction<2>([&](const unsigned int begin,
+       *                              const unsigned int end) {
+       *       std::array<Number, 2> local_sums = {};
+       *       for (unsigned int i = begin; i < end; ++i)
+       *         {
+       *           x_ptr[i] += alpha * p_ptr[i];
+       *           r_ptr[i] -= alpha * v_ptr[i];
+       *           local_sums[0] += r_ptr[i] * r_ptr[i];
+       *           local_sums[1] += r_ptr[i] * z_ptr[i];
+       *         }
+       *       return local_sums;
+       *     });
+       * @endcode
+       * For complex-valued vectors, the operation itself is responsible for
+       * taking the complex conjugate where needed. Note that a loop
+       * accumulating sums must not be annotated with
+       * `DEAL_II_OPENMP_SIMD_PRAGMA`, which does not declare the reduction.
+       *
+       * The result only depends on the number of threads and MPI processes,
+       * not on the scheduling of the threads.
+       *
+       * This function is only available for vectors in
+       * MemorySpace::Host.
+       */
+      template <std::size_t n_sums, typename Operation>
+      std::array<Number, n_sums>
+      fused_reduction(const Operation &operation) const;
+
       /**
        * Return the global size of the vector, equal to the sum of the number of
        * locally owned indices among all processors.
@@ -1364,6 +1497,13 @@ namespace LinearAlgebra
                         const Vector<Number, MemorySpace> &V,
                         const Vector<Number, MemorySpace> &W);
 
+      /**
+       * Sum the given values over all MPI processes of the communicator of
+       * this vector. Used by fused_reduction().
+       */
+      void
+      sum_over_processes(const ArrayView<Number> &values) const;
+
       /**
        * Shared pointer to store the parallel partitioning information. This
        * information can be shared between several vectors that have the same
@@ -1404,6 +1544,13 @@ namespace LinearAlgebra
        */
       mutable bool vector_is_ghosted;
 
+      /**
+       * Whether compress() with VectorOperation::add sends the ghost
+       * contributions in single precision, see
+       * set_single_precision_compress().
+       */
+      bool single_precision_compress;
+
 #ifdef DEAL_II_WITH_MPI
       /**
        * A vector that collects all requests from compress() operations.
@@ -1415,6 +1562,14 @@ namespace LinearAlgebra
        */
       std::vector<MPI_Request> compress_requests;
 
+      /**
+       * The ghost contributions sent and the contributions received in
+       * compress() with VectorOperation::add when the vector is set up to
+       * compress in single precision.
+       */
+      std::vector<float> compress_send_buffer;
+      std::vector<float> compress_receive_buffer;
+
       /**
        * A vector that collects all requests from update_ghost_values()
        * operations. This class uses persistent MPI communicators.
@@ -1436,6 +1591,26 @@ namespace LinearAlgebra
        */
       MPI_Comm comm_sm;
 
+      /**
+       * The object performing the data exchange of ghost values within the
+       * shared-memory domain given by `comm_sm`. Only set up for vectors in
+       * MemorySpace::Host with entries of type `double` or `float` when a
+       * shared-memory communicator other than MPI_COMM_SELF is given,
+       * otherwise this pointer is empty and the data exchange is performed by
+       * the partitioner.
+       */
+      std::shared_ptr<
+        const ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::Base>
+        shared_memory_exchanger;
+
+      /**
+       * A helper function that sets up or resets the shared_memory_exchanger
+       * field for the current partitioner and `comm_sm`. Used in reinit()
+       * functions.
+       */
+      void
+      setup_shared_memory_exchanger(const bool partitioner_changed);
+
       /**
        * A helper function that clears the compress_requests and
        * update_ghost_values_requests field. Used in reinit() functions.
@@ -1774,6 +1949,49 @@ namespace LinearAlgebra
       vector_is_ghosted = ghosted;
     }
 
+
+
+    template <typename Number, typename MemorySpace>
+    template <typename Operation>
+    inline void
+    Vector<Number, MemorySpace>::fused_operation(
+      const Operation &operation) const
+    {
+      static_assert(std::is_same_v<MemorySpace, ::dealii::MemorySpace::Host>,
+                    "This function is only implemented for the Host memory "
+                    "space.");
+
+      dealii::internal::VectorOperations::parallel_for(
+        operation,
+        0,
+        partitioner->locally_owned_size(),
+        thread_loop_partitioner);
+    }
+
+
+
+    template <typename Number, typename MemorySpace>
+    template <std::size_t n_sums, typename Operation>
+    inline std::array<Number, n_sums>
+    Vector<Number, MemorySpace>::fused_reduction(
+      const Operation &operation) const
+    {
+      static_assert(std::is_same_v<MemorySpace, ::dealii::MemorySpace::Host>,
+                    "This function is only implemented for the Host memory "
+                    "space.");
+
+      std::array<Number, n_sums> sums =
+        dealii::internal::VectorOperations::
+          parallel_sum_over_subranges<Number, n_sums>(
+            operation,
+            0,
+            partitioner->locally_owned_size(),
+            thread_loop_partitioner);
+      if (partitioner->n_mpi_processes() > 1)
+        sum_over_processes(make_array_view(sums));
+      return sums;
+    }
+
 #endif
 
   } // namespace distributed
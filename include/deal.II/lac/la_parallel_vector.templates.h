@@ -27,6 +27,8 @@
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_operations_internal.h>
 
+#include <deal.II/matrix_free/vector_data_exchange.h>
+
 #include <memory>
 
 
@@ -79,6 +81,15 @@ namespace LinearAlgebra
 
 
 
+      // The data exchange within a shared-memory domain as implemented by
+      // internal::MatrixFreeFunctions::VectorDataExchange::Full is only
+      // available for these number types.
+      template <typename Number>
+      constexpr bool shared_memory_exchange_is_supported =
+        std::is_same_v<Number, double> || std::is_same_v<Number, float>;
+
+
+
       // Resize the underlying array on the host or on the device
       template <typename Number, typename MemorySpaceType>
       struct la_parallel_vector_templates_functions
@@ -527,6 +538,35 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::setup_shared_memory_exchanger(
+      const bool partitioner_changed)
+    {
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                    internal::shared_memory_exchange_is_supported<Number>)
+        {
+#ifdef DEAL_II_WITH_MPI
+          if (comm_sm != MPI_COMM_SELF)
+            {
+              // setting up the exchanger needs communication, so only do it
+              // if something has changed
+              if (partitioner_changed ||
+                  shared_memory_exchanger.get() == nullptr)
+                shared_memory_exchanger = std::make_shared<
+                  ::dealii::internal::MatrixFreeFunctions::VectorDataExchange::
+                    Full>(partitioner, comm_sm);
+              return;
+            }
+#endif
+        }
+      (void)partitioner_changed;
+
+      shared_memory_exchanger.reset();
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::resize_val(const size_type new_alloc_size,
@@ -561,6 +601,7 @@ namespace LinearAlgebra
 
       // set partitioner to serial version
       partitioner = std::make_shared<Utilities::MPI::Partitioner>(size);
+      shared_memory_exchanger.reset();
 
       // set entries to zero if so requested
       if (omit_zeroing_entries == false)
@@ -594,6 +635,7 @@ namespace LinearAlgebra
       partitioner = std::make_shared<Utilities::MPI::Partitioner>(local_size,
                                                                   ghost_size,
                                                                   comm);
+      setup_shared_memory_exchanger(true);
 
       this->operator=(Number());
     }
@@ -610,19 +652,21 @@ namespace LinearAlgebra
       clear_mpi_requests();
       Assert(v.partitioner.get() != nullptr, ExcNotInitialized());
 
-      this->comm_sm = v.comm_sm;
+      const bool comm_sm_changed = this->comm_sm != v.comm_sm;
+      this->comm_sm              = v.comm_sm;
 
       // check whether the partitioners are
       // different (check only if the are allocated
       // differently, not if the actual data is
       // different)
-      if (partitioner.get() != v.partitioner.get())
+      if (partitioner.get() != v.partitioner.get() || comm_sm_changed)
         {
           partitioner = v.partitioner;
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
           resize_val(new_allocated_size, this->comm_sm);
         }
+      shared_memory_exchanger = v.shared_memory_exchanger;
 
       if (omit_zeroing_entries == false)
         this->operator=(Number());
@@ -677,16 +721,21 @@ namespace LinearAlgebra
     {
       clear_mpi_requests();
 
+      const bool partitioner_changed =
+        partitioner.get() != partitioner_in.get() || this->comm_sm != comm_sm;
+
       this->comm_sm = comm_sm;
 
-      // set vector size and allocate memory
-      if (partitioner.get() != partitioner_in.get())
+      // set vector size and allocate memory, which also needs to be done if
+      // only the shared-memory communicator has changed
+      if (partitioner_changed)
         {
           partitioner = partitioner_in;
           const size_type new_allocated_size =
             partitioner->locally_owned_size() + partitioner->n_ghost_indices();
           resize_val(new_allocated_size, comm_sm);
         }
+      setup_shared_memory_exchanger(partitioner_changed);
 
       // initialize to zero
       *this = Number();
@@ -720,6 +769,7 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::Vector()
       : partitioner(std::make_shared<Utilities::MPI::Partitioner>())
       , allocated_size(0)
+      , single_precision_compress(false)
       , comm_sm(MPI_COMM_SELF)
     {
       reinit(0);
@@ -733,6 +783,7 @@ namespace LinearAlgebra
       : Subscriptor()
       , allocated_size(0)
       , vector_is_ghosted(false)
+      , single_precision_compress(v.single_precision_compress)
       , comm_sm(MPI_COMM_SELF)
     {
       reinit(v, true);
@@ -761,6 +812,7 @@ namespace LinearAlgebra
                                             const MPI_Comm  communicator)
       : allocated_size(0)
       , vector_is_ghosted(false)
+      , single_precision_compress(false)
       , comm_sm(MPI_COMM_SELF)
     {
       reinit(local_range, ghost_indices, communicator);
@@ -773,6 +825,7 @@ namespace LinearAlgebra
                                             const MPI_Comm  communicator)
       : allocated_size(0)
       , vector_is_ghosted(false)
+      , single_precision_compress(false)
       , comm_sm(MPI_COMM_SELF)
     {
       reinit(local_range, communicator);
@@ -784,6 +837,7 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::Vector(const size_type size)
       : allocated_size(0)
       , vector_is_ghosted(false)
+      , single_precision_compress(false)
       , comm_sm(MPI_COMM_SELF)
     {
       reinit(size, false);
@@ -796,6 +850,7 @@ namespace LinearAlgebra
       const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
       : allocated_size(0)
       , vector_is_ghosted(false)
+      , single_precision_compress(false)
       , comm_sm(MPI_COMM_SELF)
     {
       reinit(partitioner);
@@ -843,7 +898,8 @@ namespace LinearAlgebra
       // the same local range but different ghost layout
       bool must_update_ghost_values = c.vector_is_ghosted;
 
-      this->comm_sm = c.comm_sm;
+      this->comm_sm                   = c.comm_sm;
+      this->single_precision_compress = c.single_precision_compress;
 
       // check whether the two vectors use the same parallel partitioner. if
       // not, check if all local ranges are the same (that way, we can
@@ -1016,6 +1072,50 @@ namespace LinearAlgebra
             }
         }
 
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                    internal::shared_memory_exchange_is_supported<Number>)
+        if (shared_memory_exchanger.get() != nullptr &&
+            operation == VectorOperation::add)
+          {
+            shared_memory_exchanger->import_from_ghosted_array_start(
+              operation,
+              communication_channel,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(),
+                                shared_memory_exchanger->n_import_indices()),
+              compress_requests);
+            return;
+          }
+
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                    std::is_same_v<Number, double>)
+        if (single_precision_compress && operation == VectorOperation::add)
+          {
+            // round the ghost contributions to single precision and let the
+            // partitioner send them from a separate buffer; they are added
+            // to the locally owned entries in compress_finish()
+            compress_send_buffer.assign(data.values.data() +
+                                          partitioner->locally_owned_size(),
+                                        data.values.data() +
+                                          partitioner->locally_owned_size() +
+                                          partitioner->n_ghost_indices());
+            compress_receive_buffer.resize(partitioner->n_import_indices());
+            partitioner->import_from_ghosted_array_start(
+              operation,
+              communication_channel,
+              ArrayView<float>(compress_send_buffer.data(),
+                               compress_send_buffer.size()),
+              ArrayView<float>(compress_receive_buffer.data(),
+                               compress_receive_buffer.size()),
+              compress_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, dealii::MemorySpace::Default>)
         {
@@ -1078,6 +1178,62 @@ namespace LinearAlgebra
 
       // make this function thread safe
       std::lock_guard<std::mutex> lock(mutex);
+
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                    internal::shared_memory_exchange_is_supported<Number>)
+        if (shared_memory_exchanger.get() != nullptr &&
+            operation == VectorOperation::add)
+          {
+            shared_memory_exchanger->import_from_ghosted_array_finish(
+              operation,
+              ArrayView<Number>(data.values.data(),
+                                partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<const Number>(
+                import_data.values.data(),
+                shared_memory_exchanger->n_import_indices()),
+              compress_requests);
+            compress_requests.clear();
+
+            // the processes on the shared-memory domain add the ghost values
+            // of this process and then set them to zero, so wait for them to
+            // complete before returning. there is nothing to wait for if this
+            // process is alone on its shared-memory domain
+            if (Utilities::MPI::n_mpi_processes(comm_sm) > 1)
+              {
+                const int ierr = MPI_Barrier(comm_sm);
+                AssertThrowMPI(ierr);
+              }
+            return;
+          }
+
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                    std::is_same_v<Number, double>)
+        if (single_precision_compress && operation == VectorOperation::add)
+          {
+            const int ierr = MPI_Waitall(compress_requests.size(),
+                                         compress_requests.data(),
+                                         MPI_STATUSES_IGNORE);
+            AssertThrowMPI(ierr);
+            compress_requests.clear();
+
+            Number      *values        = data.values.data();
+            const float *read_position = compress_receive_buffer.data();
+            for (const auto &import_range : partitioner->import_indices())
+              for (unsigned int j = import_range.first; j < import_range.second;
+                   ++j)
+                values[j] += *read_position++;
+
+            std::fill(values + partitioner->locally_owned_size(),
+                      values + partitioner->locally_owned_size() +
+                        partitioner->n_ghost_indices(),
+                      Number());
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1130,6 +1286,16 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::set_single_precision_compress(
+      const bool single_precision)
+    {
+      single_precision_compress = single_precision;
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     void
     Vector<Number, MemorySpaceType>::update_ghost_values_start(
@@ -1176,6 +1342,24 @@ namespace LinearAlgebra
             }
         }
 
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                    internal::shared_memory_exchange_is_supported<Number>)
+        if (shared_memory_exchanger.get() != nullptr)
+          {
+            shared_memory_exchanger->export_to_ghosted_array_start(
+              communication_channel,
+              ArrayView<const Number>(data.values.data(),
+                                      partitioner->locally_owned_size()),
+              data.values_sm,
+              ArrayView<Number>(data.values.data() +
+                                  partitioner->locally_owned_size(),
+                                partitioner->n_ghost_indices()),
+              ArrayView<Number>(import_data.values.data(),
+                                shared_memory_exchanger->n_import_indices()),
+              update_ghost_values_requests);
+            return;
+          }
+
 #  if !defined(DEAL_II_MPI_WITH_DEVICE_SUPPORT)
       if (std::is_same_v<MemorySpaceType, MemorySpace::Default>)
         {
@@ -1233,6 +1417,40 @@ namespace LinearAlgebra
     Vector<Number, MemorySpaceType>::update_ghost_values_finish() const
     {
 #ifdef DEAL_II_WITH_MPI
+      if constexpr (std::is_same_v<MemorySpaceType, MemorySpace::Host> &&
+                    internal::shared_memory_exchange_is_supported<Number>)
+        if (shared_memory_exchanger.get() != nullptr)
+          {
+            if (update_ghost_values_requests.size() > 0)
+              {
+                // make this function thread safe
+                std::lock_guard<std::mutex> lock(mutex);
+
+                shared_memory_exchanger->export_to_ghosted_array_finish(
+                  ArrayView<const Number>(data.values.data(),
+                                          partitioner->locally_owned_size()),
+                  data.values_sm,
+                  ArrayView<Number>(data.values.data() +
+                                      partitioner->locally_owned_size(),
+                                    partitioner->n_ghost_indices()),
+                  update_ghost_values_requests);
+                update_ghost_values_requests.clear();
+              }
+
+            // the processes on the shared-memory domain read directly from
+            // the locally owned range of this process, so we must not return
+            // (and possibly modify the vector) before they are done. this is
+            // only necessary if there are other processes on the domain
+            if (Utilities::MPI::n_mpi_processes(comm_sm) > 1)
+              {
+                const int ierr = MPI_Barrier(comm_sm);
+                AssertThrowMPI(ierr);
+              }
+
+            vector_is_ghosted = true;
+            return;
+          }
+
       // wait for both sends and receives to complete, even though only
       // receives are really necessary. this gives (much) better performance
       AssertDimension(partitioner->ghost_targets().size() +
@@ -1411,12 +1629,15 @@ namespace LinearAlgebra
       std::swap(comm_sm, v.comm_sm);
 #endif
 
+      std::swap(shared_memory_exchanger, v.shared_memory_exchanger);
+
       std::swap(partitioner, v.partitioner);
       std::swap(thread_loop_partitioner, v.thread_loop_partitioner);
       std::swap(allocated_size, v.allocated_size);
       std::swap(data, v.data);
       std::swap(import_data, v.import_data);
       std::swap(vector_is_ghosted, v.vector_is_ghosted);
+      std::swap(single_precision_compress, v.single_precision_compress);
     }
 
 
@@ -2005,6 +2226,16 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpaceType>
+    void
+    Vector<Number, MemorySpaceType>::sum_over_processes(
+      const ArrayView<Number> &values) const
+    {
+      Utilities::MPI::sum(values, partitioner->get_mpi_communicator(), values);
+    }
+
+
+
     template <typename Number, typename MemorySpaceType>
     inline bool
     Vector<Number, MemorySpaceType>::partitioners_are_compatible(
@@ -0,0 +1,576 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_linear_operator_expression_h
+#define dealii_linear_operator_expression_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/lac/linear_operator.h>
+
+#include <memory>
+#include <type_traits>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * A namespace for linear operators whose composition is resolved at compile
+ * time.
+ *
+ * A LinearOperator stores its operations as <code>std::function</code>
+ * objects, so that each level of a composite operator such as
+ * <code>A * B + C</code> involves an indirect call, and a product of two
+ * operators requests an intermediate vector from a GrowingVectorMemory on
+ * every application. The classes in this namespace instead encode the
+ * structure of the composite operator in its type: the operators
+ * <code>+</code>, <code>-</code> and <code>*</code> applied to them return
+ * new expression objects, all calls are resolved statically, and the
+ * intermediate vectors of products and scaled operators are owned by the
+ * expression object, allocated on first use and reused afterwards. This
+ * makes them suitable for operators applied many times, e.g., inside the
+ * inner solver of a nested solver:
+ * @code
+ *   const auto A = LinearOperatorExpressions::make_leaf(matrix_a);
+ *   const auto B = LinearOperatorExpressions::make_leaf(matrix_b);
+ *   const auto C = LinearOperatorExpressions::make_leaf(matrix_c);
+ *
+ *   const auto op = A * B + 2. * C;
+ *   op.vmult(dst, src); // no allocation after the first call
+ *
+ *   solver.solve(op, x, b, preconditioner);
+ * @endcode
+ * Each expression can be converted to a LinearOperator, which keeps a copy
+ * of the expression and with it the preallocated vectors, to be combined
+ * with the remaining LinearOperator infrastructure.
+ *
+ * The leaves of an expression store references to the matrices, which
+ * therefore must outlive the expression. Since the intermediate vectors are
+ * members of the expression object, a single object must not be applied
+ * from several threads concurrently.
+ *
+ * @ingroup LAOperators
+ */
+namespace LinearOperatorExpressions
+{
+  /**
+   * The common base class of all expressions, used to select the overloaded
+   * operators of this namespace.
+   */
+  class ExpressionBase
+  {};
+
+  /**
+   * Type trait that is true if @p T is an expression of this namespace.
+   */
+  template <typename T>
+  constexpr bool is_expression =
+    std::is_base_of_v<ExpressionBase, std::decay_t<T>>;
+
+
+
+  /**
+   * Leaf of an expression, applying a matrix (or any other object providing
+   * <code>vmult</code> and <code>Tvmult</code>). If the matrix does not
+   * provide <code>vmult_add</code> and <code>Tvmult_add</code>, these are
+   * implemented with an intermediate vector stored in this object. The
+   * vectors are set up through the same mechanism as in linear_operator().
+   */
+  template <typename Range, typename Domain, typename Matrix>
+  class Leaf : public ExpressionBase
+  {
+  public:
+    using range_type  = Range;
+    using domain_type = Domain;
+
+    /**
+     * Constructor. Stores a reference to @p matrix.
+     */
+    explicit Leaf(const Matrix &matrix)
+      : matrix(&matrix)
+    {}
+
+    void
+    vmult(Range &v, const Domain &u) const
+    {
+      matrix->vmult(v, u);
+    }
+
+    void
+    vmult_add(Range &v, const Domain &u) const
+    {
+      if constexpr (has_vmult_add)
+        matrix->vmult_add(v, u);
+      else
+        {
+          if (tmp_range.size() == 0)
+            reinit_range_vector(tmp_range, true);
+          matrix->vmult(tmp_range, u);
+          v += tmp_range;
+        }
+    }
+
+    void
+    Tvmult(Domain &v, const Range &u) const
+    {
+      matrix->Tvmult(v, u);
+    }
+
+    void
+    Tvmult_add(Domain &v, const Range &u) const
+    {
+      if constexpr (has_vmult_add)
+        matrix->Tvmult_add(v, u);
+      else
+        {
+          if (tmp_domain.size() == 0)
+            reinit_domain_vector(tmp_domain, true);
+          matrix->Tvmult(tmp_domain, u);
+          v += tmp_domain;
+        }
+    }
+
+    void
+    reinit_range_vector(Range &v, const bool omit_zeroing_entries) const
+    {
+      internal::LinearOperatorImplementation::ReinitHelper<
+        Range>::reinit_range_vector(*matrix, v, omit_zeroing_entries);
+    }
+
+    void
+    reinit_domain_vector(Domain &v, const bool omit_zeroing_entries) const
+    {
+      internal::LinearOperatorImplementation::ReinitHelper<
+        Domain>::reinit_domain_vector(*matrix, v, omit_zeroing_entries);
+    }
+
+  private:
+    static constexpr bool has_vmult_add =
+      internal::LinearOperatorImplementation::
+        has_vmult_add_and_Tvmult_add<Range, Domain, Matrix>::type::value;
+
+    /**
+     * The matrix.
+     */
+    const Matrix *matrix;
+
+    /**
+     * Intermediate vectors, only used if the matrix does not provide
+     * <code>vmult_add</code> and <code>Tvmult_add</code>.
+     */
+    mutable Range  tmp_range;
+    mutable Domain tmp_domain;
+  };
+
+
+
+  /**
+   * Expression for the sum, or the difference if @p subtract is true, of
+   * two operators with the same range and domain. No intermediate vector is
+   * needed: the first operator writes into the destination vector and the
+   * second one adds to it.
+   */
+  template <typename Left, typename Right, bool subtract>
+  class Sum : public ExpressionBase
+  {
+  public:
+    using range_type  = typename Left::range_type;
+    using domain_type = typename Left::domain_type;
+
+    static_assert(std::is_same_v<range_type, typename Right::range_type> &&
+                    std::is_same_v<domain_type, typename Right::domain_type>,
+                  "Both operators of a sum must have the same range and "
+                  "domain types.");
+
+    Sum(const Left &left, const Right &right)
+      : left(left)
+      , right(right)
+    {}
+
+    void
+    vmult(range_type &v, const domain_type &u) const
+    {
+      if constexpr (subtract)
+        {
+          right.vmult(v, u);
+          v *= -1.;
+          left.vmult_add(v, u);
+        }
+      else
+        {
+          left.vmult(v, u);
+          right.vmult_add(v, u);
+        }
+    }
+
+    void
+    vmult_add(range_type &v, const domain_type &u) const
+    {
+      if constexpr (subtract)
+        {
+          // v - R u = -(-v + R u), where the sign changes are exact
+          v *= -1.;
+          right.vmult_add(v, u);
+          v *= -1.;
+        }
+      else
+        right.vmult_add(v, u);
+      left.vmult_add(v, u);
+    }
+
+    void
+    Tvmult(domain_type &v, const range_type &u) const
+    {
+      if constexpr (subtract)
+        {
+          right.Tvmult(v, u);
+          v *= -1.;
+          left.Tvmult_add(v, u);
+        }
+      else
+        {
+          left.Tvmult(v, u);
+          right.Tvmult_add(v, u);
+        }
+    }
+
+    void
+    Tvmult_add(domain_type &v, const range_type &u) const
+    {
+      if constexpr (subtract)
+        {
+          v *= -1.;
+          right.Tvmult_add(v, u);
+          v *= -1.;
+        }
+      else
+        right.Tvmult_add(v, u);
+      left.Tvmult_add(v, u);
+    }
+
+    void
+    reinit_range_vector(range_type &v, const bool omit_zeroing_entries) const
+    {
+      left.reinit_range_vector(v, omit_zeroing_entries);
+    }
+
+    void
+    reinit_domain_vector(domain_type &v, const bool omit_zeroing_entries) const
+    {
+      left.reinit_domain_vector(v, omit_zeroing_entries);
+    }
+
+  private:
+    Left  left;
+    Right right;
+  };
+
+
+
+  /**
+   * Expression for the composition $(L R) u = L (R u)$ of two operators.
+   * The intermediate vector $R u$ is stored in this object and set up on
+   * the first application only.
+   */
+  template <typename Left, typename Right>
+  class Product : public ExpressionBase
+  {
+  public:
+    using range_type        = typename Left::range_type;
+    using intermediate_type = typename Left::domain_type;
+    using domain_type       = typename Right::domain_type;
+
+    static_assert(
+      std::is_same_v<intermediate_type, typename Right::range_type>,
+      "The domain of the first operator of a product must match the range "
+      "of the second one.");
+
+    Product(const Left &left, const Right &right)
+      : left(left)
+      , right(right)
+    {}
+
+    void
+    vmult(range_type &v, const domain_type &u) const
+    {
+      right.vmult(intermediate(), u);
+      left.vmult(v, intermediate());
+    }
+
+    void
+    vmult_add(range_type &v, const domain_type &u) const
+    {
+      right.vmult(intermediate(), u);
+      left.vmult_add(v, intermediate());
+    }
+
+    void
+    Tvmult(domain_type &v, const range_type &u) const
+    {
+      left.Tvmult(intermediate(), u);
+      right.Tvmult(v, intermediate());
+    }
+
+    void
+    Tvmult_add(domain_type &v, const range_type &u) const
+    {
+      left.Tvmult(intermediate(), u);
+      right.Tvmult_add(v, intermediate());
+    }
+
+    void
+    reinit_range_vector(range_type &v, const bool omit_zeroing_entries) const
+    {
+      left.reinit_range_vector(v, omit_zeroing_entries);
+    }
+
+    void
+    reinit_domain_vector(domain_type &v, const bool omit_zeroing_entries) const
+    {
+      right.reinit_domain_vector(v, omit_zeroing_entries);
+    }
+
+  private:
+    /**
+     * Return the intermediate vector, setting it up on first use. The
+     * vector is the same for the application of the operator and its
+     * transpose, as both live in the domain of the first operator.
+     */
+    intermediate_type &
+    intermediate() const
+    {
+      if (tmp.size() == 0)
+        right.reinit_range_vector(tmp, true);
+      return tmp;
+    }
+
+    Left  left;
+    Right right;
+
+    mutable intermediate_type tmp;
+  };
+
+
+
+  /**
+   * Expression for an operator multiplied by a scalar. The intermediate
+   * vectors needed for the <code>vmult_add</code> variants are stored in
+   * this object.
+   */
+  template <typename Operator>
+  class Scaled : public ExpressionBase
+  {
+  public:
+    using range_type  = typename Operator::range_type;
+    using domain_type = typename Operator::domain_type;
+    using value_type  = typename range_type::value_type;
+
+    Scaled(const value_type factor, const Operator &op)
+      : factor(factor)
+      , op(op)
+    {}
+
+    void
+    vmult(range_type &v, const domain_type &u) const
+    {
+      op.vmult(v, u);
+      v *= factor;
+    }
+
+    void
+    vmult_add(range_type &v, const domain_type &u) const
+    {
+      if (tmp_range.size() == 0)
+        op.reinit_range_vector(tmp_range, true);
+      op.vmult(tmp_range, u);
+      v.add(factor, tmp_range);
+    }
+
+    void
+    Tvmult(domain_type &v, const range_type &u) const
+    {
+      op.Tvmult(v, u);
+      v *= factor;
+    }
+
+    void
+    Tvmult_add(domain_type &v, const range_type &u) const
+    {
+      if (tmp_domain.size() == 0)
+        op.reinit_domain_vector(tmp_domain, true);
+      op.Tvmult(tmp_domain, u);
+      v.add(factor, tmp_domain);
+    }
+
+    void
+    reinit_range_vector(range_type &v, const bool omit_zeroing_entries) const
+    {
+      op.reinit_range_vector(v, omit_zeroing_entries);
+    }
+
+    void
+    reinit_domain_vector(domain_type &v, const bool omit_zeroing_entries) const
+    {
+      op.reinit_domain_vector(v, omit_zeroing_entries);
+    }
+
+  private:
+    value_type factor;
+    Operator   op;
+
+    mutable range_type  tmp_range;
+    mutable domain_type tmp_domain;
+  };
+
+
+
+  /**
+   * Create the leaf of an expression from @p matrix. The arguments
+   * @p Range and @p Domain have the same meaning as for linear_operator().
+   */
+  template <typename Range = Vector<double>,
+            typename Domain = Range,
+            typename Matrix>
+  Leaf<Range, Domain, Matrix>
+  make_leaf(const Matrix &matrix)
+  {
+    return Leaf<Range, Domain, Matrix>(matrix);
+  }
+
+
+
+  /**
+   * Sum of two expressions.
+   */
+  template <typename Left,
+            typename Right,
+            typename = std::enable_if_t<is_expression<Left> &&
+                                        is_expression<Right>>>
+  Sum<Left, Right, false>
+  operator+(const Left &left, const Right &right)
+  {
+    return Sum<Left, Right, false>(left, right);
+  }
+
+
+
+  /**
+   * Difference of two expressions.
+   */
+  template <typename Left,
+            typename Right,
+            typename = std::enable_if_t<is_expression<Left> &&
+                                        is_expression<Right>>>
+  Sum<Left, Right, true>
+  operator-(const Left &left, const Right &right)
+  {
+    return Sum<Left, Right, true>(left, right);
+  }
+
+
+
+  /**
+   * Composition of two expressions.
+   */
+  template <typename Left,
+            typename Right,
+            typename = std::enable_if_t<is_expression<Left> &&
+                                        is_expression<Right>>>
+  Product<Left, Right>
+  operator*(const Left &left, const Right &right)
+  {
+    return Product<Left, Right>(left, right);
+  }
+
+
+
+  /**
+   * Multiplication of an expression by a scalar from the left.
+   */
+  template <typename Operator,
+            typename = std::enable_if_t<is_expression<Operator>>>
+  Scaled<Operator>
+  operator*(const typename Operator::range_type::value_type factor,
+            const Operator                                &op)
+  {
+    return Scaled<Operator>(factor, op);
+  }
+
+
+
+  /**
+   * Multiplication of an expression by a scalar from the right.
+   */
+  template <typename Operator,
+            typename = std::enable_if_t<is_expression<Operator>>>
+  Scaled<Operator>
+  operator*(const Operator                                &op,
+            const typename Operator::range_type::value_type factor)
+  {
+    return Scaled<Operator>(factor, op);
+  }
+
+
+
+  /**
+   * Convert the expression @p expression to a LinearOperator. The returned
+   * object shares a copy of the expression, including its intermediate
+   * vectors, between all its function objects, so that the conversion
+   * retains the allocation-free application of the operator.
+   */
+  template <typename Payload =
+              internal::LinearOperatorImplementation::EmptyPayload,
+            typename Expression,
+            typename = std::enable_if_t<is_expression<Expression>>>
+  LinearOperator<typename Expression::range_type,
+                 typename Expression::domain_type,
+                 Payload>
+  to_linear_operator(const Expression &expression)
+  {
+    using Range  = typename Expression::range_type;
+    using Domain = typename Expression::domain_type;
+
+    const auto expr = std::make_shared<const Expression>(expression);
+
+    LinearOperator<Range, Domain, Payload> return_op;
+
+    return_op.vmult = [expr](Range &v, const Domain &u) {
+      expr->vmult(v, u);
+    };
+    return_op.vmult_add = [expr](Range &v, const Domain &u) {
+      expr->vmult_add(v, u);
+    };
+    return_op.Tvmult = [expr](Domain &v, const Range &u) {
+      expr->Tvmult(v, u);
+    };
+    return_op.Tvmult_add = [expr](Domain &v, const Range &u) {
+      expr->Tvmult_add(v, u);
+    };
+    return_op.reinit_range_vector = [expr](Range     &v,
+                                           const bool omit_zeroing_entries) {
+      expr->reinit_range_vector(v, omit_zeroing_entries);
+    };
+    return_op.reinit_domain_vector = [expr](Domain    &v,
+                                            const bool omit_zeroing_entries) {
+      expr->reinit_domain_vector(v, omit_zeroing_entries);
+    };
+
+    return return_op;
+  }
+} // namespace LinearOperatorExpressions
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
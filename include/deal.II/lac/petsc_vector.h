@@ -32,6 +32,18 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declaration
+#  ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+#  endif
+
 
 /**
  * @addtogroup PETScWrappers
@@ -370,6 +382,24 @@ namespace PETScWrappers
       void
       reinit(const IndexSet &local, const MPI_Comm communicator);
 
+      /**
+       * Reinitialize the vector such that it shares the memory of the locally
+       * owned entries of the deal.II vector @p v rather than copying them.
+       * Changes of the entries of either vector are hence visible in the other
+       * one. This allows to apply PETSc preconditioners or solvers to vectors
+       * used in deal.II's own solvers without copying the data back and forth
+       * in every iteration.
+       *
+       * The present object does not take ownership of the memory of @p v.
+       * The vector @p v must hence neither be destroyed nor reinitialized
+       * while the present object is in use. The ghost entries of @p v are not
+       * part of the view, i.e., the present object is not a ghosted vector.
+       */
+      void
+      reinit_as_view(
+        LinearAlgebra::distributed::Vector<PetscScalar,
+                                           ::dealii::MemorySpace::Host> &v);
+
       /**
        * Initialize the vector given to the parallel partitioning described in
        * @p partitioner.
@@ -99,6 +99,16 @@ namespace internal
      * Estimate for the largest eigenvalue.
      */
     double max_eigenvalue_estimate;
+    /**
+     * Relative change of the estimate of the largest eigenvalue in the last
+     * iteration of the eigenvalue algorithm, as an indicator of the quality
+     * of #max_eigenvalue_estimate. A small value indicates that the
+     * estimate has settled, whereas a large value suggests to increase the
+     * number of iterations of the eigenvalue algorithm. Remains at its
+     * invalid initial value if no eigenvalue computation was performed or if
+     * the algorithm ran for less than two iterations.
+     */
+    double max_eigenvalue_relative_change;
     /**
      * Number of CG iterations performed or 0.
      */
@@ -114,6 +124,7 @@ namespace internal
     EigenvalueInformation()
       : min_eigenvalue_estimate{std::numeric_limits<double>::max()}
       , max_eigenvalue_estimate{std::numeric_limits<double>::lowest()}
+      , max_eigenvalue_relative_change{std::numeric_limits<double>::max()}
       , cg_iterations{0}
       , degree{0}
     {}
@@ -2024,6 +2035,36 @@ public:
  *
  * For details on the algorithm, see section 5.1 of @cite Varga2009.
  *
+ * <h4>Using the PreconditionChebyshev as a polynomial preconditioner</h4>
+ *
+ * Since the Chebyshev iteration with a fixed degree is a linear operation
+ * that does not compute any inner products, this class can be passed as a
+ * preconditioner to a Krylov solver such as SolverCG, with the smoothing
+ * range set to zero in order to act on the whole estimated spectrum. A
+ * higher degree reduces the number of outer iterations and hence the number
+ * of global reductions, at the price of more matrix-vector products per
+ * iteration. On large parallel machines, where the latency of the global
+ * reductions can exceed the cost of a matrix-vector product on the locally
+ * owned part of the mesh, it is therefore beneficial to trade reductions for
+ * local work.
+ *
+ * This trade-off can be automated by setting the degree to
+ * numbers::invalid_unsigned_int and
+ * PreconditionChebyshev::AdditionalData::krylov_reduction_cost to the cost
+ * of the global reductions of one outer iteration, measured in units of
+ * matrix-vector products. The degree, up to 64, is then selected to
+ * minimize the product of the cost of an outer iteration and the number of
+ * outer iterations predicted by the conjugate gradient error bound. For the
+ * condition number of the preconditioned matrix, eigenvalues below the
+ * estimated range are assumed to exist, as the smallest eigenvalue is
+ * typically overestimated by the few iterations of the eigenvalue
+ * algorithm. For a small reduction cost, the selected degree is roughly the
+ * one that resolves the estimated spectrum, whereas for a large reduction
+ * cost, it approaches the reduction cost itself. The selected
+ * degree is returned by estimate_eigenvalues(). Like the solver mode above,
+ * this requires the Lanczos algorithm for the eigenvalue estimate and the
+ * polynomial of the first kind.
+ *
  * <h4>Requirements on the templated classes</h4>
  *
  * The class `MatrixType` must be derived from Subscriptor because a
@@ -2097,6 +2138,19 @@ public:
  * set `dst` to zero, whereas the operation after the loop performs the
  * iteration leading to $x^{n+1}$ described above, modifying the `dst` and
  * `src` vectors.
+ *
+ * The operators derived from MatrixFreeOperators::Base, such as
+ * MatrixFreeOperators::LaplaceOperator, provide this function. Own operators
+ * derived from that class enable it by overriding
+ * MatrixFreeOperators::Base::apply_add_with_operations() as in the example
+ * above.
+ *
+ * For a DiagonalMatrix preconditioner around a
+ * LinearAlgebra::distributed::Vector in the MemorySpace::Default memory
+ * space, e.g. when the matrix is implemented with Portable::MatrixFree, the
+ * vector updates of each iteration are performed by a single fused device
+ * kernel, so that the smoother does not move data between the host and the
+ * device.
  */
 template <typename MatrixType         = SparseMatrix<double>,
           typename VectorType         = Vector<double>,
@@ -2165,6 +2219,35 @@ public:
      * Specifies the polynomial type to be used.
      */
     PolynomialType polynomial_type;
+
+    /**
+     * If true, the power iteration for the eigenvalue estimate (see
+     * EigenvalueAlgorithm::power_iteration) starts from the approximate
+     * dominant eigenvector found by the previous estimate of this object,
+     * which is kept across calls to initialize(). If the matrix changes
+     * only little between two setups, as is typical for multigrid
+     * hierarchies rebuilt in every time step, the start vector is then
+     * already close to the dominant eigenvector, and a small number of
+     * iterations set by #eig_cg_n_iterations suffices. The quality of the
+     * estimate can be monitored through
+     * EigenvalueInformation::max_eigenvalue_relative_change.
+     *
+     * This option has no effect for the Lanczos algorithm, as the CG
+     * iteration behind it does not produce an approximation of the
+     * eigenvector.
+     */
+    bool warm_start_eigenvalue_estimation = false;
+
+    /**
+     * The cost of the global reductions of one iteration of an outer Krylov
+     * solver that uses this class as preconditioner, relative to the cost of
+     * one matrix-vector product. If this value is positive and #degree is
+     * set to numbers::invalid_unsigned_int, the degree is selected to
+     * minimize the estimated cost of the outer solver, rather than to reach
+     * the tolerance given by the smoothing range. See the section on
+     * polynomial preconditioning in the class documentation.
+     */
+    double krylov_reduction_cost = 0.;
   };
 
 
@@ -2275,6 +2358,13 @@ private:
    */
   mutable VectorType temp_vector2;
 
+  /**
+   * Approximation of the dominant eigenvector from the last eigenvalue
+   * estimate, used as start vector of the next estimate if
+   * AdditionalData::warm_start_eigenvalue_estimation is set.
+   */
+  mutable VectorType dominant_eigenvector;
+
   /**
    * Stores the additional data passed to the initialize function, obtained
    * through a copy operation.
@@ -2399,9 +2489,11 @@ namespace internal
   power_iteration(const MatrixType         &matrix,
                   VectorType               &eigenvector,
                   const PreconditionerType &preconditioner,
-                  const unsigned int        n_iterations)
+                  const unsigned int        n_iterations,
+                  double                   *relative_change = nullptr)
   {
     typename VectorType::value_type eigenvalue_estimate = 0.;
+    typename VectorType::value_type previous_estimate   = 0.;
     eigenvector /= eigenvector.l2_norm();
     VectorType vector1, vector2;
     vector1.reinit(eigenvector, true);
@@ -2417,11 +2509,18 @@ namespace internal
         else
           matrix.vmult(vector1, eigenvector);
 
+        previous_estimate   = eigenvalue_estimate;
         eigenvalue_estimate = eigenvector * vector1;
 
         vector1 /= vector1.l2_norm();
         eigenvector.swap(vector1);
       }
+
+    if (relative_change != nullptr && n_iterations > 1 &&
+        eigenvalue_estimate != typename VectorType::value_type())
+      *relative_change = std::abs(eigenvalue_estimate - previous_estimate) /
+                         std::abs(eigenvalue_estimate);
+
     return std::abs(eigenvalue_estimate);
   }
 
@@ -2436,7 +2535,8 @@ namespace internal
     const MatrixType                                            *matrix_ptr,
     VectorType                                                  &solution_old,
     VectorType                                                  &temp_vector1,
-    const unsigned int                                           degree)
+    const unsigned int                                           degree,
+    const bool use_temp_vector_as_initial_guess = false)
   {
     Assert(data.preconditioner.get() != nullptr, ExcNotInitialized());
 
@@ -2452,8 +2552,10 @@ namespace internal
 
         // set an initial guess that contains some high-frequency parts (to the
         // extent possible without knowing the discretization and the numbering)
-        // to trigger high eigenvalues according to the external function
-        internal::set_initial_guess(temp_vector1);
+        // to trigger high eigenvalues according to the external function,
+        // unless the caller provides a better one
+        if (use_temp_vector_as_initial_guess == false)
+          internal::set_initial_guess(temp_vector1);
         data.constraints.set_zero(temp_vector1);
 
         if (data.eigenvalue_algorithm == internal::EigenvalueAlgorithm::lanczos)
@@ -2470,12 +2572,27 @@ namespace internal
                 eigenvalue_tracker.slot(eigenvalues);
               });
 
+            // record the largest eigenvalue of each iteration to judge the
+            // quality of the final estimate
+            std::vector<double> max_eigenvalues;
+            solver.connect_eigenvalues_slot(
+              [&max_eigenvalues](const std::vector<double> &eigenvalues) {
+                if (!eigenvalues.empty())
+                  max_eigenvalues.push_back(eigenvalues.back());
+              },
+              true);
+
             solver.solve(*matrix_ptr,
                          solution_old,
                          temp_vector1,
                          *data.preconditioner);
 
             info.cg_iterations = control.last_step();
+            if (max_eigenvalues.size() > 1 && max_eigenvalues.back() != 0.)
+              info.max_eigenvalue_relative_change =
+                std::abs(max_eigenvalues.back() -
+                         max_eigenvalues[max_eigenvalues.size() - 2]) /
+                std::abs(max_eigenvalues.back());
           }
         else if (data.eigenvalue_algorithm ==
                  internal::EigenvalueAlgorithm::power_iteration)
@@ -2490,7 +2607,8 @@ namespace internal
               internal::power_iteration(*matrix_ptr,
                                         temp_vector1,
                                         *data.preconditioner,
-                                        data.eig_cg_n_iterations));
+                                        data.eig_cg_n_iterations,
+                                        &info.max_eigenvalue_relative_change));
           }
         else
           DEAL_II_NOT_IMPLEMENTED();
@@ -3479,6 +3597,76 @@ namespace internal
         }
     }
 
+    // selection for diagonal matrix around parallel deal.II vector in the
+    // default memory space: perform the same fused updates as above with a
+    // single device kernel
+    template <typename Number>
+    inline void
+    vector_updates(
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &rhs,
+      const dealii::DiagonalMatrix<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>>
+                        &jacobi,
+      const unsigned int iteration_index,
+      const double       factor1_in,
+      const double       factor2_in,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &solution_old,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &temp_vector1,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+        &solution)
+    {
+      const Number *rhs_ptr      = rhs.get_values();
+      const Number *diagonal_ptr = jacobi.get_vector().get_values();
+      Number       *solution_old_ptr = solution_old.get_values();
+      Number       *tmp_ptr          = temp_vector1.get_values();
+      Number       *solution_ptr     = solution.get_values();
+
+      const Number factor1        = factor1_in;
+      const Number factor1_plus_1 = 1. + factor1_in;
+      const Number factor2        = factor2_in;
+
+      Kokkos::RangePolicy<MemorySpace::Default::kokkos_space::execution_space,
+                          Kokkos::IndexType<types::global_dof_index>>
+        policy(0, rhs.locally_owned_size());
+
+      if (iteration_index == 0)
+        Kokkos::parallel_for(
+          "dealii::PreconditionChebyshev::vector_updates",
+          policy,
+          KOKKOS_LAMBDA(types::global_dof_index i) {
+            solution_ptr[i] = factor2 * diagonal_ptr[i] * rhs_ptr[i];
+          });
+      else if (iteration_index == 1)
+        Kokkos::parallel_for(
+          "dealii::PreconditionChebyshev::vector_updates",
+          policy,
+          KOKKOS_LAMBDA(types::global_dof_index i) {
+            tmp_ptr[i] = factor1_plus_1 * solution_ptr[i] +
+                         factor2 * diagonal_ptr[i] * (rhs_ptr[i] - tmp_ptr[i]);
+          });
+      else
+        Kokkos::parallel_for(
+          "dealii::PreconditionChebyshev::vector_updates",
+          policy,
+          KOKKOS_LAMBDA(types::global_dof_index i) {
+            tmp_ptr[i] = factor1_plus_1 * solution_ptr[i] -
+                         factor1 * solution_old_ptr[i] +
+                         factor2 * diagonal_ptr[i] * (rhs_ptr[i] - tmp_ptr[i]);
+          });
+      Kokkos::fence();
+
+      // swap vectors x^{n+1}->x^{n}, given the updates in the function above
+      if (iteration_index > 0)
+        {
+          solution.swap(temp_vector1);
+          solution_old.swap(temp_vector1);
+        }
+    }
+
     // We need to have a separate declaration for static const members
 
     // general case and the case that the preconditioner can work on
@@ -3738,6 +3926,52 @@ namespace internal
             }
         }
     }
+
+    /**
+     * Return the degree of a first-kind Chebyshev polynomial on the interval
+     * [min_eigenvalue, max_eigenvalue] that minimizes the model cost of an
+     * outer conjugate gradient solver preconditioned by the polynomial. The
+     * cost of one outer iteration is the number of matrix-vector products,
+     * equal to the degree, plus @p reduction_cost. The number of outer
+     * iterations is proportional to the square root of the condition number
+     * of the preconditioned matrix. Since the smallest eigenvalues of the
+     * matrix are typically underestimated by the eigenvalue algorithm, the
+     * condition number is modeled by the ratio of the maximum of the
+     * preconditioned polynomial $\lambda p(\lambda)$ on the interval and its
+     * slope $p(0)$ at zero, which acts on the eigenvalues below the interval.
+     */
+    inline unsigned int
+    select_degree_for_krylov_solver(const double       min_eigenvalue,
+                                    const double       max_eigenvalue,
+                                    const double       reduction_cost,
+                                    const unsigned int max_degree = 64)
+    {
+      Assert(min_eigenvalue < max_eigenvalue, ExcInternalError());
+
+      const double acosh_sigma = std::acosh((max_eigenvalue + min_eigenvalue) /
+                                            (max_eigenvalue - min_eigenvalue));
+
+      unsigned int best_degree = 1;
+      double       best_cost   = std::numeric_limits<double>::max();
+      for (unsigned int degree = 1; degree <= max_degree; ++degree)
+        {
+          // With the residual polynomial r(x) = T_d(sigma - 2 x / (b - a)) /
+          // T_d(sigma), the maximum of x p(x) = 1 - r(x) on [a, b] is
+          // 1 + 1 / T_d(sigma), and p(0) = -r'(0) is proportional to
+          // d tanh(d acosh(sigma)), dropping factors independent of d
+          const double x = degree * acosh_sigma;
+          const double condition_number =
+            (1. + 1. / std::cosh(std::min(x, 700.))) / (degree * std::tanh(x));
+          const double cost =
+            (degree + reduction_cost) * std::sqrt(condition_number);
+          if (cost < best_cost)
+            {
+              best_cost   = cost;
+              best_degree = degree;
+            }
+        }
+      return best_degree;
+    }
   } // namespace PreconditionChebyshevImplementation
 } // namespace internal
 
@@ -3807,6 +4041,7 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::clear()
     solution_old.reinit(empty_vector);
     temp_vector1.reinit(empty_vector);
     temp_vector2.reinit(empty_vector);
+    dominant_eigenvector.reinit(empty_vector);
   }
   data.preconditioner.reset();
 }
@@ -3823,8 +4058,23 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   solution_old.reinit(src);
   temp_vector1.reinit(src, true);
 
+  const bool use_power_iteration =
+    data.eig_cg_n_iterations > 0 &&
+    data.eigenvalue_algorithm == internal::EigenvalueAlgorithm::power_iteration;
+  const bool warm_start = data.warm_start_eigenvalue_estimation &&
+                          use_power_iteration &&
+                          dominant_eigenvector.size() == src.size();
+  if (warm_start)
+    temp_vector1 = dominant_eigenvector;
+
   auto info = internal::estimate_eigenvalues<MatrixType>(
-    data, matrix_ptr, solution_old, temp_vector1, data.degree);
+    data, matrix_ptr, solution_old, temp_vector1, data.degree, warm_start);
+
+  if (data.warm_start_eigenvalue_estimation && use_power_iteration)
+    {
+      dominant_eigenvector.reinit(src, true);
+      dominant_eigenvector = temp_vector1;
+    }
 
   const double alpha = (data.smoothing_range > 1. ?
                           info.max_eigenvalue_estimate / data.smoothing_range :
@@ -3836,7 +4086,21 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
   // estimate, given the target tolerance specified by smoothing_range. This
   // estimate is based on the error formula given in section 5.1 of
   // R. S. Varga, Matrix iterative analysis, 2nd ed., Springer, 2009
-  if (data.degree == numbers::invalid_unsigned_int)
+  if (data.degree == numbers::invalid_unsigned_int &&
+      data.krylov_reduction_cost > 0.)
+    {
+      Assert(data.polynomial_type == AdditionalData::PolynomialType::first_kind,
+             ExcMessage("The degree selection for Krylov solvers is only "
+                        "implemented for first-kind Chebyshev polynomials."));
+      const_cast<
+        PreconditionChebyshev<MatrixType, VectorType, PreconditionerType> *>(
+        this)
+        ->data.degree = internal::PreconditionChebyshevImplementation::
+        select_degree_for_krylov_solver(alpha,
+                                        info.max_eigenvalue_estimate,
+                                        data.krylov_reduction_cost);
+    }
+  else if (data.degree == numbers::invalid_unsigned_int)
     {
       const double actual_range = info.max_eigenvalue_estimate / alpha;
       const double sigma        = (1. - std::sqrt(1. / actual_range)) /
@@ -3872,7 +4136,7 @@ PreconditionChebyshev<MatrixType, VectorType, PreconditionerType>::
        ((std::is_same_v<
            VectorType,
            LinearAlgebra::distributed::Vector<NumberType, MemorySpace::Host>> ==
-         false) ||
+         false) &&
         (std::is_same_v<VectorType,
                         LinearAlgebra::distributed::
                           Vector<NumberType, MemorySpace::Default>> == false))))
@@ -20,7 +20,9 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/vectorization.h>
 
+#include <deal.II/lac/batched_full_matrix.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
 #include <deal.II/lac/precondition_block.h>
@@ -459,45 +461,74 @@ PreconditionBlock<MatrixType, inverse_type>::invert_diagblocks()
     {
       M_cell = 0;
 
-      for (unsigned int cell = 0; cell < this->size(); ++cell)
+      const auto copy_diagonal_block = [&](const unsigned int cell) {
+        const size_type cell_start = cell * blocksize;
+        for (size_type row_cell = 0; row_cell < blocksize; ++row_cell)
+          {
+            const size_type                     row   = row_cell + cell_start;
+            typename MatrixType::const_iterator entry = M.begin(row);
+            const typename MatrixType::const_iterator row_end = M.end(row);
+
+            for (; entry != row_end; ++entry)
+              {
+                if (entry->column() < cell_start)
+                  continue;
+
+                const size_type column_cell = entry->column() - cell_start;
+                if (column_cell >= blocksize)
+                  continue;
+                M_cell(row_cell, column_cell) = entry->value();
+              }
+          }
+
+        if (this->store_diagonals())
+          this->diagonal(cell) = M_cell;
+      };
+
+      if (this->inversion == PreconditionBlockBase<inverse_type>::gauss_jordan)
         {
-          const size_type cell_start = cell * blocksize;
-          for (size_type row_cell = 0; row_cell < blocksize; ++row_cell)
+          // Invert as many blocks at once as there are lanes in a SIMD
+          // register, which is much faster than inverting the small
+          // matrices one by one. Unused lanes of the last batch are filled
+          // with a copy of the last block to keep them regular.
+          constexpr unsigned int n_lanes =
+            VectorizedArray<inverse_type>::size();
+          BatchedFullMatrix<VectorizedArray<inverse_type>> batch(blocksize,
+                                                                 blocksize);
+          for (unsigned int first = 0; first < this->size(); first += n_lanes)
             {
-              const size_type                     row   = row_cell + cell_start;
-              typename MatrixType::const_iterator entry = M.begin(row);
-              const typename MatrixType::const_iterator row_end = M.end(row);
-
-              for (; entry != row_end; ++entry)
+              const unsigned int n_filled =
+                std::min<unsigned int>(n_lanes, this->size() - first);
+              for (unsigned int lane = 0; lane < n_lanes; ++lane)
                 {
-                  if (entry->column() < cell_start)
-                    continue;
-
-                  const size_type column_cell = entry->column() - cell_start;
-                  if (column_cell >= blocksize)
-                    continue;
-                  M_cell(row_cell, column_cell) = entry->value();
+                  if (lane < n_filled)
+                    copy_diagonal_block(first + lane);
+                  batch.insert_lane(lane, M_cell);
                 }
-            }
 
-          if (this->store_diagonals())
-            this->diagonal(cell) = M_cell;
-          switch (this->inversion)
-            {
-              case PreconditionBlockBase<inverse_type>::gauss_jordan:
-                this->inverse(cell).invert(M_cell);
-                break;
-              case PreconditionBlockBase<inverse_type>::householder:
-                this->inverse_householder(cell).initialize(M_cell);
-                break;
-              case PreconditionBlockBase<inverse_type>::svd:
-                this->inverse_svd(cell) = M_cell;
-                this->inverse_svd(cell).compute_inverse_svd(1.e-12);
-                break;
-              default:
-                DEAL_II_NOT_IMPLEMENTED();
+              batch.invert();
+
+              for (unsigned int lane = 0; lane < n_filled; ++lane)
+                batch.extract_lane(lane, this->inverse(first + lane));
             }
         }
+      else
+        for (unsigned int cell = 0; cell < this->size(); ++cell)
+          {
+            copy_diagonal_block(cell);
+            switch (this->inversion)
+              {
+                case PreconditionBlockBase<inverse_type>::householder:
+                  this->inverse_householder(cell).initialize(M_cell);
+                  break;
+                case PreconditionBlockBase<inverse_type>::svd:
+                  this->inverse_svd(cell) = M_cell;
+                  this->inverse_svd(cell).compute_inverse_svd(1.e-12);
+                  break;
+                default:
+                  DEAL_II_NOT_IMPLEMENTED();
+              }
+          }
     }
   this->inverses_computed(true);
 }
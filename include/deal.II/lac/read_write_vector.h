@@ -324,6 +324,13 @@ namespace LinearAlgebra
      * current vector or replace the current elements. The last parameter can
      * be used if the same communication pattern is used multiple times. This
      * can be used to improve performance.
+     *
+     * If no communication pattern is given, the one set up in the last call
+     * to this function is reused if the locally owned elements of @p vec are
+     * the same as in that call, which makes repeated imports from vectors
+     * with the same layout cheap. The locally owned values of @p vec are read
+     * in place, and the elements owned by the current process are imported
+     * while the ghost values are being communicated.
      */
     template <typename MemorySpace>
     void
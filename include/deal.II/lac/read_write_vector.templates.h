@@ -90,6 +90,24 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number>
+    void
+    apply_operation(Number                       &value,
+                    const Number                  imported_value,
+                    const VectorOperation::values operation)
+    {
+      if (operation == VectorOperation::add)
+        value += imported_value;
+      else if (operation == VectorOperation::min)
+        value = get_min(imported_value, value);
+      else if (operation == VectorOperation::max)
+        value = get_max(imported_value, value);
+      else
+        value = imported_value;
+    }
+
+
+
     template <typename Number, typename MemorySpace>
     struct read_write_vector_functions
     {
@@ -129,32 +147,59 @@ namespace LinearAlgebra
         const VectorOperation::values                     operation,
         ::dealii::LinearAlgebra::ReadWriteVector<Number> &rw_vector)
       {
-        distributed::Vector<Number, ::dealii::MemorySpace::Host> tmp_vector(
-          communication_pattern);
-
-        const unsigned int n_elements =
+        // The locally owned values are read directly from the source vector,
+        // so only the ghost values need to be received into a separate array
+        const unsigned int n_owned =
           communication_pattern->locally_owned_size();
-        std::copy(values, values + n_elements, tmp_vector.begin());
-        tmp_vector.update_ghost_values();
+        const unsigned int n_ghosts = communication_pattern->n_ghost_indices();
+        std::vector<Number> ghost_values(n_ghosts);
+
+#ifdef DEAL_II_WITH_MPI
+        std::vector<Number> temporary_storage(
+          communication_pattern->n_import_indices());
+        std::vector<MPI_Request> requests;
+        communication_pattern->export_to_ghosted_array_start<Number>(
+          0,
+          ArrayView<const Number>(values, n_owned),
+          make_array_view(temporary_storage),
+          make_array_view(ghost_values),
+          requests);
+#endif
 
+        // Import the locally owned elements while the ghost values are on
+        // their way
         const IndexSet &stored = rw_vector.get_stored_elements();
-        if (operation == VectorOperation::add)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) +=
-              tmp_vector(stored.nth_index_in_set(i));
-        else if (operation == VectorOperation::min)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) =
-              get_min(tmp_vector(stored.nth_index_in_set(i)),
-                      rw_vector.local_element(i));
-        else if (operation == VectorOperation::max)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) =
-              get_max(tmp_vector(stored.nth_index_in_set(i)),
-                      rw_vector.local_element(i));
-        else
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) = tmp_vector(stored.nth_index_in_set(i));
+        size_type       i      = 0;
+        for (const types::global_dof_index index : stored)
+          {
+            const unsigned int local_index =
+              communication_pattern->global_to_local(index);
+            if (local_index < n_owned)
+              apply_operation(rw_vector.local_element(i),
+                              values[local_index],
+                              operation);
+            ++i;
+          }
+
+#ifdef DEAL_II_WITH_MPI
+        communication_pattern->export_to_ghosted_array_finish(
+          make_array_view(ghost_values), requests);
+#endif
+
+        if (n_ghosts > 0)
+          {
+            i = 0;
+            for (const types::global_dof_index index : stored)
+              {
+                const unsigned int local_index =
+                  communication_pattern->global_to_local(index);
+                if (local_index >= n_owned)
+                  apply_operation(rw_vector.local_element(i),
+                                  ghost_values[local_index - n_owned],
+                                  operation);
+                ++i;
+              }
+          }
       }
     };
 
@@ -163,8 +208,6 @@ namespace LinearAlgebra
     template <typename Number>
     struct read_write_vector_functions<Number, ::dealii::MemorySpace::Default>
     {
-      using size_type = types::global_dof_index;
-
       static void
       import_elements(
         const std::shared_ptr<const ::dealii::Utilities::MPI::Partitioner>
@@ -173,37 +216,21 @@ namespace LinearAlgebra
         const VectorOperation::values                     operation,
         ::dealii::LinearAlgebra::ReadWriteVector<Number> &rw_vector)
       {
-        distributed::Vector<Number, ::dealii::MemorySpace::Host> tmp_vector(
-          communication_pattern);
-
         const unsigned int n_elements =
           communication_pattern->locally_owned_size();
+        std::vector<Number> host_values(n_elements);
         Kokkos::deep_copy(
-          Kokkos::View<Number *, Kokkos::HostSpace>(tmp_vector.begin(),
+          Kokkos::View<Number *, Kokkos::HostSpace>(host_values.data(),
                                                     n_elements),
           Kokkos::View<const Number *,
                        ::dealii::MemorySpace::Default::kokkos_space>(
             values, n_elements));
-        tmp_vector.update_ghost_values();
 
-        const IndexSet &stored = rw_vector.get_stored_elements();
-        if (operation == VectorOperation::add)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) +=
-              tmp_vector(stored.nth_index_in_set(i));
-        else if (operation == VectorOperation::min)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) =
-              get_min(tmp_vector(stored.nth_index_in_set(i)),
-                      rw_vector.local_element(i));
-        else if (operation == VectorOperation::max)
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) =
-              get_max(tmp_vector(stored.nth_index_in_set(i)),
-                      rw_vector.local_element(i));
-        else
-          for (size_type i = 0; i < stored.n_elements(); ++i)
-            rw_vector.local_element(i) = tmp_vector(stored.nth_index_in_set(i));
+        read_write_vector_functions<Number, ::dealii::MemorySpace::Host>::
+          import_elements(communication_pattern,
+                          host_values.data(),
+                          operation,
+                          rw_vector);
       }
     };
   } // namespace internal
@@ -310,6 +337,12 @@ namespace LinearAlgebra
     thread_loop_partitioner = in_vector.thread_loop_partitioner;
     if (locally_owned_size() != in_vector.locally_owned_size())
       reinit(in_vector, true);
+    else
+      {
+        // reset the communication pattern
+        source_stored_elements.clear();
+        comm_pattern.reset();
+      }
 
     if (locally_owned_size() > 0)
       {
@@ -332,6 +365,12 @@ namespace LinearAlgebra
     thread_loop_partitioner = in_vector.thread_loop_partitioner;
     if (locally_owned_size() != in_vector.locally_owned_size())
       reinit(in_vector, true);
+    else
+      {
+        // reset the communication pattern
+        source_stored_elements.clear();
+        comm_pattern.reset();
+      }
 
     if (locally_owned_size() > 0)
       {
@@ -424,29 +463,58 @@ namespace LinearAlgebra
     const std::shared_ptr<const Utilities::MPI::CommunicationPatternBase>
       &communication_pattern)
   {
-    // If no communication pattern is given, create one. Otherwise, use the
-    // given one.
-    std::shared_ptr<const Utilities::MPI::Partitioner> comm_pattern;
+    // If no communication pattern is given, reuse the one of the last import
+    // if it was set up for the same source elements, or create a new one.
+    // Otherwise, use the given one.
+    std::shared_ptr<const Utilities::MPI::Partitioner> partitioner;
     if (communication_pattern.get() == nullptr)
       {
-        comm_pattern = std::make_shared<Utilities::MPI::Partitioner>(
-          vec.locally_owned_elements(),
-          get_stored_elements(),
-          vec.get_mpi_communicator());
+        const IndexSet source_elements = vec.locally_owned_elements();
+        const MPI_Comm mpi_comm        = vec.get_mpi_communicator();
+
+        // The pattern can only be reused if its ghost indices are still the
+        // elements stored in this vector that the source does not own
+        partitioner =
+          std::dynamic_pointer_cast<const Utilities::MPI::Partitioner>(
+            comm_pattern);
+        bool can_reuse_pattern =
+          partitioner != nullptr &&
+          partitioner->get_mpi_communicator() == mpi_comm &&
+          source_elements.size() == source_stored_elements.size() &&
+          source_elements == source_stored_elements &&
+          stored_elements.size() == source_elements.size();
+        if (can_reuse_pattern)
+          {
+            IndexSet ghost_elements = stored_elements;
+            ghost_elements.subtract_set(partitioner->locally_owned_range());
+            can_reuse_pattern = ghost_elements == partitioner->ghost_indices();
+          }
+
+        // Setting up a new pattern is a collective operation, so all
+        // processes need to agree on whether to reuse the old one
+        if (Utilities::MPI::min(can_reuse_pattern ? 1U : 0U, mpi_comm) == 0)
+          {
+            auto new_partitioner =
+              std::make_shared<Utilities::MPI::Partitioner>(
+                source_elements, get_stored_elements(), mpi_comm);
+            source_stored_elements = source_elements;
+            comm_pattern           = new_partitioner;
+            partitioner            = new_partitioner;
+          }
       }
     else
       {
-        comm_pattern =
+        partitioner =
           std::dynamic_pointer_cast<const Utilities::MPI::Partitioner>(
             communication_pattern);
-        AssertThrow(comm_pattern != nullptr,
+        AssertThrow(partitioner != nullptr,
                     ExcMessage("The communication pattern is not of type "
                                "Utilities::MPI::Partitioner."));
       }
 
 
     internal::read_write_vector_functions<Number, MemorySpace>::import_elements(
-      comm_pattern, vec.begin(), operation, *this);
+      partitioner, vec.begin(), operation, *this);
   }
 
 
@@ -946,6 +1014,8 @@ namespace LinearAlgebra
   {
     std::swap(stored_elements, v.stored_elements);
     std::swap(values, v.values);
+    std::swap(source_stored_elements, v.source_stored_elements);
+    std::swap(comm_pattern, v.comm_pattern);
   }
 
 
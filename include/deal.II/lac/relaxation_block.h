@@ -170,6 +170,25 @@ public:
      */
     std::vector<std::vector<unsigned int>> order;
 
+    /**
+     * If true, the blocks are grouped into colors during initialize(), such
+     * that no two blocks of the same color are coupled through the matrix,
+     * i.e., no block reads or writes an entry of the vector written by
+     * another block of the same color. The relaxation method then runs
+     * through the colors one after the other and processes the blocks of
+     * each color in parallel on all available threads.
+     *
+     * For the multiplicative methods RelaxationBlockSOR and
+     * RelaxationBlockSSOR, this changes the order in which the blocks are
+     * traversed compared to the sequential method, and thus the result of a
+     * step. In return, the smoothers of vertex patch methods, which are
+     * otherwise strictly sequential, scale with the number of threads.
+     * This option cannot be combined with a user-defined #order. The
+     * element access of VectorType needs to be thread-safe for different
+     * entries, as is the case for the vector classes of deal.II.
+     */
+    bool parallel_coloring = false;
+
     /**
      * Temporary ghost vector that is used in the relaxation method when
      * performing parallel MPI computations. The user is required to have this
@@ -240,6 +259,18 @@ protected:
           const VectorType &src,
           const bool        backward) const;
 
+  /**
+   * Perform the relaxation step of do_step() on a single @p block, using
+   * @p b_cell and @p x_cell as scratch arrays.
+   */
+  void
+  do_block_step(const unsigned int                       block,
+                VectorType                              &dst,
+                const VectorType                        &prev,
+                const VectorType                        &src,
+                Vector<typename VectorType::value_type> &b_cell,
+                Vector<typename VectorType::value_type> &x_cell) const;
+
   /**
    * Pointer to the matrix. Make sure that the matrix exists as long as this
    * class needs it, i.e. until calling @p invert_diagblocks, or (if the
@@ -263,6 +294,12 @@ private:
    */
   void
   block_kernel(const size_type block_begin, const size_type block_end);
+
+  /**
+   * The blocks grouped by color, if AdditionalData::parallel_coloring is
+   * set. Empty otherwise.
+   */
+  std::vector<std::vector<unsigned int>> block_colors;
 };
 
 
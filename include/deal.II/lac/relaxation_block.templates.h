@@ -17,11 +17,19 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/graph_coloring.h>
+#include <deal.II/base/parallel.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/batched_full_matrix.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/relaxation_block.h>
 #include <deal.II/lac/trilinos_vector.h>
 #include <deal.II/lac/vector_memory.h>
 
+#include <algorithm>
+#include <numeric>
+
 DEAL_II_NAMESPACE_OPEN
 
 template <typename MatrixType, typename InverseNumberType, typename VectorType>
@@ -72,6 +80,47 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::initialize(
                additional_data->same_diagonal,
                additional_data->inversion);
 
+  if (additional_data->parallel_coloring &&
+      additional_data->block_list.n_rows() > 0)
+    {
+      Assert(additional_data->order.empty(),
+             ExcMessage("A user-defined order of the blocks cannot be "
+                        "combined with the parallel coloring of blocks."));
+
+      // Two blocks are in conflict if the rows of one of them are coupled
+      // to the rows of the other one, which is the case if the sets of
+      // columns of the matrix rows of the two blocks intersect
+      const auto get_conflict_indices =
+        [&](const std::vector<unsigned int>::const_iterator &block) {
+          std::vector<types::global_dof_index> indices;
+          for (SparsityPattern::iterator row =
+                 additional_data->block_list.begin(*block);
+               row != additional_data->block_list.end(*block);
+               ++row)
+            for (typename MatrixType::const_iterator entry =
+                   M.begin(row->column());
+                 entry != M.end(row->column());
+                 ++entry)
+              indices.push_back(entry->column());
+          std::sort(indices.begin(), indices.end());
+          indices.erase(std::unique(indices.begin(), indices.end()),
+                        indices.end());
+          return indices;
+        };
+
+      std::vector<unsigned int> blocks(additional_data->block_list.n_rows());
+      std::iota(blocks.begin(), blocks.end(), 0U);
+      const auto coloring =
+        GraphColoring::make_graph_coloring(blocks.cbegin(),
+                                           blocks.cend(),
+                                           get_conflict_indices);
+
+      block_colors.resize(coloring.size());
+      for (unsigned int c = 0; c < coloring.size(); ++c)
+        for (const auto &block : coloring[c])
+          block_colors[c].push_back(*block);
+    }
+
   if (additional_data->invert_diagonal)
     invert_diagblocks();
 }
@@ -83,6 +132,7 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::clear()
 {
   A               = nullptr;
   additional_data = nullptr;
+  block_colors.clear();
   PreconditionBlockBase<InverseNumberType>::clear();
 }
 
@@ -119,6 +169,27 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::block_kernel(
   const MatrixType             &M = *(this->A);
   FullMatrix<InverseNumberType> M_cell;
 
+  // Blocks of equal size are inverted as many at once as there are lanes in
+  // a SIMD register. Consecutive blocks are collected in the following batch
+  // until it is full or a block of different size is encountered.
+  constexpr unsigned int n_lanes = VectorizedArray<InverseNumberType>::size();
+  BatchedFullMatrix<VectorizedArray<InverseNumberType>> batch;
+  std::vector<size_type>                                batch_blocks;
+  const auto invert_batch = [&]() {
+    if (batch_blocks.empty())
+      return;
+
+    // fill unused lanes with a copy of the first block to keep them regular
+    for (unsigned int lane = batch_blocks.size(); lane < n_lanes; ++lane)
+      for (unsigned int i = 0; i < batch.m(); ++i)
+        for (unsigned int j = 0; j < batch.n(); ++j)
+          batch(i, j)[lane] = batch(i, j)[0];
+    batch.invert();
+    for (unsigned int lane = 0; lane < batch_blocks.size(); ++lane)
+      batch.extract_lane(lane, this->inverse(batch_blocks[lane]));
+    batch_blocks.clear();
+  };
+
   for (size_type block = block_begin; block < block_end; ++block)
     {
       const size_type bs = this->additional_data->block_list.row_length(block);
@@ -151,8 +222,14 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::block_kernel(
       switch (this->inversion)
         {
           case PreconditionBlockBase<InverseNumberType>::gauss_jordan:
-            this->inverse(block).reinit(bs, bs);
-            this->inverse(block).invert(M_cell);
+            if (!batch_blocks.empty() && batch.m() != bs)
+              invert_batch();
+            if (batch.m() != bs)
+              batch.reinit(bs, bs);
+            batch.insert_lane(batch_blocks.size(), M_cell);
+            batch_blocks.push_back(block);
+            if (batch_blocks.size() == n_lanes)
+              invert_batch();
             break;
           case PreconditionBlockBase<InverseNumberType>::householder:
             this->inverse_householder(block).initialize(M_cell);
@@ -171,6 +248,7 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::block_kernel(
             DEAL_II_NOT_IMPLEMENTED();
         }
     }
+  invert_batch();
 }
 
 namespace internal
@@ -226,8 +304,28 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
   const VectorType &ghosted_prev =
     internal::prepare_ghost_vector(prev, additional_data->temp_ghost_vector);
 
-  const MatrixType                       &M = *this->A;
-  Vector<typename VectorType::value_type> b_cell, x_cell;
+  if (!block_colors.empty())
+    {
+      // The blocks of one color do not interact with each other, so process
+      // them in parallel
+      for (unsigned int c = 0; c < block_colors.size(); ++c)
+        {
+          const std::vector<unsigned int> &color =
+            block_colors[backward ? block_colors.size() - 1 - c : c];
+          parallel::apply_to_subranges(
+            0U,
+            static_cast<unsigned int>(color.size()),
+            [&](const unsigned int begin, const unsigned int end) {
+              Vector<typename VectorType::value_type> b_cell, x_cell;
+              for (unsigned int i = begin; i < end; ++i)
+                do_block_step(
+                  color[i], dst, ghosted_prev, src, b_cell, x_cell);
+            },
+            16);
+        }
+      dst.compress(VectorOperation::add);
+      return;
+    }
 
   const bool         permutation_empty = additional_data->order.empty();
   const unsigned int n_permutations =
@@ -238,6 +336,7 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
     for (unsigned int i = 0; i < additional_data->order.size(); ++i)
       AssertDimension(additional_data->order[i].size(), this->size());
 
+  Vector<typename VectorType::value_type> b_cell, x_cell;
   for (unsigned int perm = 0; perm < n_permutations; ++perm)
     {
       for (unsigned int bi = 0; bi < n_blocks; ++bi)
@@ -250,42 +349,53 @@ RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_step(
                              ->order[n_permutations - 1 - perm][raw_block]) :
                           (additional_data->order[perm][raw_block]));
 
-          const size_type bs = additional_data->block_list.row_length(block);
-
-          b_cell.reinit(bs);
-          x_cell.reinit(bs);
-          // Collect off-diagonal parts
-          SparsityPattern::iterator row =
-            additional_data->block_list.begin(block);
-          for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
-            {
-              b_cell(row_cell) = src(row->column());
-              for (typename MatrixType::const_iterator entry =
-                     M.begin(row->column());
-                   entry != M.end(row->column());
-                   ++entry)
-                b_cell(row_cell) -=
-                  entry->value() * ghosted_prev(entry->column());
-            }
-          // Apply inverse diagonal
-          this->inverse_vmult(block, x_cell, b_cell);
-#ifdef DEBUG
-          for (unsigned int i = 0; i < x_cell.size(); ++i)
-            {
-              AssertIsFinite(x_cell(i));
-            }
-#endif
-          // Store in result vector
-          row = additional_data->block_list.begin(block);
-          for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
-            dst(row->column()) +=
-              additional_data->relaxation * x_cell(row_cell);
+          do_block_step(block, dst, ghosted_prev, src, b_cell, x_cell);
         }
     }
   dst.compress(VectorOperation::add);
 }
 
 
+template <typename MatrixType, typename InverseNumberType, typename VectorType>
+inline void
+RelaxationBlock<MatrixType, InverseNumberType, VectorType>::do_block_step(
+  const unsigned int                       block,
+  VectorType                              &dst,
+  const VectorType                        &prev,
+  const VectorType                        &src,
+  Vector<typename VectorType::value_type> &b_cell,
+  Vector<typename VectorType::value_type> &x_cell) const
+{
+  const MatrixType &M  = *this->A;
+  const size_type   bs = additional_data->block_list.row_length(block);
+
+  b_cell.reinit(bs);
+  x_cell.reinit(bs);
+  // Collect off-diagonal parts
+  SparsityPattern::iterator row = additional_data->block_list.begin(block);
+  for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
+    {
+      b_cell(row_cell) = src(row->column());
+      for (typename MatrixType::const_iterator entry = M.begin(row->column());
+           entry != M.end(row->column());
+           ++entry)
+        b_cell(row_cell) -= entry->value() * prev(entry->column());
+    }
+  // Apply inverse diagonal
+  this->inverse_vmult(block, x_cell, b_cell);
+#ifdef DEBUG
+  for (unsigned int i = 0; i < x_cell.size(); ++i)
+    {
+      AssertIsFinite(x_cell(i));
+    }
+#endif
+  // Store in result vector
+  row = additional_data->block_list.begin(block);
+  for (size_type row_cell = 0; row_cell < bs; ++row_cell, ++row)
+    dst(row->column()) += additional_data->relaxation * x_cell(row_cell);
+}
+
+
 //----------------------------------------------------------------------//
 
 template <typename MatrixType, typename InverseNumberType, typename VectorType>
@@ -19,6 +19,7 @@
 
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
+#include <deal.II/base/trace.h>
 
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/vector_memory.h>
@@ -527,6 +528,7 @@ inline SolverBase<VectorType>::SolverBase(
   connect([&solver_control](const unsigned int iteration,
                             const double       check_value,
                             const VectorType &) {
+    Trace::instant("SolverBase iteration");
     return solver_control.check(iteration, check_value);
   });
 }
@@ -546,6 +548,7 @@ inline SolverBase<VectorType>::SolverBase(SolverControl &solver_control)
   connect([&solver_control](const unsigned int iteration,
                             const double       check_value,
                             const VectorType &) {
+    Trace::instant("SolverBase iteration");
     return solver_control.check(iteration, check_value);
   });
 }
@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/numbers.h>
 #include <deal.II/base/signaling_nan.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
@@ -26,11 +27,25 @@
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 
+#include <array>
 #include <cmath>
 #include <limits>
+#include <utility>
 
 DEAL_II_NAMESPACE_OPEN
 
+// forward declaration
+#ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+#endif
+
 /**
  * @addtogroup Solvers
  * @{
@@ -211,6 +226,158 @@ private:
 
 #ifndef DOXYGEN
 
+namespace internal
+{
+  namespace SolverBicgstabImplementation
+  {
+    // Vector operations of the BiCGStab iteration. The generic
+    // implementation uses the vector space operations of VectorType, whereas
+    // the one for LinearAlgebra::distributed::Vector below merges operations
+    // that access the same vectors into a single sweep through memory and
+    // a single global reduction.
+    template <typename VectorType>
+    struct IterationOperations
+    {
+      using value_type = typename VectorType::value_type;
+      using real_type  = typename numbers::NumberTraits<value_type>::real_type;
+
+      // Compute p = beta * p + r - beta * omega * v
+      static void
+      update_search_direction(VectorType       &p,
+                              const VectorType &r,
+                              const VectorType &v,
+                              const value_type  beta,
+                              const value_type  omega)
+      {
+        p.sadd(beta, 1., r);
+        p.add(-beta * omega, v);
+      }
+
+      // Return the pair (t * r, t * t)
+      static std::pair<value_type, real_type>
+      dot_and_norm_sqr(const VectorType &t, const VectorType &r)
+      {
+        const value_type t_dot_r   = t * r;
+        const real_type  t_squared = t * t;
+        return {t_dot_r, t_squared};
+      }
+
+      // Compute x += alpha * y + omega * z and r -= omega * t, and return the
+      // pair (r * r, r * rbar) of the updated residual
+      static std::pair<real_type, value_type>
+      update_solution_and_residual(VectorType       &x,
+                                   const VectorType &y,
+                                   const VectorType &z,
+                                   VectorType       &r,
+                                   const VectorType &t,
+                                   const VectorType &rbar,
+                                   const value_type  alpha,
+                                   const value_type  omega)
+      {
+        x.add(alpha, y, omega, z);
+        const real_type r_squared = real_type(r.add_and_dot(-omega, t, r));
+        return {r_squared, r * rbar};
+      }
+    };
+
+
+
+    template <typename Number>
+    struct IterationOperations<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+    {
+      using VectorType =
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>;
+      using value_type = Number;
+      using real_type  = typename numbers::NumberTraits<Number>::real_type;
+
+      static void
+      update_search_direction(VectorType       &p,
+                              const VectorType &r,
+                              const VectorType &v,
+                              const value_type  beta,
+                              const value_type  omega)
+      {
+        const Number  beta_omega = beta * omega;
+        Number       *p_ptr      = p.begin();
+        const Number *r_ptr      = r.begin();
+        const Number *v_ptr      = v.begin();
+        p.fused_operation([&](const unsigned int begin,
+                              const unsigned int end) {
+          DEAL_II_OPENMP_SIMD_PRAGMA
+          for (unsigned int i = begin; i < end; ++i)
+            p_ptr[i] = beta * p_ptr[i] + r_ptr[i] - beta_omega * v_ptr[i];
+        });
+        if (p.has_ghost_elements())
+          p.update_ghost_values();
+      }
+
+      static std::pair<value_type, real_type>
+      dot_and_norm_sqr(const VectorType &t, const VectorType &r)
+      {
+        const Number *t_ptr = t.begin();
+        const Number *r_ptr = r.begin();
+
+        const std::array<Number, 2> sums =
+          t.template fused_reduction<2>([&](const unsigned int begin,
+                                            const unsigned int end) {
+            std::array<Number, 2> local_sums = {};
+            for (unsigned int i = begin; i < end; ++i)
+              {
+                local_sums[0] +=
+                  t_ptr[i] * numbers::NumberTraits<Number>::conjugate(r_ptr[i]);
+                local_sums[1] += numbers::NumberTraits<Number>::abs_square(
+                  t_ptr[i]);
+              }
+            return local_sums;
+          });
+        return {sums[0], numbers::NumberTraits<Number>::abs(sums[1])};
+      }
+
+      static std::pair<real_type, value_type>
+      update_solution_and_residual(VectorType       &x,
+                                   const VectorType &y,
+                                   const VectorType &z,
+                                   VectorType       &r,
+                                   const VectorType &t,
+                                   const VectorType &rbar,
+                                   const value_type  alpha,
+                                   const value_type  omega)
+      {
+        Number       *x_ptr    = x.begin();
+        Number       *r_ptr    = r.begin();
+        const Number *y_ptr    = y.begin();
+        const Number *z_ptr    = z.begin();
+        const Number *t_ptr    = t.begin();
+        const Number *rbar_ptr = rbar.begin();
+
+        const std::array<Number, 2> sums =
+          x.template fused_reduction<2>([&](const unsigned int begin,
+                                            const unsigned int end) {
+            std::array<Number, 2> local_sums = {};
+            for (unsigned int i = begin; i < end; ++i)
+              {
+                x_ptr[i] += alpha * y_ptr[i] + omega * z_ptr[i];
+                r_ptr[i] -= omega * t_ptr[i];
+                local_sums[0] += numbers::NumberTraits<Number>::abs_square(
+                  r_ptr[i]);
+                local_sums[1] +=
+                  r_ptr[i] *
+                  numbers::NumberTraits<Number>::conjugate(rbar_ptr[i]);
+              }
+            return local_sums;
+          });
+        if (x.has_ghost_elements())
+          x.update_ghost_values();
+        if (r.has_ghost_elements())
+          r.update_ghost_values();
+        return {numbers::NumberTraits<Number>::abs(sums[0]), sums[1]};
+      }
+    };
+  } // namespace SolverBicgstabImplementation
+} // namespace internal
+
+
 
 template <typename VectorType>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
@@ -323,15 +490,22 @@ typename SolverBicgstab<VectorType>::IterationResult
 
   rbar = r;
 
+  using Operations =
+    internal::SolverBicgstabImplementation::IterationOperations<VectorType>;
+
   value_type alpha = 1.;
   value_type rho   = 1.;
   value_type omega = 1.;
 
+  // the inner product of r and rbar, computed together with the update of
+  // the residual at the end of each iteration
+  value_type r_dot_rbar = res * res;
+
   do
     {
       ++step;
 
-      const value_type rhobar = (step == 1 + last_step) ? res * res : r * rbar;
+      const value_type rhobar = r_dot_rbar;
 
       if (std::fabs(rhobar) < additional_data.breakdown)
         {
@@ -346,8 +520,7 @@ typename SolverBicgstab<VectorType>::IterationResult
         }
       else
         {
-          p.sadd(beta, 1., r);
-          p.add(-beta * omega, v);
+          Operations::update_search_direction(p, r, v, beta, omega);
         }
 
       preconditioner.vmult(y, p);
@@ -377,22 +550,22 @@ typename SolverBicgstab<VectorType>::IterationResult
 
       preconditioner.vmult(z, r);
       A.vmult(t, z);
-      const value_type t_dot_r   = t * r;
-      const real_type  t_squared = t * t;
+      const auto [t_dot_r, t_squared] = Operations::dot_and_norm_sqr(t, r);
       if (t_squared < additional_data.breakdown)
         {
           return IterationResult(true, state, step, res);
         }
       omega = t_dot_r / t_squared;
-      x.add(alpha, y, omega, z);
+
+      const auto [r_squared, new_r_dot_rbar] =
+        Operations::update_solution_and_residual(
+          x, y, z, r, t, rbar, alpha, omega);
+      r_dot_rbar = new_r_dot_rbar;
 
       if (additional_data.exact_residual)
-        {
-          r.add(-omega, t);
-          res = criterion(A, x, b, t);
-        }
+        res = criterion(A, x, b, t);
       else
-        res = std::sqrt(real_type(r.add_and_dot(-omega, t, r)));
+        res = std::sqrt(r_squared);
 
       state = this->iteration_status(step, res, x);
       print_vectors(step, x, r, y);
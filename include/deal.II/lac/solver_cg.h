@@ -18,17 +18,28 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/logstream.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/vectorization.h>
 
+#include <deal.II/lac/block_vector_base.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/lapack_full_matrix.h>
 #include <deal.II/lac/solver.h>
 #include <deal.II/lac/solver_control.h>
 #include <deal.II/lac/tridiagonal_matrix.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/lac/vector_operations_internal.h>
 
+#include <array>
 #include <cmath>
+#include <initializer_list>
+#include <utility>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -41,7 +52,9 @@ namespace LinearAlgebra
   {
     template <typename, typename>
     class Vector;
-  }
+    template <typename>
+    class BlockVector;
+  } // namespace distributed
 } // namespace LinearAlgebra
 #endif
 
@@ -66,7 +79,10 @@ namespace LinearAlgebra
  * SolverFlexibleCG, that allows to use a variable preconditioner or a
  * preconditioner with some slight non-symmetry (like weighted Schwarz
  * methods), by using a different formula for the step length in the
- * computation of the next search direction.
+ * computation of the next search direction. For sequences of linear systems
+ * with the same or slowly changing matrices, SolverDeflatedCG reuses
+ * approximate eigenvectors from previous solves to reduce the number of
+ * iterations.
  *
  *
  * <h3>Eigenvalue computation</h3>
@@ -387,6 +403,348 @@ public:
 };
 
 
+
+/**
+ * This class implements the deflated conjugate gradient method by Saad,
+ * Yeung, Erhel, and Guyomarc'h (@cite Saad2000), which recycles information
+ * from previous solves when a sequence of linear systems with the same or a
+ * slowly changing matrix is solved, as it appears for example in time
+ * stepping or in nonlinear iterations. The iteration is kept
+ * $A$-orthogonal to a small deflation space $W$ spanned by approximate
+ * eigenvectors of the smallest eigenvalues of the preconditioned matrix.
+ * This removes these eigenvalues from the spectrum seen by the
+ * conjugate gradient method and hence reduces the number of iterations,
+ * in particular for the slowly converging modes that a simple
+ * preconditioner does not capture well.
+ *
+ * The deflation space is stored in this object and is updated at the end of
+ * each call to solve(): The search directions of the first
+ * AdditionalData::n_harvest_iterations iterations are kept, and the
+ * harmonic Ritz vectors with the smallest harmonic Ritz values of the
+ * preconditioned matrix in the space spanned by $W$ and these search
+ * directions are selected as the new deflation space of dimension
+ * AdditionalData::n_deflation_vectors. The matrices needed for this
+ * Rayleigh-Ritz procedure follow from the coefficients of the conjugate
+ * gradient recurrence, so that no additional matrix-vector products with
+ * the search directions are necessary. The first solve is hence a plain
+ * conjugate gradient solve, and the subsequent solves benefit from the
+ * deflation space accumulated so far.
+ *
+ * At the beginning of each solve, the products of the matrix with the
+ * deflation vectors are recomputed with the current matrix, which costs
+ * AdditionalData::n_deflation_vectors matrix-vector products and
+ * preconditioner applications. The matrix is thus allowed to change between
+ * solves, in which case the deflation space is no longer exactly composed
+ * of approximate eigenvectors but still remains a good coarse space as long
+ * as the change is small. If the size of the system changes, e.g., after
+ * mesh refinement, the deflation space must be discarded by calling
+ * clear_deflation_space(). The preconditioner must be symmetric and
+ * positive definite, as for SolverCG.
+ *
+ * Each iteration costs, in addition to the work of SolverCG,
+ * AdditionalData::n_deflation_vectors inner products and vector updates.
+ * The memory needed for the search directions kept during the first
+ * iterations amounts to AdditionalData::n_harvest_iterations vectors.
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverDeflatedCG : public SolverCG<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor. By default, a deflation space of dimension eight is
+     * extracted from the search directions of the first 24 iterations.
+     */
+    explicit AdditionalData(const unsigned int n_deflation_vectors  = 8,
+                            const unsigned int n_harvest_iterations = 24);
+
+    /**
+     * The maximal dimension of the deflation space. If zero, no
+     * deflation space is built and the solver behaves like SolverCG.
+     */
+    unsigned int n_deflation_vectors;
+
+    /**
+     * The number of iterations at the beginning of each solve whose search
+     * directions are kept to update the deflation space.
+     */
+    unsigned int n_harvest_iterations;
+  };
+
+  /**
+   * Constructor.
+   */
+  SolverDeflatedCG(SolverControl            &cn,
+                   VectorMemory<VectorType> &mem,
+                   const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverDeflatedCG(SolverControl        &cn,
+                   const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x, using the deflation space built
+   * by the previous calls to this function, and update the deflation space
+   * afterwards.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+  /**
+   * Discard the deflation space, such that the next call to solve() starts
+   * with a plain conjugate gradient iteration.
+   */
+  void
+  clear_deflation_space();
+
+  /**
+   * Return the current dimension of the deflation space.
+   */
+  unsigned int
+  n_deflation_vectors() const;
+
+protected:
+  /**
+   * Replace the deflation space by the harmonic Ritz vectors with the
+   * smallest harmonic Ritz values in the space spanned by the current
+   * deflation vectors and the given @p search_directions. The matrices of
+   * the Rayleigh-Ritz procedure are assembled from the matrix @p coarse_matrix
+   * $W^T A W$, the matrix @p coarse_preconditioned_matrix $(AW)^T P^{-1}
+   * (AW)$, and the coefficients of the conjugate gradient recurrence
+   * recorded during the iteration, namely the step lengths @p alpha, the
+   * values $p_j^T A p_j$ in @p p_times_ap, the values $r_j^T z_j$ in
+   * @p r_times_z, and the projections $(AW)^T z_j$ of the preconditioned
+   * residuals in @p aw_times_z.
+   */
+  void
+  update_deflation_space(const std::vector<VectorType> &search_directions,
+                         const FullMatrix<double>      &coarse_matrix,
+                         const FullMatrix<double> &coarse_preconditioned_matrix,
+                         const std::vector<double>         &alpha,
+                         const std::vector<double>         &p_times_ap,
+                         const std::vector<double>         &r_times_z,
+                         const std::vector<Vector<double>> &aw_times_z);
+
+  /**
+   * Additional parameters.
+   */
+  AdditionalData deflation_data;
+
+  /**
+   * The vectors spanning the deflation space, which are kept between calls
+   * to solve().
+   */
+  std::vector<VectorType> deflation_vectors;
+};
+
+
+
+/**
+ * This class implements the pipelined preconditioned conjugate gradient
+ * method by Ghysels and Vanroose (@cite Ghysels2014). In exact arithmetic, the
+ * iterates are the same as the ones produced by SolverCG, but the algorithm
+ * is rearranged in such a way that all inner products of one iteration can be
+ * computed with a single global reduction. Furthermore, this reduction does
+ * not depend on the result of the preconditioner application and the
+ * matrix-vector product of the same iteration, which allows to overlap the
+ * communication latency of the reduction with the application of the operator
+ * and the preconditioner. This makes the method attractive on large parallel
+ * machines, where the latency of the global reductions in SolverCG limits
+ * strong scaling.
+ *
+ * The price to pay for the reduced synchronization is additional memory
+ * (six more vectors than SolverCG) and vector updates per iteration, as well
+ * as a slightly less stable recurrence for the residual. It is therefore
+ * mostly useful in the regime where the global reductions dominate the cost
+ * of an iteration, i.e., for cheap operators and preconditioners at large
+ * process counts.
+ *
+ * <h3>Optimized operations for LinearAlgebra::distributed::Vector</h3>
+ *
+ * If the `VectorType` is LinearAlgebra::distributed::Vector on the host
+ * memory space, the three local inner products needed by every iteration are
+ * computed in a single sweep through the vectors, and the associated global
+ * sum is started as a non-blocking MPI_Iallreduce before the preconditioner
+ * and the matrix are applied. The result of the reduction is only awaited
+ * after the matrix-vector product has finished. Likewise, the eight vector
+ * updates at the end of an iteration are merged into a single loop. For
+ * other vector types, the inner products and vector updates are computed by
+ * the generic vector interface.
+ *
+ * The residual norm reported to the SolverControl object in iteration $k$ is
+ * the norm of the recursively updated residual $r_k$, which is computed as
+ * part of the fused reduction. Since the check is performed after the
+ * operator has been applied in the same iteration, this class does one more
+ * operator and preconditioner evaluation than SolverCG upon convergence.
+ */
+template <typename VectorType = Vector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   * Here, it does not store anything but just exists for consistency
+   * with the other solver classes.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverPipelinedCG(SolverControl            &cn,
+                    VectorMemory<VectorType> &mem,
+                    const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverPipelinedCG(SolverControl        &cn,
+                    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+
+/**
+ * This class implements the preconditioned conjugate gradient method for
+ * the simultaneous solution of several linear systems $Ax_j=b_j$,
+ * $j=0,\ldots,s-1$, with the same symmetric positive definite matrix $A$ and
+ * preconditioner, but with different right hand sides. Typical applications
+ * are parameter sweeps or the computation of several adjoint solutions for
+ * the same operator.
+ *
+ * The right hand sides and solutions are stored as the blocks of a block
+ * vector, i.e., `VectorType` is expected to be a block vector such as
+ * LinearAlgebra::distributed::BlockVector where block $j$ holds the vector
+ * of the $j$-th system and all blocks share the same layout. The matrix and
+ * the preconditioner passed to solve() are applied to the whole block vector
+ * at once, i.e., they need to provide a function `vmult(VectorType &dst,
+ * const VectorType &src)` that applies the (same) operator to every block of
+ * `src`. This is where the method draws its performance advantage from
+ * compared to solving the systems one after the other with SolverCG: A
+ * matrix-free operator based on MatrixFree::cell_loop, which natively
+ * supports block vectors, reads the mapping data, the indices and the
+ * coefficients only once for all right hand sides, which increases the
+ * arithmetic intensity of the operator evaluation. Furthermore, the inner
+ * products of all systems are gathered into two global reductions per
+ * iteration, independently of the number of right hand sides.
+ *
+ * Note that the "block" in the name refers to the block vector holding the
+ * systems: The coefficients of the iteration are computed separately for
+ * each block, so every block undergoes the same iteration as it would with
+ * SolverCG (up to round-off). This is different from the block conjugate
+ * gradient method of O'Leary, which would search in the space spanned by all
+ * right hand sides at the price of small dense matrix operations and
+ * factorizations in each iteration.
+ *
+ * The residual reported to the SolverControl object is the largest of the
+ * residual norms of the individual systems, such that the iteration stops
+ * once all systems have converged. Systems that have reached exactly zero
+ * residual are not updated any more.
+ *
+ * <h3>Optimized operations for LinearAlgebra::distributed::BlockVector</h3>
+ *
+ * If the `VectorType` is LinearAlgebra::distributed::BlockVector, the local
+ * inner products of all blocks are computed first and then summed up by a
+ * single call to Utilities::MPI::sum(). For other block vector types, the
+ * inner products are computed block by block through the vector interface.
+ */
+template <typename VectorType = BlockVector<double>>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+class SolverBlockCG : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   * Here, it does not store anything but just exists for consistency
+   * with the other solver classes.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverBlockCG(SolverControl            &cn,
+                VectorMemory<VectorType> &mem,
+                const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverBlockCG(SolverControl        &cn,
+                const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear systems $Ax_j=b_j$ for all blocks $j$ of the vectors
+   * @p x and @p b.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+  void solve(const MatrixType         &A,
+             VectorType               &x,
+             const VectorType         &b,
+             const PreconditionerType &preconditioner);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+
 /** @} */
 
 /*------------------------- Implementation ----------------------------*/
@@ -1418,6 +1776,916 @@ SolverFlexibleCG<VectorType>::SolverFlexibleCG(SolverControl &cn,
 
 
 
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverDeflatedCG<VectorType>::AdditionalData::AdditionalData(
+  const unsigned int n_deflation_vectors,
+  const unsigned int n_harvest_iterations)
+  : n_deflation_vectors(n_deflation_vectors)
+  , n_harvest_iterations(n_harvest_iterations)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverDeflatedCG<VectorType>::SolverDeflatedCG(SolverControl            &cn,
+                                               VectorMemory<VectorType> &mem,
+                                               const AdditionalData &data)
+  : SolverCG<VectorType>(cn, mem)
+  , deflation_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverDeflatedCG<VectorType>::SolverDeflatedCG(SolverControl        &cn,
+                                               const AdditionalData &data)
+  : SolverCG<VectorType>(cn)
+  , deflation_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+void SolverDeflatedCG<VectorType>::clear_deflation_space()
+{
+  deflation_vectors.clear();
+}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+unsigned int SolverDeflatedCG<VectorType>::n_deflation_vectors() const
+{
+  return deflation_vectors.size();
+}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverDeflatedCG<VectorType>::solve(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  using number = typename VectorType::value_type;
+
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("deflated cg");
+
+  const bool do_eigenvalues = !this->condition_number_signal.empty() ||
+                              !this->all_condition_numbers_signal.empty() ||
+                              !this->eigenvalues_signal.empty() ||
+                              !this->all_eigenvalues_signal.empty();
+
+  std::vector<number> diagonal;
+  std::vector<number> offdiagonal;
+  number              eigen_beta_alpha = 0;
+
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &z = *z_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &q = *q_pointer;
+
+  r.reinit(x, true);
+  z.reinit(x, true);
+  p.reinit(x, true);
+  q.reinit(x, true);
+
+  // Compute the products of the matrix with the deflation vectors with the
+  // current matrix, the coarse matrix E = W^T A W and its inverse, as well as
+  // the matrix H = (AW)^T P^{-1} (AW) needed to update the deflation space
+  const unsigned int n_w = deflation_vectors.size();
+  for (unsigned int i = 0; i < n_w; ++i)
+    AssertDimension(deflation_vectors[i].size(), x.size());
+
+  std::vector<VectorType> aw(n_w);
+  FullMatrix<double>      coarse_matrix(n_w, n_w);
+  FullMatrix<double>      coarse_preconditioned_matrix(n_w, n_w);
+  for (unsigned int i = 0; i < n_w; ++i)
+    {
+      aw[i].reinit(x, true);
+      A.vmult(aw[i], deflation_vectors[i]);
+      preconditioner.vmult(z, aw[i]);
+      for (unsigned int j = 0; j <= i; ++j)
+        {
+          coarse_matrix(i, j) = coarse_matrix(j, i) =
+            deflation_vectors[j] * aw[i];
+          coarse_preconditioned_matrix(i, j) =
+            coarse_preconditioned_matrix(j, i) = aw[j] * z;
+        }
+    }
+  FullMatrix<double> coarse_matrix_inverse(coarse_matrix);
+  if (n_w > 0)
+    coarse_matrix_inverse.gauss_jordan();
+
+  // Compute the coefficients E^{-1} v of the projection onto the deflation
+  // space, where v holds the inner products of the vectors in 'basis' with
+  // 'vector'
+  Vector<double> inner_products(n_w);
+  Vector<double> coefficients(n_w);
+
+  const auto project = [&](const std::vector<VectorType> &basis,
+                           const VectorType              &vector) {
+    for (unsigned int i = 0; i < n_w; ++i)
+      inner_products(i) = basis[i] * vector;
+    if (n_w > 0)
+      coarse_matrix_inverse.vmult(coefficients, inner_products);
+  };
+
+  // Initial residual, corrected by the solution in the deflation space such
+  // that W^T r = 0
+  A.vmult(r, x);
+  r.sadd(-1., 1., b);
+  project(deflation_vectors, r);
+  for (unsigned int i = 0; i < n_w; ++i)
+    {
+      x.add(coefficients(i), deflation_vectors[i]);
+      r.add(-coefficients(i), aw[i]);
+    }
+
+  solver_state = this->iteration_status(0, r.l2_norm(), x);
+  if (solver_state != SolverControl::iterate)
+    return;
+
+  preconditioner.vmult(z, r);
+  number rho = r * z;
+  project(aw, z);
+  p = z;
+  for (unsigned int i = 0; i < n_w; ++i)
+    p.add(-coefficients(i), deflation_vectors[i]);
+
+  // Data of the first iterations for the update of the deflation space
+  const unsigned int n_harvest_iterations =
+    deflation_data.n_deflation_vectors > 0 ?
+      deflation_data.n_harvest_iterations :
+      0;
+  std::vector<VectorType>     search_directions;
+  std::vector<double>         harvest_alpha;
+  std::vector<double>         harvest_p_times_ap;
+  std::vector<double>         harvest_r_times_z(1, rho);
+  std::vector<Vector<double>> harvest_aw_times_z(1, inner_products);
+  search_directions.reserve(n_harvest_iterations);
+
+  int it = 0;
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      A.vmult(q, p);
+      const number p_times_ap = p * q;
+      Assert(std::abs(p_times_ap) != 0., ExcDivideByZero());
+      const number alpha = rho / p_times_ap;
+
+      x.add(alpha, p);
+      r.add(-alpha, q);
+
+      preconditioner.vmult(z, r);
+      const number rho_new = r * z;
+      project(aw, z);
+
+      if (search_directions.size() < n_harvest_iterations)
+        {
+          search_directions.emplace_back(p);
+          harvest_alpha.push_back(alpha);
+          harvest_p_times_ap.push_back(p_times_ap);
+          harvest_r_times_z.push_back(rho_new);
+          harvest_aw_times_z.push_back(inner_products);
+        }
+
+      const number beta = rho_new / rho;
+      rho               = rho_new;
+
+      this->print_vectors(it, x, r, p);
+
+      this->coefficients_signal(alpha, beta);
+      if (do_eigenvalues)
+        {
+          diagonal.push_back(number(1.) / alpha + eigen_beta_alpha);
+          eigen_beta_alpha = beta / alpha;
+          offdiagonal.push_back(std::sqrt(beta) / alpha);
+        }
+      this->compute_eigs_and_cond(diagonal,
+                                  offdiagonal,
+                                  this->all_eigenvalues_signal,
+                                  this->all_condition_numbers_signal);
+
+      solver_state = this->iteration_status(it, r.l2_norm(), x);
+
+      // The new search direction is A-orthogonal to the deflation space
+      if (solver_state == SolverControl::iterate)
+        {
+          p.sadd(beta, 1., z);
+          for (unsigned int i = 0; i < n_w; ++i)
+            p.add(-coefficients(i), deflation_vectors[i]);
+        }
+    }
+
+  this->compute_eigs_and_cond(diagonal,
+                              offdiagonal,
+                              this->eigenvalues_signal,
+                              this->condition_number_signal);
+
+  if (!search_directions.empty())
+    update_deflation_space(search_directions,
+                           coarse_matrix,
+                           coarse_preconditioned_matrix,
+                           harvest_alpha,
+                           harvest_p_times_ap,
+                           harvest_r_times_z,
+                           harvest_aw_times_z);
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, r.l2_norm()));
+}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+void SolverDeflatedCG<VectorType>::update_deflation_space(
+  const std::vector<VectorType>     &search_directions,
+  const FullMatrix<double>          &coarse_matrix,
+  const FullMatrix<double>          &coarse_preconditioned_matrix,
+  const std::vector<double>         &alpha,
+  const std::vector<double>         &p_times_ap,
+  const std::vector<double>         &r_times_z,
+  const std::vector<Vector<double>> &aw_times_z)
+{
+  const unsigned int n_w = deflation_vectors.size();
+  const unsigned int n_p = search_directions.size();
+  const unsigned int n_u = n_w + n_p;
+  AssertDimension(alpha.size(), n_p);
+  AssertDimension(p_times_ap.size(), n_p);
+  AssertDimension(r_times_z.size(), n_p + 1);
+  AssertDimension(aw_times_z.size(), n_p + 1);
+
+  // Set up the generalized eigenvalue problem G s = theta F s for the
+  // harmonic Ritz values theta of the preconditioned matrix in the space
+  // U = [W, P], with F = U^T A U and G = (AU)^T P^{-1} (AU). The search
+  // directions P are A-orthogonal to each other and to W, so F is block
+  // diagonal. The products with AP follow from A p_j = (r_j - r_{j+1}) /
+  // alpha_j and the orthogonality r_i^T z_j = 0 for i != j of the residuals.
+  LAPACKFullMatrix<double> f(n_u, n_u);
+  LAPACKFullMatrix<double> g(n_u, n_u);
+  for (unsigned int i = 0; i < n_w; ++i)
+    for (unsigned int j = 0; j < n_w; ++j)
+      {
+        f(i, j) = coarse_matrix(i, j);
+        g(i, j) = coarse_preconditioned_matrix(i, j);
+      }
+  for (unsigned int j = 0; j < n_p; ++j)
+    {
+      f(n_w + j, n_w + j) = p_times_ap[j];
+      for (unsigned int i = 0; i < n_w; ++i)
+        g(i, n_w + j) = g(n_w + j, i) =
+          (aw_times_z[j](i) - aw_times_z[j + 1](i)) / alpha[j];
+      g(n_w + j, n_w + j) =
+        (r_times_z[j] + r_times_z[j + 1]) / (alpha[j] * alpha[j]);
+      if (j + 1 < n_p)
+        g(n_w + j, n_w + j + 1) = g(n_w + j + 1, n_w + j) =
+          -r_times_z[j + 1] / (alpha[j] * alpha[j + 1]);
+    }
+
+  // The eigenvectors are returned in the order of ascending eigenvalues and
+  // are normalized such that the new deflation vectors satisfy W^T A W = I
+  std::vector<Vector<double>> eigenvectors(
+    std::min(deflation_data.n_deflation_vectors, n_u));
+  g.compute_generalized_eigenvalues_symmetric(f, eigenvectors);
+
+  std::vector<VectorType> new_deflation_vectors(eigenvectors.size());
+  for (unsigned int l = 0; l < eigenvectors.size(); ++l)
+    {
+      VectorType &w = new_deflation_vectors[l];
+      w.reinit(search_directions[0]);
+      for (unsigned int i = 0; i < n_w; ++i)
+        w.add(eigenvectors[l](i), deflation_vectors[i]);
+      for (unsigned int j = 0; j < n_p; ++j)
+        w.add(eigenvectors[l](n_w + j), search_directions[j]);
+    }
+  deflation_vectors = std::move(new_deflation_vectors);
+}
+
+
+
+namespace internal
+{
+  namespace SolverPipelinedCG
+  {
+    // Implementation of the inner products and vector updates of the
+    // pipelined conjugate gradient method for generic vector types, using
+    // the operations provided by the vector interface. The inner products
+    // are stored as {(r,u), (w,u), (r,r)}.
+    template <typename VectorType>
+    struct IterationOperations
+    {
+      using Number = typename VectorType::value_type;
+
+      std::array<Number, 3> sums;
+
+      void
+      start_reduction(const VectorType &r,
+                      const VectorType &u,
+                      const VectorType &w)
+      {
+        sums[0] = r * u;
+        sums[1] = w * u;
+        sums[2] = r * r;
+      }
+
+      void
+      finish_reduction()
+      {}
+
+      void
+      update_vectors(const bool        first_iteration,
+                     const Number      alpha,
+                     const Number      beta,
+                     VectorType       &x,
+                     VectorType       &r,
+                     VectorType       &u,
+                     VectorType       &w,
+                     const VectorType &m,
+                     const VectorType &n,
+                     VectorType       &p,
+                     VectorType       &q,
+                     VectorType       &s,
+                     VectorType       &z) const
+      {
+        if (first_iteration)
+          {
+            z.equ(1., n);
+            q.equ(1., m);
+            s.equ(1., w);
+            p.equ(1., u);
+          }
+        else
+          {
+            z.sadd(beta, 1., n);
+            q.sadd(beta, 1., m);
+            s.sadd(beta, 1., w);
+            p.sadd(beta, 1., u);
+          }
+        x.add(alpha, p);
+        r.add(-alpha, s);
+        u.add(-alpha, q);
+        w.add(-alpha, z);
+      }
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::Vector, where we compute
+    // the three local inner products in a single threaded sweep through the
+    // vectors, combine them into a single global reduction, overlap the
+    // reduction with the operator evaluation by a non-blocking
+    // MPI_Iallreduce, and merge all vector updates into a single loop.
+    template <typename Number>
+    struct IterationOperations<
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+    {
+      using VectorType =
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>;
+
+      std::array<Number, 3> sums;
+
+      std::shared_ptr<parallel::internal::TBBPartitioner>
+        thread_loop_partitioner =
+          std::make_shared<parallel::internal::TBBPartitioner>();
+
+#  ifdef DEAL_II_WITH_MPI
+      MPI_Request request     = MPI_REQUEST_NULL;
+      bool        has_request = false;
+
+      ~IterationOperations()
+      {
+        // Make sure that MPI does not write into the array after it has been
+        // destroyed, e.g. if an exception was thrown while the reduction was
+        // in flight
+        if (has_request)
+          MPI_Wait(&request, MPI_STATUS_IGNORE);
+      }
+#  endif
+
+      void
+      start_reduction(const VectorType &r,
+                      const VectorType &u,
+                      const VectorType &w)
+      {
+        const Number *r_ptr = r.begin();
+        const Number *u_ptr = u.begin();
+        const Number *w_ptr = w.begin();
+
+        // Compute the three local inner products in a single threaded sweep
+        // through the vectors, with the same subranges as the other vector
+        // operations
+        sums = dealii::internal::VectorOperations::
+          parallel_sum_over_subranges<Number, 3>(
+            [&](const unsigned int begin, const unsigned int end) {
+              std::array<Number, 3> local_sums = {};
+              for (unsigned int i = begin; i < end; ++i)
+                {
+                  const Number u_conj =
+                    numbers::NumberTraits<Number>::conjugate(u_ptr[i]);
+                  local_sums[0] += r_ptr[i] * u_conj;
+                  local_sums[1] += w_ptr[i] * u_conj;
+                  local_sums[2] +=
+                    numbers::NumberTraits<Number>::abs_square(r_ptr[i]);
+                }
+              return local_sums;
+            },
+            0,
+            r.locally_owned_size(),
+            thread_loop_partitioner);
+
+#  ifdef DEAL_II_WITH_MPI
+        const MPI_Comm comm = r.get_mpi_communicator();
+        if (Utilities::MPI::job_supports_mpi() &&
+            Utilities::MPI::n_mpi_processes(comm) > 1)
+          {
+            const int ierr =
+              MPI_Iallreduce(MPI_IN_PLACE,
+                             sums.data(),
+                             sums.size(),
+                             Utilities::MPI::mpi_type_id_for_type<Number>,
+                             MPI_SUM,
+                             comm,
+                             &request);
+            AssertThrowMPI(ierr);
+            has_request = true;
+          }
+#  endif
+      }
+
+      void
+      finish_reduction()
+      {
+#  ifdef DEAL_II_WITH_MPI
+        if (has_request)
+          {
+            const int ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+            has_request = false;
+          }
+#  endif
+      }
+
+      void
+      update_vectors(const bool        first_iteration,
+                     const Number      alpha,
+                     const Number      beta_in,
+                     VectorType       &x,
+                     VectorType       &r,
+                     VectorType       &u,
+                     VectorType       &w,
+                     const VectorType &m,
+                     const VectorType &n,
+                     VectorType       &p,
+                     VectorType       &q,
+                     VectorType       &s,
+                     VectorType       &z) const
+      {
+        Number       *x_ptr = x.begin();
+        Number       *r_ptr = r.begin();
+        Number       *u_ptr = u.begin();
+        Number       *w_ptr = w.begin();
+        const Number *m_ptr = m.begin();
+        const Number *n_ptr = n.begin();
+        Number       *p_ptr = p.begin();
+        Number       *q_ptr = q.begin();
+        Number       *s_ptr = s.begin();
+        Number       *z_ptr = z.begin();
+
+        // Run the merged update through the threaded loop of the vector
+        // class. In the first iteration, the vectors p, q, s, z are
+        // uninitialized, so we must not read from them
+        if (first_iteration)
+          x.fused_operation([&](const unsigned int begin,
+                                const unsigned int end) {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = begin; i < end; ++i)
+              {
+                z_ptr[i] = n_ptr[i];
+                q_ptr[i] = m_ptr[i];
+                s_ptr[i] = w_ptr[i];
+                p_ptr[i] = u_ptr[i];
+                x_ptr[i] += alpha * p_ptr[i];
+                r_ptr[i] -= alpha * s_ptr[i];
+                u_ptr[i] -= alpha * q_ptr[i];
+                w_ptr[i] -= alpha * z_ptr[i];
+              }
+          });
+        else
+          {
+            const Number beta = beta_in;
+            x.fused_operation([&](const unsigned int begin,
+                                  const unsigned int end) {
+              DEAL_II_OPENMP_SIMD_PRAGMA
+              for (unsigned int i = begin; i < end; ++i)
+                {
+                  z_ptr[i] = n_ptr[i] + beta * z_ptr[i];
+                  q_ptr[i] = m_ptr[i] + beta * q_ptr[i];
+                  s_ptr[i] = w_ptr[i] + beta * s_ptr[i];
+                  p_ptr[i] = u_ptr[i] + beta * p_ptr[i];
+                  x_ptr[i] += alpha * p_ptr[i];
+                  r_ptr[i] -= alpha * s_ptr[i];
+                  u_ptr[i] -= alpha * q_ptr[i];
+                  w_ptr[i] -= alpha * z_ptr[i];
+                }
+            });
+          }
+      }
+    };
+  } // namespace SolverPipelinedCG
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl            &cn,
+                                                 VectorMemory<VectorType> &mem,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverPipelinedCG<VectorType>::SolverPipelinedCG(SolverControl        &cn,
+                                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverPipelinedCG<VectorType>::solve(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  using Number = typename VectorType::value_type;
+
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("pipelined_cg");
+
+  // Use the notation of the paper by Ghysels and Vanroose (2014): 'r' is
+  // the residual, 'u' the preconditioned residual, 'w = A u', 'm = P^{-1} w',
+  // 'n = A m', and 'p', 's = A p', 'q = P^{-1} s', 'z = A q' are the search
+  // direction and its images
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer u_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer w_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer m_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer n_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer q_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer s_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer z_pointer(this->memory);
+
+  VectorType &r = *r_pointer;
+  VectorType &u = *u_pointer;
+  VectorType &w = *w_pointer;
+  VectorType &m = *m_pointer;
+  VectorType &n = *n_pointer;
+  VectorType &p = *p_pointer;
+  VectorType &q = *q_pointer;
+  VectorType &s = *s_pointer;
+  VectorType &z = *z_pointer;
+
+  // Initialize without setting the vector entries, as those would soon be
+  // overwritten anyway
+  r.reinit(x, true);
+  u.reinit(x, true);
+  w.reinit(x, true);
+  m.reinit(x, true);
+  n.reinit(x, true);
+  p.reinit(x, true);
+  q.reinit(x, true);
+  s.reinit(x, true);
+  z.reinit(x, true);
+
+  // compute residual. if vector is zero, then short-circuit the full
+  // computation
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r.equ(1., b);
+
+  preconditioner.vmult(u, r);
+  A.vmult(w, u);
+
+  internal::SolverPipelinedCG::IterationOperations<VectorType> operations;
+
+  Number       alpha          = Number();
+  Number       previous_gamma = Number();
+  double       residual_norm  = 0.;
+  unsigned int it             = 0;
+
+  while (true)
+    {
+      // Start the global reduction and hide its latency behind the
+      // preconditioner and the matrix-vector product
+      operations.start_reduction(r, u, w);
+
+      preconditioner.vmult(m, w);
+      A.vmult(n, m);
+
+      operations.finish_reduction();
+
+      const Number gamma = operations.sums[0];
+      const Number delta = operations.sums[1];
+      residual_norm      = std::sqrt(std::abs(operations.sums[2]));
+
+      solver_state = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      Number beta = Number();
+      if (it > 0)
+        {
+          Assert(std::abs(previous_gamma) != 0., ExcDivideByZero());
+          Assert(std::abs(alpha) != 0., ExcDivideByZero());
+          beta = gamma / previous_gamma;
+          Assert(std::abs(delta - beta * gamma / alpha) != 0.,
+                 ExcDivideByZero());
+          alpha = gamma / (delta - beta * gamma / alpha);
+        }
+      else
+        {
+          Assert(std::abs(delta) != 0., ExcDivideByZero());
+          alpha = gamma / delta;
+        }
+
+      operations.update_vectors(
+        it == 0, alpha, beta, x, r, u, w, m, n, p, q, s, z);
+
+      previous_gamma = gamma;
+      ++it;
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+
+namespace internal
+{
+  namespace SolverBlockCG
+  {
+    // Compute the inner products of all blocks of the pairs of block vectors
+    // given in 'pairs', storing the inner product of block 'b' of the pair
+    // 'p' in 'result[p * n_blocks + b]'. This is the generic variant,
+    // which computes the inner products block by block through the vector
+    // interface.
+    template <typename VectorType>
+    struct BlockOperations
+    {
+      using Number = typename VectorType::value_type;
+
+      static void
+      inner_products(
+        const std::initializer_list<
+          std::pair<const VectorType *, const VectorType *>> &pairs,
+        std::vector<Number>                                   &result)
+      {
+        const unsigned int n_blocks = pairs.begin()->first->n_blocks();
+        result.resize(pairs.size() * n_blocks);
+
+        unsigned int p = 0;
+        for (const auto &pair : pairs)
+          {
+            for (unsigned int b = 0; b < n_blocks; ++b)
+              result[p * n_blocks + b] =
+                pair.first->block(b) * pair.second->block(b);
+            ++p;
+          }
+      }
+    };
+
+
+
+    // Specialization for LinearAlgebra::distributed::BlockVector, where we
+    // first compute all local inner products and then sum them up in a
+    // single global reduction.
+    template <typename Number>
+    struct BlockOperations<LinearAlgebra::distributed::BlockVector<Number>>
+    {
+      using VectorType = LinearAlgebra::distributed::BlockVector<Number>;
+
+      static void
+      inner_products(
+        const std::initializer_list<
+          std::pair<const VectorType *, const VectorType *>> &pairs,
+        std::vector<Number>                                   &result)
+      {
+        const auto        &first    = *pairs.begin()->first;
+        const unsigned int n_blocks = first.n_blocks();
+        result.resize(pairs.size() * n_blocks);
+
+        // Compute the local inner products with the threaded and vectorized
+        // kernels of the vector class
+        const auto thread_loop_partitioner =
+          std::make_shared<parallel::internal::TBBPartitioner>();
+        unsigned int p = 0;
+        for (const auto &pair : pairs)
+          {
+            for (unsigned int b = 0; b < n_blocks; ++b)
+              {
+                AssertDimension(pair.first->block(b).locally_owned_size(),
+                                pair.second->block(b).locally_owned_size());
+                const dealii::internal::VectorOperations::Dot<Number, Number>
+                  dot(pair.first->block(b).begin(),
+                      pair.second->block(b).begin());
+                dealii::internal::VectorOperations::parallel_reduce(
+                  dot,
+                  0,
+                  pair.first->block(b).locally_owned_size(),
+                  result[p * n_blocks + b],
+                  thread_loop_partitioner);
+              }
+            ++p;
+          }
+
+        Utilities::MPI::sum(ArrayView<const Number>(result),
+                            first.block(0).get_mpi_communicator(),
+                            ArrayView<Number>(result));
+      }
+    };
+  } // namespace SolverBlockCG
+} // namespace internal
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverBlockCG<VectorType>::SolverBlockCG(SolverControl            &cn,
+                                         VectorMemory<VectorType> &mem,
+                                         const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+SolverBlockCG<VectorType>::SolverBlockCG(SolverControl        &cn,
+                                         const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<PreconditionerType, VectorType>))
+void SolverBlockCG<VectorType>::solve(const MatrixType         &A,
+                                      VectorType               &x,
+                                      const VectorType         &b,
+                                      const PreconditionerType &preconditioner)
+{
+  static_assert(IsBlockVector<VectorType>::value,
+                "SolverBlockCG requires a block vector type, with one block "
+                "per right hand side.");
+
+  using Number = typename VectorType::value_type;
+
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("block_cg");
+
+  typename VectorMemory<VectorType>::Pointer g_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer d_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer h_pointer(this->memory);
+
+  // 'g' is the residual, 'h' the preconditioned residual, and 'd' the
+  // search direction, using the notation of SolverCG
+  VectorType &g = *g_pointer;
+  VectorType &d = *d_pointer;
+  VectorType &h = *h_pointer;
+
+  g.reinit(x, true);
+  d.reinit(x, true);
+  h.reinit(x, true);
+
+  const unsigned int n_blocks = x.n_blocks();
+  AssertDimension(b.n_blocks(), n_blocks);
+
+  // compute residual. if vector is zero, then short-circuit the full
+  // computation
+  if (!x.all_zero())
+    {
+      A.vmult(g, x);
+      g.sadd(-1., 1., b);
+    }
+  else
+    g.equ(1., b);
+
+  preconditioner.vmult(h, g);
+  d.equ(1., h);
+
+  // Gather the inner products (g,h) and (g,g) of all blocks in one
+  // reduction
+  std::vector<Number> sums;
+  using BlockOperations = internal::SolverBlockCG::BlockOperations<VectorType>;
+  BlockOperations::inner_products({{&g, &h}, {&g, &g}}, sums);
+
+  std::vector<Number> gh(sums.begin(), sums.begin() + n_blocks);
+  std::vector<Number> alpha(n_blocks), beta(n_blocks);
+
+  const auto max_residual_norm = [&]() {
+    double norm = 0.;
+    for (unsigned int j = 0; j < n_blocks; ++j)
+      norm = std::max(norm, std::sqrt(std::abs(sums[n_blocks + j])));
+    return norm;
+  };
+
+  double       residual_norm = max_residual_norm();
+  unsigned int it            = 0;
+
+  solver_state = this->iteration_status(it, residual_norm, x);
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      A.vmult(h, d);
+
+      BlockOperations::inner_products({{&d, &h}}, sums);
+
+      // Compute the step lengths of all systems. Systems whose
+      // preconditioned residual has become exactly zero have converged and
+      // are not updated any more
+      for (unsigned int j = 0; j < n_blocks; ++j)
+        {
+          if (std::abs(gh[j]) == 0.)
+            alpha[j] = Number();
+          else
+            {
+              Assert(std::abs(sums[j]) != 0., ExcDivideByZero());
+              alpha[j] = gh[j] / sums[j];
+            }
+          x.block(j).add(alpha[j], d.block(j));
+          g.block(j).add(-alpha[j], h.block(j));
+        }
+
+      preconditioner.vmult(h, g);
+
+      BlockOperations::inner_products({{&g, &h}, {&g, &g}}, sums);
+
+      residual_norm = max_residual_norm();
+      solver_state  = this->iteration_status(it, residual_norm, x);
+      if (solver_state != SolverControl::iterate)
+        break;
+
+      for (unsigned int j = 0; j < n_blocks; ++j)
+        {
+          beta[j] = (std::abs(gh[j]) == 0.) ? Number() : sums[j] / gh[j];
+          gh[j]   = sums[j];
+          d.block(j).sadd(beta[j], 1., h.block(j));
+        }
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
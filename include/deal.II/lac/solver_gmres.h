@@ -19,6 +19,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/subscriptor.h>
 #include <deal.II/base/template_constraints.h>
@@ -124,6 +125,77 @@ namespace internal
 
 
 
+    /**
+     * Class to hold the vectors of the Arnoldi basis in single precision,
+     * used by SolverGMRES if the flag
+     * SolverGMRES::AdditionalData::single_precision_basis is set. The locally
+     * owned entries of each vector are stored as `float` in a contiguous
+     * array, whereas all arithmetic with the vectors is done in double
+     * precision. This class is only implemented for the vector
+     * types of the LinearAlgebra::distributed namespace in MemorySpace::Host.
+     */
+    template <typename VectorType>
+    class SinglePrecisionBasis
+    {
+    public:
+      /**
+       * Constructor. Prepares an array of @p max_size vectors, which get
+       * allocated once they are needed.
+       */
+      SinglePrecisionBasis(const unsigned int max_size);
+
+      /**
+       * Round the vector @p v times @p factor to single precision and store
+       * it as vector number @p i.
+       */
+      void
+      set_vector(const unsigned int i,
+                 const VectorType  &v,
+                 const double       factor);
+
+      /**
+       * Copy vector number @p i into the locally owned entries of @p v.
+       */
+      void
+      get_vector(const unsigned int i, VectorType &v) const;
+
+      /**
+       * Add the inner products of @p v with the vectors <tt>0, ..., n -
+       * 1</tt> to the first @p n entries of @p h.
+       */
+      void
+      add_inner_products(const unsigned int n,
+                         const VectorType  &v,
+                         Vector<double>    &h) const;
+
+      /**
+       * Subtract the vectors <tt>0, ..., n - 1</tt> times the entries of
+       * @p h from @p v and return the norm of the resulting vector.
+       */
+      double
+      subtract_and_norm(const unsigned int    n,
+                        const Vector<double> &h,
+                        VectorType           &v) const;
+
+      /**
+       * Add the vectors <tt>0, ..., n - 1</tt> times the entries of @p h to
+       * @p p, which is set to zero before if @p zero_out is `true`.
+       */
+      void
+      add(VectorType           &p,
+          const unsigned int    n,
+          const Vector<double> &h,
+          const bool            zero_out) const;
+
+    private:
+      /**
+       * The locally owned entries of the vectors, one block after the other.
+       */
+      std::vector<AlignedVector<float>> data;
+    };
+
+
+
     /**
      * Class that performs the Arnoldi orthogonalization process within the
      * SolverGMRES and SolverFGMRES classes. It uses one of the algorithms in
@@ -176,6 +248,66 @@ namespace internal
         const boost::signals2::signal<void(int)> &reorthogonalize_signal =
           boost::signals2::signal<void(int)>());
 
+      /**
+       * Variant of the function above for an orthonormal basis stored in
+       * single precision. The vector @p vv is orthogonalized against the
+       * vectors with indices <tt>0, ..., n - 1</tt> of @p orthogonal_vectors
+       * and then stored as vector number @p n. Since the rounding of the basis
+       * vectors to single precision makes them orthogonal only up to the
+       * accuracy of `float`, the classical Gram-Schmidt method with one
+       * re-orthogonalization step is used regardless of the strategy given to
+       * initialize(), which makes @p vv orthogonal to the stored vectors in
+       * double precision.
+       */
+      template <typename VectorType>
+      double
+      orthonormalize_nth_vector(
+        const unsigned int                n,
+        VectorType                       &vv,
+        SinglePrecisionBasis<VectorType> &orthogonal_vectors);
+
+      /**
+       * Orthonormalize the block of @p k vectors at the positions <tt>n + 1,
+       * ..., n + k</tt> within the array @p orthogonal_vectors against the
+       * <tt>n + 1</tt> orthonormal vectors with indices <tt>0, ..., n</tt>
+       * and among themselves, using two passes of block classical
+       * Gram-Schmidt with Cholesky factorization of the Gram matrix. This
+       * function is used by the s-step variant of SolverGMRES, where the
+       * block has been generated from the vector at position @p n by the
+       * relation $M [v_0, \ldots, v_{k-1}] = [v_0, \ldots, v_k] B$, with
+       * $v_0$ the vector at position @p n, $M$ the (preconditioned) operator,
+       * and the $(k+1)\times k$ change-of-basis matrix $B$ given by the
+       * argument @p basis_change_matrix.
+       *
+       * From the triangular factors of the orthogonalization and the matrix
+       * $B$, the columns <tt>n, ..., n + k - 1</tt> of the upper Hessenberg
+       * matrix are computed. In contrast to orthonormalize_nth_vector(), the
+       * QR factorization of these columns is not yet updated; this is done
+       * by one call to finalize_block_column() per column, which allows the
+       * caller to check for convergence after every column.
+       *
+       * The function returns `false` if the Cholesky factorization broke down
+       * due to numerical rank deficiency of the block, in which case the
+       * vectors at positions <tt>n + 1, ..., n + k</tt> and the Hessenberg
+       * matrix are in an undefined state, and the block needs to be
+       * recomputed by the standard Arnoldi process.
+       */
+      template <typename VectorType>
+      bool
+      orthonormalize_block(const unsigned int        n,
+                           const unsigned int        k,
+                           TmpVectors<VectorType>   &orthogonal_vectors,
+                           const FullMatrix<double> &basis_change_matrix);
+
+      /**
+       * Transform the column @p col of the Hessenberg matrix computed by
+       * orthonormalize_block() into upper triangular form by Givens rotations
+       * and return the resulting estimate of the residual in the Krylov
+       * space. The columns need to be finalized in increasing order.
+       */
+      double
+      finalize_block_column(const unsigned int col);
+
       /**
        * Using the matrix and right hand side computed during the
        * factorization, solve the underlying minimization problem for the
@@ -329,6 +461,62 @@ namespace internal
  * class, see the documentation of the Solver base class.
  *
  *
+ * <h3>The s-step variant</h3>
+ *
+ * Even with the classical Gram-Schmidt variants, every step of the Arnoldi
+ * process involves at least one global reduction, which can dominate the run
+ * time on large parallel machines. If AdditionalData::s_step is set to a
+ * value $s>1$, the class instead runs the s-step (communication-avoiding)
+ * GMRES method described in @cite Hoemmen2010: Blocks of $s$ Krylov vectors
+ * are generated by $s$ successive operator evaluations without any
+ * intermediate reduction, using a Newton basis $v_{i+1} = (P^{-1}A -
+ * \theta_i I) v_i / \sigma$ to keep the basis well-conditioned. The block is
+ * then orthogonalized against the previous basis vectors and within itself by
+ * two passes of block classical Gram-Schmidt, where each pass computes the
+ * projection and the Gram matrix of the new block with a single global
+ * reduction followed by a Cholesky factorization of the Pythagorean update of
+ * the Gram matrix. As a result, the method only needs two global reductions
+ * per $s$ iterations. The Hessenberg matrix of the Arnoldi relation is
+ * recovered from the triangular factors and the change-of-basis matrix, such
+ * that convergence is still monitored in every iteration.
+ *
+ * The shifts $\theta_i$ are the Ritz values of the Hessenberg matrix
+ * obtained from $s$ steps of the standard Arnoldi process with classical
+ * Gram-Schmidt orthogonalization in the beginning of the first cycle, ordered
+ * in a modified Leja ordering. Complex conjugate pairs of Ritz values are
+ * represented in real arithmetic. The scaling factor $\sigma$ is the
+ * largest modulus among the Ritz values. Should the Cholesky factorization
+ * break down because the block is numerically rank deficient, the solver
+ * reverts to the standard Arnoldi process for the remainder of the solve.
+ * The s-step variant is only available with the default residual as stopping
+ * criterion, and the choice in AdditionalData::orthogonalization_strategy is
+ * only used for the standard Arnoldi steps, where the delayed classical
+ * Gram-Schmidt method is replaced by the classical one. For values of $s$
+ * larger than roughly 10, the Newton basis is typically not well enough
+ * conditioned in double precision, and more frequent fallbacks are to be
+ * expected.
+ *
+ *
+ * <h3>Arnoldi basis in single precision</h3>
+ *
+ * For large sizes of the Arnoldi basis, the basis vectors dominate both the
+ * memory consumption of the solver and the memory traffic of the
+ * orthogonalization. If AdditionalData::single_precision_basis is set, the
+ * basis vectors are stored in single precision, which halves both and allows
+ * for a twice as large basis within the same memory. All arithmetic, as well
+ * as the Hessenberg matrix and the solution, remain in double precision. The
+ * rounding of the basis vectors perturbs the Arnoldi relation at the level of
+ * the accuracy of `float`, which may slightly increase the number of
+ * iterations, but not the accuracy that can be reached, since the residual
+ * is recomputed in double precision on every restart. The basis vectors are
+ * orthogonalized by the classical Gram-Schmidt method with one
+ * re-orthogonalization step. This option is only available for the vector
+ * types of the LinearAlgebra::distributed namespace in MemorySpace::Host,
+ * with the default residual as stopping criterion, and without the s-step
+ * variant. The signal of connect_krylov_space_slot() is not called in this
+ * case.
+ *
+ *
  * <h3>Observing the progress of linear solver iterations</h3>
  *
  * The solve() function of this class uses the mechanism described in the
@@ -365,7 +553,9 @@ public:
      * information is disabled by default. Finally, the default
      * orthogonalization algorithm is the classical Gram-Schmidt method with
      * delayed reorthogonalization, which combines stability with fast
-     * execution, especially in parallel.
+     * execution, especially in parallel. The s-step variant of the method and
+     * the storage of the Arnoldi basis in single precision are disabled by
+     * default.
      */
     explicit AdditionalData(const unsigned int max_basis_size        = 30,
                             const bool         right_preconditioning = false,
@@ -375,7 +565,9 @@ public:
                             const LinearAlgebra::OrthogonalizationStrategy
                               orthogonalization_strategy =
                                 LinearAlgebra::OrthogonalizationStrategy::
-                                  delayed_classical_gram_schmidt);
+                                  delayed_classical_gram_schmidt,
+                            const unsigned int s_step = 1,
+                            const bool single_precision_basis = false);
 
     /**
      * Maximum number of temporary vectors. Together with max_basis_size, this
@@ -433,6 +625,21 @@ public:
      * Strategy to orthogonalize vectors.
      */
     LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy;
+
+    /**
+     * Number of Krylov vectors that are generated together in the s-step
+     * (communication-avoiding) variant of GMRES, see the section on the
+     * s-step method in the documentation of this class. A value of one
+     * selects the standard Arnoldi process.
+     */
+    unsigned int s_step;
+
+    /**
+     * Flag to store the vectors of the Arnoldi basis in single precision,
+     * see the section on the Arnoldi basis in single precision in the
+     * documentation of this class.
+     */
+    bool single_precision_basis;
   };
 
   /**
@@ -618,6 +825,18 @@ protected:
    * projected linear system.
    */
   internal::SolverGMRESImplementation::ArnoldiProcess arnoldi_process;
+
+private:
+  /**
+   * Implementation of solve() for the case that the Arnoldi basis is stored
+   * in single precision.
+   */
+  template <typename MatrixType, typename PreconditionerType>
+  void
+  solve_with_single_precision_basis(const MatrixType         &A,
+                                    VectorType               &x,
+                                    const VectorType         &b,
+                                    const PreconditionerType &preconditioner);
 };
 
 
@@ -728,7 +947,9 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   const bool                                     use_default_residual,
   const bool                                     force_re_orthogonalization,
   const bool                                     batched_mode,
-  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy)
+  const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy,
+  const unsigned int                             s_step,
+  const bool                                     single_precision_basis)
   : max_n_tmp_vectors(0)
   , max_basis_size(max_basis_size)
   , right_preconditioning(right_preconditioning)
@@ -736,10 +957,15 @@ inline SolverGMRES<VectorType>::AdditionalData::AdditionalData(
   , force_re_orthogonalization(force_re_orthogonalization)
   , batched_mode(batched_mode)
   , orthogonalization_strategy(orthogonalization_strategy)
+  , s_step(s_step)
+  , single_precision_basis(single_precision_basis)
 {
   Assert(max_basis_size >= 1,
          ExcMessage("SolverGMRES needs at least one vector in the "
                     "Arnoldi basis."));
+  Assert(s_step >= 1,
+         ExcMessage("The s-step parameter of SolverGMRES must be at least "
+                    "one."));
 }
 
 
@@ -1349,6 +1575,382 @@ namespace internal
 
 
 
+    // Compute the inner products between the k vectors at positions n + 1,
+    // ..., n + k of the array 'vectors' and all vectors at positions 0, ...,
+    // n + k up to the respective vector itself. The result for the vector
+    // n + 1 + l and vector i is stored in products(l * (n + 1 + k) + i).
+    template <typename VectorType,
+              std::enable_if_t<
+                !is_dealii_compatible_distributed_vector<VectorType>::value,
+                VectorType> * = nullptr>
+    void
+    block_inner_products(const unsigned int            n,
+                         const unsigned int            k,
+                         const TmpVectors<VectorType> &vectors,
+                         Vector<double>               &products)
+    {
+      const unsigned int n_all = n + 1 + k;
+      AssertDimension(products.size(), n_all * k);
+      for (unsigned int l = 0; l < k; ++l)
+        for (unsigned int i = 0; i < n + 2 + l; ++i)
+          products(l * n_all + i) = vectors[i] * vectors[n + 1 + l];
+    }
+
+
+
+    template <typename VectorType,
+              std::enable_if_t<
+                is_dealii_compatible_distributed_vector<VectorType>::value,
+                VectorType> * = nullptr>
+    void
+    block_inner_products(const unsigned int            n,
+                         const unsigned int            k,
+                         const TmpVectors<VectorType> &vectors,
+                         Vector<double>               &products)
+    {
+      using Number = typename VectorType::value_type;
+
+      const unsigned int n_all = n + 1 + k;
+      AssertDimension(products.size(), n_all * k);
+      products = 0.;
+
+      // Work on chunks of the vectors that fit into the L1 cache and compute
+      // all inner products on the chunk, such that each vector is only read
+      // once from main memory
+      static constexpr unsigned int n_lanes = VectorizedArray<Number>::size();
+      static constexpr unsigned int chunk_size = 64;
+      static_assert(chunk_size % n_lanes == 0,
+                    "Chunk size must be a multiple of the SIMD width");
+
+      for (unsigned int b = 0; b < n_blocks(vectors[0]); ++b)
+        {
+          const unsigned int local_size =
+            block(vectors[0], b).locally_owned_size();
+          for (unsigned int start = 0; start < local_size; start += chunk_size)
+            {
+              const unsigned int length =
+                std::min(chunk_size, local_size - start);
+              const unsigned int end_regular = length / n_lanes * n_lanes;
+              for (unsigned int l = 0; l < k; ++l)
+                {
+                  const Number *v_l =
+                    block(vectors[n + 1 + l], b).begin() + start;
+                  for (unsigned int i = 0; i < n + 2 + l; ++i)
+                    {
+                      const Number *v_i = block(vectors[i], b).begin() + start;
+                      VectorizedArray<Number> sum = 0.;
+                      for (unsigned int c = 0; c < end_regular; c += n_lanes)
+                        {
+                          VectorizedArray<Number> v_i_values, v_l_values;
+                          v_i_values.load(v_i + c);
+                          v_l_values.load(v_l + c);
+                          sum += v_i_values * v_l_values;
+                        }
+                      double scalar_sum = sum.sum();
+                      for (unsigned int c = end_regular; c < length; ++c)
+                        scalar_sum += v_i[c] * v_l[c];
+                      products(l * n_all + i) += scalar_sum;
+                    }
+                }
+            }
+        }
+
+      Utilities::MPI::sum(products,
+                          block(vectors[0], 0).get_mpi_communicator(),
+                          products);
+    }
+
+
+
+    template <typename VectorType>
+    inline SinglePrecisionBasis<VectorType>::SinglePrecisionBasis(
+      const unsigned int max_size)
+      : data(max_size)
+    {
+      static_assert(is_dealii_compatible_distributed_vector<VectorType>::value,
+                    "The Arnoldi basis can only be stored in single precision "
+                    "for LinearAlgebra::distributed::(Block)Vector in "
+                    "MemorySpace::Host.");
+    }
+
+
+
+    template <typename VectorType>
+    void
+    SinglePrecisionBasis<VectorType>::set_vector(const unsigned int i,
+                                                 const VectorType  &v,
+                                                 const double       factor)
+    {
+      AssertIndexRange(i, data.size());
+      std::size_t local_size = 0;
+      for (unsigned int b = 0; b < n_blocks(v); ++b)
+        local_size += block(v, b).locally_owned_size();
+      data[i].resize_fast(local_size);
+
+      float *values = data[i].begin();
+      for (unsigned int b = 0; b < n_blocks(v); ++b)
+        {
+          const auto        &v_block = block(v, b);
+          const unsigned int size    = v_block.locally_owned_size();
+          for (unsigned int j = 0; j < size; ++j)
+            values[j] = v_block.local_element(j) * factor;
+          values += size;
+        }
+    }
+
+
+
+    template <typename VectorType>
+    void
+    SinglePrecisionBasis<VectorType>::get_vector(const unsigned int i,
+                                                 VectorType        &v) const
+    {
+      AssertIndexRange(i, data.size());
+      const float *values = data[i].begin();
+      for (unsigned int b = 0; b < n_blocks(v); ++b)
+        {
+          auto              &v_block = block(v, b);
+          const unsigned int size    = v_block.locally_owned_size();
+          for (unsigned int j = 0; j < size; ++j)
+            v_block.local_element(j) = values[j];
+          values += size;
+        }
+      AssertDimension(values - data[i].begin(), data[i].size());
+    }
+
+
+
+    template <typename VectorType>
+    void
+    SinglePrecisionBasis<VectorType>::add_inner_products(
+      const unsigned int n,
+      const VectorType  &v,
+      Vector<double>    &h) const
+    {
+      AssertIndexRange(n, data.size() + 1);
+      AssertIndexRange(n, h.size() + 1);
+
+      // Work on chunks of the vector that fit into the L1 cache and compute
+      // all inner products on the chunk, such that v is only read once from
+      // main memory
+      static constexpr unsigned int chunk_size = 256;
+
+      Vector<double> sums(n);
+      std::size_t    offset = 0;
+      for (unsigned int b = 0; b < n_blocks(v); ++b)
+        {
+          const auto        &v_block    = block(v, b);
+          const unsigned int local_size = v_block.locally_owned_size();
+          for (unsigned int start = 0; start < local_size; start += chunk_size)
+            {
+              const unsigned int length =
+                std::min(chunk_size, local_size - start);
+              const auto *v_values = v_block.begin() + start;
+              for (unsigned int i = 0; i < n; ++i)
+                {
+                  const float *basis_values =
+                    data[i].begin() + offset + start;
+                  double sum = 0.;
+                  for (unsigned int c = 0; c < length; ++c)
+                    sum += basis_values[c] * v_values[c];
+                  sums(i) += sum;
+                }
+            }
+          offset += local_size;
+        }
+
+      Utilities::MPI::sum(sums, block(v, 0).get_mpi_communicator(), sums);
+      for (unsigned int i = 0; i < n; ++i)
+        h(i) += sums(i);
+    }
+
+
+
+    template <typename VectorType>
+    double
+    SinglePrecisionBasis<VectorType>::subtract_and_norm(
+      const unsigned int    n,
+      const Vector<double> &h,
+      VectorType           &v) const
+    {
+      AssertIndexRange(n, data.size() + 1);
+      AssertIndexRange(n, h.size() + 1);
+
+      static constexpr unsigned int chunk_size = 256;
+
+      double      norm_square = 0.;
+      std::size_t offset      = 0;
+      for (unsigned int b = 0; b < n_blocks(v); ++b)
+        {
+          auto              &v_block    = block(v, b);
+          const unsigned int local_size = v_block.locally_owned_size();
+          for (unsigned int start = 0; start < local_size; start += chunk_size)
+            {
+              const unsigned int length =
+                std::min(chunk_size, local_size - start);
+              auto *v_values = v_block.begin() + start;
+              for (unsigned int i = 0; i < n; ++i)
+                {
+                  const float *basis_values =
+                    data[i].begin() + offset + start;
+                  const double factor = h(i);
+                  for (unsigned int c = 0; c < length; ++c)
+                    v_values[c] -= factor * basis_values[c];
+                }
+              for (unsigned int c = 0; c < length; ++c)
+                norm_square += v_values[c] * v_values[c];
+            }
+          offset += local_size;
+        }
+
+      return std::sqrt(
+        Utilities::MPI::sum(norm_square, block(v, 0).get_mpi_communicator()));
+    }
+
+
+
+    template <typename VectorType>
+    void
+    SinglePrecisionBasis<VectorType>::add(VectorType           &p,
+                                          const unsigned int    n,
+                                          const Vector<double> &h,
+                                          const bool            zero_out) const
+    {
+      AssertIndexRange(n, data.size() + 1);
+
+      std::size_t offset = 0;
+      for (unsigned int b = 0; b < n_blocks(p); ++b)
+        {
+          auto              &p_block    = block(p, b);
+          const unsigned int local_size = p_block.locally_owned_size();
+          for (unsigned int j = 0; j < local_size; ++j)
+            {
+              double temp = zero_out ? 0. : p_block.local_element(j);
+              for (unsigned int i = 0; i < n; ++i)
+                temp += data[i][offset + j] * h(i);
+              p_block.local_element(j) = temp;
+            }
+          offset += local_size;
+        }
+    }
+
+
+
+    // Compute the shifts for the Newton basis of the s-step GMRES method as
+    // the Ritz values of the leading s-by-s block of the given Hessenberg
+    // matrix in modified Leja ordering, and fill the (s+1)-by-s
+    // change-of-basis matrix that represents the relation M [v_0, ...,
+    // v_{s-1}] = [v_0, ..., v_s] B, where complex conjugate pairs of Ritz
+    // values are represented in real arithmetic following Bai, Hu, and
+    // Reichel (1994). The function returns false if no valid shifts could be
+    // determined.
+    inline bool
+    compute_newton_basis(const FullMatrix<double> &hessenberg_matrix,
+                         const unsigned int        s,
+                         FullMatrix<double>       &basis_change_matrix)
+    {
+      LAPACKFullMatrix<double> mat(s, s);
+      for (unsigned int i = 0; i < s; ++i)
+        for (unsigned int j = 0; j < s; ++j)
+          mat(i, j) = hessenberg_matrix(i, j);
+      mat.compute_eigenvalues();
+
+      std::vector<std::complex<double>> candidates;
+      for (unsigned int i = 0; i < s; ++i)
+        {
+          const std::complex<double> ritz_value = mat.eigenvalue(i);
+          if (!std::isfinite(ritz_value.real()) ||
+              !std::isfinite(ritz_value.imag()))
+            return false;
+          // only keep one member of complex conjugate pairs, the other one
+          // gets added after the one with positive imaginary part
+          if (ritz_value.imag() >= 0.)
+            candidates.push_back(ritz_value);
+        }
+
+      // modified Leja ordering: start with the value of largest modulus and
+      // then successively add the value that maximizes the product of the
+      // distances to the already selected values, evaluated in terms of
+      // logarithms to avoid over- and underflow
+      std::vector<std::complex<double>> shifts;
+      std::vector<double>               log_distances(candidates.size(), 0.);
+      double                            scaling = 0.;
+      while (!candidates.empty())
+        {
+          unsigned int selected = 0;
+          if (shifts.empty())
+            {
+              for (unsigned int i = 1; i < candidates.size(); ++i)
+                if (std::abs(candidates[i]) > std::abs(candidates[selected]))
+                  selected = i;
+            }
+          else
+            for (unsigned int i = 1; i < candidates.size(); ++i)
+              if (log_distances[i] > log_distances[selected])
+                selected = i;
+
+          const std::complex<double> shift = candidates[selected];
+          scaling = std::max(scaling, std::abs(shift));
+          shifts.push_back(shift);
+          if (shift.imag() > 0.)
+            shifts.push_back(std::conj(shift));
+
+          candidates.erase(candidates.begin() + selected);
+          log_distances.erase(log_distances.begin() + selected);
+          for (unsigned int i = 0; i < candidates.size(); ++i)
+            {
+              log_distances[i] += std::log(std::abs(candidates[i] - shift));
+              if (shift.imag() > 0.)
+                log_distances[i] +=
+                  std::log(std::abs(candidates[i] - std::conj(shift)));
+            }
+        }
+
+      // LAPACK might return Ritz values that are not exactly closed under
+      // complex conjugation, in which case the pairing above does not
+      // produce s shifts; fall back to the monomial basis in that case
+      if (shifts.size() != s)
+        return false;
+
+      if (scaling == 0.)
+        scaling = 1.;
+
+      basis_change_matrix.reinit(s + 1, s);
+      for (unsigned int i = 0; i < s;)
+        {
+          const double real = shifts[i].real();
+          const double imag = shifts[i].imag();
+          if (imag > 0.)
+            {
+              // the conjugate partner always follows a shift with positive
+              // imaginary part, see above
+              AssertIndexRange(i + 1, shifts.size());
+              Assert(shifts[i + 1] == std::conj(shifts[i]),
+                     ExcInternalError());
+              // v_{i+1} = (M - real I) v_i / scaling,
+              // v_{i+2} = ((M - real I) v_{i+1} + imag^2 / scaling v_i) /
+              //           scaling
+              basis_change_matrix(i, i)         = real;
+              basis_change_matrix(i + 1, i)     = scaling;
+              basis_change_matrix(i, i + 1)     = -imag * imag / scaling;
+              basis_change_matrix(i + 1, i + 1) = real;
+              basis_change_matrix(i + 2, i + 1) = scaling;
+              i += 2;
+            }
+          else
+            {
+              // v_{i+1} = (M - real I) v_i / scaling
+              basis_change_matrix(i, i)     = real;
+              basis_change_matrix(i + 1, i) = scaling;
+              i += 1;
+            }
+        }
+
+      return true;
+    }
+
+
+
     inline void
     ArnoldiProcess::initialize(
       const LinearAlgebra::OrthogonalizationStrategy orthogonalization_strategy,
@@ -1561,6 +2163,219 @@ namespace internal
 
 
 
+    template <typename VectorType>
+    inline double
+    ArnoldiProcess::orthonormalize_nth_vector(
+      const unsigned int                n,
+      VectorType                       &vv,
+      SinglePrecisionBasis<VectorType> &orthogonal_vectors)
+    {
+      AssertIndexRange(n, hessenberg_matrix.m());
+
+      double residual_estimate = std::numeric_limits<double>::signaling_NaN();
+      if (n == 0)
+        {
+          givens_rotations.clear();
+          residual_estimate = vv.l2_norm();
+          orthogonal_vectors.set_vector(0,
+                                        vv,
+                                        residual_estimate != 0. ?
+                                          1. / residual_estimate :
+                                          1.);
+          projected_rhs(0) = residual_estimate;
+        }
+      else
+        {
+          // classical Gram-Schmidt with one re-orthogonalization step
+          h.reinit(n);
+          double norm_vv = 0.;
+          for (unsigned int c = 0; c < 2; ++c)
+            {
+              Vector<double> h_pass(n);
+              orthogonal_vectors.add_inner_products(n, vv, h_pass);
+              norm_vv = orthogonal_vectors.subtract_and_norm(n, h_pass, vv);
+              h += h_pass;
+            }
+
+          for (unsigned int i = 0; i < n; ++i)
+            hessenberg_matrix(i, n - 1) = h(i);
+          hessenberg_matrix(n, n - 1) = norm_vv;
+
+          // norm_vv is a lucky breakdown, the solver will reach convergence,
+          // but we must not divide by zero here.
+          orthogonal_vectors.set_vector(n,
+                                        vv,
+                                        norm_vv != 0. ? 1. / norm_vv : 1.);
+
+          residual_estimate = do_givens_rotation(
+            false, n - 1, triangular_matrix, givens_rotations, projected_rhs);
+        }
+
+      return residual_estimate;
+    }
+
+
+
+    template <typename VectorType>
+    inline bool
+    ArnoldiProcess::orthonormalize_block(
+      const unsigned int        n,
+      const unsigned int        k,
+      TmpVectors<VectorType>   &orthogonal_vectors,
+      const FullMatrix<double> &basis_change_matrix)
+    {
+      AssertIndexRange(n + k, hessenberg_matrix.m());
+      AssertIndexRange(n + k, orthogonal_vectors.size() + 1);
+      AssertDimension(basis_change_matrix.m(), k + 1);
+      AssertDimension(basis_change_matrix.n(), k);
+      AssertDimension(givens_rotations.size(), n);
+
+      const unsigned int n_old = n + 1;
+      const unsigned int n_all = n_old + k;
+
+      // Coefficients of the block vectors v_1, ..., v_k (as generated) in
+      // terms of the final orthonormal basis and the factors of the current
+      // orthogonalization pass
+      FullMatrix<double> block_coefficients(n_all, k);
+      FullMatrix<double> pass_coefficients(n_all, k);
+      FullMatrix<double> cholesky_factor(k, k);
+      Vector<double>     products(n_all * k);
+      Vector<double>     projection(n_old);
+
+      // Run two passes of block classical Gram-Schmidt, each with a single
+      // global reduction for both the projection onto the previous vectors
+      // and the Gram matrix of the block
+      for (unsigned int pass = 0; pass < 2; ++pass)
+        {
+          block_inner_products(n, k, orthogonal_vectors, products);
+
+          // Cholesky factorization of the Pythagorean update of the Gram
+          // matrix G - C^T C, where C contains the projections onto the
+          // previous vectors
+          for (unsigned int c = 0; c < k; ++c)
+            {
+              for (unsigned int r = 0; r <= c; ++r)
+                {
+                  double sum = products(c * n_all + n_old + r);
+                  for (unsigned int i = 0; i < n_old; ++i)
+                    sum -= products(r * n_all + i) * products(c * n_all + i);
+                  for (unsigned int i = 0; i < r; ++i)
+                    sum -= cholesky_factor(i, r) * cholesky_factor(i, c);
+                  if (r < c)
+                    cholesky_factor(r, c) = sum / cholesky_factor(r, r);
+                  else
+                    {
+                      // The block is numerically rank deficient if the
+                      // remaining part of the vector is at the level of
+                      // roundoff, as compared to its norm
+                      const double norm_square =
+                        products(c * n_all + n_old + c);
+                      const double tolerance =
+                        100. * std::numeric_limits<double>::epsilon();
+                      if (!(sum > tolerance * norm_square))
+                        return false;
+                      cholesky_factor(c, c) = std::sqrt(sum);
+                    }
+                }
+            }
+
+          // Subtract the projection and apply the inverse of the Cholesky
+          // factor to the block
+          for (unsigned int c = 0; c < k; ++c)
+            {
+              VectorType &v = orthogonal_vectors[n + 1 + c];
+              for (unsigned int i = 0; i < n_old; ++i)
+                projection(i) = -products(c * n_all + i);
+              add(v, n_old, projection, orthogonal_vectors, false);
+              for (unsigned int r = 0; r < c; ++r)
+                v.add(-cholesky_factor(r, c), orthogonal_vectors[n + 1 + r]);
+              v /= cholesky_factor(c, c);
+            }
+
+          // Combine the factors: the input V of this pass satisfies V = Q C
+          // + V_new R, so the originally generated block is given in terms of
+          // the new vectors by multiplying the previous factors with [C; R]
+          pass_coefficients = 0.;
+          for (unsigned int c = 0; c < k; ++c)
+            {
+              for (unsigned int i = 0; i < n_old; ++i)
+                pass_coefficients(i, c) = products(c * n_all + i);
+              for (unsigned int r = 0; r <= c; ++r)
+                pass_coefficients(n_old + r, c) = cholesky_factor(r, c);
+            }
+          if (pass == 0)
+            block_coefficients = pass_coefficients;
+          else
+            {
+              FullMatrix<double> first_pass(block_coefficients);
+              for (unsigned int c = 0; c < k; ++c)
+                for (unsigned int r = 0; r < n_old; ++r)
+                  {
+                    double sum = first_pass(r, c);
+                    for (unsigned int i = 0; i <= c; ++i)
+                      sum +=
+                        pass_coefficients(r, i) * first_pass(n_old + i, c);
+                    block_coefficients(r, c) = sum;
+                  }
+              for (unsigned int c = 0; c < k; ++c)
+                for (unsigned int r = 0; r <= c; ++r)
+                  {
+                    double sum = 0;
+                    for (unsigned int i = r; i <= c; ++i)
+                      sum += pass_coefficients(n_old + r, i) *
+                             first_pass(n_old + i, c);
+                    block_coefficients(n_old + r, c) = sum;
+                  }
+            }
+        }
+
+      // Compute the new columns of the Hessenberg matrix. With the
+      // coefficients R of the vectors v_0, ..., v_k in terms of the
+      // orthonormal basis (where v_0 is the vector at position n), split
+      // into R = [X; T] for the first k vectors with T upper triangular, we
+      // have M Q_{n:n+k-1} = (Q R B - M Q_{0:n-1} X) T^{-1}, where the
+      // previous columns of the Hessenberg matrix represent M Q_{0:n-1}.
+      const auto coefficient = [&](const unsigned int row,
+                                   const unsigned int col) -> double {
+        if (col == 0)
+          return row == n ? 1. : 0.;
+        else
+          return block_coefficients(row, col - 1);
+      };
+
+      FullMatrix<double> new_columns(n_all, k);
+      for (unsigned int c = 0; c < k; ++c)
+        {
+          for (unsigned int r = 0; r < n_all; ++r)
+            {
+              double sum = 0;
+              for (unsigned int i = (c > 0 ? c - 1 : 0); i < c + 2; ++i)
+                sum += coefficient(r, i) * basis_change_matrix(i, c);
+              if (r < n_old)
+                for (unsigned int i = 0; i < n; ++i)
+                  sum -= hessenberg_matrix(r, i) * coefficient(i, c);
+              for (unsigned int i = 0; i < c; ++i)
+                sum -= new_columns(r, i) * coefficient(n + i, c);
+              new_columns(r, c) = sum / coefficient(n + c, c);
+            }
+          for (unsigned int r = 0; r < n + c + 2; ++r)
+            hessenberg_matrix(r, n + c) = new_columns(r, c);
+        }
+
+      return true;
+    }
+
+
+
+    inline double
+    ArnoldiProcess::finalize_block_column(const unsigned int col)
+    {
+      return do_givens_rotation(
+        false, col, triangular_matrix, givens_rotations, projected_rhs);
+    }
+
+
+
     inline double
     ArnoldiProcess::do_givens_rotation(
       const bool                              delayed_reorthogonalization,
@@ -1789,6 +2604,21 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
                                     const VectorType         &b,
                                     const PreconditionerType &preconditioner)
 {
+  if (additional_data.single_precision_basis)
+    {
+      if constexpr (internal::SolverGMRESImplementation::
+                      is_dealii_compatible_distributed_vector<
+                        VectorType>::value)
+        solve_with_single_precision_basis(A, x, b, preconditioner);
+      else
+        AssertThrow(false,
+                    ExcMessage("The Arnoldi basis can only be stored in "
+                               "single precision for the vector types of the "
+                               "LinearAlgebra::distributed namespace in "
+                               "MemorySpace::Host."));
+      return;
+    }
+
   std::unique_ptr<LogStream::Prefix> prefix;
   if (!additional_data.batched_mode)
     prefix = std::make_unique<LogStream::Prefix>("GMRES");
@@ -1842,9 +2672,26 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
       x_->reinit(x);
     }
 
-  arnoldi_process.initialize(additional_data.orthogonalization_strategy,
-                             basis_size,
-                             additional_data.force_re_orthogonalization);
+  // Settings for the s-step variant: the change-of-basis matrix for the
+  // Newton basis gets computed from the Hessenberg matrix once the first s
+  // standard Arnoldi steps are done. The delayed classical Gram-Schmidt
+  // method lags behind by one column in the Hessenberg matrix, so we use the
+  // classical variant instead.
+  const unsigned int s_step = std::min(additional_data.s_step, basis_size);
+  bool               use_s_step = s_step > 1;
+  FullMatrix<double> basis_change_matrix;
+  Assert(s_step == 1 || use_default_residual,
+         ExcMessage("The s-step variant of SolverGMRES is only implemented "
+                    "for the default residual."));
+
+  arnoldi_process.initialize(
+    (use_s_step && additional_data.orthogonalization_strategy ==
+                     LinearAlgebra::OrthogonalizationStrategy::
+                       delayed_classical_gram_schmidt) ?
+      LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt :
+      additional_data.orthogonalization_strategy,
+    basis_size,
+    additional_data.force_re_orthogonalization);
 
   ///////////////////////////////////////////////////////////////////////////
   // outer iteration: loop until we either reach convergence or the maximum
@@ -1928,7 +2775,8 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
 
       // inner iteration doing at most as many steps as the size of the
       // Arnoldi basis
-      unsigned int inner_iteration = 0;
+      unsigned int inner_iteration         = 0;
+      unsigned int block_columns_remaining = 0;
       for (; (inner_iteration < basis_size &&
               iteration_state == SolverControl::iterate);
            ++inner_iteration)
@@ -1937,22 +2785,84 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
           // yet another alias
           VectorType &vv = basis_vectors(inner_iteration + 1, x);
 
-          if (left_precondition)
+          // In the s-step variant, generate a new block of Krylov vectors
+          // with the Newton basis once the previous block has been used up
+          if (use_s_step && block_columns_remaining == 0 &&
+              basis_change_matrix.m() > 0 && inner_iteration + 1 < basis_size)
+            {
+              const unsigned int k =
+                std::min(s_step, basis_size - inner_iteration);
+              FullMatrix<double> block_basis_change(k + 1, k);
+              for (unsigned int i = 0; i < k + 1; ++i)
+                for (unsigned int j = 0; j < k; ++j)
+                  block_basis_change(i, j) = basis_change_matrix(i, j);
+
+              for (unsigned int i = 0; i < k; ++i)
+                {
+                  const VectorType &v = basis_vectors[inner_iteration + i];
+                  VectorType &v_next =
+                    basis_vectors(inner_iteration + i + 1, x);
+                  if (left_precondition)
+                    {
+                      A.vmult(p, v);
+                      preconditioner.vmult(v_next, p);
+                    }
+                  else
+                    {
+                      preconditioner.vmult(p, v);
+                      A.vmult(v_next, p);
+                    }
+                  const double scaling = 1. / block_basis_change(i + 1, i);
+                  v_next.sadd(scaling,
+                              -block_basis_change(i, i) * scaling,
+                              v);
+                  if (i > 0 && block_basis_change(i - 1, i) != 0.)
+                    v_next.add(-block_basis_change(i - 1, i) * scaling,
+                               basis_vectors[inner_iteration + i - 1]);
+                }
+
+              if (arnoldi_process.orthonormalize_block(inner_iteration,
+                                                       k,
+                                                       basis_vectors,
+                                                       block_basis_change))
+                block_columns_remaining = k;
+              else
+                use_s_step = false;
+            }
+
+          if (block_columns_remaining > 0)
             {
-              A.vmult(p, basis_vectors[inner_iteration]);
-              preconditioner.vmult(vv, p);
+              res = arnoldi_process.finalize_block_column(inner_iteration);
+              --block_columns_remaining;
             }
           else
             {
-              preconditioner.vmult(p, basis_vectors[inner_iteration]);
-              A.vmult(vv, p);
+              if (left_precondition)
+                {
+                  A.vmult(p, basis_vectors[inner_iteration]);
+                  preconditioner.vmult(vv, p);
+                }
+              else
+                {
+                  preconditioner.vmult(p, basis_vectors[inner_iteration]);
+                  A.vmult(vv, p);
+                }
+
+              res = arnoldi_process.orthonormalize_nth_vector(
+                inner_iteration + 1,
+                basis_vectors,
+                accumulated_iterations,
+                re_orthogonalize_signal);
             }
 
-          res =
-            arnoldi_process.orthonormalize_nth_vector(inner_iteration + 1,
-                                                      basis_vectors,
-                                                      accumulated_iterations,
-                                                      re_orthogonalize_signal);
+          // Compute the shifts of the Newton basis for the s-step variant
+          // from the Ritz values of the standard Arnoldi steps
+          if (use_s_step && basis_change_matrix.m() == 0 &&
+              inner_iteration + 1 == s_step)
+            use_s_step = internal::SolverGMRESImplementation::
+              compute_newton_basis(arnoldi_process.get_hessenberg_matrix(),
+                                   s_step,
+                                   basis_change_matrix);
 
           if (use_default_residual)
             {
@@ -2057,6 +2967,159 @@ void SolverGMRES<VectorType>::solve(const MatrixType         &A,
 
 
 
+template <typename VectorType>
+DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
+template <typename MatrixType, typename PreconditionerType>
+void SolverGMRES<VectorType>::solve_with_single_precision_basis(
+  const MatrixType         &A,
+  VectorType               &x,
+  const VectorType         &b,
+  const PreconditionerType &preconditioner)
+{
+  Assert(additional_data.use_default_residual,
+         ExcMessage("The Arnoldi basis in single precision is only "
+                    "implemented for the default residual."));
+  Assert(additional_data.s_step == 1,
+         ExcMessage("The Arnoldi basis in single precision is not "
+                    "implemented for the s-step variant."));
+
+  std::unique_ptr<LogStream::Prefix> prefix;
+  if (!additional_data.batched_mode)
+    prefix = std::make_unique<LogStream::Prefix>("GMRES");
+
+  const unsigned int basis_size =
+    (additional_data.max_basis_size > 0 ?
+       additional_data.max_basis_size :
+       std::max(additional_data.max_n_tmp_vectors, 3u) - 2);
+
+  // The basis vectors are stored in single precision, so we only need two
+  // vectors in full precision: v holds the current basis vector and the
+  // result of the operator evaluation, p the intermediate result
+  internal::SolverGMRESImplementation::SinglePrecisionBasis<VectorType>
+    basis_vectors(basis_size + 1);
+  typename VectorMemory<VectorType>::Pointer v_pointer(this->memory);
+  typename VectorMemory<VectorType>::Pointer p_pointer(this->memory);
+  VectorType                                &v = *v_pointer;
+  VectorType                                &p = *p_pointer;
+  v.reinit(x, true);
+  p.reinit(x, true);
+
+  unsigned int accumulated_iterations = 0;
+
+  const bool do_eigenvalues =
+    !additional_data.batched_mode &&
+    (!condition_number_signal.empty() ||
+     !all_condition_numbers_signal.empty() || !eigenvalues_signal.empty() ||
+     !all_eigenvalues_signal.empty() || !hessenberg_signal.empty() ||
+     !all_hessenberg_signal.empty());
+
+  SolverControl::State iteration_state = SolverControl::iterate;
+  double               res             = std::numeric_limits<double>::lowest();
+
+  const bool left_precondition = !additional_data.right_preconditioning;
+
+  arnoldi_process.initialize(
+    LinearAlgebra::OrthogonalizationStrategy::classical_gram_schmidt,
+    basis_size,
+    true);
+
+  const auto check = [&]() {
+    if (additional_data.batched_mode)
+      return solver_control.check(accumulated_iterations, res);
+    else
+      return this->iteration_status(accumulated_iterations, res, x);
+  };
+
+  do
+    {
+      if (left_precondition)
+        {
+          if (accumulated_iterations == 0 && x.all_zero())
+            preconditioner.vmult(v, b);
+          else
+            {
+              A.vmult(p, x);
+              p.sadd(-1., 1., b);
+              preconditioner.vmult(v, p);
+            }
+        }
+      else
+        {
+          if (accumulated_iterations == 0 && x.all_zero())
+            v = b;
+          else
+            {
+              A.vmult(v, x);
+              v.sadd(-1., 1., b);
+            }
+        }
+
+      res = arnoldi_process.orthonormalize_nth_vector(0, v, basis_vectors);
+      iteration_state = check();
+      if (iteration_state != SolverControl::iterate)
+        break;
+
+      unsigned int inner_iteration = 0;
+      for (; (inner_iteration < basis_size &&
+              iteration_state == SolverControl::iterate);
+           ++inner_iteration)
+        {
+          ++accumulated_iterations;
+
+          // evaluate the operator on the basis vector as stored, such that
+          // the Arnoldi relation refers to the rounded vectors
+          basis_vectors.get_vector(inner_iteration, v);
+          if (left_precondition)
+            {
+              A.vmult(p, v);
+              preconditioner.vmult(v, p);
+            }
+          else
+            {
+              preconditioner.vmult(p, v);
+              A.vmult(v, p);
+            }
+
+          res = arnoldi_process.orthonormalize_nth_vector(inner_iteration + 1,
+                                                          v,
+                                                          basis_vectors);
+          iteration_state = check();
+        }
+
+      const Vector<double> &projected_solution =
+        arnoldi_process.solve_projected_system(true);
+
+      if (do_eigenvalues)
+        compute_eigs_and_cond(arnoldi_process.get_hessenberg_matrix(),
+                              inner_iteration,
+                              all_eigenvalues_signal,
+                              all_hessenberg_signal,
+                              condition_number_signal);
+
+      if (left_precondition)
+        basis_vectors.add(x, inner_iteration, projected_solution, false);
+      else
+        {
+          basis_vectors.add(p, inner_iteration, projected_solution, true);
+          preconditioner.vmult(v, p);
+          x.add(1., v);
+        }
+
+      if (iteration_state != SolverControl::iterate && do_eigenvalues)
+        compute_eigs_and_cond(arnoldi_process.get_hessenberg_matrix(),
+                              inner_iteration,
+                              eigenvalues_signal,
+                              hessenberg_signal,
+                              condition_number_signal);
+    }
+  while (iteration_state == SolverControl::iterate);
+
+  AssertThrow(iteration_state == SolverControl::success,
+              SolverControl::NoConvergence(accumulated_iterations, res));
+}
+
+
+
 template <typename VectorType>
 DEAL_II_CXX20_REQUIRES(concepts::is_vector_space_vector<VectorType>)
 boost::signals2::connection
@@ -0,0 +1,262 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_solver_mixed_precision_h
+#define dealii_solver_mixed_precision_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/logstream.h>
+#include <deal.II/base/template_constraints.h>
+
+#include <deal.II/lac/solver.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/vector_memory.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * Implementation of a mixed-precision iterative refinement (defect
+ * correction) scheme. The outer iteration computes the residual
+ * $r_k = b - Ax_k$ of the linear system in the precision of `VectorType`,
+ * typically `double`, whereas the correction $d_k \approx A^{-1} r_k$ is
+ * computed by an inner solver working on vectors of type `InnerVectorType`,
+ * typically the same vector class with `float` entries:
+ * @f{align*}{
+ *   r_k &= b - A x_k, \\
+ *   d_k &= \tilde{A}^{-1} r_k, \\
+ *   x_{k+1} &= x_k + d_k.
+ * @f}
+ * Since the inner solver only needs to reduce the residual by a moderate
+ * factor in each outer iteration (e.g., by $10^{-2}$ to $10^{-4}$), its
+ * operations can be performed in single precision without affecting the
+ * accuracy of the final solution, as long as the residual is computed in
+ * double precision. For memory-bandwidth bound operations, such as
+ * matrix-free operator evaluation or multigrid V-cycles, this roughly halves
+ * the cost of the inner iteration. See, e.g., the multigrid solver in step-37
+ * for a manual implementation of this concept.
+ *
+ * The convergence of the outer iteration is controlled by the SolverControl
+ * object passed to the constructor, based on the norm of the double-precision
+ * residual $r_k$. Every correction step counts as one iteration.
+ *
+ * The inner solver is passed to the solve() function as an object
+ * providing a function `vmult(InnerVectorType &dst, const InnerVectorType
+ * &src)` that approximately applies the inverse of the matrix. This can be
+ * a preconditioner, such as a multigrid V-cycle (PreconditionMG) on a
+ * MatrixFree<dim,float> operator, or a complete Krylov solver with its own
+ * SolverControl object, e.g. created via inverse_operator():
+ * @code
+ *   // float-precision operator, multigrid preconditioner based on
+ *   // MGTransferMF<dim,float>, and inner solver
+ *   const auto A_float     = linear_operator<VectorTypeFloat>(system_float);
+ *   ReductionControl inner_control(100, 1e-30, 1e-3);
+ *   SolverCG<VectorTypeFloat> inner_cg(inner_control);
+ *   const auto A_float_inv = inverse_operator(A_float, inner_cg, mg_float);
+ *
+ *   SolverControl outer_control(100, 1e-10 * rhs.l2_norm());
+ *   SolverMixedPrecisionRefinement<VectorType, VectorTypeFloat>
+ *     solver(outer_control);
+ *   solver.solve(system_matrix, solution, rhs, A_float_inv);
+ * @endcode
+ * When using an inner Krylov solver, keep in mind that it throws an
+ * exception if it does not reach its tolerance within the given number of
+ * iterations. Since the outer iteration corrects for an inexact inner
+ * solution anyway, it is often useful to either use an IterationNumberControl
+ * object, which never signals failure, or a ReductionControl with a generous
+ * iteration limit for the inner solver.
+ *
+ * The residual is scaled by its norm before being converted to the
+ * precision of `InnerVectorType` and the correction is scaled back
+ * afterwards. This avoids underflow of the entries in the lower precision
+ * as the outer iteration converges.
+ *
+ * The vector types are converted into each other via `reinit()` and the
+ * assignment operator, which are provided, e.g., by Vector and
+ * LinearAlgebra::distributed::Vector for different number types.
+ *
+ *
+ * <h3>Observing the progress of linear solver iterations</h3>
+ *
+ * The solve() function of this class uses the mechanism described in the
+ * Solver base class to determine convergence. This mechanism can also be used
+ * to observe the progress of the iteration.
+ *
+ *
+ * @ingroup Solvers
+ */
+template <typename VectorType      = Vector<double>,
+          typename InnerVectorType = Vector<float>>
+DEAL_II_CXX20_REQUIRES((concepts::is_vector_space_vector<VectorType> &&
+                        concepts::is_vector_space_vector<InnerVectorType>))
+class SolverMixedPrecisionRefinement : public SolverBase<VectorType>
+{
+public:
+  /**
+   * Standardized data struct to pipe additional data to the solver.
+   * Here, it does not store anything but just exists for consistency
+   * with the other solver classes.
+   */
+  struct AdditionalData
+  {};
+
+  /**
+   * Constructor.
+   */
+  SolverMixedPrecisionRefinement(
+    SolverControl            &cn,
+    VectorMemory<VectorType> &mem,
+    const AdditionalData     &data = AdditionalData());
+
+  /**
+   * Constructor. Use an object of type GrowingVectorMemory as a default to
+   * allocate memory.
+   */
+  SolverMixedPrecisionRefinement(
+    SolverControl        &cn,
+    const AdditionalData &data = AdditionalData());
+
+  /**
+   * Solve the linear system $Ax=b$ for x, using @p inner_solver to compute
+   * the corrections in the precision of `InnerVectorType`.
+   */
+  template <typename MatrixType, typename InnerSolverType>
+  DEAL_II_CXX20_REQUIRES(
+    (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+     concepts::is_linear_operator_on<InnerSolverType, InnerVectorType>))
+  void solve(const MatrixType      &A,
+             VectorType            &x,
+             const VectorType      &b,
+             const InnerSolverType &inner_solver);
+
+protected:
+  /**
+   * Additional parameters.
+   */
+  AdditionalData additional_data;
+};
+
+/*----------------------------------------------------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES((concepts::is_vector_space_vector<VectorType> &&
+                        concepts::is_vector_space_vector<InnerVectorType>))
+SolverMixedPrecisionRefinement<VectorType, InnerVectorType>::
+  SolverMixedPrecisionRefinement(SolverControl            &cn,
+                                 VectorMemory<VectorType> &mem,
+                                 const AdditionalData     &data)
+  : SolverBase<VectorType>(cn, mem)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES((concepts::is_vector_space_vector<VectorType> &&
+                        concepts::is_vector_space_vector<InnerVectorType>))
+SolverMixedPrecisionRefinement<VectorType, InnerVectorType>::
+  SolverMixedPrecisionRefinement(SolverControl        &cn,
+                                 const AdditionalData &data)
+  : SolverBase<VectorType>(cn)
+  , additional_data(data)
+{}
+
+
+
+template <typename VectorType, typename InnerVectorType>
+DEAL_II_CXX20_REQUIRES((concepts::is_vector_space_vector<VectorType> &&
+                        concepts::is_vector_space_vector<InnerVectorType>))
+template <typename MatrixType, typename InnerSolverType>
+DEAL_II_CXX20_REQUIRES(
+  (concepts::is_linear_operator_on<MatrixType, VectorType> &&
+   concepts::is_linear_operator_on<InnerSolverType, InnerVectorType>))
+void SolverMixedPrecisionRefinement<VectorType, InnerVectorType>::solve(
+  const MatrixType      &A,
+  VectorType            &x,
+  const VectorType      &b,
+  const InnerSolverType &inner_solver)
+{
+  using InnerNumber = typename InnerVectorType::value_type;
+
+  SolverControl::State solver_state = SolverControl::iterate;
+
+  LogStream::Prefix prefix("MixedPrecision");
+
+  typename VectorMemory<VectorType>::Pointer r_pointer(this->memory);
+  VectorType                                &r = *r_pointer;
+  r.reinit(x, true);
+
+  GrowingVectorMemory<InnerVectorType>            inner_memory;
+  typename VectorMemory<InnerVectorType>::Pointer r_inner_pointer(
+    inner_memory);
+  typename VectorMemory<InnerVectorType>::Pointer d_inner_pointer(
+    inner_memory);
+  InnerVectorType &r_inner = *r_inner_pointer;
+  InnerVectorType &d_inner = *d_inner_pointer;
+  r_inner.reinit(x, true);
+  d_inner.reinit(x, true);
+
+  // compute residual. if vector is zero, then short-circuit the full
+  // computation
+  if (!x.all_zero())
+    {
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+    }
+  else
+    r = b;
+
+  double       residual_norm = r.l2_norm();
+  unsigned int it            = 0;
+
+  solver_state = this->iteration_status(it, residual_norm, x);
+  while (solver_state == SolverControl::iterate)
+    {
+      ++it;
+
+      // Scale the residual to unit norm in the precision of the outer
+      // iteration and only then convert it to the lower precision, to
+      // prevent underflow as the outer iteration converges. 'r' gets
+      // overwritten below anyway.
+      r *= 1. / residual_norm;
+      r_inner = r;
+
+      d_inner = InnerNumber();
+      inner_solver.vmult(d_inner, r_inner);
+
+      // Undo the scaling and apply the correction in the precision of the
+      // outer iteration, using 'r' as temporary storage
+      r = d_inner;
+      x.add(residual_norm, r);
+
+      A.vmult(r, x);
+      r.sadd(-1., 1., b);
+
+      residual_norm = r.l2_norm();
+      solver_state  = this->iteration_status(it, residual_norm, x);
+    }
+
+  AssertThrow(solver_state == SolverControl::success,
+              SolverControl::NoConvergence(it, residual_norm));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,692 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_sparse_amg_h
+#define dealii_sparse_amg_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/exceptions.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup Preconditioners
+ * @{
+ */
+
+/**
+ * An algebraic multigrid preconditioner for SparseMatrix objects based on
+ * smoothed aggregation, which does not rely on any external library.
+ *
+ * The hierarchy is set up by initialize() as follows:
+ * <ol>
+ * <li> The degrees of freedom are grouped into aggregates of strongly
+ * connected unknowns, using the three passes of Vaněk, Mandel, and Brezina
+ * (Computing 56, 1996). An off-diagonal entry $a_{ij}$ is considered strong if
+ * $|a_{ij}| \geq \theta \sqrt{|a_{ii} a_{jj}|}$ with the threshold $\theta$
+ * given by AdditionalData::strong_threshold. Unknowns without any strong
+ * connection, e.g. rows that only contain a diagonal entry as they arise from
+ * constrained degrees of freedom, are not aggregated and only treated by the
+ * smoother.
+ * <li> The tentative prolongator $T$ interpolates the constant vector, i.e.,
+ * it has a single unit entry per aggregated row. It is smoothed by one step
+ * of damped Jacobi, $P = (I - \omega D^{-1} A) T$, with $\omega$ given by
+ * AdditionalData::prolongator_damping divided by a Gershgorin bound of the
+ * largest eigenvalue of $D^{-1} A$.
+ * <li> The coarse matrix is computed as the Galerkin product $P^T A P$ with
+ * SparseMatrix::mmult() and SparseMatrix::Tmmult().
+ * </ol>
+ * This is repeated until the matrix has at most
+ * AdditionalData::max_coarse_size rows, no further coarsening is possible,
+ * or AdditionalData::max_n_levels levels have been created. On the coarsest
+ * level, a pseudo-inverse is computed by a singular value decomposition, so
+ * that also singular problems, e.g. the Laplacian with pure Neumann boundary
+ * conditions, can be handled.
+ *
+ * The vmult() function applies one V-cycle with PreconditionChebyshev
+ * (preconditioned by the point-Jacobi method) as pre- and post-smoother on
+ * all but the coarsest level. Since the pre- and post-smoothers are the same
+ * polynomial, the V-cycle is symmetric and the preconditioner can be used
+ * with SolverCG for symmetric positive definite matrices.
+ *
+ * The class is designed for scalar problems, as the tentative prolongator
+ * only interpolates the constant near-null space. Apart from SparseMatrix, it
+ * can be used as coarse solver in a multigrid hierarchy, e.g. by
+ * wrapping it in MGCoarseGridIterativeSolver together with SolverCG. The
+ * templated vmult() accepts any vector type with element access, such as
+ * LinearAlgebra::distributed::Vector as used by MGTransferMatrixFree, as long
+ * as all elements are owned by the calling process.
+ */
+template <typename number>
+class SparseAMG : public Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Parameters of the hierarchy and of the V-cycle.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double       strong_threshold    = 0.08,
+                   const double       prolongator_damping = 4. / 3.,
+                   const unsigned int smoother_degree     = 2,
+                   const double       smoothing_range     = 20.,
+                   const unsigned int max_coarse_size     = 200,
+                   const unsigned int max_n_levels        = 20);
+
+    /**
+     * Threshold $\theta$ for the strength of connection, see the class
+     * documentation.
+     */
+    double strong_threshold;
+
+    /**
+     * Damping factor of the Jacobi step applied to the tentative
+     * prolongator, relative to the inverse of the largest eigenvalue of
+     * $D^{-1}A$.
+     */
+    double prolongator_damping;
+
+    /**
+     * Polynomial degree of the Chebyshev smoother, see
+     * PreconditionChebyshev::AdditionalData::degree.
+     */
+    unsigned int smoother_degree;
+
+    /**
+     * Ratio between the largest eigenvalue and the lower end of the range
+     * treated by the Chebyshev smoother, see
+     * PreconditionChebyshev::AdditionalData::smoothing_range.
+     */
+    double smoothing_range;
+
+    /**
+     * Coarsening stops once a level has at most this number of rows. The
+     * coarsest matrix is inverted densely.
+     */
+    unsigned int max_coarse_size;
+
+    /**
+     * Maximal number of levels of the hierarchy.
+     */
+    unsigned int max_n_levels;
+  };
+
+  /**
+   * Constructor. Does nothing.
+   *
+   * Call the @p initialize function before using this object as
+   * preconditioner.
+   */
+  SparseAMG() = default;
+
+  /**
+   * Set up the multigrid hierarchy for the given matrix. The finest level
+   * keeps a pointer to @p matrix, which must therefore remain alive as long
+   * as this object is used.
+   */
+  void
+  initialize(const SparseMatrix<number> &matrix,
+             const AdditionalData       &parameters = AdditionalData());
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Apply one V-cycle, i.e., $dst \approx A^{-1} src$.
+   */
+  void
+  vmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Apply the transpose of the preconditioner. Since the V-cycle is
+   * symmetric, this is the same as vmult().
+   */
+  void
+  Tvmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Apply one V-cycle to a vector of another type. The entries are copied
+   * into an internal vector of type Vector<number>, which requires all
+   * elements of @p src and @p dst to be accessible on the calling process.
+   */
+  template <typename VectorType>
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Same as the templated vmult().
+   */
+  template <typename VectorType>
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the number of levels of the hierarchy, including the finest one.
+   */
+  unsigned int
+  n_levels() const;
+
+  /**
+   * Return the number of rows of the matrix on the given level, where level
+   * zero is the finest level.
+   */
+  size_type
+  n_rows(const unsigned int level) const;
+
+  /**
+   * Return the operator complexity, i.e., the sum of the numbers of nonzero
+   * entries of the matrices on all levels divided by the number of nonzero
+   * entries of the matrix on the finest level.
+   */
+  double
+  operator_complexity() const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Data stored on each level of the hierarchy.
+   */
+  struct Level
+  {
+    /**
+     * Sparsity pattern and matrix computed by the Galerkin product. Unused
+     * on the finest level.
+     */
+    SparsityPattern      galerkin_sparsity;
+    SparseMatrix<number> galerkin_matrix;
+
+    /**
+     * Pointer to the matrix of this level, i.e., either to the matrix passed
+     * to initialize() or to galerkin_matrix.
+     */
+    SmartPointer<const SparseMatrix<number>> matrix;
+
+    /**
+     * Prolongation from the next coarser level to this one. Unused on the
+     * coarsest level.
+     */
+    SparsityPattern      prolongation_sparsity;
+    SparseMatrix<number> prolongation;
+
+    /**
+     * Smoother of this level. Unused on the coarsest level.
+     */
+    PreconditionChebyshev<SparseMatrix<number>, Vector<number>> smoother;
+
+    /**
+     * Vectors used during the V-cycle.
+     */
+    mutable Vector<number> solution;
+    mutable Vector<number> rhs;
+    mutable Vector<number> residual;
+  };
+
+  /**
+   * Group the rows of @p matrix into aggregates. Returns the number of
+   * aggregates and fills @p aggregates with the aggregate index of each row,
+   * or numbers::invalid_unsigned_int for rows that are not aggregated.
+   */
+  static unsigned int
+  compute_aggregates(const SparseMatrix<number> &matrix,
+                     const double                strong_threshold,
+                     std::vector<unsigned int>  &aggregates);
+
+  /**
+   * Compute the smoothed prolongator from the aggregates.
+   */
+  static void
+  compute_prolongation(const SparseMatrix<number>      &matrix,
+                       const std::vector<unsigned int> &aggregates,
+                       const unsigned int               n_aggregates,
+                       const double                     damping,
+                       SparsityPattern                 &sparsity,
+                       SparseMatrix<number>            &prolongation);
+
+  /**
+   * Recursively apply the V-cycle starting at the given level, using the
+   * vectors Level::rhs and Level::solution as input and output.
+   */
+  void
+  v_cycle(const unsigned int level) const;
+
+  /**
+   * The levels of the hierarchy, starting with the finest one.
+   */
+  std::vector<std::unique_ptr<Level>> levels;
+
+  /**
+   * Pseudo-inverse of the matrix on the coarsest level.
+   */
+  LAPACKFullMatrix<number> coarse_inverse;
+};
+
+/** @} */
+
+/*---------------------------- Inline functions -----------------------------*/
+
+#ifndef DOXYGEN
+
+template <typename number>
+inline SparseAMG<number>::AdditionalData::AdditionalData(
+  const double       strong_threshold,
+  const double       prolongator_damping,
+  const unsigned int smoother_degree,
+  const double       smoothing_range,
+  const unsigned int max_coarse_size,
+  const unsigned int max_n_levels)
+  : strong_threshold(strong_threshold)
+  , prolongator_damping(prolongator_damping)
+  , smoother_degree(smoother_degree)
+  , smoothing_range(smoothing_range)
+  , max_coarse_size(max_coarse_size)
+  , max_n_levels(max_n_levels)
+{}
+
+
+
+template <typename number>
+unsigned int
+SparseAMG<number>::compute_aggregates(const SparseMatrix<number> &matrix,
+                                      const double               strong_threshold,
+                                      std::vector<unsigned int> &aggregates)
+{
+  const size_type n = matrix.m();
+
+  // strong neighbors of each row, excluding the row itself
+  std::vector<std::vector<size_type>> strong_neighbors(n);
+  for (size_type i = 0; i < n; ++i)
+    {
+      const number a_ii = matrix.diag_element(i);
+      for (auto entry = matrix.begin(i); entry != matrix.end(i); ++entry)
+        {
+          const size_type j = entry->column();
+          if (j != i && entry->value() != number() &&
+              std::abs(entry->value()) >=
+                strong_threshold *
+                  std::sqrt(std::abs(a_ii * matrix.diag_element(j))))
+            strong_neighbors[i].push_back(j);
+        }
+    }
+
+  aggregates.assign(n, numbers::invalid_unsigned_int);
+  unsigned int n_aggregates = 0;
+
+  // pass 1: rows whose strong neighborhood is not yet aggregated form a new
+  // aggregate together with their neighbors
+  for (size_type i = 0; i < n; ++i)
+    {
+      if (strong_neighbors[i].empty() ||
+          aggregates[i] != numbers::invalid_unsigned_int)
+        continue;
+
+      bool neighbors_free = true;
+      for (const size_type j : strong_neighbors[i])
+        if (aggregates[j] != numbers::invalid_unsigned_int)
+          {
+            neighbors_free = false;
+            break;
+          }
+
+      if (neighbors_free)
+        {
+          aggregates[i] = n_aggregates;
+          for (const size_type j : strong_neighbors[i])
+            aggregates[j] = n_aggregates;
+          ++n_aggregates;
+        }
+    }
+
+  // pass 2: attach the remaining rows to the aggregate of the strongest
+  // neighbor from pass 1
+  const std::vector<unsigned int> aggregates_pass_1 = aggregates;
+  for (size_type i = 0; i < n; ++i)
+    if (aggregates[i] == numbers::invalid_unsigned_int &&
+        !strong_neighbors[i].empty())
+      {
+        number strongest = number();
+        for (const size_type j : strong_neighbors[i])
+          if (aggregates_pass_1[j] != numbers::invalid_unsigned_int &&
+              std::abs(matrix.el(i, j)) > strongest)
+            {
+              strongest     = std::abs(matrix.el(i, j));
+              aggregates[i] = aggregates_pass_1[j];
+            }
+      }
+
+  // pass 3: the rows that are still left form aggregates with their
+  // remaining strong neighbors
+  for (size_type i = 0; i < n; ++i)
+    if (aggregates[i] == numbers::invalid_unsigned_int &&
+        !strong_neighbors[i].empty())
+      {
+        aggregates[i] = n_aggregates;
+        for (const size_type j : strong_neighbors[i])
+          if (aggregates[j] == numbers::invalid_unsigned_int)
+            aggregates[j] = n_aggregates;
+        ++n_aggregates;
+      }
+
+  return n_aggregates;
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::compute_prolongation(
+  const SparseMatrix<number>      &matrix,
+  const std::vector<unsigned int> &aggregates,
+  const unsigned int               n_aggregates,
+  const double                     damping,
+  SparsityPattern                 &sparsity,
+  SparseMatrix<number>            &prolongation)
+{
+  const size_type n = matrix.m();
+
+  // Gershgorin bound for the largest eigenvalue of D^{-1} A
+  double max_eigenvalue = 0.;
+  for (size_type i = 0; i < n; ++i)
+    {
+      double row_sum = 0.;
+      for (auto entry = matrix.begin(i); entry != matrix.end(i); ++entry)
+        row_sum += std::abs(entry->value());
+      if (matrix.diag_element(i) != number())
+        max_eigenvalue =
+          std::max(max_eigenvalue, row_sum / std::abs(matrix.diag_element(i)));
+    }
+  const double omega = max_eigenvalue > 0. ? damping / max_eigenvalue : 0.;
+
+  DynamicSparsityPattern dsp(n, n_aggregates);
+  for (size_type i = 0; i < n; ++i)
+    for (auto entry = matrix.begin(i); entry != matrix.end(i); ++entry)
+      if (aggregates[entry->column()] != numbers::invalid_unsigned_int)
+        dsp.add(i, aggregates[entry->column()]);
+  sparsity.copy_from(dsp);
+  prolongation.reinit(sparsity);
+
+  // P = (I - omega D^{-1} A) T, where T has a unit entry in column
+  // aggregates[i] of each aggregated row i
+  for (size_type i = 0; i < n; ++i)
+    {
+      if (aggregates[i] != numbers::invalid_unsigned_int)
+        prolongation.add(i, aggregates[i], number(1.));
+
+      if (matrix.diag_element(i) == number())
+        continue;
+
+      const number factor = -omega / matrix.diag_element(i);
+      for (auto entry = matrix.begin(i); entry != matrix.end(i); ++entry)
+        if (aggregates[entry->column()] != numbers::invalid_unsigned_int)
+          prolongation.add(i,
+                           aggregates[entry->column()],
+                           factor * entry->value());
+    }
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::initialize(const SparseMatrix<number> &matrix,
+                              const AdditionalData       &parameters)
+{
+  Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
+
+  clear();
+
+  levels.emplace_back(std::make_unique<Level>());
+  levels.back()->matrix = &matrix;
+
+  std::vector<unsigned int> aggregates;
+  while (levels.size() < parameters.max_n_levels &&
+         levels.back()->matrix->m() > parameters.max_coarse_size)
+    {
+      Level                      &fine     = *levels.back();
+      const SparseMatrix<number> &fine_mat = *fine.matrix;
+
+      const unsigned int n_aggregates =
+        compute_aggregates(fine_mat, parameters.strong_threshold, aggregates);
+
+      if (n_aggregates == 0 || n_aggregates >= fine_mat.m())
+        break;
+
+      compute_prolongation(fine_mat,
+                           aggregates,
+                           n_aggregates,
+                           parameters.prolongator_damping,
+                           fine.prolongation_sparsity,
+                           fine.prolongation);
+
+      // Galerkin product P^T (A P); mmult() and Tmmult() rebuild the
+      // sparsity patterns the result matrices are associated with
+      SparsityPattern      product_sparsity;
+      SparseMatrix<number> product(product_sparsity);
+      fine_mat.mmult(product, fine.prolongation);
+
+      levels.emplace_back(std::make_unique<Level>());
+      Level &coarse = *levels.back();
+      coarse.galerkin_matrix.reinit(coarse.galerkin_sparsity);
+      fine.prolongation.Tmmult(coarse.galerkin_matrix, product);
+      coarse.matrix = &coarse.galerkin_matrix;
+    }
+
+  for (unsigned int l = 0; l < levels.size(); ++l)
+    {
+      Level &level = *levels[l];
+      level.solution.reinit(level.matrix->m());
+      level.rhs.reinit(level.matrix->m());
+
+      if (l + 1 == levels.size())
+        break;
+
+      level.residual.reinit(level.matrix->m());
+
+      typename PreconditionChebyshev<SparseMatrix<number>,
+                                     Vector<number>>::AdditionalData data;
+      data.degree          = parameters.smoother_degree;
+      data.smoothing_range = parameters.smoothing_range;
+      data.preconditioner =
+        std::make_shared<DiagonalMatrix<Vector<number>>>();
+      data.preconditioner->get_vector().reinit(level.matrix->m());
+      for (size_type i = 0; i < level.matrix->m(); ++i)
+        {
+          const number diagonal = level.matrix->diag_element(i);
+          data.preconditioner->get_vector()(i) =
+            diagonal != number() ? number(1.) / diagonal : number(1.);
+        }
+      level.smoother.initialize(*level.matrix, data);
+    }
+
+  coarse_inverse.reinit(levels.back()->matrix->m());
+  coarse_inverse = *levels.back()->matrix;
+  coarse_inverse.compute_inverse_svd(
+    1e3 * std::numeric_limits<number>::epsilon());
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::clear()
+{
+  levels.clear();
+  coarse_inverse.reinit(0);
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::v_cycle(const unsigned int l) const
+{
+  const Level &level = *levels[l];
+
+  if (l + 1 == levels.size())
+    {
+      coarse_inverse.vmult(level.solution, level.rhs);
+      return;
+    }
+
+  const Level &coarse = *levels[l + 1];
+
+  level.smoother.vmult(level.solution, level.rhs);
+  level.matrix->residual(level.residual, level.solution, level.rhs);
+  level.prolongation.Tvmult(coarse.rhs, level.residual);
+  v_cycle(l + 1);
+  level.prolongation.vmult_add(level.solution, coarse.solution);
+  level.smoother.step(level.solution, level.rhs);
+}
+
+
+
+template <typename number>
+void
+SparseAMG<number>::vmult(Vector<number> &dst, const Vector<number> &src) const
+{
+  Assert(levels.empty() == false, ExcNotInitialized());
+  AssertDimension(src.size(), levels[0]->matrix->m());
+
+  levels[0]->rhs = src;
+  v_cycle(0);
+  dst = levels[0]->solution;
+}
+
+
+
+template <typename number>
+inline void
+SparseAMG<number>::Tvmult(Vector<number> &dst, const Vector<number> &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+void
+SparseAMG<number>::vmult(VectorType &dst, const VectorType &src) const
+{
+  Assert(levels.empty() == false, ExcNotInitialized());
+  AssertDimension(src.size(), levels[0]->matrix->m());
+
+  for (size_type i = 0; i < src.size(); ++i)
+    levels[0]->rhs(i) = src(i);
+  v_cycle(0);
+  for (size_type i = 0; i < dst.size(); ++i)
+    dst(i) = levels[0]->solution(i);
+}
+
+
+
+template <typename number>
+template <typename VectorType>
+inline void
+SparseAMG<number>::Tvmult(VectorType &dst, const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <typename number>
+inline unsigned int
+SparseAMG<number>::n_levels() const
+{
+  return levels.size();
+}
+
+
+
+template <typename number>
+inline typename SparseAMG<number>::size_type
+SparseAMG<number>::n_rows(const unsigned int level) const
+{
+  AssertIndexRange(level, levels.size());
+  return levels[level]->matrix->m();
+}
+
+
+
+template <typename number>
+double
+SparseAMG<number>::operator_complexity() const
+{
+  if (levels.empty())
+    return 0.;
+
+  double n_nonzero = 0.;
+  for (const auto &level : levels)
+    n_nonzero += level->matrix->n_nonzero_elements();
+  return n_nonzero / levels[0]->matrix->n_nonzero_elements();
+}
+
+
+
+template <typename number>
+std::size_t
+SparseAMG<number>::memory_consumption() const
+{
+  std::size_t memory = sizeof(*this) + coarse_inverse.memory_consumption();
+  for (const auto &level : levels)
+    memory += level->galerkin_sparsity.memory_consumption() +
+              level->galerkin_matrix.memory_consumption() +
+              level->prolongation_sparsity.memory_consumption() +
+              level->prolongation.memory_consumption() +
+              level->solution.memory_consumption() +
+              level->rhs.memory_consumption() +
+              level->residual.memory_consumption();
+  return memory;
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif // dealii_sparse_amg_h
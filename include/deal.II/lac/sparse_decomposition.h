@@ -17,6 +17,9 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/multithread_info.h>
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/lac/sparse_matrix.h>
 
 #include <cmath>
@@ -318,11 +321,43 @@ protected:
   std::vector<const size_type *> prebuilt_lower_bound;
 
   /**
-   * Fills the #prebuilt_lower_bound array.
+   * Fills the #prebuilt_lower_bound array and the level schedules below.
    */
   void
   prebuild_lower_bound();
 
+  /**
+   * Level schedule of the strictly lower triangular part of the sparsity
+   * pattern: The rows of level @p l are
+   * <code>lower_level_rows[lower_level_starts[l]]</code> to
+   * <code>lower_level_rows[lower_level_starts[l+1]-1]</code>, and they only
+   * couple to rows of previous levels. All rows of a level can hence be
+   * processed concurrently in a forward substitution, or when computing the
+   * rows of an incomplete factorization one after the other. Becomes
+   * available after invocation of prebuild_lower_bound().
+   */
+  std::vector<size_type> lower_level_rows;
+  std::vector<size_type> lower_level_starts;
+
+  /**
+   * Same as #lower_level_rows and #lower_level_starts for the strictly upper
+   * triangular part, i.e., for backward substitutions.
+   */
+  std::vector<size_type> upper_level_rows;
+  std::vector<size_type> upper_level_starts;
+
+  /**
+   * Call @p row_operation for all rows in an order that is valid for a
+   * forward substitution (if @p upper is false) or a backward substitution
+   * (if @p upper is true). If several threads are available and the levels
+   * contain enough rows on average, the rows of each level are processed
+   * in parallel, see #lower_level_rows. Otherwise, the rows are visited in
+   * ascending or descending order, respectively.
+   */
+  template <typename RowOperation>
+  void
+  apply_level_scheduled(const bool upper, const RowOperation &row_operation) const;
+
 private:
   /**
    * In general this pointer is zero except for the case that no
@@ -407,6 +442,48 @@ SparseLUDecomposition<number>::Tvmult_add(OutVector      &dst,
   dst += tmp;
 }
 
+
+
+template <typename number>
+template <typename RowOperation>
+inline void
+SparseLUDecomposition<number>::apply_level_scheduled(
+  const bool          upper,
+  const RowOperation &row_operation) const
+{
+  const size_type               N      = this->m();
+  const std::vector<size_type> &rows   = upper ? upper_level_rows :
+                                                 lower_level_rows;
+  const std::vector<size_type> &starts = upper ? upper_level_starts :
+                                                 lower_level_starts;
+
+  // rows that are processed by one task; the levels must contain at least
+  // this many rows on average for the parallel traversal to pay off
+  const size_type grain_size = 64;
+
+  if (MultithreadInfo::n_threads() == 1 || rows.size() != N ||
+      N < grain_size * (starts.size() - 1))
+    {
+      if (upper)
+        for (size_type row = N; row-- > 0;)
+          row_operation(row);
+      else
+        for (size_type row = 0; row < N; ++row)
+          row_operation(row);
+      return;
+    }
+
+  for (size_type level = 0; level + 1 < starts.size(); ++level)
+    parallel::apply_to_subranges(
+      starts[level],
+      starts[level + 1],
+      [&](const size_type begin, const size_type end) {
+        for (size_type i = begin; i < end; ++i)
+          row_operation(rows[i]);
+      },
+      grain_size);
+}
+
 //---------------------------------------------------------------------------
 
 
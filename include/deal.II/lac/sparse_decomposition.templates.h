@@ -56,6 +56,11 @@ SparseLUDecomposition<number>::clear()
   std::vector<const size_type *> tmp;
   tmp.swap(prebuilt_lower_bound);
 
+  lower_level_rows.clear();
+  lower_level_starts.clear();
+  upper_level_rows.clear();
+  upper_level_starts.clear();
+
   SparseMatrix<number>::clear();
 
   if (own_sparsity != nullptr)
@@ -156,6 +161,52 @@ SparseLUDecomposition<number>::prebuild_lower_bound()
                                &column_numbers[rowstart_indices[row + 1]],
                                row);
     }
+
+  // compute the level schedules: the level of a row is one more than the
+  // largest level of the rows it couples to in the respective triangle. the
+  // rows are then sorted by level, keeping the natural order within a level
+  std::vector<size_type> level(N);
+
+  const auto sort_by_level = [&](const size_type         n_levels,
+                                 std::vector<size_type> &level_rows,
+                                 std::vector<size_type> &level_starts) {
+    level_starts.assign(n_levels + 1, 0);
+    for (size_type row = 0; row < N; ++row)
+      ++level_starts[level[row] + 1];
+    for (size_type l = 0; l < n_levels; ++l)
+      level_starts[l + 1] += level_starts[l];
+
+    std::vector<size_type> next(level_starts.begin(), level_starts.end() - 1);
+    level_rows.resize(N);
+    for (size_type row = 0; row < N; ++row)
+      level_rows[next[level[row]]++] = row;
+  };
+
+  size_type n_levels = 0;
+  for (size_type row = 0; row < N; ++row)
+    {
+      size_type row_level = 0;
+      for (const size_type *col = &column_numbers[rowstart_indices[row] + 1];
+           col != prebuilt_lower_bound[row];
+           ++col)
+        row_level = std::max(row_level, level[*col] + 1);
+      level[row] = row_level;
+      n_levels   = std::max(n_levels, row_level + 1);
+    }
+  sort_by_level(n_levels, lower_level_rows, lower_level_starts);
+
+  n_levels = 0;
+  for (size_type row = N; row-- > 0;)
+    {
+      size_type row_level = 0;
+      for (const size_type *col = prebuilt_lower_bound[row];
+           col != &column_numbers[rowstart_indices[row + 1]];
+           ++col)
+        row_level = std::max(row_level, level[*col] + 1);
+      level[row] = row_level;
+      n_levels   = std::max(n_levels, row_level + 1);
+    }
+  sort_by_level(n_levels, upper_level_rows, upper_level_starts);
 }
 
 template <typename number>
@@ -238,7 +289,11 @@ std::size_t
 SparseLUDecomposition<number>::memory_consumption() const
 {
   return (SparseMatrix<number>::memory_consumption() +
-          MemoryConsumption::memory_consumption(prebuilt_lower_bound));
+          MemoryConsumption::memory_consumption(prebuilt_lower_bound) +
+          MemoryConsumption::memory_consumption(lower_level_rows) +
+          MemoryConsumption::memory_consumption(lower_level_starts) +
+          MemoryConsumption::memory_consumption(upper_level_rows) +
+          MemoryConsumption::memory_consumption(upper_level_starts));
 }
 
 
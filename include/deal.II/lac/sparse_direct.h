@@ -132,11 +132,12 @@ public:
   /**
    * Factorize the matrix. This function may be called multiple times for
    * different matrices, after the object of this class has been initialized
-   * for a certain sparsity pattern. You may therefore save some computing
-   * time if you want to invert several matrices with the same sparsity
-   * pattern. However, note that the bulk of the computing time is actually
-   * spent in the factorization, so this functionality may not always be of
-   * large benefit.
+   * for a certain sparsity pattern. If the sparsity pattern of the matrix is
+   * the same as in the previous call, the symbolic factorization (i.e., the
+   * fill-reducing ordering and the analysis of the pattern) is reused and
+   * only the numeric factorization is recomputed. However, note that the
+   * bulk of the computing time is usually spent in the numeric
+   * factorization, so this functionality may not always be of large benefit.
    *
    * In contrast to the other direct solver classes, the initialization method
    * does nothing. Therefore initialize is not automatically called by this
@@ -17,6 +17,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/atomic_operations.h>
 #include <deal.II/base/mpi_stub.h>
 #include <deal.II/base/smartpointer.h>
 #include <deal.II/base/subscriptor.h>
@@ -41,6 +42,8 @@ class FullMatrix;
 template <typename Matrix>
 class BlockMatrixBase;
 template <typename number>
+class BlockSparseMatrix;
+template <typename number>
 class SparseILU;
 #  ifdef DEAL_II_WITH_MPI
 namespace Utilities
@@ -938,6 +941,36 @@ public:
       const bool       elide_zero_values      = true,
       const bool       col_indices_are_sorted = false);
 
+  /**
+   * Select whether the add() functions may be called concurrently from
+   * several threads, also for the same rows. If @p concurrent is true, every
+   * matrix entry is updated with an atomic operation. This allows to run the
+   * copier of a WorkStream loop in parallel without graph coloring, by
+   * passing all cells as a single color:
+   * @code
+   * system_matrix.set_concurrent_add(true);
+   * WorkStream::run(std::vector<std::vector<Iterator>>{all_cells},
+   *                 worker,
+   *                 copier, // calls constraints.distribute_local_to_global()
+   *                 sample_scratch_data,
+   *                 sample_copy_data);
+   * system_matrix.set_concurrent_add(false);
+   * @endcode
+   * Atomic updates are slower than plain additions when only a single thread
+   * writes into the matrix, so the setting should only be enabled for the
+   * assembly loop. Functions other than add(), such as set(), are not
+   * affected.
+   */
+  void
+  set_concurrent_add(const bool concurrent);
+
+  /**
+   * Return whether the add() functions use atomic operations, see
+   * set_concurrent_add().
+   */
+  bool
+  get_concurrent_add() const;
+
   /**
    * Multiply the entire matrix by a fixed factor.
    */
@@ -1763,6 +1796,26 @@ private:
    */
   std::size_t max_len;
 
+  /**
+   * Whether add() uses atomic operations, see set_concurrent_add().
+   */
+  bool concurrent_add = false;
+
+  /**
+   * Perform the matrix-vector product on the rows in the range
+   * [@p begin_row, @p end_row) only, overwriting the entries of @p dst if
+   * @p add is false and adding to them otherwise. The function does not
+   * start any tasks itself, which allows BlockSparseMatrix to run the
+   * products of all its blocks in a single parallel loop.
+   */
+  template <class OutVector, class InVector>
+  void
+  vmult_on_subrange(const size_type begin_row,
+                    const size_type end_row,
+                    OutVector      &dst,
+                    const InVector &src,
+                    const bool      add) const;
+
   // make all other sparse matrices friends
   template <typename somenumber>
   friend class SparseMatrix;
@@ -1775,6 +1828,10 @@ private:
   template <typename>
   friend class BlockMatrixBase;
 
+  // To allow it calling private vmult_on_subrange().
+  template <typename>
+  friend class BlockSparseMatrix;
+
   // Also give access to internal details to the iterator/accessor classes.
   template <typename, bool>
   friend class SparseMatrixIterators::Iterator;
@@ -1935,7 +1992,28 @@ SparseMatrix<number>::add(const size_type i,
       return;
     }
 
-  val[index] += value;
+  if (concurrent_add)
+    internal::atomic_add(val[index], value);
+  else
+    val[index] += value;
+}
+
+
+
+template <typename number>
+inline void
+SparseMatrix<number>::set_concurrent_add(const bool concurrent)
+{
+  concurrent_add = concurrent;
+}
+
+
+
+template <typename number>
+inline bool
+SparseMatrix<number>::get_concurrent_add() const
+{
+  return concurrent_add;
 }
 
 
@@ -76,6 +76,7 @@ SparseMatrix<number>::SparseMatrix(SparseMatrix<number> &&m) noexcept
   , cols(m.cols)
   , val(std::move(m.val))
   , max_len(m.max_len)
+  , concurrent_add(m.concurrent_add)
 {
   m.cols    = nullptr;
   m.val     = nullptr;
@@ -104,9 +105,10 @@ template <typename number>
 SparseMatrix<number> &
 SparseMatrix<number>::operator=(SparseMatrix<number> &&m) noexcept
 {
-  cols    = m.cols;
-  val     = std::move(m.val);
-  max_len = m.max_len;
+  cols           = m.cols;
+  val            = std::move(m.val);
+  max_len        = m.max_len;
+  concurrent_add = m.concurrent_add;
 
   m.cols    = nullptr;
   m.val     = nullptr;
@@ -195,34 +197,26 @@ SparseMatrix<number>::operator=(const double d)
   Assert(cols->compressed || cols->empty(),
          SparsityPattern::ExcNotCompressed());
 
-  // do initial zeroing of elements in parallel. Try to achieve a similar
-  // layout as when doing matrix-vector products, as on some NUMA systems, a
-  // memory block is assigned to memory banks where the first access is
-  // generated. For sparse matrices, the first operations is usually the
-  // operator=. The grain size is chosen to reflect the number of rows in
-  // minimum_parallel_grain_size, weighted by the number of nonzero entries
-  // per row on average.
+  // do initial zeroing of elements in parallel. Use the same layout as when
+  // doing matrix-vector products, as on NUMA systems, a memory block is
+  // assigned to memory banks where the first access is generated. For sparse
+  // matrices, the first operations is usually the operator=. We split the
+  // rows with the affinity partitioner stored in the sparsity pattern, which
+  // is also used in vmult(), such that the rows are processed by the same
+  // threads in both cases.
   const std::size_t matrix_size = cols->n_nonzero_elements();
-  const size_type   grain_size =
-    internal::SparseMatrixImplementation::minimum_parallel_grain_size *
-    (cols->n_nonzero_elements() + m()) / m();
-  if (matrix_size > grain_size)
-    parallel::apply_to_subranges(
-      0U,
-      matrix_size,
-      [this](const size_type begin, const size_type end) {
-        internal::SparseMatrixImplementation::zero_subrange(begin,
-                                                            end,
-                                                            val.get());
-      },
-      grain_size);
-  else if (matrix_size > 0)
-    {
-      if constexpr (std::is_trivial_v<number>)
-        std::memset(val.get(), 0, matrix_size * sizeof(number));
-      else
-        std::fill(val.get(), val.get() + matrix_size, 0);
-    }
+  if (matrix_size == 0)
+    return *this;
+
+  parallel::internal::apply_to_subranges_with_affinity(
+    0,
+    m(),
+    [this](const size_type begin_row, const size_type end_row) {
+      internal::SparseMatrixImplementation::zero_subrange(
+        cols->rowstart[begin_row], cols->rowstart[end_row], val.get());
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size,
+    cols->thread_loop_partitioner);
 
   return *this;
 }
@@ -261,10 +255,12 @@ SparseMatrix<number>::reinit(const SparsityPattern &sparsity)
       return;
     }
 
+  // Allocate the memory without initializing it, since the zeroing in
+  // operator= should be the first access to the memory for NUMA reasons
   const std::size_t N = cols->n_nonzero_elements();
   if (N > max_len || max_len == 0)
     {
-      val     = std::make_unique<number[]>(N);
+      val.reset(new number[N]);
       max_len = N;
     }
 
@@ -544,7 +540,7 @@ SparseMatrix<number>::add(const size_type  row,
   // look whether we found one, rather than
   // doing many binary searches
   if (elide_zero_values == false && col_indices_are_sorted == true &&
-      n_cols > 3)
+      n_cols > 3 && concurrent_add == false)
     {
       // check whether the given indices are
       // really sorted
@@ -676,7 +672,10 @@ SparseMatrix<number>::add(const size_type  row,
         }
 
     add_value:
-      val[index] += value;
+      if (concurrent_add)
+        internal::atomic_add(val[index], value);
+      else
+        val[index] += value;
       ++index;
     }
 }
@@ -778,8 +777,8 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
 
-  parallel::apply_to_subranges(
-    0U,
+  parallel::internal::apply_to_subranges_with_affinity(
+    0,
     m(),
     [this, &src, &dst](const size_type begin_row, const size_type end_row) {
       internal::SparseMatrixImplementation::vmult_on_subrange(
@@ -792,7 +791,34 @@ SparseMatrix<number>::vmult(OutVector &dst, const InVector &src) const
         dst,
         false);
     },
-    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size,
+    cols->thread_loop_partitioner);
+}
+
+
+
+template <typename number>
+template <class OutVector, class InVector>
+void
+SparseMatrix<number>::vmult_on_subrange(const size_type begin_row,
+                                        const size_type end_row,
+                                        OutVector      &dst,
+                                        const InVector &src,
+                                        const bool      add) const
+{
+  Assert(cols != nullptr, ExcNeedsSparsityPattern());
+  AssertIndexRange(end_row, m() + 1);
+  Assert(m() == dst.size(), ExcDimensionMismatch(m(), dst.size()));
+  Assert(n() == src.size(), ExcDimensionMismatch(n(), src.size()));
+
+  internal::SparseMatrixImplementation::vmult_on_subrange(begin_row,
+                                                          end_row,
+                                                          val.get(),
+                                                          cols->rowstart.get(),
+                                                          cols->colnums.get(),
+                                                          src,
+                                                          dst,
+                                                          add);
 }
 
 
@@ -836,8 +862,8 @@ SparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
 
   Assert(!PointerComparison::equal(&src, &dst), ExcSourceEqualsDestination());
 
-  parallel::apply_to_subranges(
-    0U,
+  parallel::internal::apply_to_subranges_with_affinity(
+    0,
     m(),
     [this, &src, &dst](const size_type begin_row, const size_type end_row) {
       internal::SparseMatrixImplementation::vmult_on_subrange(
@@ -850,7 +876,8 @@ SparseMatrix<number>::vmult_add(OutVector &dst, const InVector &src) const
         dst,
         true);
     },
-    internal::SparseMatrixImplementation::minimum_parallel_grain_size);
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size,
+    cols->thread_loop_partitioner);
 }
 
 
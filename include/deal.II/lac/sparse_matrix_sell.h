@@ -0,0 +1,377 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_sell_h
+#define dealii_sparse_matrix_sell_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/lac/exceptions.h>
+
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+// Forward declarations
+#ifndef DOXYGEN
+template <typename number>
+class Vector;
+template <typename number>
+class SparseMatrix;
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+#endif
+
+/**
+ * @addtogroup Matrix1
+ * @{
+ */
+
+/**
+ * A sparse matrix stored in the sliced ELLPACK format with row sorting,
+ * SELL-C-$\sigma$, as described in @cite Kreutzer2014. This class is not
+ * meant for assembly, but rather as a read-only copy of an assembled
+ * SparseMatrix that is optimized for fast matrix-vector products using the
+ * SIMD instructions of the processor.
+ *
+ * In the compressed row storage of SparseMatrix, the inner loop of a
+ * matrix-vector product runs over the entries of a single row. For the
+ * short rows typical of finite element matrices (e.g., 27 entries for
+ * trilinear elements in 3d), this loop is too short to be vectorized
+ * efficiently. The SELL-C-$\sigma$ format instead groups $C$ consecutive
+ * rows into a chunk, where $C$ is the SIMD width VectorizedArray::size().
+ * Within a chunk, all rows are padded with zeros to the length of the
+ * longest row in the chunk and the entries are stored column-wise, i.e., the
+ * $j$-th entries of the $C$ rows are contiguous in memory. The matrix-vector
+ * product then processes all $C$ rows of a chunk at once with vector
+ * loads of the matrix entries and gather operations for the source vector.
+ *
+ * To reduce the overhead from the padding, the rows within windows of
+ * $\sigma$ consecutive rows can be sorted by their length before forming
+ * the chunks, which is controlled by the `sort_window` argument of reinit().
+ * Since finite element matrices mostly have rows of the same length, small
+ * windows (or no sorting at all, the default) are usually sufficient and keep
+ * the access pattern into the source vector local.
+ *
+ * The source and destination vectors must have the same number type as the
+ * matrix. Besides Vector, the functions of this class also accept
+ * LinearAlgebra::distributed::Vector objects, as long as they are not
+ * actually distributed across several MPI processes.
+ *
+ * The matrix-vector products vmult() and vmult_add() as well as residual()
+ * are run in parallel on subranges of chunks using the task-based parallelism
+ * of the library. The transpose products are run serially since the
+ * scattered updates of the destination vector would need synchronization.
+ */
+template <typename number>
+class SparseMatrixSELL : public virtual Subscriptor
+{
+public:
+  /**
+   * Declare type for container size.
+   */
+  using size_type = types::global_dof_index;
+
+  /**
+   * Type of matrix entries. This alias is analogous to <tt>value_type</tt>
+   * in the standard library containers.
+   */
+  using value_type = number;
+
+  /**
+   * The number of rows that are grouped into a chunk, given by the number of
+   * lanes of the SIMD vectors for the given number type.
+   */
+  static constexpr unsigned int chunk_size = VectorizedArray<number>::size();
+
+  /**
+   * Constructor. Initialize an empty matrix of dimension zero times zero.
+   */
+  SparseMatrixSELL();
+
+  /**
+   * Constructor. Set up the matrix from the entries of @p matrix by calling
+   * reinit().
+   */
+  explicit SparseMatrixSELL(const SparseMatrix<number> &matrix,
+                            const unsigned int          sort_window = 1);
+
+  /**
+   * Copy all entries of the given @p matrix into the SELL-C-$\sigma$ format.
+   * The rows within contiguous windows of @p sort_window rows are sorted by
+   * descending length before they are grouped into chunks. A value of one
+   * means that the rows are not reordered.
+   *
+   * This function also stores explicit zeros of @p matrix, i.e., the
+   * structure of the sparsity pattern is kept.
+   */
+  void
+  reinit(const SparseMatrix<number> &matrix,
+         const unsigned int          sort_window = 1);
+
+  /**
+   * Release all memory and return to a state just like after having called
+   * the default constructor.
+   */
+  void
+  clear();
+
+  /**
+   * Return the number of rows of this matrix.
+   */
+  size_type
+  m() const;
+
+  /**
+   * Return the number of columns of this matrix.
+   */
+  size_type
+  n() const;
+
+  /**
+   * Return the number of nonzero entries of the original matrix, i.e., not
+   * counting the entries added for padding the chunks.
+   */
+  std::size_t
+  n_nonzero_elements() const;
+
+  /**
+   * Return the number of entries actually stored, including the padding
+   * entries of the chunks.
+   */
+  std::size_t
+  n_stored_elements() const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M*src$ with $M$ being this
+   * matrix.
+   */
+  void
+  vmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Same as above, for LinearAlgebra::distributed::Vector.
+   */
+  void
+  vmult(LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &dst,
+        const LinearAlgebra::distributed::Vector<number, MemorySpace::Host>
+          &src) const;
+
+  /**
+   * Adding matrix-vector multiplication. Add $M*src$ on $dst$ with $M$ being
+   * this matrix.
+   */
+  void
+  vmult_add(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Same as above, for LinearAlgebra::distributed::Vector.
+   */
+  void
+  vmult_add(
+    LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+    const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &src)
+    const;
+
+  /**
+   * Matrix-vector multiplication: let $dst = M^T*src$ with $M$ being this
+   * matrix.
+   */
+  void
+  Tvmult(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Same as above, for LinearAlgebra::distributed::Vector.
+   */
+  void
+  Tvmult(LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &dst,
+         const LinearAlgebra::distributed::Vector<number, MemorySpace::Host>
+           &src) const;
+
+  /**
+   * Adding matrix-vector multiplication. Add $M^T*src$ to $dst$ with $M$
+   * being this matrix.
+   */
+  void
+  Tvmult_add(Vector<number> &dst, const Vector<number> &src) const;
+
+  /**
+   * Same as above, for LinearAlgebra::distributed::Vector.
+   */
+  void
+  Tvmult_add(
+    LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+    const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &src)
+    const;
+
+  /**
+   * Compute the residual of an equation <i>Mx=b</i>, where the residual is
+   * defined to be <i>r=b-Mx</i>. Write the residual into @p dst. The
+   * <i>l<sub>2</sub></i> norm of the residual vector is returned.
+   *
+   * Source <i>x</i> and destination <i>dst</i> must not be the same vector.
+   */
+  number
+  residual(Vector<number>       &dst,
+           const Vector<number> &x,
+           const Vector<number> &b) const;
+
+  /**
+   * Same as above, for LinearAlgebra::distributed::Vector.
+   */
+  number
+  residual(
+    LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+    const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &x,
+    const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &b)
+    const;
+
+  /**
+   * Determine an estimate for the memory consumption (in bytes) of this
+   * object.
+   */
+  std::size_t
+  memory_consumption() const;
+
+  /**
+   * @addtogroup Exceptions
+   * @{
+   */
+
+  /**
+   * Exception
+   */
+  DeclExceptionMsg(ExcSourceEqualsDestination,
+                   "You are attempting an operation on two vectors that "
+                   "are the same object, but the operation requires that the "
+                   "two objects are in fact different.");
+  /** @} */
+
+private:
+  /**
+   * Compute $dst = M*src$ or $dst += M*src$ on raw arrays.
+   */
+  void
+  do_vmult(number *dst, const number *src, const bool add) const;
+
+  /**
+   * Compute $dst = M^T*src$ or $dst += M^T*src$ on raw arrays.
+   */
+  void
+  do_Tvmult(number *dst, const number *src, const bool add) const;
+
+  /**
+   * Compute $dst = b-M*x$ on raw arrays and return the square of the norm
+   * of @p dst.
+   */
+  number
+  do_residual(number *dst, const number *x, const number *b) const;
+
+  /**
+   * Number of rows of the matrix.
+   */
+  size_type n_rows;
+
+  /**
+   * Number of columns of the matrix.
+   */
+  size_type n_cols;
+
+  /**
+   * Number of nonzero entries of the original matrix.
+   */
+  std::size_t n_nonzeros;
+
+  /**
+   * The offset of the first entry of each chunk in the arrays #values and
+   * #column_indices, with one additional entry at the end. The length of
+   * chunk $c$ is obtained as
+   * `(chunk_offsets[c+1] - chunk_offsets[c]) / chunk_size`.
+   */
+  std::vector<std::size_t> chunk_offsets;
+
+  /**
+   * The original row index of each lane of the chunks, with
+   * numbers::invalid_unsigned_int for the padding rows in the last chunk.
+   */
+  std::vector<unsigned int> row_indices;
+
+  /**
+   * The column indices of the entries, stored column-wise within each
+   * chunk. Padding entries point to column zero.
+   */
+  std::vector<unsigned int> column_indices;
+
+  /**
+   * The values of the entries, stored column-wise within each chunk.
+   * Padding entries are zero.
+   */
+  AlignedVector<number> values;
+};
+
+/** @} */
+
+/*---------------------- Inline functions -----------------------------------*/
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::m() const
+{
+  return n_rows;
+}
+
+
+
+template <typename number>
+inline typename SparseMatrixSELL<number>::size_type
+SparseMatrixSELL<number>::n() const
+{
+  return n_cols;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_nonzero_elements() const
+{
+  return n_nonzeros;
+}
+
+
+
+template <typename number>
+inline std::size_t
+SparseMatrixSELL<number>::n_stored_elements() const
+{
+  return values.size();
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
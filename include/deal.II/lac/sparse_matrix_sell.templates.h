@@ -0,0 +1,462 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_sparse_matrix_sell_templates_h
+#define dealii_sparse_matrix_sell_templates_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/parallel.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparse_matrix_sell.h>
+#include <deal.II/lac/vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+template <typename number>
+SparseMatrixSELL<number>::SparseMatrixSELL()
+  : n_rows(0)
+  , n_cols(0)
+  , n_nonzeros(0)
+{}
+
+
+
+template <typename number>
+SparseMatrixSELL<number>::SparseMatrixSELL(const SparseMatrix<number> &matrix,
+                                           const unsigned int sort_window)
+  : SparseMatrixSELL()
+{
+  reinit(matrix, sort_window);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::reinit(const SparseMatrix<number> &matrix,
+                                 const unsigned int          sort_window)
+{
+  Assert(sort_window > 0, ExcMessage("The sort window must be positive."));
+  AssertThrow(matrix.m() <= std::numeric_limits<unsigned int>::max() &&
+                matrix.n() <= std::numeric_limits<unsigned int>::max(),
+              ExcMessage("SparseMatrixSELL uses 32-bit row and column "
+                         "indices, but the given matrix is too large."));
+
+  n_rows     = matrix.m();
+  n_cols     = matrix.n();
+  n_nonzeros = matrix.n_nonzero_elements();
+
+  const SparsityPattern &sparsity = matrix.get_sparsity_pattern();
+
+  // Sort the rows within each window by descending length. A stable sort
+  // keeps the original order of rows with the same length, and thus the
+  // original order of all rows of a matrix with rows of equal length.
+  std::vector<unsigned int> permutation(n_rows);
+  std::iota(permutation.begin(), permutation.end(), 0U);
+  if (sort_window > 1)
+    for (size_type start = 0; start < n_rows; start += sort_window)
+      {
+        const size_type end = std::min<size_type>(start + sort_window, n_rows);
+        std::stable_sort(permutation.begin() + start,
+                         permutation.begin() + end,
+                         [&sparsity](const unsigned int a,
+                                     const unsigned int b) {
+                           return sparsity.row_length(a) >
+                                  sparsity.row_length(b);
+                         });
+      }
+
+  // Determine the length of each chunk as the length of its longest row
+  const size_type n_chunks = (n_rows + chunk_size - 1) / chunk_size;
+  row_indices.resize(n_chunks * chunk_size);
+  chunk_offsets.resize(n_chunks + 1);
+  chunk_offsets[0] = 0;
+  for (size_type c = 0; c < n_chunks; ++c)
+    {
+      unsigned int chunk_length = 0;
+      for (unsigned int v = 0; v < chunk_size; ++v)
+        {
+          const size_type lane = c * chunk_size + v;
+          if (lane < n_rows)
+            {
+              row_indices[lane] = permutation[lane];
+              chunk_length =
+                std::max(chunk_length,
+                         sparsity.row_length(permutation[lane]));
+            }
+          else
+            row_indices[lane] = numbers::invalid_unsigned_int;
+        }
+      chunk_offsets[c + 1] =
+        chunk_offsets[c] + std::size_t(chunk_length) * chunk_size;
+    }
+
+  // Fill the entries column by column within each chunk, padding short rows
+  // with zeros that refer to column zero
+  values.resize_fast(chunk_offsets.back());
+  column_indices.resize(chunk_offsets.back());
+  parallel::apply_to_subranges(
+    0U,
+    n_chunks,
+    [&](const size_type begin_chunk, const size_type end_chunk) {
+      for (size_type c = begin_chunk; c < end_chunk; ++c)
+        {
+          const std::size_t offset = chunk_offsets[c];
+          const unsigned int chunk_length =
+            (chunk_offsets[c + 1] - offset) / chunk_size;
+          for (unsigned int v = 0; v < chunk_size; ++v)
+            {
+              unsigned int j = 0;
+              if (row_indices[c * chunk_size + v] !=
+                  numbers::invalid_unsigned_int)
+                for (auto entry = matrix.begin(row_indices[c * chunk_size + v]);
+                     entry != matrix.end(row_indices[c * chunk_size + v]);
+                     ++entry, ++j)
+                  {
+                    values[offset + j * chunk_size + v] = entry->value();
+                    column_indices[offset + j * chunk_size + v] =
+                      entry->column();
+                  }
+              for (; j < chunk_length; ++j)
+                {
+                  values[offset + j * chunk_size + v]         = number();
+                  column_indices[offset + j * chunk_size + v] = 0;
+                }
+            }
+        }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+      chunk_size);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::clear()
+{
+  n_rows     = 0;
+  n_cols     = 0;
+  n_nonzeros = 0;
+  chunk_offsets.clear();
+  row_indices.clear();
+  column_indices.clear();
+  values.clear();
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::do_vmult(number       *dst,
+                                   const number *src,
+                                   const bool    add) const
+{
+  const size_type n_chunks = row_indices.size() / chunk_size;
+
+  parallel::apply_to_subranges(
+    0U,
+    n_chunks,
+    [this, dst, src, add](const size_type begin_chunk,
+                          const size_type end_chunk) {
+      for (size_type c = begin_chunk; c < end_chunk; ++c)
+        {
+          const std::size_t   end    = chunk_offsets[c + 1];
+          const unsigned int *rows   = row_indices.data() + c * chunk_size;
+          VectorizedArray<number> sum = number();
+          for (std::size_t j = chunk_offsets[c]; j < end; j += chunk_size)
+            {
+              VectorizedArray<number> matrix_entries, src_entries;
+              matrix_entries.load(values.data() + j);
+              src_entries.gather(src, column_indices.data() + j);
+              sum += matrix_entries * src_entries;
+            }
+
+          for (unsigned int v = 0;
+               v < chunk_size && rows[v] != numbers::invalid_unsigned_int;
+               ++v)
+            if (add)
+              dst[rows[v]] += sum[v];
+            else
+              dst[rows[v]] = sum[v];
+        }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+      chunk_size);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::do_Tvmult(number       *dst,
+                                    const number *src,
+                                    const bool    add) const
+{
+  if (!add)
+    std::fill(dst, dst + n_cols, number());
+
+  // The updates into dst are scattered, so we run this loop serially
+  const size_type n_chunks = row_indices.size() / chunk_size;
+  for (size_type c = 0; c < n_chunks; ++c)
+    {
+      const std::size_t   end  = chunk_offsets[c + 1];
+      const unsigned int *rows = row_indices.data() + c * chunk_size;
+      for (unsigned int v = 0;
+           v < chunk_size && rows[v] != numbers::invalid_unsigned_int;
+           ++v)
+        {
+          const number src_value = src[rows[v]];
+          for (std::size_t j = chunk_offsets[c] + v; j < end; j += chunk_size)
+            dst[column_indices[j]] += values[j] * src_value;
+        }
+    }
+}
+
+
+
+template <typename number>
+number
+SparseMatrixSELL<number>::do_residual(number       *dst,
+                                      const number *x,
+                                      const number *b) const
+{
+  const size_type n_chunks = row_indices.size() / chunk_size;
+
+  return parallel::accumulate_from_subranges<number>(
+    [this, dst, x, b](const size_type begin_chunk, const size_type end_chunk) {
+      number norm_sqr = 0.;
+      for (size_type c = begin_chunk; c < end_chunk; ++c)
+        {
+          const std::size_t   end    = chunk_offsets[c + 1];
+          const unsigned int *rows   = row_indices.data() + c * chunk_size;
+          VectorizedArray<number> sum = number();
+          for (std::size_t j = chunk_offsets[c]; j < end; j += chunk_size)
+            {
+              VectorizedArray<number> matrix_entries, x_entries;
+              matrix_entries.load(values.data() + j);
+              x_entries.gather(x, column_indices.data() + j);
+              sum += matrix_entries * x_entries;
+            }
+
+          for (unsigned int v = 0;
+               v < chunk_size && rows[v] != numbers::invalid_unsigned_int;
+               ++v)
+            {
+              const number s = b[rows[v]] - sum[v];
+              dst[rows[v]]   = s;
+              norm_sqr += s * s;
+            }
+        }
+      return norm_sqr;
+    },
+    0,
+    n_chunks,
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size /
+      chunk_size);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::vmult(Vector<number>       &dst,
+                                const Vector<number> &src) const
+{
+  Assert(m() == dst.size(), ExcDimensionMismatch(m(), dst.size()));
+  Assert(n() == src.size(), ExcDimensionMismatch(n(), src.size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_vmult(dst.begin(), src.begin(), false);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::vmult(
+  LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+  const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &src)
+  const
+{
+  Assert(m() == dst.locally_owned_size(),
+         ExcDimensionMismatch(m(), dst.locally_owned_size()));
+  Assert(n() == src.locally_owned_size(),
+         ExcDimensionMismatch(n(), src.locally_owned_size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_vmult(dst.begin(), src.begin(), false);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::vmult_add(Vector<number>       &dst,
+                                    const Vector<number> &src) const
+{
+  Assert(m() == dst.size(), ExcDimensionMismatch(m(), dst.size()));
+  Assert(n() == src.size(), ExcDimensionMismatch(n(), src.size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_vmult(dst.begin(), src.begin(), true);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::vmult_add(
+  LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+  const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &src)
+  const
+{
+  Assert(m() == dst.locally_owned_size(),
+         ExcDimensionMismatch(m(), dst.locally_owned_size()));
+  Assert(n() == src.locally_owned_size(),
+         ExcDimensionMismatch(n(), src.locally_owned_size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_vmult(dst.begin(), src.begin(), true);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::Tvmult(Vector<number>       &dst,
+                                 const Vector<number> &src) const
+{
+  Assert(n() == dst.size(), ExcDimensionMismatch(n(), dst.size()));
+  Assert(m() == src.size(), ExcDimensionMismatch(m(), src.size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_Tvmult(dst.begin(), src.begin(), false);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::Tvmult(
+  LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+  const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &src)
+  const
+{
+  Assert(n() == dst.locally_owned_size(),
+         ExcDimensionMismatch(n(), dst.locally_owned_size()));
+  Assert(m() == src.locally_owned_size(),
+         ExcDimensionMismatch(m(), src.locally_owned_size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_Tvmult(dst.begin(), src.begin(), false);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::Tvmult_add(Vector<number>       &dst,
+                                     const Vector<number> &src) const
+{
+  Assert(n() == dst.size(), ExcDimensionMismatch(n(), dst.size()));
+  Assert(m() == src.size(), ExcDimensionMismatch(m(), src.size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_Tvmult(dst.begin(), src.begin(), true);
+}
+
+
+
+template <typename number>
+void
+SparseMatrixSELL<number>::Tvmult_add(
+  LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+  const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &src)
+  const
+{
+  Assert(n() == dst.locally_owned_size(),
+         ExcDimensionMismatch(n(), dst.locally_owned_size()));
+  Assert(m() == src.locally_owned_size(),
+         ExcDimensionMismatch(m(), src.locally_owned_size()));
+  Assert(&src != &dst, ExcSourceEqualsDestination());
+
+  do_Tvmult(dst.begin(), src.begin(), true);
+}
+
+
+
+template <typename number>
+number
+SparseMatrixSELL<number>::residual(Vector<number>       &dst,
+                                   const Vector<number> &x,
+                                   const Vector<number> &b) const
+{
+  Assert(m() == dst.size(), ExcDimensionMismatch(m(), dst.size()));
+  Assert(m() == b.size(), ExcDimensionMismatch(m(), b.size()));
+  Assert(n() == x.size(), ExcDimensionMismatch(n(), x.size()));
+  Assert(&x != &dst, ExcSourceEqualsDestination());
+
+  return std::sqrt(do_residual(dst.begin(), x.begin(), b.begin()));
+}
+
+
+
+template <typename number>
+number
+SparseMatrixSELL<number>::residual(
+  LinearAlgebra::distributed::Vector<number, MemorySpace::Host>       &dst,
+  const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &x,
+  const LinearAlgebra::distributed::Vector<number, MemorySpace::Host> &b)
+  const
+{
+  Assert(m() == dst.locally_owned_size(),
+         ExcDimensionMismatch(m(), dst.locally_owned_size()));
+  Assert(m() == b.locally_owned_size(),
+         ExcDimensionMismatch(m(), b.locally_owned_size()));
+  Assert(n() == x.locally_owned_size(),
+         ExcDimensionMismatch(n(), x.locally_owned_size()));
+  Assert(&x != &dst, ExcSourceEqualsDestination());
+
+  return std::sqrt(do_residual(dst.begin(), x.begin(), b.begin()));
+}
+
+
+
+template <typename number>
+std::size_t
+SparseMatrixSELL<number>::memory_consumption() const
+{
+  return sizeof(*this) + MemoryConsumption::memory_consumption(chunk_offsets) +
+         MemoryConsumption::memory_consumption(row_indices) +
+         MemoryConsumption::memory_consumption(column_indices) +
+         MemoryConsumption::memory_consumption(values);
+}
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -56,6 +56,14 @@ class SparseLUDecomposition;
 template <typename number>
 class SparseILU;
 
+namespace parallel
+{
+  namespace internal
+  {
+    class TBBPartitioner;
+  }
+} // namespace parallel
+
 namespace ChunkSparsityPatternIterators
 {
   class Accessor;
@@ -1150,6 +1158,18 @@ private:
    */
   bool compressed;
 
+  /**
+   * A TBB affinity partitioner that records the assignment of the rows of
+   * this sparsity pattern to threads. It is used for the initialization of
+   * #colnums in reinit() and compress() and by the SparseMatrix objects
+   * based on this sparsity pattern for initializing their values and for the
+   * loops of the matrix-vector products. Since the memory pages are placed
+   * in the NUMA domain of the thread that first touches them, reusing the
+   * same assignment of rows to threads ensures that the threads mostly
+   * access memory close to them.
+   */
+  std::shared_ptr<parallel::internal::TBBPartitioner> thread_loop_partitioner;
+
   // Make all sparse matrices friends of this class.
   template <typename number>
   friend class SparseMatrix;
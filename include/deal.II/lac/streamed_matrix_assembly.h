@@ -0,0 +1,517 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_lac_streamed_matrix_assembly_h
+#define dealii_lac_streamed_matrix_assembly_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_tags.h>
+#include <deal.II/base/subscriptor.h>
+#include <deal.II/base/types.h>
+
+#include <deal.II/lac/vector_operation.h>
+
+#include <boost/serialization/utility.hpp>
+
+#include <algorithm>
+#include <list>
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace LinearAlgebra
+{
+  /**
+   * A wrapper around a distributed matrix that sends the contributions to
+   * rows owned by other processes to their owners while the assembly is
+   * still running, rather than exchanging all of them in the compress() call
+   * at the end of the assembly. For the parallel matrix classes of the
+   * Trilinos and PETSc wrappers, all off-processor entries are otherwise
+   * communicated in one step after the last cell has been assembled, during
+   * which no computation takes place. With this class, the communication of
+   * most of these entries overlaps with the assembly of the remaining cells,
+   * and compress() only has to send what has been added after the last full
+   * buffer.
+   *
+   * The object is used in place of the matrix in the copier of the assembly
+   * loop:
+   * @code
+   *   LinearAlgebra::StreamedMatrixAssembly<TrilinosWrappers::SparseMatrix>
+   *     streamed_matrix(system_matrix, locally_owned_dofs, mpi_communicator);
+   *
+   *   WorkStream::run(
+   *     filtered_cells_begin, filtered_cells_end,
+   *     worker,
+   *     [&](const CopyData &data) {
+   *       constraints.distribute_local_to_global(data.cell_matrix,
+   *                                              data.local_dof_indices,
+   *                                              streamed_matrix);
+   *     },
+   *     scratch_data, copy_data);
+   *
+   *   streamed_matrix.compress(VectorOperation::add);
+   * @endcode
+   * Since the function template AffineConstraints::distribute_local_to_global()
+   * is only instantiated for the matrix classes of the library, the file
+   * <tt>deal.II/lac/affine_constraints.templates.h</tt> has to be included to
+   * use it with this class.
+   *
+   * Contributions to locally owned rows are added to the matrix right away.
+   * The contributions to other rows are collected in one buffer per owning
+   * process, and a buffer is sent with a nonblocking send as soon as it
+   * holds as many entries as given to the constructor. Every time a buffer is
+   * sent, the contributions that have arrived from other processes so far
+   * are received and added to the matrix. compress() sends the remaining
+   * buffers and receives all outstanding contributions, using the same
+   * nonblocking consensus algorithm as
+   * Utilities::MPI::ConsensusAlgorithms::NBX to find out when all messages
+   * have arrived, before it calls the compress() function of the matrix. At
+   * that point, the matrix only contains entries in its locally owned rows.
+   *
+   * The locally owned rows of each process have to form a contiguous range,
+   * and the ranges have to be ordered by the rank of the processes, as it is
+   * the case for the locally owned degrees of freedom of a DoFHandler with
+   * the default numbering. Since the MPI calls of this class are made by the
+   * thread that runs the copier, MPI has to be initialized with support for
+   * at least MPI_THREAD_SERIALIZED, as Utilities::MPI::MPI_InitFinalize does.
+   * Only the addition of entries is supported.
+   *
+   * @ingroup Matrices
+   */
+  template <typename MatrixType>
+  class StreamedMatrixAssembly : public Subscriptor
+  {
+  public:
+    /**
+     * Declare type for container size.
+     */
+    using size_type = types::global_dof_index;
+
+    /**
+     * Declare type of the matrix entries.
+     */
+    using value_type = typename MatrixType::value_type;
+
+    /**
+     * Constructor. @p locally_owned_rows are the rows of @p matrix owned by
+     * the current process, and @p buffer_size the number of entries collected
+     * for another process before they are sent to it. This is a collective
+     * operation on @p communicator.
+     */
+    StreamedMatrixAssembly(MatrixType        &matrix,
+                           const IndexSet    &locally_owned_rows,
+                           const MPI_Comm     communicator,
+                           const unsigned int buffer_size = 4096);
+
+    /**
+     * Destructor. All contributions have to be communicated by a call to
+     * compress() before the object is destroyed.
+     */
+    ~StreamedMatrixAssembly() override;
+
+    /**
+     * Return the number of rows of the underlying matrix.
+     */
+    size_type
+    m() const;
+
+    /**
+     * Return the number of columns of the underlying matrix.
+     */
+    size_type
+    n() const;
+
+    /**
+     * Add @p value to the entry (@p row, @p col) of the matrix.
+     */
+    void
+    add(const size_type row, const size_type col, const value_type value);
+
+    /**
+     * Add the @p n_cols entries in @p values to the columns
+     * @p col_indices of the row @p row of the matrix. The arguments have the
+     * same meaning as in SparseMatrix::add().
+     */
+    void
+    add(const size_type   row,
+        const size_type   n_cols,
+        const size_type  *col_indices,
+        const value_type *values,
+        const bool        elide_zero_values      = true,
+        const bool        col_indices_are_sorted = false);
+
+    /**
+     * Send the remaining contributions to rows owned by other processes,
+     * receive all contributions to the locally owned rows, and then call the
+     * compress() function of the matrix with @p operation, which has to be
+     * VectorOperation::add. This is a collective operation. After this call,
+     * the object can be used for another assembly of the same matrix.
+     */
+    void
+    compress(const VectorOperation::values operation);
+
+  private:
+    /**
+     * A single contribution to an entry of the matrix, in the format in
+     * which it is sent to the owner of the row.
+     */
+    struct Entry
+    {
+      size_type  row;
+      size_type  col;
+      value_type value;
+    };
+
+    /**
+     * Add @p entry to the buffer of the owner of its row, and send the
+     * buffer if it is full.
+     */
+    void
+    add_nonlocal(const Entry &entry);
+
+    /**
+     * Send the buffer of the process @p rank, if it is not empty.
+     */
+    void
+    send_buffer(const unsigned int rank);
+
+    /**
+     * Receive all contributions that have arrived from other processes, add
+     * them to the matrix, and release the buffers of the sends that have
+     * completed.
+     */
+    void
+    receive_pending();
+
+    /**
+     * The matrix that is assembled.
+     */
+    MatrixType &matrix;
+
+    /**
+     * The locally owned rows of the matrix.
+     */
+    const std::pair<size_type, size_type> local_range;
+
+    /**
+     * The first row owned by each process, followed by the number of rows of
+     * the matrix.
+     */
+    std::vector<size_type> first_owned_rows;
+
+    /**
+     * A duplicate of the communicator given to the constructor, so that the
+     * messages of this class cannot be mixed up with the ones of other
+     * communication that is going on at the same time.
+     */
+    MPI_Comm communicator;
+
+    /**
+     * The number of entries collected for another process before they are
+     * sent.
+     */
+    const unsigned int buffer_size;
+
+    /**
+     * The entries collected for each process that have not been sent yet.
+     */
+    std::vector<std::vector<Entry>> send_buffers;
+
+#ifdef DEAL_II_WITH_MPI
+    /**
+     * The buffers that have been sent, together with the requests of the
+     * sends that may not have completed yet.
+     */
+    std::list<std::pair<std::vector<Entry>, MPI_Request>> pending_sends;
+#endif
+  };
+
+
+
+#ifndef DOXYGEN
+
+  template <typename MatrixType>
+  StreamedMatrixAssembly<MatrixType>::StreamedMatrixAssembly(
+    MatrixType        &matrix,
+    const IndexSet    &locally_owned_rows,
+    const MPI_Comm     communicator,
+    const unsigned int buffer_size)
+    : matrix(matrix)
+    , local_range(locally_owned_rows.is_empty() ?
+                    std::make_pair(size_type(0), size_type(0)) :
+                    std::make_pair(locally_owned_rows.nth_index_in_set(0),
+                                   locally_owned_rows.nth_index_in_set(0) +
+                                     locally_owned_rows.n_elements()))
+    , communicator(Utilities::MPI::duplicate_communicator(communicator))
+    , buffer_size(buffer_size)
+    , send_buffers(Utilities::MPI::n_mpi_processes(communicator))
+  {
+    Assert(locally_owned_rows.is_contiguous(),
+           ExcMessage("The locally owned rows have to form a contiguous "
+                      "range."));
+    Assert(buffer_size > 0, ExcMessage("The buffer size must be positive."));
+
+    // Processes without rows report the end of the range of the previous
+    // process, so that the owner of a row is the last process whose first
+    // row is not larger than it
+    const std::vector<std::pair<size_type, size_type>> ranges =
+      Utilities::MPI::all_gather(communicator, local_range);
+    first_owned_rows.resize(ranges.size() + 1);
+    size_type end_of_previous_range = 0;
+    for (unsigned int p = 0; p < ranges.size(); ++p)
+      {
+        Assert(ranges[p].first == ranges[p].second ||
+                 ranges[p].first == end_of_previous_range,
+               ExcMessage("The locally owned rows have to be ordered by the "
+                          "rank of the processes."));
+        first_owned_rows[p] = end_of_previous_range;
+        if (ranges[p].first != ranges[p].second)
+          end_of_previous_range = ranges[p].second;
+      }
+    first_owned_rows.back() = end_of_previous_range;
+  }
+
+
+
+  template <typename MatrixType>
+  StreamedMatrixAssembly<MatrixType>::~StreamedMatrixAssembly()
+  {
+#  ifdef DEAL_II_WITH_MPI
+    AssertNothrow(pending_sends.empty(),
+                  ExcMessage("The StreamedMatrixAssembly object is destroyed "
+                             "while some of its messages have not been "
+                             "received. Did you forget to call compress()?"));
+#  endif
+    Utilities::MPI::free_communicator(communicator);
+  }
+
+
+
+  template <typename MatrixType>
+  inline typename StreamedMatrixAssembly<MatrixType>::size_type
+  StreamedMatrixAssembly<MatrixType>::m() const
+  {
+    return matrix.m();
+  }
+
+
+
+  template <typename MatrixType>
+  inline typename StreamedMatrixAssembly<MatrixType>::size_type
+  StreamedMatrixAssembly<MatrixType>::n() const
+  {
+    return matrix.n();
+  }
+
+
+
+  template <typename MatrixType>
+  inline void
+  StreamedMatrixAssembly<MatrixType>::add(const size_type  row,
+                                          const size_type  col,
+                                          const value_type value)
+  {
+    if (row >= local_range.first && row < local_range.second)
+      matrix.add(row, col, value);
+    else
+      add_nonlocal(Entry{row, col, value});
+  }
+
+
+
+  template <typename MatrixType>
+  inline void
+  StreamedMatrixAssembly<MatrixType>::add(
+    const size_type   row,
+    const size_type   n_cols,
+    const size_type  *col_indices,
+    const value_type *values,
+    const bool        elide_zero_values,
+    const bool        col_indices_are_sorted)
+  {
+    if (row >= local_range.first && row < local_range.second)
+      matrix.add(row,
+                 n_cols,
+                 col_indices,
+                 values,
+                 elide_zero_values,
+                 col_indices_are_sorted);
+    else
+      for (size_type j = 0; j < n_cols; ++j)
+        if (!elide_zero_values || values[j] != value_type())
+          add_nonlocal(Entry{row, col_indices[j], values[j]});
+  }
+
+
+
+  template <typename MatrixType>
+  void
+  StreamedMatrixAssembly<MatrixType>::add_nonlocal(const Entry &entry)
+  {
+    AssertIndexRange(entry.row, first_owned_rows.back());
+    const unsigned int owner =
+      std::upper_bound(first_owned_rows.begin(),
+                       first_owned_rows.end() - 1,
+                       entry.row) -
+      first_owned_rows.begin() - 1;
+
+    send_buffers[owner].push_back(entry);
+    if (send_buffers[owner].size() >= buffer_size)
+      {
+        send_buffer(owner);
+        receive_pending();
+      }
+  }
+
+
+
+  template <typename MatrixType>
+  void
+  StreamedMatrixAssembly<MatrixType>::send_buffer(const unsigned int rank)
+  {
+    if (send_buffers[rank].empty())
+      return;
+
+#  ifdef DEAL_II_WITH_MPI
+    // The send has to be synchronous: the consensus algorithm in compress()
+    // relies on the completion of a send meaning that the message has been
+    // received
+    pending_sends.emplace_back(std::move(send_buffers[rank]), MPI_Request());
+    auto &[buffer, request] = pending_sends.back();
+    const int ierr =
+      MPI_Issend(buffer.data(),
+                 buffer.size() * sizeof(Entry),
+                 MPI_BYTE,
+                 rank,
+                 Utilities::MPI::internal::Tags::streamed_matrix_assembly,
+                 communicator,
+                 &request);
+    AssertThrowMPI(ierr);
+    send_buffers[rank].clear();
+#  else
+    DEAL_II_NOT_IMPLEMENTED();
+#  endif
+  }
+
+
+
+  template <typename MatrixType>
+  void
+  StreamedMatrixAssembly<MatrixType>::receive_pending()
+  {
+#  ifdef DEAL_II_WITH_MPI
+    const int tag = Utilities::MPI::internal::Tags::streamed_matrix_assembly;
+
+    std::vector<Entry> receive_buffer;
+    while (true)
+      {
+        int        message_is_pending;
+        MPI_Status status;
+        int        ierr = MPI_Iprobe(
+          MPI_ANY_SOURCE, tag, communicator, &message_is_pending, &status);
+        AssertThrowMPI(ierr);
+        if (message_is_pending == 0)
+          break;
+
+        int message_size;
+        ierr = MPI_Get_count(&status, MPI_BYTE, &message_size);
+        AssertThrowMPI(ierr);
+        Assert(message_size % sizeof(Entry) == 0, ExcInternalError());
+        receive_buffer.resize(message_size / sizeof(Entry));
+        ierr = MPI_Recv(receive_buffer.data(),
+                        message_size,
+                        MPI_BYTE,
+                        status.MPI_SOURCE,
+                        tag,
+                        communicator,
+                        MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+
+        for (const Entry &entry : receive_buffer)
+          matrix.add(entry.row, entry.col, entry.value);
+      }
+
+    for (auto it = pending_sends.begin(); it != pending_sends.end();)
+      {
+        int       send_is_complete;
+        const int ierr =
+          MPI_Test(&it->second, &send_is_complete, MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+        if (send_is_complete != 0)
+          it = pending_sends.erase(it);
+        else
+          ++it;
+      }
+#  endif
+  }
+
+
+
+  template <typename MatrixType>
+  void
+  StreamedMatrixAssembly<MatrixType>::compress(
+    const VectorOperation::values operation)
+  {
+    Assert(operation == VectorOperation::add,
+           ExcMessage("Only the addition of entries is supported."));
+
+#  ifdef DEAL_II_WITH_MPI
+    for (unsigned int p = 0; p < send_buffers.size(); ++p)
+      send_buffer(p);
+
+    // Receive messages until all of our own messages have been received,
+    // then signal this by entering a nonblocking barrier and keep receiving
+    // until all processes have entered it
+    MPI_Request barrier_request;
+    bool        barrier_is_entered = false;
+    while (true)
+      {
+        receive_pending();
+        if (!barrier_is_entered)
+          {
+            if (pending_sends.empty())
+              {
+                const int ierr = MPI_Ibarrier(communicator, &barrier_request);
+                AssertThrowMPI(ierr);
+                barrier_is_entered = true;
+              }
+          }
+        else
+          {
+            int       all_processes_are_done;
+            const int ierr = MPI_Test(&barrier_request,
+                                      &all_processes_are_done,
+                                      MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+            if (all_processes_are_done != 0)
+              break;
+          }
+      }
+#  endif
+
+    matrix.compress(operation);
+  }
+
+#endif // DOXYGEN
+
+} // namespace LinearAlgebra
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
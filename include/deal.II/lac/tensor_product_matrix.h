@@ -27,6 +27,8 @@
 
 #include <deal.II/matrix_free/tensor_product_kernels.h>
 
+#include <map>
+
 DEAL_II_NAMESPACE_OPEN
 
 // Forward declarations
@@ -573,16 +575,86 @@ namespace internal
 
 
 
+    /**
+     * Cache of generalized eigendecompositions computed by
+     * spectral_assembly(). The key is the concatenation of the (scalar) mass
+     * and derivative matrices, the value the concatenation of the
+     * eigenvalues and the eigenvectors. Identical 1d problems are common
+     * (same mesh size in all directions, in all lanes of a vectorized array
+     * and across patches), so that the expensive LAPACK call can be skipped
+     * for all but the first occurrence.
+     */
+    template <typename Number>
+    using SpectralAssemblyCache =
+      std::map<std::vector<Number>, std::vector<Number>>;
+
+
+
+    /**
+     * Same as spectral_assembly() but first looks up the 1d problem in
+     * @p cache and only computes the eigendecomposition if it has not been
+     * encountered before.
+     */
+    template <typename Number>
+    void
+    cached_spectral_assembly(const Number                  *mass_matrix,
+                             const Number                  *derivative_matrix,
+                             const unsigned int             n_rows,
+                             const unsigned int             n_cols,
+                             Number                        *eigenvalues,
+                             Number                        *eigenvectors,
+                             SpectralAssemblyCache<Number> &cache)
+    {
+      const unsigned int nm = n_rows * n_cols;
+
+      std::vector<Number> key(2 * nm);
+      std::copy(mass_matrix, mass_matrix + nm, key.begin());
+      std::copy(derivative_matrix, derivative_matrix + nm, key.begin() + nm);
+
+      const auto entry = cache.find(key);
+      if (entry != cache.end())
+        {
+          std::copy(entry->second.begin(),
+                    entry->second.begin() + n_rows,
+                    eigenvalues);
+          std::copy(entry->second.begin() + n_rows,
+                    entry->second.end(),
+                    eigenvectors);
+          return;
+        }
+
+      // spectral_assembly() does not touch the rows of constrained DoFs
+      std::fill(eigenvectors, eigenvectors + nm, Number());
+      spectral_assembly<Number>(mass_matrix,
+                                derivative_matrix,
+                                n_rows,
+                                n_cols,
+                                eigenvalues,
+                                eigenvectors);
+
+      std::vector<Number> value(n_rows + nm);
+      std::copy(eigenvalues, eigenvalues + n_rows, value.begin());
+      std::copy(eigenvectors, eigenvectors + nm, value.begin() + n_rows);
+      cache.emplace(std::move(key), std::move(value));
+    }
+
+
+
     template <std::size_t dim, typename Number>
     inline void
     setup(const std::array<Table<2, Number>, dim> &mass_matrix,
           const std::array<Table<2, Number>, dim> &derivative_matrix,
           std::array<Table<2, Number>, dim>       &eigenvectors,
-          std::array<AlignedVector<Number>, dim>  &eigenvalues)
+          std::array<AlignedVector<Number>, dim>  &eigenvalues,
+          SpectralAssemblyCache<Number>           *cache = nullptr)
     {
       const unsigned int n_rows_1d = mass_matrix[0].n_cols();
       (void)n_rows_1d;
 
+      SpectralAssemblyCache<Number> local_cache;
+      if (cache == nullptr)
+        cache = &local_cache;
+
       for (unsigned int dir = 0; dir < dim; ++dir)
         {
           AssertDimension(n_rows_1d, mass_matrix[dir].n_cols());
@@ -595,13 +667,13 @@ namespace internal
           eigenvectors[dir].reinit(mass_matrix[dir].n_cols(),
                                    mass_matrix[dir].n_rows());
           eigenvalues[dir].resize(mass_matrix[dir].n_cols());
-          internal::TensorProductMatrixSymmetricSum::spectral_assembly<Number>(
-            &(mass_matrix[dir](0, 0)),
-            &(derivative_matrix[dir](0, 0)),
-            mass_matrix[dir].n_rows(),
-            mass_matrix[dir].n_cols(),
-            eigenvalues[dir].begin(),
-            &(eigenvectors[dir](0, 0)));
+          cached_spectral_assembly<Number>(&(mass_matrix[dir](0, 0)),
+                                           &(derivative_matrix[dir](0, 0)),
+                                           mass_matrix[dir].n_rows(),
+                                           mass_matrix[dir].n_cols(),
+                                           eigenvalues[dir].begin(),
+                                           &(eigenvectors[dir](0, 0)),
+                                           *cache);
         }
     }
 
@@ -616,8 +688,13 @@ namespace internal
         &derivative_matrix,
       std::array<Table<2, VectorizedArray<Number, n_lanes>>, dim> &eigenvectors,
       std::array<AlignedVector<VectorizedArray<Number, n_lanes>>, dim>
-        &eigenvalues)
+                                    &eigenvalues,
+      SpectralAssemblyCache<Number> *cache = nullptr)
     {
+      SpectralAssemblyCache<Number> local_cache;
+      if (cache == nullptr)
+        cache = &local_cache;
+
       const unsigned int     n_rows_1d = mass_matrix[0].n_cols();
       constexpr unsigned int macro_size =
         VectorizedArray<Number, n_lanes>::size();
@@ -665,13 +742,13 @@ namespace internal
           Number       *eigenvec_begin = eigenvectors_flat.data();
           Number       *eigenval_begin = eigenvalues_flat.data();
           for (unsigned int lane = 0; lane < macro_size; ++lane)
-            internal::TensorProductMatrixSymmetricSum::spectral_assembly<
-              Number>(mass_cbegin + nm * lane,
-                      deriv_cbegin + nm * lane,
-                      n_rows,
-                      n_cols,
-                      eigenval_begin + n_rows * lane,
-                      eigenvec_begin + nm * lane);
+            cached_spectral_assembly<Number>(mass_cbegin + nm * lane,
+                                             deriv_cbegin + nm * lane,
+                                             n_rows,
+                                             n_cols,
+                                             eigenval_begin + n_rows * lane,
+                                             eigenvec_begin + nm * lane,
+                                             *cache);
 
           eigenvalues[dir].resize(n_rows);
           eigenvectors[dir].reinit(n_rows, n_cols);
@@ -1204,6 +1281,13 @@ template <int dim, typename Number, int n_rows_1d>
 void
 TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::finalize()
 {
+  // the eigendecompositions are computed lane by lane; share them between
+  // all 1d problems of the collection so that each distinct one is only
+  // solved once
+  internal::TensorProductMatrixSymmetricSum::SpectralAssemblyCache<
+    typename dealii::internal::VectorizedArrayTrait<Number>::value_type>
+    spectral_cache;
+
   const auto store = [&](const unsigned int    index,
                          const MatrixPairType &M_and_K) {
     std::array<Table<2, Number>, 1> mass_matrix;
@@ -1218,7 +1302,8 @@ TensorProductMatrixSymmetricSumCollection<dim, Number, n_rows_1d>::finalize()
     internal::TensorProductMatrixSymmetricSum::setup(mass_matrix,
                                                      derivative_matrix,
                                                      eigenvectors,
-                                                     eigenvalues);
+                                                     eigenvalues,
+                                                     &spectral_cache);
 
     for (unsigned int i = 0, m = matrix_ptr[index], v = vector_ptr[index];
          i < mass_matrix[0].n_rows();
@@ -587,6 +587,39 @@ namespace LinearAlgebra
       void
       add(const Number factor, const SparseMatrix<Number, MemorySpace> &matrix);
 
+      /**
+       * Add a batch of cell matrices to this matrix without transferring any
+       * data to the host. The cell matrices are summed into the values of the
+       * local Tpetra::CrsMatrix directly in the memory space of this object,
+       * using atomic operations to resolve conflicts between cells that share
+       * degrees of freedom. The intended use is a GPU-based assembly, where
+       * the cell matrices are computed by a Kokkos kernel, e.g., by applying
+       * the cell operator of Portable::MatrixFree to unit vectors, and stay on
+       * the device.
+       *
+       * @p dof_indices has the layout (cell, i) and contains the global
+       * indices of the degrees of freedom of each cell, and @p cell_matrices
+       * has the layout (cell, i, j) and contains the entries of the cell
+       * matrices to be added at the positions (dof_indices(cell, i),
+       * dof_indices(cell, j)). Constraints are not resolved, i.e., the cell
+       * matrices need to be condensed by the caller.
+       *
+       * Only entries in locally owned rows are added, and all other ones are
+       * skipped. In parallel, the correct matrix is hence obtained if each
+       * process passes all cells that touch its locally owned rows, e.g., its
+       * locally owned and ghost cells. All entries added must be part of the
+       * sparsity pattern this matrix was initialized with.
+       *
+       * @note This function does not communicate and leaves the matrix in a
+       * compressed state.
+       */
+      void
+      add_cell_matrices(
+        const Kokkos::View<const size_type **,
+                           typename MemorySpace::kokkos_space> &dof_indices,
+        const Kokkos::View<const Number ***,
+                           typename MemorySpace::kokkos_space> &cell_matrices);
+
       /**
        * Set the element (<i>i,j</i>) to @p value.
        *
@@ -24,6 +24,8 @@
 #  include <deal.II/lac/trilinos_tpetra_sparse_matrix.h>
 #  include <deal.II/lac/trilinos_tpetra_sparsity_pattern.h>
 
+#  include <Tpetra_Details_OrdinalTraits.hpp>
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace LinearAlgebra
@@ -1206,6 +1208,60 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpace>
+    void
+    SparseMatrix<Number, MemorySpace>::add_cell_matrices(
+      const Kokkos::View<const size_type **, typename MemorySpace::kokkos_space>
+        &dof_indices,
+      const Kokkos::View<const Number ***, typename MemorySpace::kokkos_space>
+        &cell_matrices)
+    {
+      AssertDimension(dof_indices.extent(0), cell_matrices.extent(0));
+      AssertDimension(dof_indices.extent(1), cell_matrices.extent(1));
+      AssertDimension(dof_indices.extent(1), cell_matrices.extent(2));
+
+      // The values of the local matrix can only be modified on a matrix with
+      // fixed structure, so make sure the column map has been set up
+      if (!compressed)
+        compress(VectorOperation::add);
+
+      const auto row_map = matrix->getRowMap()->getLocalMap();
+      const auto col_map = matrix->getColMap()->getLocalMap();
+#  if DEAL_II_TRILINOS_VERSION_GTE(13, 2, 0)
+      const auto local_matrix = matrix->getLocalMatrixDevice();
+#  else
+      const auto local_matrix = matrix->getLocalMatrix();
+#  endif
+      const int n_cells       = dof_indices.extent(0);
+      const int dofs_per_cell = dof_indices.extent(1);
+
+      using ExecutionSpace =
+        typename MemorySpace::kokkos_space::execution_space;
+      Kokkos::parallel_for(
+        "dealii::TpetraWrappers::SparseMatrix::add_cell_matrices",
+        Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<2>>(
+          {0, 0}, {n_cells, dofs_per_cell}),
+        KOKKOS_LAMBDA(const int cell, const int i) {
+          const int local_row = row_map.getLocalElement(
+            static_cast<types::signed_global_dof_index>(dof_indices(cell, i)));
+          if (local_row == Tpetra::Details::OrdinalTraits<int>::invalid())
+            return;
+
+          for (int j = 0; j < dofs_per_cell; ++j)
+            {
+              const int local_col = col_map.getLocalElement(
+                static_cast<types::signed_global_dof_index>(
+                  dof_indices(cell, j)));
+              const Number value = cell_matrices(cell, i, j);
+              local_matrix.sumIntoValues(
+                local_row, &local_col, 1, &value, false, true);
+            }
+        });
+      Kokkos::fence();
+    }
+
+
+
     template <typename Number, typename MemorySpace>
     void
     SparseMatrix<Number, MemorySpace>::clear_row(const size_type row,
@@ -82,6 +82,12 @@ namespace LinearAlgebra
 #  ifndef DOXYGEN
   template <typename Number>
   class ReadWriteVector;
+
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
 #  endif
 
   /**
@@ -407,6 +413,27 @@ namespace LinearAlgebra
       reinit(const Vector<Number, MemorySpace> &V,
              const bool                         omit_zeroing_entries = false);
 
+      /**
+       * Reinitialize the vector such that it shares the memory of the locally
+       * owned entries of the deal.II vector @p v rather than copying them.
+       * Changes of the entries of either vector are hence visible in the other
+       * one. This allows to apply Trilinos preconditioners or solvers to
+       * vectors used in deal.II's own solvers without copying the data back
+       * and forth in every iteration.
+       *
+       * The present object does not take ownership of the memory of @p v.
+       * The vector @p v must hence neither be destroyed nor reinitialized
+       * while the present object is in use. The ghost entries of @p v are not
+       * part of the view.
+       *
+       * @note This function is only implemented for vectors in
+       * MemorySpace::Host.
+       */
+      void
+      reinit_as_view(
+        LinearAlgebra::distributed::Vector<Number, dealii::MemorySpace::Host>
+          &v);
+
       /**
        * Swap the contents of this vector and the other vector @p v. One could do
        * this operation with a temporary variable and copying over the data
@@ -26,6 +26,7 @@
 #  include <deal.II/base/index_set.h>
 #  include <deal.II/base/trilinos_utilities.h>
 
+#  include <deal.II/lac/la_parallel_vector.h>
 #  include <deal.II/lac/read_write_vector.h>
 
 #  include <boost/io/ios_state.hpp>
@@ -264,6 +265,38 @@ namespace LinearAlgebra
 
 
 
+    template <typename Number, typename MemorySpace>
+    void
+    Vector<Number, MemorySpace>::reinit_as_view(
+      LinearAlgebra::distributed::Vector<Number, dealii::MemorySpace::Host> &v)
+    {
+      if constexpr (std::is_same_v<MemorySpace, dealii::MemorySpace::Host>)
+        {
+          // Wrap the locally owned entries of v in an unmanaged Kokkos view,
+          // which Tpetra uses as storage on both the host and the device
+          // side since both coincide for host vectors.
+          using DualViewType = typename VectorType::dual_view_type;
+          const typename DualViewType::t_dev local_view(
+            v.begin(), v.locally_owned_size(), 1);
+
+          nonlocal_vector.reset();
+
+          compressed = true;
+          has_ghost  = false;
+          vector     = Utilities::Trilinos::internal::make_rcp<VectorType>(
+            v.locally_owned_elements().make_tpetra_map_rcp(
+              v.get_mpi_communicator(), true),
+            DualViewType(local_view, local_view));
+        }
+      else
+        {
+          (void)v;
+          AssertThrow(false, ExcNotImplemented());
+        }
+    }
+
+
+
     template <typename Number, typename MemorySpace>
     void
     Vector<Number, MemorySpace>::extract_subvector_to(
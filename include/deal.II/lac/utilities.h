@@ -18,6 +18,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/memory_space.h>
 #include <deal.II/base/signaling_nan.h>
 
 #include <deal.II/lac/lapack_support.h>
@@ -25,10 +26,33 @@
 
 #include <array>
 #include <complex>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
+// Forward declarations
+#ifndef DOXYGEN
+namespace LinearAlgebra
+{
+  namespace distributed
+  {
+    template <typename, typename>
+    class Vector;
+  } // namespace distributed
+} // namespace LinearAlgebra
+
+namespace Utilities
+{
+  namespace MPI
+  {
+    class Partitioner;
+  } // namespace MPI
+} // namespace Utilities
+#endif
+
 namespace Utilities
 {
   /**
@@ -170,6 +194,59 @@ namespace Utilities
                      const double                    tau,
                      VectorMemory<VectorType>       &vector_memory);
 
+    /**
+     * Compute approximations of the @p rank largest singular values and the
+     * associated left singular vectors of the matrix
+     * $A = [s_0, \ldots, s_{m-1}]$ whose $m$ = @p n_snapshots columns are
+     * distributed vectors, e.g., the snapshots from which a POD basis is
+     * built. The snapshots are never held in memory at the same time: the
+     * function @p get_snapshot is called with the index $j$ of a snapshot and
+     * a vector initialized with @p partitioner, into which it should write
+     * $s_j$, for example by reading it from disk or by recomputing it.
+     *
+     * This function implements the randomized SVD of Halko, Martinsson and
+     * Tropp (SIAM Review 53, 2011). It multiplies $A$ by a random Gaussian
+     * matrix with @p rank + @p oversampling columns to sample the range of
+     * $A$, improves the sample by @p n_power_iterations steps of the power
+     * iteration $A A^T$, and orthonormalizes it with a communication-avoiding
+     * tall-skinny QR factorization (TSQR) to obtain a basis $Q$. The singular
+     * value decomposition of the small matrix $Q^T A$ then yields the result.
+     * Every pass over the snapshots accumulates the products with all
+     * columns of the random or basis matrix at once, and the global
+     * reductions are done once per pass rather than once per snapshot. In
+     * total, each snapshot is requested 2 + 2 @p n_power_iterations times,
+     * and the memory consumption is that of @p rank + @p oversampling
+     * vectors.
+     *
+     * On return, @p singular_values contains the singular values in
+     * descending order and @p left_singular_vectors the corresponding
+     * orthonormal left singular vectors. If the numerical rank of $A$ is
+     * smaller than @p rank, fewer values and vectors are returned.
+     *
+     * The random matrix is generated with a fixed seed, identically on all
+     * processes, so the results are reproducible.
+     *
+     * @note This function uses LAPACK for the QR factorizations and
+     * singular value decompositions of small dense matrices.
+     */
+    template <typename Number>
+    void
+    randomized_svd(
+      const std::function<
+        void(const unsigned int,
+             dealii::LinearAlgebra::distributed::Vector<Number,
+                                                         MemorySpace::Host> &)>
+                                                               &get_snapshot,
+      const unsigned int                                        n_snapshots,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+      const unsigned int                                        rank,
+      std::vector<
+        dealii::LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+                          &left_singular_vectors,
+      std::vector<Number> &singular_values,
+      const unsigned int   oversampling       = 10,
+      const unsigned int   n_power_iterations = 1);
+
   } // namespace LinearAlgebra
 
 } // namespace Utilities
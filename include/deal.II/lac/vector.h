@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/atomic_operations.h>
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/index_set.h>
 #include <deal.II/base/numbers.h>
@@ -806,6 +807,16 @@ public:
       const size_type   *indices,
       const OtherNumber *values);
 
+  /**
+   * Select whether the three collective add() functions above may be called
+   * concurrently from several threads, also for the same indices. If
+   * @p concurrent is true, every vector entry is updated with an atomic
+   * operation. See SparseMatrix::set_concurrent_add() for the intended use
+   * in WorkStream loops without graph coloring.
+   */
+  void
+  set_concurrent_add(const bool concurrent);
+
   /**
    * Addition of @p s to all components. Note that @p s is a scalar and not a
    * vector.
@@ -1104,6 +1115,12 @@ private:
   mutable std::shared_ptr<parallel::internal::TBBPartitioner>
     thread_loop_partitioner;
 
+  /**
+   * Whether the collective add() functions use atomic operations, see
+   * set_concurrent_add().
+   */
+  bool concurrent_add = false;
+
   // Make all other vector types friends.
   template <typename Number2>
   friend class Vector;
@@ -1368,12 +1385,24 @@ Vector<Number>::add(const size_type    n_indices,
         ExcMessage(
           "The given value is not finite but either infinite or Not A Number (NaN)"));
 
-      this->values[indices[i]] += values[i];
+      if (concurrent_add)
+        internal::atomic_add(this->values[indices[i]], Number(values[i]));
+      else
+        this->values[indices[i]] += values[i];
     }
 }
 
 
 
+template <typename Number>
+inline void
+Vector<Number>::set_concurrent_add(const bool concurrent)
+{
+  concurrent_add = concurrent;
+}
+
+
+
 template <typename Number>
 template <typename Number2>
 inline bool
@@ -20,6 +20,7 @@
 
 #include <deal.II/lac/trilinos_epetra_vector.h>
 #include <deal.II/lac/trilinos_tpetra_vector.h>
+#include <deal.II/lac/vector.h>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -77,6 +78,33 @@ namespace internal
 
 
 
+  // Vector goes through its collective add() function, which respects the
+  // setting of Vector::set_concurrent_add()
+  template <typename Number>
+  struct ElementAccess<Vector<Number>>
+  {
+  public:
+    static void
+    add(const Number value, const types::global_dof_index i, Vector<Number> &V)
+    {
+      V.add(1, &i, &value);
+    }
+
+    static void
+    set(const Number value, const types::global_dof_index i, Vector<Number> &V)
+    {
+      V(i) = value;
+    }
+
+    static Number
+    get(const Vector<Number> &V, const types::global_dof_index i)
+    {
+      return V(i);
+    }
+  };
+
+
+
 #ifdef DEAL_II_WITH_TRILINOS
   template <>
   inline void
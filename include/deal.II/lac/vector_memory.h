@@ -23,6 +23,7 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -308,6 +309,20 @@ public:
  * GrowingVectorMemory object whenever needed without the performance penalty
  * of creating a new memory pool every time. A drawback of this policy is that
  * vectors once allocated are only released at the end of the program run.
+ *
+ * To allow many threads to allocate and release vectors at the same time,
+ * e.g., in nested solvers run inside tasks, the global pool is split into
+ * one pool per thread, each guarded by its own mutex that is uncontended in
+ * the common case of a vector being released on the thread that allocated
+ * it. Only the first use of the class on a thread and the release of a
+ * vector on a different thread than the one it was allocated on need to
+ * synchronize with the other threads. The number of pools is limited to
+ * twice the number of hardware threads; beyond that, threads share pools.
+ *
+ * As the vectors of a pool keep their size and parallel layout, the
+ * alloc_like() function returns, if possible, an unused vector that already
+ * has the layout of a given vector, so that re-initializing it neither
+ * allocates memory nor sets up the ghost layout again.
  */
 template <typename VectorType = dealii::Vector<double>>
 class GrowingVectorMemory : public VectorMemory<VectorType>
@@ -374,6 +389,21 @@ public:
   virtual void
   free(const VectorType *const) override;
 
+  /**
+   * Return a pointer to a vector re-initialized with the layout of
+   * @p exemplar by calling <code>reinit(exemplar,
+   * omit_zeroing_entries)</code>. Among the unused vectors of the pool of
+   * the current thread, one that already has the same layout as
+   * @p exemplar is preferred, which for LinearAlgebra::distributed::Vector
+   * means the same Utilities::MPI::Partitioner object, so that the
+   * re-initialization does not need to allocate memory.
+   *
+   * The vector must be returned through free(), as for alloc().
+   */
+  VectorType *
+  alloc_like(const VectorType &exemplar,
+             const bool        omit_zeroing_entries = false);
+
   /**
    * Release all vectors that are not currently in use.
    */
@@ -399,8 +429,8 @@ private:
    * The class providing the actual storage for the memory pool.
    *
    * This is where the actual storage for GrowingVectorMemory is provided.
-   * Only one of these pools is used for each vector type, thus allocating all
-   * vectors from the same storage.
+   * There is one pool per thread (see the class documentation) for each
+   * vector type, shared by all objects of this class.
    */
   struct Pool
   {
@@ -424,25 +454,46 @@ private:
      * Pointer to the storage object
      */
     std::vector<entry_type> *data;
+
+    /**
+     * Mutex guarding #data.
+     */
+    std::mutex mutex;
   };
 
   /**
-   * Return an array of allocated vectors.
+   * Return all pools of this vector type. Adding pools to and traversing
+   * the returned object requires to hold #mutex.
+   */
+  static std::vector<std::unique_ptr<Pool>> &
+  get_pools();
+
+  /**
+   * Return the pool of the current thread.
    */
   static Pool &
-  get_pool();
+  get_thread_pool();
+
+  /**
+   * Mark an unused vector of @p pool as used and return it, adding a new
+   * vector if there is none. If @p exemplar is given, an unused vector with
+   * the same layout is preferred. The caller must hold the mutex of
+   * @p pool.
+   */
+  static VectorType *
+  claim_vector(Pool &pool, const VectorType *exemplar);
 
   /**
    * Overall number of allocations. Only used for bookkeeping and to generate
    * output at the end of an object's lifetime.
    */
-  size_type total_alloc;
+  std::atomic<size_type> total_alloc;
 
   /**
    * Number of vectors currently allocated in this object; used for detecting
    * memory leaks.
    */
-  size_type current_alloc;
+  std::atomic<size_type> current_alloc;
 
   /**
    * A flag controlling the logging of statistics by the destructor.
@@ -450,7 +501,7 @@ private:
   bool log_statistics;
 
   /**
-   * Mutex to synchronize access to internal data of this object from multiple
+   * Mutex to synchronize the creation and traversal of the pools of all
    * threads.
    */
   static Threads::Mutex mutex;
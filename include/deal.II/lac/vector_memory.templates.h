@@ -21,34 +21,88 @@
 #include <deal.II/base/kokkos.h>
 #include <deal.II/base/logstream.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/template_constraints.h>
 
 #include <deal.II/lac/vector_memory.h>
 
+#include <algorithm>
 #include <memory>
+#include <thread>
 
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace internal
+{
+  namespace GrowingVectorMemoryImplementation
+  {
+    template <typename VectorType>
+    using get_partitioner_t =
+      decltype(std::declval<const VectorType &>().get_partitioner());
+
+    /**
+     * Return whether re-initializing @p v with the layout of @p exemplar
+     * is expected to be cheap, i.e., whether both vectors share the same
+     * partitioner (if the vector type has one) and have the same size.
+     */
+    template <typename VectorType>
+    bool
+    has_same_layout(const VectorType &v, const VectorType &exemplar)
+    {
+      if constexpr (is_supported_operation<get_partitioner_t, VectorType>)
+        if (v.get_partitioner().get() != exemplar.get_partitioner().get())
+          return false;
+      return v.size() == exemplar.size();
+    }
+  } // namespace GrowingVectorMemoryImplementation
+} // namespace internal
+
+
+
 template <typename VectorType>
-typename GrowingVectorMemory<VectorType>::Pool &
-GrowingVectorMemory<VectorType>::get_pool()
+std::vector<std::unique_ptr<typename GrowingVectorMemory<VectorType>::Pool>> &
+GrowingVectorMemory<VectorType>::get_pools()
 {
-  // Kokkos needs to be initialized before constructing the static Pool for
+  // Kokkos needs to be initialized before constructing the static pools for
   // vector types that use Kokkos.
   // If Kokkos is initialized by deal.II, this make sure that it is finalized
-  // after the Pool has been destroyed.
+  // after the pools have been destroyed.
   // If Kokkos is not initialized by deal.II, we assume that Kokkos is not
   // finalized past program end together with static variables and we need to
-  // make sure to empty the Pool when finalizing Kokkos so that the destruction
-  // of the Pool doesn't call Kokkos functions.
-  static auto pool = []() {
+  // make sure to empty the pools when finalizing Kokkos so that the
+  // destruction of the pools doesn't call Kokkos functions.
+  static auto pools = []() {
     internal::ensure_kokkos_initialized();
     if (!internal::dealii_initialized_kokkos)
       Kokkos::push_finalize_hook(
         GrowingVectorMemory<VectorType>::release_unused_memory);
-    return GrowingVectorMemory<VectorType>::Pool{};
+    return std::vector<std::unique_ptr<Pool>>();
+  }();
+  return pools;
+}
+
+
+
+template <typename VectorType>
+typename GrowingVectorMemory<VectorType>::Pool &
+GrowingVectorMemory<VectorType>::get_thread_pool()
+{
+  // Each thread picks its pool upon first use. Since all accesses to a pool
+  // are guarded by the pool's mutex, sharing a pool between threads once
+  // the maximal number of pools has been reached is correct, merely slower.
+  static thread_local Pool *const pool = []() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto              &pools = get_pools();
+    const unsigned int max_n_pools =
+      2 * std::max(std::thread::hardware_concurrency(), 1U);
+    if (pools.size() < max_n_pools)
+      return pools.emplace_back(std::make_unique<Pool>()).get();
+
+    static unsigned int next_shared_pool = 0;
+    return pools[next_shared_pool++ % pools.size()].get();
   }();
-  return pool;
+  return *pool;
 }
 
 
@@ -107,13 +161,12 @@ inline GrowingVectorMemory<VectorType>::GrowingVectorMemory(
   , current_alloc(0)
   , log_statistics(log_statistics)
 {
-  // Constructors generally cannot be called in parallel and so it is not
-  // necessary to guard access to member variables with a mutex -- unless
-  // the member variable being accessed is 'static', which is the case
-  // for the things get_pool() returns, and in that case the mutex itself
-  // must also be 'static' as it is here.
-  std::lock_guard<std::mutex> lock(mutex);
-  get_pool().initialize(initial_size);
+  // The pool of the current thread is shared with other objects of this
+  // class (and possibly other threads), so it must be accessed under its
+  // mutex.
+  Pool                       &pool = get_thread_pool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  pool.initialize(initial_size);
 }
 
 
@@ -121,13 +174,23 @@ template <typename VectorType>
 inline GrowingVectorMemory<VectorType>::~GrowingVectorMemory()
 {
   AssertNothrow(current_alloc == 0,
-                StandardExceptions::ExcMemoryLeak(current_alloc));
+                StandardExceptions::ExcMemoryLeak(current_alloc.load()));
   if (log_statistics)
     {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      std::size_t n_vectors = 0;
+      for (const auto &pool : get_pools())
+        {
+          std::lock_guard<std::mutex> pool_lock(pool->mutex);
+          if (pool->data != nullptr)
+            n_vectors += pool->data->size();
+        }
+
       deallog << "GrowingVectorMemory:Overall allocated vectors: "
-              << total_alloc << std::endl;
+              << total_alloc.load() << std::endl;
       deallog << "GrowingVectorMemory:Maximum allocated vectors: "
-              << get_pool().data->size() << std::endl;
+              << n_vectors << std::endl;
     }
 }
 
@@ -135,29 +198,72 @@ inline GrowingVectorMemory<VectorType>::~GrowingVectorMemory()
 
 template <typename VectorType>
 inline VectorType *
-GrowingVectorMemory<VectorType>::alloc()
+GrowingVectorMemory<VectorType>::claim_vector(Pool             &pool,
+                                              const VectorType *exemplar)
 {
-  std::lock_guard<std::mutex> lock(mutex);
+  pool.initialize(0);
+
+  // See if there is a currently unused vector available in our list,
+  // preferably one with the same layout as the exemplar
+  entry_type *unused_entry = nullptr;
+  for (entry_type &i : *pool.data)
+    if (i.first == false)
+      {
+        if (exemplar == nullptr ||
+            internal::GrowingVectorMemoryImplementation::has_same_layout(
+              *i.second, *exemplar))
+          {
+            unused_entry = &i;
+            break;
+          }
+        else if (unused_entry == nullptr)
+          unused_entry = &i;
+      }
+
+  // No currently unused vector found, so let's just allocate a new one
+  if (unused_entry == nullptr)
+    unused_entry =
+      &pool.data->emplace_back(false, std::make_unique<VectorType>());
+
+  unused_entry->first = true;
+  return unused_entry->second.get();
+}
+
+
 
+template <typename VectorType>
+inline VectorType *
+GrowingVectorMemory<VectorType>::alloc()
+{
   ++total_alloc;
   ++current_alloc;
 
-  // See if there is a currently unused vector available in our list
-  for (entry_type &i : *get_pool().data)
-    {
-      if (i.first == false)
-        {
-          i.first = true;
-          return i.second.get();
-        }
-    }
+  Pool                       &pool = get_thread_pool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  return claim_vector(pool, nullptr);
+}
 
-  // No currently unused vector found, so let's just allocate a new one
-  // and return it:
-  const auto &new_entry =
-    get_pool().data->emplace_back(true, std::make_unique<VectorType>());
 
-  return new_entry.second.get();
+
+template <typename VectorType>
+inline VectorType *
+GrowingVectorMemory<VectorType>::alloc_like(const VectorType &exemplar,
+                                            const bool omit_zeroing_entries)
+{
+  ++total_alloc;
+  ++current_alloc;
+
+  VectorType *v = nullptr;
+  {
+    Pool                       &pool = get_thread_pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    v = claim_vector(pool, &exemplar);
+  }
+
+  // the vector is owned by the caller now, so it can be set up outside the
+  // lock
+  v->reinit(exemplar, omit_zeroing_entries);
+  return v;
 }
 
 
@@ -166,18 +272,31 @@ template <typename VectorType>
 inline void
 GrowingVectorMemory<VectorType>::free(const VectorType *const v)
 {
-  std::lock_guard<std::mutex> lock(mutex);
+  const auto mark_unused = [&](Pool &pool) {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if (pool.data != nullptr)
+      for (entry_type &i : *pool.data)
+        if (v == i.second.get())
+          {
+            i.first = false;
+            --current_alloc;
+            return true;
+          }
+    return false;
+  };
+
+  // In the common case, the vector is returned on the thread that allocated
+  // it. Otherwise, search the pools of all threads.
+  Pool &thread_pool = get_thread_pool();
+  if (mark_unused(thread_pool))
+    return;
 
-  // Find the vector to be de-allocated and mark it as now unused:
-  for (entry_type &i : *get_pool().data)
-    {
-      if (v == i.second.get())
-        {
-          i.first = false;
-          --current_alloc;
-          return;
-        }
-    }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto &pool : get_pools())
+      if (pool.get() != &thread_pool && mark_unused(*pool))
+        return;
+  }
 
   // If we got here, someone is trying to free a vector that has not
   // been allocated!
@@ -192,8 +311,12 @@ GrowingVectorMemory<VectorType>::release_unused_memory()
 {
   std::lock_guard<std::mutex> lock(mutex);
 
-  if (get_pool().data != nullptr)
-    get_pool().data->clear();
+  for (const auto &pool : get_pools())
+    {
+      std::lock_guard<std::mutex> pool_lock(pool->mutex);
+      if (pool->data != nullptr)
+        pool->data->clear();
+    }
 }
 
 
@@ -205,14 +328,19 @@ GrowingVectorMemory<VectorType>::memory_consumption() const
   std::lock_guard<std::mutex> lock(mutex);
 
   std::size_t result = sizeof(*this);
-  for (const auto &[_, ptr] : *get_pool().data)
-    result += sizeof(ptr) + (ptr ? MemoryConsumption::memory_consumption(*ptr) :
-                                   MemoryConsumption::memory_consumption(ptr));
+  for (const auto &pool : get_pools())
+    {
+      std::lock_guard<std::mutex> pool_lock(pool->mutex);
+      if (pool->data != nullptr)
+        for (const auto &[_, ptr] : *pool->data)
+          result += sizeof(ptr) +
+                    (ptr ? MemoryConsumption::memory_consumption(*ptr) :
+                           MemoryConsumption::memory_consumption(ptr));
+    }
 
   return result;
 }
 
-
 DEAL_II_NAMESPACE_CLOSE
 
 #endif
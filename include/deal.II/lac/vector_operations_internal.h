@@ -27,8 +27,11 @@
 
 #include <deal.II/lac/vector_operation.h>
 
+#include <array>
 #include <cstdio>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -191,6 +194,71 @@ namespace internal
     }
 
 
+
+    // Same as parallel_for() above, but for a functor that returns an array
+    // of @p n_sums partial sums for each subrange. The partial sums are
+    // added in the order of the subranges, with the same subranges and
+    // assignment to threads as in parallel_for(), such that the result only
+    // depends on the number of threads (as for the other reductions in this
+    // file).
+    template <typename Number, std::size_t n_sums, typename Functor>
+    std::array<Number, n_sums>
+    parallel_sum_over_subranges(
+      const Functor  &functor,
+      const size_type start,
+      const size_type end,
+      const std::shared_ptr<::dealii::parallel::internal::TBBPartitioner>
+        &partitioner)
+    {
+      std::array<Number, n_sums> sums = {};
+#ifdef DEAL_II_WITH_TBB
+      const size_type vec_size = end - start;
+      if (vec_size >=
+            4 * internal::VectorImplementation::minimum_parallel_grain_size &&
+          MultithreadInfo::n_threads() > 1)
+        {
+          Assert(partitioner.get() != nullptr,
+                 ExcInternalError(
+                   "Unexpected initialization of Vector that does "
+                   "not set the TBB partitioner to a usable state."));
+
+          std::vector<std::array<Number, n_sums>> partial_sums;
+          size_type                               chunk_size = 1;
+          const auto chunk_functor = [&](const size_type begin_chunk,
+                                         const size_type end_chunk) {
+            partial_sums[(begin_chunk - start) / chunk_size] =
+              functor(begin_chunk, end_chunk);
+          };
+          TBBForFunctor<decltype(chunk_functor)> generic_functor(
+            chunk_functor, start, end);
+          chunk_size = generic_functor.chunk_size;
+          partial_sums.resize(generic_functor.n_chunks);
+
+          std::shared_ptr<tbb::affinity_partitioner> tbb_partitioner =
+            partitioner->acquire_one_partitioner();
+          ::dealii::parallel::internal::parallel_for(
+            static_cast<size_type>(0),
+            static_cast<size_type>(generic_functor.n_chunks),
+            generic_functor,
+            1,
+            tbb_partitioner);
+          partitioner->release_one_partitioner(tbb_partitioner);
+
+          for (const auto &partial_sum : partial_sums)
+            for (std::size_t i = 0; i < n_sums; ++i)
+              sums[i] += partial_sum[i];
+        }
+      else if (vec_size > 0)
+        sums = functor(start, end);
+#else
+      if (end > start)
+        sums = functor(start, end);
+      (void)partitioner;
+#endif
+      return sums;
+    }
+
+
     // Define the functors necessary to use SIMD with TBB. we also include the
     // simple copy and set operations
 
@@ -0,0 +1,435 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_cell_patch_smoother_h
+#define dealii_matrix_free_cell_patch_smoother_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/tensor_product_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <deal.II/numerics/tensor_product_matrix_creator.h>
+
+#include <memory>
+#include <set>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+/**
+ * An additive Schwarz smoother with one patch per cell for the Laplacian
+ * discretized with continuous FE_Q elements in a MatrixFree context. On each
+ * cell, the inverse of the local matrix is applied with the fast
+ * diagonalization method of TensorProductMatrixSymmetricSum, based on the
+ * 1d mass and stiffness matrices from
+ * TensorProductMatrixCreator::create_laplace_tensor_product_matrix() for a
+ * Cartesian cell with the extent of the actual cell. The 1d matrices of all
+ * cells are kept in a TensorProductMatrixSymmetricSumCollection, which only
+ * stores one copy of matrices shared by several cells, e.g., on a uniform
+ * Cartesian mesh.
+ *
+ * The local solutions are added into the global result with
+ * FEEvaluation::distribute_local_to_global(), i.e., the ghost exchange of
+ * the vector partitioner handles the overlap of the patches on the degrees
+ * of freedom shared between cells. To keep the operation symmetric, both
+ * the input and the result are scaled by $\sqrt{\omega/n_i}$, where $n_i$ is
+ * the number of cells sharing the degree of freedom $i$ and $\omega$ the
+ * relaxation parameter.
+ *
+ * The class provides the interface expected by MGSmootherPrecondition and
+ * PreconditionChebyshev. As an example, a multigrid smoother based on this
+ * class is set up by
+ * @code
+ * using SmootherType = CellPatchSmoother<dim, float>;
+ * MGSmootherPrecondition<LevelMatrixType, SmootherType, VectorType>
+ *   mg_smoother(2);
+ * SmootherType::AdditionalData smoother_data;
+ * smoother_data.relaxation           = 0.7;
+ * smoother_data.dirichlet_boundaries = {0};
+ * mg_smoother.initialize(mg_matrices, smoother_data);
+ * @endcode
+ * where the level matrices need to provide a function get_matrix_free() as
+ * MatrixFreeOperators::Base does.
+ *
+ * @note The local matrices only consider the degrees of freedom of the
+ * respective cell, i.e., the overlap parameter of
+ * TensorProductMatrixCreator::create_laplace_tensor_product_matrix() is
+ * one. On curved or non-Cartesian cells, the fast diagonalization is only
+ * an approximation of the local matrix, which is usually sufficient for a
+ * smoother.
+ *
+ * @ingroup matrixfree
+ */
+template <int dim,
+          typename Number,
+          typename VectorizedArrayType = VectorizedArray<Number>>
+class CellPatchSmoother : public Subscriptor
+{
+public:
+  /**
+   * The type of vector this class works on.
+   */
+  using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+  /**
+   * Parameters of the smoother.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(const double                        relaxation = 1.,
+                   const std::set<types::boundary_id> &dirichlet_boundaries =
+                     std::set<types::boundary_id>(),
+                   const unsigned int dof_no = 0);
+
+    /**
+     * The relaxation parameter $\omega$ applied to the sum of the local
+     * solutions.
+     */
+    double relaxation;
+
+    /**
+     * The boundary ids with Dirichlet conditions. All other boundaries are
+     * treated as Neumann boundaries.
+     */
+    std::set<types::boundary_id> dirichlet_boundaries;
+
+    /**
+     * The index of the DoFHandler within the MatrixFree object.
+     */
+    unsigned int dof_no;
+  };
+
+  /**
+   * Set up the local matrices and their fast diagonalization for all cells
+   * of @p matrix_free.
+   */
+  void
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Same as above, with the MatrixFree object taken from the function
+   * get_matrix_free() of @p matrix. This is the interface used by
+   * MGSmootherPrecondition.
+   */
+  template <typename MatrixType>
+  void
+  initialize(const MatrixType     &matrix,
+             const AdditionalData &additional_data = AdditionalData());
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Apply the smoother, i.e., the weighted sum of the inverses of the local
+   * matrices on all cells, to @p src.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Apply the transpose of the smoother, which is the same as vmult() due
+   * to the symmetric weighting.
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * Return the memory consumption of this class in bytes.
+   */
+  std::size_t
+  memory_consumption() const;
+
+private:
+  /**
+   * Apply the local inverses on a range of cell batches.
+   */
+  void
+  local_apply(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+              VectorType                                         &dst,
+              const VectorType                                   &src,
+              const std::pair<unsigned int, unsigned int> &cell_range) const;
+
+  /**
+   * Pointer to the underlying MatrixFree object.
+   */
+  SmartPointer<const MatrixFree<dim, Number, VectorizedArrayType>>
+    matrix_free;
+
+  /**
+   * The index of the DoFHandler within the MatrixFree object.
+   */
+  unsigned int dof_no;
+
+  /**
+   * The fast diagonalization of the local matrices, indexed by the cell
+   * batch.
+   */
+  std::unique_ptr<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>
+    local_inverses;
+
+  /**
+   * The weights $\sqrt{\omega/n_i}$ applied to the input and the result.
+   */
+  VectorType weights;
+
+  /**
+   * Temporary vector holding the weighted input.
+   */
+  mutable VectorType weighted_src;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int dim, typename Number, typename VectorizedArrayType>
+CellPatchSmoother<dim, Number, VectorizedArrayType>::AdditionalData::
+  AdditionalData(const double                        relaxation,
+                 const std::set<types::boundary_id> &dirichlet_boundaries,
+                 const unsigned int                  dof_no)
+  : relaxation(relaxation)
+  , dirichlet_boundaries(dirichlet_boundaries)
+  , dof_no(dof_no)
+{}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const AdditionalData                               &additional_data)
+{
+  clear();
+
+  this->matrix_free = &matrix_free;
+  dof_no            = additional_data.dof_no;
+
+  const auto &dof_handler = matrix_free.get_dof_handler(dof_no);
+  const auto &fe          = dof_handler.get_fe();
+  AssertThrow(fe.n_components() == 1 &&
+                dynamic_cast<const FE_Q<dim> *>(&fe) != nullptr,
+              ExcMessage("CellPatchSmoother is only implemented for scalar "
+                         "FE_Q elements."));
+
+  const FE_Q<1>             fe_1d(fe.degree);
+  const QGauss<1>           quadrature_1d(fe.degree + 1);
+  const Triangulation<dim> &tria = dof_handler.get_triangulation();
+
+  std::set<types::boundary_id> neumann_boundaries;
+  for (const types::boundary_id id : tria.get_boundary_ids())
+    if (additional_data.dirichlet_boundaries.find(id) ==
+        additional_data.dirichlet_boundaries.end())
+      neumann_boundaries.insert(id);
+
+  const unsigned int n_cell_batches = matrix_free.n_cell_batches();
+  local_inverses = std::make_unique<
+    TensorProductMatrixSymmetricSumCollection<dim, VectorizedArrayType>>();
+  local_inverses->reserve(n_cell_batches);
+
+  for (unsigned int batch = 0; batch < n_cell_batches; ++batch)
+    {
+      std::array<Table<2, VectorizedArrayType>, dim> Ms, Ks;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          Ms[d].reinit(fe.degree + 1, fe.degree + 1);
+          Ks[d].reinit(fe.degree + 1, fe.degree + 1);
+        }
+
+      for (unsigned int v = 0;
+           v < matrix_free.n_active_entries_per_cell_batch(batch);
+           ++v)
+        {
+          const auto cell = matrix_free.get_cell_iterator(batch, v, dof_no);
+
+          // extent of the cell and its left and right neighbors in each
+          // direction, with zero for boundaries
+          dealii::ndarray<double, dim, 3> cell_extent = {};
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              cell_extent[d][1] = cell->extent_in_direction(d);
+              for (unsigned int side = 0; side < 2; ++side)
+                if (cell->at_boundary(2 * d + side) == false ||
+                    cell->has_periodic_neighbor(2 * d + side))
+                  cell_extent[d][2 * side] =
+                    cell->neighbor_or_periodic_neighbor(2 * d + side)
+                      ->extent_in_direction(d);
+            }
+
+          const auto M_and_K = TensorProductMatrixCreator::
+            create_laplace_tensor_product_matrix<dim, Number>(
+              cell,
+              additional_data.dirichlet_boundaries,
+              neumann_boundaries,
+              fe_1d,
+              quadrature_1d,
+              cell_extent);
+
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int i = 0; i < fe.degree + 1; ++i)
+              for (unsigned int j = 0; j < fe.degree + 1; ++j)
+                {
+                  Ms[d][i][j][v] = M_and_K.first[d][i][j];
+                  Ks[d][i][j][v] = M_and_K.second[d][i][j];
+                }
+        }
+
+      local_inverses->insert(batch, Ms, Ks);
+    }
+
+  local_inverses->finalize();
+
+  // count the number of cells sharing each unknown to set up the weights
+  matrix_free.initialize_dof_vector(weights, dof_no);
+  matrix_free.initialize_dof_vector(weighted_src, dof_no);
+  {
+    FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(matrix_free,
+                                                                 dof_no);
+    for (unsigned int batch = 0; batch < n_cell_batches; ++batch)
+      {
+        phi.reinit(batch);
+        for (const unsigned int i : phi.dof_indices())
+          phi.begin_dof_values()[i] = Number(1);
+        phi.distribute_local_to_global(weights);
+      }
+    weights.compress(VectorOperation::add);
+  }
+  for (Number &weight : weights)
+    weight = (weight > Number(0)) ?
+               Number(std::sqrt(additional_data.relaxation / weight)) :
+               Number(0);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename MatrixType>
+void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::initialize(
+  const MatrixType     &matrix,
+  const AdditionalData &additional_data)
+{
+  initialize(*matrix.get_matrix_free(), additional_data);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::clear()
+{
+  matrix_free = nullptr;
+  dof_no      = 0;
+  local_inverses.reset();
+  weights.reinit(0);
+  weighted_src.reinit(0);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  Assert(matrix_free != nullptr, ExcNotInitialized());
+
+  weighted_src = src;
+  weighted_src.scale(weights);
+
+  matrix_free->cell_loop(
+    &CellPatchSmoother::local_apply, this, dst, weighted_src, true);
+
+  dst.scale(weights);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::Tvmult(
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  vmult(dst, src);
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+CellPatchSmoother<dim, Number, VectorizedArrayType>::local_apply(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  VectorType                                         &dst,
+  const VectorType                                   &src,
+  const std::pair<unsigned int, unsigned int>        &cell_range) const
+{
+  FEEvaluation<dim, -1, 0, 1, Number, VectorizedArrayType> phi(matrix_free,
+                                                               dof_no);
+  AlignedVector<VectorizedArrayType> local_src(phi.dofs_per_cell);
+
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      phi.reinit(cell);
+      phi.read_dof_values(src);
+      for (const unsigned int i : phi.dof_indices())
+        local_src[i] = phi.begin_dof_values()[i];
+
+      local_inverses->apply_inverse(
+        cell,
+        make_array_view(phi.begin_dof_values(),
+                        phi.begin_dof_values() + phi.dofs_per_cell),
+        make_array_view(local_src.begin(), local_src.end()));
+
+      phi.distribute_local_to_global(dst);
+    }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+std::size_t
+CellPatchSmoother<dim, Number, VectorizedArrayType>::memory_consumption()
+  const
+{
+  return (local_inverses ? local_inverses->memory_consumption() : 0) +
+         weights.memory_consumption() + weighted_src.memory_consumption();
+}
+
+#endif
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
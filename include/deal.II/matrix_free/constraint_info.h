@@ -20,6 +20,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/floating_point_comparator.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/matrix_free/dof_info.h>
 #include <deal.II/matrix_free/evaluation_template_factory.h>
@@ -192,6 +193,14 @@ namespace internal
       std::vector<unsigned int>               active_fe_indices;
 
     private:
+      /**
+       * Release the data structures that are only needed between reinit()
+       * and finalize(), including the HangingNodes object, which stores
+       * information about all lines of the triangulation.
+       */
+      void
+      clear_setup_data();
+
       inline const typename Number::value_type *
       constraint_pool_begin(const unsigned int row) const;
 
@@ -618,9 +627,6 @@ namespace internal
 
       AssertDimension(constraint_pool_data.size(), length);
 
-      this->dof_indices_per_cell.clear();
-      constraint_indicator_per_cell.clear();
-
       if (hanging_nodes &&
           std::all_of(hanging_node_constraint_masks.begin(),
                       hanging_node_constraint_masks.end(),
@@ -628,6 +634,8 @@ namespace internal
                         return i == unconstrained_compressed_constraint_kind;
                       }))
         hanging_node_constraint_masks.clear();
+
+      clear_setup_data();
     }
 
 
@@ -635,43 +643,43 @@ namespace internal
     inline std::shared_ptr<const Utilities::MPI::Partitioner>
     ConstraintInfo<dim, Number, IndexType>::finalize(const MPI_Comm comm)
     {
-      this->dof_indices.clear();
-      this->plain_dof_indices.clear();
-      this->constraint_indicator.clear();
-
-      this->row_starts.clear();
-      this->row_starts.reserve(this->dof_indices_per_cell.size());
-      this->row_starts.emplace_back(0, 0);
-
-      if (this->plain_dof_indices_per_cell.empty() == false)
+      const unsigned int n_cells = this->dof_indices_per_cell.size();
+      const bool has_plain_indices =
+        this->plain_dof_indices_per_cell.empty() == false;
+
+      // compute the offsets of the cells in the flat arrays up front, so
+      // that the cells can be written independently of each other below
+      this->row_starts.resize(n_cells + 1);
+      this->row_starts[0] = {0, 0};
+      for (unsigned int i = 0; i < n_cells; ++i)
+        this->row_starts[i + 1] = {
+          this->row_starts[i].first + this->dof_indices_per_cell[i].size(),
+          this->row_starts[i].second +
+            this->constraint_indicator_per_cell[i].size()};
+
+      if (has_plain_indices)
         {
-          this->row_starts_plain_indices.clear();
-          this->row_starts_plain_indices.reserve(
-            this->dof_indices_per_cell.size());
-          this->row_starts_plain_indices.emplace_back(0);
+          this->row_starts_plain_indices.resize(n_cells + 1);
+          this->row_starts_plain_indices[0] = 0;
+          for (unsigned int i = 0; i < n_cells; ++i)
+            this->row_starts_plain_indices[i + 1] =
+              this->row_starts_plain_indices[i] +
+              this->plain_dof_indices_per_cell[i].size();
         }
 
-      std::vector<types::global_dof_index>  ghost_dofs;
-      std::pair<unsigned int, unsigned int> counts = {0, 0};
+      const IndexType n_owned_indices = local_range.second - local_range.first;
 
-      for (unsigned int i = 0; i < this->dof_indices_per_cell.size(); ++i)
+      std::vector<types::global_dof_index> ghost_dofs;
+      for (unsigned int i = 0; i < n_cells; ++i)
         {
-          counts.first += this->dof_indices_per_cell[i].size();
-
           for (const auto &j : this->dof_indices_per_cell[i])
-            if (j >= (local_range.second - local_range.first))
-              ghost_dofs.push_back(j -
-                                   (local_range.second - local_range.first));
-
-          if (this->plain_dof_indices_per_cell.empty() == false)
-            {
-              counts.second += this->plain_dof_indices_per_cell[i].size();
+            if (j >= n_owned_indices)
+              ghost_dofs.push_back(j - n_owned_indices);
 
-              for (const auto &j : this->plain_dof_indices_per_cell[i])
-                if (j >= (local_range.second - local_range.first))
-                  ghost_dofs.push_back(
-                    j - (local_range.second - local_range.first));
-            }
+          if (has_plain_indices)
+            for (const auto &j : this->plain_dof_indices_per_cell[i])
+              if (j >= n_owned_indices)
+                ghost_dofs.push_back(j - n_owned_indices);
         }
 
       std::sort(ghost_dofs.begin(), ghost_dofs.end());
@@ -686,40 +694,45 @@ namespace internal
                                                       locally_relevant_dofs,
                                                       comm);
 
-      this->dof_indices.reserve(counts.first);
-      this->plain_dof_indices.reserve(counts.second);
+      this->dof_indices.resize(this->row_starts.back().first);
+      this->constraint_indicator.resize(this->row_starts.back().second);
+      this->plain_dof_indices.resize(
+        has_plain_indices ? this->row_starts_plain_indices.back() : 0);
 
-      for (unsigned int i = 0; i < this->dof_indices_per_cell.size(); ++i)
-        {
-          for (const auto &j : this->dof_indices_per_cell[i])
-            if (j < (local_range.second - local_range.first))
-              this->dof_indices.push_back(j);
-            else
-              this->dof_indices.push_back(partitioner->global_to_local(
-                j - (local_range.second - local_range.first)));
-
-          this->constraint_indicator.insert(
-            this->constraint_indicator.end(),
-            constraint_indicator_per_cell[i].begin(),
-            constraint_indicator_per_cell[i].end());
-
-          this->row_starts.emplace_back(this->dof_indices.size(),
-                                        this->constraint_indicator.size());
+      // translate the indices of ghost entries into the numbering of the
+      // partitioner, which only involves read access to the partitioner
+      const auto translate = [&](const IndexType j) -> unsigned int {
+        if (j < n_owned_indices)
+          return j;
+        else
+          return partitioner->global_to_local(j - n_owned_indices);
+      };
 
-          if (this->plain_dof_indices_per_cell.empty() == false)
+      dealii::parallel::apply_to_subranges(
+        0U,
+        n_cells,
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
             {
-              for (const auto &j : this->plain_dof_indices_per_cell[i])
-                if (j < (local_range.second - local_range.first))
-                  this->plain_dof_indices.push_back(j);
-                else
-                  this->plain_dof_indices.push_back(
-                    partitioner->global_to_local(
-                      j - (local_range.second - local_range.first)));
-
-              this->row_starts_plain_indices.emplace_back(
-                this->plain_dof_indices.size());
+              std::transform(this->dof_indices_per_cell[i].begin(),
+                             this->dof_indices_per_cell[i].end(),
+                             this->dof_indices.begin() +
+                               this->row_starts[i].first,
+                             translate);
+              std::copy(this->constraint_indicator_per_cell[i].begin(),
+                        this->constraint_indicator_per_cell[i].end(),
+                        this->constraint_indicator.begin() +
+                          this->row_starts[i].second);
+
+              if (has_plain_indices)
+                std::transform(this->plain_dof_indices_per_cell[i].begin(),
+                               this->plain_dof_indices_per_cell[i].end(),
+                               this->plain_dof_indices.begin() +
+                                 this->row_starts_plain_indices[i],
+                               translate);
             }
-        }
+        },
+        256);
 
       std::vector<const std::vector<double> *> constraints(
         constraint_values.constraints.size());
@@ -748,9 +761,6 @@ namespace internal
 
       AssertDimension(constraint_pool_data.size(), length);
 
-      this->dof_indices_per_cell.clear();
-      constraint_indicator_per_cell.clear();
-
       if (hanging_nodes &&
           std::all_of(hanging_node_constraint_masks.begin(),
                       hanging_node_constraint_masks.end(),
@@ -759,11 +769,34 @@ namespace internal
                       }))
         hanging_node_constraint_masks.clear();
 
+      clear_setup_data();
+
       return partitioner;
     }
 
 
 
+    template <int dim, typename Number, typename IndexType>
+    inline void
+    ConstraintInfo<dim, Number, IndexType>::clear_setup_data()
+    {
+      // swap with empty objects to actually release the memory
+      std::vector<std::vector<unsigned int>>().swap(dof_indices_per_cell);
+      std::vector<std::vector<unsigned int>>().swap(
+        plain_dof_indices_per_cell);
+      std::vector<std::vector<std::pair<unsigned short, unsigned short>>>()
+        .swap(constraint_indicator_per_cell);
+      std::vector<std::vector<unsigned int>>().swap(lexicographic_numbering);
+      std::vector<types::global_dof_index>().swap(local_dof_indices);
+      std::vector<types::global_dof_index>().swap(local_dof_indices_lex);
+      std::vector<ConstraintKinds>().swap(mask);
+
+      constraint_values.constraints.clear();
+      hanging_nodes.reset();
+    }
+
+
+
     template <int dim, typename Number, typename IndexType>
     template <typename T, typename VectorType>
     inline void
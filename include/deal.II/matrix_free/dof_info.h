@@ -541,6 +541,26 @@ namespace internal
        */
       std::vector<unsigned int> dof_indices_interleaved;
 
+      /**
+       * Compressed variant of @p dof_indices_interleaved, set up if
+       * @p compress_dof_indices is true: For each cell of a batch with
+       * `IndexStorageVariants::interleaved`, the indices are stored as the
+       * smallest index on the respective cell, kept in this array at
+       * position `cell_batch_index * vectorization_length + lane`, plus the
+       * offsets relative to that base index in the array
+       * @p dof_indices_interleaved_offsets. Batches whose indices do not fit
+       * into 16-bit offsets are marked by numbers::invalid_unsigned_int and
+       * keep using @p dof_indices_interleaved.
+       */
+      std::vector<unsigned int> dof_indices_interleaved_base;
+
+      /**
+       * The 16-bit offsets of the interleaved indices relative to
+       * @p dof_indices_interleaved_base, using the same layout as
+       * @p dof_indices_interleaved.
+       */
+      std::vector<unsigned short> dof_indices_interleaved_offsets;
+
       /**
        * Compressed index storage for faster access than through @p
        * dof_indices used according to the description in IndexStorageVariants.
@@ -703,6 +723,13 @@ namespace internal
        */
       bool store_plain_indices;
 
+      /**
+       * Informs on whether the indices of cells with interleaved storage are
+       * compressed to a base index per cell and 16-bit offsets, see
+       * @p dof_indices_interleaved_base.
+       */
+      bool compress_dof_indices;
+
       /**
        * Stores the index of the active finite element in the hp-case.
        */
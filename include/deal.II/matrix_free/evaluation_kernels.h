@@ -628,48 +628,27 @@ namespace internal
 
     const auto &shape_data = fe_eval.get_shape_info().data;
 
-    using Number2 =
-      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
-
+    // all components are processed at once, which loads the shape matrix
+    // only once per cell batch
     if (evaluation_flag & EvaluationFlags::values)
-      {
-        const auto *const shape_values = shape_data.front().shape_values.data();
-        auto             *out          = fe_eval.begin_values();
-        const auto       *in           = values_dofs_actual;
-
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            apply_matrix_vector_product<evaluate_general,
-                                        EvaluatorQuantity::value,
-                                        /* transpose_matrix */ true,
-                                        /* add */ false,
-                                        /* consider_strides */ false>(
-              shape_values, in, out, n_dofs, n_q_points, 1, 1);
-
-            out += n_q_points;
-            in += n_dofs;
-          }
-      }
+      apply_matrix_vector_product_components</* transpose_matrix */ true,
+                                             /* add */ false>(
+        shape_data.front().shape_values.data(),
+        values_dofs_actual,
+        fe_eval.begin_values(),
+        n_dofs,
+        n_q_points,
+        n_components);
 
     if (evaluation_flag & EvaluationFlags::gradients)
-      {
-        const auto *const shape_gradients =
-          shape_data.front().shape_gradients.data();
-        auto       *out = fe_eval.begin_gradients();
-        const auto *in  = values_dofs_actual;
-
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            apply_matrix_vector_product<evaluate_general,
-                                        EvaluatorQuantity::value,
-                                        /* transpose_matrix */ true,
-                                        /* add */ false,
-                                        /* consider_strides */ false>(
-              shape_gradients, in, out, n_dofs, n_q_points * dim, 1, 1);
-            out += n_q_points * dim;
-            in += n_dofs;
-          }
-      }
+      apply_matrix_vector_product_components</* transpose_matrix */ true,
+                                             /* add */ false>(
+        shape_data.front().shape_gradients.data(),
+        values_dofs_actual,
+        fe_eval.begin_gradients(),
+        n_dofs,
+        n_q_points * dim,
+        n_components);
   }
 
 
@@ -696,65 +675,51 @@ namespace internal
 
     const auto &shape_data = fe_eval.get_shape_info().data;
 
-    using Number2 =
-      typename FEEvaluationData<dim, Number, false>::shape_info_number_type;
-
+    // all components are processed at once, which loads the shape matrix
+    // only once per cell batch
     if (integration_flag & EvaluationFlags::values)
       {
-        const auto *const shape_values = shape_data.front().shape_values.data();
-        auto             *in           = fe_eval.begin_values();
-        auto             *out          = values_dofs_actual;
-
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            if (add_into_values_array == false)
-              apply_matrix_vector_product<evaluate_general,
-                                          EvaluatorQuantity::value,
-                                          /* transpose_matrix */ false,
-                                          /* add */ false,
-                                          /* consider_strides */ false>(
-                shape_values, in, out, n_dofs, n_q_points, 1, 1);
-            else
-              apply_matrix_vector_product<evaluate_general,
-                                          EvaluatorQuantity::value,
-                                          /* transpose_matrix */ false,
-                                          /* add */ true,
-                                          /* consider_strides */ false>(
-                shape_values, in, out, n_dofs, n_q_points, 1, 1);
-
-            in += n_q_points;
-            out += n_dofs;
-          }
+        if (add_into_values_array == false)
+          apply_matrix_vector_product_components</* transpose_matrix */ false,
+                                                 /* add */ false>(
+            shape_data.front().shape_values.data(),
+            fe_eval.begin_values(),
+            values_dofs_actual,
+            n_dofs,
+            n_q_points,
+            n_components);
+        else
+          apply_matrix_vector_product_components</* transpose_matrix */ false,
+                                                 /* add */ true>(
+            shape_data.front().shape_values.data(),
+            fe_eval.begin_values(),
+            values_dofs_actual,
+            n_dofs,
+            n_q_points,
+            n_components);
       }
 
     if (integration_flag & EvaluationFlags::gradients)
       {
-        const auto *const shape_gradients =
-          shape_data.front().shape_gradients.data();
-        auto *in  = fe_eval.begin_gradients();
-        auto *out = values_dofs_actual;
-
-        for (unsigned int c = 0; c < n_components; ++c)
-          {
-            if (add_into_values_array == false &&
-                !(integration_flag & EvaluationFlags::values))
-              apply_matrix_vector_product<evaluate_general,
-                                          EvaluatorQuantity::value,
-                                          /* transpose_matrix */ false,
-                                          /* add */ false,
-                                          /* consider_strides */ false>(
-                shape_gradients, in, out, n_dofs, n_q_points * dim, 1, 1);
-            else
-              apply_matrix_vector_product<evaluate_general,
-                                          EvaluatorQuantity::value,
-                                          /* transpose_matrix */ false,
-                                          /* add */ true,
-                                          /* consider_strides */ false>(
-                shape_gradients, in, out, n_dofs, n_q_points * dim, 1, 1);
-
-            in += n_q_points * dim;
-            out += n_dofs;
-          }
+        if (add_into_values_array == false &&
+            !(integration_flag & EvaluationFlags::values))
+          apply_matrix_vector_product_components</* transpose_matrix */ false,
+                                                 /* add */ false>(
+            shape_data.front().shape_gradients.data(),
+            fe_eval.begin_gradients(),
+            values_dofs_actual,
+            n_dofs,
+            n_q_points * dim,
+            n_components);
+        else
+          apply_matrix_vector_product_components</* transpose_matrix */ false,
+                                                 /* add */ true>(
+            shape_data.front().shape_gradients.data(),
+            fe_eval.begin_gradients(),
+            values_dofs_actual,
+            n_dofs,
+            n_q_points * dim,
+            n_components);
       }
   }
 
@@ -2030,10 +1995,12 @@ namespace internal
             sum_into_values_array);
         }
       // '<=' on type means tensor_symmetric or tensor_symmetric_hermite, see
-      // shape_info.h for more details
-      else if (fe_degree >= 0 &&
-               use_collocation_evaluation(fe_degree, n_q_points_1d) &&
-               element_type <= ElementType::tensor_symmetric)
+      // shape_info.h for more details; whether the transformation pays off is
+      // decided by ShapeInfo::use_collocation_transformation
+      else if (fe_degree >= 0 && n_q_points_1d > fe_degree &&
+               n_q_points_1d < 200 &&
+               element_type <= ElementType::tensor_symmetric &&
+               fe_eval.get_shape_info().use_collocation_transformation)
         {
           evaluate_or_integrate<
             FEEvaluationImplTransformToCollocation<dim,
@@ -1454,8 +1454,6 @@ namespace internal
     {
       const auto &shape_info = fe_eval.get_shape_info();
       const auto &shape_data = shape_info.data.front();
-      using Number2 =
-        typename FEEvaluationData<dim, Number, true>::shape_info_number_type;
 
       Assert((fe_eval.get_dof_access_index() ==
                 MatrixFreeFunctions::DoFInfo::dof_access_cell &&
@@ -1468,47 +1466,24 @@ namespace internal
       const std::size_t  n_q_points = shape_info.n_q_points_faces[face_no];
 
       if (evaluation_flag & EvaluationFlags::values)
-        {
-          const auto *const shape_values =
-            &shape_data.shape_values_face(face_no, face_orientation, 0);
-
-          auto *out = fe_eval.begin_values();
-          auto *in  = values_dofs;
-
-          for (unsigned int c = 0; c < n_components; ++c)
-            {
-              apply_matrix_vector_product<evaluate_general,
-                                          EvaluatorQuantity::value,
-                                          /*transpose_matrix*/ true,
-                                          /*add*/ false,
-                                          /*consider_strides*/ false>(
-                shape_values, in, out, n_dofs, n_q_points, 1, 1);
-
-              out += n_q_points;
-              in += n_dofs;
-            }
-        }
+        apply_matrix_vector_product_components</*transpose_matrix*/ true,
+                                               /*add*/ false>(
+          &shape_data.shape_values_face(face_no, face_orientation, 0),
+          values_dofs,
+          fe_eval.begin_values(),
+          n_dofs,
+          n_q_points,
+          n_components);
 
       if (evaluation_flag & EvaluationFlags::gradients)
-        {
-          auto       *out = fe_eval.begin_gradients();
-          const auto *in  = values_dofs;
-
-          const auto *const shape_gradients =
-            &shape_data.shape_gradients_face(face_no, face_orientation, 0);
-
-          for (unsigned int c = 0; c < n_components; ++c)
-            {
-              apply_matrix_vector_product<evaluate_general,
-                                          EvaluatorQuantity::value,
-                                          /*transpose_matrix*/ true,
-                                          /*add*/ false,
-                                          /*consider_strides*/ false>(
-                shape_gradients, in, out, n_dofs, n_q_points * dim, 1, 1);
-              out += n_q_points * dim;
-              in += n_dofs;
-            }
-        }
+        apply_matrix_vector_product_components</*transpose_matrix*/ true,
+                                               /*add*/ false>(
+          &shape_data.shape_gradients_face(face_no, face_orientation, 0),
+          values_dofs,
+          fe_eval.begin_gradients(),
+          n_dofs,
+          n_q_points * dim,
+          n_components);
 
       Assert(!(evaluation_flag & EvaluationFlags::hessians),
              ExcNotImplemented());
@@ -1878,61 +1853,50 @@ namespace internal
 
       if (integration_flag & EvaluationFlags::values)
         {
-          const auto *const shape_values =
+          const Number2 *shape_values =
             &shape_data.shape_values_face(face_no, face_orientation, 0);
-
-          auto *in  = fe_eval.begin_values();
-          auto *out = values_dofs;
-
-          for (unsigned int c = 0; c < n_components; ++c)
-            {
-              if (sum_into_values)
-                apply_matrix_vector_product<evaluate_general,
-                                            EvaluatorQuantity::value,
-                                            /*transpose_matrix*/ false,
-                                            /*add*/ true,
-                                            /*consider_strides*/ false>(
-                  shape_values, in, out, n_dofs, n_q_points, 1, 1);
-              else
-                apply_matrix_vector_product<evaluate_general,
-                                            EvaluatorQuantity::value,
-                                            /*transpose_matrix*/ false,
-                                            /*add*/ false,
-                                            /*consider_strides*/ false>(
-                  shape_values, in, out, n_dofs, n_q_points, 1, 1);
-              in += n_q_points;
-              out += n_dofs;
-            }
+          if (sum_into_values)
+            apply_matrix_vector_product_components</*transpose_matrix*/ false,
+                                                   /*add*/ true>(
+              shape_values,
+              fe_eval.begin_values(),
+              values_dofs,
+              n_dofs,
+              n_q_points,
+              n_components);
+          else
+            apply_matrix_vector_product_components</*transpose_matrix*/ false,
+                                                   /*add*/ false>(
+              shape_values,
+              fe_eval.begin_values(),
+              values_dofs,
+              n_dofs,
+              n_q_points,
+              n_components);
         }
 
       if (integration_flag & EvaluationFlags::gradients)
         {
-          auto *in  = fe_eval.begin_gradients();
-          auto *out = values_dofs;
-
-          const auto *const shape_gradients =
+          const Number2 *shape_gradients =
             &shape_data.shape_gradients_face(face_no, face_orientation, 0);
-
-          for (unsigned int c = 0; c < n_components; ++c)
-            {
-              if (!sum_into_values &&
-                  !(integration_flag & EvaluationFlags::values))
-                apply_matrix_vector_product<evaluate_general,
-                                            EvaluatorQuantity::value,
-                                            /*transpose_matrix*/ false,
-                                            /*add*/ false,
-                                            /*consider_strides*/ false>(
-                  shape_gradients, in, out, n_dofs, n_q_points * dim, 1, 1);
-              else
-                apply_matrix_vector_product<evaluate_general,
-                                            EvaluatorQuantity::value,
-                                            /*transpose_matrix*/ false,
-                                            /*add*/ true,
-                                            /*consider_strides*/ false>(
-                  shape_gradients, in, out, n_dofs, n_q_points * dim, 1, 1);
-              in += n_q_points * dim;
-              out += n_dofs;
-            }
+          if (!sum_into_values && !(integration_flag & EvaluationFlags::values))
+            apply_matrix_vector_product_components</*transpose_matrix*/ false,
+                                                   /*add*/ false>(
+              shape_gradients,
+              fe_eval.begin_gradients(),
+              values_dofs,
+              n_dofs,
+              n_q_points * dim,
+              n_components);
+          else
+            apply_matrix_vector_product_components</*transpose_matrix*/ false,
+                                                   /*add*/ true>(
+              shape_gradients,
+              fe_eval.begin_gradients(),
+              values_dofs,
+              n_dofs,
+              n_q_points * dim,
+              n_components);
         }
 
       Assert(!(integration_flag & EvaluationFlags::hessians),
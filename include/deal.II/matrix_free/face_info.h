@@ -127,6 +127,45 @@ namespace internal
 
 
 
+    /**
+     * The cell on the other side of a face of a cell, as seen from that cell,
+     * together with the face number within the neighbor and the orientation
+     * of the face relative to the cell. This information can be derived from
+     * FaceToCellTopology, but is precomputed for element-centric loops where
+     * it is needed once for every face of every cell.
+     */
+    struct FaceNeighborInfo
+    {
+      /**
+       * Index of the neighboring cell in the non-vectorized cell storage, or
+       * numbers::invalid_unsigned_int at the boundary.
+       */
+      unsigned int cell = numbers::invalid_unsigned_int;
+
+      /**
+       * Number of the face within the neighboring cell.
+       */
+      std::uint8_t face_no = static_cast<std::uint8_t>(-1);
+
+      /**
+       * Orientation of the face as seen from the current cell, in the
+       * format of FaceToCellTopology::face_orientation without the flag for
+       * the interior side.
+       */
+      std::uint8_t face_orientation = static_cast<std::uint8_t>(-1);
+
+      /**
+       * Return the memory consumption of the present data structure.
+       */
+      std::size_t
+      memory_consumption() const
+      {
+        return sizeof(*this);
+      }
+    };
+
+
+
     /**
      * A data structure that holds the connectivity between the faces and the
      * cells.
@@ -144,6 +183,7 @@ namespace internal
         faces.clear();
         cell_and_face_to_plain_faces.reinit(TableIndices<3>(0, 0, 0));
         cell_and_face_boundary_id.reinit(TableIndices<3>(0, 0, 0));
+        cell_and_face_to_neighbor.reinit(TableIndices<3>(0, 0, 0));
       }
 
       /**
@@ -154,7 +194,8 @@ namespace internal
       {
         return sizeof(faces) +
                cell_and_face_to_plain_faces.memory_consumption() +
-               cell_and_face_boundary_id.memory_consumption();
+               cell_and_face_boundary_id.memory_consumption() +
+               cell_and_face_to_neighbor.memory_consumption();
       }
 
       /**
@@ -176,6 +217,15 @@ namespace internal
        * same indexing as the cell_and_face_to_plain_faces data structure
        */
       ::dealii::Table<3, types::boundary_id> cell_and_face_boundary_id;
+
+      /**
+       * Stores the neighbor of each face of each cell using the same
+       * indexing as the cell_and_face_to_plain_faces data structure. Only
+       * filled if faces are evaluated by cells, i.e., if
+       * MatrixFree::AdditionalData::mapping_update_flags_faces_by_cells is
+       * set.
+       */
+      ::dealii::Table<3, FaceNeighborInfo> cell_and_face_to_neighbor;
     };
   } // end of namespace MatrixFreeFunctions
 } // end of namespace internal
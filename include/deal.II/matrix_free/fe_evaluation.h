@@ -1146,9 +1146,9 @@ using FEEvaluationAccess DEAL_II_DEPRECATED =
  * instantiating the classes FEEvaluationFactory and FEFaceEvaluationFactory
  * (the latter for FEFaceEvaluation) creates paths to templated functions for
  * a possibly larger set of degrees. This can both be set when configuring
- * deal.II by passing the flag `-D FE_EVAL_FACTORY_DEGREE_MAX=8` (in case you
- * want to compile all degrees up to eight; recommended setting) or by
- * compiling `evaluation_template_factory.templates.h` and
+ * deal.II by passing the flag `-D DEAL_II_FE_EVAL_FACTORY_DEGREE_MAX=8` to
+ * CMake (in case you want to compile all degrees up to eight; recommended
+ * setting) or by compiling `evaluation_template_factory.templates.h` and
  * `evaluation_template_face_factory.templates.h` with the
  * `FE_EVAL_FACTORY_DEGREE_MAX` overridden to the desired value. In the second
  * option, symbols will be available twice, and it depends on your linker and
@@ -1158,6 +1158,29 @@ using FEEvaluationAccess DEAL_II_DEPRECATED =
  * calling FEEvaluation::fast_evaluation_supported() or
  * FEFaceEvaluation::fast_evaluation_supported().
  *
+ * <h4>Templated code in the hp-adaptive case</h4>
+ *
+ * In the hp-adaptive case, MatrixFree groups the cells by their active FE
+ * index, and each cell range passed to the function of MatrixFree::cell_loop()
+ * contains cells with a single element only. The degree of these cells can be
+ * queried via MatrixFree::get_cell_active_fe_index(), and the run-time degree
+ * can be translated into a compile-time constant by
+ * MatrixFreeTools::call_with_degree(). This way, not only the evaluation
+ * kernels but the complete local operation including the work at quadrature
+ * points runs with the degree as a template parameter:
+ * @code
+ * const unsigned int degree =
+ *   matrix_free.get_dof_handler()
+ *     .get_fe(matrix_free.get_cell_active_fe_index(cell_range))
+ *     .degree;
+ * MatrixFreeTools::call_with_degree<1, 6>(degree, [&](const auto d) {
+ *   constexpr int fe_degree = decltype(d)::value;
+ *   FEEvaluation<dim, fe_degree, fe_degree + 1> fe_eval(matrix_free,
+ *                                                       cell_range);
+ *   ...
+ * });
+ * @endcode
+ *
  * <h3>Handling multi-component systems</h3>
  *
  * FEEvaluation also allows for treating vector-valued problems through a
@@ -2499,6 +2522,12 @@ inline FEEvaluationBase<dim,
       this->quadrature_points =
         this->mapped_geometry->get_data_storage().quadrature_points.begin();
     }
+  else
+    {
+      // geometry data computed on the fly is filled by reinit(), so do not
+      // share the storage with the other object
+      this->mapped_geometry.reset();
+    }
 
   this->set_data_pointers(scratch_data_array, n_components_);
 }
@@ -2569,6 +2598,7 @@ operator=(const FEEvaluationBase<dim,
   else
     {
       scratch_data_array = matrix_free->acquire_scratch_data();
+      this->mapped_geometry.reset();
     }
 
   this->set_data_pointers(scratch_data_array, n_components_);
@@ -2909,8 +2939,7 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
                             IndexStorageVariants::interleaved &&
       use_vectorized_path)
     {
-      const unsigned int *dof_indices =
-        dof_info.dof_indices_interleaved.data() +
+      const unsigned int start_index =
         dof_info.row_starts[this->cell * this->n_fe_components * n_lanes]
           .first +
         this->dof_info
@@ -2927,6 +2956,52 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
         src_ptrs[0] =
           const_cast<typename VectorType::value_type *>(src[0]->begin());
 
+      // compressed storage: reconstruct the indices from the base index of
+      // each cell and the 16-bit offsets
+      if (!dof_info.dof_indices_interleaved_base.empty() &&
+          dof_info.dof_indices_interleaved_base[this->cell * n_lanes] !=
+            numbers::invalid_unsigned_int)
+        {
+          const unsigned int *base_indices =
+            dof_info.dof_indices_interleaved_base.data() + this->cell * n_lanes;
+          const unsigned short *offsets =
+            dof_info.dof_indices_interleaved_offsets.data() + start_index;
+          std::array<unsigned int, n_lanes> dof_indices;
+
+          if (n_components == 1 || this->n_fe_components == 1)
+            for (unsigned int i = 0; i < dofs_per_component;
+                 ++i, offsets += n_lanes)
+              {
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  dof_indices[v] = base_indices[v] + offsets[v];
+                for (unsigned int comp = 0; comp < n_components; ++comp)
+                  operation.process_dof_gather(dof_indices.data(),
+                                               *src[comp],
+                                               0,
+                                               src_ptrs[comp],
+                                               values_dofs[comp][i],
+                                               vector_selector);
+              }
+          else
+            for (unsigned int comp = 0; comp < n_components; ++comp)
+              for (unsigned int i = 0; i < dofs_per_component;
+                   ++i, offsets += n_lanes)
+                {
+                  for (unsigned int v = 0; v < n_lanes; ++v)
+                    dof_indices[v] = base_indices[v] + offsets[v];
+                  operation.process_dof_gather(dof_indices.data(),
+                                               *src[0],
+                                               0,
+                                               src_ptrs[0],
+                                               values_dofs[comp][i],
+                                               vector_selector);
+                }
+          return;
+        }
+
+      const unsigned int *dof_indices =
+        dof_info.dof_indices_interleaved.data() + start_index;
+
       if (n_components == 1 || this->n_fe_components == 1)
         for (unsigned int i = 0; i < dofs_per_component;
              ++i, dof_indices += n_lanes)
@@ -4096,21 +4171,23 @@ inline DEAL_II_ALWAYS_INLINE
           else
             {
               // Affine or general cell
+              const bool general_cell =
+                this->cell_type > internal::MatrixFreeFunctions::affine;
               const Tensor<2, dim, VectorizedArrayType> inv_t_jac =
-                (this->cell_type > internal::MatrixFreeFunctions::affine) ?
-                  this->jacobian[q_point] :
-                  this->jacobian[0];
+                general_cell ? this->jacobian[q_point] : this->jacobian[0];
+
+              // On general cells, J * det(J^-1) is the cofactor matrix of
+              // J^{-T}, which avoids inverting J^{-T} at each point
               const Tensor<2, dim, VectorizedArrayType> jac =
-                (this->cell_type > internal::MatrixFreeFunctions::affine) ?
-                  transpose(invert(inv_t_jac)) :
-                  this->jacobian[1];
+                general_cell ? cofactor(inv_t_jac) : this->jacobian[1];
 
               // Derivatives are reordered for faces. Need to take this into
               // account
+              const Number sign =
+                (is_face && dim == 2 && this->get_face_no() < 2) ? -1 : 1;
               const VectorizedArrayType inv_det =
-                (is_face && dim == 2 && this->get_face_no() < 2) ?
-                  -determinant(inv_t_jac) :
-                  determinant(inv_t_jac);
+                general_cell ? VectorizedArrayType(sign) :
+                               sign * determinant(inv_t_jac);
               // J * u * det(J^-1)
               for (unsigned int comp = 0; comp < n_components; ++comp)
                 {
@@ -4858,26 +4935,29 @@ FEEvaluationBase<dim, n_components_, Number, is_face, VectorizedArrayType>::
           else
             {
               // Affine or general cell
+              const bool general_cell =
+                this->cell_type > internal::MatrixFreeFunctions::affine;
               const Tensor<2, dim, VectorizedArrayType> inv_t_jac =
-                (this->cell_type > internal::MatrixFreeFunctions::affine) ?
-                  this->jacobian[q_point] :
-                  this->jacobian[0];
+                general_cell ? this->jacobian[q_point] : this->jacobian[0];
 
+              // On general cells, use the cofactor matrix of J^{-T}, i.e.,
+              // J * det(J^{-1}), instead of inverting J^{-T} at each point,
+              // and compensate the determinant in the factor.
               // Derivatives are reordered for faces. Need to take this into
               // account and 1/inv_det != J_value for faces
+              const Number sign =
+                (is_face && dim == 2 && this->get_face_no() < 2) ? -1 : 1;
               const VectorizedArrayType fac =
                 (!is_face) ?
-                  this->quadrature_weights[q_point] :
-                  (((this->cell_type > internal::MatrixFreeFunctions::affine) ?
-                      this->J_value[q_point] :
-                      this->J_value[0] * this->quadrature_weights[q_point]) *
-                   ((dim == 2 && this->get_face_no() < 2) ?
-                      -determinant(inv_t_jac) :
-                      determinant(inv_t_jac)));
+                  (general_cell ? this->quadrature_weights[q_point] /
+                                    determinant(inv_t_jac) :
+                                  this->quadrature_weights[q_point]) :
+                  (general_cell ? sign * this->J_value[q_point] :
+                                  sign * this->J_value[0] *
+                                    this->quadrature_weights[q_point] *
+                                    determinant(inv_t_jac));
               const Tensor<2, dim, VectorizedArrayType> jac =
-                (this->cell_type > internal::MatrixFreeFunctions::affine) ?
-                  transpose(invert(inv_t_jac)) :
-                  this->jacobian[1];
+                general_cell ? cofactor(inv_t_jac) : this->jacobian[1];
 
               // J^T * u * factor
               for (unsigned int comp = 0; comp < n_components; ++comp)
@@ -6258,19 +6338,72 @@ FEEvaluation<dim,
   Assert(this->dof_info != nullptr, ExcNotInitialized());
   Assert(this->mapping_data != nullptr, ExcNotInitialized());
   this->cell = cell_index;
-  this->cell_type =
-    this->matrix_free->get_mapping_info().get_cell_type(cell_index);
+  const auto &mapping_info = this->matrix_free->get_mapping_info();
+  this->cell_type          = mapping_info.get_cell_type(cell_index);
 
-  const unsigned int offsets =
-    this->mapping_data->data_index_offsets[cell_index];
-  this->jacobian = &this->mapping_data->jacobians[0][offsets];
-  this->J_value  = &this->mapping_data->JxW_values[offsets];
-  if (!this->mapping_data->jacobian_gradients[0].empty())
+  const bool geometry_on_the_fly =
+    mapping_info.cell_geometry_on_the_fly &&
+    this->cell_type > internal::MatrixFreeFunctions::GeometryType::affine;
+  if (geometry_on_the_fly)
     {
-      this->jacobian_gradients =
-        this->mapping_data->jacobian_gradients[0].data() + offsets;
-      this->jacobian_gradients_non_inverse =
-        this->mapping_data->jacobian_gradients_non_inverse[0].data() + offsets;
+      if (this->mapped_geometry == nullptr)
+        this->mapped_geometry =
+          std::make_shared<internal::MatrixFreeFunctions::
+                             MappingDataOnTheFly<dim, VectorizedArrayType>>();
+
+      auto &mapping_storage = this->mapped_geometry->get_data_storage();
+      AlignedVector<VectorizedArrayType> *scratch =
+        this->matrix_free->acquire_scratch_data();
+      mapping_info.compute_cell_data_on_the_fly(cell_index,
+                                                this->quad_no,
+                                                mapping_storage,
+                                                *scratch);
+      this->matrix_free->release_scratch_data(scratch);
+
+      this->jacobian = mapping_storage.jacobians[0].data();
+      this->J_value  = mapping_storage.JxW_values.data();
+      if (mapping_storage.quadrature_points.empty() == false)
+        this->quadrature_points = mapping_storage.quadrature_points.data();
+    }
+  else if (mapping_info.cell_geometry_single_precision &&
+           this->cell_type >
+             internal::MatrixFreeFunctions::GeometryType::affine)
+    {
+      if (this->mapped_geometry == nullptr)
+        this->mapped_geometry =
+          std::make_shared<internal::MatrixFreeFunctions::
+                             MappingDataOnTheFly<dim, VectorizedArrayType>>();
+
+      auto &mapping_storage = this->mapped_geometry->get_data_storage();
+      mapping_info.copy_cell_data_from_single_precision(cell_index,
+                                                        this->quad_no,
+                                                        mapping_storage);
+
+      this->jacobian = mapping_storage.jacobians[0].data();
+      this->J_value  = mapping_storage.JxW_values.data();
+      if (this->mapping_data->quadrature_points.empty() == false)
+        this->quadrature_points =
+          &this->mapping_data->quadrature_points
+             [this->mapping_data->quadrature_point_offsets[this->cell]];
+    }
+  else
+    {
+      const unsigned int offsets =
+        this->mapping_data->data_index_offsets[cell_index];
+      this->jacobian = &this->mapping_data->jacobians[0][offsets];
+      this->J_value  = &this->mapping_data->JxW_values[offsets];
+      if (!this->mapping_data->jacobian_gradients[0].empty())
+        {
+          this->jacobian_gradients =
+            this->mapping_data->jacobian_gradients[0].data() + offsets;
+          this->jacobian_gradients_non_inverse =
+            this->mapping_data->jacobian_gradients_non_inverse[0].data() +
+            offsets;
+        }
+      if (this->mapping_data->quadrature_points.empty() == false)
+        this->quadrature_points =
+          &this->mapping_data->quadrature_points
+             [this->mapping_data->quadrature_point_offsets[this->cell]];
     }
 
   if (this->matrix_free->n_active_entries_per_cell_batch(this->cell) == n_lanes)
@@ -6289,11 +6422,6 @@ FEEvaluation<dim,
         this->cell_ids[i] = numbers::invalid_unsigned_int;
     }
 
-  if (this->mapping_data->quadrature_points.empty() == false)
-    this->quadrature_points =
-      &this->mapping_data->quadrature_points
-         [this->mapping_data->quadrature_point_offsets[this->cell]];
-
 #  ifdef DEBUG
   this->is_reinitialized           = true;
   this->dof_values_initialized     = false;
@@ -6342,6 +6470,16 @@ FEEvaluation<dim,
                    cell_index / n_lanes));
     }
 
+  Assert((this->matrix_free->get_mapping_info().cell_geometry_on_the_fly ==
+              false &&
+            this->matrix_free->get_mapping_info()
+                .cell_geometry_single_precision == false) ||
+           this->cell_type <=
+             internal::MatrixFreeFunctions::GeometryType::affine,
+         ExcMessage("Reinitialization with individual cell indices is not "
+                    "supported for cells whose geometry is computed on the "
+                    "fly or stored in single precision."));
+
   // allocate memory for internal data storage
   if (this->mapped_geometry == nullptr)
     this->mapped_geometry =
@@ -7195,61 +7333,25 @@ FEFaceEvaluation<dim,
 
   if (this->is_interior_face() == false)
     {
-      // for this case, we need to look into the FaceInfo field that collects
-      // information from both sides of a face once for the global mesh, and
-      // pick the face id that is not the local one (cell_this).
+      // for this case, we look up the neighbor across the face, its face
+      // number and the orientation relative to the local cell, which have
+      // been precomputed from the FaceInfo field that collects information
+      // from both sides of a face once for the global mesh
+      const auto &neighbors =
+        this->matrix_free->get_cell_and_face_to_neighbor();
+      Assert(neighbors.size(0) > cell_index, ExcInternalError());
       for (unsigned int i = 0; i < n_lanes; ++i)
         {
-          // compute actual (non vectorized) cell ID
-          const unsigned int cell_this = cell_index * n_lanes + i;
-          // compute face ID
-          unsigned int face_index =
+          this->face_ids[i] =
             this->matrix_free->get_cell_and_face_to_plain_faces()(cell_index,
                                                                   face_number,
                                                                   i);
 
-          this->face_ids[i] = face_index;
-
-          if (face_index == numbers::invalid_unsigned_int)
-            {
-              this->cell_ids[i]          = numbers::invalid_unsigned_int;
-              this->face_numbers[i]      = static_cast<std::uint8_t>(-1);
-              this->face_orientations[i] = static_cast<std::uint8_t>(-1);
-              continue; // invalid face ID: no neighbor on boundary
-            }
-
-          const auto &faces =
-            this->matrix_free->get_face_info(face_index / n_lanes);
-          // get cell ID on both sides of face
-          auto cell_m = faces.cells_interior[face_index % n_lanes];
-          auto cell_p = faces.cells_exterior[face_index % n_lanes];
-
-          const bool face_identifies_as_interior = cell_m != cell_this;
-
-          Assert(cell_m == cell_this || cell_p == cell_this,
-                 ExcInternalError());
-
-          // compare the IDs with the given cell ID
-          if (face_identifies_as_interior)
-            {
-              this->cell_ids[i]     = cell_m; // neighbor has the other ID
-              this->face_numbers[i] = faces.interior_face_no;
-            }
-          else
-            {
-              this->cell_ids[i]     = cell_p;
-              this->face_numbers[i] = faces.exterior_face_no;
-            }
-
-          const bool   orientation_interior_face = faces.face_orientation >= 8;
-          unsigned int face_orientation          = faces.face_orientation % 8;
-          if (face_identifies_as_interior != orientation_interior_face)
-            {
-              constexpr std::array<std::uint8_t, 8> table{
-                {0, 1, 2, 3, 6, 5, 4, 7}};
-              face_orientation = table[face_orientation];
-            }
-          this->face_orientations[i] = face_orientation;
+          const internal::MatrixFreeFunctions::FaceNeighborInfo &neighbor =
+            neighbors(cell_index, face_number, i);
+          this->cell_ids[i]          = neighbor.cell;
+          this->face_numbers[i]      = neighbor.face_no;
+          this->face_orientations[i] = neighbor.face_orientation;
         }
     }
   else
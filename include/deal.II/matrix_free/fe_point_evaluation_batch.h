@@ -0,0 +1,411 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_fe_point_evaluation_batch_h
+#define dealii_matrix_free_fe_point_evaluation_batch_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+
+#include <deal.II/fe/fe.h>
+
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_point_kernels.h>
+
+#include <type_traits>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * Evaluate a finite element solution at arbitrary points spread over many
+ * cells, vectorizing over the points of consecutive cells.
+ *
+ * FEPointEvaluation works on one cell at a time and vectorizes over the
+ * points of that cell. If there are only few points per cell, as for
+ * particle-in-cell methods with a handful of particles per cell, most lanes
+ * of the SIMD registers remain unused. This class instead collects the
+ * solution coefficients and the reference coordinates of the points of many
+ * cells through add_cell(), and then evaluate() fills the lanes of a
+ * VectorizedArray with points of possibly different cells, each lane using
+ * the coefficients of its own cell, in the tensor product kernels of
+ * tensor_product_point_kernels.h.
+ *
+ * A typical use together with Particles::ParticleHandler looks as follows:
+ * @code
+ * FEPointEvaluationBatch<dim, dim> evaluator(dof_handler.get_fe());
+ * std::vector<double>     local_values(dof_handler.get_fe().n_dofs_per_cell());
+ * std::vector<Point<dim>> unit_points;
+ *
+ * for (const auto &cell : dof_handler.active_cell_iterators())
+ *   if (cell->is_locally_owned() &&
+ *       particle_handler.n_particles_in_cell(cell) > 0)
+ *     {
+ *       cell->get_dof_values(solution, local_values.begin(),
+ *                            local_values.end());
+ *       unit_points.clear();
+ *       for (const auto &particle : particle_handler.particles_in_cell(cell))
+ *         unit_points.push_back(particle.get_reference_location());
+ *       evaluator.add_cell(make_array_view(local_values),
+ *                          make_array_view(unit_points));
+ *     }
+ * evaluator.evaluate();
+ * @endcode
+ * The values are then available through get_value(), numbered in the order
+ * in which the points have been added, i.e., in the order of the particles
+ * of the loop above.
+ *
+ * Only the values of the solution are computed. The class supports the
+ * elements for which FEPointEvaluation uses its fast path, i.e., elements
+ * with tensor product shape functions such as FE_Q and FE_DGQ, and systems
+ * of them, as long as the selected components belong to the same base
+ * element.
+ *
+ * @tparam n_components Number of vector components of the evaluated field.
+ * @tparam dim Dimension of the cells.
+ * @tparam spacedim Dimension of the space the cells live in.
+ * @tparam Number Scalar type of the solution.
+ */
+template <int n_components,
+          int dim,
+          int spacedim    = dim,
+          typename Number = double>
+class FEPointEvaluationBatch
+{
+public:
+  /**
+   * The vectorized array type the points are processed with.
+   */
+  using VectorizedArrayType = VectorizedArray<Number>;
+
+  /**
+   * The type of the value of the field at a point.
+   */
+  using value_type = std::conditional_t<n_components == 1,
+                                        Number,
+                                        Tensor<1, n_components, Number>>;
+
+  /**
+   * Constructor.
+   *
+   * @param fe The finite element.
+   * @param first_selected_component The first component of @p fe that is
+   *   evaluated.
+   */
+  FEPointEvaluationBatch(const FiniteElement<dim, spacedim> &fe,
+                         const unsigned int first_selected_component = 0);
+
+  /**
+   * Remove all cells and points added so far.
+   */
+  void
+  clear();
+
+  /**
+   * Add the points of a cell, given by their coordinates
+   * @p unit_points on the reference cell, together with the coefficients
+   * @p solution_values of the solution on the cell, in the numbering of the
+   * degrees of freedom of the finite element.
+   */
+  void
+  add_cell(const ArrayView<const Number>     &solution_values,
+           const ArrayView<const Point<dim>> &unit_points);
+
+  /**
+   * Return the number of points added so far.
+   */
+  unsigned int
+  n_points() const;
+
+  /**
+   * Evaluate the solution at all points added so far.
+   */
+  void
+  evaluate();
+
+  /**
+   * Return the value at the point with the given index, counting the
+   * points over all calls to add_cell(). Requires a previous call to
+   * evaluate().
+   */
+  const value_type &
+  get_value(const unsigned int point_index) const;
+
+private:
+  /**
+   * The polynomials of the tensor product shape functions.
+   */
+  std::vector<Polynomials::Polynomial<double>> poly;
+
+  /**
+   * Whether the element is linear with Lagrangian polynomials, in which
+   * case a simplified kernel is used.
+   */
+  bool use_linear_path;
+
+  /**
+   * Renumbering from the numbering of the finite element to the
+   * lexicographic numbering of the tensor product, empty if the two
+   * coincide.
+   */
+  std::vector<unsigned int> renumber;
+
+  /**
+   * The number of degrees of freedom of each component.
+   */
+  unsigned int dofs_per_component;
+
+  /**
+   * The component within the base element of the first selected
+   * component.
+   */
+  unsigned int component_in_base_element;
+
+  /**
+   * The coefficients of all cells added, in lexicographic order, stored
+   * one component after the other and one cell after the other.
+   */
+  std::vector<Number> cell_coefficients;
+
+  /**
+   * The index of the cell of each point.
+   */
+  std::vector<unsigned int> point_cells;
+
+  /**
+   * The reference coordinates of each point.
+   */
+  std::vector<Point<dim>> unit_points;
+
+  /**
+   * The values computed by evaluate().
+   */
+  std::vector<value_type> values;
+
+  /**
+   * Scratch array for the coefficients of the cells of the lanes.
+   */
+  AlignedVector<VectorizedArrayType> lane_coefficients;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <int n_components, int dim, int spacedim, typename Number>
+FEPointEvaluationBatch<n_components, dim, spacedim, Number>::
+  FEPointEvaluationBatch(const FiniteElement<dim, spacedim> &fe,
+                         const unsigned int first_selected_component)
+{
+  AssertIndexRange(first_selected_component + n_components,
+                   fe.n_components() + 1);
+
+  bool         same_base_element   = true;
+  unsigned int base_element_number = 0;
+  component_in_base_element        = 0;
+  unsigned int component           = 0;
+  for (; base_element_number < fe.n_base_elements(); ++base_element_number)
+    if (component + fe.element_multiplicity(base_element_number) >
+        first_selected_component)
+      {
+        if (first_selected_component + n_components >
+            component + fe.element_multiplicity(base_element_number))
+          same_base_element = false;
+        component_in_base_element = first_selected_component - component;
+        break;
+      }
+    else
+      component += fe.element_multiplicity(base_element_number);
+
+  AssertThrow(same_base_element &&
+                internal::FEPointEvaluation::is_fast_path_supported(
+                  fe, base_element_number),
+              ExcMessage("FEPointEvaluationBatch only supports elements with "
+                         "tensor product shape functions, with all selected "
+                         "components in the same base element."));
+
+  internal::MatrixFreeFunctions::ShapeInfo<Number> shape_info;
+  shape_info.reinit(QMidpoint<1>(), fe, base_element_number);
+  renumber           = shape_info.lexicographic_numbering;
+  dofs_per_component = shape_info.dofs_per_component_on_cell;
+  poly               = internal::FEPointEvaluation::get_polynomial_space(
+    fe.base_element(base_element_number));
+
+  bool is_lexicographic = true;
+  for (unsigned int i = 0; i < renumber.size(); ++i)
+    if (i != renumber[i])
+      is_lexicographic = false;
+  if (is_lexicographic)
+    renumber.clear();
+
+  use_linear_path = (poly.size() == 2 && poly[0].value(0.) == 1. &&
+                     poly[0].value(1.) == 0. && poly[1].value(0.) == 0. &&
+                     poly[1].value(1.) == 1.);
+
+  lane_coefficients.resize(dofs_per_component);
+}
+
+
+
+template <int n_components, int dim, int spacedim, typename Number>
+inline void
+FEPointEvaluationBatch<n_components, dim, spacedim, Number>::clear()
+{
+  cell_coefficients.clear();
+  point_cells.clear();
+  unit_points.clear();
+  values.clear();
+}
+
+
+
+template <int n_components, int dim, int spacedim, typename Number>
+void
+FEPointEvaluationBatch<n_components, dim, spacedim, Number>::add_cell(
+  const ArrayView<const Number>     &solution_values,
+  const ArrayView<const Point<dim>> &cell_unit_points)
+{
+  if (cell_unit_points.empty())
+    return;
+
+  const unsigned int cell_index =
+    cell_coefficients.size() / (n_components * dofs_per_component);
+
+  // store the coefficients in lexicographic order, in the same way as
+  // FEPointEvaluation does for a single cell
+  for (unsigned int comp = 0; comp < n_components; ++comp)
+    {
+      const std::size_t offset =
+        (component_in_base_element + comp) * dofs_per_component;
+      AssertIndexRange(offset + dofs_per_component - 1, solution_values.size());
+      for (unsigned int i = 0; i < dofs_per_component; ++i)
+        cell_coefficients.push_back(
+          solution_values[renumber.empty() ? offset + i :
+                                             renumber[offset + i]]);
+    }
+
+  for (const Point<dim> &p : cell_unit_points)
+    {
+      point_cells.push_back(cell_index);
+      unit_points.emplace_back(p);
+    }
+}
+
+
+
+template <int n_components, int dim, int spacedim, typename Number>
+inline unsigned int
+FEPointEvaluationBatch<n_components, dim, spacedim, Number>::n_points() const
+{
+  return unit_points.size();
+}
+
+
+
+template <int n_components, int dim, int spacedim, typename Number>
+void
+FEPointEvaluationBatch<n_components, dim, spacedim, Number>::evaluate()
+{
+  constexpr unsigned int n_lanes     = VectorizedArrayType::size();
+  const unsigned int     n_points    = unit_points.size();
+  const unsigned int     n_dofs_cell = n_components * dofs_per_component;
+
+  values.resize(n_points);
+
+  for (unsigned int p0 = 0; p0 < n_points; p0 += n_lanes)
+    {
+      const unsigned int n_filled = std::min(n_lanes, n_points - p0);
+
+      // fill the lanes with the points, duplicating the last point into
+      // unused lanes so that all lanes contain valid numbers
+      Point<dim, VectorizedArrayType> point;
+      bool                            same_cell = true;
+      for (unsigned int v = 0; v < n_lanes; ++v)
+        {
+          const unsigned int q = p0 + std::min(v, n_filled - 1);
+          for (unsigned int d = 0; d < dim; ++d)
+            point[d][v] = unit_points[q][d];
+          if (point_cells[q] != point_cells[p0])
+            same_cell = false;
+        }
+
+      for (unsigned int comp = 0; comp < n_components; ++comp)
+        {
+          // gather the coefficients of the cell of each lane, or broadcast
+          // them if all points of this batch are in the same cell
+          if (same_cell)
+            {
+              const Number *coefficients = cell_coefficients.data() +
+                                           point_cells[p0] * n_dofs_cell +
+                                           comp * dofs_per_component;
+              for (unsigned int i = 0; i < dofs_per_component; ++i)
+                lane_coefficients[i] = coefficients[i];
+            }
+          else
+            for (unsigned int v = 0; v < n_lanes; ++v)
+              {
+                const unsigned int q = p0 + std::min(v, n_filled - 1);
+                const Number *coefficients = cell_coefficients.data() +
+                                             point_cells[q] * n_dofs_cell +
+                                             comp * dofs_per_component;
+                for (unsigned int i = 0; i < dofs_per_component; ++i)
+                  lane_coefficients[i][v] = coefficients[i];
+              }
+
+          const VectorizedArrayType value =
+            internal::evaluate_tensor_product_value(
+              poly,
+              ArrayView<const VectorizedArrayType>(lane_coefficients.data(),
+                                                   dofs_per_component),
+              point,
+              use_linear_path);
+
+          for (unsigned int v = 0; v < n_filled; ++v)
+            if constexpr (n_components == 1)
+              values[p0 + v] = value[v];
+            else
+              values[p0 + v][comp] = value[v];
+        }
+    }
+}
+
+
+
+template <int n_components, int dim, int spacedim, typename Number>
+inline const typename FEPointEvaluationBatch<n_components,
+                                             dim,
+                                             spacedim,
+                                             Number>::value_type &
+FEPointEvaluationBatch<n_components, dim, spacedim, Number>::get_value(
+  const unsigned int point_index) const
+{
+  AssertIndexRange(point_index, values.size());
+  return values[point_index];
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -0,0 +1,576 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+
+#ifndef dealii_matrix_free_fe_system_evaluation_h
+#define dealii_matrix_free_fe_system_evaluation_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/matrix_free/evaluation_flags.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include <array>
+#include <tuple>
+#include <utility>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace internal
+{
+  /**
+   * Compute the offset of the first component of each evaluator within a
+   * FESystemEvaluation, relative to the first selected component.
+   */
+  template <typename... FEEvaluationTypes>
+  constexpr std::array<unsigned int, sizeof...(FEEvaluationTypes)>
+  compute_fe_system_component_offsets()
+  {
+    std::array<unsigned int, sizeof...(FEEvaluationTypes)> offsets{};
+    unsigned int                                            offset = 0;
+    unsigned int                                            index  = 0;
+    ((offsets[index++] = offset, offset += FEEvaluationTypes::n_components),
+     ...);
+    return offsets;
+  }
+} // namespace internal
+
+
+
+/**
+ * A class that combines several FEEvaluation objects for the base elements
+ * of an FESystem, such as the velocity and pressure parts of a Taylor--Hood
+ * element FESystem(FE_Q(k+1)^dim, FE_Q(k)), into one evaluator.
+ *
+ * A single FEEvaluation object can only work on components that share the
+ * same base element. For a system of different elements, one FEEvaluation
+ * object is needed per base element, with the first selected component of
+ * each object shifted by the number of components of the previous ones.
+ * This class sets up these objects from the list of FEEvaluation types
+ * given as template arguments, in the order the base elements appear in the
+ * FESystem, and forwards reinit(), the access to vectors, and the
+ * evaluate/integrate calls to all of them. All evaluators use the same
+ * quadrature formula, so they point to the same geometry data within the
+ * MatrixFree object, and the quadrature point loop of the user code can run
+ * over the contributions of all base elements at once:
+ * @code
+ * FESystemEvaluation<FEEvaluation<dim, degree + 1, degree + 2, dim, Number>,
+ *                    FEEvaluation<dim, degree, degree + 2, 1, Number>>
+ *   phi(matrix_free);
+ *
+ * for (unsigned int cell = range.first; cell < range.second; ++cell)
+ *   {
+ *     phi.reinit(cell);
+ *     phi.gather_evaluate(src,
+ *                         {{EvaluationFlags::gradients,
+ *                           EvaluationFlags::values}});
+ *
+ *     auto &velocity = phi.template get<0>();
+ *     auto &pressure = phi.template get<1>();
+ *     for (const unsigned int q : phi.quadrature_point_indices())
+ *       {
+ *         const auto grad_u = velocity.get_symmetric_gradient(q);
+ *         const auto p      = pressure.get_value(q);
+ *         const auto div_u  = velocity.get_divergence(q);
+ *
+ *         auto flux = grad_u;
+ *         for (unsigned int d = 0; d < dim; ++d)
+ *           flux[d][d] -= p;
+ *         velocity.submit_symmetric_gradient(flux, q);
+ *         pressure.submit_value(-div_u, q);
+ *       }
+ *
+ *     phi.integrate_scatter({{EvaluationFlags::gradients,
+ *                             EvaluationFlags::values}},
+ *                           dst);
+ *   }
+ * @endcode
+ *
+ * The evaluators are stored in a std::tuple and can be accessed with get().
+ * All operations of this class run over the evaluators in the order of the
+ * template arguments; the individual evaluators can also be used directly,
+ * e.g., to only evaluate one of the base elements.
+ *
+ * @ingroup matrixfree
+ */
+template <typename... FEEvaluationTypes>
+class FESystemEvaluation
+{
+  static_assert(sizeof...(FEEvaluationTypes) > 0,
+                "FESystemEvaluation needs at least one FEEvaluation type.");
+
+  using FirstEvaluationType =
+    std::tuple_element_t<0, std::tuple<FEEvaluationTypes...>>;
+
+  /**
+   * The evaluators of the base elements. This member is declared before the
+   * public members because n_q_points is initialized from it.
+   */
+  std::tuple<FEEvaluationTypes...> evaluators;
+
+public:
+  /**
+   * The dimension of the evaluators.
+   */
+  static constexpr unsigned int dimension = FirstEvaluationType::dimension;
+
+  /**
+   * The number of evaluators, i.e., the number of (groups of) base elements
+   * that are combined by this class.
+   */
+  static constexpr unsigned int n_evaluators = sizeof...(FEEvaluationTypes);
+
+  /**
+   * The total number of components of all evaluators.
+   */
+  static constexpr unsigned int n_components =
+    (FEEvaluationTypes::n_components + ...);
+
+  /**
+   * The offset of the first component of each evaluator relative to the
+   * first selected component passed to the constructor.
+   */
+  static constexpr std::array<unsigned int, n_evaluators> component_offsets =
+    internal::compute_fe_system_component_offsets<FEEvaluationTypes...>();
+
+  /**
+   * Constructor. Sets up one evaluator per template argument, using the
+   * given @p first_selected_component for the first evaluator and the
+   * subsequent components for the following ones. The other arguments are
+   * passed on to the constructors of the evaluators, see the documentation
+   * of FEEvaluation for their meaning.
+   */
+  template <int dim, typename Number, typename VectorizedArrayType>
+  FESystemEvaluation(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const unsigned int                                  dof_no  = 0,
+    const unsigned int                                  quad_no = 0,
+    const unsigned int first_selected_component                 = 0,
+    const unsigned int active_fe_index   = numbers::invalid_unsigned_int,
+    const unsigned int active_quad_index = numbers::invalid_unsigned_int);
+
+  /**
+   * Return a reference to the evaluator with index @p index.
+   */
+  template <unsigned int index>
+  std::tuple_element_t<index, std::tuple<FEEvaluationTypes...>> &
+  get();
+
+  /**
+   * Return a reference to the evaluator with index @p index.
+   */
+  template <unsigned int index>
+  const std::tuple_element_t<index, std::tuple<FEEvaluationTypes...>> &
+  get() const;
+
+  /**
+   * Initialize all evaluators for the given batch of cells.
+   */
+  void
+  reinit(const unsigned int cell_batch_index);
+
+  /**
+   * Read the degrees of freedom of all base elements on the current cell
+   * batch from @p src, see FEEvaluationBase::read_dof_values().
+   */
+  template <typename VectorType>
+  void
+  read_dof_values(const VectorType &src);
+
+  /**
+   * Add the degrees of freedom of all base elements on the current cell
+   * batch into @p dst, see FEEvaluationBase::distribute_local_to_global().
+   */
+  template <typename VectorType>
+  void
+  distribute_local_to_global(VectorType &dst) const;
+
+  /**
+   * Write the degrees of freedom of all base elements on the current cell
+   * batch into @p dst, see FEEvaluationBase::set_dof_values().
+   */
+  template <typename VectorType>
+  void
+  set_dof_values(VectorType &dst) const;
+
+  /**
+   * Evaluate all base elements at the quadrature points, with the flags
+   * given for each evaluator in @p evaluation_flags.
+   */
+  void
+  evaluate(const std::array<EvaluationFlags::EvaluationFlags, n_evaluators>
+             &evaluation_flags);
+
+  /**
+   * Combination of read_dof_values() and evaluate(). For each evaluator,
+   * this calls FEEvaluation::gather_evaluate(), which can evaluate directly
+   * from the vector entries without an intermediate copy if possible.
+   */
+  template <typename VectorType>
+  void
+  gather_evaluate(
+    const VectorType                                                 &src,
+    const std::array<EvaluationFlags::EvaluationFlags, n_evaluators> &flags);
+
+  /**
+   * Test all base elements with the values, gradients, or hessians submitted
+   * at the quadrature points, with the flags given for each evaluator in
+   * @p integration_flags.
+   */
+  void
+  integrate(const std::array<EvaluationFlags::EvaluationFlags, n_evaluators>
+              &integration_flags);
+
+  /**
+   * Combination of integrate() and distribute_local_to_global(), calling
+   * FEEvaluation::integrate_scatter() for each evaluator.
+   */
+  template <typename VectorType>
+  void
+  integrate_scatter(
+    const std::array<EvaluationFlags::EvaluationFlags, n_evaluators> &flags,
+    VectorType                                                       &dst);
+
+  /**
+   * Return the index of the current cell batch.
+   */
+  unsigned int
+  get_current_cell_index() const;
+
+  /**
+   * Return the quadrature weight times the Jacobian determinant at the
+   * quadrature point with index @p q_point, which is the same for all
+   * evaluators.
+   */
+  auto
+  JxW(const unsigned int q_point) const;
+
+  /**
+   * Return the position of the quadrature point with index @p q_point in
+   * real coordinates.
+   */
+  auto
+  quadrature_point(const unsigned int q_point) const;
+
+  /**
+   * Return an object that can be used in a range-based loop over all
+   * quadrature points of the current cell batch.
+   */
+  std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+  quadrature_point_indices() const;
+
+  /**
+   * The number of quadrature points of all evaluators.
+   */
+  const unsigned int n_q_points;
+
+private:
+  /**
+   * Constructor that sets up the evaluators with the components shifted by
+   * component_offsets.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            std::size_t... indices>
+  FESystemEvaluation(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const unsigned int                                  dof_no,
+    const unsigned int                                  quad_no,
+    const unsigned int                                  first_selected_component,
+    const unsigned int                                  active_fe_index,
+    const unsigned int                                  active_quad_index,
+    std::index_sequence<indices...>);
+
+  /**
+   * Call @p function for all evaluators, with the evaluator as first and its
+   * index as second argument.
+   */
+  template <typename Function, std::size_t... indices>
+  void
+  for_each_evaluator(const Function &function, std::index_sequence<indices...>);
+
+  /**
+   * Same as above, for read-only access.
+   */
+  template <typename Function, std::size_t... indices>
+  void
+  for_each_evaluator(const Function &function,
+                     std::index_sequence<indices...>) const;
+};
+
+
+
+#ifndef DOXYGEN
+
+template <typename... FEEvaluationTypes>
+template <int dim, typename Number, typename VectorizedArrayType>
+inline FESystemEvaluation<FEEvaluationTypes...>::FESystemEvaluation(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const unsigned int                                  dof_no,
+  const unsigned int                                  quad_no,
+  const unsigned int                                  first_selected_component,
+  const unsigned int                                  active_fe_index,
+  const unsigned int                                  active_quad_index)
+  : FESystemEvaluation(matrix_free,
+                       dof_no,
+                       quad_no,
+                       first_selected_component,
+                       active_fe_index,
+                       active_quad_index,
+                       std::index_sequence_for<FEEvaluationTypes...>())
+{}
+
+
+
+template <typename... FEEvaluationTypes>
+template <int dim,
+          typename Number,
+          typename VectorizedArrayType,
+          std::size_t... indices>
+inline FESystemEvaluation<FEEvaluationTypes...>::FESystemEvaluation(
+  const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+  const unsigned int                                  dof_no,
+  const unsigned int                                  quad_no,
+  const unsigned int                                  first_selected_component,
+  const unsigned int                                  active_fe_index,
+  const unsigned int                                  active_quad_index,
+  std::index_sequence<indices...>)
+  : evaluators(FEEvaluationTypes(matrix_free,
+                                 dof_no,
+                                 quad_no,
+                                 first_selected_component +
+                                   component_offsets[indices],
+                                 active_fe_index,
+                                 active_quad_index)...)
+  , n_q_points(std::get<0>(evaluators).n_q_points)
+{
+  static_assert(((FEEvaluationTypes::dimension == dim) && ...),
+                "All evaluators must have the same dimension.");
+
+  for_each_evaluator(
+    [&](const auto &phi, const unsigned int) {
+      (void)phi;
+      AssertDimension(phi.n_q_points, n_q_points);
+    },
+    std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <unsigned int index>
+inline std::tuple_element_t<index, std::tuple<FEEvaluationTypes...>> &
+FESystemEvaluation<FEEvaluationTypes...>::get()
+{
+  return std::get<index>(evaluators);
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <unsigned int index>
+inline const std::tuple_element_t<index, std::tuple<FEEvaluationTypes...>> &
+FESystemEvaluation<FEEvaluationTypes...>::get() const
+{
+  return std::get<index>(evaluators);
+}
+
+
+
+template <typename... FEEvaluationTypes>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::reinit(
+  const unsigned int cell_batch_index)
+{
+  for_each_evaluator([&](auto &phi,
+                         const unsigned int) { phi.reinit(cell_batch_index); },
+                     std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <typename VectorType>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::read_dof_values(const VectorType &src)
+{
+  for_each_evaluator([&](auto &phi,
+                         const unsigned int) { phi.read_dof_values(src); },
+                     std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <typename VectorType>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::distribute_local_to_global(
+  VectorType &dst) const
+{
+  for_each_evaluator(
+    [&](const auto &phi, const unsigned int) {
+      phi.distribute_local_to_global(dst);
+    },
+    std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <typename VectorType>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::set_dof_values(VectorType &dst) const
+{
+  for_each_evaluator([&](const auto &phi,
+                         const unsigned int) { phi.set_dof_values(dst); },
+                     std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::evaluate(
+  const std::array<EvaluationFlags::EvaluationFlags, n_evaluators>
+    &evaluation_flags)
+{
+  for_each_evaluator(
+    [&](auto &phi, const unsigned int i) {
+      if (evaluation_flags[i] != EvaluationFlags::nothing)
+        phi.evaluate(evaluation_flags[i]);
+    },
+    std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <typename VectorType>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::gather_evaluate(
+  const VectorType                                                 &src,
+  const std::array<EvaluationFlags::EvaluationFlags, n_evaluators> &flags)
+{
+  for_each_evaluator(
+    [&](auto &phi, const unsigned int i) {
+      if (flags[i] != EvaluationFlags::nothing)
+        phi.gather_evaluate(src, flags[i]);
+    },
+    std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::integrate(
+  const std::array<EvaluationFlags::EvaluationFlags, n_evaluators>
+    &integration_flags)
+{
+  for_each_evaluator(
+    [&](auto &phi, const unsigned int i) {
+      if (integration_flags[i] != EvaluationFlags::nothing)
+        phi.integrate(integration_flags[i]);
+    },
+    std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <typename VectorType>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::integrate_scatter(
+  const std::array<EvaluationFlags::EvaluationFlags, n_evaluators> &flags,
+  VectorType                                                       &dst)
+{
+  for_each_evaluator(
+    [&](auto &phi, const unsigned int i) {
+      if (flags[i] != EvaluationFlags::nothing)
+        phi.integrate_scatter(flags[i], dst);
+    },
+    std::index_sequence_for<FEEvaluationTypes...>());
+}
+
+
+
+template <typename... FEEvaluationTypes>
+inline unsigned int
+FESystemEvaluation<FEEvaluationTypes...>::get_current_cell_index() const
+{
+  return std::get<0>(evaluators).get_current_cell_index();
+}
+
+
+
+template <typename... FEEvaluationTypes>
+inline auto
+FESystemEvaluation<FEEvaluationTypes...>::JxW(const unsigned int q_point) const
+{
+  return std::get<0>(evaluators).JxW(q_point);
+}
+
+
+
+template <typename... FEEvaluationTypes>
+inline auto
+FESystemEvaluation<FEEvaluationTypes...>::quadrature_point(
+  const unsigned int q_point) const
+{
+  return std::get<0>(evaluators).quadrature_point(q_point);
+}
+
+
+
+template <typename... FEEvaluationTypes>
+inline std_cxx20::ranges::iota_view<unsigned int, unsigned int>
+FESystemEvaluation<FEEvaluationTypes...>::quadrature_point_indices() const
+{
+  return {0U, n_q_points};
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <typename Function, std::size_t... indices>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::for_each_evaluator(
+  const Function &function,
+  std::index_sequence<indices...>)
+{
+  (function(std::get<indices>(evaluators), indices), ...);
+}
+
+
+
+template <typename... FEEvaluationTypes>
+template <typename Function, std::size_t... indices>
+inline void
+FESystemEvaluation<FEEvaluationTypes...>::for_each_evaluator(
+  const Function &function,
+  std::index_sequence<indices...>) const
+{
+  (function(std::get<indices>(evaluators), indices), ...);
+}
+
+#endif // ifndef DOXYGEN
+
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
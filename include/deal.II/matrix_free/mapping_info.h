@@ -33,6 +33,7 @@
 
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/mapping_info_storage.h>
+#include <deal.II/matrix_free/shape_info.h>
 
 #include <memory>
 
@@ -73,7 +74,9 @@ namespace internal
         const UpdateFlags update_flags_boundary_faces,
         const UpdateFlags update_flags_inner_faces,
         const UpdateFlags update_flags_faces_by_cells,
-        const bool        piola_transform);
+        const bool        piola_transform,
+        const bool        cell_geometry_on_the_fly       = false,
+        const bool        cell_geometry_single_precision = false);
 
       /**
        * Update the information in the given cells and faces that is the
@@ -89,6 +92,37 @@ namespace internal
         const std::vector<unsigned int> &active_fe_index,
         const std::shared_ptr<dealii::hp::MappingCollection<dim>> &mapping);
 
+      /**
+       * Compute the inverse Jacobians, the JxW values, and, if requested by
+       * the update flags, the quadrature points of the given cell batch from
+       * the stored mapping support points, for the case that
+       * @p cell_geometry_on_the_fly is set. The results are written into
+       * the first entries of the respective fields of @p data, which are
+       * resized as necessary. The array @p scratch_data is used as temporary
+       * storage for the tensor-product evaluation.
+       */
+      void
+      compute_cell_data_on_the_fly(
+        const unsigned int                                 cell_batch_index,
+        const unsigned int                                 quad_no,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &data,
+        AlignedVector<VectorizedArrayType>                &scratch_data) const;
+
+      /**
+       * Convert the inverse Jacobians and the JxW values of the given cell
+       * batch from the single-precision copy in
+       * @p cell_single_precision_data to the precision of
+       * VectorizedArrayType, for the case that
+       * @p cell_geometry_single_precision is set. The results are written
+       * into the first entries of the respective fields of @p data, which
+       * are resized as necessary.
+       */
+      void
+      copy_cell_data_from_single_precision(
+        const unsigned int                                 cell_batch_index,
+        const unsigned int                                 quad_no,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &data) const;
+
       /**
        * Return the type of a given cell as detected during initialization.
        */
@@ -171,6 +205,68 @@ namespace internal
        */
       std::vector<MappingInfoStorage<dim, dim, VectorizedArrayType>> cell_data;
 
+      /**
+       * If true, the geometry of cells of type `general` is not stored on
+       * the quadrature points in @p cell_data. Instead, only the support
+       * points of the mapping are kept in @p cell_mapping_support_points and
+       * the data is recomputed with compute_cell_data_on_the_fly() whenever
+       * FEEvaluation is reinitialized on such a cell batch. This is only
+       * enabled for mappings of type MappingQ without hp-adaptivity and
+       * without update_jacobian_grads on cells; otherwise, the flag given
+       * to initialize() is ignored.
+       */
+      bool cell_geometry_on_the_fly = false;
+
+      /**
+       * The support points of the mapping on the cell batches of type
+       * `general` in case @p cell_geometry_on_the_fly is set, with the points
+       * in lexicographic order and the components of the points as the outer
+       * index. Indexed by @p cell_mapping_support_point_offsets.
+       */
+      AlignedVector<VectorizedArrayType> cell_mapping_support_points;
+
+      /**
+       * The offsets into @p cell_mapping_support_points for each cell batch,
+       * set to numbers::invalid_unsigned_int for batches that store their
+       * geometry in @p cell_data.
+       */
+      std::vector<unsigned int> cell_mapping_support_point_offsets;
+
+      /**
+       * The interpolation matrices from the mapping support points to the
+       * quadrature points of each entry of @p cell_data, used by
+       * compute_cell_data_on_the_fly().
+       */
+      std::vector<ShapeInfo<Number>> cell_mapping_shape_infos;
+
+      /**
+       * If true, the inverse Jacobians and the JxW values of cells of type
+       * `general` are not kept in @p cell_data but in single precision in
+       * @p cell_single_precision_data, and are converted back with
+       * copy_cell_data_from_single_precision() whenever FEEvaluation is
+       * reinitialized on such a cell batch. This is only enabled under the
+       * same conditions as @p cell_geometry_on_the_fly, when the latter is
+       * not set, and when Number is not already float; otherwise, the flag
+       * given to initialize() is ignored.
+       */
+      bool cell_geometry_single_precision = false;
+
+      /**
+       * The position of each cell batch of type `general` within
+       * @p cell_single_precision_data, set to numbers::invalid_unsigned_int
+       * for batches that store their geometry in @p cell_data.
+       */
+      std::vector<unsigned int> cell_single_precision_index;
+
+      /**
+       * The inverse Jacobians and the JxW values on the cell batches of type
+       * `general` in case @p cell_geometry_single_precision is set, for each
+       * entry of @p cell_data. On each quadrature point, the $\text{dim}^2$
+       * entries of the inverse Jacobian are followed by the JxW value, with
+       * the SIMD lanes as the fastest running index.
+       */
+      std::vector<AlignedVector<float>> cell_single_precision_data;
+
       /**
        * The data cache for the faces.
        */
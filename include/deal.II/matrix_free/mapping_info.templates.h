@@ -52,6 +52,13 @@ namespace internal
       face_data_by_cells.clear();
       cell_type.clear();
       face_type.clear();
+      cell_geometry_on_the_fly = false;
+      cell_mapping_support_points.clear();
+      cell_mapping_support_point_offsets.clear();
+      cell_mapping_shape_infos.clear();
+      cell_geometry_single_precision = false;
+      cell_single_precision_index.clear();
+      cell_single_precision_data.clear();
       mapping_collection = nullptr;
       mapping            = nullptr;
     }
@@ -71,11 +78,15 @@ namespace internal
       const UpdateFlags update_flags_boundary_faces,
       const UpdateFlags update_flags_inner_faces,
       const UpdateFlags update_flags_faces_by_cells,
-      const bool        piola_transform)
+      const bool        piola_transform,
+      const bool        cell_geometry_on_the_fly,
+      const bool        cell_geometry_single_precision)
     {
       clear();
-      this->mapping_collection = mapping;
-      this->mapping            = &mapping->operator[](0);
+      this->cell_geometry_on_the_fly       = cell_geometry_on_the_fly;
+      this->cell_geometry_single_precision = cell_geometry_single_precision;
+      this->mapping_collection             = mapping;
+      this->mapping                        = &mapping->operator[](0);
 
       cell_data.resize(quad.size());
       face_data.resize(quad.size());
@@ -190,6 +201,9 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          this->cell_geometry_on_the_fly       = false;
+          this->cell_geometry_single_precision = false;
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -213,13 +227,11 @@ namespace internal
       AssertDimension(cells.size() / VectorizedArrayType::size(),
                       cell_type.size());
 
-      for (auto &data : cell_data)
-        data.clear_data_fields();
-      for (auto &data : face_data)
-        data.clear_data_fields();
-      for (auto &data : face_data_by_cells)
-        data.clear_data_fields();
-
+      // We do not clear the data fields here: All of them get resized to
+      // their new length with resize_fast() below, which keeps the memory
+      // already allocated. Since the number of cells with a general geometry
+      // changes only little in a typical moving-mesh simulation, this avoids
+      // to allocate and first touch all the arrays in every call.
       this->mapping_collection = mapping;
       this->mapping            = &mapping->operator[](0);
 
@@ -228,6 +240,9 @@ namespace internal
         compute_mapping_q(tria, cells, face_info);
       else
         {
+          cell_geometry_on_the_fly       = false;
+          cell_geometry_single_precision = false;
+
           // Could call these functions in parallel, but not useful because
           // the work inside is nicely split up already
           initialize_cells(tria, cells, active_fe_index, *mapping);
@@ -1171,6 +1186,7 @@ namespace internal
         const UpdateFlags            update_flags_cells,
         const AlignedVector<double> &plain_quadrature_points,
         const ShapeInfo<double>     &shape_info,
+        const bool                   skip_general_cells,
         MappingInfoStorage<dim, dim, VectorizedArrayType> &my_data)
       {
         constexpr unsigned int n_lanes   = VectorizedArrayType::size();
@@ -1189,6 +1205,9 @@ namespace internal
         for (unsigned int cell = begin_cell; cell < end_cell; ++cell)
           for (unsigned vv = 0; vv < n_lanes; vv += n_lanes_d)
             {
+              if (skip_general_cells && cell_type[cell] > affine)
+                continue;
+
               if (cell_type[cell] > affine || process_cell[cell])
                 {
                   unsigned int start_indices[n_lanes_d];
@@ -2781,6 +2800,60 @@ namespace internal
                               preliminary_cell_type.data() + cell + n_lanes);
         }
 
+      // step 3b: in case the geometry of general cells should be computed
+      // on the fly, keep the mapping support points of those cells and the
+      // interpolation matrices to the quadrature points
+      if (update_flags_cells & update_jacobian_grads)
+        cell_geometry_on_the_fly = false;
+      if (cell_geometry_on_the_fly)
+        {
+          FE_DGQ<dim> fe_geometry(mapping_degree);
+          cell_mapping_shape_infos.resize(cell_data.size());
+          for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
+            cell_mapping_shape_infos[my_q].reinit(
+              cell_data[my_q].descriptor[0].quadrature, fe_geometry);
+
+          cell_mapping_support_point_offsets.resize(
+            cell_type.size(), numbers::invalid_unsigned_int);
+          unsigned int n_general_cells = 0;
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] > affine)
+              cell_mapping_support_point_offsets[cell] =
+                (n_general_cells++) * dim * n_mapping_points;
+
+          cell_mapping_support_points.resize_fast(n_general_cells * dim *
+                                                  n_mapping_points);
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] > affine)
+              for (unsigned int i = 0; i < dim * n_mapping_points; ++i)
+                for (unsigned int v = 0; v < n_lanes; ++v)
+                  cell_mapping_support_points
+                    [cell_mapping_support_point_offsets[cell] + i][v] =
+                      plain_quadrature_points
+                        [(cell * n_lanes + v) * dim * n_mapping_points + i];
+        }
+
+      // step 3c: in case the geometry of general cells should be stored in
+      // single precision, assign the position of those cells in the
+      // single-precision arrays, letting batches with the same data share
+      // their entries
+      if ((update_flags_cells & update_jacobian_grads) ||
+          cell_geometry_on_the_fly || std::is_same_v<Number, float>)
+        cell_geometry_single_precision = false;
+      unsigned int n_single_precision_cells = 0;
+      if (cell_geometry_single_precision)
+        {
+          cell_single_precision_index.assign(cell_type.size(),
+                                             numbers::invalid_unsigned_int);
+          for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+            if (cell_type[cell] > affine)
+              cell_single_precision_index[cell] =
+                process_cell[cell] ?
+                  n_single_precision_cells++ :
+                  cell_single_precision_index[cell_data_index_vect[cell]];
+          cell_single_precision_data.resize(cell_data.size());
+        }
+
       // step 4: compute the data on cells from the cached quadrature
       // points, filling up all SIMD lanes as appropriate
       for (unsigned int my_q = 0; my_q < cell_data.size(); ++my_q)
@@ -2791,7 +2864,9 @@ namespace internal
           // step 4a: set the index offsets, find out how much to allocate,
           // and allocate the memory
           const unsigned int n_q_points = my_data.descriptor[0].n_q_points;
-          unsigned int       max_size   = 0;
+          const unsigned int n_general_points =
+            cell_geometry_on_the_fly ? 0 : n_q_points;
+          unsigned int max_size = 0;
           my_data.data_index_offsets.resize(cell_type.size());
           for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
             {
@@ -2803,7 +2878,7 @@ namespace internal
               max_size =
                 std::max(max_size,
                          my_data.data_index_offsets[cell] +
-                           (cell_type[cell] <= affine ? 2 : n_q_points));
+                           (cell_type[cell] <= affine ? 2 : n_general_points));
             }
 
           my_data.JxW_values.resize_fast(max_size);
@@ -2823,10 +2898,11 @@ namespace internal
                     my_data.quadrature_point_offsets[cell - 1] + 1;
                 else
                   my_data.quadrature_point_offsets[cell] =
-                    my_data.quadrature_point_offsets[cell - 1] + n_q_points;
+                    my_data.quadrature_point_offsets[cell - 1] +
+                    n_general_points;
               my_data.quadrature_points.resize_fast(
                 my_data.quadrature_point_offsets.back() +
-                (cell_type.back() <= affine ? 1 : n_q_points));
+                (cell_type.back() <= affine ? 1 : n_general_points));
             }
 
           // step 4b: go through the cells and compute the information using
@@ -2848,10 +2924,72 @@ namespace internal
                 update_flags_cells,
                 plain_quadrature_points,
                 shape_infos[my_q],
+                cell_geometry_on_the_fly,
                 my_data);
             },
             std::max(cell_type.size() / MultithreadInfo::n_threads() / 2,
                      std::size_t(2U)));
+
+          // step 4c: move the inverse Jacobians and JxW values of general
+          // cells to the single-precision arrays and compact the remaining
+          // data of Cartesian and affine cells
+          if (cell_geometry_single_precision)
+            {
+              constexpr unsigned int n_entries = dim * dim + 1;
+              AlignedVector<float>  &sp_data = cell_single_precision_data[my_q];
+              sp_data.resize_fast(n_single_precision_cells * n_q_points *
+                                  n_entries * n_lanes);
+
+              std::map<unsigned int, unsigned int> new_offsets;
+              unsigned int                         n_stored = 0;
+              for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+                if (cell_type[cell] <= affine)
+                  {
+                    if (new_offsets
+                          .emplace(my_data.data_index_offsets[cell], n_stored)
+                          .second)
+                      n_stored += 2;
+                  }
+                else if (process_cell[cell])
+                  {
+                    const unsigned int offset =
+                      my_data.data_index_offsets[cell];
+                    float *data_ptr =
+                      sp_data.data() + cell_single_precision_index[cell] *
+                                         n_q_points * n_entries * n_lanes;
+                    for (unsigned int q = 0; q < n_q_points; ++q)
+                      {
+                        for (unsigned int d = 0; d < dim; ++d)
+                          for (unsigned int e = 0; e < dim; ++e)
+                            for (unsigned int v = 0; v < n_lanes; ++v)
+                              data_ptr[(d * dim + e) * n_lanes + v] =
+                                my_data.jacobians[0][offset + q][d][e][v];
+                        for (unsigned int v = 0; v < n_lanes; ++v)
+                          data_ptr[dim * dim * n_lanes + v] =
+                            my_data.JxW_values[offset + q][v];
+                        data_ptr += n_entries * n_lanes;
+                      }
+                  }
+
+              AlignedVector<Tensor<2, dim, VectorizedArrayType>> jacobians(
+                n_stored);
+              AlignedVector<VectorizedArrayType> JxW_values(n_stored);
+              for (const auto &[old_offset, new_offset] : new_offsets)
+                for (unsigned int i = 0; i < 2; ++i)
+                  {
+                    jacobians[new_offset + i] =
+                      my_data.jacobians[0][old_offset + i];
+                    JxW_values[new_offset + i] =
+                      my_data.JxW_values[old_offset + i];
+                  }
+              for (unsigned int cell = 0; cell < cell_type.size(); ++cell)
+                my_data.data_index_offsets[cell] =
+                  cell_type[cell] <= affine ?
+                    new_offsets[my_data.data_index_offsets[cell]] :
+                    n_stored;
+              my_data.jacobians[0].swap(jacobians);
+              my_data.JxW_values.swap(JxW_values);
+            }
         }
 
       const std::vector<FaceToCellTopology<VectorizedArrayType::size()>>
@@ -3362,11 +3500,139 @@ namespace internal
 
 
 
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    MappingInfo<dim, Number, VectorizedArrayType>::compute_cell_data_on_the_fly(
+      const unsigned int                                 cell_batch_index,
+      const unsigned int                                 quad_no,
+      MappingInfoStorage<dim, dim, VectorizedArrayType> &data,
+      AlignedVector<VectorizedArrayType>                &scratch_data) const
+    {
+      AssertIndexRange(quad_no, cell_mapping_shape_infos.size());
+      AssertIndexRange(cell_batch_index,
+                       cell_mapping_support_point_offsets.size());
+      Assert(cell_mapping_support_point_offsets[cell_batch_index] !=
+               numbers::invalid_unsigned_int,
+             ExcMessage("The geometry of this cell batch is stored "
+                        "explicitly and not computed on the fly."));
+
+      const ShapeInfo<Number> &shape_info = cell_mapping_shape_infos[quad_no];
+      const unsigned int       n_q_points =
+        cell_data[quad_no].descriptor[0].n_q_points;
+      const unsigned int n_mapping_points =
+        shape_info.dofs_per_component_on_cell;
+      const bool compute_points = update_flags_cells & update_quadrature_points;
+
+      FEEvaluationData<dim, VectorizedArrayType, false> eval(shape_info);
+      eval.set_data_pointers(&scratch_data, dim);
+
+      const VectorizedArrayType *support_points =
+        cell_mapping_support_points.data() +
+        cell_mapping_support_point_offsets[cell_batch_index];
+      std::copy(support_points,
+                support_points + dim * n_mapping_points,
+                eval.begin_dof_values());
+
+      FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+        dim,
+        EvaluationFlags::gradients |
+          (compute_points ? EvaluationFlags::values : EvaluationFlags::nothing),
+        eval.begin_dof_values(),
+        eval);
+
+      if (data.data_index_offsets.size() != 1)
+        data.data_index_offsets.resize(1, 0U);
+      if (data.jacobians[0].size() != n_q_points)
+        data.jacobians[0].resize_fast(n_q_points);
+      if (data.JxW_values.size() != n_q_points)
+        data.JxW_values.resize_fast(n_q_points);
+      if (compute_points && data.quadrature_points.size() != n_q_points)
+        {
+          data.quadrature_point_offsets.resize(1, 0U);
+          data.quadrature_points.resize_fast(n_q_points);
+        }
+
+      const Quadrature<dim> &quadrature =
+        cell_data[quad_no].descriptor[0].quadrature;
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          Tensor<2, dim, VectorizedArrayType> jac;
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              jac[d][e] =
+                eval.begin_gradients()[e + (d * n_q_points + q) * dim];
+
+          data.JxW_values[q] = determinant(jac) * Number(quadrature.weight(q));
+          data.jacobians[0][q] = transpose(invert(jac));
+
+          if (compute_points)
+            for (unsigned int d = 0; d < dim; ++d)
+              data.quadrature_points[q][d] =
+                eval.begin_values()[q + d * n_q_points];
+        }
+    }
+
+
+
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    MappingInfo<dim, Number, VectorizedArrayType>::
+      copy_cell_data_from_single_precision(
+        const unsigned int                                 cell_batch_index,
+        const unsigned int                                 quad_no,
+        MappingInfoStorage<dim, dim, VectorizedArrayType> &data) const
+    {
+      AssertIndexRange(quad_no, cell_single_precision_data.size());
+      AssertIndexRange(cell_batch_index, cell_single_precision_index.size());
+      Assert(cell_single_precision_index[cell_batch_index] !=
+               numbers::invalid_unsigned_int,
+             ExcMessage("The geometry of this cell batch is not stored in "
+                        "single precision."));
+
+      constexpr unsigned int n_lanes   = VectorizedArrayType::size();
+      constexpr unsigned int n_entries = dim * dim + 1;
+      const unsigned int     n_q_points =
+        cell_data[quad_no].descriptor[0].n_q_points;
+
+      if (data.data_index_offsets.size() != 1)
+        data.data_index_offsets.resize(1, 0U);
+      if (data.jacobians[0].size() != n_q_points)
+        data.jacobians[0].resize_fast(n_q_points);
+      if (data.JxW_values.size() != n_q_points)
+        data.JxW_values.resize_fast(n_q_points);
+
+      const float *data_ptr =
+        cell_single_precision_data[quad_no].data() +
+        cell_single_precision_index[cell_batch_index] * n_q_points *
+          n_entries * n_lanes;
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int e = 0; e < dim; ++e)
+              for (unsigned int v = 0; v < n_lanes; ++v)
+                data.jacobians[0][q][d][e][v] =
+                  data_ptr[(d * dim + e) * n_lanes + v];
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            data.JxW_values[q][v] = data_ptr[dim * dim * n_lanes + v];
+          data_ptr += n_entries * n_lanes;
+        }
+    }
+
+
+
     template <int dim, typename Number, typename VectorizedArrayType>
     std::size_t
     MappingInfo<dim, Number, VectorizedArrayType>::memory_consumption() const
     {
       std::size_t memory = MemoryConsumption::memory_consumption(cell_data);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_mapping_support_points);
+      memory += MemoryConsumption::memory_consumption(
+        cell_mapping_support_point_offsets);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_single_precision_index);
+      memory +=
+        MemoryConsumption::memory_consumption(cell_single_precision_data);
       memory += MemoryConsumption::memory_consumption(face_data);
       memory += MemoryConsumption::memory_consumption(face_data_by_cells);
       memory += cell_type.capacity() * sizeof(GeometryType);
@@ -3401,6 +3667,22 @@ namespace internal
                                           GeometryInfo<dim>::faces_per_cell *
                                           sizeof(GeometryType));
 
+      if (cell_geometry_on_the_fly)
+        {
+          out << "    Mapping support points:          ";
+          task_info.print_memory_statistics(
+            out,
+            MemoryConsumption::memory_consumption(cell_mapping_support_points));
+        }
+
+      if (cell_geometry_single_precision)
+        {
+          out << "    Single-precision cell geometry:  ";
+          task_info.print_memory_statistics(
+            out,
+            MemoryConsumption::memory_consumption(cell_single_precision_data));
+        }
+
       for (unsigned int j = 0; j < cell_data.size(); ++j)
         {
           out << "    Data component " << j << std::endl;
@@ -49,6 +49,9 @@
 #include <limits>
 #include <list>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -178,7 +181,10 @@ public:
    *
    * Finally, @p allow_ghosted_vectors_in_loops allows to enable and disable
    * checks and @p communicator_sm gives the MPI communicator to be used
-   * if MPI-3.0 shared-memory features should be used.
+   * if MPI-3.0 shared-memory features should be used. The variable
+   * @p poll_communication_progress can be set to let the loops test the
+   * state of the ghost value exchange in between the cell batches that
+   * overlap with the communication.
    */
   struct AdditionalData
   {
@@ -250,6 +256,12 @@ public:
           cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(allow_ghosted_vectors_in_loops)
       , communicator_sm(MPI_COMM_SELF)
+      , poll_communication_progress(false)
+      , tune_evaluation_kernels(false)
+      , order_cells_along_hilbert_curve(false)
+      , compress_dof_indices(false)
+      , cell_geometry_on_the_fly(false)
+      , cell_geometry_single_precision(false)
     {}
 
     /**
@@ -276,6 +288,12 @@ public:
           other.cell_vectorization_categories_strict)
       , allow_ghosted_vectors_in_loops(other.allow_ghosted_vectors_in_loops)
       , communicator_sm(other.communicator_sm)
+      , poll_communication_progress(other.poll_communication_progress)
+      , tune_evaluation_kernels(other.tune_evaluation_kernels)
+      , order_cells_along_hilbert_curve(other.order_cells_along_hilbert_curve)
+      , compress_dof_indices(other.compress_dof_indices)
+      , cell_geometry_on_the_fly(other.cell_geometry_on_the_fly)
+      , cell_geometry_single_precision(other.cell_geometry_single_precision)
     {}
 
     /**
@@ -302,8 +320,14 @@ public:
       cell_vectorization_category   = other.cell_vectorization_category;
       cell_vectorization_categories_strict =
         other.cell_vectorization_categories_strict;
-      allow_ghosted_vectors_in_loops = other.allow_ghosted_vectors_in_loops;
-      communicator_sm                = other.communicator_sm;
+      allow_ghosted_vectors_in_loops  = other.allow_ghosted_vectors_in_loops;
+      communicator_sm                 = other.communicator_sm;
+      poll_communication_progress     = other.poll_communication_progress;
+      tune_evaluation_kernels         = other.tune_evaluation_kernels;
+      order_cells_along_hilbert_curve = other.order_cells_along_hilbert_curve;
+      compress_dof_indices            = other.compress_dof_indices;
+      cell_geometry_on_the_fly        = other.cell_geometry_on_the_fly;
+      cell_geometry_single_precision  = other.cell_geometry_single_precision;
 
       return *this;
     }
@@ -551,6 +575,142 @@ public:
      * Shared-memory MPI communicator. Default: MPI_COMM_SELF.
      */
     MPI_Comm communicator_sm;
+
+    /**
+     * Many MPI implementations only make progress on non-blocking messages
+     * while the application is inside an MPI call. In that case, the
+     * overlap of the ghost value exchange with the computations on the
+     * cells that do not need ghost values, as set up by
+     * @p overlap_communication_computation, is mostly illusory, because the
+     * messages are only transferred once the loop waits for them. If this
+     * flag is set, the serial loops (i.e., the ones with
+     * @p tasks_parallel_scheme set to @p none) test the state of the
+     * outstanding messages after each range of cell batches, face batches,
+     * and boundary face batches, until the exchange has completed. This
+     * gives the MPI implementation regular opportunities to make progress.
+     * The test only applies to the ghost exchange of the source vectors of
+     * type LinearAlgebra::distributed::Vector, and it is not done in the
+     * loops with multithreading because this would require MPI to be
+     * initialized with support for concurrent calls from several threads.
+     *
+     * When this flag is set, the loops also record statistics of how much
+     * of the exchange overlapped with computations, see
+     * internal::MatrixFreeFunctions::TaskInfo::GhostExchangeStatistics,
+     * which can be queried via
+     * `get_task_info().ghost_exchange_statistics`.
+     *
+     * Default: false.
+     */
+    bool poll_communication_progress;
+
+    /**
+     * For elements with symmetric shape functions and more quadrature points
+     * than the polynomial degree, FEEvaluation can compute the gradients
+     * either with the usual sum-factorization kernels of the even-odd
+     * decomposition or by a transformation to the collocation space of the
+     * quadrature points. By default, the variant with the lower operation
+     * count is used. Since the actual performance also depends on the
+     * hardware, the compiler, and the vectorization width, setting this flag
+     * lets MatrixFree::reinit() time both variants for evaluation and
+     * integration of values and gradients for each finite element and
+     * quadrature formula, and store the faster one in the respective
+     * internal::MatrixFreeFunctions::ShapeInfo object. The timings are
+     * taken as the maximum over all MPI processes, such that all processes
+     * select the same variant. The selection can be queried by
+     * MatrixFree::print_evaluation_kernels().
+     *
+     * The tuning only affects the evaluation on cells. Note that the
+     * measurement takes some time and is subject to noise, so this flag is
+     * mostly useful for long-running applications.
+     *
+     * Default: false.
+     */
+    bool tune_evaluation_kernels;
+
+    /**
+     * By default, the cells are passed to the setup of the cell batches and
+     * the task partitioning in the order given by a traversal of the coarse
+     * cells, where the children of each coarse cell are visited in
+     * z-order. This gives good data locality within each coarse cell but not
+     * necessarily between coarse cells, e.g. for meshes read from a file
+     * where the coarse cells are numbered in arbitrary order. If this flag is
+     * set to true, the locally owned cells (or the locally owned level cells
+     * when @p mg_level is set) are instead first sorted along a Hilbert
+     * space-filling curve through the cell centers, such that consecutive
+     * cell batches tend to share degrees of freedom and the vector entries
+     * accessed in read_dof_values() and distribute_local_to_global() stay in
+     * caches.
+     *
+     * The ordering of the cells is preserved by the cell batches and by the
+     * task scheme @p none, whereas the partitioning of the other task schemes
+     * reorders the cells according to their own criteria starting from this
+     * order. In order to also obtain a matching numbering of the unknowns,
+     * call DoFRenumbering::matrix_free_data_locality() with the same
+     * AdditionalData before the final setup of the MatrixFree object.
+     *
+     * Default: false.
+     */
+    bool order_cells_along_hilbert_curve;
+
+    /**
+     * For continuous elements, the indices of the cell batches without
+     * constraints are stored in an interleaved format with one 32-bit
+     * integer per degree of freedom and SIMD lane, which makes up a
+     * significant part of the memory transfer in operator evaluation of
+     * high-order elements. If this flag is set to true, the indices of those
+     * cells are instead stored as one base index per cell plus 16-bit
+     * offsets, which halves the size of the index data read in
+     * FEEvaluation::read_dof_values() and
+     * FEEvaluation::distribute_local_to_global() at the cost of one integer
+     * addition per index. Cells whose indices span more than 65536 entries
+     * keep the uncompressed format. The compression works best together
+     * with a numbering of the degrees of freedom that keeps the indices of a
+     * cell close together, such as the one of
+     * DoFRenumbering::matrix_free_data_locality().
+     *
+     * Default: false.
+     */
+    bool compress_dof_indices;
+
+    /**
+     * On cells of curved meshes, MatrixFree stores the inverse Jacobian and
+     * the JxW value on every quadrature point, which dominates the memory
+     * transfer of operator evaluation for higher mapping degrees. If this
+     * flag is set to true, only the support points of the mapping are stored
+     * for such cells, and FEEvaluation::reinit() recomputes the inverse
+     * Jacobians, the JxW values, and (if requested) the quadrature points
+     * with the sum-factorization kernels, trading arithmetic for a reduction
+     * of the geometry data from $(\text{dim}^2+1)$ numbers per quadrature
+     * point to $\text{dim}$ numbers per mapping support point. Cartesian and
+     * affine cells as well as faces keep their stored data.
+     *
+     * This option is only available for mappings derived from MappingQ
+     * without hp-adaptivity, and when @p mapping_update_flags does not contain
+     * update_jacobian_grads or update_hessians; otherwise, the flag is
+     * silently ignored. FEEvaluation::reinit() with an array of cell indices
+     * is not supported on curved cells with this option.
+     *
+     * Default: false.
+     */
+    bool cell_geometry_on_the_fly;
+
+    /**
+     * If set to true, the inverse Jacobians and the JxW values on the
+     * quadrature points of curved cells are stored in single precision, and
+     * FEEvaluation::reinit() converts them back to the precision of
+     * VectorizedArrayType. This halves the memory transfer for the geometry
+     * of a double-precision operator, at the cost of a relative accuracy of
+     * the geometry of about $10^{-7}$, which is acceptable for many
+     * operators, e.g. within a preconditioner. Cartesian and affine cells,
+     * faces, and the quadrature points keep their stored data.
+     *
+     * The same restrictions as for @p cell_geometry_on_the_fly apply, and
+     * this flag has no effect if the latter is set or if the
+     * MatrixFree object uses float as number type.
+     *
+     * Default: false.
+     */
+    bool cell_geometry_single_precision;
   };
 
   /**
@@ -583,6 +743,11 @@ public:
    * same element. Mixing several different elements into one FESystem is
    * not allowed. In that case, use the initialization function with
    * several DoFHandler arguments.
+   *
+   * When this function is called again on the same object with the same
+   * finite element and quadrature formula, e.g. after adaptive refinement
+   * of the mesh, the shape information on the unit cell is kept from the
+   * previous call rather than being recomputed.
    */
   template <typename QuadratureType, typename number2, typename MappingType>
   void
@@ -653,6 +818,15 @@ public:
    * same. Compared to reinit(), this operation only has to re-generate the
    * geometry arrays and can thus be significantly cheaper (depending on the
    * cost to evaluate the geometry).
+   *
+   * This is the intended way to deal with moving meshes, e.g. with a
+   * MappingQEulerian or MappingFEField object that describes the current
+   * configuration through a displacement vector: After the displacement
+   * vector has been changed, a call to this function with the same mapping
+   * object recomputes the geometry in parallel with the tasks set up in
+   * reinit(). The DoFInfo data structures, the partitioning of the cells
+   * into batches and tasks, as well as the memory of the geometry arrays
+   * are kept.
    */
   void
   update_mapping(const Mapping<dim> &mapping);
@@ -2089,6 +2263,16 @@ public:
   void
   print_memory_consumption(StreamType &out) const;
 
+  /**
+   * Prints which evaluation kernel FEEvaluation uses on cells for each
+   * finite element and quadrature formula, as selected by the element type
+   * and, if AdditionalData::tune_evaluation_kernels was set, by the timings
+   * taken in reinit().
+   */
+  template <typename StreamType>
+  void
+  print_evaluation_kernels(StreamType &out) const;
+
   /**
    * Prints a summary of this class to the given output stream. It is focused
    * on the indices, and does not print all the data stored.
@@ -2170,6 +2354,15 @@ public:
   const Table<3, unsigned int> &
   get_cell_and_face_to_plain_faces() const;
 
+  /**
+   * Return the table that translates a triple of the cell-batch number,
+   * the index of a face within a cell and the index within the cell batch of
+   * vectorization into the neighbor across that face. Only available if
+   * AdditionalData::mapping_update_flags_faces_by_cells is set.
+   */
+  const Table<3, internal::MatrixFreeFunctions::FaceNeighborInfo> &
+  get_cell_and_face_to_neighbor() const;
+
   /**
    * Obtains a scratch data object for internal use. Make sure to release it
    * afterwards by passing the pointer you obtain from this object to the
@@ -2241,6 +2434,14 @@ private:
     const std::vector<IndexSet>                           &locally_owned_set,
     const AdditionalData                                  &additional_data);
 
+  /**
+   * Time the evaluation kernels that are possible for the elements in
+   * shape_info and keep the fastest one, see
+   * AdditionalData::tune_evaluation_kernels.
+   */
+  void
+  tune_evaluation_kernels(const MPI_Comm communicator);
+
   /**
    * Initializes the DoFHandlers based on a DoFHandler<dim> argument.
    */
@@ -2294,6 +2495,15 @@ private:
    */
   Table<4, internal::MatrixFreeFunctions::ShapeInfo<Number>> shape_info;
 
+  /**
+   * The name of the finite element together with the base element index,
+   * and the points and weights of the quadrature formula each entry of
+   * shape_info has been computed from. Used to skip the computation of the
+   * shape information in reinit() if neither the elements nor the
+   * quadrature formulas have changed, e.g. after adaptive mesh refinement.
+   */
+  Table<4, std::pair<std::string, std::vector<double>>> shape_info_keys;
+
   /**
    * Describes how the cells are gone through. With the cell level (first
    * index in this field) and the index within the level, one can reconstruct
@@ -2897,6 +3107,16 @@ MatrixFree<dim, Number, VectorizedArrayType>::get_cell_and_face_to_plain_faces()
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+inline const Table<3, internal::MatrixFreeFunctions::FaceNeighborInfo> &
+MatrixFree<dim, Number, VectorizedArrayType>::get_cell_and_face_to_neighbor()
+  const
+{
+  return face_info.cell_and_face_to_neighbor;
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 inline const Quadrature<dim> &
 MatrixFree<dim, Number, VectorizedArrayType>::get_quadrature(
@@ -3610,6 +3830,37 @@ namespace internal
 
 
 
+    /**
+     * Check whether the communication started by the
+     * update_ghost_values_start() functions for
+     * LinearAlgebra::distributed::Vector has completed on the present
+     * process. This gives the MPI implementation the opportunity to make
+     * progress on the messages during computations. The requests are not
+     * freed by this function, so they must still be passed to the
+     * update_ghost_values_finish() functions. Returns `true` if all requests
+     * have completed, including the case that no communication is in flight
+     * or the vector type does not use the requests of this class.
+     */
+    bool
+    test_ghost_values_progress() const
+    {
+#  ifdef DEAL_II_WITH_MPI
+      for (const std::vector<MPI_Request> &requests_component : requests)
+        for (const MPI_Request &request : requests_component)
+          {
+            int       flag = 0;
+            const int ierr =
+              MPI_Request_get_status(request, &flag, MPI_STATUS_IGNORE);
+            AssertThrowMPI(ierr);
+            if (flag == 0)
+              return false;
+          }
+#  endif
+      return true;
+    }
+
+
+
     /**
      * Start compress for serial vectors
      */
@@ -4813,6 +5064,15 @@ namespace internal
         internal::update_ghost_values_finish(src, src_data_exchanger);
     }
 
+    // Tests for completion of the update ghost values operation
+    virtual bool
+    vector_update_ghosts_test() override
+    {
+      if (!src_and_dst_are_same)
+        return src_data_exchanger.test_ghost_values_progress();
+      return true;
+    }
+
     // Starts the communication for the vector compress operation
     virtual void
     vector_compress_start() override
@@ -25,6 +25,7 @@
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/tensor_product_polynomials.h>
+#include <deal.II/base/utilities.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -40,8 +41,10 @@
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 
 #include <deal.II/matrix_free/constraint_info.h>
+#include <deal.II/matrix_free/evaluation_template_factory.h>
 #include <deal.II/matrix_free/face_info.h>
 #include <deal.II/matrix_free/face_setup_internal.h>
+#include <deal.II/matrix_free/fe_evaluation_data.h>
 #include <deal.II/matrix_free/hanging_nodes_internal.h>
 #include <deal.II/matrix_free/matrix_free.h>
 
@@ -51,7 +54,10 @@
 #  include <tbb/concurrent_unordered_map.h>
 #endif
 
+#include <chrono>
 #include <fstream>
+#include <limits>
+#include <numeric>
 
 //
 // TBB with oneAPI API has deprecated and removed the
@@ -349,6 +355,7 @@ MatrixFree<dim, Number, VectorizedArrayType>::copy_from(
   constraint_pool_row_index  = v.constraint_pool_row_index;
   mapping_info               = v.mapping_info;
   shape_info                 = v.shape_info;
+  shape_info_keys            = v.shape_info_keys;
   cell_level_index           = v.cell_level_index;
   cell_level_index_end_local = v.cell_level_index_end_local;
   task_info                  = v.task_info;
@@ -413,8 +420,13 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
     unsigned int n_quad_in_collection = 0;
     for (unsigned int q = 0; q < n_quad; ++q)
       n_quad_in_collection = std::max(n_quad_in_collection, quad[q].size());
-    shape_info.reinit(TableIndices<4>(
-      n_components, n_quad, n_fe_in_collection, n_quad_in_collection));
+
+    // Identify each entry by the element and the quadrature formula it is
+    // computed from. In case these are the same as in a previous call to
+    // this function, as it is typically the case after adaptive mesh
+    // refinement, the shape information is still valid and kept.
+    Table<4, std::pair<std::string, std::vector<double>>> new_shape_info_keys(
+      n_components, n_quad, n_fe_in_collection, n_quad_in_collection);
     for (unsigned int no = 0, c = 0; no < dof_handler.size(); ++no)
       for (unsigned int b = 0; b < dof_handler[no]->get_fe(0).n_base_elements();
            ++b, ++c)
@@ -423,10 +435,47 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
              ++fe_no)
           for (unsigned int nq = 0; nq < n_quad; ++nq)
             for (unsigned int q_no = 0; q_no < quad[nq].size(); ++q_no)
-              shape_info(c, nq, fe_no, q_no)
-                .reinit(quad[nq][q_no], dof_handler[no]->get_fe(fe_no), b);
+              {
+                auto &key = new_shape_info_keys(c, nq, fe_no, q_no);
+                key.first = dof_handler[no]->get_fe(fe_no).get_name() + "#" +
+                            std::to_string(b);
+                const Quadrature<q_dim> &quadrature = quad[nq][q_no];
+                key.second.reserve(quadrature.size() * (q_dim + 1));
+                for (unsigned int q = 0; q < quadrature.size(); ++q)
+                  {
+                    for (unsigned int d = 0; d < q_dim; ++d)
+                      key.second.push_back(quadrature.point(q)[d]);
+                    key.second.push_back(quadrature.weight(q));
+                  }
+              }
+
+    const bool shape_info_is_valid =
+      shape_info.n_elements() > 0 &&
+      new_shape_info_keys.size() == shape_info_keys.size() &&
+      new_shape_info_keys == shape_info_keys;
+
+    if (!shape_info_is_valid)
+      {
+        shape_info.reinit(TableIndices<4>(
+          n_components, n_quad, n_fe_in_collection, n_quad_in_collection));
+        for (unsigned int no = 0, c = 0; no < dof_handler.size(); ++no)
+          for (unsigned int b = 0;
+               b < dof_handler[no]->get_fe(0).n_base_elements();
+               ++b, ++c)
+            for (unsigned int fe_no = 0;
+                 fe_no < dof_handler[no]->get_fe_collection().size();
+                 ++fe_no)
+              for (unsigned int nq = 0; nq < n_quad; ++nq)
+                for (unsigned int q_no = 0; q_no < quad[nq].size(); ++q_no)
+                  shape_info(c, nq, fe_no, q_no)
+                    .reinit(quad[nq][q_no], dof_handler[no]->get_fe(fe_no), b);
+        shape_info_keys = std::move(new_shape_info_keys);
+      }
   }
 
+  if (additional_data.tune_evaluation_kernels)
+    tune_evaluation_kernels(dof_handler[0]->get_communicator());
+
   // Store pointers to AffineConstraints objects if Number type matches
   affine_constraints.resize(constraints.size());
   for (unsigned int no = 0; no < constraints.size(); ++no)
@@ -441,6 +490,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
 
       task_info.allow_ghosted_vectors_in_loops =
         additional_data.allow_ghosted_vectors_in_loops;
+      task_info.poll_communication_progress =
+        additional_data.poll_communication_progress;
 
       task_info.communicator    = dof_handler[0]->get_communicator();
       task_info.communicator_sm = additional_data.communicator_sm;
@@ -464,6 +515,8 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         {
           dof_info[no].store_plain_indices =
             additional_data.store_plain_indices;
+          dof_info[no].compress_dof_indices =
+            additional_data.compress_dof_indices;
           dof_info[no].global_base_element_offset =
             no > 0 ? dof_info[no - 1].global_base_element_offset +
                        dof_handler[no - 1]->get_fe(0).n_base_elements() :
@@ -844,7 +897,9 @@ MatrixFree<dim, Number, VectorizedArrayType>::internal_reinit(
         additional_data.mapping_update_flags_boundary_faces,
         additional_data.mapping_update_flags_inner_faces,
         additional_data.mapping_update_flags_faces_by_cells,
-        piola_transform);
+        piola_transform,
+        additional_data.cell_geometry_on_the_fly,
+        additional_data.cell_geometry_single_precision);
 
       mapping_is_initialized = true;
     }
@@ -981,6 +1036,42 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_dof_handlers(
         }
     }
 
+  if (additional_data.order_cells_along_hilbert_curve &&
+      cell_level_index.size() > 1)
+    {
+      std::vector<Point<dim>> centers;
+      centers.reserve(cell_level_index.size());
+      for (const auto &index : cell_level_index)
+        centers.push_back(
+          typename Triangulation<dim>::cell_iterator(&tria,
+                                                     index.first,
+                                                     index.second)
+            ->center());
+
+      // Sort the cells by their index along the Hilbert curve. Ties, which
+      // can only appear for cells that are not distinguished by the
+      // resolution of the curve, keep the original z-ordering.
+      const std::vector<std::array<std::uint64_t, dim>> hilbert_indices =
+        Utilities::inverse_Hilbert_space_filling_curve(centers);
+      std::vector<unsigned int> permutation(cell_level_index.size());
+      std::iota(permutation.begin(), permutation.end(), 0U);
+      std::stable_sort(permutation.begin(),
+                       permutation.end(),
+                       [&](const unsigned int a, const unsigned int b) {
+                         return std::lexicographical_compare(
+                           hilbert_indices[a].begin(),
+                           hilbert_indices[a].end(),
+                           hilbert_indices[b].begin(),
+                           hilbert_indices[b].end());
+                       });
+
+      std::vector<std::pair<unsigned int, unsigned int>> sorted_cells;
+      sorted_cells.reserve(cell_level_index.size());
+      for (const unsigned int i : permutation)
+        sorted_cells.push_back(cell_level_index[i]);
+      cell_level_index.swap(sorted_cells);
+    }
+
   // All these are cells local to this processor. Therefore, set
   // cell_level_index_end_local to the size of cell_level_index.
   cell_level_index_end_local = cell_level_index.size();
@@ -2063,6 +2154,66 @@ MatrixFree<dim, Number, VectorizedArrayType>::initialize_indices(
                 types::boundary_id(face_info.faces[f].exterior_face_no);
           }
 
+      // for element-centric loops, precompute the neighbor of each face of
+      // each cell, including the face orientation as seen from that cell,
+      // to avoid looking up the face batch in FEFaceEvaluation::reinit()
+      if (additional_data.mapping_update_flags_faces_by_cells !=
+          update_default)
+        {
+          face_info.cell_and_face_to_neighbor.reinit(
+            TableIndices<3>(task_info.cell_partition_data.back(),
+                            GeometryInfo<dim>::faces_per_cell,
+                            VectorizedArrayType::size()));
+
+          constexpr std::array<std::uint8_t, 8> flip_orientation{
+            {0, 1, 2, 3, 6, 5, 4, 7}};
+          for (unsigned int f = 0;
+               f < task_info.ghost_face_partition_data.back();
+               ++f)
+            for (unsigned int v = 0; v < VectorizedArrayType::size() &&
+                                     face_info.faces[f].cells_interior[v] !=
+                                       numbers::invalid_unsigned_int;
+                 ++v)
+              {
+                const auto &face = face_info.faces[f];
+
+                const bool orientation_interior_face =
+                  face.face_orientation >= 8;
+                const std::uint8_t orientation = face.face_orientation % 8;
+
+                // neighbor of the cell on the interior side, with the same
+                // content as in FaceToCellTopology at the boundary
+                auto &neighbor_of_interior =
+                  face_info.cell_and_face_to_neighbor(
+                    face.cells_interior[v] / VectorizedArrayType::size(),
+                    face.interior_face_no,
+                    face.cells_interior[v] % VectorizedArrayType::size());
+                neighbor_of_interior.cell    = face.cells_exterior[v];
+                neighbor_of_interior.face_no = face.exterior_face_no;
+                neighbor_of_interior.face_orientation =
+                  orientation_interior_face ? flip_orientation[orientation] :
+                                              orientation;
+
+                // neighbor of the cell on the exterior side
+                if (face.cells_exterior[v] != numbers::invalid_unsigned_int &&
+                    face.cells_exterior[v] / VectorizedArrayType::size() <
+                      task_info.cell_partition_data.back())
+                  {
+                    auto &neighbor_of_exterior =
+                      face_info.cell_and_face_to_neighbor(
+                        face.cells_exterior[v] / VectorizedArrayType::size(),
+                        face.exterior_face_no,
+                        face.cells_exterior[v] % VectorizedArrayType::size());
+                    neighbor_of_exterior.cell    = face.cells_interior[v];
+                    neighbor_of_exterior.face_no = face.interior_face_no;
+                    neighbor_of_exterior.face_orientation =
+                      orientation_interior_face ?
+                        orientation :
+                        flip_orientation[orientation];
+                  }
+              }
+        }
+
       // compute tighter index sets for various sets of face integrals
       unsigned int count = 0;
       for (auto &di : dof_info)
@@ -2378,6 +2529,178 @@ MatrixFree<dim, Number, VectorizedArrayType>::print_memory_consumption(
 
 
 
+template <int dim, typename Number, typename VectorizedArrayType>
+template <typename StreamType>
+void
+MatrixFree<dim, Number, VectorizedArrayType>::print_evaluation_kernels(
+  StreamType &out) const
+{
+  using ShapeInfoType = internal::MatrixFreeFunctions::ShapeInfo<Number>;
+  using ElementType   = internal::MatrixFreeFunctions::ElementType;
+
+  const auto kernel_name = [](const ShapeInfoType &info) -> std::string {
+    const unsigned int fe_degree     = info.data.front().fe_degree;
+    const unsigned int n_q_points_1d = info.data.front().n_q_points_1d;
+    if (info.element_type <= ElementType::tensor_symmetric_plus_dg0 &&
+        !internal::FEEvaluationFactory<dim, VectorizedArrayType>::
+          fast_evaluation_supported(fe_degree, n_q_points_1d))
+      return "general sum factorization with run-time loop bounds";
+
+    switch (info.element_type)
+      {
+        case ElementType::tensor_symmetric_collocation:
+          return "collocation";
+        case ElementType::tensor_symmetric_hermite:
+        case ElementType::tensor_symmetric:
+          if (info.use_collocation_transformation)
+            return "transformation to collocation space";
+          else
+            return fe_degree + n_q_points_1d > 4 ?
+                     "even-odd sum factorization" :
+                     "symmetric sum factorization";
+        case ElementType::tensor_symmetric_no_collocation:
+          return "even-odd sum factorization";
+        case ElementType::tensor_general:
+          return "general sum factorization";
+        case ElementType::truncated_tensor:
+          return "sum factorization on truncated tensor product";
+        case ElementType::tensor_symmetric_plus_dg0:
+          return "sum factorization with additional constant";
+        case ElementType::tensor_raviart_thomas:
+          return "anisotropic sum factorization";
+        case ElementType::tensor_none:
+          return "full interpolation matrices";
+        default:
+          return "unknown";
+      }
+  };
+
+  out << "  Evaluation kernels on cells:" << std::endl;
+  for (unsigned int no = 0; no < dof_info.size(); ++no)
+    for (unsigned int b = 0;
+         b < dof_handlers[no]->get_fe(0).n_base_elements();
+         ++b)
+      for (unsigned int fe_no = 0; fe_no < shape_info.size(2); ++fe_no)
+        for (unsigned int nq = 0; nq < shape_info.size(1); ++nq)
+          for (unsigned int q_no = 0; q_no < shape_info.size(3); ++q_no)
+            {
+              const ShapeInfoType &info =
+                shape_info(dof_info[no].global_base_element_offset + b,
+                           nq,
+                           fe_no,
+                           q_no);
+              if (info.data.empty())
+                continue;
+
+              out << "   DoFHandler " << no << ", base element " << b;
+              if (shape_info.size(2) > 1)
+                out << ", active FE index " << fe_no;
+              out << ", quadrature " << nq;
+              if (shape_info.size(3) > 1)
+                out << ", active quadrature index " << q_no;
+              out << ": degree " << info.data.front().fe_degree << ", "
+                  << info.data.front().n_q_points_1d << " points in 1d, "
+                  << kernel_name(info) << std::endl;
+            }
+}
+
+
+
+template <int dim, typename Number, typename VectorizedArrayType>
+void
+MatrixFree<dim, Number, VectorizedArrayType>::tune_evaluation_kernels(
+  const MPI_Comm communicator)
+{
+  using ShapeInfoType = internal::MatrixFreeFunctions::ShapeInfo<Number>;
+  using ElementType   = internal::MatrixFreeFunctions::ElementType;
+
+  // Collect the elements for which both the plain sum-factorization kernels
+  // and the transformation to the collocation space are available in
+  // FEEvaluationImplSelector. As the shape information is the same on all
+  // processes, the list is the same on all processes, too.
+  std::vector<ShapeInfoType *> candidates;
+  for (unsigned int c = 0; c < shape_info.size(0); ++c)
+    for (unsigned int nq = 0; nq < shape_info.size(1); ++nq)
+      for (unsigned int fe_no = 0; fe_no < shape_info.size(2); ++fe_no)
+        for (unsigned int q_no = 0; q_no < shape_info.size(3); ++q_no)
+          {
+            ShapeInfoType &info = shape_info(c, nq, fe_no, q_no);
+            if (info.element_type != ElementType::tensor_symmetric &&
+                info.element_type != ElementType::tensor_symmetric_hermite)
+              continue;
+
+            const unsigned int fe_degree     = info.data.front().fe_degree;
+            const unsigned int n_q_points_1d = info.data.front().n_q_points_1d;
+            if (n_q_points_1d > fe_degree && n_q_points_1d < 200 &&
+                internal::FEEvaluationFactory<dim, VectorizedArrayType>::
+                  fast_evaluation_supported(fe_degree, n_q_points_1d))
+              candidates.push_back(&info);
+          }
+
+  if (candidates.empty())
+    return;
+
+  // Time the evaluation and integration of values and gradients, i.e., the
+  // typical operations of a Laplace-type operator, for both variants. The
+  // number of repetitions is calibrated such that a single measurement takes
+  // roughly a millisecond, and the best of several measurements is used.
+  std::vector<double> timings(2 * candidates.size());
+  AlignedVector<VectorizedArrayType> scratch_data;
+  AlignedVector<VectorizedArrayType> dof_values;
+  const EvaluationFlags::EvaluationFlags flags =
+    EvaluationFlags::values | EvaluationFlags::gradients;
+  for (unsigned int i = 0; i < candidates.size(); ++i)
+    {
+      ShapeInfoType &info = *candidates[i];
+
+      FEEvaluationData<dim, VectorizedArrayType, false> eval(info);
+      eval.set_data_pointers(&scratch_data, 1);
+      dof_values.resize(info.dofs_per_component_on_cell);
+      for (unsigned int j = 0; j < dof_values.size(); ++j)
+        dof_values[j] = Number(1) / Number(j + 1);
+
+      const auto run = [&](const unsigned int n_repetitions) {
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int r = 0; r < n_repetitions; ++r)
+          {
+            internal::FEEvaluationFactory<dim, VectorizedArrayType>::evaluate(
+              1, flags, dof_values.data(), eval);
+            internal::FEEvaluationFactory<dim, VectorizedArrayType>::
+              integrate(1, flags, eval.begin_dof_values(), eval, false);
+          }
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                             start)
+          .count();
+      };
+
+      const bool default_choice = info.use_collocation_transformation;
+
+      unsigned int n_repetitions = 8;
+      while (run(n_repetitions) < 1e-3 && n_repetitions < (1U << 24))
+        n_repetitions *= 2;
+
+      for (unsigned int variant = 0; variant < 2; ++variant)
+        {
+          info.use_collocation_transformation = (variant == 1);
+          double best_time = std::numeric_limits<double>::max();
+          for (unsigned int trial = 0; trial < 3; ++trial)
+            best_time = std::min(best_time, run(n_repetitions));
+          timings[2 * i + variant] = best_time / n_repetitions;
+        }
+
+      info.use_collocation_transformation = default_choice;
+    }
+
+  // Make all processes select the same variant.
+  Utilities::MPI::max(timings, communicator, timings);
+
+  for (unsigned int i = 0; i < candidates.size(); ++i)
+    candidates[i]->use_collocation_transformation =
+      timings[2 * i + 1] < timings[2 * i];
+}
+
+
+
 template <int dim, typename Number, typename VectorizedArrayType>
 void
 MatrixFree<dim, Number, VectorizedArrayType>::print(std::ostream &out) const
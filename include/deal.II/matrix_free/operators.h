@@ -24,6 +24,7 @@
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 #include <deal.II/matrix_free/fe_evaluation.h>
@@ -32,6 +33,8 @@
 
 #include <deal.II/multigrid/mg_constrained_dofs.h>
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 
 DEAL_II_NAMESPACE_OPEN
@@ -305,12 +308,57 @@ namespace MatrixFreeOperators
     void
     vmult_interface_up(VectorType &dst, const VectorType &src) const;
 
+    /**
+     * Enable or disable the reuse of the level matrix-vector product in
+     * vmult_interface_down(). If enabled, vmult() and vmult_add() keep the
+     * values they compute in the rows of the refinement edge DoFs, which
+     * are the values vmult_interface_down() computes by another loop over
+     * the cells, and the next call to vmult_interface_down() with the same
+     * source vector returns them instead. This matches the computation of
+     * the residual with edge matrices in Multigrid, where the level matrix
+     * and the interface matrix are applied to the same vector one after the
+     * other.
+     *
+     * @note The source vector must not be modified between the two calls,
+     * which is why this is disabled by default.
+     */
+    void
+    set_interface_values_caching(const bool enable);
+
     /**
      * Matrix-vector multiplication.
      */
     void
     vmult(VectorType &dst, const VectorType &src) const;
 
+    /**
+     * Matrix-vector multiplication that runs
+     * @p operation_before_matrix_vector_product on a range of the locally
+     * owned entries of @p dst before the operator touches them for the first
+     * time, and @p operation_after_matrix_vector_product on a range once the
+     * result of the multiplication, including the contributions of the
+     * constrained entries, is final there. The ranges are passed as
+     * `[first, last)` in MPI-local numbering, as in MatrixFree::cell_loop().
+     * The entries of @p dst need to be set to zero by
+     * @p operation_before_matrix_vector_product.
+     *
+     * This interface allows to merge vector updates into the loop of the
+     * operator, which is used by PreconditionChebyshev to apply its vector
+     * updates while the data is still in cache. Derived classes that
+     * implement apply_add() by a MatrixFree::cell_loop() can override
+     * apply_add_with_operations() to make use of this; otherwise, the
+     * operations run on the whole range before and after apply_add().
+     *
+     * @note This function is only implemented for non-block vectors.
+     */
+    void
+    vmult(VectorType       &dst,
+          const VectorType &src,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_before_matrix_vector_product,
+          const std::function<void(const unsigned int, const unsigned int)>
+            &operation_after_matrix_vector_product) const;
+
     /**
      * Transpose matrix-vector multiplication.
      */
@@ -420,6 +468,26 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const = 0;
 
+    /**
+     * Apply operator to @p src and add result in @p dst, running
+     * @p operation_before_loop and @p operation_after_loop on ranges of the
+     * locally owned entries as described in MatrixFree::cell_loop().
+     *
+     * The default implementation runs @p operation_before_loop on the whole
+     * locally owned range, calls apply_add(), and then runs
+     * @p operation_after_loop on the whole range. Derived classes that
+     * perform a MatrixFree::cell_loop() in apply_add() should pass the two
+     * functions on to the loop.
+     */
+    virtual void
+    apply_add_with_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const;
+
     /**
      * Apply transpose operator to @p src and add result in @p dst.
      *
@@ -476,6 +544,29 @@ namespace MatrixFreeOperators
      */
     bool have_interface_matrices;
 
+    /**
+     * A flag which determines whether vmult() keeps the values needed by
+     * vmult_interface_down(), see set_interface_values_caching().
+     */
+    bool interface_values_caching;
+
+    /**
+     * The values of the last vmult() or vmult_add() in the rows of the
+     * refinement edge DoFs if interface_values_caching is set.
+     */
+    mutable std::vector<std::vector<value_type>> interface_down_values;
+
+    /**
+     * The source vector of the product stored in interface_down_values, or
+     * nullptr if there is no such product.
+     */
+    mutable const VectorType *interface_down_source;
+
+    /**
+     * Auxiliary vector for vmult_interface_up().
+     */
+    mutable VectorType interface_up_source;
+
     /**
      * %Function which implements vmult_add (@p transpose = false) and
      * Tvmult_add (@p transpose = true).
@@ -824,6 +915,19 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Same as apply_add(), but running @p operation_before_loop and
+     * @p operation_after_loop within the loop over cells.
+     */
+    virtual void
+    apply_add_with_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const override;
+
     /**
      * For this operator, there is just a cell contribution.
      */
@@ -974,6 +1078,19 @@ namespace MatrixFreeOperators
     virtual void
     apply_add(VectorType &dst, const VectorType &src) const override;
 
+    /**
+     * Same as apply_add(), but running @p operation_before_loop and
+     * @p operation_after_loop within the loop over cells.
+     */
+    virtual void
+    apply_add_with_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const override;
+
     /**
      * Applies the Laplace operator on a cell.
      */
@@ -1015,6 +1132,151 @@ namespace MatrixFreeOperators
 
 
 
+  /**
+   * Block upper-triangular preconditioner for saddle point problems of the
+   * form
+   * @f[
+   *   \begin{pmatrix} A & B^T \\ B & C \end{pmatrix}
+   *   \begin{pmatrix} u \\ p \end{pmatrix} =
+   *   \begin{pmatrix} f \\ g \end{pmatrix},
+   * @f]
+   * e.g., the Stokes equations with velocity $u$ and pressure $p$, for
+   * operators evaluated with MatrixFree. The preconditioner applies
+   * @f[
+   *   \begin{pmatrix} A & B^T \\ 0 & -S \end{pmatrix}^{-1}
+   *   \begin{pmatrix} r_u \\ r_p \end{pmatrix},
+   *   \quad\text{i.e.,}\quad
+   *   y_p = -\tilde S^{-1} r_p, \quad
+   *   y_u = \tilde A^{-1} (r_u - B^T y_p),
+   * @f]
+   * where $\tilde A^{-1}$ and $\tilde S^{-1}$ are approximations of the
+   * inverses of $A$ and of the Schur complement $S$ provided by the user,
+   * e.g., a multigrid cycle and the inverse of the pressure mass matrix.
+   * The sign of $-\tilde S^{-1}$ is part of the function supplied by the
+   * user.
+   *
+   * Compared to a composition of LinearOperator objects, e.g., with
+   * block_back_substitution(), this class evaluates $B^T y_p$ with a
+   * single MatrixFree::cell_loop() and merges the vector updates into it:
+   * the subtraction from $r_u$ runs in the `operation_after_loop` of the
+   * cell loop while the entries are still in caches, and, if $\tilde
+   * A^{-1}$ is given as a diagonal matrix (e.g. the inverse of a lumped
+   * mass matrix or point Jacobi), its application as well. The only
+   * temporary vector is allocated once and kept by this object, so that no
+   * memory pool is involved in vmult().
+   *
+   * The block vectors passed to vmult() contain the velocity in block 0
+   * and the pressure in block 1, with the layout of the vectors
+   * initialized by MatrixFree::initialize_dof_vector() for the respective
+   * DoFHandler objects.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType = VectorizedArray<Number>>
+  class BlockTriangularPreconditioner : public Subscriptor
+  {
+  public:
+    /**
+     * Vector type of the individual blocks.
+     */
+    using VectorType = LinearAlgebra::distributed::Vector<Number>;
+
+    /**
+     * Block vector type this preconditioner acts on.
+     */
+    using BlockVectorType = LinearAlgebra::distributed::BlockVector<Number>;
+
+    /**
+     * Type of the cell operation that adds the contribution of a range of
+     * cells to $B^T y_p$, i.e., reads the pressure vector and writes to the
+     * velocity vector.
+     */
+    using CouplingOperation =
+      std::function<void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+                         VectorType &,
+                         const VectorType &,
+                         const std::pair<unsigned int, unsigned int> &)>;
+
+    /**
+     * Type of the functions applying the approximate inverses of the
+     * diagonal blocks, with the destination as first argument.
+     */
+    using InverseOperation =
+      std::function<void(VectorType &, const VectorType &)>;
+
+    /**
+     * Set up the preconditioner with a general approximation
+     * @p inverse_a of the inverse of the velocity block.
+     *
+     * @p dof_index_velocity is the index of the DoFHandler of the velocity
+     * within @p matrix_free.
+     */
+    void
+    initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+               const CouplingOperation &coupling_operation,
+               const InverseOperation  &inverse_schur_complement,
+               const InverseOperation  &inverse_a,
+               const unsigned int       dof_index_velocity = 0);
+
+    /**
+     * Set up the preconditioner with a diagonal approximation
+     * @p inverse_diagonal_a of the inverse of the velocity block, which is
+     * applied inside the cell loop. The object must live as long as this
+     * preconditioner.
+     */
+    void
+    initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+               const CouplingOperation          &coupling_operation,
+               const InverseOperation           &inverse_schur_complement,
+               const DiagonalMatrix<VectorType> &inverse_diagonal_a,
+               const unsigned int                dof_index_velocity = 0);
+
+    /**
+     * Apply the preconditioner.
+     */
+    void
+    vmult(BlockVectorType &dst, const BlockVectorType &src) const;
+
+  private:
+    /**
+     * The underlying MatrixFree object.
+     */
+    SmartPointer<const MatrixFree<dim, Number, VectorizedArrayType>>
+      matrix_free;
+
+    /**
+     * Cell operation for the coupling block $B^T$.
+     */
+    CouplingOperation coupling_operation;
+
+    /**
+     * Approximate inverse of the Schur complement, including the sign.
+     */
+    InverseOperation inverse_schur_complement;
+
+    /**
+     * General approximate inverse of the velocity block, if given.
+     */
+    InverseOperation inverse_a;
+
+    /**
+     * Diagonal approximate inverse of the velocity block, if given.
+     */
+    SmartPointer<const DiagonalMatrix<VectorType>> inverse_diagonal_a;
+
+    /**
+     * Index of the DoFHandler of the velocity within #matrix_free.
+     */
+    unsigned int dof_index_velocity;
+
+    /**
+     * Temporary velocity vector, kept across calls to vmult().
+     */
+    mutable VectorType tmp_velocity;
+  };
+
+
+
   // ------------------------------------ inline functions ---------------------
 
   template <int dim,
@@ -1217,6 +1479,8 @@ namespace MatrixFreeOperators
   Base<dim, VectorType, VectorizedArrayType>::Base()
     : Subscriptor()
     , have_interface_matrices(false)
+    , interface_values_caching(false)
+    , interface_down_source(nullptr)
   {}
 
 
@@ -1255,6 +1519,7 @@ namespace MatrixFreeOperators
   {
     data.reset();
     inverse_diagonal_entries.reset();
+    interface_down_source = nullptr;
   }
 
 
@@ -1348,6 +1613,7 @@ namespace MatrixFreeOperators
     edge_constrained_values.clear();
     edge_constrained_values.resize(selected_rows.size());
     have_interface_matrices = false;
+    interface_down_source   = nullptr;
   }
 
 
@@ -1405,6 +1671,7 @@ namespace MatrixFreeOperators
     edge_constrained_indices.resize(selected_rows.size());
     edge_constrained_values.clear();
     edge_constrained_values.resize(selected_rows.size());
+    interface_down_source = nullptr;
 
     data = data_;
 
@@ -1470,6 +1737,97 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::vmult(
+    VectorType       &dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_matrix_vector_product,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_matrix_vector_product) const
+  {
+    if constexpr (IsBlockVector<VectorType>::value)
+      {
+        (void)dst;
+        (void)src;
+        (void)operation_before_matrix_vector_product;
+        (void)operation_after_matrix_vector_product;
+        AssertThrow(false, ExcNotImplemented());
+      }
+    else
+      {
+        AssertDimension(dst.size(), src.size());
+        AssertDimension(selected_rows.size(), 1);
+        preprocess_constraints(dst, src);
+        interface_down_source = nullptr;
+
+        // the entries of dst are only zeroed by the operation before the
+        // loop, so the values remembered for the edge constrained entries
+        // are the ones of vmult(), i.e., zero
+        for (auto &values : edge_constrained_values[0])
+          values.second = 0.;
+
+        // The constrained entries are ordered by their index as long as the
+        // constraints were closed. In that case, the constraints can be
+        // applied on the ranges passed to the operation after the loop, which
+        // then sees the final result. Otherwise, we need to apply them after
+        // the loop on the whole vector.
+        const std::vector<unsigned int> &constrained_dofs =
+          data->get_constrained_dofs(selected_rows[0]);
+        const std::vector<unsigned int> &edge_indices =
+          edge_constrained_indices[0];
+        const bool constraints_by_range =
+          std::is_sorted(constrained_dofs.begin(), constrained_dofs.end()) &&
+          std::is_sorted(edge_indices.begin(), edge_indices.end());
+
+        const auto postprocess_constraints_on_range =
+          [&](const unsigned int begin, const unsigned int end) {
+            for (auto dof = std::lower_bound(constrained_dofs.begin(),
+                                             constrained_dofs.end(),
+                                             begin);
+                 dof != constrained_dofs.end() && *dof < end;
+                 ++dof)
+              dst.local_element(*dof) += src.local_element(*dof);
+
+            for (auto index = std::lower_bound(edge_indices.begin(),
+                                               edge_indices.end(),
+                                               begin);
+                 index != edge_indices.end() && *index < end;
+                 ++index)
+              {
+                const value_type value =
+                  edge_constrained_values[0][index - edge_indices.begin()]
+                    .first;
+                const_cast<VectorType &>(src).local_element(*index) = value;
+                dst.local_element(*index)                           = value;
+              }
+          };
+
+        if (constraints_by_range)
+          apply_add_with_operations(
+            dst,
+            src,
+            operation_before_matrix_vector_product,
+            [&](const unsigned int begin, const unsigned int end) {
+              postprocess_constraints_on_range(begin, end);
+              operation_after_matrix_vector_product(begin, end);
+            });
+        else
+          {
+            apply_add_with_operations(
+              dst,
+              src,
+              operation_before_matrix_vector_product,
+              [](const unsigned int, const unsigned int) {});
+            postprocess_constraints(dst, src);
+            operation_after_matrix_vector_product(0, dst.locally_owned_size());
+          }
+      }
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::vmult_add(
@@ -1579,6 +1937,27 @@ namespace MatrixFreeOperators
       Tapply_add(dst, src);
     else
       apply_add(dst, src);
+
+    // keep the product in the rows of the edge constrained entries, which is
+    // what vmult_interface_down() computes for the same source vector
+    interface_down_source = nullptr;
+    if (transpose == false && interface_values_caching &&
+        have_interface_matrices)
+      {
+        interface_down_values.resize(BlockHelper::n_blocks(dst));
+        for (unsigned int j = 0; j < BlockHelper::n_blocks(dst); ++j)
+          {
+            interface_down_values[j].resize(edge_constrained_indices[j].size());
+            for (unsigned int i = 0; i < edge_constrained_indices[j].size();
+                 ++i)
+              interface_down_values[j][i] =
+                BlockHelper::subblock(dst, j).local_element(
+                  edge_constrained_indices[j][i]) -
+                edge_constrained_values[j][i].second;
+          }
+        interface_down_source = &src;
+      }
+
     postprocess_constraints(dst, src);
   }
 
@@ -1635,6 +2014,17 @@ namespace MatrixFreeOperators
     if (!have_interface_matrices)
       return;
 
+    // reuse the product of the last vmult() on the same vector if available
+    if (interface_down_source == &src)
+      {
+        for (unsigned int j = 0; j < BlockHelper::n_blocks(dst); ++j)
+          for (unsigned int i = 0; i < edge_constrained_indices[j].size(); ++i)
+            BlockHelper::subblock(dst, j).local_element(
+              edge_constrained_indices[j][i]) = interface_down_values[j][i];
+        interface_down_source = nullptr;
+        return;
+      }
+
     // set zero Dirichlet values on the input vector (and remember the src and
     // dst values because we need to reset them at the end)
     for (unsigned int j = 0; j < BlockHelper::n_blocks(dst); ++j)
@@ -1689,21 +2079,17 @@ namespace MatrixFreeOperators
     if (!have_interface_matrices)
       return;
 
-    VectorType src_cpy(src);
+    // only the edge constrained entries of the source vector are needed,
+    // so zero a vector with the layout of src and copy them over rather than
+    // copying the whole vector; the vector keeps its memory between calls
+    interface_down_source = nullptr;
+    interface_up_source.reinit(src, false);
     for (unsigned int j = 0; j < BlockHelper::n_blocks(dst); ++j)
-      {
-        unsigned int c = 0;
-        for (unsigned int i = 0; i < edge_constrained_indices[j].size(); ++i)
-          {
-            for (; c < edge_constrained_indices[j][i]; ++c)
-              BlockHelper::subblock(src_cpy, j).local_element(c) = 0.;
-            ++c;
-          }
-        for (; c < BlockHelper::subblock(src_cpy, j).locally_owned_size(); ++c)
-          BlockHelper::subblock(src_cpy, j).local_element(c) = 0.;
-      }
+      for (const unsigned int index : edge_constrained_indices[j])
+        BlockHelper::subblock(interface_up_source, j).local_element(index) =
+          BlockHelper::subblock(src, j).local_element(index);
 
-    apply_add(dst, src_cpy);
+    apply_add(dst, interface_up_source);
 
     for (unsigned int j = 0; j < BlockHelper::n_blocks(dst); ++j)
       for (unsigned int i = 0; i < edge_constrained_indices[j].size(); ++i)
@@ -1713,6 +2099,17 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::set_interface_values_caching(
+    const bool enable)
+  {
+    interface_values_caching = enable;
+    interface_down_source    = nullptr;
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::Tvmult(
@@ -1785,6 +2182,23 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim, typename VectorType, typename VectorizedArrayType>
+  void
+  Base<dim, VectorType, VectorizedArrayType>::apply_add_with_operations(
+    VectorType       &dst,
+    const VectorType &src,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_before_loop,
+    const std::function<void(const unsigned int, const unsigned int)>
+      &operation_after_loop) const
+  {
+    operation_before_loop(0, dst.locally_owned_size());
+    apply_add(dst, src);
+    operation_after_loop(0, dst.locally_owned_size());
+  }
+
+
+
   template <int dim, typename VectorType, typename VectorizedArrayType>
   void
   Base<dim, VectorType, VectorizedArrayType>::precondition_Jacobi(
@@ -2112,6 +2526,39 @@ namespace MatrixFreeOperators
 
 
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  MassOperator<dim,
+               fe_degree,
+               n_q_points_1d,
+               n_components,
+               VectorType,
+               VectorizedArrayType>::
+    apply_add_with_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &MassOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
+
+
   template <int dim,
             int fe_degree,
             int n_q_points_1d,
@@ -2305,6 +2752,39 @@ namespace MatrixFreeOperators
       &LaplaceOperator::local_apply_cell, this, dst, src);
   }
 
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename VectorType,
+            typename VectorizedArrayType>
+  void
+  LaplaceOperator<dim,
+                  fe_degree,
+                  n_q_points_1d,
+                  n_components,
+                  VectorType,
+                  VectorizedArrayType>::
+    apply_add_with_operations(
+      VectorType       &dst,
+      const VectorType &src,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_before_loop,
+      const std::function<void(const unsigned int, const unsigned int)>
+        &operation_after_loop) const
+  {
+    Base<dim, VectorType, VectorizedArrayType>::data->cell_loop(
+      &LaplaceOperator::local_apply_cell,
+      this,
+      dst,
+      src,
+      operation_before_loop,
+      operation_after_loop,
+      this->selected_rows[0]);
+  }
+
   namespace Implementation
   {
     template <typename VectorizedArrayType>
@@ -2492,6 +2972,106 @@ namespace MatrixFreeOperators
   }
 
 
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  BlockTriangularPreconditioner<dim, Number, VectorizedArrayType>::initialize(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const CouplingOperation                            &coupling_operation,
+    const InverseOperation &inverse_schur_complement,
+    const InverseOperation &inverse_a,
+    const unsigned int      dof_index_velocity)
+  {
+    this->matrix_free              = &matrix_free;
+    this->coupling_operation       = coupling_operation;
+    this->inverse_schur_complement = inverse_schur_complement;
+    this->inverse_a                = inverse_a;
+    this->inverse_diagonal_a       = nullptr;
+    this->dof_index_velocity       = dof_index_velocity;
+    matrix_free.initialize_dof_vector(tmp_velocity, dof_index_velocity);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  BlockTriangularPreconditioner<dim, Number, VectorizedArrayType>::initialize(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const CouplingOperation                            &coupling_operation,
+    const InverseOperation           &inverse_schur_complement,
+    const DiagonalMatrix<VectorType> &inverse_diagonal_a,
+    const unsigned int                dof_index_velocity)
+  {
+    this->matrix_free              = &matrix_free;
+    this->coupling_operation       = coupling_operation;
+    this->inverse_schur_complement = inverse_schur_complement;
+    this->inverse_a                = InverseOperation();
+    this->inverse_diagonal_a       = &inverse_diagonal_a;
+    this->dof_index_velocity       = dof_index_velocity;
+    matrix_free.initialize_dof_vector(tmp_velocity, dof_index_velocity);
+  }
+
+
+
+  template <int dim, typename Number, typename VectorizedArrayType>
+  void
+  BlockTriangularPreconditioner<dim, Number, VectorizedArrayType>::vmult(
+    BlockVectorType       &dst,
+    const BlockVectorType &src) const
+  {
+    Assert(matrix_free != nullptr, ExcNotInitialized());
+    AssertDimension(dst.n_blocks(), 2);
+    AssertDimension(src.n_blocks(), 2);
+
+    // pressure block
+    inverse_schur_complement(dst.block(1), src.block(1));
+
+    // velocity block, evaluating B^T y_p and merging the remaining vector
+    // operations into the cell loop
+    const VectorType &src_u = src.block(0);
+    VectorType       &dst_u = dst.block(0);
+    const auto        zero_tmp = [&](const unsigned int start_range,
+                              const unsigned int end_range) {
+      DEAL_II_OPENMP_SIMD_PRAGMA
+      for (unsigned int i = start_range; i < end_range; ++i)
+        tmp_velocity.local_element(i) = Number();
+    };
+
+    if (inverse_diagonal_a != nullptr)
+      {
+        const VectorType &diagonal = inverse_diagonal_a->get_vector();
+        matrix_free->template cell_loop<VectorType, VectorType>(
+          coupling_operation,
+          tmp_velocity,
+          dst.block(1),
+          zero_tmp,
+          [&](const unsigned int start_range, const unsigned int end_range) {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              dst_u.local_element(i) =
+                diagonal.local_element(i) *
+                (src_u.local_element(i) - tmp_velocity.local_element(i));
+          },
+          dof_index_velocity);
+      }
+    else
+      {
+        matrix_free->template cell_loop<VectorType, VectorType>(
+          coupling_operation,
+          tmp_velocity,
+          dst.block(1),
+          zero_tmp,
+          [&](const unsigned int start_range, const unsigned int end_range) {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              tmp_velocity.local_element(i) =
+                src_u.local_element(i) - tmp_velocity.local_element(i);
+          },
+          dof_index_velocity);
+        inverse_a(dst_u, tmp_velocity);
+      }
+  }
+
+
 } // end of namespace MatrixFreeOperators
 
 
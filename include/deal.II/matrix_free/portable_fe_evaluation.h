@@ -581,6 +581,931 @@ namespace Portable
   }
 
 
+  /**
+   * This class provides the functions necessary to evaluate functions at the
+   * quadrature points of a face and to perform face integrations on the
+   * @ref GlossDevice "device", as needed for discontinuous Galerkin methods.
+   * In functionality, this class is similar to dealii::FEFaceEvaluation. It
+   * is used within the face operations passed to Portable::MatrixFree::loop().
+   *
+   * On interior faces, two objects of this class are typically created, one
+   * for the cell on the interior side of the face and one for the cell on
+   * the exterior side, which are selected by the last argument of the
+   * constructor. The two objects see the same quadrature points, but each
+   * one the normal vector pointing out of its own cell.
+   *
+   * The values of the shape functions on the face are obtained by first
+   * interpolating the cell values in the direction normal to the face, along
+   * with the normal derivative, and then applying the sum factorization
+   * kernels of dimension `dim-1` in the directions tangential to the face.
+   *
+   * The template arguments have the same meaning as for
+   * Portable::FEEvaluation.
+   *
+   * @ingroup Portable
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d = fe_degree + 1,
+            int n_components_ = 1,
+            typename Number   = double>
+  class FEFaceEvaluation
+  {
+  public:
+    /**
+     * An alias for scalar quantities.
+     */
+    using value_type = Number;
+
+    /**
+     * An alias for vectorial quantities.
+     */
+    using gradient_type = Tensor<1, dim, Number>;
+
+    /**
+     * An alias to kernel specific information.
+     */
+    using data_type = typename MatrixFree<dim, Number>::FaceData;
+
+    /**
+     * Dimension.
+     */
+    static constexpr unsigned int dimension = dim;
+
+    /**
+     * Number of components.
+     */
+    static constexpr unsigned int n_components = n_components_;
+
+    /**
+     * Number of quadrature points per face.
+     */
+    static constexpr unsigned int n_q_points =
+      Utilities::pow(n_q_points_1d, dim - 1);
+
+    /**
+     * Number of tensor degrees of freedoms per cell.
+     */
+    static constexpr unsigned int tensor_dofs_per_cell =
+      Utilities::pow(fe_degree + 1, dim);
+
+    /**
+     * Constructor. The argument @p shdata is the pointer to the two
+     * SharedData objects passed to the face operation by
+     * Portable::MatrixFree::loop(). The argument @p is_interior_face selects
+     * the cell on the interior or the exterior side of the face.
+     */
+    DEAL_II_HOST_DEVICE
+    FEFaceEvaluation(const data_type         *data,
+                     SharedData<dim, Number> *shdata,
+                     const bool               is_interior_face = true);
+
+    /**
+     * For the vector @p src, read out the values on the degrees of freedom of
+     * the cell adjacent to the current face, and store them internally.
+     */
+    DEAL_II_HOST_DEVICE void
+    read_dof_values(const Number *src);
+
+    /**
+     * Take the value stored internally on dof values of the cell adjacent to
+     * the current face and sum them into the vector @p dst. Since
+     * neighboring faces are processed concurrently, this function always uses
+     * atomic operations.
+     */
+    DEAL_II_HOST_DEVICE void
+    distribute_local_to_global(Number *dst) const;
+
+    /**
+     * Evaluate the function values and the gradients of the FE function given
+     * at the DoF values of the cell at the quadrature points of the face.
+     */
+    DEAL_II_HOST_DEVICE void
+    evaluate(const EvaluationFlags::EvaluationFlags evaluate_flag);
+
+    /**
+     * This function takes the values and/or gradients that are stored on
+     * the quadrature points of the face, tests them by all the basis
+     * functions/gradients of the cell and performs the face integration.
+     */
+    DEAL_II_HOST_DEVICE void
+    integrate(const EvaluationFlags::EvaluationFlags integration_flag);
+
+    /**
+     * Return the value at the quadrature point with index @p q_point.
+     */
+    DEAL_II_HOST_DEVICE value_type
+    get_value(int q_point) const;
+
+    /**
+     * Return the value of the local degree of freedom with index @p dof.
+     */
+    DEAL_II_HOST_DEVICE value_type
+    get_dof_value(int dof) const;
+
+    /**
+     * Write a value to the field containing the values on the quadrature
+     * point with index @p q_point, multiplied by the surface element times
+     * the quadrature weight.
+     */
+    DEAL_II_HOST_DEVICE void
+    submit_value(const value_type &val_in, int q_point);
+
+    /**
+     * Write a value to the field containing the degrees of freedom with index
+     * @p dof.
+     */
+    DEAL_II_HOST_DEVICE void
+    submit_dof_value(const value_type &val_in, int dof);
+
+    /**
+     * Return the gradient at the quadrature point with index @p q_point.
+     */
+    DEAL_II_HOST_DEVICE gradient_type
+    get_gradient(int q_point) const;
+
+    /**
+     * Write a gradient to the field containing the gradients on the
+     * quadrature point with index @p q_point, multiplied by the surface
+     * element times the quadrature weight.
+     */
+    DEAL_II_HOST_DEVICE void
+    submit_gradient(const gradient_type &grad_in, int q_point);
+
+    /**
+     * Return the derivative in the direction of get_normal_vector() at the
+     * quadrature point with index @p q_point.
+     */
+    DEAL_II_HOST_DEVICE value_type
+    get_normal_derivative(int q_point) const;
+
+    /**
+     * Submit the normal derivative at the quadrature point with index
+     * @p q_point, i.e., a gradient in the direction of get_normal_vector().
+     * This function overwrites the data set by submit_gradient().
+     */
+    DEAL_II_HOST_DEVICE void
+    submit_normal_derivative(const value_type &val_in, int q_point);
+
+    /**
+     * Return the unit normal vector at the quadrature point with index
+     * @p q_point, pointing out of the cell selected in the constructor.
+     */
+    DEAL_II_HOST_DEVICE gradient_type
+    get_normal_vector(int q_point) const;
+
+    /**
+     * Return the boundary id of the current face. Only valid for faces at
+     * the boundary of the domain.
+     */
+    DEAL_II_HOST_DEVICE types::boundary_id
+    boundary_id() const;
+
+    // clang-format off
+    /**
+     * Apply the functor @p func on every quadrature point of the face.
+     *
+     * @p func needs to define
+     * \code
+     * DEAL_II_HOST_DEVICE void operator()(
+     *   Portable::FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components, Number> *fe_eval,
+     *   const int q_point) const;
+     * \endcode
+     */
+    // clang-format on
+    template <typename Functor>
+    DEAL_II_HOST_DEVICE void
+    apply_for_each_quad_point(const Functor &func);
+
+  private:
+    /**
+     * Return the stride of the lexicographic cell numbering in the given
+     * coordinate direction.
+     */
+    DEAL_II_HOST_DEVICE static unsigned int
+    stride(const unsigned int direction);
+
+    /**
+     * Return the coordinate direction tangential to the face with the given
+     * index, in ascending order.
+     */
+    DEAL_II_HOST_DEVICE unsigned int
+    tangential_direction(const unsigned int index) const;
+
+    const data_type         *data;
+    SharedData<dim, Number> *shared_data;
+    int                      face_id;
+    bool                     is_interior_face;
+    unsigned int             face_no;
+  };
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    FEFaceEvaluation(const data_type         *data,
+                     SharedData<dim, Number> *shdata,
+                     const bool               is_interior_face)
+    : data(data)
+    , shared_data(is_interior_face ? shdata : shdata + 1)
+    , face_id(shdata->team_member.league_rank())
+    , is_interior_face(is_interior_face)
+    , face_no(is_interior_face ? data->face_no_interior(face_id) :
+                                 data->face_no_exterior(face_id))
+  {
+    static_assert(n_q_points_1d == fe_degree + 1,
+                  "The face integrals need n_q_points_1d == fe_degree + 1.");
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE unsigned int
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    stride(const unsigned int direction)
+  {
+    return direction == 0 ? 1 :
+           direction == 1 ? (fe_degree + 1) :
+                            (fe_degree + 1) * (fe_degree + 1);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE unsigned int
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    tangential_direction(const unsigned int index) const
+  {
+    const unsigned int normal_direction = face_no / 2;
+    return index < normal_direction ? index : index + 1;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    read_dof_values(const Number *src)
+  {
+    static_assert(n_components_ == 1, "This function only supports FE with one \
+                  components");
+    const auto &local_to_global = is_interior_face ?
+                                    data->local_to_global_interior :
+                                    data->local_to_global_exterior;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
+                                                 tensor_dofs_per_cell),
+                         [&](const int &i) {
+                           shared_data->values(i) =
+                             src[local_to_global(face_id, i)];
+                         });
+    shared_data->team_member.team_barrier();
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    distribute_local_to_global(Number *dst) const
+  {
+    static_assert(n_components_ == 1, "This function only supports FE with one \
+                  components");
+    const auto &local_to_global = is_interior_face ?
+                                    data->local_to_global_interior :
+                                    data->local_to_global_exterior;
+    Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(shared_data->team_member, tensor_dofs_per_cell),
+      [&](const int &i) {
+        Kokkos::atomic_add(&dst[local_to_global(face_id, i)],
+                           shared_data->values(i));
+      });
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    evaluate(const EvaluationFlags::EvaluationFlags evaluate_flag)
+  {
+    constexpr unsigned int n_dofs_1d        = fe_degree + 1;
+    const unsigned int     normal_direction = face_no / 2;
+    const unsigned int     shape_offset     = (face_no % 2) * 2 * n_dofs_1d;
+    const bool evaluate_gradients = evaluate_flag & EvaluationFlags::gradients;
+
+    auto face_values = Kokkos::subview(
+      shared_data->values,
+      Kokkos::make_pair(tensor_dofs_per_cell,
+                        tensor_dofs_per_cell + n_q_points));
+    auto normal_derivatives =
+      Kokkos::subview(shared_data->gradients, Kokkos::ALL, normal_direction);
+
+    // Interpolate the values and the normal derivatives from the cell to the
+    // face in the direction normal to the face
+    const unsigned int stride_normal = stride(normal_direction);
+    const unsigned int stride_0 = dim > 1 ? stride(tangential_direction(0)) : 0;
+    const unsigned int stride_1 = dim > 2 ? stride(tangential_direction(1)) : 0;
+    Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(shared_data->team_member, n_q_points),
+      [&](const int &i) {
+        const unsigned int base =
+          (i % n_dofs_1d) * stride_0 + (i / n_dofs_1d) * stride_1;
+        Number value      = 0.;
+        Number derivative = 0.;
+        for (unsigned int k = 0; k < n_dofs_1d; ++k)
+          {
+            const Number u = shared_data->values(base + k * stride_normal);
+            value += data->shape_data_on_face(shape_offset + k) * u;
+            derivative +=
+              data->shape_data_on_face(shape_offset + n_dofs_1d + k) * u;
+          }
+        face_values(i) = value;
+        if (evaluate_gradients)
+          normal_derivatives(i) = derivative;
+      });
+    shared_data->team_member.team_barrier();
+
+    // Evaluate in the directions tangential to the face
+    if constexpr (dim > 1)
+      {
+        internal::EvaluatorTensorProduct<internal::evaluate_general,
+                                         dim - 1,
+                                         fe_degree,
+                                         n_q_points_1d,
+                                         Number>
+          evaluator_tensor_product(shared_data->team_member,
+                                   data->shape_values,
+                                   data->shape_gradients,
+                                   data->shape_gradients);
+
+        if (evaluate_gradients)
+          {
+            auto gradients_0 = Kokkos::subview(shared_data->gradients,
+                                               Kokkos::ALL,
+                                               tangential_direction(0));
+            if constexpr (dim == 2)
+              {
+                evaluator_tensor_product
+                  .template gradients<0, true, false, false>(face_values,
+                                                             gradients_0);
+                evaluator_tensor_product.template values<0, true, false, true>(
+                  normal_derivatives, normal_derivatives);
+                shared_data->team_member.team_barrier();
+              }
+            else
+              {
+                auto gradients_1 = Kokkos::subview(shared_data->gradients,
+                                                   Kokkos::ALL,
+                                                   tangential_direction(1));
+                evaluator_tensor_product
+                  .template gradients<0, true, false, false>(face_values,
+                                                             gradients_0);
+                evaluator_tensor_product.template values<0, true, false, false>(
+                  face_values, gradients_1);
+                evaluator_tensor_product.template values<0, true, false, true>(
+                  normal_derivatives, normal_derivatives);
+                shared_data->team_member.team_barrier();
+
+                evaluator_tensor_product.template values<1, true, false, true>(
+                  gradients_0, gradients_0);
+                evaluator_tensor_product
+                  .template gradients<1, true, false, true>(gradients_1,
+                                                            gradients_1);
+                evaluator_tensor_product.template values<1, true, false, true>(
+                  normal_derivatives, normal_derivatives);
+                shared_data->team_member.team_barrier();
+              }
+          }
+
+        if (evaluate_flag & EvaluationFlags::values)
+          {
+            evaluator_tensor_product.evaluate_values(face_values);
+            shared_data->team_member.team_barrier();
+          }
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    integrate(const EvaluationFlags::EvaluationFlags integration_flag)
+  {
+    constexpr unsigned int n_dofs_1d        = fe_degree + 1;
+    const unsigned int     normal_direction = face_no / 2;
+    const unsigned int     shape_offset     = (face_no % 2) * 2 * n_dofs_1d;
+    const bool integrate_values = integration_flag & EvaluationFlags::values;
+    const bool integrate_gradients =
+      integration_flag & EvaluationFlags::gradients;
+
+    auto face_values = Kokkos::subview(
+      shared_data->values,
+      Kokkos::make_pair(tensor_dofs_per_cell,
+                        tensor_dofs_per_cell + n_q_points));
+    auto normal_derivatives =
+      Kokkos::subview(shared_data->gradients, Kokkos::ALL, normal_direction);
+
+    // The tangential derivatives are added into the face values below, so
+    // start from zero if no values were submitted
+    if (!integrate_values)
+      {
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
+                                                     n_q_points),
+                             [&](const int &i) { face_values(i) = 0.; });
+        shared_data->team_member.team_barrier();
+      }
+
+    // Integrate in the directions tangential to the face
+    if constexpr (dim > 1)
+      {
+        internal::EvaluatorTensorProduct<internal::evaluate_general,
+                                         dim - 1,
+                                         fe_degree,
+                                         n_q_points_1d,
+                                         Number>
+          evaluator_tensor_product(shared_data->team_member,
+                                   data->shape_values,
+                                   data->shape_gradients,
+                                   data->shape_gradients);
+
+        if (integrate_gradients)
+          {
+            auto gradients_0 = Kokkos::subview(shared_data->gradients,
+                                               Kokkos::ALL,
+                                               tangential_direction(0));
+            if constexpr (dim == 2)
+              {
+                evaluator_tensor_product
+                  .template values<0, false, false, true>(normal_derivatives,
+                                                          normal_derivatives);
+                if (integrate_values)
+                  evaluator_tensor_product
+                    .template values<0, false, false, true>(face_values,
+                                                            face_values);
+                shared_data->team_member.team_barrier();
+
+                evaluator_tensor_product
+                  .template gradients<0, false, true, false>(gradients_0,
+                                                             face_values);
+                shared_data->team_member.team_barrier();
+              }
+            else
+              {
+                auto gradients_1 = Kokkos::subview(shared_data->gradients,
+                                                   Kokkos::ALL,
+                                                   tangential_direction(1));
+                evaluator_tensor_product
+                  .template values<1, false, false, true>(gradients_0,
+                                                          gradients_0);
+                evaluator_tensor_product
+                  .template gradients<1, false, false, true>(gradients_1,
+                                                             gradients_1);
+                evaluator_tensor_product
+                  .template values<1, false, false, true>(normal_derivatives,
+                                                          normal_derivatives);
+                if (integrate_values)
+                  evaluator_tensor_product
+                    .template values<1, false, false, true>(face_values,
+                                                            face_values);
+                shared_data->team_member.team_barrier();
+
+                evaluator_tensor_product
+                  .template values<0, false, false, true>(normal_derivatives,
+                                                          normal_derivatives);
+                if (integrate_values)
+                  evaluator_tensor_product
+                    .template values<0, false, false, true>(face_values,
+                                                            face_values);
+                shared_data->team_member.team_barrier();
+
+                evaluator_tensor_product
+                  .template gradients<0, false, true, false>(gradients_0,
+                                                             face_values);
+                shared_data->team_member.team_barrier();
+                evaluator_tensor_product.template values<0, false, true, false>(
+                  gradients_1, face_values);
+                shared_data->team_member.team_barrier();
+              }
+          }
+        else if (integrate_values)
+          {
+            evaluator_tensor_product.integrate_values(face_values);
+            shared_data->team_member.team_barrier();
+          }
+      }
+
+    // Extrapolate from the face to the cell in the direction normal to the
+    // face
+    const unsigned int stride_normal = stride(normal_direction);
+    const unsigned int stride_0 = dim > 1 ? stride(tangential_direction(0)) : 1;
+    const unsigned int stride_1 = dim > 2 ? stride(tangential_direction(1)) : 1;
+    Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(shared_data->team_member, tensor_dofs_per_cell),
+      [&](const int &i) {
+        const unsigned int k = (i / stride_normal) % n_dofs_1d;
+        const unsigned int face_index =
+          (dim > 1 ? (i / stride_0) % n_dofs_1d : 0) +
+          (dim > 2 ? n_dofs_1d * ((i / stride_1) % n_dofs_1d) : 0);
+        Number value =
+          data->shape_data_on_face(shape_offset + k) * face_values(face_index);
+        if (integrate_gradients)
+          value += data->shape_data_on_face(shape_offset + n_dofs_1d + k) *
+                   normal_derivatives(face_index);
+        shared_data->values(i) = value;
+      });
+    shared_data->team_member.team_barrier();
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::value_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_value(int q_point) const
+  {
+    return shared_data->values(tensor_dofs_per_cell + q_point);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::value_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_dof_value(int dof) const
+  {
+    return shared_data->values(dof);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    submit_value(const value_type &val_in, int q_point)
+  {
+    shared_data->values(tensor_dofs_per_cell + q_point) =
+      val_in * data->JxW(face_id, q_point);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    submit_dof_value(const value_type &val_in, int dof)
+  {
+    shared_data->values(dof) = val_in;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::gradient_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_gradient(int q_point) const
+  {
+    static_assert(n_components_ == 1, "This function only supports FE with one \
+                  components");
+    const auto &inv_jacobian = is_interior_face ?
+                                 data->inv_jacobian_interior :
+                                 data->inv_jacobian_exterior;
+
+    gradient_type grad;
+    for (unsigned int d_1 = 0; d_1 < dim; ++d_1)
+      {
+        Number tmp = 0.;
+        for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
+          tmp += inv_jacobian(face_id, q_point, d_2, d_1) *
+                 shared_data->gradients(q_point, d_2);
+        grad[d_1] = tmp;
+      }
+
+    return grad;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    submit_gradient(const gradient_type &grad_in, int q_point)
+  {
+    const auto &inv_jacobian = is_interior_face ?
+                                 data->inv_jacobian_interior :
+                                 data->inv_jacobian_exterior;
+    for (unsigned int d_1 = 0; d_1 < dim; ++d_1)
+      {
+        Number tmp = 0.;
+        for (unsigned int d_2 = 0; d_2 < dim; ++d_2)
+          tmp += inv_jacobian(face_id, q_point, d_1, d_2) * grad_in[d_2];
+        shared_data->gradients(q_point, d_1) =
+          tmp * data->JxW(face_id, q_point);
+      }
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::value_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_normal_derivative(int q_point) const
+  {
+    return get_gradient(q_point) * get_normal_vector(q_point);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    submit_normal_derivative(const value_type &val_in, int q_point)
+  {
+    submit_gradient(val_in * get_normal_vector(q_point), q_point);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE typename FEFaceEvaluation<dim,
+                                                fe_degree,
+                                                n_q_points_1d,
+                                                n_components_,
+                                                Number>::gradient_type
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    get_normal_vector(int q_point) const
+  {
+    gradient_type normal;
+    for (unsigned int d = 0; d < dim; ++d)
+      normal[d] = is_interior_face ? data->normal_vectors(face_id, q_point, d) :
+                                     -data->normal_vectors(face_id, q_point, d);
+    return normal;
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  DEAL_II_HOST_DEVICE types::boundary_id
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    boundary_id() const
+  {
+    return data->boundary_id(face_id);
+  }
+
+
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  template <typename Functor>
+  DEAL_II_HOST_DEVICE void
+  FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+    apply_for_each_quad_point(const Functor &func)
+  {
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
+                                                 n_q_points),
+                         [&](const int &i) { func(this, i); });
+    shared_data->team_member.team_barrier();
+  }
+
+
+
+
+  /**
+   * This class implements the action of the inverse of the
+   * @ref GlossMassMatrix "mass matrix" on a cell for discontinuous elements
+   * on the @ref GlossDevice "device", in the same way as
+   * MatrixFreeOperators::CellwiseInverseMassMatrix does on the host. It uses
+   * tensor products of the inverse 1d shape matrices, so the inverse is
+   * exactly as expensive as the mass matrix itself. Since
+   * Portable::MatrixFree uses as many quadrature points as there are degrees
+   * of freedom per direction, the result is the exact inverse of the mass
+   * matrix of FE_DGQ elements.
+   *
+   * The operation works on the degrees of freedom held in the shared memory of
+   * the team, which are the ones read by FEEvaluation::read_dof_values() and
+   * written by FEEvaluation::distribute_local_to_global(). An explicit time
+   * integrator for a DG discretization typically assembles the right hand
+   * side with MatrixFree::loop() and then applies the inverse mass matrix in
+   * a second call to MatrixFree::cell_loop() with the following operation:
+   * @code
+   * Portable::FEEvaluation<dim, fe_degree> phi(gpu_data, shared_data);
+   * Portable::CellwiseInverseMassMatrix<dim, fe_degree> inverse_mass(
+   *   gpu_data, shared_data);
+   * phi.read_dof_values(src);
+   * inverse_mass.apply();
+   * phi.distribute_local_to_global(dst);
+   * @endcode
+   * The operation uses the JxW values of the cells, so the MatrixFree object
+   * must be set up with update_JxW_values.
+   *
+   * @ingroup Portable
+   */
+  template <int dim, int fe_degree, typename Number = double>
+  class CellwiseInverseMassMatrix
+  {
+  public:
+    /**
+     * An alias to kernel specific information.
+     */
+    using data_type = typename MatrixFree<dim, Number>::Data;
+
+    /**
+     * Number of quadrature points and degrees of freedom per cell.
+     */
+    static constexpr unsigned int n_q_points =
+      Utilities::pow(fe_degree + 1, dim);
+
+    /**
+     * Constructor.
+     */
+    DEAL_II_HOST_DEVICE
+    CellwiseInverseMassMatrix(const data_type         *data,
+                              SharedData<dim, Number> *shdata);
+
+    /**
+     * Apply the inverse mass matrix of the current cell to the degrees of
+     * freedom in the shared memory, overwriting them with the result.
+     */
+    DEAL_II_HOST_DEVICE void
+    apply();
+
+    /**
+     * Transform the values in the shared memory, which are interpreted as
+     * values at the quadrature points, to the coefficients of the finite
+     * element basis interpolating them. This is the projection of a function
+     * given at the quadrature points onto the finite element space, without
+     * the multiplication by the JxW values and the inverse mass matrix, which
+     * cancel.
+     */
+    DEAL_II_HOST_DEVICE void
+    transform_from_q_points_to_basis();
+
+  private:
+    const data_type         *data;
+    SharedData<dim, Number> *shared_data;
+    int                      cell_id;
+  };
+
+
+
+  template <int dim, int fe_degree, typename Number>
+  DEAL_II_HOST_DEVICE
+  CellwiseInverseMassMatrix<dim, fe_degree, Number>::CellwiseInverseMassMatrix(
+    const data_type         *data,
+    SharedData<dim, Number> *shdata)
+    : data(data)
+    , shared_data(shdata)
+    , cell_id(shared_data->team_member.league_rank())
+  {}
+
+
+
+  template <int dim, int fe_degree, typename Number>
+  DEAL_II_HOST_DEVICE void
+  CellwiseInverseMassMatrix<dim, fe_degree, Number>::apply()
+  {
+    // The inverse of the mass matrix S^T W S is S^{-1} W^{-1} S^{-T}, where
+    // S holds the values of the shape functions at the quadrature points and
+    // W the JxW values. The tensor product kernels apply the transpose of the
+    // inverse shape matrix in the direction from the degrees of freedom to
+    // the quadrature points, and the inverse itself in the other direction.
+    internal::EvaluatorTensorProduct<
+      internal::EvaluatorVariant::evaluate_general,
+      dim,
+      fe_degree,
+      fe_degree + 1,
+      Number>
+      evaluator_tensor_product(shared_data->team_member,
+                               data->inverse_shape_values,
+                               data->shape_gradients,
+                               data->co_shape_gradients);
+
+    evaluator_tensor_product.evaluate_values(shared_data->values);
+    shared_data->team_member.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(shared_data->team_member,
+                                                 n_q_points),
+                         [&](const int &q_point) {
+                           shared_data->values(q_point) /=
+                             data->JxW(cell_id, q_point);
+                         });
+    shared_data->team_member.team_barrier();
+
+    evaluator_tensor_product.integrate_values(shared_data->values);
+    shared_data->team_member.team_barrier();
+  }
+
+
+
+  template <int dim, int fe_degree, typename Number>
+  DEAL_II_HOST_DEVICE void
+  CellwiseInverseMassMatrix<dim, fe_degree, Number>::
+    transform_from_q_points_to_basis()
+  {
+    internal::EvaluatorTensorProduct<
+      internal::EvaluatorVariant::evaluate_general,
+      dim,
+      fe_degree,
+      fe_degree + 1,
+      Number>
+      evaluator_tensor_product(shared_data->team_member,
+                               data->inverse_shape_values,
+                               data->shape_gradients,
+                               data->co_shape_gradients);
+
+    evaluator_tensor_product.integrate_values(shared_data->values);
+    shared_data->team_member.team_barrier();
+  }
+
+
 
 #ifndef DOXYGEN
   template <int dim,
@@ -591,6 +1516,19 @@ namespace Portable
   constexpr unsigned int
     FEEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
       n_q_points;
+
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components_,
+            typename Number>
+  constexpr unsigned int
+    FEFaceEvaluation<dim, fe_degree, n_q_points_1d, n_components_, Number>::
+      n_q_points;
+
+  template <int dim, int fe_degree, typename Number>
+  constexpr unsigned int
+    CellwiseInverseMassMatrix<dim, fe_degree, Number>::n_q_points;
 #endif
 } // namespace Portable
 
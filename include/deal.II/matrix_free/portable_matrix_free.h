@@ -49,7 +49,10 @@ namespace internal
   namespace MatrixFreeFunctions
   {
     enum class ConstraintKinds : std::uint16_t;
-  }
+
+    template <typename Number>
+    struct ShapeInfo;
+  } // namespace MatrixFreeFunctions
 } // namespace internal
 
 namespace Portable
@@ -85,6 +88,17 @@ namespace Portable
    * This class traverse the cells in a different order than the usual
    * Triangulation class in deal.II.
    *
+   * For discontinuous Galerkin methods, the class can additionally collect
+   * data for the integrals over interior and boundary faces, which is enabled
+   * by setting AdditionalData::mapping_update_flags_inner_faces and
+   * AdditionalData::mapping_update_flags_boundary_faces. The function loop()
+   * then runs the cell integrals as well as the face integrals on the
+   * @ref GlossDevice "device", with the face operations implemented in terms
+   * of the class Portable::FEFaceEvaluation. The face integrals are currently
+   * restricted to meshes without hanging nodes and with consistently oriented
+   * faces, as obtained, e.g., from GridGenerator::subdivided_hyper_cube() or
+   * global refinement of a single coarse cell.
+   *
    * @note Only float and double are supported.
    *
    * @ingroup CUDAWrappers
@@ -113,6 +127,8 @@ namespace Portable
                      const bool use_coloring                      = false,
                      const bool overlap_communication_computation = false)
         : mapping_update_flags(mapping_update_flags)
+        , mapping_update_flags_inner_faces(update_default)
+        , mapping_update_flags_boundary_faces(update_default)
         , use_coloring(use_coloring)
         , overlap_communication_computation(overlap_communication_computation)
       {
@@ -139,6 +155,23 @@ namespace Portable
        */
       UpdateFlags mapping_update_flags;
 
+      /**
+       * This flag determines the mapping data on interior faces to be cached.
+       * If set to a value different from update_default, the interior faces
+       * are collected and MatrixFree::loop() runs the face operation on them.
+       * The Jacobian determinants times quadrature weights and the normal
+       * vectors are always computed for the faces, the inverse Jacobians of
+       * the two adjacent cells are computed if update_gradients is given, and
+       * the quadrature points if update_quadrature_points is given.
+       */
+      UpdateFlags mapping_update_flags_inner_faces;
+
+      /**
+       * Same as mapping_update_flags_inner_faces, but for the faces at the
+       * boundary of the domain.
+       */
+      UpdateFlags mapping_update_flags_boundary_faces;
+
       /**
        * If true, use graph coloring. Otherwise, use atomic operations. Graph
        * coloring ensures bitwise reproducibility but is slower on Pascal and
@@ -207,6 +240,13 @@ namespace Portable
       Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
         co_shape_gradients;
 
+      /**
+       * Inverse of the 1d matrix of the values of the shape functions, used
+       * by CellwiseInverseMassMatrix.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        inverse_shape_values;
+
       /**
        * Weights used when resolving hanginf nodes.
        */
@@ -259,6 +299,111 @@ namespace Portable
       }
     };
 
+    /**
+     * Structure which is passed to the kernels of the face integrals. It
+     * contains the data of a set of faces, either the interior faces or the
+     * faces at the boundary of the domain. For the latter, the fields related
+     * to the exterior side of the face are empty.
+     *
+     * The quadrature points of a face are the tensor product of the 1d
+     * quadrature formula in the two (in 3d) coordinate directions of the
+     * cell that are tangential to the face, with the lower coordinate
+     * direction running fastest. This numbering is the same from both sides
+     * of the face.
+     */
+    struct FaceData
+    {
+      /**
+       * Kokkos::View of the quadrature points on the faces.
+       */
+      Kokkos::View<point_type **, MemorySpace::Default::kokkos_space> q_points;
+
+      /**
+       * Map the position in the local vector of the cell on the interior side
+       * of each face to the position in the global vector.
+       */
+      Kokkos::View<types::global_dof_index **,
+                   MemorySpace::Default::kokkos_space>
+        local_to_global_interior;
+
+      /**
+       * Same as local_to_global_interior, but for the cell on the exterior
+       * side of each face.
+       */
+      Kokkos::View<types::global_dof_index **,
+                   MemorySpace::Default::kokkos_space>
+        local_to_global_exterior;
+
+      /**
+       * The number of the face within the cell on the interior side, in the
+       * numbering of GeometryInfo.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        face_no_interior;
+
+      /**
+       * The number of the face within the cell on the exterior side.
+       */
+      Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>
+        face_no_exterior;
+
+      /**
+       * The boundary id of each face. Only filled for boundary faces.
+       */
+      Kokkos::View<types::boundary_id *, MemorySpace::Default::kokkos_space>
+        boundary_id;
+
+      /**
+       * Kokkos::View of the inverse Jacobian of the interior cell at the
+       * quadrature points of the faces.
+       */
+      Kokkos::View<Number **[dim][dim], MemorySpace::Default::kokkos_space>
+        inv_jacobian_interior;
+
+      /**
+       * Kokkos::View of the inverse Jacobian of the exterior cell at the
+       * quadrature points of the faces.
+       */
+      Kokkos::View<Number **[dim][dim], MemorySpace::Default::kokkos_space>
+        inv_jacobian_exterior;
+
+      /**
+       * Kokkos::View of the surface element times the quadrature weights.
+       */
+      Kokkos::View<Number **, MemorySpace::Default::kokkos_space> JxW;
+
+      /**
+       * Kokkos::View of the unit normal vectors, pointing out of the cell on
+       * the interior side.
+       */
+      Kokkos::View<Number **[dim], MemorySpace::Default::kokkos_space>
+        normal_vectors;
+
+      /**
+       * Values of the shape functions.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space> shape_values;
+
+      /**
+       * Gradients of the shape functions.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        shape_gradients;
+
+      /**
+       * Values and derivatives of the 1d shape functions, evaluated at the
+       * left end point of the unit interval followed by the ones at the right
+       * end point.
+       */
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+        shape_data_on_face;
+
+      /**
+       * Number of faces.
+       */
+      unsigned int n_faces;
+    };
+
     /**
      * Default constructor.
      */
@@ -339,6 +484,63 @@ namespace Portable
               const VectorType &src,
               VectorType       &dst) const;
 
+    // clang-format off
+    /**
+     * This method runs the loop over all cells, all interior faces and all
+     * boundary faces and applies the respective local operations in parallel.
+     * It is the analogue of dealii::MatrixFree::loop() for discontinuous
+     * Galerkin methods. The face data must have been set up by
+     * AdditionalData::mapping_update_flags_inner_faces and
+     * AdditionalData::mapping_update_flags_boundary_faces.
+     *
+     * @p cell_func is a functor as in cell_loop(). @p inner_face_func and
+     * @p boundary_face_func need to define
+     * \code
+     * DEAL_II_HOST_DEVICE void operator()(
+     *   const unsigned int                                          face,
+     *   const typename Portable::MatrixFree<dim, Number>::FaceData *face_data,
+     *   Portable::SharedData<dim, Number> *                     shared_data,
+     *   const Number *                                              src,
+     *   Number *                                                    dst) const;
+     *   static const unsigned int n_local_dofs;
+     *   static const unsigned int n_q_points;
+     * \endcode
+     * where `n_local_dofs` is the number of degrees of freedom of a cell and
+     * `n_q_points` the number of quadrature points of a face. The argument
+     * `shared_data` points to two objects, the first for the interior side
+     * and the second for the exterior side of the face, which are consumed
+     * by Portable::FEFaceEvaluation.
+     *
+     * The contributions of the faces are added into @p dst with atomic
+     * operations, also when graph coloring is used for the cells. The
+     * vectors must be initialized by initialize_dof_vector().
+     */
+    // clang-format on
+    template <typename CellFunctor,
+              typename InnerFaceFunctor,
+              typename BoundaryFaceFunctor>
+    void
+    loop(
+      const CellFunctor         &cell_func,
+      const InnerFaceFunctor    &inner_face_func,
+      const BoundaryFaceFunctor &boundary_face_func,
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+                                                                       &src,
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &dst)
+      const;
+
+    /**
+     * Return the FaceData structure of the interior faces.
+     */
+    FaceData
+    get_inner_face_data() const;
+
+    /**
+     * Return the FaceData structure of the boundary faces.
+     */
+    FaceData
+    get_boundary_face_data() const;
+
     /**
      * This method runs the loop over all cells and apply the local operation on
      * each element in parallel. This function is very similar to cell_loop()
@@ -463,6 +665,32 @@ namespace Portable
       LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &dst)
       const;
 
+    /**
+     * Helper function. Run the kernels of the cell and face operations of
+     * loop() on the given vector entries.
+     */
+    template <typename CellFunctor,
+              typename InnerFaceFunctor,
+              typename BoundaryFaceFunctor>
+    void
+    apply_loop_kernels(const CellFunctor         &cell_func,
+                       const InnerFaceFunctor    &inner_face_func,
+                       const BoundaryFaceFunctor &boundary_face_func,
+                       Number *const              src,
+                       Number                    *dst) const;
+
+    /**
+     * Helper function. Collect the interior and boundary faces of the cells
+     * in the colored graph and fill the respective FaceData objects.
+     */
+    void
+    setup_face_data(
+      const Mapping<dim>  &mapping,
+      const Quadrature<1> &quad,
+      const ::dealii::internal::MatrixFreeFunctions::ShapeInfo<Number>
+                           &shape_info,
+      const AdditionalData &additional_data);
+
 #ifdef DEAL_II_WITH_CUDA
     /**
      * This function should never be called. Calling it results in an internal
@@ -590,12 +818,28 @@ namespace Portable
     Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
       co_shape_gradients;
 
+    /**
+     * Inverse of the 1d matrix of the values of the shape functions.
+     */
+    Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+      inverse_shape_values;
+
     /**
      * Weights used when resolving hanginf nodes.
      */
     Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
       constraint_weights;
 
+    /**
+     * Data of the interior faces.
+     */
+    FaceData inner_face_data;
+
+    /**
+     * Data of the boundary faces.
+     */
+    FaceData boundary_face_data;
+
     /**
      * Shared pointer to a Partitioner for distributed Vectors used in
      * cell_loop. When MPI is not used the pointer is null.
@@ -403,6 +403,79 @@ namespace Portable
         func(team_member.league_rank(), &gpu_data, &shared_data, src, dst);
       }
     };
+
+
+
+    template <int dim, typename Number, typename Functor>
+    struct ApplyFaceKernel
+    {
+      using TeamHandle = Kokkos::TeamPolicy<
+        MemorySpace::Default::kokkos_space::execution_space>::member_type;
+      using SharedView1D =
+        Kokkos::View<Number *,
+                     MemorySpace::Default::kokkos_space::execution_space::
+                       scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+      using SharedView2D =
+        Kokkos::View<Number *[dim],
+                     MemorySpace::Default::kokkos_space::execution_space::
+                       scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+      ApplyFaceKernel(Functor                                          func,
+                      const typename MatrixFree<dim, Number>::FaceData face_data,
+                      Number *const                                    src,
+                      Number                                          *dst)
+        : func(func)
+        , face_data(face_data)
+        , src(src)
+        , dst(dst)
+      {}
+
+      Functor                                          func;
+      const typename MatrixFree<dim, Number>::FaceData face_data;
+      Number *const                                    src;
+      Number                                          *dst;
+
+
+      // Provide the shared memory capacity for the two sides of the face. The
+      // values array holds the cell values followed by the values on the
+      // face, whereas the gradients are only needed on the face.
+      size_t
+      team_shmem_size(int /*team_size*/) const
+      {
+        return 2 * (SharedView1D::shmem_size(Functor::n_local_dofs +
+                                             Functor::n_q_points) +
+                    SharedView2D::shmem_size(Functor::n_local_dofs));
+      }
+
+
+      DEAL_II_HOST_DEVICE
+      void
+      operator()(const TeamHandle &team_member) const
+      {
+        // Get the scratch memory
+        SharedView1D values_interior(team_member.team_shmem(),
+                                     Functor::n_local_dofs +
+                                       Functor::n_q_points);
+        SharedView2D gradients_interior(team_member.team_shmem(),
+                                        Functor::n_local_dofs);
+        SharedView1D values_exterior(team_member.team_shmem(),
+                                     Functor::n_local_dofs +
+                                       Functor::n_q_points);
+        SharedView2D gradients_exterior(team_member.team_shmem(),
+                                        Functor::n_local_dofs);
+
+        SharedData<dim, Number> shared_data[2] = {
+          SharedData<dim, Number>(team_member,
+                                  values_interior,
+                                  gradients_interior),
+          SharedData<dim, Number>(team_member,
+                                  values_exterior,
+                                  gradients_exterior)};
+        func(team_member.league_rank(), &face_data, shared_data, src, dst);
+      }
+    };
   } // namespace internal
 
 
@@ -413,7 +486,10 @@ namespace Portable
     , n_dofs(0)
     , padding_length(0)
     , dof_handler(nullptr)
-  {}
+  {
+    inner_face_data.n_faces    = 0;
+    boundary_face_data.n_faces = 0;
+  }
 
 
 
@@ -497,22 +573,41 @@ namespace Portable
       data_copy.inv_jacobian = inv_jacobian[color];
     if (JxW.size() > 0)
       data_copy.JxW = JxW[color];
-    data_copy.local_to_global    = local_to_global[color];
-    data_copy.constraint_mask    = constraint_mask[color];
-    data_copy.shape_values       = shape_values;
-    data_copy.shape_gradients    = shape_gradients;
-    data_copy.co_shape_gradients = co_shape_gradients;
-    data_copy.constraint_weights = constraint_weights;
-    data_copy.n_cells            = n_cells[color];
-    data_copy.padding_length     = padding_length;
-    data_copy.row_start          = row_start[color];
-    data_copy.use_coloring       = use_coloring;
+    data_copy.local_to_global      = local_to_global[color];
+    data_copy.constraint_mask      = constraint_mask[color];
+    data_copy.shape_values         = shape_values;
+    data_copy.shape_gradients      = shape_gradients;
+    data_copy.co_shape_gradients   = co_shape_gradients;
+    data_copy.inverse_shape_values = inverse_shape_values;
+    data_copy.constraint_weights   = constraint_weights;
+    data_copy.n_cells              = n_cells[color];
+    data_copy.padding_length       = padding_length;
+    data_copy.row_start            = row_start[color];
+    data_copy.use_coloring         = use_coloring;
 
     return data_copy;
   }
 
 
 
+  template <int dim, typename Number>
+  typename MatrixFree<dim, Number>::FaceData
+  MatrixFree<dim, Number>::get_inner_face_data() const
+  {
+    return inner_face_data;
+  }
+
+
+
+  template <int dim, typename Number>
+  typename MatrixFree<dim, Number>::FaceData
+  MatrixFree<dim, Number>::get_boundary_face_data() const
+  {
+    return boundary_face_data;
+  }
+
+
+
   template <int dim, typename Number>
   template <typename VectorType>
   void
@@ -732,6 +827,15 @@ namespace Portable
                         shape_info.data.front().shape_values.data(),
                         size_shape_values));
 
+    inverse_shape_values =
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+        Kokkos::view_alloc("inverse_shape_values", Kokkos::WithoutInitializing),
+        size_shape_values);
+    Kokkos::deep_copy(inverse_shape_values,
+                      Kokkos::View<Number *, Kokkos::HostSpace>(
+                        shape_info.data.front().inverse_shape_values.data(),
+                        size_shape_values));
+
     if (update_flags & update_gradients)
       {
         shape_gradients =
@@ -921,6 +1025,360 @@ namespace Portable
                                      constrained_dofs_host.size());
         Kokkos::deep_copy(constrained_dofs, constrained_dofs_host_view);
       }
+
+    setup_face_data(mapping, quad, shape_info, additional_data);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MatrixFree<dim, Number>::setup_face_data(
+    const Mapping<dim>  &mapping,
+    const Quadrature<1> &quad,
+    const ::dealii::internal::MatrixFreeFunctions::ShapeInfo<Number>
+                         &shape_info,
+    const AdditionalData &additional_data)
+  {
+    inner_face_data            = FaceData();
+    inner_face_data.n_faces    = 0;
+    boundary_face_data         = FaceData();
+    boundary_face_data.n_faces = 0;
+
+    const UpdateFlags update_flags_inner_faces =
+      additional_data.mapping_update_flags_inner_faces;
+    const UpdateFlags update_flags_boundary_faces =
+      additional_data.mapping_update_flags_boundary_faces;
+    if (update_flags_inner_faces == update_default &&
+        update_flags_boundary_faces == update_default)
+      return;
+
+    const unsigned int n_q_points_1d = quad.size();
+    const unsigned int n_face_q_points =
+      Utilities::fixed_power<dim - 1>(n_q_points_1d);
+    const unsigned int n_faces_per_cell = 2 * dim;
+
+    // Set up the quadrature formulas on the faces of the reference cell in
+    // the numbering used by FEFaceEvaluation, where the lower of the
+    // tangential coordinate directions runs fastest, and compute the mapping
+    // data with FEValues
+    std::vector<std::unique_ptr<FEValues<dim>>> fe_values_faces;
+    for (unsigned int f = 0; f < n_faces_per_cell; ++f)
+      {
+        const unsigned int      normal_direction = f / 2;
+        std::vector<Point<dim>> points(n_face_q_points);
+        std::vector<double>     weights(n_face_q_points, 1.);
+        for (unsigned int q = 0; q < n_face_q_points; ++q)
+          {
+            unsigned int index = q;
+            for (unsigned int d = 0; d < dim; ++d)
+              if (d == normal_direction)
+                points[q][d] = f % 2;
+              else
+                {
+                  points[q][d] = quad.point(index % n_q_points_1d)[0];
+                  weights[q] *= quad.weight(index % n_q_points_1d);
+                  index /= n_q_points_1d;
+                }
+          }
+        fe_values_faces.push_back(std::make_unique<FEValues<dim>>(
+          mapping,
+          dof_handler->get_fe(),
+          Quadrature<dim>(points, weights),
+          update_jacobians | update_inverse_jacobians |
+            update_quadrature_points));
+      }
+
+    // Collect the faces of the cells in the loop. Interior faces between two
+    // cells of this process are assigned to the cell with the lower index,
+    // faces to ghost cells to the process with the lower subdomain id.
+    const Triangulation<dim> &tria = dof_handler->get_triangulation();
+    std::vector<bool>         cell_in_loop(tria.n_active_cells(), false);
+    for (const auto &color : graph)
+      for (const auto &cell : color)
+        cell_in_loop[cell->active_cell_index()] = true;
+
+    using CellIterator = typename DoFHandler<dim>::active_cell_iterator;
+    std::vector<std::pair<CellIterator, unsigned int>> inner_faces;
+    std::vector<std::pair<CellIterator, unsigned int>> boundary_faces;
+    for (const auto &color : graph)
+      for (const auto &filtered_cell : color)
+        {
+          const CellIterator cell = filtered_cell;
+          for (const unsigned int f : cell->face_indices())
+            {
+              if (cell->at_boundary(f))
+                {
+                  AssertThrow(cell->has_periodic_neighbor(f) == false,
+                              ExcNotImplemented(
+                                "Periodic faces are not supported by the face "
+                                "integrals of Portable::MatrixFree."));
+                  if (update_flags_boundary_faces != update_default)
+                    boundary_faces.emplace_back(cell, f);
+                  continue;
+                }
+
+              AssertThrow(cell->neighbor_is_coarser(f) == false &&
+                            cell->face(f)->has_children() == false,
+                          ExcNotImplemented(
+                            "Faces with hanging nodes are not supported by the "
+                            "face integrals of Portable::MatrixFree."));
+              if (update_flags_inner_faces == update_default)
+                continue;
+
+              const CellIterator neighbor = cell->neighbor(f);
+              if (cell_in_loop[neighbor->active_cell_index()])
+                {
+                  if (cell->active_cell_index() < neighbor->active_cell_index())
+                    inner_faces.emplace_back(cell, f);
+                }
+              else
+                {
+                  AssertThrow(neighbor->is_ghost(),
+                              ExcNotImplemented(
+                                "The face integrals of Portable::MatrixFree "
+                                "need all locally owned cells in the loop."));
+                  if (cell->subdomain_id() < neighbor->subdomain_id())
+                    inner_faces.emplace_back(cell, f);
+                }
+            }
+        }
+
+    const auto &lexicographic_inv = shape_info.lexicographic_numbering;
+    const unsigned int n_dofs_1d  = fe_degree + 1;
+    std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+    const auto fill_dof_indices = [&](const CellIterator &cell,
+                                      const unsigned int  face,
+                                      auto               &local_to_global) {
+      cell->get_dof_indices(dof_indices);
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        {
+          const types::global_dof_index index =
+            dof_indices[lexicographic_inv[i]];
+          local_to_global(face, i) =
+            partitioner ? partitioner->global_to_local(index) : index;
+        }
+    };
+
+    const auto fill_inverse_jacobian = [&](const FEValues<dim> &fe_values,
+                                           const unsigned int   face,
+                                           auto &inv_jacobian) {
+      for (unsigned int q = 0; q < n_face_q_points; ++q)
+        for (unsigned int d = 0; d < dim; ++d)
+          for (unsigned int e = 0; e < dim; ++e)
+            inv_jacobian(face, q, d, e) = fe_values.inverse_jacobian(q)[d][e];
+    };
+
+    const auto fill_face_data =
+      [&](const std::vector<std::pair<CellIterator, unsigned int>> &faces,
+          const UpdateFlags                                         update_flags,
+          const bool                                                is_inner,
+          FaceData                                                 &face_data) {
+        const unsigned int n_faces = faces.size();
+        face_data.n_faces          = n_faces;
+
+        face_data.shape_values = shape_values;
+        face_data.shape_gradients =
+          Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("face_shape_gradients",
+                               Kokkos::WithoutInitializing),
+            n_dofs_1d * n_q_points_1d);
+        Kokkos::deep_copy(face_data.shape_gradients,
+                          Kokkos::View<const Number *, Kokkos::HostSpace>(
+                            shape_info.data.front().shape_gradients.data(),
+                            n_dofs_1d * n_q_points_1d));
+        face_data.shape_data_on_face =
+          Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("shape_data_on_face",
+                               Kokkos::WithoutInitializing),
+            4 * n_dofs_1d);
+        auto shape_data_on_face_host =
+          Kokkos::create_mirror_view(face_data.shape_data_on_face);
+        for (unsigned int side = 0; side < 2; ++side)
+          for (unsigned int i = 0; i < 2 * n_dofs_1d; ++i)
+            shape_data_on_face_host(side * 2 * n_dofs_1d + i) =
+              shape_info.data.front().shape_data_on_face[side][i];
+        Kokkos::deep_copy(face_data.shape_data_on_face,
+                          shape_data_on_face_host);
+
+        if (n_faces == 0)
+          return;
+
+        const std::string suffix = is_inner ? "_inner" : "_boundary";
+
+        face_data.local_to_global_interior = Kokkos::View<
+          types::global_dof_index **,
+          MemorySpace::Default::kokkos_space>(
+          Kokkos::view_alloc("face_local_to_global_interior" + suffix,
+                             Kokkos::WithoutInitializing),
+          n_faces,
+          dofs_per_cell);
+        face_data.face_no_interior =
+          Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("face_no_interior" + suffix,
+                               Kokkos::WithoutInitializing),
+            n_faces);
+        face_data.JxW =
+          Kokkos::View<Number **, MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("face_JxW" + suffix,
+                               Kokkos::WithoutInitializing),
+            n_faces,
+            n_face_q_points);
+        face_data.normal_vectors =
+          Kokkos::View<Number **[dim], MemorySpace::Default::kokkos_space>(
+            Kokkos::view_alloc("face_normal_vectors" + suffix,
+                               Kokkos::WithoutInitializing),
+            n_faces,
+            n_face_q_points);
+        if (update_flags & update_gradients)
+          face_data.inv_jacobian_interior = Kokkos::
+            View<Number **[dim][dim], MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("face_inv_jacobian_interior" + suffix,
+                                 Kokkos::WithoutInitializing),
+              n_faces,
+              n_face_q_points);
+        if (update_flags & update_quadrature_points)
+          face_data.q_points =
+            Kokkos::View<point_type **, MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("face_q_points" + suffix,
+                                 Kokkos::WithoutInitializing),
+              n_faces,
+              n_face_q_points);
+        if (is_inner)
+          {
+            face_data.local_to_global_exterior = Kokkos::View<
+              types::global_dof_index **,
+              MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("face_local_to_global_exterior" + suffix,
+                                 Kokkos::WithoutInitializing),
+              n_faces,
+              dofs_per_cell);
+            face_data.face_no_exterior =
+              Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>(
+                Kokkos::view_alloc("face_no_exterior" + suffix,
+                                   Kokkos::WithoutInitializing),
+                n_faces);
+            if (update_flags & update_gradients)
+              face_data.inv_jacobian_exterior = Kokkos::
+                View<Number **[dim][dim], MemorySpace::Default::kokkos_space>(
+                  Kokkos::view_alloc("face_inv_jacobian_exterior" + suffix,
+                                     Kokkos::WithoutInitializing),
+                  n_faces,
+                  n_face_q_points);
+          }
+        else
+          face_data.boundary_id =
+            Kokkos::View<types::boundary_id *,
+                         MemorySpace::Default::kokkos_space>(
+              Kokkos::view_alloc("face_boundary_id" + suffix,
+                                 Kokkos::WithoutInitializing),
+              n_faces);
+
+        auto local_to_global_interior_host =
+          Kokkos::create_mirror_view(face_data.local_to_global_interior);
+        auto local_to_global_exterior_host =
+          Kokkos::create_mirror_view(face_data.local_to_global_exterior);
+        auto face_no_interior_host =
+          Kokkos::create_mirror_view(face_data.face_no_interior);
+        auto face_no_exterior_host =
+          Kokkos::create_mirror_view(face_data.face_no_exterior);
+        auto boundary_id_host =
+          Kokkos::create_mirror_view(face_data.boundary_id);
+        auto JxW_host = Kokkos::create_mirror_view(face_data.JxW);
+        auto normal_vectors_host =
+          Kokkos::create_mirror_view(face_data.normal_vectors);
+        auto inv_jacobian_interior_host =
+          Kokkos::create_mirror_view(face_data.inv_jacobian_interior);
+        auto inv_jacobian_exterior_host =
+          Kokkos::create_mirror_view(face_data.inv_jacobian_exterior);
+        auto q_points_host = Kokkos::create_mirror_view(face_data.q_points);
+
+        for (unsigned int face = 0; face < n_faces; ++face)
+          {
+            const CellIterator &cell             = faces[face].first;
+            const unsigned int  f                = faces[face].second;
+            const unsigned int  normal_direction = f / 2;
+
+            fill_dof_indices(cell, face, local_to_global_interior_host);
+            face_no_interior_host(face) = f;
+
+            FEValues<dim> &fe_values = *fe_values_faces[f];
+            fe_values.reinit(cell);
+            for (unsigned int q = 0; q < n_face_q_points; ++q)
+              {
+                // the normal vector is the row of the inverse Jacobian
+                // associated with the normal direction on the reference cell
+                const Tensor<1, dim> normal =
+                  fe_values.inverse_jacobian(q)[normal_direction];
+                const double normal_norm = normal.norm();
+                JxW_host(face, q) =
+                  std::abs(fe_values.jacobian(q).determinant()) *
+                  normal_norm * fe_values.get_quadrature().weight(q);
+                for (unsigned int d = 0; d < dim; ++d)
+                  normal_vectors_host(face, q, d) =
+                    (f % 2 == 0 ? -1. : 1.) * normal[d] / normal_norm;
+                if (update_flags & update_quadrature_points)
+                  q_points_host(face, q) = fe_values.quadrature_point(q);
+              }
+            if (update_flags & update_gradients)
+              fill_inverse_jacobian(fe_values, face, inv_jacobian_interior_host);
+
+            if (is_inner)
+              {
+                const CellIterator neighbor = cell->neighbor(f);
+                const unsigned int f_exterior = cell->neighbor_of_neighbor(f);
+                fill_dof_indices(neighbor, face, local_to_global_exterior_host);
+                face_no_exterior_host(face) = f_exterior;
+
+                FEValues<dim> &fe_values_exterior =
+                  *fe_values_faces[f_exterior];
+                fe_values_exterior.reinit(neighbor);
+                for (unsigned int q = 0; q < n_face_q_points; ++q)
+                  AssertThrow(fe_values_exterior.quadrature_point(q).distance(
+                                fe_values.quadrature_point(q)) <
+                                1e-10 * cell->diameter(),
+                              ExcNotImplemented(
+                                "The face integrals of Portable::MatrixFree "
+                                "need the faces to be oriented in the same "
+                                "way from both sides."));
+                if (update_flags & update_gradients)
+                  fill_inverse_jacobian(fe_values_exterior,
+                                        face,
+                                        inv_jacobian_exterior_host);
+              }
+            else
+              boundary_id_host(face) = cell->face(f)->boundary_id();
+          }
+
+        Kokkos::deep_copy(face_data.local_to_global_interior,
+                          local_to_global_interior_host);
+        Kokkos::deep_copy(face_data.face_no_interior, face_no_interior_host);
+        Kokkos::deep_copy(face_data.JxW, JxW_host);
+        Kokkos::deep_copy(face_data.normal_vectors, normal_vectors_host);
+        if (update_flags & update_gradients)
+          Kokkos::deep_copy(face_data.inv_jacobian_interior,
+                            inv_jacobian_interior_host);
+        if (update_flags & update_quadrature_points)
+          Kokkos::deep_copy(face_data.q_points, q_points_host);
+        if (is_inner)
+          {
+            Kokkos::deep_copy(face_data.local_to_global_exterior,
+                              local_to_global_exterior_host);
+            Kokkos::deep_copy(face_data.face_no_exterior,
+                              face_no_exterior_host);
+            if (update_flags & update_gradients)
+              Kokkos::deep_copy(face_data.inv_jacobian_exterior,
+                                inv_jacobian_exterior_host);
+          }
+        else
+          Kokkos::deep_copy(face_data.boundary_id, boundary_id_host);
+      };
+
+    fill_face_data(inner_faces, update_flags_inner_faces, true, inner_face_data);
+    fill_face_data(boundary_faces,
+                   update_flags_boundary_faces,
+                   false,
+                   boundary_face_data);
   }
 
 
@@ -958,6 +1416,124 @@ namespace Portable
 
 
 
+  template <int dim, typename Number>
+  template <typename CellFunctor,
+            typename InnerFaceFunctor,
+            typename BoundaryFaceFunctor>
+  void
+  MatrixFree<dim, Number>::loop(
+    const CellFunctor         &cell_func,
+    const InnerFaceFunctor    &inner_face_func,
+    const BoundaryFaceFunctor &boundary_face_func,
+    const LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &src,
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Default> &dst) const
+  {
+    if (partitioner)
+      {
+        Assert(src.get_partitioner()->is_compatible(*partitioner) &&
+                 dst.get_partitioner()->is_compatible(*partitioner),
+               ExcMessage("The vectors passed to loop() must be initialized "
+                          "by initialize_dof_vector()."));
+
+        src.update_ghost_values();
+        apply_loop_kernels(cell_func,
+                           inner_face_func,
+                           boundary_face_func,
+                           src.get_values(),
+                           dst.get_values());
+
+        // We need a synchronization point because we don't want device-aware
+        // MPI to start the MPI communication until the kernels are done.
+        Kokkos::fence();
+        dst.compress(VectorOperation::add);
+        src.zero_out_ghost_values();
+      }
+    else
+      {
+        apply_loop_kernels(cell_func,
+                           inner_face_func,
+                           boundary_face_func,
+                           src.get_values(),
+                           dst.get_values());
+        Kokkos::fence();
+      }
+  }
+
+
+
+  template <int dim, typename Number>
+  template <typename CellFunctor,
+            typename InnerFaceFunctor,
+            typename BoundaryFaceFunctor>
+  void
+  MatrixFree<dim, Number>::apply_loop_kernels(
+    const CellFunctor         &cell_func,
+    const InnerFaceFunctor    &inner_face_func,
+    const BoundaryFaceFunctor &boundary_face_func,
+    Number *const              src,
+    Number                    *dst) const
+  {
+    MemorySpace::Default::kokkos_space::execution_space exec;
+
+    for (unsigned int color = 0; color < n_colors; ++color)
+      if (n_cells[color] > 0)
+        {
+          Kokkos::TeamPolicy<
+            MemorySpace::Default::kokkos_space::execution_space>
+            team_policy(
+#if KOKKOS_VERSION >= 20900
+              exec,
+#endif
+              n_cells[color],
+              Kokkos::AUTO);
+
+          internal::ApplyKernel<dim, Number, CellFunctor> apply_kernel(
+            cell_func, get_data(color), src, dst);
+
+          Kokkos::parallel_for("dealii::MatrixFree::loop_cells",
+                               team_policy,
+                               apply_kernel);
+        }
+
+    if (inner_face_data.n_faces > 0)
+      {
+        Kokkos::TeamPolicy<MemorySpace::Default::kokkos_space::execution_space>
+          team_policy(
+#if KOKKOS_VERSION >= 20900
+            exec,
+#endif
+            inner_face_data.n_faces,
+            Kokkos::AUTO);
+
+        internal::ApplyFaceKernel<dim, Number, InnerFaceFunctor> apply_kernel(
+          inner_face_func, inner_face_data, src, dst);
+
+        Kokkos::parallel_for("dealii::MatrixFree::loop_inner_faces",
+                             team_policy,
+                             apply_kernel);
+      }
+
+    if (boundary_face_data.n_faces > 0)
+      {
+        Kokkos::TeamPolicy<MemorySpace::Default::kokkos_space::execution_space>
+          team_policy(
+#if KOKKOS_VERSION >= 20900
+            exec,
+#endif
+            boundary_face_data.n_faces,
+            Kokkos::AUTO);
+
+        internal::ApplyFaceKernel<dim, Number, BoundaryFaceFunctor>
+          apply_kernel(boundary_face_func, boundary_face_data, src, dst);
+
+        Kokkos::parallel_for("dealii::MatrixFree::loop_boundary_faces",
+                             team_policy,
+                             apply_kernel);
+      }
+  }
+
+
+
   template <int dim, typename Number>
   template <typename Functor>
   void
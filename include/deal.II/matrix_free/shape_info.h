@@ -399,6 +399,20 @@ namespace internal
        */
       ElementType element_type;
 
+      /**
+       * For elements of type tensor_symmetric and tensor_symmetric_hermite
+       * with at least as many quadrature points as degrees of freedom in 1d,
+       * FEEvaluation can either compute the gradients with the standard
+       * sum-factorization kernels or by first transforming the values to the
+       * collocation space spanned by the quadrature points and computing the
+       * derivatives there. This variable selects the latter option. It is set
+       * by reinit() according to the operation count as given by
+       * internal::use_collocation_evaluation(), and can be changed by the
+       * kernel tuning of MatrixFree::reinit(), see
+       * MatrixFree::AdditionalData::tune_evaluation_kernels.
+       */
+      bool use_collocation_transformation;
+
       /**
        * Empty constructor. Does nothing.
        */
@@ -46,6 +46,7 @@
 #include <deal.II/lac/householder.h>
 
 #include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
 #include <deal.II/matrix_free/util.h>
 
 
@@ -203,6 +204,7 @@ namespace internal
     template <typename Number>
     ShapeInfo<Number>::ShapeInfo()
       : element_type(tensor_general)
+      , use_collocation_transformation(false)
       , n_dimensions(0)
       , n_components(0)
       , n_q_points(0)
@@ -220,6 +222,7 @@ namespace internal
       const FiniteElement<dim, spacedim> &fe_in,
       const unsigned int                  base_element_number)
       : element_type(tensor_general)
+      , use_collocation_transformation(false)
       , n_dimensions(0)
       , n_components(0)
       , n_q_points(0)
@@ -239,6 +242,8 @@ namespace internal
                               const FiniteElement<dim, spacedim> &fe_in,
                               const unsigned int base_element_number)
     {
+      use_collocation_transformation = false;
+
       // ShapeInfo for RT elements. Here, data is of size 2 instead of 1.
       // data[0] is univariate_shape_data in normal direction and
       // data[1] is univariate_shape_data in tangential direction
@@ -735,6 +740,11 @@ namespace internal
         }
 
       univariate_shape_data.element_type = this->element_type;
+
+      use_collocation_transformation =
+        (element_type == tensor_symmetric ||
+         element_type == tensor_symmetric_hermite) &&
+        use_collocation_evaluation(fe_degree, n_q_points_1d);
     }
 
 
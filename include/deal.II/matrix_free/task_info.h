@@ -25,6 +25,8 @@
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/vectorization.h>
 
+#include <memory>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -32,6 +34,13 @@ DEAL_II_NAMESPACE_OPEN
 // forward declaration
 #ifndef DOXYGEN
 class DynamicSparsityPattern;
+namespace parallel
+{
+  namespace internal
+  {
+    class TBBPartitioner;
+  }
+} // namespace parallel
 #endif
 
 
@@ -54,6 +63,12 @@ namespace internal
     virtual void
     vector_update_ghosts_finish() = 0;
 
+    /// Tests whether the communication for the update ghost values operation
+    /// has completed, without finishing it, which gives MPI the opportunity
+    /// to make progress
+    virtual bool
+    vector_update_ghosts_test() = 0;
+
     /// Starts the communication for the vector compress operation
     virtual void
     vector_compress_start() = 0;
@@ -619,6 +634,72 @@ namespace internal
        */
       bool allow_ghosted_vectors_in_loops;
 
+      /**
+       * Test the state of the ghost value exchange in between the cell
+       * ranges that overlap with communication in the serial loop, see
+       * MatrixFree::AdditionalData::poll_communication_progress.
+       */
+      bool poll_communication_progress;
+
+      /**
+       * A collection of statistics on the overlap of the ghost value exchange
+       * with computations in loop(), accumulated over all calls to loop()
+       * since the last call to clear(). The statistics are only recorded if
+       * @p poll_communication_progress is set and the loop is run without
+       * threads on more than one MPI process.
+       */
+      struct GhostExchangeStatistics
+      {
+        /**
+         * Number of loops in which the statistics were recorded.
+         */
+        unsigned int n_loops = 0;
+
+        /**
+         * Number of loops in which the ghost exchange was found to be
+         * complete before the loop started to wait for it, i.e., where the
+         * communication was completely hidden behind computations.
+         */
+        unsigned int n_loops_completed_during_computation = 0;
+
+        /**
+         * Number of tests of the state of the ghost exchange.
+         */
+        unsigned long long n_progress_tests = 0;
+
+        /**
+         * Accumulated time in seconds between the start of the ghost
+         * exchange and the point where the loop needs the ghost values, i.e.,
+         * the time available to hide the communication.
+         */
+        double overlap_time = 0.;
+
+        /**
+         * Accumulated time in seconds spent waiting for the completion of the
+         * ghost exchange, i.e., the part of the communication that was not
+         * hidden behind computations.
+         */
+        double wait_time = 0.;
+      };
+
+      /**
+       * Statistics on the overlap of the ghost exchange with computations.
+       * This variable is modified by loop(), which is why it is mutable.
+       */
+      mutable GhostExchangeStatistics ghost_exchange_statistics;
+
+      /**
+       * Affinity partitioners for the thread-parallel loops over the cells of
+       * each partition in the partition_color scheme. Reusing them from one
+       * loop to the next makes TBB schedule the same chunks of cells on the
+       * same threads, so that the data of these cells stays in the caches
+       * and the NUMA domain of the thread, see also
+       * MultithreadInfo::pin_threads(). Created on first use by loop().
+       */
+      mutable std::vector<
+        std::shared_ptr<dealii::parallel::internal::TBBPartitioner>>
+        color_partitioners;
+
       /**
        * Rank of MPI process
        */
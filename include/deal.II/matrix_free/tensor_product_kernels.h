@@ -454,6 +454,128 @@ namespace internal
 
 
 
+  /**
+   * Matrix-vector product with run-time matrix sizes applied to
+   * @p n_components vectors at once, stored one after the other in @p in and
+   * @p out with the size of the input and output dimension, respectively.
+   * This is used for elements without tensor-product structure (e.g.
+   * simplex elements), where the full shape matrix is applied to each
+   * component. Compared to calling the function above once per component,
+   * each entry of the matrix is loaded only once for all components, and
+   * two rows of the result are computed at once to reuse the loaded input
+   * values.
+   */
+  template <int  n_components,
+            bool transpose_matrix,
+            bool add,
+            typename Number,
+            typename Number2>
+  inline void
+  apply_matrix_vector_product_components(const Number2 *matrix,
+                                         const Number  *in,
+                                         Number        *out,
+                                         const int      n_rows,
+                                         const int      n_columns)
+  {
+    Assert(n_rows > 0 && n_columns > 0,
+           ExcInternalError("Empty evaluation task!"));
+
+    const int mm = transpose_matrix ? n_rows : n_columns,
+              nn = transpose_matrix ? n_columns : n_rows;
+
+    const auto matrix_entry = [&](const int col, const int i) {
+      return transpose_matrix ? matrix[i * n_columns + col] :
+                                matrix[col * n_columns + i];
+    };
+
+    int col = 0;
+    for (; col + 1 < nn; col += 2)
+      {
+        std::array<Number, n_components> res0, res1;
+        {
+          const Number2 m0 = matrix_entry(col, 0);
+          const Number2 m1 = matrix_entry(col + 1, 0);
+          for (int c = 0; c < n_components; ++c)
+            {
+              res0[c] = m0 * in[c * mm];
+              res1[c] = m1 * in[c * mm];
+            }
+        }
+        for (int i = 1; i < mm; ++i)
+          {
+            const Number2 m0 = matrix_entry(col, i);
+            const Number2 m1 = matrix_entry(col + 1, i);
+            for (int c = 0; c < n_components; ++c)
+              {
+                res0[c] += m0 * in[c * mm + i];
+                res1[c] += m1 * in[c * mm + i];
+              }
+          }
+        for (int c = 0; c < n_components; ++c)
+          if (add)
+            {
+              out[c * nn + col] += res0[c];
+              out[c * nn + col + 1] += res1[c];
+            }
+          else
+            {
+              out[c * nn + col]     = res0[c];
+              out[c * nn + col + 1] = res1[c];
+            }
+      }
+    if (col < nn)
+      {
+        std::array<Number, n_components> res0;
+        const Number2                    m0 = matrix_entry(col, 0);
+        for (int c = 0; c < n_components; ++c)
+          res0[c] = m0 * in[c * mm];
+        for (int i = 1; i < mm; ++i)
+          {
+            const Number2 m0 = matrix_entry(col, i);
+            for (int c = 0; c < n_components; ++c)
+              res0[c] += m0 * in[c * mm + i];
+          }
+        for (int c = 0; c < n_components; ++c)
+          if (add)
+            out[c * nn + col] += res0[c];
+          else
+            out[c * nn + col] = res0[c];
+      }
+  }
+
+
+
+  /**
+   * Same as above, but with the number of components given at run time. Up
+   * to three components (the typical case of vector-valued problems) are
+   * processed at once, more components are processed in groups of three.
+   */
+  template <bool transpose_matrix, bool add, typename Number, typename Number2>
+  inline void
+  apply_matrix_vector_product_components(const Number2     *matrix,
+                                         const Number      *in,
+                                         Number            *out,
+                                         const int          n_rows,
+                                         const int          n_columns,
+                                         const unsigned int n_components)
+  {
+    const int mm = transpose_matrix ? n_rows : n_columns,
+              nn = transpose_matrix ? n_columns : n_rows;
+
+    unsigned int c = 0;
+    for (; c + 3 <= n_components; c += 3, in += 3 * mm, out += 3 * nn)
+      apply_matrix_vector_product_components<3, transpose_matrix, add>(
+        matrix, in, out, n_rows, n_columns);
+    if (n_components - c == 2)
+      apply_matrix_vector_product_components<2, transpose_matrix, add>(
+        matrix, in, out, n_rows, n_columns);
+    else if (n_components - c == 1)
+      apply_matrix_vector_product_components<1, transpose_matrix, add>(
+        matrix, in, out, n_rows, n_columns);
+  }
+
+
+
   /**
    * Internal evaluator specialized for "symmetric" finite elements, i.e.,
    * when the shape functions and quadrature points are symmetric about the
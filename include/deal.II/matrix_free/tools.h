@@ -17,12 +17,19 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/std_cxx20/type_traits.h>
+
 #include <deal.II/grid/tria.h>
 
+#include <deal.II/lac/vector.h>
+
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/matrix_free/matrix_free.h>
 #include <deal.II/matrix_free/vector_access_internal.h>
 
+#include <chrono>
+#include <type_traits>
+
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -231,6 +238,72 @@ namespace MatrixFreeTools
 
 
 
+  /**
+   * Coefficients of a scalar second-order operator with the weak form
+   * $(v, c\, u) + (v, \mathbf{b}\cdot\nabla u) + (\nabla v, A \nabla u)$,
+   * as used by compute_diagonal_sum_factorized(). Each function is called
+   * with the index of the cell batch and the index of the quadrature point
+   * and returns the coefficient on the real cell. Terms whose function is
+   * empty are not part of the operator.
+   */
+  template <int dim, typename VectorizedArrayType>
+  struct SecondOrderCoefficients
+  {
+    /**
+     * The coefficient $c$ of the mass term.
+     */
+    std::function<VectorizedArrayType(const unsigned int, const unsigned int)>
+      mass;
+
+    /**
+     * The velocity $\mathbf{b}$ of the advection term.
+     */
+    std::function<Tensor<1, dim, VectorizedArrayType>(const unsigned int,
+                                                      const unsigned int)>
+      advection;
+
+    /**
+     * The tensor $A$ of the diffusion term.
+     */
+    std::function<Tensor<2, dim, VectorizedArrayType>(const unsigned int,
+                                                      const unsigned int)>
+      diffusion;
+  };
+
+
+
+  /**
+   * Compute the diagonal of the scalar operator described by @p coefficients
+   * (@p diagonal_global) for a tensor-product element such as FE_Q or
+   * FE_DGQ. Rather than applying the operator to all unit vectors of a cell
+   * as done by compute_diagonal(), at a cost of $\mathcal O(k^{2d+1})$ per
+   * cell for polynomial degree $k$, the diagonal entries are computed
+   * directly with sum factorization over the products of the 1d shape
+   * functions and their derivatives, at a cost of $\mathcal O(d^2 k^{d+1})$.
+   * Cells whose constraints couple several unknowns, like hanging nodes,
+   * fall back to the algorithm of compute_diagonal() applied to the same
+   * operator.
+   *
+   * The parameters @p dof_no, @p quad_no, and @p first_selected_component are
+   * passed to the constructor of the FEEvaluation that is internally set up.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  compute_diagonal_sum_factorized(
+    const MatrixFree<dim, Number, VectorizedArrayType>      &matrix_free,
+    VectorType                                              &diagonal_global,
+    const SecondOrderCoefficients<dim, VectorizedArrayType> &coefficients,
+    const unsigned int                                       dof_no  = 0,
+    const unsigned int                                       quad_no = 0,
+    const unsigned int first_selected_component                      = 0);
+
+
+
   /**
    * Compute the matrix representation of a linear operator (@p matrix), given
    * @p matrix_free and the local cell integral operation @p cell_operation.
@@ -420,6 +493,171 @@ namespace MatrixFreeTools
 
 
 
+  /**
+   * Perform one stage of a low-storage Runge--Kutta method as in step-67,
+   * with the vector updates merged into the loop over the cells. The
+   * function computes <code>vec_ki</code> by calling @p cell_operation
+   * with the source vector @p current_ri in a MatrixFree::cell_loop(), and
+   * then updates
+   * @f[
+   *   \text{next\_ri} = \text{solution} + \text{factor\_ai}\,
+   *   \text{vec\_ki}, \qquad
+   *   \text{solution} \mathrel{+}= \text{factor\_solution}\,
+   *   \text{vec\_ki}
+   * @f]
+   * in the `operation_after_loop` of the cell loop, i.e., as soon as the
+   * entries of <code>vec_ki</code> have been computed and while they are
+   * still in caches. This way, the vectors are streamed from main memory
+   * only once per stage. If @p factor_ai is zero, as in the last stage of
+   * the method, @p next_ri is not touched.
+   *
+   * The arguments are ordered such that the function can be used as the
+   * stage operation of TimeStepping::LowStorageRungeKutta:
+   * @code
+   * time_integrator.evolve_one_time_step(
+   *   [&](const double  stage_time,
+   *       const double  factor_solution,
+   *       const double  factor_ai,
+   *       const auto   &current_ri,
+   *       auto         &vec_ki,
+   *       auto         &solution,
+   *       auto         &next_ri) {
+   *     // set up the operator for stage_time, then
+   *     MatrixFreeTools::perform_low_storage_runge_kutta_stage(
+   *       matrix_free, cell_operation, factor_solution, factor_ai,
+   *       current_ri, vec_ki, solution, next_ri);
+   *   },
+   *   time, time_step, solution, vec_ri, vec_ki);
+   * @endcode
+   *
+   * The @p cell_operation must compute the complete right-hand side of the
+   * ODE on its cells, including the inverse of the mass matrix, and write it
+   * into its destination vector with FEEvaluation::distribute_local_to_global()
+   * or FEEvaluation::set_dof_values(). The vector @p next_ri may be the same
+   * object as @p current_ri, since the `operation_after_loop` only runs once
+   * the cell loop has finished reading the respective entries.
+   *
+   * @param dof_no The index of the DoFHandler within @p matrix_free that
+   * the vectors are associated with.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  perform_low_storage_runge_kutta_stage(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std_cxx20::type_identity_t<
+      std::function<void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+                         VectorType &,
+                         const VectorType &,
+                         const std::pair<unsigned int, unsigned int> &)>>
+                      &cell_operation,
+    const Number       factor_solution,
+    const Number       factor_ai,
+    const VectorType  &current_ri,
+    VectorType        &vec_ki,
+    VectorType        &solution,
+    VectorType        &next_ri,
+    const unsigned int dof_no = 0);
+
+
+
+  /**
+   * Call @p function with an argument of type
+   * `std::integral_constant<int, degree>`, turning the run-time polynomial
+   * degree @p degree into a compile-time constant. The degrees between
+   * @p min_degree and @p max_degree are compiled into the calling code, and
+   * all other degrees call @p function with the value -1, for which
+   * FEEvaluation falls back to its pre-compiled kernels or the evaluation
+   * with run-time bounds.
+   *
+   * This function is meant to be used in the hp-adaptive case, where each
+   * cell range passed to MatrixFree::cell_loop() contains cells of a single
+   * element, to run the complete local operation, including the work at the
+   * quadrature points, with templated FEEvaluation objects. See the
+   * documentation of FEEvaluation for an example.
+   */
+  template <int min_degree, int max_degree, typename Function>
+  void
+  call_with_degree(const unsigned int degree, const Function &function);
+
+
+
+  /**
+   * Evaluate a quantity derived from the finite element field @p solution,
+   * such as the vorticity of a velocity field or the stresses of a
+   * displacement field, for graphical output. This is the matrix-free
+   * counterpart of a DataPostprocessor: rather than evaluating the field
+   * with FEValues cell by cell and passing the values to
+   * DataPostprocessor::evaluate_vector_field(), the field is evaluated with
+   * FEEvaluation on batches of cells, and @p quantity is called for each
+   * quadrature point with VectorizedArray data of several cells at once. It
+   * receives the FEEvaluation object of the solution, from which it can
+   * query values, gradients, or Hessians according to
+   * @p evaluation_flags, and the index of the quadrature point.
+   *
+   * The result is written into @p derived_quantity, a vector of the
+   * DoFHandler with index @p dof_no_derived in @p matrix_free, which has to
+   * be an FE_DGQ element of some degree $k$, or an FESystem of
+   * @p n_components_out copies of it. The quadrature with index @p quad_no
+   * has to be QIterated<1>(QTrapezoid<1>(), k), i.e., its points are the
+   * support points of the FE_DGQ element, so that the computed values are
+   * the nodal values of the derived field. They are also the points at
+   * which DataOut::build_patches() evaluates the data with $k$
+   * subdivisions, so that
+   * @code
+   * MatrixFreeTools::evaluate_derived_quantity<dim, dim, 1>(
+   *   matrix_free,
+   *   [](const auto &phi, const unsigned int q) {
+   *     return phi.get_gradient(q)[0][1] - phi.get_gradient(q)[1][0];
+   *   },
+   *   EvaluationFlags::gradients,
+   *   velocity,
+   *   vorticity);
+   *
+   * DataOut<dim> data_out;
+   * data_out.add_data_vector(dof_handler_dg, vorticity, "vorticity");
+   * data_out.build_patches(k);
+   * @endcode
+   * gives the same output as a DataPostprocessor computing the vorticity
+   * of @p velocity.
+   *
+   * @param dof_no The index of the DoFHandler of @p solution within
+   * @p matrix_free.
+   */
+  template <int dim,
+            int n_components,
+            int n_components_out,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  evaluate_derived_quantity(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std_cxx20::type_identity_t<std::function<
+      typename FEEvaluation<dim,
+                            -1,
+                            0,
+                            n_components_out,
+                            Number,
+                            VectorizedArrayType>::value_type(
+        const FEEvaluation<dim,
+                           -1,
+                           0,
+                           n_components,
+                           Number,
+                           VectorizedArrayType> &,
+        const unsigned int)>>             &quantity,
+    const EvaluationFlags::EvaluationFlags evaluation_flags,
+    const VectorType                      &solution,
+    VectorType                            &derived_quantity,
+    const unsigned int                     dof_no         = 0,
+    const unsigned int                     dof_no_derived = 1,
+    const unsigned int                     quad_no        = 0);
+
+
+
   /**
    * A wrapper around MatrixFree to help users to deal with DoFHandler
    * objects involving cells without degrees of freedom, i.e.,
@@ -601,6 +839,156 @@ namespace MatrixFreeTools
     unsigned int fe_index_valid;
   };
 
+
+
+  /**
+   * A wrapper around MatrixFree that measures the time spent in the cell
+   * operations of a cell loop and attributes it to the active cells of the
+   * triangulation. The time of a range of cell batches is split evenly among
+   * the batches in the range and the cells within each batch. The
+   * accumulated costs can be passed to
+   * parallel::CellWeights::measured_cost_weighting(), such that the
+   * subsequent repartitioning balances the measured work rather than an
+   * a-priori guess, which is useful for hp-adaptive computations or cells
+   * with different quadrature formulas.
+   * @code
+   * MatrixFreeTools::CellCostRecorder<dim, double> recorder;
+   * recorder.reinit(matrix_free);
+   * for (unsigned int i = 0; i < n_iterations; ++i)
+   *   recorder.cell_loop(cell_operation, dst, src);
+   *
+   * cell_weights.reinit(dof_handler,
+   *                     parallel::CellWeights<dim>::measured_cost_weighting(
+   *                       recorder.get_cell_costs(), 1e6));
+   * triangulation.repartition();
+   * @endcode
+   *
+   * @note The measured times are subject to the resolution of the timer and
+   *   to fluctuations of the machine, so the cell loop should be run a
+   *   number of times before the costs are used.
+   */
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType = VectorizedArray<Number>>
+  class CellCostRecorder
+  {
+  public:
+    /**
+     * Reinitialize class based on a given MatrixFree instance and reset the
+     * recorded costs. The parameter @p dof_index selects the DoFHandler
+     * within @p matrix_free whose triangulation the costs refer to.
+     */
+    void
+    reinit(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+           const unsigned int                                  dof_index = 0)
+    {
+      this->matrix_free = &matrix_free;
+      this->dof_index   = dof_index;
+      cost_per_cell_batch.assign(matrix_free.n_cell_batches(), 0.);
+    }
+
+    /**
+     * Set the recorded costs to zero.
+     */
+    void
+    reset()
+    {
+      std::fill(cost_per_cell_batch.begin(), cost_per_cell_batch.end(), 0.);
+    }
+
+    /**
+     * Loop over all cells and record the time spent in @p cell_operation.
+     *
+     * For the meaning of the parameters see MatrixFree::cell_loop().
+     */
+    template <typename VectorTypeOut, typename VectorTypeIn>
+    void
+    cell_loop(const std::function<void(
+                const MatrixFree<dim, Number, VectorizedArrayType> &,
+                VectorTypeOut &,
+                const VectorTypeIn &,
+                const std::pair<unsigned int, unsigned int> &)> &cell_operation,
+              VectorTypeOut                                     &dst,
+              const VectorTypeIn                                &src,
+              const bool zero_dst_vector = false)
+    {
+      Assert(matrix_free != nullptr, ExcNotInitialized());
+      AssertDimension(cost_per_cell_batch.size(),
+                      matrix_free->n_cell_batches());
+
+      // The ranges passed to the cell operation are disjoint, so the
+      // entries can be updated from several threads without
+      // synchronization.
+      const auto timed_cell_operation = [&](const auto &matrix_free,
+                                            auto       &dst,
+                                            const auto &src,
+                                            const auto &range) {
+        const auto start = std::chrono::steady_clock::now();
+
+        cell_operation(matrix_free, dst, src, range);
+
+        if (range.second > range.first)
+          {
+            const double time_per_batch =
+              std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                            start)
+                .count() /
+              (range.second - range.first);
+            for (unsigned int cell = range.first; cell < range.second; ++cell)
+              cost_per_cell_batch[cell] += time_per_batch;
+          }
+      };
+
+      matrix_free->template cell_loop<VectorTypeOut, VectorTypeIn>(
+        timed_cell_operation, dst, src, zero_dst_vector);
+    }
+
+    /**
+     * Return the accumulated time in seconds spent on each active cell of
+     * the triangulation, indexed by CellAccessor::active_cell_index(). The
+     * entries of cells not handled by the present process are zero.
+     */
+    Vector<float>
+    get_cell_costs() const
+    {
+      Assert(matrix_free != nullptr, ExcNotInitialized());
+
+      const auto &dof_handler = matrix_free->get_dof_handler(dof_index);
+      Vector<float> cost_per_active_cell(
+        dof_handler.get_triangulation().n_active_cells());
+
+      for (unsigned int cell = 0; cell < cost_per_cell_batch.size(); ++cell)
+        {
+          const unsigned int n_lanes =
+            matrix_free->n_active_entries_per_cell_batch(cell);
+          for (unsigned int v = 0; v < n_lanes; ++v)
+            cost_per_active_cell[matrix_free
+                                   ->get_cell_iterator(cell, v, dof_index)
+                                   ->active_cell_index()] +=
+              cost_per_cell_batch[cell] / n_lanes;
+        }
+
+      return cost_per_active_cell;
+    }
+
+  private:
+    /**
+     * Pointer to the underlying MatrixFree object.
+     */
+    SmartPointer<const MatrixFree<dim, Number, VectorizedArrayType>>
+      matrix_free;
+
+    /**
+     * Index of the DoFHandler within MatrixFree the costs refer to.
+     */
+    unsigned int dof_index = 0;
+
+    /**
+     * The accumulated time in seconds spent on each cell batch.
+     */
+    std::vector<double> cost_per_cell_batch;
+  };
+
   // implementations
 
 #ifndef DOXYGEN
@@ -1330,6 +1718,188 @@ namespace MatrixFreeTools
       return init_data.shape_info->dofs_per_component_on_cell == 0;
     }
 
+
+
+    /**
+     * Add to @p diagonal the contraction
+     * $\sum_q c_q \prod_{d} M_d(i_d, q_d)$ over all quadrature points, where
+     * the 1d matrices @p matrices have the quadrature index running fastest,
+     * as in UnivariateShapeData. The contraction is performed dimension by
+     * dimension, using the arrays @p tmp0 and @p tmp1 with
+     * $\max(n_\text{dofs,1d}, n_\text{q,1d})^\text{dim}$ entries each as
+     * intermediate storage.
+     */
+    template <int dim, typename Number, typename VectorizedArrayType>
+    void
+    add_diagonal_contraction(
+      const std::array<const Number *, dim> &matrices,
+      const unsigned int                     n_dofs_1d,
+      const unsigned int                     n_q_points_1d,
+      const VectorizedArrayType             *coefficients,
+      VectorizedArrayType                   *tmp0,
+      VectorizedArrayType                   *tmp1,
+      VectorizedArrayType                   *diagonal)
+    {
+      std::array<unsigned int, dim> extents;
+      extents.fill(n_q_points_1d);
+
+      const VectorizedArrayType *in  = coefficients;
+      VectorizedArrayType       *out = tmp0;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          unsigned int n_pre = 1, n_post = 1;
+          for (unsigned int e = 0; e < d; ++e)
+            n_pre *= extents[e];
+          for (unsigned int e = d + 1; e < dim; ++e)
+            n_post *= extents[e];
+
+          const Number *matrix = matrices[d];
+          for (unsigned int k = 0; k < n_post; ++k)
+            for (unsigned int i = 0; i < n_dofs_1d; ++i)
+              for (unsigned int j = 0; j < n_pre; ++j)
+                {
+                  VectorizedArrayType sum = VectorizedArrayType();
+                  for (unsigned int q = 0; q < n_q_points_1d; ++q)
+                    sum += matrix[i * n_q_points_1d + q] *
+                           in[(k * n_q_points_1d + q) * n_pre + j];
+                  out[(k * n_dofs_1d + i) * n_pre + j] = sum;
+                }
+
+          extents[d] = n_dofs_1d;
+          in         = out;
+          out        = (out == tmp0) ? tmp1 : tmp0;
+        }
+
+      for (unsigned int i = 0; i < Utilities::pow(n_dofs_1d, dim); ++i)
+        diagonal[i] += in[i];
+    }
+
+
+
+    /**
+     * Compute the diagonal of the element matrix of the operator given by
+     * @p coefficients on the cell batch @p phi is currently initialized
+     * with, writing the result into the dof values of @p phi. The arrays
+     * @p products hold the 1d products of values times values, values times
+     * gradients and gradients times gradients of the shape functions, and
+     * @p scratch is used as temporary storage.
+     */
+    template <typename FEEvaluationType, typename Number>
+    void
+    compute_cell_diagonal_sum_factorized(
+      FEEvaluationType &phi,
+      const SecondOrderCoefficients<FEEvaluationType::dimension,
+                                    typename FEEvaluationType::NumberType>
+                                                   &coefficients,
+      const std::array<AlignedVector<Number>, 3>   &products,
+      const unsigned int                            n_dofs_1d,
+      const unsigned int                            n_q_points_1d,
+      AlignedVector<typename FEEvaluationType::NumberType> &scratch)
+    {
+      constexpr int dim = FEEvaluationType::dimension;
+      using VectorizedArrayType = typename FEEvaluationType::NumberType;
+
+      const unsigned int n_q_points = phi.n_q_points;
+      const unsigned int cell       = phi.get_current_cell_index();
+
+      // coefficients of the terms with reference-cell shape functions: the
+      // mass term, dim advection terms, and dim*(dim+1)/2 diffusion terms
+      // with the mixed derivatives summed up
+      const unsigned int n_terms = 1 + dim + (dim * (dim + 1)) / 2;
+      const unsigned int n_tmp =
+        Utilities::pow(std::max(n_dofs_1d, n_q_points_1d), dim);
+      scratch.resize_fast(n_terms * n_q_points + 2 * n_tmp);
+      VectorizedArrayType *tmp0 = scratch.data() + n_terms * n_q_points;
+      VectorizedArrayType *tmp1 = tmp0 + n_tmp;
+
+      for (unsigned int t = 0; t < n_terms * n_q_points; ++t)
+        scratch[t] = VectorizedArrayType();
+
+      for (unsigned int q = 0; q < n_q_points; ++q)
+        {
+          const VectorizedArrayType          JxW = phi.JxW(q);
+          const Tensor<2, dim, VectorizedArrayType> inv_jac =
+            phi.inverse_jacobian(q);
+
+          if (coefficients.mass)
+            scratch[q] = coefficients.mass(cell, q) * JxW;
+
+          if (coefficients.advection)
+            {
+              const Tensor<1, dim, VectorizedArrayType> b =
+                coefficients.advection(cell, q);
+              for (unsigned int e = 0; e < dim; ++e)
+                {
+                  VectorizedArrayType sum = VectorizedArrayType();
+                  for (unsigned int d = 0; d < dim; ++d)
+                    sum += b[d] * inv_jac[d][e];
+                  scratch[(1 + e) * n_q_points + q] = sum * JxW;
+                }
+            }
+
+          if (coefficients.diffusion)
+            {
+              const Tensor<2, dim, VectorizedArrayType> a =
+                transpose(inv_jac) * coefficients.diffusion(cell, q) *
+                inv_jac;
+              for (unsigned int e = 0, t = 1 + dim; e < dim; ++e)
+                for (unsigned int f = e; f < dim; ++f, ++t)
+                  scratch[t * n_q_points + q] =
+                    (e == f ? a[e][e] : a[e][f] + a[f][e]) * JxW;
+            }
+        }
+
+      VectorizedArrayType *diagonal = phi.begin_dof_values();
+      for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+        diagonal[i] = VectorizedArrayType();
+
+      std::array<const Number *, dim> matrices;
+      if (coefficients.mass)
+        {
+          matrices.fill(products[0].data());
+          add_diagonal_contraction<dim>(matrices,
+                                        n_dofs_1d,
+                                        n_q_points_1d,
+                                        scratch.data(),
+                                        tmp0,
+                                        tmp1,
+                                        diagonal);
+        }
+
+      if (coefficients.advection)
+        for (unsigned int e = 0; e < dim; ++e)
+          {
+            matrices.fill(products[0].data());
+            matrices[e] = products[1].data();
+            add_diagonal_contraction<dim>(matrices,
+                                          n_dofs_1d,
+                                          n_q_points_1d,
+                                          scratch.data() +
+                                            (1 + e) * n_q_points,
+                                          tmp0,
+                                          tmp1,
+                                          diagonal);
+          }
+
+      if (coefficients.diffusion)
+        for (unsigned int e = 0, t = 1 + dim; e < dim; ++e)
+          for (unsigned int f = e; f < dim; ++f, ++t)
+            {
+              matrices.fill(products[0].data());
+              if (e == f)
+                matrices[e] = products[2].data();
+              else
+                matrices[e] = matrices[f] = products[1].data();
+              add_diagonal_contraction<dim>(matrices,
+                                            n_dofs_1d,
+                                            n_q_points_1d,
+                                            scratch.data() + t * n_q_points,
+                                            tmp0,
+                                            tmp1,
+                                            diagonal);
+            }
+    }
+
   } // namespace internal
 
   template <int dim,
@@ -1766,6 +2336,161 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  compute_diagonal_sum_factorized(
+    const MatrixFree<dim, Number, VectorizedArrayType>      &matrix_free,
+    VectorType                                              &diagonal_global,
+    const SecondOrderCoefficients<dim, VectorizedArrayType> &coefficients,
+    const unsigned int                                       dof_no,
+    const unsigned int                                       quad_no,
+    const unsigned int first_selected_component)
+  {
+    using FEEvaluationType = FEEvaluation<dim,
+                                          fe_degree,
+                                          n_q_points_1d,
+                                          1,
+                                          Number,
+                                          VectorizedArrayType>;
+
+    int dummy = 0;
+
+    std::array<typename dealii::internal::BlockVectorSelector<
+                 VectorType,
+                 IsBlockVector<VectorType>::value>::BaseVectorType *,
+               1>
+      diagonal_global_components;
+    diagonal_global_components[0] = dealii::internal::
+      BlockVectorSelector<VectorType, IsBlockVector<VectorType>::value>::
+        get_vector_component(diagonal_global, first_selected_component);
+
+    const auto &dof_info = matrix_free.get_dof_info(dof_no);
+    dealii::internal::check_vector_compatibility(
+      *diagonal_global_components[0], matrix_free, dof_info);
+
+    // the operator applied column by column on cells with general
+    // constraints
+    const auto cell_operation = [&](FEEvaluationType &phi) {
+      const unsigned int cell = phi.get_current_cell_index();
+      phi.evaluate(
+        (coefficients.mass ? EvaluationFlags::values :
+                             EvaluationFlags::nothing) |
+        (coefficients.advection || coefficients.diffusion ?
+           EvaluationFlags::gradients :
+           EvaluationFlags::nothing));
+      for (const unsigned int q : phi.quadrature_point_indices())
+        {
+          if (coefficients.mass || coefficients.advection)
+            {
+              VectorizedArrayType value = VectorizedArrayType();
+              if (coefficients.mass)
+                value += coefficients.mass(cell, q) * phi.get_value(q);
+              if (coefficients.advection)
+                value += coefficients.advection(cell, q) * phi.get_gradient(q);
+              phi.submit_value(value, q);
+            }
+          if (coefficients.diffusion)
+            phi.submit_gradient(coefficients.diffusion(cell, q) *
+                                  phi.get_gradient(q),
+                                q);
+        }
+      phi.integrate(
+        (coefficients.mass || coefficients.advection ?
+           EvaluationFlags::values :
+           EvaluationFlags::nothing) |
+        (coefficients.diffusion ? EvaluationFlags::gradients :
+                                  EvaluationFlags::nothing));
+    };
+
+    using Helper = internal::ComputeDiagonalHelper<FEEvaluationType, false>;
+
+    Threads::ThreadLocalStorage<Helper> scratch_data;
+
+    const auto cell_operation_wrapped =
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+          VectorType &,
+          const int &,
+          const std::pair<unsigned int, unsigned int> &range) {
+        // shortcut for FE_Nothing cells
+        if (internal::is_fe_nothing<false>(matrix_free,
+                                           range,
+                                           dof_no,
+                                           quad_no,
+                                           first_selected_component,
+                                           fe_degree,
+                                           n_q_points_1d))
+          return;
+
+        Helper &helper = scratch_data.get();
+
+        FEEvaluationType phi(
+          matrix_free, range, dof_no, quad_no, first_selected_component);
+        helper.initialize(phi);
+
+        const auto &shape_info = phi.get_shape_info();
+        Assert(shape_info.element_type <= dealii::internal::
+                                            MatrixFreeFunctions::
+                                              tensor_symmetric_no_collocation,
+               ExcNotImplemented());
+        const auto        &shape_data  = shape_info.data.front();
+        const unsigned int n_dofs_1d   = shape_data.fe_degree + 1;
+        const unsigned int n_points_1d = shape_data.n_q_points_1d;
+        AssertDimension(Utilities::pow(n_dofs_1d, dim), phi.dofs_per_cell);
+
+        // products of values and gradients of the 1d shape functions
+        std::array<AlignedVector<Number>, 3> products;
+        for (auto &product : products)
+          product.resize(n_dofs_1d * n_points_1d);
+        for (unsigned int i = 0; i < n_dofs_1d * n_points_1d; ++i)
+          {
+            const Number value    = shape_data.shape_values[i];
+            const Number gradient = shape_data.shape_gradients[i];
+            products[0][i]        = value * value;
+            products[1][i]        = value * gradient;
+            products[2][i]        = gradient * gradient;
+          }
+
+        AlignedVector<VectorizedArrayType> scratch;
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell)
+          {
+            helper.reinit(cell);
+
+            if (helper.use_fast_path())
+              {
+                internal::compute_cell_diagonal_sum_factorized(phi,
+                                                               coefficients,
+                                                               products,
+                                                               n_dofs_1d,
+                                                               n_points_1d,
+                                                               scratch);
+                phi.distribute_local_to_global(diagonal_global_components);
+              }
+            else
+              {
+                for (unsigned int i = 0; i < phi.dofs_per_cell; ++i)
+                  {
+                    helper.prepare_basis_vector(i);
+                    cell_operation(phi);
+                    helper.submit();
+                  }
+
+                helper.distribute_local_to_global(diagonal_global_components);
+              }
+          }
+      };
+
+    matrix_free.template cell_loop<VectorType, int>(cell_operation_wrapped,
+                                                    diagonal_global,
+                                                    dummy,
+                                                    false);
+  }
+
   namespace internal
   {
     /**
@@ -2335,6 +3060,153 @@ namespace MatrixFreeTools
       first_selected_component);
   }
 
+
+
+  template <int dim,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  perform_low_storage_runge_kutta_stage(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std_cxx20::type_identity_t<
+      std::function<void(const MatrixFree<dim, Number, VectorizedArrayType> &,
+                         VectorType &,
+                         const VectorType &,
+                         const std::pair<unsigned int, unsigned int> &)>>
+                      &cell_operation,
+    const Number       factor_solution,
+    const Number       factor_ai,
+    const VectorType  &current_ri,
+    VectorType        &vec_ki,
+    VectorType        &solution,
+    VectorType        &next_ri,
+    const unsigned int dof_no)
+  {
+    matrix_free.template cell_loop<VectorType, VectorType>(
+      cell_operation,
+      vec_ki,
+      current_ri,
+      [&](const unsigned int start_range, const unsigned int end_range) {
+        for (unsigned int i = start_range; i < end_range; ++i)
+          vec_ki.local_element(i) = Number();
+      },
+      [&](const unsigned int start_range, const unsigned int end_range) {
+        if (factor_ai == Number())
+          {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              solution.local_element(i) +=
+                factor_solution * vec_ki.local_element(i);
+          }
+        else
+          {
+            DEAL_II_OPENMP_SIMD_PRAGMA
+            for (unsigned int i = start_range; i < end_range; ++i)
+              {
+                const Number k_i          = vec_ki.local_element(i);
+                const Number sol_i        = solution.local_element(i);
+                solution.local_element(i) = sol_i + factor_solution * k_i;
+                next_ri.local_element(i)  = sol_i + factor_ai * k_i;
+              }
+          }
+      },
+      dof_no);
+  }
+
+
+
+  template <int dim,
+            int n_components,
+            int n_components_out,
+            typename Number,
+            typename VectorizedArrayType,
+            typename VectorType>
+  void
+  evaluate_derived_quantity(
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+    const std_cxx20::type_identity_t<std::function<
+      typename FEEvaluation<dim,
+                            -1,
+                            0,
+                            n_components_out,
+                            Number,
+                            VectorizedArrayType>::value_type(
+        const FEEvaluation<dim,
+                           -1,
+                           0,
+                           n_components,
+                           Number,
+                           VectorizedArrayType> &,
+        const unsigned int)>>             &quantity,
+    const EvaluationFlags::EvaluationFlags evaluation_flags,
+    const VectorType                      &solution,
+    VectorType                            &derived_quantity,
+    const unsigned int                     dof_no,
+    const unsigned int                     dof_no_derived,
+    const unsigned int                     quad_no)
+  {
+    matrix_free.template cell_loop<VectorType, VectorType>(
+      [&](const MatrixFree<dim, Number, VectorizedArrayType> &data,
+          VectorType                                         &dst,
+          const VectorType                                   &src,
+          const std::pair<unsigned int, unsigned int>        &cell_range) {
+        FEEvaluation<dim, -1, 0, n_components, Number, VectorizedArrayType>
+          phi(data, cell_range, dof_no, quad_no);
+        FEEvaluation<dim, -1, 0, n_components_out, Number, VectorizedArrayType>
+          phi_derived(data, cell_range, dof_no_derived, quad_no);
+        Assert(phi_derived.dofs_per_component == phi_derived.n_q_points,
+               ExcMessage("The derived quantity must be represented by an "
+                          "FE_DGQ element whose support points are the "
+                          "quadrature points."));
+
+        for (unsigned int cell = cell_range.first; cell < cell_range.second;
+             ++cell)
+          {
+            phi.reinit(cell);
+            phi.gather_evaluate(src, evaluation_flags);
+            phi_derived.reinit(cell);
+
+            // The quadrature points are the support points of the element of
+            // the derived quantity, so the values at the quadrature points
+            // are its values on the degrees of freedom
+            VectorizedArrayType *dof_values = phi_derived.begin_dof_values();
+            const unsigned int   n_q_points = phi_derived.n_q_points;
+            for (unsigned int q = 0; q < n_q_points; ++q)
+              {
+                const auto value = quantity(phi, q);
+                if constexpr (n_components_out == 1)
+                  dof_values[q] = value;
+                else
+                  for (unsigned int c = 0; c < n_components_out; ++c)
+                    dof_values[c * n_q_points + q] = value[c];
+              }
+            phi_derived.set_dof_values(dst);
+          }
+      },
+      derived_quantity,
+      solution);
+  }
+
+
+
+  template <int min_degree, int max_degree, typename Function>
+  void
+  call_with_degree(const unsigned int degree, const Function &function)
+  {
+    static_assert(min_degree >= 1, "The smallest degree must be positive.");
+
+    if constexpr (min_degree > max_degree)
+      {
+        (void)degree;
+        function(std::integral_constant<int, -1>());
+      }
+    else if (degree == static_cast<unsigned int>(min_degree))
+      function(std::integral_constant<int, min_degree>());
+    else
+      call_with_degree<min_degree + 1, max_degree>(degree, function);
+  }
+
 #endif // DOXYGEN
 
 } // namespace MatrixFreeTools
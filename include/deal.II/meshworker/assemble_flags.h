@@ -85,6 +85,45 @@ namespace MeshWorker
      */
     cells_after_faces = 0x0080,
 
+    /**
+     * Visit the cells grouped by their active finite element index, rather
+     * than in the order given by the iterator range, so that consecutive
+     * cells, and hence the chunks of cells handed to the threads, use the
+     * same finite element. For hp-assembly with hp::FEValues, this keeps the
+     * shape function data of a single element in the caches while a chunk
+     * is processed, rather than alternating between the data of different
+     * elements. Within a group, the cells are visited in the order of the
+     * iterator range. This flag has no effect for iterators that do not
+     * provide an active finite element index, e.g., those of a
+     * Triangulation.
+     */
+    group_cells_by_fe_index = 0x0100,
+
+    /**
+     * Partition the cells into colors such that the copier calls of two cells
+     * of the same color never write into the same data, and let
+     * WorkStream::run() process the colors one after the other, running the
+     * worker and the copier of the cells within a color concurrently (see
+     * the variant of WorkStream::run() for colored iterators). This removes
+     * the serialization of the copier, which otherwise limits the parallel
+     * efficiency of assembly loops with cheap workers, such as those with
+     * face terms.
+     *
+     * Two cells are considered to conflict if they share a vertex with any
+     * of the cells whose data the copier of the respective other cell may
+     * write into: the cell itself, the neighbors across its faces if work
+     * on faces is requested, and the parents of these cells, which covers
+     * the entries introduced by hanging node constraints. In other words,
+     * the copier must only write into data associated with these cells,
+     * e.g., through AffineConstraints::distribute_local_to_global(), but not
+     * accumulate into data shared by all cells, such as a single scalar.
+     *
+     * If this flag is given together with group_cells_by_fe_index, the
+     * cells are grouped by their active finite element index within each
+     * color.
+     */
+    color_cells = 0x0200,
+
     /**
      * Combination of flags to determine if any work on cells is done.
      */
@@ -129,6 +168,10 @@ namespace MeshWorker
       s << "|ghost_faces_both";
     if (u & assemble_boundary_faces)
       s << "|boundary_faces";
+    if (u & group_cells_by_fe_index)
+      s << "|group_cells_by_fe_index";
+    if (u & color_cells)
+      s << "|color_cells";
     return s;
   }
 
@@ -18,6 +18,7 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/graph_coloring.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/types.h>
 #include <deal.II/base/work_stream.h>
@@ -31,8 +32,11 @@
 #include <deal.II/meshworker/local_integrator.h>
 #include <deal.II/meshworker/loop.h>
 
+#include <algorithm>
 #include <functional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -96,6 +100,15 @@ namespace MeshWorker
       // remove the template layers to retrieve the underlying iterator type.
       using type = typename CellIteratorBaseType<CellIteratorType>::type;
     };
+
+
+    /**
+     * The type of the active finite element index of a cell iterator, used
+     * to detect whether the iterator provides such an index.
+     */
+    template <typename CellIteratorType>
+    using active_fe_index_t =
+      decltype(std::declval<const CellIteratorType &>()->active_fe_index());
   } // namespace internal
 
 #ifdef DOXYGEN
@@ -190,6 +203,12 @@ namespace MeshWorker
    * assumed to integrate all face terms at once (and add contributions to both
    * sides of the face in a discontinuous Galerkin setting).
    *
+   * By default, the copier is called for one cell at a time. If the flag
+   * AssembleFlags::color_cells is given, the cells are instead partitioned
+   * into colors of cells whose copiers do not write into the same data, and
+   * the copiers of the cells of one color run concurrently. See the
+   * documentation of that flag for the requirements on the copier.
+   *
    * This method is equivalent to the WorkStream::run() method when
    * AssembleFlags contains only @p assemble_own_cells, and can be used as a
    * drop-in replacement for that method.
@@ -626,6 +645,120 @@ namespace MeshWorker
         cell_worker(cell, scratch, copy);
     };
 
+    // The active finite element index by which cells are grouped. Cells
+    // without an index, i.e., inactive or artificial ones, are visited last.
+    const auto get_fe_index_for_grouping = [](const auto &cell) {
+      return (cell->is_active() && cell->is_artificial() == false) ?
+               cell->active_fe_index() :
+               numbers::invalid_fe_index;
+    };
+
+    if (flags & color_cells)
+      {
+        std::vector<CellIteratorBaseType> cells;
+        for (CellIteratorType cell = begin; cell != end; ++cell)
+          cells.emplace_back(cell);
+        if (cells.empty())
+          return;
+
+        // The copier of a cell may write into data associated with the cell,
+        // the neighbors across the faces it works on, and, through hanging
+        // node constraints, the parents of these cells. Two cells conflict
+        // if any of these cells share a vertex.
+        using Iterator = typename std::vector<CellIteratorBaseType>::iterator;
+        const auto get_conflict_indices = [&](const Iterator &it) {
+          const CellIteratorBaseType          &cell = *it;
+          std::vector<types::global_dof_index> conflict_indices;
+          const auto add_vertices = [&](const auto &writing_cell) {
+            for (const unsigned int v : writing_cell->vertex_indices())
+              conflict_indices.push_back(writing_cell->vertex_index(v));
+            if (writing_cell->level() > 0)
+              {
+                const auto parent = writing_cell->parent();
+                for (const unsigned int v : parent->vertex_indices())
+                  conflict_indices.push_back(parent->vertex_index(v));
+              }
+          };
+
+          add_vertices(cell);
+          if (flags & work_on_faces)
+            for (const unsigned int face_no : cell->face_indices())
+              if (!cell->at_boundary(face_no) ||
+                  cell->has_periodic_neighbor(face_no))
+                add_vertices(cell->neighbor_or_periodic_neighbor(face_no));
+
+          std::sort(conflict_indices.begin(), conflict_indices.end());
+          conflict_indices.erase(std::unique(conflict_indices.begin(),
+                                             conflict_indices.end()),
+                                 conflict_indices.end());
+          return conflict_indices;
+        };
+
+        std::vector<std::vector<Iterator>> colored_cells =
+          GraphColoring::make_graph_coloring(cells.begin(),
+                                             cells.end(),
+                                             get_conflict_indices);
+
+        if constexpr (dealii::internal::is_supported_operation<
+                        internal::active_fe_index_t,
+                        CellIteratorBaseType>)
+          if (flags & group_cells_by_fe_index)
+            for (auto &color : colored_cells)
+              std::stable_sort(color.begin(),
+                               color.end(),
+                               [&](const Iterator &a, const Iterator &b) {
+                                 return get_fe_index_for_grouping(*a) <
+                                        get_fe_index_for_grouping(*b);
+                               });
+
+        WorkStream::run(
+          colored_cells,
+          [&](const Iterator &it, ScratchData &scratch, CopyData &copy) {
+            cell_action(*it, scratch, copy);
+          },
+          copier,
+          sample_scratch_data,
+          sample_copy_data,
+          queue_length,
+          chunk_size);
+        return;
+      }
+
+    if constexpr (dealii::internal::is_supported_operation<
+                    internal::active_fe_index_t,
+                    CellIteratorBaseType>)
+      if (flags & group_cells_by_fe_index)
+        {
+          // Sort the cells by their active finite element index, keeping
+          // the order within each group.
+          std::vector<std::pair<types::fe_index, CellIteratorBaseType>> cells;
+          for (CellIteratorType cell = begin; cell != end; ++cell)
+            {
+              const CellIteratorBaseType &base_cell = cell;
+              cells.emplace_back(get_fe_index_for_grouping(base_cell),
+                                 base_cell);
+            }
+          std::stable_sort(cells.begin(),
+                           cells.end(),
+                           [](const auto &a, const auto &b) {
+                             return a.first < b.first;
+                           });
+
+          using Iterator = typename decltype(cells)::const_iterator;
+          WorkStream::run(
+            cells.cbegin(),
+            cells.cend(),
+            [&](const Iterator &it, ScratchData &scratch, CopyData &copy) {
+              cell_action(it->second, scratch, copy);
+            },
+            copier,
+            sample_scratch_data,
+            sample_copy_data,
+            queue_length,
+            chunk_size);
+          return;
+        }
+
     // Submit to workstream
     WorkStream::run(begin,
                     end,
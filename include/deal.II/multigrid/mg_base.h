@@ -84,6 +84,20 @@ public:
              VectorType        &dst,
              const VectorType  &src) const = 0;
 
+  /**
+   * Compute the residual <tt>dst = rhs - A src</tt> on a certain level.
+   *
+   * The default implementation calls vmult() and then combines the result
+   * with @p rhs, which reads and writes @p dst a second time. Derived
+   * classes can override this function to compute the residual within a
+   * single pass over the vectors.
+   */
+  virtual void
+  residual(const unsigned int level,
+           VectorType        &dst,
+           const VectorType  &src,
+           const VectorType  &rhs) const;
+
   /**
    * Return the minimal level for which matrices are stored.
    */
@@ -18,9 +18,15 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/householder.h>
 #include <deal.II/lac/linear_operator.h>
+#include <deal.II/lac/sparse_direct.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
 
 #include <deal.II/multigrid/mg_base.h>
 
@@ -238,6 +244,89 @@ private:
   LAPACKFullMatrix<number> matrix;
 };
 
+/**
+ * Coarse grid solver using the sparse direct solver SparseDirectUMFPACK.
+ *
+ * The coarse matrix is passed to initialize() as a SparseMatrix in the
+ * global numbering of the coarse level. In parallel computations, each
+ * process passes a matrix of full size that contains its own contributions,
+ * e.g. the ones of its locally owned cells, and the sum of these matrices is
+ * gathered on the first process of the given communicator. Only this process
+ * stores the factorization and performs the solves, which avoids a
+ * distributed direct solver for the typically small coarse problems of
+ * global-coarsening multigrid.
+ *
+ * The factorization is kept between calls: calling initialize() again with
+ * the same matrix does not factorize anything, and if only the values but
+ * not the sparsity pattern have changed, SparseDirectUMFPACK::factorize()
+ * reuses the symbolic factorization.
+ *
+ * In operator(), the locally owned entries of the right-hand side are
+ * gathered on the first process, the system is solved there, and each
+ * process receives its locally owned entries of the solution. @p VectorType
+ * can be any vector type that provides locally_owned_elements() and element
+ * access, e.g. Vector or LinearAlgebra::distributed::Vector.
+ */
+template <typename number = double, typename VectorType = Vector<number>>
+class MGCoarseGridSparseDirect : public MGCoarseGridBase<VectorType>
+{
+public:
+  /**
+   * Constructor leaving an uninitialized object.
+   */
+  MGCoarseGridSparseDirect() = default;
+
+  /**
+   * Gather the contributions to the coarse matrix of all processes in
+   * @p communicator and factorize their sum, unless the result is the same
+   * as in the previous call.
+   */
+  void
+  initialize(const SparseMatrix<number> &A,
+             const MPI_Comm              communicator = MPI_COMM_SELF);
+
+  void
+  operator()(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src) const override;
+
+  /**
+   * Return how often the matrix has been factorized since the construction
+   * of this object, which is only meaningful on the first process of the
+   * communicator.
+   */
+  unsigned int
+  n_factorizations() const;
+
+private:
+  /**
+   * The communicator passed to initialize().
+   */
+  MPI_Comm communicator = MPI_COMM_SELF;
+
+  /**
+   * Sparsity pattern and values of the gathered matrix. Only filled on the
+   * first process of the communicator.
+   */
+  SparsityPattern      sparsity;
+  SparseMatrix<number> matrix;
+
+  /**
+   * The factorization of the gathered matrix.
+   */
+  SparseDirectUMFPACK solver;
+
+  /**
+   * The number of factorizations computed so far.
+   */
+  unsigned int factorization_counter = 0;
+
+  /**
+   * Right-hand side and solution on the first process.
+   */
+  mutable Vector<double> solution;
+};
+
 /** @} */
 
 #ifndef DOXYGEN
@@ -500,6 +589,147 @@ MGCoarseGridSVD<number, VectorType>::log() const
 }
 
 
+//---------------------------------------------------------------------------
+
+
+
+template <typename number, typename VectorType>
+void
+MGCoarseGridSparseDirect<number, VectorType>::initialize(
+  const SparseMatrix<number> &A,
+  const MPI_Comm              communicator)
+{
+  Assert(A.m() == A.n(), ExcNotQuadratic());
+
+  this->communicator = communicator;
+
+  std::vector<types::global_dof_index> rows, columns;
+  std::vector<number>                  values;
+  rows.reserve(A.n_nonzero_elements());
+  columns.reserve(A.n_nonzero_elements());
+  values.reserve(A.n_nonzero_elements());
+  for (const auto &entry : A)
+    {
+      rows.push_back(entry.row());
+      columns.push_back(entry.column());
+      values.push_back(entry.value());
+    }
+
+  std::vector<std::vector<types::global_dof_index>> all_rows, all_columns;
+  std::vector<std::vector<number>>                  all_values;
+  if (Utilities::MPI::n_mpi_processes(communicator) == 1)
+    {
+      all_rows.emplace_back(std::move(rows));
+      all_columns.emplace_back(std::move(columns));
+      all_values.emplace_back(std::move(values));
+    }
+  else
+    {
+      all_rows    = Utilities::MPI::gather(communicator, rows);
+      all_columns = Utilities::MPI::gather(communicator, columns);
+      all_values  = Utilities::MPI::gather(communicator, values);
+    }
+
+  if (Utilities::MPI::this_mpi_process(communicator) != 0)
+    return;
+
+  DynamicSparsityPattern dsp(A.m(), A.n());
+  for (unsigned int p = 0; p < all_rows.size(); ++p)
+    for (unsigned int i = 0; i < all_rows[p].size(); ++i)
+      dsp.add(all_rows[p][i], all_columns[p][i]);
+
+  SparsityPattern new_sparsity;
+  new_sparsity.copy_from(dsp);
+
+  const bool same_pattern =
+    (factorization_counter > 0) && (sparsity == new_sparsity);
+  if (same_pattern == false)
+    {
+      sparsity.copy_from(dsp);
+      matrix.reinit(sparsity);
+    }
+
+  SparseMatrix<number> new_matrix(sparsity);
+  for (unsigned int p = 0; p < all_rows.size(); ++p)
+    for (unsigned int i = 0; i < all_rows[p].size(); ++i)
+      new_matrix.add(all_rows[p][i], all_columns[p][i], all_values[p][i]);
+
+  if (same_pattern &&
+      std::equal(matrix.begin(),
+                 matrix.end(),
+                 new_matrix.begin(),
+                 [](const auto &a, const auto &b) {
+                   return a.value() == b.value();
+                 }))
+    return;
+
+  matrix.copy_from(new_matrix);
+  solver.factorize(matrix);
+  solution.reinit(matrix.m());
+  ++factorization_counter;
+}
+
+
+
+template <typename number, typename VectorType>
+void
+MGCoarseGridSparseDirect<number, VectorType>::operator()(
+  const unsigned int /*level*/,
+  VectorType       &dst,
+  const VectorType &src) const
+{
+  const IndexSet owned = src.locally_owned_elements();
+
+  std::vector<types::global_dof_index> indices;
+  std::vector<double>                  values;
+  indices.reserve(owned.n_elements());
+  values.reserve(owned.n_elements());
+  for (const auto i : owned)
+    {
+      indices.push_back(i);
+      values.push_back(src(i));
+    }
+
+  if (Utilities::MPI::n_mpi_processes(communicator) == 1)
+    {
+      for (unsigned int i = 0; i < indices.size(); ++i)
+        solution(indices[i]) = values[i];
+      solver.solve(solution);
+      for (unsigned int i = 0; i < indices.size(); ++i)
+        dst(indices[i]) = solution(indices[i]);
+      return;
+    }
+
+  const auto all_indices = Utilities::MPI::gather(communicator, indices);
+  auto       all_values  = Utilities::MPI::gather(communicator, values);
+
+  if (Utilities::MPI::this_mpi_process(communicator) == 0)
+    {
+      for (unsigned int p = 0; p < all_indices.size(); ++p)
+        for (unsigned int i = 0; i < all_indices[p].size(); ++i)
+          solution(all_indices[p][i]) = all_values[p][i];
+
+      solver.solve(solution);
+
+      for (unsigned int p = 0; p < all_indices.size(); ++p)
+        for (unsigned int i = 0; i < all_indices[p].size(); ++i)
+          all_values[p][i] = solution(all_indices[p][i]);
+    }
+
+  values = Utilities::MPI::scatter(communicator, all_values);
+  for (unsigned int i = 0; i < indices.size(); ++i)
+    dst(indices[i]) = values[i];
+}
+
+
+
+template <typename number, typename VectorType>
+inline unsigned int
+MGCoarseGridSparseDirect<number, VectorType>::n_factorizations() const
+{
+  return factorization_counter;
+}
+
 #endif // DOXYGEN
 
 DEAL_II_NAMESPACE_CLOSE
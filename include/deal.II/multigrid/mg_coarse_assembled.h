@@ -0,0 +1,472 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_coarse_assembled_h
+#define dealii_mg_coarse_assembled_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/sparse_amg.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/lac/trilinos_sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <deal.II/multigrid/mg_base.h>
+
+#include <functional>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * Coarse grid solver for matrix-free multigrid methods that assembles the
+ * matrix of the coarse level from the matrix-free operator and solves with
+ * an algebraic preconditioner, typically an algebraic multigrid method such
+ * as SparseAMG or TrilinosWrappers::PreconditionAMG.
+ *
+ * Matrix-free multigrid hierarchies, e.g., the ones built with
+ * MGTransferGlobalCoarseningTools::create_polynomial_coarsening_sequence(),
+ * typically end with linear elements on a mesh that is still too fine for a
+ * smoother alone. This class computes the matrix of this level with
+ * MatrixFreeTools::compute_matrix() from the same cell operation as used by
+ * the matrix-free operator, so that no separate assembly is needed. For
+ * serial computations, the default choice is a SparseMatrix together with
+ * the algebraic multigrid method SparseAMG, which does not need any
+ * external library:
+ * @code
+ * MGCoarseGridAssembledPreconditioner<
+ *   LinearAlgebra::distributed::Vector<float>,
+ *   SparseMatrix<double>,
+ *   SparseAMG<double>,
+ *   Vector<double>>
+ *   coarse_grid_solver;
+ * coarse_grid_solver.initialize(matrix_free, constraints, cell_operation);
+ * @endcode
+ * where `cell_operation` is a function taking an FEEvaluation object as in
+ * MatrixFreeTools::compute_matrix(). For computations with MPI, use
+ * TrilinosWrappers::SparseMatrix and TrilinosWrappers::PreconditionAMG
+ * instead:
+ * @code
+ * MGCoarseGridAssembledPreconditioner<
+ *   LinearAlgebra::distributed::Vector<double>,
+ *   TrilinosWrappers::SparseMatrix,
+ *   TrilinosWrappers::PreconditionAMG>
+ *   coarse_grid_solver;
+ * @endcode
+ *
+ * In operator(), the coarse problem is solved with the conjugate gradient
+ * method preconditioned by @p PreconditionerType, or, if
+ * AdditionalData::max_iterations is zero, the preconditioner is applied
+ * once.
+ *
+ * If the coarse operator changes, e.g., because of a new coefficient, while
+ * the mesh and the constraints stay the same, update() recomputes the matrix
+ * in the sparsity pattern set up by initialize() and initializes the
+ * preconditioner anew.
+ *
+ * @p MatrixType can be SparseMatrix or TrilinosWrappers::SparseMatrix, and
+ * @p PreconditionerType any preconditioner with an AdditionalData type and a
+ * function `initialize(const MatrixType &, const AdditionalData &)`. The
+ * right-hand side and the solution are copied into vectors of type
+ * @p SolverVectorType, which both @p MatrixType and @p PreconditionerType
+ * need to support, e.g., Vector<double> for SparseMatrix and SparseAMG, or
+ * LinearAlgebra::distributed::Vector<double> for the Trilinos classes, also
+ * if the multigrid levels use vectors of type
+ * LinearAlgebra::distributed::Vector<float>.
+ */
+template <typename VectorType,
+          typename MatrixType,
+          typename PreconditionerType,
+          typename SolverVectorType = VectorType>
+class MGCoarseGridAssembledPreconditioner : public MGCoarseGridBase<VectorType>
+{
+public:
+  /**
+   * Parameters of the coarse grid solver.
+   */
+  struct AdditionalData
+  {
+    /**
+     * Constructor.
+     */
+    AdditionalData(
+      const unsigned int max_iterations     = 100,
+      const double       relative_tolerance = 1e-4,
+      const typename PreconditionerType::AdditionalData &preconditioner_data =
+        typename PreconditionerType::AdditionalData())
+      : max_iterations(max_iterations)
+      , relative_tolerance(relative_tolerance)
+      , preconditioner_data(preconditioner_data)
+    {}
+
+    /**
+     * The maximal number of iterations of the conjugate gradient method. If
+     * zero, the preconditioner is applied once instead.
+     */
+    unsigned int max_iterations;
+
+    /**
+     * The reduction of the residual after which the iteration stops.
+     */
+    double relative_tolerance;
+
+    /**
+     * The parameters of the preconditioner.
+     */
+    typename PreconditionerType::AdditionalData preconditioner_data;
+  };
+
+  /**
+   * Compute the matrix of the operator described by @p matrix_free,
+   * @p constraints and @p cell_operation with
+   * MatrixFreeTools::compute_matrix(), and initialize the preconditioner
+   * with it. The arguments @p dof_no and @p quad_no select the DoFHandler
+   * and the quadrature of @p matrix_free.
+   *
+   * Only references to @p matrix_free and @p constraints are stored, so
+   * their lifetime needs to exceed the usage of this class.
+   */
+  template <int dim,
+            int fe_degree,
+            int n_q_points_1d,
+            int n_components,
+            typename Number,
+            typename VectorizedArrayType>
+  void
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const AffineConstraints<Number>                    &constraints,
+             const std::function<void(FEEvaluation<dim,
+                                                   fe_degree,
+                                                   n_q_points_1d,
+                                                   n_components,
+                                                   Number,
+                                                   VectorizedArrayType> &)>
+                                 &cell_operation,
+             const AdditionalData &additional_data = AdditionalData(),
+             const unsigned int    dof_no          = 0,
+             const unsigned int    quad_no         = 0);
+
+  /**
+   * Recompute the entries of the matrix with the arguments given to
+   * initialize(), keeping the sparsity pattern, and initialize the
+   * preconditioner again.
+   */
+  void
+  update();
+
+  /**
+   * Release all memory.
+   */
+  void
+  clear();
+
+  /**
+   * Return the assembled matrix.
+   */
+  const MatrixType &
+  get_matrix() const;
+
+  virtual void
+  operator()(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src) const override;
+
+private:
+  /**
+   * The parameters passed to initialize().
+   */
+  AdditionalData additional_data;
+
+  /**
+   * A function computing the matrix, set up in initialize().
+   */
+  std::function<void(MatrixType &)> compute_matrix;
+
+  /**
+   * A function setting up the solver vectors, set up in initialize().
+   */
+  std::function<void(SolverVectorType &)> initialize_vector;
+
+  /**
+   * The sparsity pattern in case @p MatrixType is SparseMatrix.
+   */
+  SparsityPattern sparsity_pattern;
+
+  /**
+   * The assembled matrix.
+   */
+  MatrixType matrix;
+
+  /**
+   * The preconditioner.
+   */
+  PreconditionerType preconditioner;
+
+  /**
+   * Right-hand side and solution in the vector type of the solver.
+   */
+  mutable SolverVectorType solver_src;
+  mutable SolverVectorType solver_dst;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+
+namespace internal
+{
+  namespace MGCoarseGridAssembledPreconditioner
+  {
+    template <int dim, int spacedim, typename Number, typename number>
+    void
+    reinit_matrix(const DoFHandler<dim, spacedim>         &dof_handler,
+                  const dealii::AffineConstraints<Number> &constraints,
+                  SparsityPattern                         &sparsity_pattern,
+                  SparseMatrix<number>                    &matrix)
+    {
+      DynamicSparsityPattern dsp(dof_handler.n_dofs());
+      DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+      sparsity_pattern.copy_from(dsp);
+      matrix.reinit(sparsity_pattern);
+    }
+
+
+
+#  ifdef DEAL_II_WITH_TRILINOS
+    template <int dim, int spacedim, typename Number>
+    void
+    reinit_matrix(const DoFHandler<dim, spacedim>         &dof_handler,
+                  const dealii::AffineConstraints<Number> &constraints,
+                  SparsityPattern &,
+                  TrilinosWrappers::SparseMatrix &matrix)
+    {
+      const MPI_Comm communicator = dof_handler.get_communicator();
+
+      TrilinosWrappers::SparsityPattern dsp(dof_handler.locally_owned_dofs(),
+                                            communicator);
+      DoFTools::make_sparsity_pattern(
+        dof_handler,
+        dsp,
+        constraints,
+        false,
+        Utilities::MPI::this_mpi_process(communicator));
+      dsp.compress();
+      matrix.reinit(dsp);
+    }
+#  endif
+
+
+
+    template <int dim, int spacedim, typename number>
+    void
+    reinit_vector(const DoFHandler<dim, spacedim> &dof_handler,
+                  Vector<number>                  &vector)
+    {
+      vector.reinit(dof_handler.n_dofs());
+    }
+
+
+
+    template <int dim, int spacedim, typename number>
+    void
+    reinit_vector(const DoFHandler<dim, spacedim>            &dof_handler,
+                  LinearAlgebra::distributed::Vector<number> &vector)
+    {
+      vector.reinit(dof_handler.locally_owned_dofs(),
+                    dof_handler.get_communicator());
+    }
+  } // namespace MGCoarseGridAssembledPreconditioner
+} // namespace internal
+
+
+
+template <typename VectorType,
+          typename MatrixType,
+          typename PreconditionerType,
+          typename SolverVectorType>
+template <int dim,
+          int fe_degree,
+          int n_q_points_1d,
+          int n_components,
+          typename Number,
+          typename VectorizedArrayType>
+void
+MGCoarseGridAssembledPreconditioner<VectorType,
+                                    MatrixType,
+                                    PreconditionerType,
+                                    SolverVectorType>::
+  initialize(const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free,
+             const AffineConstraints<Number>                    &constraints,
+             const std::function<void(FEEvaluation<dim,
+                                                   fe_degree,
+                                                   n_q_points_1d,
+                                                   n_components,
+                                                   Number,
+                                                   VectorizedArrayType> &)>
+                                 &cell_operation,
+             const AdditionalData &additional_data,
+             const unsigned int    dof_no,
+             const unsigned int    quad_no)
+{
+  Assert(matrix_free.get_mg_level() == numbers::invalid_unsigned_int,
+         ExcMessage("This class only supports MatrixFree objects set up for "
+                    "the active cells of a DoFHandler."));
+
+  this->additional_data = additional_data;
+
+  const DoFHandler<dim> &dof_handler = matrix_free.get_dof_handler(dof_no);
+
+  internal::MGCoarseGridAssembledPreconditioner::reinit_matrix(
+    dof_handler, constraints, sparsity_pattern, matrix);
+
+  compute_matrix =
+    [&matrix_free, &constraints, cell_operation, dof_no, quad_no](
+      MatrixType &system_matrix) {
+      MatrixFreeTools::compute_matrix(matrix_free,
+                                      constraints,
+                                      system_matrix,
+                                      cell_operation,
+                                      dof_no,
+                                      quad_no);
+    };
+
+  initialize_vector = [&matrix_free, dof_no](SolverVectorType &vector) {
+    internal::MGCoarseGridAssembledPreconditioner::reinit_vector(
+      matrix_free.get_dof_handler(dof_no), vector);
+  };
+
+  initialize_vector(solver_src);
+  initialize_vector(solver_dst);
+
+  update();
+}
+
+
+
+template <typename VectorType,
+          typename MatrixType,
+          typename PreconditionerType,
+          typename SolverVectorType>
+void
+MGCoarseGridAssembledPreconditioner<VectorType,
+                                    MatrixType,
+                                    PreconditionerType,
+                                    SolverVectorType>::update()
+{
+  Assert(compute_matrix, ExcNotInitialized());
+
+  matrix = 0.;
+  compute_matrix(matrix);
+  preconditioner.initialize(matrix, additional_data.preconditioner_data);
+}
+
+
+
+template <typename VectorType,
+          typename MatrixType,
+          typename PreconditionerType,
+          typename SolverVectorType>
+void
+MGCoarseGridAssembledPreconditioner<VectorType,
+                                    MatrixType,
+                                    PreconditionerType,
+                                    SolverVectorType>::clear()
+{
+  compute_matrix    = {};
+  initialize_vector = {};
+  preconditioner.clear();
+  matrix.clear();
+  sparsity_pattern.reinit(0, 0, 0);
+  solver_src.reinit(0);
+  solver_dst.reinit(0);
+}
+
+
+
+template <typename VectorType,
+          typename MatrixType,
+          typename PreconditionerType,
+          typename SolverVectorType>
+const MatrixType &
+MGCoarseGridAssembledPreconditioner<VectorType,
+                                    MatrixType,
+                                    PreconditionerType,
+                                    SolverVectorType>::get_matrix() const
+{
+  return matrix;
+}
+
+
+
+template <typename VectorType,
+          typename MatrixType,
+          typename PreconditionerType,
+          typename SolverVectorType>
+void
+MGCoarseGridAssembledPreconditioner<VectorType,
+                                    MatrixType,
+                                    PreconditionerType,
+                                    SolverVectorType>::
+operator()(const unsigned int /*level*/,
+           VectorType       &dst,
+           const VectorType &src) const
+{
+  Assert(compute_matrix, ExcNotInitialized());
+
+  for (const auto i : src.locally_owned_elements())
+    solver_src(i) = src(i);
+
+  if (additional_data.max_iterations == 0)
+    preconditioner.vmult(solver_dst, solver_src);
+  else
+    {
+      solver_dst = 0.;
+
+      IterationNumberControl solver_control(additional_data.max_iterations,
+                                            additional_data.relative_tolerance *
+                                              solver_src.l2_norm(),
+                                            false,
+                                            false);
+      SolverCG<SolverVectorType> solver(solver_control);
+      solver.solve(matrix, solver_dst, solver_src, preconditioner);
+    }
+
+  for (const auto i : dst.locally_owned_elements())
+    dst(i) = solver_dst(i);
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
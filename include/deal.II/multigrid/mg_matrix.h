@@ -18,13 +18,17 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/template_constraints.h>
 
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/linear_operator.h>
 #include <deal.II/lac/sparse_matrix.h>
 #include <deal.II/lac/vector.h>
 
 #include <deal.II/multigrid/mg_base.h>
 
+#include <cstring>
+#include <functional>
 #include <memory>
 
 DEAL_II_NAMESPACE_OPEN
@@ -36,10 +40,49 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace mg
 {
+  namespace internal
+  {
+    template <typename MatrixType, typename VectorType>
+    using vmult_with_operations_t =
+      decltype(std::declval<const MatrixType>().vmult(
+        std::declval<VectorType &>(),
+        std::declval<const VectorType &>(),
+        std::declval<const std::function<void(const unsigned int,
+                                              const unsigned int)> &>(),
+        std::declval<const std::function<void(const unsigned int,
+                                              const unsigned int)> &>()));
+
+    /**
+     * Whether @p MatrixType provides a vmult() function that runs functions
+     * on ranges of the locally owned entries before and after the
+     * multiplication, see PreconditionChebyshev, and @p VectorType allows
+     * to access these entries through a pointer.
+     */
+    template <typename MatrixType, typename VectorType>
+    constexpr bool has_vmult_with_operations =
+      dealii::internal::is_supported_operation<vmult_with_operations_t,
+                                               MatrixType,
+                                               VectorType> &&
+      (std::is_same_v<VectorType,
+                      dealii::Vector<typename VectorType::value_type>> ||
+       std::is_same_v<
+         VectorType,
+         LinearAlgebra::distributed::Vector<typename VectorType::value_type,
+                                            MemorySpace::Host>>);
+  } // namespace internal
+
+
+
   /**
    * Multilevel matrix. This matrix stores an MGLevelObject of
    * LinearOperator objects. It implements the interface defined in
    * MGMatrixBase, so that it can be used as a matrix in Multigrid.
+   *
+   * If the matrices passed to initialize() provide a vmult() function that
+   * runs functions before and after the multiplication on ranges of the
+   * vector entries, as described for PreconditionChebyshev, residual() uses
+   * it to subtract the product from the right hand side while the entries
+   * are still in cache, saving a sweep over the vectors.
    */
   template <typename VectorType = Vector<double>>
   class Matrix : public MGMatrixBase<VectorType>
@@ -93,6 +136,11 @@ namespace mg
     Tvmult_add(const unsigned int level,
                VectorType        &dst,
                const VectorType  &src) const override;
+    virtual void
+    residual(const unsigned int level,
+             VectorType        &dst,
+             const VectorType  &src,
+             const VectorType  &rhs) const override;
     virtual unsigned int
     get_minlevel() const override;
     virtual unsigned int
@@ -106,6 +154,14 @@ namespace mg
 
   private:
     MGLevelObject<LinearOperator<VectorType>> matrices;
+
+    /**
+     * Functions computing the residual in a single pass, set up in
+     * initialize() for matrices that support it and empty otherwise.
+     */
+    MGLevelObject<std::function<
+      void(VectorType &, const VectorType &, const VectorType &)>>
+      residuals;
   };
 
 } // namespace mg
@@ -204,6 +260,7 @@ namespace mg
   Matrix<VectorType>::initialize(const MGLevelObject<MatrixType> &p)
   {
     matrices.resize(p.min_level(), p.max_level());
+    residuals.resize(p.min_level(), p.max_level());
     for (unsigned int level = p.min_level(); level <= p.max_level(); ++level)
       {
         // Workaround: Unfortunately, not every "p[level]" object has a
@@ -213,6 +270,37 @@ namespace mg
           linear_operator<VectorType>(LinearOperator<VectorType>(),
                                       Utilities::get_underlying_value(
                                         p[level]));
+
+        using UnderlyingMatrixType = std::remove_cv_t<std::remove_reference_t<
+          decltype(Utilities::get_underlying_value(p[level]))>>;
+        if constexpr (internal::has_vmult_with_operations<UnderlyingMatrixType,
+                                                          VectorType>)
+          {
+            const UnderlyingMatrixType &matrix =
+              Utilities::get_underlying_value(p[level]);
+            residuals[level] = [&matrix](VectorType       &dst,
+                                         const VectorType &src,
+                                         const VectorType &rhs) {
+              using Number = typename VectorType::value_type;
+              matrix.vmult(
+                dst,
+                src,
+                [&](const unsigned int begin, const unsigned int end) {
+                  if (end > begin)
+                    std::memset(dst.begin() + begin,
+                                0,
+                                sizeof(Number) * (end - begin));
+                },
+                [&](const unsigned int begin, const unsigned int end) {
+                  const auto dst_ptr = dst.begin();
+                  const auto rhs_ptr = rhs.begin();
+
+                  DEAL_II_OPENMP_SIMD_PRAGMA
+                  for (std::size_t i = begin; i < end; ++i)
+                    dst_ptr[i] = rhs_ptr[i] - dst_ptr[i];
+                });
+            };
+          }
       }
   }
 
@@ -223,6 +311,7 @@ namespace mg
   Matrix<VectorType>::reset()
   {
     matrices.resize(0, 0);
+    residuals.resize(0, 0);
   }
 
 
@@ -289,6 +378,21 @@ namespace mg
 
 
 
+  template <typename VectorType>
+  void
+  Matrix<VectorType>::residual(const unsigned int level,
+                               VectorType        &dst,
+                               const VectorType  &src,
+                               const VectorType  &rhs) const
+  {
+    if (residuals[level])
+      residuals[level](dst, src, rhs);
+    else
+      MGMatrixBase<VectorType>::residual(level, dst, src, rhs);
+  }
+
+
+
   template <typename VectorType>
   unsigned int
   Matrix<VectorType>::get_minlevel() const
@@ -19,7 +19,9 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/smartpointer.h>
+#include <deal.II/base/thread_management.h>
 
 #include <deal.II/lac/linear_operator.h>
 #include <deal.II/lac/vector_memory.h>
@@ -30,6 +32,13 @@
 
 DEAL_II_NAMESPACE_OPEN
 
+#ifndef DOXYGEN
+namespace internal
+{
+  struct EigenvalueInformation;
+}
+#endif
+
 /*
  * MGSmootherBase is defined in mg_base.h
  */
@@ -527,6 +536,27 @@ public:
              const unsigned int                block_row,
              const unsigned int                block_col);
 
+  /**
+   * Compute the eigenvalue estimates of the smoothers on all levels by
+   * calling the function estimate_eigenvalues() of PreconditionerType,
+   * which must be PreconditionChebyshev or PreconditionRelaxation. Without
+   * calling this function, the estimate on each level is computed on the
+   * first application of the smoother on that level. Calling it after
+   * initialize() instead moves the estimation into the setup phase and
+   * processes all levels concurrently on separate tasks. Since the
+   * eigenvalue algorithms perform global reductions, the levels are
+   * processed in sequence if the program runs on more than one MPI
+   * process.
+   *
+   * The vectors in @p vectors define the layout of the temporary vectors
+   * on the respective levels; their content is ignored. The return value
+   * contains the results of the estimates, including their quality, on
+   * each level.
+   */
+  template <typename VectorType2>
+  MGLevelObject<internal::EigenvalueInformation>
+  estimate_eigenvalues(const MGLevelObject<VectorType2> &vectors);
+
   /**
    * Empty all vectors.
    */
@@ -1015,6 +1045,37 @@ inline MGSmootherPrecondition<MatrixType, PreconditionerType, VectorType>::
 
 
 
+template <typename MatrixType, typename PreconditionerType, typename VectorType>
+template <typename VectorType2>
+inline MGLevelObject<internal::EigenvalueInformation>
+MGSmootherPrecondition<MatrixType, PreconditionerType, VectorType>::
+  estimate_eigenvalues(const MGLevelObject<VectorType2> &vectors)
+{
+  const unsigned int min = smoothers.min_level();
+  const unsigned int max = smoothers.max_level();
+  AssertDimension(vectors.min_level(), min);
+  AssertDimension(vectors.max_level(), max);
+
+  MGLevelObject<internal::EigenvalueInformation> info(min, max);
+
+  if (Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) == 1)
+    {
+      Threads::TaskGroup<void> tasks;
+      for (unsigned int l = min; l <= max; ++l)
+        tasks += Threads::new_task([&, l]() {
+          info[l] = smoothers[l].estimate_eigenvalues(vectors[l]);
+        });
+      tasks.join_all();
+    }
+  else
+    for (unsigned int l = min; l <= max; ++l)
+      info[l] = smoothers[l].estimate_eigenvalues(vectors[l]);
+
+  return info;
+}
+
+
+
 template <typename MatrixType, typename PreconditionerType, typename VectorType>
 inline void
 MGSmootherPrecondition<MatrixType, PreconditionerType, VectorType>::clear()
@@ -0,0 +1,317 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_timer_h
+#define dealii_mg_timer_h
+
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/mpi_stub.h>
+
+#include <deal.II/multigrid/multigrid.h>
+
+#include <boost/signals2/connection.hpp>
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+/**
+ * @addtogroup mg
+ * @{
+ */
+
+/**
+ * A class that measures the time spent in the phases of a multigrid cycle,
+ * per level, by connecting to the signals of Multigrid and PreconditionMG
+ * (see mg::Signals).
+ *
+ * Besides the wall time and the number of calls, the class can report the
+ * achieved memory throughput and arithmetic performance of each phase if
+ * the number of bytes moved and floating point operations of a single call
+ * are provided with set_work_estimate(). These numbers depend on the
+ * operators, smoothers, and transfers in use and are not known to the
+ * multigrid classes, so they need to be provided by the user, e.g., from
+ * the number of nonzeros of the level matrices or the number of degrees of
+ * freedom times the number of vectors accessed.
+ * @code
+ * Multigrid<VectorType>     mg(...);
+ * PreconditionMG<dim, ...>  preconditioner(dof_handler, mg, transfer);
+ *
+ * MGTimer mg_timer;
+ * mg_timer.attach(mg);
+ * mg_timer.attach(preconditioner);
+ *
+ * solver.solve(system_matrix, solution, rhs, preconditioner);
+ *
+ * mg_timer.print_summary(pcout.get_stream(), MPI_COMM_WORLD);
+ * @endcode
+ *
+ * The time of the communication between the processes, e.g., the exchange
+ * of ghost values, is included in the phase that triggers it, since the
+ * multigrid classes do not signal it separately.
+ *
+ * The object needs to outlive the Multigrid and PreconditionMG objects it
+ * is attached to, or be detached with detach() before it is destroyed.
+ */
+class MGTimer
+{
+public:
+  /**
+   * The phases of a multigrid cycle that are measured.
+   */
+  enum class Phase
+  {
+    /**
+     * Pre-smoothing, see mg::Signals::pre_smoother_step.
+     */
+    pre_smoothing,
+    /**
+     * Computation of the residual, see mg::Signals::residual_step.
+     */
+    residual,
+    /**
+     * Restriction, see mg::Signals::restriction.
+     */
+    restriction,
+    /**
+     * Coarse grid solver, see mg::Signals::coarse_solve.
+     */
+    coarse_solve,
+    /**
+     * Prolongation, see mg::Signals::prolongation.
+     */
+    prolongation,
+    /**
+     * Application of the edge matrices, see mg::Signals::edge_prolongation.
+     */
+    edge_prolongation,
+    /**
+     * Post-smoothing, see mg::Signals::post_smoother_step.
+     */
+    post_smoothing,
+    /**
+     * Transfer of the global vector to the multigrid levels, see
+     * mg::Signals::transfer_to_mg. This phase is not associated with a
+     * level.
+     */
+    transfer_to_mg,
+    /**
+     * Transfer of the multigrid levels to the global vector, see
+     * mg::Signals::transfer_to_global. This phase is not associated with a
+     * level.
+     */
+    transfer_to_global
+  };
+
+  /**
+   * The number of phases.
+   */
+  static constexpr unsigned int n_phases = 9;
+
+  /**
+   * Destructor. Disconnects from all signals.
+   */
+  ~MGTimer();
+
+  /**
+   * Connect to the signals of @p mg.
+   */
+  template <typename VectorType>
+  void
+  attach(Multigrid<VectorType> &mg);
+
+  /**
+   * Connect to the signals of @p preconditioner, i.e., measure the
+   * transfers between the global vector and the multigrid levels.
+   */
+  template <int dim, typename VectorType, typename TransferType>
+  void
+  attach(PreconditionMG<dim, VectorType, TransferType> &preconditioner);
+
+  /**
+   * Disconnect from all signals. The measured data is kept.
+   */
+  void
+  detach();
+
+  /**
+   * Reset all measured times and numbers of calls. The work estimates and
+   * the connections to the signals are kept.
+   */
+  void
+  reset();
+
+  /**
+   * Set the number of bytes moved from and to main memory and the number of
+   * floating point operations of a single execution of @p phase on
+   * @p level. For the phases that are not associated with a level, the
+   * argument @p level is ignored.
+   */
+  void
+  set_work_estimate(const unsigned int level,
+                    const Phase        phase,
+                    const double       bytes,
+                    const double       flops);
+
+  /**
+   * Return the accumulated wall time, in seconds, of @p phase on @p level
+   * on this process.
+   */
+  double
+  get_time(const unsigned int level, const Phase phase) const;
+
+  /**
+   * Return how often @p phase has been executed on @p level on this
+   * process.
+   */
+  unsigned long int
+  get_n_calls(const unsigned int level, const Phase phase) const;
+
+  /**
+   * Return the sum of the wall times of all phases on all levels on this
+   * process, in seconds.
+   */
+  double
+  get_total_time() const;
+
+  /**
+   * Print a table with the number of calls and the minimum, average, and
+   * maximum accumulated wall time over all processes in @p mpi_communicator
+   * of each phase on each level. If work estimates have been set, the
+   * throughput in GB/s and the arithmetic performance in GFlop/s, based on
+   * the maximum time, are printed as well. Only the phases executed at
+   * least once are listed.
+   *
+   * This function needs to be called on all processes of
+   * @p mpi_communicator, and all of them need to have measured the same
+   * levels and phases.
+   */
+  void
+  print_summary(std::ostream &out, const MPI_Comm mpi_communicator) const;
+
+  /**
+   * Return the name of @p phase.
+   */
+  static const char *
+  get_phase_name(const Phase phase);
+
+private:
+  /**
+   * The data recorded for one phase on one level.
+   */
+  struct Data
+  {
+    /**
+     * The accumulated wall time.
+     */
+    double time = 0.;
+
+    /**
+     * The number of calls.
+     */
+    unsigned long int n_calls = 0;
+
+    /**
+     * The bytes moved per call.
+     */
+    double bytes = 0.;
+
+    /**
+     * The floating point operations per call.
+     */
+    double flops = 0.;
+
+    /**
+     * The time of the last start of the phase.
+     */
+    std::chrono::steady_clock::time_point start_time;
+  };
+
+  /**
+   * Start or stop measuring @p phase on @p level, depending on @p before.
+   */
+  void
+  measure(const bool before, const unsigned int level, const Phase phase);
+
+  /**
+   * Return the data of @p phase on @p level, extending the storage if
+   * necessary.
+   */
+  Data &
+  get_data(const unsigned int level, const Phase phase);
+
+  /**
+   * The data of all phases, indexed by the level and the phase. The phases
+   * not associated with a level are stored in the entry of level zero.
+   */
+  std::vector<std::array<Data, n_phases>> data;
+
+  /**
+   * The connections to the signals.
+   */
+  std::vector<boost::signals2::connection> connections;
+};
+
+/** @} */
+
+#ifndef DOXYGEN
+
+template <typename VectorType>
+void
+MGTimer::attach(Multigrid<VectorType> &mg)
+{
+  const auto connect = [&](const Phase phase) {
+    return [this, phase](const bool before, const unsigned int level) {
+      measure(before, level, phase);
+    };
+  };
+
+  connections.push_back(
+    mg.connect_pre_smoother_step(connect(Phase::pre_smoothing)));
+  connections.push_back(mg.connect_residual_step(connect(Phase::residual)));
+  connections.push_back(mg.connect_restriction(connect(Phase::restriction)));
+  connections.push_back(mg.connect_coarse_solve(connect(Phase::coarse_solve)));
+  connections.push_back(mg.connect_prolongation(connect(Phase::prolongation)));
+  connections.push_back(
+    mg.connect_edge_prolongation(connect(Phase::edge_prolongation)));
+  connections.push_back(
+    mg.connect_post_smoother_step(connect(Phase::post_smoothing)));
+}
+
+
+
+template <int dim, typename VectorType, typename TransferType>
+void
+MGTimer::attach(PreconditionMG<dim, VectorType, TransferType> &preconditioner)
+{
+  connections.push_back(
+    preconditioner.connect_transfer_to_mg([this](const bool before) {
+      measure(before, 0, Phase::transfer_to_mg);
+    }));
+  connections.push_back(
+    preconditioner.connect_transfer_to_global([this](const bool before) {
+      measure(before, 0, Phase::transfer_to_global);
+    }));
+}
+
+#endif // DOXYGEN
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
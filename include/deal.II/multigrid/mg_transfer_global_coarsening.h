@@ -203,6 +203,30 @@ namespace MGTransferGlobalCoarseningTools
     const RepartitioningPolicyTools::Base<dim, spacedim> &policy,
     const bool repartition_fine_triangulation = false);
 
+  /**
+   * Similar to the above function, but choosing the repartitioning of the
+   * coarser levels automatically: For a parallel::distributed::Triangulation,
+   * the levels are repartitioned with
+   * RepartitioningPolicyTools::MinimalGranularityPolicy, such that every
+   * process that owns cells on a level owns at least
+   * @p n_min_cells_per_process of them. On the coarse levels, the cells are
+   * hence gathered on a subset of the processes, and the remaining processes
+   * do not take part in the point-to-point communication of the
+   * matrix-vector products and transfers on these levels any more. The
+   * fine level keeps the partitioning of @p tria. For other types of
+   * triangulations, this function returns the same as the first function
+   * above.
+   *
+   * The transfer between levels with different partitions is handled by
+   * MGTwoLevelTransfer, so that the returned triangulations can be used as
+   * in the other variants.
+   */
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const Triangulation<dim, spacedim>>>
+  create_geometric_coarsening_sequence(
+    const Triangulation<dim, spacedim> &tria,
+    const unsigned int                  n_min_cells_per_process);
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -247,6 +271,26 @@ public:
   void
   restrict_and_add(VectorType &dst, const VectorType &src) const;
 
+  /**
+   * Perform prolongation on several vectors with the same parallel layout,
+   * e.g., the blocks of a block vector. If the transfer works in place on
+   * the given vectors, the ghost value exchanges of all source vectors are
+   * started before the first one is completed and the communication that
+   * completes the result of one vector overlaps with the cell loop of the
+   * next one. Otherwise, the vectors are processed one after the other.
+   */
+  void
+  prolongate_and_add(const std::vector<VectorType *>       &dst,
+                     const std::vector<const VectorType *> &src) const;
+
+  /**
+   * Perform restriction on several vectors with the same parallel layout.
+   * See the function above for details on the communication.
+   */
+  void
+  restrict_and_add(const std::vector<VectorType *>       &dst,
+                   const std::vector<const VectorType *> &src) const;
+
   /**
    * Perform interpolation of a solution vector from the fine level to the
    * coarse level. This function is different from restriction, where a
@@ -394,6 +438,18 @@ protected:
    * are a subset of an external Partitioner object.
    */
   mutable AlignedVector<Number> buffer_fine_embedded;
+
+  /**
+   * Buffers for the communication of several vectors at once if locally
+   * relevant DoFs are a subset of an external Partitioner object.
+   */
+  mutable std::vector<AlignedVector<Number>> buffers_coarse_embedded;
+
+  /**
+   * Buffers for the communication of several vectors at once if locally
+   * relevant DoFs are a subset of an external Partitioner object.
+   */
+  mutable std::vector<AlignedVector<Number>> buffers_fine_embedded;
 };
 
 
@@ -685,15 +741,19 @@ public:
      * RemotePointEvaluation, i.e. 1e-6 and 0, respectively. The last Boolean
      * parameter @p enforce_all_points_found is true by default and checks
      * that all points submitted internally to RemotePointEvaluation::reinit()
-     * have been found.
+     * have been found. The parameter @p precompute_shape_values selects
+     * whether the values of the coarse shape functions at the points are
+     * tabulated during reinit().
      *
      */
     AdditionalData(const double       tolerance                = 1e-6,
                    const unsigned int rtree_level              = 0,
-                   const bool         enforce_all_points_found = true)
+                   const bool         enforce_all_points_found = true,
+                   const bool         precompute_shape_values  = true)
       : tolerance(tolerance)
       , rtree_level(rtree_level)
       , enforce_all_points_found(enforce_all_points_found)
+      , precompute_shape_values(precompute_shape_values)
     {}
 
     /**
@@ -717,6 +777,18 @@ public:
      *
      */
     bool enforce_all_points_found;
+
+    /**
+     * If set to true, the values of the shape functions of the coarse
+     * element are evaluated once at all points found by
+     * RemotePointEvaluation during reinit(). Prolongation and restriction
+     * then only perform small dense products with these tables, vectorized
+     * over the points of a cell, instead of setting up an FEPointEvaluation
+     * object on every cell in every call. This trades memory, namely the
+     * number of points times the number of shape functions of the scalar
+     * coarse element, for speed.
+     */
+    bool precompute_shape_values;
   };
 
   /**
@@ -877,6 +949,22 @@ private:
    */
   std::vector<unsigned int> level_dof_indices_fine_ptrs;
 
+  /**
+   * Values of the shape functions of the scalar coarse element at the
+   * points of RemotePointEvaluation, filled if
+   * AdditionalData::precompute_shape_values is set. For each cell, the
+   * values are stored by shape function first and point second, starting at
+   * offset reference_point_ptrs[cell] times the number of shape functions.
+   */
+  std::vector<Number> shape_values;
+
+  /**
+   * Index of the shape function of the coarse element for each component and
+   * each shape function of the scalar coarse element, used to access the
+   * values of a cell together with @p shape_values.
+   */
+  std::vector<unsigned int> shape_values_dof_indices;
+
   friend class MGTransferMF<dim, Number>;
 };
 
@@ -1063,6 +1151,29 @@ public:
                    VectorType        &dst,
                    const VectorType  &src) const override;
 
+  /**
+   * Perform prolongation of all blocks of a block vector, whose blocks
+   * share the parallel layout of the vectors of this class. The
+   * communication of the blocks is batched, see
+   * MGTwoLevelTransferBase::prolongate_and_add().
+   */
+  void
+  prolongate_and_add(
+    const unsigned int                                     to_level,
+    LinearAlgebra::distributed::BlockVector<Number>       &dst,
+    const LinearAlgebra::distributed::BlockVector<Number> &src) const;
+
+  /**
+   * Perform restriction of all blocks of a block vector, whose blocks share
+   * the parallel layout of the vectors of this class. The communication of
+   * the blocks is batched, see MGTwoLevelTransferBase::restrict_and_add().
+   */
+  void
+  restrict_and_add(
+    const unsigned int                                     from_level,
+    LinearAlgebra::distributed::BlockVector<Number>       &dst,
+    const LinearAlgebra::distributed::BlockVector<Number> &src) const;
+
   /**
    * Initialize internal vectors and copy @p src vector
    * (associated to @p dof_handler) to the finest multigrid level.
@@ -1308,6 +1419,36 @@ public:
   void
   build(const std::vector<const DoFHandler<dim> *> &dof_handler);
 
+  /**
+   * Perform prolongation. If the same DoFHandler is used for all blocks,
+   * the communication of the blocks is batched.
+   */
+  void
+  prolongate(
+    const unsigned int                                     to_level,
+    LinearAlgebra::distributed::BlockVector<Number>       &dst,
+    const LinearAlgebra::distributed::BlockVector<Number> &src) const override;
+
+  /**
+   * Perform prolongation. If the same DoFHandler is used for all blocks,
+   * the communication of the blocks is batched.
+   */
+  void
+  prolongate_and_add(
+    const unsigned int                                     to_level,
+    LinearAlgebra::distributed::BlockVector<Number>       &dst,
+    const LinearAlgebra::distributed::BlockVector<Number> &src) const override;
+
+  /**
+   * Perform restriction. If the same DoFHandler is used for all blocks,
+   * the communication of the blocks is batched.
+   */
+  void
+  restrict_and_add(
+    const unsigned int                                     from_level,
+    LinearAlgebra::distributed::BlockVector<Number>       &dst,
+    const LinearAlgebra::distributed::BlockVector<Number> &src) const override;
+
 protected:
   const MGTransferMF<dim, Number> &
   get_matrix_free_transfer(const unsigned int b) const override;
@@ -52,6 +52,7 @@
 #include <boost/algorithm/string/join.hpp>
 
 #include <limits>
+#include <optional>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -112,6 +113,37 @@ namespace
     const unsigned int degree_coarse;
   };
 
+  /**
+   * Helper function to select the right templated implementation of the
+   * cell-wise transfer with a full matrix, as used for elements without a
+   * tensor-product structure. The sizes of the p-transfer between the
+   * FE_SimplexP elements of degree up to three on triangles and tetrahedra
+   * are compiled into the kernel, all other sizes are passed at run time.
+   */
+  template <typename Fu>
+  void
+  run_full_transfer(Fu              &fu,
+                    const unsigned int n_dofs_fine,
+                    const unsigned int n_dofs_coarse)
+  {
+    // triangles: 3, 6, and 10 unknowns for degrees 1, 2, and 3
+    if (n_dofs_fine == 6 && n_dofs_coarse == 3)
+      fu.template run_full<6, 3>(n_dofs_fine, n_dofs_coarse);
+    else if (n_dofs_fine == 10 && n_dofs_coarse == 3)
+      fu.template run_full<10, 3>(n_dofs_fine, n_dofs_coarse);
+    else if (n_dofs_fine == 10 && n_dofs_coarse == 6)
+      fu.template run_full<10, 6>(n_dofs_fine, n_dofs_coarse);
+    // tetrahedra: 4, 10, and 20 unknowns for degrees 1, 2, and 3
+    else if (n_dofs_fine == 10 && n_dofs_coarse == 4)
+      fu.template run_full<10, 4>(n_dofs_fine, n_dofs_coarse);
+    else if (n_dofs_fine == 20 && n_dofs_coarse == 4)
+      fu.template run_full<20, 4>(n_dofs_fine, n_dofs_coarse);
+    else if (n_dofs_fine == 20 && n_dofs_coarse == 10)
+      fu.template run_full<20, 10>(n_dofs_fine, n_dofs_coarse);
+    else
+      fu.template run_full<0, 0>(n_dofs_fine, n_dofs_coarse);
+  }
+
   /**
    * Helper class containing the cell-wise prolongation operation.
    */
@@ -149,22 +181,24 @@ namespace
                                      degree_fine_ + 1);
     }
 
+    template <int n_dofs_fine, int n_dofs_coarse>
     void
-    run_full(const unsigned int n_dofs_fine, const unsigned int n_dofs_coarse)
+    run_full(const unsigned int n_dofs_fine_, const unsigned int n_dofs_coarse_)
     {
-      AssertDimension(prolongation_matrix.size(), n_dofs_coarse * n_dofs_fine);
+      AssertDimension(prolongation_matrix.size(),
+                      n_dofs_coarse_ * n_dofs_fine_);
 
       internal::FEEvaluationImplBasisChange<
         internal::evaluate_general,
         internal::EvaluatorQuantity::value,
         1,
-        0,
-        0>::do_forward(1,
-                       prolongation_matrix,
-                       evaluation_data_coarse,
-                       evaluation_data_fine,
-                       n_dofs_coarse,
-                       n_dofs_fine);
+        n_dofs_coarse,
+        n_dofs_fine>::do_forward(1,
+                                 prolongation_matrix,
+                                 evaluation_data_coarse,
+                                 evaluation_data_fine,
+                                 n_dofs_coarse_,
+                                 n_dofs_fine_);
     }
 
   private:
@@ -213,23 +247,25 @@ namespace
                     degree_fine_ + 1);
     }
 
+    template <int n_dofs_fine, int n_dofs_coarse>
     void
-    run_full(const unsigned int n_dofs_fine, const unsigned int n_dofs_coarse)
+    run_full(const unsigned int n_dofs_fine_, const unsigned int n_dofs_coarse_)
     {
-      AssertDimension(prolongation_matrix.size(), n_dofs_coarse * n_dofs_fine);
+      AssertDimension(prolongation_matrix.size(),
+                      n_dofs_coarse_ * n_dofs_fine_);
 
       internal::FEEvaluationImplBasisChange<
         internal::evaluate_general,
         internal::EvaluatorQuantity::value,
         1,
-        0,
-        0>::do_backward(1,
-                        prolongation_matrix,
-                        false,
-                        evaluation_data_fine,
-                        evaluation_data_coarse,
-                        n_dofs_coarse,
-                        n_dofs_fine);
+        n_dofs_coarse,
+        n_dofs_fine>::do_backward(1,
+                                  prolongation_matrix,
+                                  false,
+                                  evaluation_data_fine,
+                                  evaluation_data_coarse,
+                                  n_dofs_coarse_,
+                                  n_dofs_fine_);
     }
 
   private:
@@ -1879,8 +1915,10 @@ namespace internal
           transfer.schemes[0].n_dofs_per_cell_coarse);
 
         // ---------------------- lexicographic_numbering ----------------------
+        // only the numbering of the fine element is needed here: the indices
+        // on the coarse cells are read by constraint_info_coarse, which sets
+        // up the numbering of the coarse element itself
         std::vector<unsigned int> lexicographic_numbering_fine;
-        std::vector<unsigned int> lexicographic_numbering_coarse;
         if (reference_cell == ReferenceCells::get_hypercube<dim>())
           {
             const Quadrature<1> dummy_quadrature(
@@ -1888,8 +1926,6 @@ namespace internal
             internal::MatrixFreeFunctions::ShapeInfo<Number> shape_info;
             shape_info.reinit(dummy_quadrature, fe_fine, 0);
             lexicographic_numbering_fine = shape_info.lexicographic_numbering;
-            shape_info.reinit(dummy_quadrature, fe_coarse, 0);
-            lexicographic_numbering_coarse = shape_info.lexicographic_numbering;
           }
         else
           {
@@ -1898,8 +1934,6 @@ namespace internal
             internal::MatrixFreeFunctions::ShapeInfo<Number> shape_info;
             shape_info.reinit(dummy_quadrature, fe_fine, 0);
             lexicographic_numbering_fine = shape_info.lexicographic_numbering;
-            shape_info.reinit(dummy_quadrature, fe_coarse, 0);
-            lexicographic_numbering_coarse = shape_info.lexicographic_numbering;
           }
 
         // ------------------------------ indices ------------------------------
@@ -2640,9 +2674,11 @@ namespace internal
     SimpleVectorDataExchange(
       const std::shared_ptr<const Utilities::MPI::Partitioner>
                             &embedded_partitioner,
-      AlignedVector<Number> &buffer)
+      AlignedVector<Number> &buffer,
+      const unsigned int     communication_channel = 0)
       : embedded_partitioner(embedded_partitioner)
       , buffer(buffer)
+      , communication_channel(communication_channel)
     {}
 
     template <typename VectorType>
@@ -2667,7 +2703,7 @@ namespace internal
 
       embedded_partitioner
         ->template export_to_ghosted_array_start<Number, MemorySpace::Host>(
-          0,
+          communication_channel,
           dealii::ArrayView<const Number>(
             vec.begin(), embedded_partitioner->locally_owned_size()),
           dealii::ArrayView<Number>(buffer.begin(), buffer.size()),
@@ -2724,7 +2760,7 @@ namespace internal
       embedded_partitioner
         ->template import_from_ghosted_array_start<Number, MemorySpace::Host>(
           VectorOperation::add,
-          0,
+          communication_channel,
           dealii::ArrayView<Number>(
             const_cast<Number *>(vec.begin()) +
               embedded_partitioner->locally_owned_size(),
@@ -2781,9 +2817,95 @@ namespace internal
     const std::shared_ptr<const Utilities::MPI::Partitioner>
                                      embedded_partitioner;
     dealii::AlignedVector<Number>   &buffer;
+    const unsigned int               communication_channel;
     mutable std::vector<MPI_Request> requests;
   };
 
+
+
+  /**
+   * Data exchange for several vectors with the same parallel layout, using
+   * one communication channel per vector so that the exchanges of all
+   * vectors can be in flight at the same time. If an embedded partitioner
+   * is given, the exchange is done with SimpleVectorDataExchange and one
+   * entry of @p buffers per vector, otherwise the functions of the vectors
+   * are called.
+   */
+  template <typename Number>
+  class BatchedVectorDataExchange
+  {
+  public:
+    BatchedVectorDataExchange(
+      const std::shared_ptr<const Utilities::MPI::Partitioner>
+                                         &embedded_partitioner,
+      std::vector<AlignedVector<Number>> &buffers,
+      const unsigned int                  n_vectors)
+    {
+      if (embedded_partitioner != nullptr)
+        {
+          buffers.resize(n_vectors);
+          exchangers.reserve(n_vectors);
+          for (unsigned int v = 0; v < n_vectors; ++v)
+            exchangers.emplace_back(embedded_partitioner, buffers[v], v);
+        }
+    }
+
+    template <typename VectorType>
+    void
+    update_ghost_values_start(const VectorType  &vec,
+                              const unsigned int v) const
+    {
+      if (exchangers.empty())
+        vec.update_ghost_values_start(v);
+      else
+        exchangers[v].update_ghost_values_start(vec);
+    }
+
+    template <typename VectorType>
+    void
+    update_ghost_values_finish(const VectorType  &vec,
+                               const unsigned int v) const
+    {
+      if (exchangers.empty())
+        vec.update_ghost_values_finish();
+      else
+        exchangers[v].update_ghost_values_finish(vec);
+    }
+
+    template <typename VectorType>
+    void
+    compress_start(VectorType &vec, const unsigned int v) const
+    {
+      if (exchangers.empty())
+        vec.compress_start(v, VectorOperation::add);
+      else
+        exchangers[v].compress_start(vec);
+    }
+
+    template <typename VectorType>
+    void
+    compress_finish(VectorType &vec, const unsigned int v) const
+    {
+      if (exchangers.empty())
+        vec.compress_finish(VectorOperation::add);
+      else
+        exchangers[v].compress_finish(vec);
+    }
+
+    template <typename VectorType>
+    void
+    zero_out_ghost_values(const VectorType &vec, const unsigned int v) const
+    {
+      if (exchangers.empty())
+        vec.zero_out_ghost_values();
+      else
+        exchangers[v].zero_out_ghost_values(vec);
+    }
+
+  private:
+    std::vector<SimpleVectorDataExchange<Number>> exchangers;
+  };
+
 } // namespace internal
 
 
@@ -3011,6 +3133,27 @@ namespace MGTransferGlobalCoarseningTools
       repartition_fine_triangulation);
   }
 
+
+
+  template <int dim, int spacedim>
+  std::vector<std::shared_ptr<const Triangulation<dim, spacedim>>>
+  create_geometric_coarsening_sequence(
+    const Triangulation<dim, spacedim> &fine_triangulation_in,
+    const unsigned int                  n_min_cells_per_process)
+  {
+#ifdef DEAL_II_WITH_P4EST
+    if (dynamic_cast<const parallel::distributed::Triangulation<dim, spacedim>
+                       *>(&fine_triangulation_in) != nullptr)
+      return create_geometric_coarsening_sequence(
+        fine_triangulation_in,
+        RepartitioningPolicyTools::MinimalGranularityPolicy<dim, spacedim>(
+          n_min_cells_per_process));
+#endif
+
+    (void)n_min_cells_per_process;
+    return create_geometric_coarsening_sequence(fine_triangulation_in);
+  }
+
 } // namespace MGTransferGlobalCoarseningTools
 
 
@@ -3064,6 +3207,71 @@ MGTwoLevelTransferBase<VectorType>::prolongate_and_add(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::prolongate_and_add(
+  const std::vector<VectorType *>       &dst,
+  const std::vector<const VectorType *> &src) const
+{
+  AssertDimension(dst.size(), src.size());
+
+  const unsigned int n_vectors = dst.size();
+
+  // the batched communication needs to work directly on the given vectors
+  // and uses one communication channel per vector
+  if (this->vec_fine.size() != 0 || this->vec_coarse.size() != 0 ||
+      n_vectors > 200)
+    {
+      for (unsigned int v = 0; v < n_vectors; ++v)
+        this->prolongate_and_add(*dst[v], *src[v]);
+      return;
+    }
+
+  const internal::BatchedVectorDataExchange<Number> exchange_coarse(
+    this->partitioner_coarse_embedded,
+    this->buffers_coarse_embedded,
+    n_vectors);
+  const internal::BatchedVectorDataExchange<Number> exchange_fine(
+    this->partitioner_fine_embedded, this->buffers_fine_embedded, n_vectors);
+
+  std::vector<bool> src_ghosts_have_been_set(n_vectors);
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      Assert(dst[v]->get_partitioner().get() == this->partitioner_fine.get(),
+             ExcInternalError());
+      Assert(src[v]->get_partitioner().get() ==
+               this->partitioner_coarse.get(),
+             ExcInternalError());
+
+      src_ghosts_have_been_set[v] = src[v]->has_ghost_elements();
+      if (src_ghosts_have_been_set[v] == false)
+        exchange_coarse.update_ghost_values_start(*src[v], v);
+    }
+
+  // the compress of one vector overlaps with the cell loop of the next one
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      if (src_ghosts_have_been_set[v] == false)
+        exchange_coarse.update_ghost_values_finish(*src[v], v);
+
+      this->prolongate_and_add_internal(*dst[v], *src[v]);
+
+      if (this->vec_fine_needs_ghost_update)
+        exchange_fine.compress_start(*dst[v], v);
+    }
+
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      if (this->vec_fine_needs_ghost_update)
+        exchange_fine.compress_finish(*dst[v], v);
+
+      if (src_ghosts_have_been_set[v] == false)
+        exchange_coarse.zero_out_ghost_values(*src[v], v);
+    }
+}
+
+
+
 template <int dim, typename VectorType>
 void
 MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
@@ -3146,8 +3354,9 @@ MGTwoLevelTransfer<dim, VectorType>::prolongate_and_add_internal(
                 if (scheme.prolongation_matrix_1d.size() > 0)
                   cell_transfer.run(cell_prolongator);
                 else
-                  cell_prolongator.run_full(n_scalar_dofs_fine,
-                                            n_scalar_dofs_coarse);
+                  run_full_transfer(cell_prolongator,
+                                    n_scalar_dofs_fine,
+                                    n_scalar_dofs_coarse);
               }
           else
             evaluation_data_fine = evaluation_data_coarse; // TODO
@@ -3244,6 +3453,71 @@ MGTwoLevelTransferBase<VectorType>::restrict_and_add(
 
 
 
+template <typename VectorType>
+void
+MGTwoLevelTransferBase<VectorType>::restrict_and_add(
+  const std::vector<VectorType *>       &dst,
+  const std::vector<const VectorType *> &src) const
+{
+  AssertDimension(dst.size(), src.size());
+
+  const unsigned int n_vectors = dst.size();
+
+  // the batched communication needs to work directly on the given vectors
+  // and uses one communication channel per vector
+  if (this->vec_fine.size() != 0 || this->vec_coarse.size() != 0 ||
+      n_vectors > 200)
+    {
+      for (unsigned int v = 0; v < n_vectors; ++v)
+        this->restrict_and_add(*dst[v], *src[v]);
+      return;
+    }
+
+  const internal::BatchedVectorDataExchange<Number> exchange_coarse(
+    this->partitioner_coarse_embedded,
+    this->buffers_coarse_embedded,
+    n_vectors);
+  const internal::BatchedVectorDataExchange<Number> exchange_fine(
+    this->partitioner_fine_embedded, this->buffers_fine_embedded, n_vectors);
+
+  std::vector<bool> src_needs_ghost_update(n_vectors);
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      Assert(src[v]->get_partitioner().get() == this->partitioner_fine.get(),
+             ExcInternalError());
+      Assert(dst[v]->get_partitioner().get() ==
+               this->partitioner_coarse.get(),
+             ExcInternalError());
+
+      src_needs_ghost_update[v] =
+        vec_fine_needs_ghost_update && (src[v]->has_ghost_elements() == false);
+      if (src_needs_ghost_update[v])
+        exchange_fine.update_ghost_values_start(*src[v], v);
+    }
+
+  // the compress of one vector overlaps with the cell loop of the next one
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    {
+      // since we might add into the ghost values and call compress
+      exchange_coarse.zero_out_ghost_values(*dst[v], v);
+
+      if (src_needs_ghost_update[v])
+        exchange_fine.update_ghost_values_finish(*src[v], v);
+
+      this->restrict_and_add_internal(*dst[v], *src[v]);
+
+      if (src_needs_ghost_update[v])
+        exchange_fine.zero_out_ghost_values(*src[v], v);
+
+      exchange_coarse.compress_start(*dst[v], v);
+    }
+
+  for (unsigned int v = 0; v < n_vectors; ++v)
+    exchange_coarse.compress_finish(*dst[v], v);
+}
+
+
+
 template <int dim, typename VectorType>
 void
 MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
@@ -3345,8 +3619,9 @@ MGTwoLevelTransfer<dim, VectorType>::restrict_and_add_internal(
                 if (scheme.prolongation_matrix_1d.size() > 0)
                   cell_transfer.run(cell_restrictor);
                 else
-                  cell_restrictor.run_full(n_scalar_dofs_fine,
-                                           n_scalar_dofs_coarse);
+                  run_full_transfer(cell_restrictor,
+                                    n_scalar_dofs_fine,
+                                    n_scalar_dofs_coarse);
               }
           else
             evaluation_data_coarse = evaluation_data_fine; // TODO
@@ -3469,8 +3744,9 @@ MGTwoLevelTransfer<dim, VectorType>::interpolate(VectorType       &dst,
                 if (scheme.restriction_matrix_1d.size() > 0)
                   cell_transfer.run(cell_restrictor);
                 else
-                  cell_restrictor.run_full(n_scalar_dofs_fine,
-                                           n_scalar_dofs_coarse);
+                  run_full_transfer(cell_restrictor,
+                                    n_scalar_dofs_fine,
+                                    n_scalar_dofs_coarse);
               }
           else
             evaluation_data_coarse = evaluation_data_fine; // TODO
@@ -3547,8 +3823,17 @@ namespace internal
         larger_partitioner->locally_owned_range(),
         larger_partitioner->get_mpi_communicator());
 
+      // the owners of the ghost indices are already known from the
+      // partitioner, no need to look them up again
+      std::vector<unsigned int> ghost_owners;
+      ghost_owners.reserve(partitioner->n_ghost_indices());
+      for (const auto &[rank, n_indices] : partitioner->ghost_targets())
+        ghost_owners.insert(ghost_owners.end(), n_indices, rank);
+
       embedded_partitioner->set_ghost_indices(
-        partitioner->ghost_indices(), larger_partitioner->ghost_indices());
+        partitioner->ghost_indices(),
+        ghost_owners,
+        larger_partitioner->ghost_indices());
 
       return embedded_partitioner;
     }
@@ -4252,6 +4537,50 @@ MGTransferMF<dim, Number>::restrict_and_add(const unsigned int from_level,
 
 
 
+template <int dim, typename Number>
+void
+MGTransferMF<dim, Number>::prolongate_and_add(
+  const unsigned int                                     to_level,
+  LinearAlgebra::distributed::BlockVector<Number>       &dst,
+  const LinearAlgebra::distributed::BlockVector<Number> &src) const
+{
+  AssertDimension(dst.n_blocks(), src.n_blocks());
+
+  std::vector<VectorType *>       dst_blocks(dst.n_blocks());
+  std::vector<const VectorType *> src_blocks(src.n_blocks());
+  for (unsigned int b = 0; b < src.n_blocks(); ++b)
+    {
+      dst_blocks[b] = &dst.block(b);
+      src_blocks[b] = &src.block(b);
+    }
+
+  this->transfer[to_level]->prolongate_and_add(dst_blocks, src_blocks);
+}
+
+
+
+template <int dim, typename Number>
+void
+MGTransferMF<dim, Number>::restrict_and_add(
+  const unsigned int                                     from_level,
+  LinearAlgebra::distributed::BlockVector<Number>       &dst,
+  const LinearAlgebra::distributed::BlockVector<Number> &src) const
+{
+  AssertDimension(dst.n_blocks(), src.n_blocks());
+
+  std::vector<VectorType *>       dst_blocks(dst.n_blocks());
+  std::vector<const VectorType *> src_blocks(src.n_blocks());
+  for (unsigned int b = 0; b < src.n_blocks(); ++b)
+    {
+      dst_blocks[b] = &dst.block(b);
+      src_blocks[b] = &src.block(b);
+    }
+
+  this->transfer[from_level]->restrict_and_add(dst_blocks, src_blocks);
+}
+
+
+
 template <int dim, typename Number>
 void
 MGTransferMF<dim, Number>::assert_dof_handler(
@@ -4484,6 +4813,51 @@ MGTransferBlockMF<dim, Number>::build(
 
 
 
+template <int dim, typename Number>
+void
+MGTransferBlockMF<dim, Number>::prolongate(
+  const unsigned int                                     to_level,
+  LinearAlgebra::distributed::BlockVector<Number>       &dst,
+  const LinearAlgebra::distributed::BlockVector<Number> &src) const
+{
+  dst = Number(0.0);
+  prolongate_and_add(to_level, dst, src);
+}
+
+
+
+template <int dim, typename Number>
+void
+MGTransferBlockMF<dim, Number>::prolongate_and_add(
+  const unsigned int                                     to_level,
+  LinearAlgebra::distributed::BlockVector<Number>       &dst,
+  const LinearAlgebra::distributed::BlockVector<Number> &src) const
+{
+  if (this->same_for_all)
+    get_matrix_free_transfer(0).prolongate_and_add(to_level, dst, src);
+  else
+    MGTransferBlockMatrixFreeBase<dim, Number, MGTransferMF<dim, Number>>::
+      prolongate_and_add(to_level, dst, src);
+}
+
+
+
+template <int dim, typename Number>
+void
+MGTransferBlockMF<dim, Number>::restrict_and_add(
+  const unsigned int                                     from_level,
+  LinearAlgebra::distributed::BlockVector<Number>       &dst,
+  const LinearAlgebra::distributed::BlockVector<Number> &src) const
+{
+  if (this->same_for_all)
+    get_matrix_free_transfer(0).restrict_and_add(from_level, dst, src);
+  else
+    MGTransferBlockMatrixFreeBase<dim, Number, MGTransferMF<dim, Number>>::
+      restrict_and_add(from_level, dst, src);
+}
+
+
+
 template <int dim, typename Number>
 const MGTransferMF<dim, Number> &
 MGTransferBlockMF<dim, Number>::get_matrix_free_transfer(
@@ -4979,9 +5353,6 @@ MGTwoLevelTransferNonNested<dim, VectorType>::reinit(
       "You requested that all points should be found, but this didn'thappen."
       " You can change this option through the AdditionalData struct in the constructor."));
 
-  // set up MappingInfo for easier data access
-  mapping_info = internal::fill_mapping_info<dim, Number>(rpe);
-
   // set up constraints
   const auto &cell_data = rpe.get_cell_data();
 
@@ -5021,6 +5392,45 @@ MGTwoLevelTransferNonNested<dim, VectorType>::reinit(
     fe_coarse = dof_handler_coarse.get_fe().clone();
   else
     AssertThrow(false, ExcMessage(dof_handler_coarse.get_fe().get_name()));
+
+  this->shape_values.clear();
+  this->shape_values_dof_indices.clear();
+
+  if (additional_data.precompute_shape_values &&
+      fe_coarse->n_base_elements() == 1)
+    {
+      // tabulate the values of the scalar shape functions at the points of
+      // each cell, ordered by shape function and then by point to make the
+      // loops over the points of a cell contiguous
+      const auto        &fe_scalar    = fe_coarse->base_element(0);
+      const unsigned int n_dofs       = fe_scalar.n_dofs_per_cell();
+      const auto        &point_ptrs   = cell_data.reference_point_ptrs;
+      const auto        &unit_points  = cell_data.reference_point_values;
+      const unsigned int n_components = fe_coarse->n_components();
+
+      this->shape_values_dof_indices.resize(n_components * n_dofs);
+      for (unsigned int c = 0; c < n_components; ++c)
+        for (unsigned int i = 0; i < n_dofs; ++i)
+          this->shape_values_dof_indices[c * n_dofs + i] =
+            fe_coarse->component_to_system_index(c, i);
+
+      this->shape_values.resize(unit_points.size() * n_dofs);
+      for (unsigned int cell = 0; cell < cell_data.cells.size(); ++cell)
+        {
+          const unsigned int n_points = point_ptrs[cell + 1] - point_ptrs[cell];
+          Number            *values =
+            this->shape_values.data() + point_ptrs[cell] * n_dofs;
+          for (unsigned int i = 0; i < n_dofs; ++i)
+            for (unsigned int q = 0; q < n_points; ++q)
+              values[i * n_points + q] =
+                fe_scalar.shape_value(i, unit_points[point_ptrs[cell] + q]);
+        }
+
+      mapping_info.reset();
+    }
+  else
+    // set up MappingInfo for easier data access
+    mapping_info = internal::fill_mapping_info<dim, Number>(rpe);
 }
 
 
@@ -5070,9 +5480,11 @@ MGTwoLevelTransferNonNested<dim, VectorType>::prolongate_and_add_internal_comp(
   const auto evaluation_function = [&](auto &values, const auto &cell_data) {
     this->signals_non_nested.prolongation_cell_loop(true);
     std::vector<Number> solution_values;
+    std::vector<Number> point_values;
 
-    FEPointEvaluation<n_components, dim, dim, Number> evaluator(*mapping_info,
-                                                                *fe_coarse);
+    std::optional<FEPointEvaluation<n_components, dim, dim, Number>> evaluator;
+    if (shape_values_dof_indices.empty())
+      evaluator.emplace(*mapping_info, *fe_coarse);
 
     const auto &send_permutation = rpe.get_send_permutation();
 
@@ -5091,19 +5503,54 @@ MGTwoLevelTransferNonNested<dim, VectorType>::prolongate_and_add_internal_comp(
           solution_values.size(),
           true);
 
-        // evaluate and scatter
-        evaluator.reinit(cell);
-
-        evaluator.evaluate(solution_values, dealii::EvaluationFlags::values);
+        if (!shape_values_dof_indices.empty())
+          {
+            // evaluate with the tabulated shape values, vectorized over the
+            // points of the cell, and scatter
+            const unsigned int n_dofs =
+              shape_values_dof_indices.size() / n_components;
+            const unsigned int first_point =
+              cell_data.reference_point_ptrs[cell];
+            const unsigned int n_points =
+              cell_data.reference_point_ptrs[cell + 1] - first_point;
+            const Number *cell_shape_values =
+              shape_values.data() + first_point * n_dofs;
+
+            point_values.resize(n_points);
+            for (unsigned int c = 0; c < n_components; ++c)
+              {
+                std::fill(point_values.begin(), point_values.end(), Number());
+                for (unsigned int i = 0; i < n_dofs; ++i)
+                  {
+                    const Number  value = solution_values
+                      [shape_values_dof_indices[c * n_dofs + i]];
+                    const Number *shape = cell_shape_values + i * n_points;
+                    for (unsigned int q = 0; q < n_points; ++q)
+                      point_values[q] += shape[q] * value;
+                  }
 
-        for (const auto q : evaluator.quadrature_point_indices())
+                for (unsigned int q = 0; q < n_points; ++q)
+                  values[send_permutation[first_point + q] * n_components +
+                         c] = point_values[q];
+              }
+          }
+        else
           {
-            const unsigned int index =
-              send_permutation[q + cell_data.reference_point_ptrs[cell]];
+            // evaluate and scatter
+            evaluator->reinit(cell);
 
-            for (unsigned int c = 0; c < n_components; ++c)
-              values[index * n_components + c] =
-                internal::access(evaluator.get_value(q), c);
+            evaluator->evaluate(solution_values,
+                                dealii::EvaluationFlags::values);
+
+            for (const auto q : evaluator->quadrature_point_indices())
+              {
+                const unsigned int index =
+                  send_permutation[q + cell_data.reference_point_ptrs[cell]];
+
+                for (unsigned int c = 0; c < n_components; ++c)
+                  values[index * n_components + c] =
+                    internal::access(evaluator->get_value(q), c);
+              }
           }
       }
     this->signals_non_nested.prolongation_cell_loop(false);
@@ -5293,9 +5740,12 @@ MGTwoLevelTransferNonNested<dim, VectorType>::restrict_and_add_internal_comp(
   const auto evaluation_function = [&](const auto &values,
                                        const auto &cell_data) {
     this->signals_non_nested.restriction_cell_loop(true);
-    std::vector<Number>                               solution_values;
-    FEPointEvaluation<n_components, dim, dim, Number> evaluator(*mapping_info,
-                                                                *fe_coarse);
+    std::vector<Number> solution_values;
+    std::vector<Number> point_values;
+
+    std::optional<FEPointEvaluation<n_components, dim, dim, Number>> evaluator;
+    if (shape_values_dof_indices.empty())
+      evaluator.emplace(*mapping_info, *fe_coarse);
 
     const auto &send_permutation = rpe.get_send_permutation();
 
@@ -5303,25 +5753,59 @@ MGTwoLevelTransferNonNested<dim, VectorType>::restrict_and_add_internal_comp(
       {
         solution_values.resize(fe_coarse->n_dofs_per_cell());
 
-        // gather and integrate
-        evaluator.reinit(cell);
+        if (!shape_values_dof_indices.empty())
+          {
+            // gather and integrate with the tabulated shape values,
+            // vectorized over the points of the cell
+            const unsigned int n_dofs =
+              shape_values_dof_indices.size() / n_components;
+            const unsigned int first_point =
+              cell_data.reference_point_ptrs[cell];
+            const unsigned int n_points =
+              cell_data.reference_point_ptrs[cell + 1] - first_point;
+            const Number *cell_shape_values =
+              shape_values.data() + first_point * n_dofs;
+
+            point_values.resize(n_points);
+            for (unsigned int c = 0; c < n_components; ++c)
+              {
+                for (unsigned int q = 0; q < n_points; ++q)
+                  point_values[q] =
+                    values[send_permutation[first_point + q] * n_components +
+                           c];
 
-        for (const auto q : evaluator.quadrature_point_indices())
+                for (unsigned int i = 0; i < n_dofs; ++i)
+                  {
+                    const Number *shape = cell_shape_values + i * n_points;
+                    Number        sum   = Number();
+                    for (unsigned int q = 0; q < n_points; ++q)
+                      sum += shape[q] * point_values[q];
+                    solution_values[shape_values_dof_indices[c * n_dofs + i]] =
+                      sum;
+                  }
+              }
+          }
+        else
           {
-            typename internal::FEPointEvaluation::
-              EvaluatorTypeTraits<dim, dim, n_components, Number>::value_type
-                value;
+            // gather and integrate
+            evaluator->reinit(cell);
+
+            for (const auto q : evaluator->quadrature_point_indices())
+              {
+                value_type value;
 
-            const unsigned int index =
-              send_permutation[q + cell_data.reference_point_ptrs[cell]];
+                const unsigned int index =
+                  send_permutation[q + cell_data.reference_point_ptrs[cell]];
 
-            for (unsigned int c = 0; c < n_components; ++c)
-              internal::access(value, c) = values[index * n_components + c];
+                for (unsigned int c = 0; c < n_components; ++c)
+                  internal::access(value, c) =
+                    values[index * n_components + c];
 
-            evaluator.submit_value(value, q);
-          }
+                evaluator->submit_value(value, q);
+              }
 
-        evaluator.test_and_sum(solution_values, EvaluationFlags::values);
+            evaluator->test_and_sum(solution_values, EvaluationFlags::values);
+          }
 
         // resolve constraints and scatter
         internal::VectorDistributorLocalToGlobal<Number, VectorizedArrayType>
@@ -5403,6 +5887,8 @@ MGTwoLevelTransferNonNested<dim, VectorType>::memory_consumption() const
   size += this->partitioner_coarse->memory_consumption();
   size += this->vec_coarse.memory_consumption();
   size += MemoryConsumption::memory_consumption(this->level_dof_indices_fine);
+  size += MemoryConsumption::memory_consumption(this->shape_values);
+  size += MemoryConsumption::memory_consumption(this->shape_values_dof_indices);
   // TODO: add consumption for rpe, mapping_info and constraint_info.
 
   return size;
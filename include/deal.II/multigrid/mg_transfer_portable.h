@@ -0,0 +1,447 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_transfer_portable_h
+#define dealii_mg_transfer_portable_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/smartpointer.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/multigrid/mg_base.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <functional>
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Portable
+{
+  /**
+   * Class for the transfer between two multigrid levels for p- or global
+   * coarsening whose prolongation and restriction are performed entirely in
+   * the default memory space, i.e., on the device if Kokkos has been
+   * configured with a device backend. Together with Portable::MatrixFree for
+   * the level operators, PreconditionChebyshev with a DiagonalMatrix around a
+   * device vector as smoother, and an iterative solver such as SolverCG for
+   * the coarse level (e.g. via MGCoarseGridIterativeSolver), this class makes
+   * it possible to run a multigrid V-cycle without moving vectors between the
+   * host and the device.
+   *
+   * The transfer is set up like the transfer of the host class
+   * dealii::MGTwoLevelTransfer, see @cite munch2022gc: Each coarse cell is
+   * associated with a patch of fine degrees of freedom, namely the degrees of
+   * freedom of the same cell for polynomial coarsening and those of its
+   * $2^\text{dim}$ children for geometric coarsening, numbered
+   * lexicographically. The prolongation matrix on such a patch is the tensor
+   * product of a one-dimensional matrix, which is applied by sum
+   * factorization with one Kokkos team per coarse cell. For continuous
+   * elements, the contributions to fine degrees of freedom shared between
+   * patches are weighted by the inverse of their multiplicity. The
+   * restriction is the transpose of the prolongation.
+   *
+   * In contrast to the host class, this class currently
+   * - only supports scalar tensor-product elements such as FE_Q and FE_DGQ,
+   * - requires that the two DoFHandler objects use the same finite element
+   *   for geometric coarsening, that the fine mesh is obtained by refining
+   *   all cells of the coarse mesh once, and that the children of all
+   *   locally owned coarse cells are present (as locally owned or ghost
+   *   cells) on the fine mesh of the same process,
+   * - treats constrained degrees of freedom as homogeneous Dirichlet
+   *   constraints, i.e., it does not support hanging-node constraints.
+   */
+  template <int dim, typename Number>
+  class MGTwoLevelTransfer : public Subscriptor
+  {
+  public:
+    /**
+     * The vector type the transfer operates on.
+     */
+    using VectorType =
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+    /**
+     * Default constructor.
+     */
+    MGTwoLevelTransfer();
+
+    /**
+     * Set up global coarsening between the given DoFHandler objects
+     * (@p dof_handler_fine and @p dof_handler_coarse), which have to use the
+     * same finite element. The triangulation of @p dof_handler_fine has to be
+     * the one of @p dof_handler_coarse with all cells refined once. The
+     * transfer can be only performed on active levels.
+     */
+    void
+    reinit_geometric_transfer(
+      const DoFHandler<dim>           &dof_handler_fine,
+      const DoFHandler<dim>           &dof_handler_coarse,
+      const AffineConstraints<Number> &constraint_fine =
+        AffineConstraints<Number>(),
+      const AffineConstraints<Number> &constraint_coarse =
+        AffineConstraints<Number>());
+
+    /**
+     * Set up polynomial coarsening between the given DoFHandler objects
+     * (@p dof_handler_fine and @p dof_handler_coarse) defined on the same
+     * triangulation. Polynomial transfers can be performed on active levels
+     * (`numbers::invalid_unsigned_int`) or on multigrid levels without
+     * hanging nodes.
+     */
+    void
+    reinit_polynomial_transfer(
+      const DoFHandler<dim>           &dof_handler_fine,
+      const DoFHandler<dim>           &dof_handler_coarse,
+      const AffineConstraints<Number> &constraint_fine =
+        AffineConstraints<Number>(),
+      const AffineConstraints<Number> &constraint_coarse =
+        AffineConstraints<Number>(),
+      const unsigned int mg_level_fine   = numbers::invalid_unsigned_int,
+      const unsigned int mg_level_coarse = numbers::invalid_unsigned_int);
+
+    /**
+     * Set up the transfer operator between the given DoFHandler objects.
+     * Depending on the underlying Triangulation objects, polynomial or
+     * geometric global coarsening is performed.
+     */
+    void
+    reinit(const DoFHandler<dim>           &dof_handler_fine,
+           const DoFHandler<dim>           &dof_handler_coarse,
+           const AffineConstraints<Number> &constraint_fine =
+             AffineConstraints<Number>(),
+           const AffineConstraints<Number> &constraint_coarse =
+             AffineConstraints<Number>(),
+           const unsigned int mg_level_fine   = numbers::invalid_unsigned_int,
+           const unsigned int mg_level_coarse = numbers::invalid_unsigned_int);
+
+    /**
+     * Perform prolongation of the coarse vector @p src and add the result to
+     * the fine vector @p dst.
+     */
+    void
+    prolongate_and_add(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Perform restriction of the fine residual vector @p src and add the
+     * result to the coarse vector @p dst.
+     */
+    void
+    restrict_and_add(VectorType &dst, const VectorType &src) const;
+
+    /**
+     * Return the partitioner of the fine vectors used internally, which
+     * contains all the fine degrees of freedom touched by the locally owned
+     * coarse cells as ghosts. Vectors initialized with this partitioner are
+     * used without an additional copy.
+     */
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &
+    get_partitioner_fine() const;
+
+    /**
+     * Same as above for the coarse vectors.
+     */
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &
+    get_partitioner_coarse() const;
+
+    /**
+     * Return the memory consumption of the allocated memory in this class.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Copy the given data to the device and set up the partitioners and the
+     * weights of the fine degrees of freedom. The index arrays list the
+     * global indices of the coarse and fine degrees of freedom of each patch
+     * in lexicographic order, one patch after the other.
+     */
+    void
+    setup_data(const DoFHandler<dim>                      &dof_handler_fine,
+               const DoFHandler<dim>                      &dof_handler_coarse,
+               const AffineConstraints<Number>            &constraint_fine,
+               const AffineConstraints<Number>            &constraint_coarse,
+               const unsigned int                          mg_level_fine,
+               const unsigned int                          mg_level_coarse,
+               const std::vector<double>                  &matrix_1d,
+               const std::vector<types::global_dof_index> &indices_fine,
+               const std::vector<types::global_dof_index> &indices_coarse);
+
+    /**
+     * Number of coarse cells, i.e., of patches.
+     */
+    unsigned int n_coarse_cells;
+
+    /**
+     * Number of coarse degrees of freedom per cell in each direction.
+     */
+    unsigned int n_dofs_1d_coarse;
+
+    /**
+     * Number of fine degrees of freedom per patch in each direction.
+     */
+    unsigned int n_dofs_1d_fine;
+
+    /**
+     * The one-dimensional prolongation matrix of size `n_dofs_1d_fine` times
+     * `n_dofs_1d_coarse`, stored row-wise.
+     */
+    Kokkos::View<Number *, MemorySpace::Default::kokkos_space>
+      prolongation_matrix_1d;
+
+    /**
+     * The indices of the coarse degrees of freedom of each cell in the local
+     * index space of #partitioner_coarse, or numbers::invalid_unsigned_int
+     * for constrained degrees of freedom.
+     */
+    Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>
+      dof_indices_coarse;
+
+    /**
+     * The indices of the fine degrees of freedom of each patch in the local
+     * index space of #partitioner_fine.
+     */
+    Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>
+      dof_indices_fine;
+
+    /**
+     * The weights of the fine degrees of freedom of each patch, given by the
+     * inverse of the number of patches sharing the degree of freedom, or zero
+     * for constrained degrees of freedom.
+     */
+    Kokkos::View<Number **, MemorySpace::Default::kokkos_space> weights_fine;
+
+    /**
+     * Partitioner needed by the intermediate vector.
+     */
+    std::shared_ptr<const Utilities::MPI::Partitioner> partitioner_coarse;
+
+    /**
+     * Partitioner needed by the intermediate vector.
+     */
+    std::shared_ptr<const Utilities::MPI::Partitioner> partitioner_fine;
+
+    /**
+     * Internal vector on which the actual prolongation/restriction is
+     * performed if an external coarse vector does not have the layout of
+     * #partitioner_coarse.
+     */
+    mutable VectorType vec_coarse;
+
+    /**
+     * Internal vector on which the actual prolongation/restriction is
+     * performed if an external fine vector does not have the layout of
+     * #partitioner_fine.
+     */
+    mutable VectorType vec_fine;
+  };
+
+
+
+  /**
+   * Implementation of the MGTransferBase interface between the levels of a
+   * multigrid hierarchy whose two-level transfer operators of type
+   * Portable::MGTwoLevelTransfer work on vectors in the default memory space.
+   * This is the device counterpart of dealii::MGTransferMF for global
+   * coarsening, i.e., the finest multigrid level has to use the same
+   * numbering of the degrees of freedom as the vectors passed to
+   * copy_to_mg() and copy_from_mg().
+   */
+  template <int dim, typename Number>
+  class MGTransferMF
+    : public MGTransferBase<
+        LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>>
+  {
+  public:
+    /**
+     * Value type.
+     */
+    using VectorType =
+      LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>;
+
+    /**
+     * Constructor taking a collection of transfer operators (with the
+     * coarsest level kept empty in @p transfer) and an optional function
+     * that initializes the level vectors within the function call
+     * copy_to_mg(). If no such function is given, the level vectors are
+     * initialized with the partitioners of the two-level transfer operators.
+     */
+    MGTransferMF(
+      const MGLevelObject<MGTwoLevelTransfer<dim, Number>> &transfer,
+      const std::function<void(const unsigned int, VectorType &)>
+        &initialize_dof_vector = {});
+
+    /**
+     * Perform prolongation.
+     */
+    virtual void
+    prolongate(const unsigned int to_level,
+               VectorType        &dst,
+               const VectorType  &src) const override;
+
+    /**
+     * Perform prolongation and add the result to @p dst.
+     */
+    virtual void
+    prolongate_and_add(const unsigned int to_level,
+                       VectorType        &dst,
+                       const VectorType  &src) const override;
+
+    /**
+     * Perform restriction.
+     */
+    virtual void
+    restrict_and_add(const unsigned int from_level,
+                     VectorType        &dst,
+                     const VectorType  &src) const override;
+
+    /**
+     * Initialize the level vectors and copy @p src to the finest multigrid
+     * level.
+     */
+    template <class InVector>
+    void
+    copy_to_mg(const DoFHandler<dim>     &dof_handler,
+               MGLevelObject<VectorType> &dst,
+               const InVector            &src) const;
+
+    /**
+     * Copy the values on the finest multigrid level to @p dst.
+     */
+    template <class OutVector>
+    void
+    copy_from_mg(const DoFHandler<dim>           &dof_handler,
+                 OutVector                       &dst,
+                 const MGLevelObject<VectorType> &src) const;
+
+    /**
+     * Add the values on the finest multigrid level to @p dst.
+     */
+    template <class OutVector>
+    void
+    copy_from_mg_add(const DoFHandler<dim>           &dof_handler,
+                     OutVector                       &dst,
+                     const MGLevelObject<VectorType> &src) const;
+
+  private:
+    /**
+     * Collection of the two-level transfer operators.
+     */
+    MGLevelObject<SmartPointer<const MGTwoLevelTransfer<dim, Number>>>
+      transfer;
+
+    /**
+     * Function to initialize the level vectors.
+     */
+    std::function<void(const unsigned int, VectorType &)>
+      initialize_dof_vector;
+  };
+
+
+
+#ifndef DOXYGEN
+
+  template <int dim, typename Number>
+  inline const std::shared_ptr<const Utilities::MPI::Partitioner> &
+  MGTwoLevelTransfer<dim, Number>::get_partitioner_fine() const
+  {
+    return partitioner_fine;
+  }
+
+
+
+  template <int dim, typename Number>
+  inline const std::shared_ptr<const Utilities::MPI::Partitioner> &
+  MGTwoLevelTransfer<dim, Number>::get_partitioner_coarse() const
+  {
+    return partitioner_coarse;
+  }
+
+
+
+  template <int dim, typename Number>
+  template <class InVector>
+  void
+  MGTransferMF<dim, Number>::copy_to_mg(const DoFHandler<dim> &,
+                                        MGLevelObject<VectorType> &dst,
+                                        const InVector            &src) const
+  {
+    for (unsigned int level = dst.min_level(); level <= dst.max_level();
+         ++level)
+      {
+        if (initialize_dof_vector)
+          {
+            initialize_dof_vector(level, dst[level]);
+            continue;
+          }
+
+        const auto &partitioner =
+          (level > dst.min_level()) ?
+            transfer[level]->get_partitioner_fine() :
+            transfer[level + 1]->get_partitioner_coarse();
+        if (dst[level].get_partitioner().get() != partitioner.get())
+          dst[level].reinit(partitioner);
+        else if (level < dst.max_level())
+          dst[level] = Number();
+      }
+
+    dst[dst.max_level()].copy_locally_owned_data_from(src);
+  }
+
+
+
+  template <int dim, typename Number>
+  template <class OutVector>
+  void
+  MGTransferMF<dim, Number>::copy_from_mg(
+    const DoFHandler<dim> &,
+    OutVector                       &dst,
+    const MGLevelObject<VectorType> &src) const
+  {
+    dst.zero_out_ghost_values();
+    dst.copy_locally_owned_data_from(src[src.max_level()]);
+  }
+
+
+
+  template <int dim, typename Number>
+  template <class OutVector>
+  void
+  MGTransferMF<dim, Number>::copy_from_mg_add(
+    const DoFHandler<dim> &,
+    OutVector                       &dst,
+    const MGLevelObject<VectorType> &src) const
+  {
+    dst.zero_out_ghost_values();
+    dst.add(1., src[src.max_level()]);
+  }
+
+#endif
+
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
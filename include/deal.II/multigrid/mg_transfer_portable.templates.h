@@ -0,0 +1,788 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_mg_transfer_portable_templates_h
+#define dealii_mg_transfer_portable_templates_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_tools.h>
+
+#include <deal.II/grid/cell_id.h>
+
+#include <deal.II/matrix_free/shape_info.h>
+
+#include <deal.II/multigrid/mg_transfer_portable.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Portable
+{
+  namespace internal
+  {
+    /**
+     * Kernel applying the tensor-product prolongation or restriction on one
+     * patch per team.
+     */
+    template <int dim, typename Number>
+    struct TransferKernel
+    {
+      using TeamHandle = Kokkos::TeamPolicy<
+        MemorySpace::Default::kokkos_space::execution_space>::member_type;
+      using SharedView1D =
+        Kokkos::View<Number *,
+                     MemorySpace::Default::kokkos_space::execution_space::
+                       scratch_memory_space,
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+      // Provide the shared memory capacity, two buffers large enough for the
+      // fine degrees of freedom of a patch
+      size_t
+      team_shmem_size(int /*team_size*/) const
+      {
+        return 2 * SharedView1D::shmem_size(
+                     Utilities::pow(std::max(n_dofs_1d_fine, n_dofs_1d_coarse),
+                                    dim));
+      }
+
+      // Apply the one-dimensional matrix, or its transpose, along the given
+      // direction: The entries of 'in' have 'n_out' entries in the
+      // directions before 'direction' and 'n_in' entries in the remaining
+      // ones
+      DEAL_II_HOST_DEVICE
+      void
+      apply_1d(const TeamHandle   &team_member,
+               const unsigned int  direction,
+               const bool          transpose,
+               const SharedView1D &in,
+               const SharedView1D &out) const
+      {
+        const unsigned int n_in =
+          transpose ? n_dofs_1d_fine : n_dofs_1d_coarse;
+        const unsigned int n_out =
+          transpose ? n_dofs_1d_coarse : n_dofs_1d_fine;
+        const unsigned int stride = Utilities::pow(n_out, direction);
+        const unsigned int n_post = Utilities::pow(n_in, dim - 1 - direction);
+
+        Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(team_member, stride * n_out * n_post),
+          [&](const int i) {
+            const unsigned int i_pre  = i % stride;
+            const unsigned int row    = (i / stride) % n_out;
+            const unsigned int i_post = i / (stride * n_out);
+            const unsigned int offset = i_pre + stride * n_in * i_post;
+
+            Number sum = 0;
+            for (unsigned int k = 0; k < n_in; ++k)
+              sum += (transpose ?
+                        matrix_1d(k * n_dofs_1d_coarse + row) :
+                        matrix_1d(row * n_dofs_1d_coarse + k)) *
+                     in(offset + k * stride);
+            out(i) = sum;
+          });
+        team_member.team_barrier();
+      }
+
+      DEAL_II_HOST_DEVICE
+      void
+      operator()(const TeamHandle &team_member) const
+      {
+        const unsigned int cell = team_member.league_rank();
+        const unsigned int n_dofs_coarse =
+          Utilities::pow(n_dofs_1d_coarse, dim);
+        const unsigned int n_dofs_fine = Utilities::pow(n_dofs_1d_fine, dim);
+        const unsigned int buffer_size =
+          Utilities::pow(n_dofs_1d_fine > n_dofs_1d_coarse ? n_dofs_1d_fine :
+                                                             n_dofs_1d_coarse,
+                         dim);
+
+        SharedView1D in(team_member.team_shmem(), buffer_size);
+        SharedView1D out(team_member.team_shmem(), buffer_size);
+
+        if (is_prolongation)
+          {
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, n_dofs_coarse),
+              [&](const int i) {
+                const unsigned int index = dof_indices_coarse(cell, i);
+                in(i) =
+                  (index == numbers::invalid_unsigned_int) ? 0 : src[index];
+              });
+            team_member.team_barrier();
+
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                apply_1d(team_member, d, false, in, out);
+                const SharedView1D tmp = in;
+                in                     = out;
+                out                    = tmp;
+              }
+
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, n_dofs_fine),
+              [&](const int i) {
+                const Number weight = weights_fine(cell, i);
+                if (weight != Number(0))
+                  Kokkos::atomic_add(&dst[dof_indices_fine(cell, i)],
+                                     weight * in(i));
+              });
+          }
+        else
+          {
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, n_dofs_fine),
+              [&](const int i) {
+                in(i) = weights_fine(cell, i) * src[dof_indices_fine(cell, i)];
+              });
+            team_member.team_barrier();
+
+            for (unsigned int d = 0; d < dim; ++d)
+              {
+                apply_1d(team_member, d, true, in, out);
+                const SharedView1D tmp = in;
+                in                     = out;
+                out                    = tmp;
+              }
+
+            Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, n_dofs_coarse),
+              [&](const int i) {
+                const unsigned int index = dof_indices_coarse(cell, i);
+                if (index != numbers::invalid_unsigned_int)
+                  Kokkos::atomic_add(&dst[index], in(i));
+              });
+          }
+      }
+
+      bool         is_prolongation;
+      unsigned int n_dofs_1d_coarse;
+      unsigned int n_dofs_1d_fine;
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space> matrix_1d;
+      Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>
+        dof_indices_coarse;
+      Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>
+        dof_indices_fine;
+      Kokkos::View<Number **, MemorySpace::Default::kokkos_space> weights_fine;
+      const Number *src;
+      Number       *dst;
+    };
+
+
+
+    /**
+     * Create the one-dimensional counterpart of the given finite element and
+     * the lexicographic numbering of both elements.
+     */
+    template <int dim>
+    std::unique_ptr<FiniteElement<1>>
+    create_1d_fe_and_numbering(const FiniteElement<dim>  &fe,
+                               std::vector<unsigned int> &lexicographic,
+                               std::vector<unsigned int> &lexicographic_1d)
+    {
+      AssertThrow(fe.n_components() == 1,
+                  ExcNotImplemented(
+                    "Portable::MGTwoLevelTransfer only supports scalar "
+                    "elements."));
+      AssertThrow(fe.reference_cell() == ReferenceCells::get_hypercube<dim>(),
+                  ExcNotImplemented(
+                    "Portable::MGTwoLevelTransfer only supports "
+                    "tensor-product elements."));
+
+      std::string fe_name = fe.get_name();
+      {
+        const std::size_t template_starts = fe_name.find_first_of('<');
+        Assert(fe_name[template_starts + 1] ==
+                 (dim == 1 ? '1' : (dim == 2 ? '2' : '3')),
+               ExcInternalError());
+        fe_name[template_starts + 1] = '1';
+      }
+      std::unique_ptr<FiniteElement<1>> fe_1d =
+        FETools::get_fe_by_name<1, 1>(fe_name);
+
+      const dealii::internal::MatrixFreeFunctions::ShapeInfo<double>
+        shape_info(QGauss<1>(fe.degree + 1), fe);
+      AssertThrow(shape_info.element_type <=
+                    dealii::internal::MatrixFreeFunctions::tensor_general,
+                  ExcNotImplemented(
+                    "Portable::MGTwoLevelTransfer only supports "
+                    "tensor-product elements."));
+      lexicographic = shape_info.lexicographic_numbering;
+
+      const dealii::internal::MatrixFreeFunctions::ShapeInfo<double>
+        shape_info_1d(QGauss<1>(fe.degree + 1), *fe_1d);
+      lexicographic_1d = shape_info_1d.lexicographic_numbering;
+
+      return fe_1d;
+    }
+  } // namespace internal
+
+
+
+  template <int dim, typename Number>
+  MGTwoLevelTransfer<dim, Number>::MGTwoLevelTransfer()
+    : n_coarse_cells(0)
+    , n_dofs_1d_coarse(0)
+    , n_dofs_1d_fine(0)
+  {}
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::reinit_geometric_transfer(
+    const DoFHandler<dim>           &dof_handler_fine,
+    const DoFHandler<dim>           &dof_handler_coarse,
+    const AffineConstraints<Number> &constraint_fine,
+    const AffineConstraints<Number> &constraint_coarse)
+  {
+    AssertThrow(dof_handler_fine.get_fe_collection().size() == 1 &&
+                  dof_handler_coarse.get_fe_collection().size() == 1,
+                ExcNotImplemented());
+    AssertThrow(dof_handler_fine.get_fe() == dof_handler_coarse.get_fe(),
+                ExcMessage("The geometric transfer requires the same finite "
+                           "element on the fine and the coarse level."));
+
+    const FiniteElement<dim> &fe = dof_handler_coarse.get_fe();
+    std::vector<unsigned int> lexicographic, lexicographic_1d;
+    const std::unique_ptr<FiniteElement<1>> fe_1d =
+      internal::create_1d_fe_and_numbering(fe, lexicographic, lexicographic_1d);
+
+    // for continuous elements, the children share the degrees of freedom at
+    // the interface in the middle of the parent
+    const bool         is_continuous = fe.n_dofs_per_vertex() > 0;
+    const unsigned int n_dofs_1d     = fe.degree + 1;
+    const unsigned int step          = is_continuous ? fe.degree : n_dofs_1d;
+    const unsigned int n_dofs_1d_patch = 2 * step + (is_continuous ? 1 : 0);
+
+    std::vector<double> matrix_1d(n_dofs_1d_patch * n_dofs_1d);
+    for (unsigned int c = 0; c < GeometryInfo<1>::max_children_per_cell; ++c)
+      {
+        const FullMatrix<double> &prolongation =
+          fe_1d->get_prolongation_matrix(c);
+        for (unsigned int i = 0; i < n_dofs_1d; ++i)
+          for (unsigned int j = 0; j < n_dofs_1d; ++j)
+            matrix_1d[(c * step + i) * n_dofs_1d + j] =
+              prolongation(lexicographic_1d[i], lexicographic_1d[j]);
+      }
+
+    const Triangulation<dim> &tria_fine = dof_handler_fine.get_triangulation();
+
+    std::vector<types::global_dof_index> indices_fine, indices_coarse;
+    std::vector<types::global_dof_index> cell_indices(fe.n_dofs_per_cell());
+    for (const auto &cell : dof_handler_coarse.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          cell->get_dof_indices(cell_indices);
+          for (unsigned int i = 0; i < cell_indices.size(); ++i)
+            indices_coarse.push_back(cell_indices[lexicographic[i]]);
+
+          const CellId                    cell_id = cell->id();
+          const ArrayView<const std::uint8_t> child_indices =
+            cell_id.get_child_indices();
+          std::vector<std::uint8_t> child_path(child_indices.begin(),
+                                               child_indices.end());
+          child_path.push_back(0);
+
+          const std::size_t offset = indices_fine.size();
+          indices_fine.resize(offset + Utilities::pow(n_dofs_1d_patch, dim));
+          for (unsigned int c = 0; c < GeometryInfo<dim>::max_children_per_cell;
+               ++c)
+            {
+              child_path.back() = c;
+              const CellId child_id(cell_id.get_coarse_cell_id(), child_path);
+              AssertThrow(tria_fine.contains_cell(child_id),
+                          ExcMessage(
+                            "The children of all locally owned coarse cells "
+                            "need to be present on the fine mesh."));
+              const auto child = tria_fine.create_cell_iterator(child_id)
+                                   ->as_dof_handler_iterator(dof_handler_fine);
+              AssertThrow(child->is_active(),
+                          ExcNotImplemented(
+                            "The fine mesh needs to be obtained by refining "
+                            "all cells of the coarse mesh once."));
+              child->get_dof_indices(cell_indices);
+
+              for (unsigned int i = 0; i < cell_indices.size(); ++i)
+                {
+                  unsigned int index_patch = 0;
+                  for (unsigned int d = 0, stride = 1, i_lex = i; d < dim;
+                       ++d, stride *= n_dofs_1d_patch, i_lex /= n_dofs_1d)
+                    index_patch +=
+                      stride * ((i_lex % n_dofs_1d) + ((c >> d) & 1) * step);
+                  indices_fine[offset + index_patch] =
+                    cell_indices[lexicographic[i]];
+                }
+            }
+        }
+
+    this->n_dofs_1d_coarse = n_dofs_1d;
+    this->n_dofs_1d_fine   = n_dofs_1d_patch;
+    setup_data(dof_handler_fine,
+               dof_handler_coarse,
+               constraint_fine,
+               constraint_coarse,
+               numbers::invalid_unsigned_int,
+               numbers::invalid_unsigned_int,
+               matrix_1d,
+               indices_fine,
+               indices_coarse);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::reinit_polynomial_transfer(
+    const DoFHandler<dim>           &dof_handler_fine,
+    const DoFHandler<dim>           &dof_handler_coarse,
+    const AffineConstraints<Number> &constraint_fine,
+    const AffineConstraints<Number> &constraint_coarse,
+    const unsigned int               mg_level_fine,
+    const unsigned int               mg_level_coarse)
+  {
+    Assert(&dof_handler_fine.get_triangulation() ==
+             &dof_handler_coarse.get_triangulation(),
+           ExcMessage("The polynomial transfer requires both DoFHandler "
+                      "objects to be defined on the same triangulation."));
+    Assert((mg_level_fine == numbers::invalid_unsigned_int) ==
+             (mg_level_coarse == numbers::invalid_unsigned_int),
+           ExcMessage("You can only specify either both or no levels."));
+    Assert(mg_level_fine == mg_level_coarse, ExcNotImplemented());
+    AssertThrow(dof_handler_fine.get_fe_collection().size() == 1 &&
+                  dof_handler_coarse.get_fe_collection().size() == 1,
+                ExcNotImplemented());
+
+    const FiniteElement<dim> &fe_fine   = dof_handler_fine.get_fe();
+    const FiniteElement<dim> &fe_coarse = dof_handler_coarse.get_fe();
+
+    std::vector<unsigned int> lexicographic_fine, lexicographic_1d_fine;
+    std::vector<unsigned int> lexicographic_coarse, lexicographic_1d_coarse;
+    const std::unique_ptr<FiniteElement<1>> fe_1d_fine =
+      internal::create_1d_fe_and_numbering(fe_fine,
+                                           lexicographic_fine,
+                                           lexicographic_1d_fine);
+    const std::unique_ptr<FiniteElement<1>> fe_1d_coarse =
+      internal::create_1d_fe_and_numbering(fe_coarse,
+                                           lexicographic_coarse,
+                                           lexicographic_1d_coarse);
+
+    const unsigned int n_dofs_1d_fine   = fe_1d_fine->n_dofs_per_cell();
+    const unsigned int n_dofs_1d_coarse = fe_1d_coarse->n_dofs_per_cell();
+
+    FullMatrix<double> projection(n_dofs_1d_fine, n_dofs_1d_coarse);
+    FETools::get_projection_matrix(*fe_1d_coarse, *fe_1d_fine, projection);
+    std::vector<double> matrix_1d(n_dofs_1d_fine * n_dofs_1d_coarse);
+    for (unsigned int i = 0; i < n_dofs_1d_fine; ++i)
+      for (unsigned int j = 0; j < n_dofs_1d_coarse; ++j)
+        matrix_1d[i * n_dofs_1d_coarse + j] =
+          projection(lexicographic_1d_fine[i], lexicographic_1d_coarse[j]);
+
+    std::vector<types::global_dof_index> indices_fine, indices_coarse;
+    std::vector<types::global_dof_index> cell_indices_fine(
+      fe_fine.n_dofs_per_cell());
+    std::vector<types::global_dof_index> cell_indices_coarse(
+      fe_coarse.n_dofs_per_cell());
+
+    const auto process_cell = [&](const auto &cell_fine,
+                                  const auto &cell_coarse) {
+      if (mg_level_fine == numbers::invalid_unsigned_int)
+        {
+          cell_fine->get_dof_indices(cell_indices_fine);
+          cell_coarse->get_dof_indices(cell_indices_coarse);
+        }
+      else
+        {
+          cell_fine->get_mg_dof_indices(cell_indices_fine);
+          cell_coarse->get_mg_dof_indices(cell_indices_coarse);
+        }
+      for (unsigned int i = 0; i < cell_indices_coarse.size(); ++i)
+        indices_coarse.push_back(cell_indices_coarse[lexicographic_coarse[i]]);
+      for (unsigned int i = 0; i < cell_indices_fine.size(); ++i)
+        indices_fine.push_back(cell_indices_fine[lexicographic_fine[i]]);
+    };
+
+    if (mg_level_fine == numbers::invalid_unsigned_int)
+      {
+        for (const auto &cell : dof_handler_fine.active_cell_iterators())
+          if (cell->is_locally_owned())
+            process_cell(cell, cell->as_dof_handler_iterator(dof_handler_coarse));
+      }
+    else
+      {
+        for (const auto &cell :
+             dof_handler_fine.mg_cell_iterators_on_level(mg_level_fine))
+          if (cell->is_locally_owned_on_level())
+            process_cell(cell,
+                         cell->as_dof_handler_level_iterator(
+                           dof_handler_coarse));
+      }
+
+    this->n_dofs_1d_coarse = n_dofs_1d_coarse;
+    this->n_dofs_1d_fine   = n_dofs_1d_fine;
+    setup_data(dof_handler_fine,
+               dof_handler_coarse,
+               constraint_fine,
+               constraint_coarse,
+               mg_level_fine,
+               mg_level_coarse,
+               matrix_1d,
+               indices_fine,
+               indices_coarse);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::reinit(
+    const DoFHandler<dim>           &dof_handler_fine,
+    const DoFHandler<dim>           &dof_handler_coarse,
+    const AffineConstraints<Number> &constraint_fine,
+    const AffineConstraints<Number> &constraint_coarse,
+    const unsigned int               mg_level_fine,
+    const unsigned int               mg_level_coarse)
+  {
+    if (&dof_handler_fine.get_triangulation() ==
+        &dof_handler_coarse.get_triangulation())
+      reinit_polynomial_transfer(dof_handler_fine,
+                                 dof_handler_coarse,
+                                 constraint_fine,
+                                 constraint_coarse,
+                                 mg_level_fine,
+                                 mg_level_coarse);
+    else
+      {
+        Assert(mg_level_fine == numbers::invalid_unsigned_int &&
+                 mg_level_coarse == numbers::invalid_unsigned_int,
+               ExcNotImplemented());
+        reinit_geometric_transfer(dof_handler_fine,
+                                  dof_handler_coarse,
+                                  constraint_fine,
+                                  constraint_coarse);
+      }
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::setup_data(
+    const DoFHandler<dim>                      &dof_handler_fine,
+    const DoFHandler<dim>                      &dof_handler_coarse,
+    const AffineConstraints<Number>            &constraint_fine,
+    const AffineConstraints<Number>            &constraint_coarse,
+    const unsigned int                          mg_level_fine,
+    const unsigned int                          mg_level_coarse,
+    const std::vector<double>                  &matrix_1d,
+    const std::vector<types::global_dof_index> &indices_fine,
+    const std::vector<types::global_dof_index> &indices_coarse)
+  {
+    const unsigned int n_dofs_fine   = Utilities::pow(n_dofs_1d_fine, dim);
+    const unsigned int n_dofs_coarse = Utilities::pow(n_dofs_1d_coarse, dim);
+    AssertDimension(indices_fine.size() % n_dofs_fine, 0);
+    n_coarse_cells = indices_fine.size() / n_dofs_fine;
+    AssertDimension(indices_coarse.size(), n_coarse_cells * n_dofs_coarse);
+
+    // only homogeneous constraints can be handled by simply skipping the
+    // constrained entries
+    const auto check_constraints =
+      [](const AffineConstraints<Number>            &constraints,
+         const std::vector<types::global_dof_index> &indices) {
+        for (const types::global_dof_index index : indices)
+          if (constraints.is_constrained(index))
+            {
+              const auto *entries = constraints.get_constraint_entries(index);
+              AssertThrow(entries == nullptr || entries->empty(),
+                          ExcNotImplemented(
+                            "Portable::MGTwoLevelTransfer does not support "
+                            "constraints other than homogeneous Dirichlet "
+                            "conditions, such as hanging-node "
+                            "constraints."));
+            }
+      };
+    check_constraints(constraint_fine, indices_fine);
+    check_constraints(constraint_coarse, indices_coarse);
+
+    const auto create_partitioner =
+      [](const DoFHandler<dim>                      &dof_handler,
+         const unsigned int                          mg_level,
+         const std::vector<types::global_dof_index> &indices) {
+        const IndexSet &locally_owned =
+          (mg_level == numbers::invalid_unsigned_int) ?
+            dof_handler.locally_owned_dofs() :
+            dof_handler.locally_owned_mg_dofs(mg_level);
+
+        std::vector<types::global_dof_index> ghost_indices;
+        for (const types::global_dof_index index : indices)
+          if (!locally_owned.is_element(index))
+            ghost_indices.push_back(index);
+        std::sort(ghost_indices.begin(), ghost_indices.end());
+        ghost_indices.erase(std::unique(ghost_indices.begin(),
+                                        ghost_indices.end()),
+                            ghost_indices.end());
+
+        IndexSet ghosts(locally_owned.size());
+        ghosts.add_indices(ghost_indices.begin(), ghost_indices.end());
+
+        return std::make_shared<const Utilities::MPI::Partitioner>(
+          locally_owned, ghosts, dof_handler.get_communicator());
+      };
+    partitioner_fine =
+      create_partitioner(dof_handler_fine, mg_level_fine, indices_fine);
+    partitioner_coarse =
+      create_partitioner(dof_handler_coarse, mg_level_coarse, indices_coarse);
+
+    vec_fine.reinit(partitioner_fine);
+    vec_coarse.reinit(partitioner_coarse);
+
+    // the weights are given by the number of patches a fine degree of freedom
+    // belongs to
+    LinearAlgebra::distributed::Vector<Number, MemorySpace::Host> valence(
+      partitioner_fine);
+    for (const types::global_dof_index index : indices_fine)
+      valence(index) += Number(1);
+    valence.compress(VectorOperation::add);
+    valence.update_ghost_values();
+
+    prolongation_matrix_1d =
+      Kokkos::View<Number *, MemorySpace::Default::kokkos_space>(
+        Kokkos::view_alloc("prolongation_matrix_1d", Kokkos::WithoutInitializing),
+        matrix_1d.size());
+    dof_indices_coarse =
+      Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>(
+        Kokkos::view_alloc("dof_indices_coarse", Kokkos::WithoutInitializing),
+        n_coarse_cells,
+        n_dofs_coarse);
+    dof_indices_fine =
+      Kokkos::View<unsigned int **, MemorySpace::Default::kokkos_space>(
+        Kokkos::view_alloc("dof_indices_fine", Kokkos::WithoutInitializing),
+        n_coarse_cells,
+        n_dofs_fine);
+    weights_fine = Kokkos::View<Number **, MemorySpace::Default::kokkos_space>(
+      Kokkos::view_alloc("weights_fine", Kokkos::WithoutInitializing),
+      n_coarse_cells,
+      n_dofs_fine);
+
+    auto matrix_host = Kokkos::create_mirror_view(prolongation_matrix_1d);
+    for (unsigned int i = 0; i < matrix_1d.size(); ++i)
+      matrix_host(i) = matrix_1d[i];
+    Kokkos::deep_copy(prolongation_matrix_1d, matrix_host);
+
+    auto indices_coarse_host = Kokkos::create_mirror_view(dof_indices_coarse);
+    for (unsigned int cell = 0, k = 0; cell < n_coarse_cells; ++cell)
+      for (unsigned int i = 0; i < n_dofs_coarse; ++i, ++k)
+        indices_coarse_host(cell, i) =
+          constraint_coarse.is_constrained(indices_coarse[k]) ?
+            numbers::invalid_unsigned_int :
+            partitioner_coarse->global_to_local(indices_coarse[k]);
+    Kokkos::deep_copy(dof_indices_coarse, indices_coarse_host);
+
+    auto indices_fine_host = Kokkos::create_mirror_view(dof_indices_fine);
+    auto weights_host      = Kokkos::create_mirror_view(weights_fine);
+    for (unsigned int cell = 0, k = 0; cell < n_coarse_cells; ++cell)
+      for (unsigned int i = 0; i < n_dofs_fine; ++i, ++k)
+        {
+          indices_fine_host(cell, i) =
+            partitioner_fine->global_to_local(indices_fine[k]);
+          weights_host(cell, i) =
+            constraint_fine.is_constrained(indices_fine[k]) ?
+              Number(0) :
+              Number(1) / valence(indices_fine[k]);
+        }
+    Kokkos::deep_copy(dof_indices_fine, indices_fine_host);
+    Kokkos::deep_copy(weights_fine, weights_host);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::prolongate_and_add(
+    VectorType       &dst,
+    const VectorType &src) const
+  {
+    Assert(partitioner_fine.get() != nullptr, ExcNotInitialized());
+
+    // work directly on the external vectors if they have the internal layout
+    const bool src_is_internal =
+      src.get_partitioner().get() == partitioner_coarse.get();
+    const bool dst_is_internal =
+      dst.get_partitioner().get() == partitioner_fine.get();
+    const bool src_ghosts_were_set = src.has_ghost_elements();
+
+    if (src_is_internal == false)
+      vec_coarse.copy_locally_owned_data_from(src);
+    const VectorType &src_ghosted = src_is_internal ? src : vec_coarse;
+    src_ghosted.update_ghost_values();
+
+    VectorType &dst_ghosted = dst_is_internal ? dst : vec_fine;
+    if (dst_is_internal)
+      dst.zero_out_ghost_values();
+    else
+      vec_fine = Number();
+
+    if (n_coarse_cells > 0)
+      {
+        internal::TransferKernel<dim, Number> kernel{true,
+                                                     n_dofs_1d_coarse,
+                                                     n_dofs_1d_fine,
+                                                     prolongation_matrix_1d,
+                                                     dof_indices_coarse,
+                                                     dof_indices_fine,
+                                                     weights_fine,
+                                                     src_ghosted.get_values(),
+                                                     dst_ghosted.get_values()};
+
+        MemorySpace::Default::kokkos_space::execution_space exec;
+        Kokkos::TeamPolicy<MemorySpace::Default::kokkos_space::execution_space>
+          team_policy(exec, n_coarse_cells, Kokkos::AUTO);
+        Kokkos::parallel_for("dealii::Portable::MGTwoLevelTransfer::prolongate",
+                             team_policy,
+                             kernel);
+        exec.fence();
+      }
+
+    dst_ghosted.compress(VectorOperation::add);
+    if (dst_is_internal == false)
+      dst.add(Number(1), vec_fine);
+
+    if (src_is_internal && src_ghosts_were_set == false)
+      src.zero_out_ghost_values();
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTwoLevelTransfer<dim, Number>::restrict_and_add(VectorType       &dst,
+                                                    const VectorType &src) const
+  {
+    Assert(partitioner_fine.get() != nullptr, ExcNotInitialized());
+
+    const bool src_is_internal =
+      src.get_partitioner().get() == partitioner_fine.get();
+    const bool dst_is_internal =
+      dst.get_partitioner().get() == partitioner_coarse.get();
+    const bool src_ghosts_were_set = src.has_ghost_elements();
+
+    if (src_is_internal == false)
+      vec_fine.copy_locally_owned_data_from(src);
+    const VectorType &src_ghosted = src_is_internal ? src : vec_fine;
+    src_ghosted.update_ghost_values();
+
+    VectorType &dst_ghosted = dst_is_internal ? dst : vec_coarse;
+    if (dst_is_internal)
+      dst.zero_out_ghost_values();
+    else
+      vec_coarse = Number();
+
+    if (n_coarse_cells > 0)
+      {
+        internal::TransferKernel<dim, Number> kernel{false,
+                                                     n_dofs_1d_coarse,
+                                                     n_dofs_1d_fine,
+                                                     prolongation_matrix_1d,
+                                                     dof_indices_coarse,
+                                                     dof_indices_fine,
+                                                     weights_fine,
+                                                     src_ghosted.get_values(),
+                                                     dst_ghosted.get_values()};
+
+        MemorySpace::Default::kokkos_space::execution_space exec;
+        Kokkos::TeamPolicy<MemorySpace::Default::kokkos_space::execution_space>
+          team_policy(exec, n_coarse_cells, Kokkos::AUTO);
+        Kokkos::parallel_for("dealii::Portable::MGTwoLevelTransfer::restrict",
+                             team_policy,
+                             kernel);
+        exec.fence();
+      }
+
+    dst_ghosted.compress(VectorOperation::add);
+    if (dst_is_internal == false)
+      dst.add(Number(1), vec_coarse);
+
+    if (src_is_internal && src_ghosts_were_set == false)
+      src.zero_out_ghost_values();
+  }
+
+
+
+  template <int dim, typename Number>
+  std::size_t
+  MGTwoLevelTransfer<dim, Number>::memory_consumption() const
+  {
+    return prolongation_matrix_1d.span() * sizeof(Number) +
+           dof_indices_coarse.span() * sizeof(unsigned int) +
+           dof_indices_fine.span() * sizeof(unsigned int) +
+           weights_fine.span() * sizeof(Number) +
+           vec_coarse.memory_consumption() + vec_fine.memory_consumption();
+  }
+
+
+
+  template <int dim, typename Number>
+  MGTransferMF<dim, Number>::MGTransferMF(
+    const MGLevelObject<MGTwoLevelTransfer<dim, Number>> &transfer,
+    const std::function<void(const unsigned int, VectorType &)>
+      &initialize_dof_vector)
+    : initialize_dof_vector(initialize_dof_vector)
+  {
+    this->transfer.resize(transfer.min_level(), transfer.max_level());
+    for (unsigned int l = transfer.min_level() + 1; l <= transfer.max_level();
+         ++l)
+      this->transfer[l] = &transfer[l];
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::prolongate(const unsigned int to_level,
+                                        VectorType        &dst,
+                                        const VectorType  &src) const
+  {
+    dst = Number(0.);
+    prolongate_and_add(to_level, dst, src);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::prolongate_and_add(const unsigned int to_level,
+                                                VectorType        &dst,
+                                                const VectorType  &src) const
+  {
+    transfer[to_level]->prolongate_and_add(dst, src);
+  }
+
+
+
+  template <int dim, typename Number>
+  void
+  MGTransferMF<dim, Number>::restrict_and_add(const unsigned int from_level,
+                                              VectorType        &dst,
+                                              const VectorType  &src) const
+  {
+    transfer[from_level]->restrict_and_add(dst, src);
+  }
+} // namespace Portable
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
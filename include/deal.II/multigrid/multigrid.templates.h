@@ -125,12 +125,14 @@ Multigrid<VectorType>::level_v_step(const unsigned int level)
 
   // compute residual on level, which includes the (CG) edge matrix
   this->signals.residual_step(true, level);
-  matrix->vmult(level, t[level], solution[level]);
   if (edge_out != nullptr)
     {
+      matrix->vmult(level, t[level], solution[level]);
       edge_out->vmult_add(level, t[level], solution[level]);
+      t[level].sadd(-1.0, 1.0, defect[level]);
     }
-  t[level].sadd(-1.0, 1.0, defect[level]);
+  else
+    matrix->residual(level, t[level], solution[level], defect[level]);
 
   // Get the defect on the next coarser level as part of the (DG) edge matrix
   // and then the main part by the restriction of the transfer
@@ -199,10 +201,14 @@ Multigrid<VectorType>::level_step(const unsigned int level, Cycle cycle)
 
   // compute residual on level, which includes the (CG) edge matrix
   this->signals.residual_step(true, level);
-  matrix->vmult(level, t[level], solution[level]);
   if (edge_out != nullptr)
-    edge_out->vmult_add(level, t[level], solution[level]);
-  t[level].sadd(-1.0, 1.0, defect2[level]);
+    {
+      matrix->vmult(level, t[level], solution[level]);
+      edge_out->vmult_add(level, t[level], solution[level]);
+      t[level].sadd(-1.0, 1.0, defect2[level]);
+    }
+  else
+    matrix->residual(level, t[level], solution[level], defect2[level]);
 
   // Get the defect on the next coarser level as part of the (DG) edge matrix
   // and then the main part by the restriction of the transfer
@@ -32,6 +32,7 @@
 
 #include <deal.II/non_matching/fe_immersed_values.h>
 #include <deal.II/non_matching/mesh_classifier.h>
+#include <deal.II/non_matching/quadrature_cache.h>
 #include <deal.II/non_matching/quadrature_generator.h>
 
 #include <deque>
@@ -300,6 +301,16 @@ namespace NonMatching
     const std::optional<FEImmersedSurfaceValues<dim>> &
     get_surface_fe_values() const;
 
+    /**
+     * Use @p cache to store the immersed quadrature rules generated on
+     * intersected cells, and to look them up instead of generating them
+     * again in later calls to reinit(). The cache can be shared with other
+     * objects and needs to be cleared by the user when the level set
+     * changes. The cache must live at least as long as this object.
+     */
+    void
+    set_quadrature_cache(QuadratureCache<dim> &cache);
+
   private:
     /**
      * Internal function called by the reinit() functions.
@@ -418,6 +429,12 @@ namespace NonMatching
      * Object that generates the immersed quadrature rules.
      */
     DiscreteQuadratureGenerator<dim> quadrature_generator;
+
+    /**
+     * Pointer to the cache of immersed quadrature rules, if any was set with
+     * set_quadrature_cache().
+     */
+    SmartPointer<QuadratureCache<dim>> quadrature_cache;
   };
 
 
@@ -623,6 +640,16 @@ namespace NonMatching
     const std::optional<dealii::FEInterfaceValues<dim>> &
     get_outside_fe_values() const;
 
+    /**
+     * Use @p cache to store the immersed quadrature rules generated on
+     * intersected faces, and to look them up instead of generating them
+     * again in later calls to reinit(). The cache can be shared with other
+     * objects and needs to be cleared by the user when the level set
+     * changes. The cache must live at least as long as this object.
+     */
+    void
+    set_quadrature_cache(QuadratureCache<dim> &cache);
+
   private:
     /**
      * Do work common to the constructors. The incoming QCollection should be
@@ -714,6 +741,12 @@ namespace NonMatching
      * Object that generates the immersed quadrature rules.
      */
     DiscreteFaceQuadratureGenerator<dim> face_quadrature_generator;
+
+    /**
+     * Pointer to the cache of immersed quadrature rules, if any was set with
+     * set_quadrature_cache().
+     */
+    SmartPointer<QuadratureCache<dim>> quadrature_cache;
   };
 
 
@@ -22,6 +22,7 @@
 #include "deal.II/base/floating_point_comparator.h"
 #include <deal.II/base/aligned_vector.h>
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/vectorization.h>
 
 #include <deal.II/fe/fe_dgq.h>
@@ -594,7 +595,9 @@ namespace NonMatching
       const std::function<
         void(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
              const QuadratureType &quadrature,
-             MappingData          &mapping_data)> &compute_mapping_data);
+             std::unique_ptr<typename Mapping<dim, spacedim>::InternalDataBase>
+                         &internal_mapping_data,
+             MappingData &mapping_data)> &compute_mapping_data);
 
     /**
      * Enum class for reinitialized states.
@@ -957,7 +960,9 @@ namespace NonMatching
     const std::function<
       void(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
            const QuadratureType &quadrature,
-           MappingData          &mapping_data)> &compute_mapping_data)
+           std::unique_ptr<typename Mapping<dim, spacedim>::InternalDataBase>
+                       &internal_mapping_data,
+           MappingData &mapping_data)> &compute_mapping_data)
   {
     clear();
 
@@ -1007,11 +1012,50 @@ namespace NonMatching
       cell_index_to_compressed_cell_index.resize(n_unfiltered_cells,
                                                  numbers::invalid_unsigned_int);
 
+    // Collect the cells, such that the mapping data of several cells can be
+    // computed in parallel below.
+    std::vector<typename Triangulation<dim, spacedim>::cell_iterator> cells;
+    cells.reserve(n_cells);
+    for (const auto &cell : cell_iterator_range)
+      cells.push_back(cell);
+
+    // The evaluation of the mapping is the expensive part of the setup and
+    // independent between cells. We compute it in parallel for chunks of
+    // cells, with separate internal data of the mapping for each subrange,
+    // and process the results of a chunk in order afterwards, since the
+    // compression of the data of affine cells compares subsequent cells. The
+    // chunks bound the memory needed for the intermediate mapping data.
+    const unsigned int       chunk_size = 256;
+    std::vector<MappingData> chunk_mapping_data(std::min(n_cells, chunk_size));
+
     MappingData  mapping_data_previous_cell;
     unsigned int size_compressed_data = 0;
-    unsigned int cell_index           = 0;
-    for (const auto &cell : cell_iterator_range)
+    for (unsigned int cell_index = 0; cell_index < n_cells; ++cell_index)
       {
+        if (cell_index % chunk_size == 0)
+          {
+            const unsigned int chunk_begin = cell_index;
+            const unsigned int chunk_end =
+              std::min(chunk_begin + chunk_size, n_cells);
+            dealii::parallel::apply_to_subranges(
+              chunk_begin,
+              chunk_end,
+              [&](const unsigned int begin, const unsigned int end) {
+                auto internal_data =
+                  mapping->get_data(update_flags, Quadrature<dim>());
+                for (unsigned int i = begin; i < end; ++i)
+                  compute_mapping_data(cells[i],
+                                       quadrature_vector[i],
+                                       internal_data,
+                                       chunk_mapping_data[i - chunk_begin]);
+              },
+              16);
+          }
+
+        const auto  &cell = cells[cell_index];
+        MappingData &cell_mapping_data =
+          chunk_mapping_data[cell_index % chunk_size];
+
         if (additional_data.store_cells)
           {
             this->triangulation                = &cell->get_triangulation();
@@ -1029,9 +1073,6 @@ namespace NonMatching
                           n_q_points_unvectorized[cell_index],
                           quadrature.get_points());
 
-        // compute mapping data
-        compute_mapping_data(cell, quadrature, mapping_data);
-
         // store mapping data
         const unsigned int n_q_points_data =
           compute_n_q_points<Number>(n_q_points_unvectorized[cell_index]);
@@ -1040,9 +1081,8 @@ namespace NonMatching
         if (!empty &&
             update_flags_mapping & UpdateFlags::update_inverse_jacobians)
           {
-            cell_type.push_back(
-              internal::compute_geometry_type(cell->diameter(),
-                                              mapping_data.inverse_jacobians));
+            cell_type.push_back(internal::compute_geometry_type(
+              cell->diameter(), cell_mapping_data.inverse_jacobians));
           }
         else
           cell_type.push_back(
@@ -1066,11 +1106,11 @@ namespace NonMatching
             // we can only compare if current and previous cell have at least
             // one quadrature point and both cells are at least affine
             const auto comparison_result =
-              (!affine_cells || mapping_data.inverse_jacobians.empty() ||
+              (!affine_cells || cell_mapping_data.inverse_jacobians.empty() ||
                mapping_data_previous_cell.inverse_jacobians.empty()) ?
                 FloatingPointComparator<double>::ComparisonResult::less :
                 comparator.compare(
-                  mapping_data.inverse_jacobians[0],
+                  cell_mapping_data.inverse_jacobians[0],
                   mapping_data_previous_cell.inverse_jacobians[0]);
 
             // we can compress the Jacobians and inverse Jacobians if
@@ -1099,13 +1139,10 @@ namespace NonMatching
         else
           compressed_data_index_offsets.push_back(0);
 
-        // cache mapping_data from previous cell
-        mapping_data_previous_cell = mapping_data;
-
         store_mapping_data(data_index_offsets[cell_index],
                            n_q_points_data,
                            n_q_points_unvectorized[cell_index],
-                           mapping_data,
+                           cell_mapping_data,
                            quadrature.get_weights(),
                            compressed_data_index_offsets[cell_index],
                            cell_type[cell_index] <=
@@ -1125,7 +1162,10 @@ namespace NonMatching
           cell_index_to_compressed_cell_index[cell->active_cell_index()] =
             cell_index;
 
-        ++cell_index;
+        // keep the mapping data of this cell for the comparison with the
+        // next one, and reuse the memory of the previous cell for the next
+        // chunk
+        std::swap(mapping_data_previous_cell, cell_mapping_data);
       }
 
     if (update_flags_mapping & UpdateFlags::update_jacobians)
@@ -1155,7 +1195,9 @@ namespace NonMatching
     auto compute_mapping_data_for_cells =
       [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
           const Quadrature<dim> &quadrature,
-          MappingData           &mapping_data) {
+          std::unique_ptr<typename Mapping<dim, spacedim>::InternalDataBase>
+                      &internal_data,
+          MappingData &mapping_data) {
         CellSimilarity::Similarity cell_similarity =
           CellSimilarity::Similarity::none;
         internal::ComputeMappingDataHelper<dim, spacedim>::
@@ -1164,7 +1206,7 @@ namespace NonMatching
                                               cell,
                                               cell_similarity,
                                               quadrature,
-                                              internal_mapping_data,
+                                              internal_data,
                                               mapping_data);
       };
 
@@ -1198,14 +1240,16 @@ namespace NonMatching
     auto compute_mapping_data_for_surface =
       [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
           const ImmersedSurfaceQuadrature<dim> &quadrature,
-          MappingData                          &mapping_data) {
+          std::unique_ptr<typename Mapping<dim, spacedim>::InternalDataBase>
+                      &internal_data,
+          MappingData &mapping_data) {
         internal::ComputeMappingDataHelper<dim, spacedim>::
           compute_mapping_data_for_immersed_surface_quadrature(
             mapping,
             update_flags_mapping,
             cell,
             quadrature,
-            internal_mapping_data,
+            internal_data,
             mapping_data);
       };
 
@@ -0,0 +1,209 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_non_matching_quadrature_cache_h
+#define dealii_non_matching_quadrature_cache_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/non_matching/immersed_surface_quadrature.h>
+#include <deal.II/non_matching/quadrature_generator.h>
+
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace NonMatching
+{
+  /**
+   * A cache of the immersed quadrature rules of intersected cells and faces.
+   *
+   * Generating the immersed quadrature rules with the QuadratureGenerator
+   * classes requires root finding and the recursive construction of height
+   * functions on every intersected cell, which is often more expensive than
+   * the assembly on the cell itself. If the level set function does not
+   * change between several assembly loops, e.g., over the Newton iterations
+   * or time steps of a solver on a fixed geometry, the rules can be generated
+   * once and reused. This class stores them, indexed by the active cell
+   * index, the face number, and the index of the 1d quadrature used as base
+   * for the generation.
+   *
+   * An object of this class can be passed to NonMatching::FEValues and
+   * NonMatching::FEInterfaceValues, which then look up the quadrature rules
+   * of an intersected cell or face in the cache before generating them, and
+   * store newly generated rules in it. Several such objects, e.g., the
+   * copies used by the different threads of WorkStream::run(), can share
+   * the same cache; access to it is protected by a mutex. The stored rules
+   * can also be used directly, e.g., to set up NonMatching::MappingInfo with
+   * the same quadratures.
+   *
+   * The cache does not observe the level set or the triangulation. It needs
+   * to be cleared with clear() whenever either of them changes.
+   */
+  template <int dim>
+  class QuadratureCache : public Subscriptor
+  {
+  public:
+    /**
+     * The quadrature rules of an intersected cell.
+     */
+    struct CellQuadratures
+    {
+      /**
+       * Quadrature for the region $\{x \in B : \psi(x) < 0 \}$.
+       */
+      Quadrature<dim> inside;
+
+      /**
+       * Quadrature for the region $\{x \in B : \psi(x) > 0 \}$.
+       */
+      Quadrature<dim> outside;
+
+      /**
+       * Quadrature for the region $\{x \in B : \psi(x) = 0 \}$.
+       */
+      ImmersedSurfaceQuadrature<dim> surface;
+
+      /**
+       * Return an estimate for the memory consumption, in bytes.
+       */
+      std::size_t
+      memory_consumption() const;
+    };
+
+    /**
+     * The quadrature rules of an intersected face.
+     */
+    struct FaceQuadratures
+    {
+      /**
+       * Quadrature for the region $\{x \in F : \psi(x) < 0 \}$.
+       */
+      Quadrature<dim - 1> inside;
+
+      /**
+       * Quadrature for the region $\{x \in F : \psi(x) > 0 \}$.
+       */
+      Quadrature<dim - 1> outside;
+
+      /**
+       * Quadrature for the region $\{x \in F : \psi(x) = 0 \}$.
+       */
+      ImmersedSurfaceQuadrature<dim - 1, dim> surface;
+
+      /**
+       * Return an estimate for the memory consumption, in bytes.
+       */
+      std::size_t
+      memory_consumption() const;
+    };
+
+    /**
+     * Return a pointer to the quadrature rules stored for @p cell and the 1d
+     * quadrature with index @p q_index, or a null pointer if no rules have
+     * been stored yet.
+     */
+    const CellQuadratures *
+    find(const typename Triangulation<dim>::cell_iterator &cell,
+         const unsigned int                                q_index) const;
+
+    /**
+     * Store the quadrature rules that @p generator created in its last call
+     * to generate() for @p cell and the 1d quadrature with index
+     * @p q_index, and return a reference to the stored rules. If rules are
+     * already stored for this cell, they are kept.
+     */
+    const CellQuadratures &
+    insert(const typename Triangulation<dim>::cell_iterator &cell,
+           const unsigned int                                q_index,
+           const QuadratureGenerator<dim>                   &generator);
+
+    /**
+     * Same as above, but for face @p face_no of @p cell.
+     */
+    const FaceQuadratures *
+    find(const typename Triangulation<dim>::cell_iterator &cell,
+         const unsigned int                                face_no,
+         const unsigned int                                q_index) const;
+
+    /**
+     * Same as above, but for face @p face_no of @p cell.
+     */
+    const FaceQuadratures &
+    insert(const typename Triangulation<dim>::cell_iterator &cell,
+           const unsigned int                                face_no,
+           const unsigned int                                q_index,
+           const FaceQuadratureGenerator<dim>               &generator);
+
+    /**
+     * Remove all stored quadrature rules.
+     */
+    void
+    clear();
+
+    /**
+     * Return the number of cells for which quadrature rules are stored.
+     */
+    unsigned int
+    n_cells() const;
+
+    /**
+     * Return the number of faces for which quadrature rules are stored.
+     */
+    unsigned int
+    n_faces() const;
+
+    /**
+     * Return an estimate for the memory consumption, in bytes, of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
+
+  private:
+    /**
+     * Mutex protecting the maps below.
+     */
+    mutable std::mutex mutex;
+
+    /**
+     * The quadrature rules of the cells, indexed by the active cell index
+     * and the index of the 1d quadrature. The entries of a std::map do not
+     * move when other entries are inserted, so references to them stay
+     * valid until clear() is called.
+     */
+    std::map<std::pair<unsigned int, unsigned int>, CellQuadratures>
+      cell_quadratures;
+
+    /**
+     * The quadrature rules of the faces, indexed by the active cell index,
+     * the face number, and the index of the 1d quadrature.
+     */
+    std::map<std::tuple<unsigned int, unsigned int, unsigned int>,
+             FaceQuadratures>
+      face_quadratures;
+  };
+} // namespace NonMatching
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
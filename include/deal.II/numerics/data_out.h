@@ -318,6 +318,31 @@ public:
                 const unsigned int                          n_subdivisions = 0,
                 const CurvedCellRegion curved_region = curved_boundary);
 
+  /**
+   * Generate the patches in chunks of @p n_cells_per_chunk cells and write
+   * each chunk as a separate piece of a VTU file to @p out as soon as it has
+   * been generated, using the flags set via DataOutInterface::set_flags().
+   * In contrast to calling build_patches() followed by
+   * DataOutInterface::write_vtu(), the patches of all cells are never stored
+   * at the same time, which limits the memory consumption for large meshes
+   * or many subdivisions to the one of a single chunk. The patches of each
+   * chunk are still built in parallel. For the meaning of the remaining
+   * arguments, see build_patches().
+   *
+   * Since the patches are discarded once they have been written, this
+   * object does not store any patches after this function returns.
+   *
+   * @note Setting DataOutBase::VtkFlags::merge_duplicate_vertices further
+   *   reduces the size of the output. Nodes are only merged within each
+   *   chunk, though.
+   */
+  void
+  write_vtu_in_chunks(std::ostream                 &out,
+                      const Mapping<dim, spacedim> &mapping,
+                      const unsigned int            n_cells_per_chunk,
+                      const unsigned int            n_subdivisions = 0,
+                      const CurvedCellRegion curved_region = curved_boundary);
+
   /**
    * A function that allows selecting for which cells output should be
    * generated. This function takes two arguments, both `std::function`
@@ -447,7 +472,22 @@ private:
     const std::pair<cell_iterator, unsigned int> *cell_and_index,
     internal::DataOutImplementation::ParallelData<dim, spacedim> &scratch_data,
     const unsigned int     n_subdivisions,
-    const CurvedCellRegion curved_cell_region);
+    const CurvedCellRegion curved_cell_region,
+    const unsigned int     first_patch_index);
+
+  /**
+   * Build the patches as described in build_patches(), but only for
+   * @p n_cells_per_chunk cells at a time, such that the patches of the
+   * current chunk replace the ones of the previous chunk. After each chunk
+   * has been built, @p process_chunk is called. The indices of the patches
+   * and of their neighbors refer to the numbering of all patches.
+   */
+  void
+  build_patches_in_chunks(const hp::MappingCollection<dim, spacedim> &mapping,
+                          const unsigned int           n_subdivisions,
+                          const CurvedCellRegion       curved_region,
+                          const unsigned int           n_cells_per_chunk,
+                          const std::function<void()> &process_chunk);
 };
 
 
@@ -53,6 +53,12 @@ DEAL_II_NAMESPACE_OPEN
  * data_out.build_patches(mapping);
  * @endcode
  *
+ * All components of all vectors added to this object are evaluated at the
+ * points of the patch triangulation together, which only needs a single round
+ * of communication in build_patches(). Hence, the cost of the output on a
+ * slice between two time steps in which the mesh does not change is
+ * dominated by the evaluation of the solution at the points.
+ *
  * @note While the dimension of the two triangulations might differ, their
  *   space dimension need to coincide.
  */
@@ -123,6 +129,17 @@ public:
       curved_region =
         DataOut<patch_dim, spacedim>::CurvedCellRegion::curved_boundary);
 
+  /**
+   * Return whether the evaluation points and the communication pattern set
+   * up by update_mapping() are still valid, such that the build_patches()
+   * function without mapping argument can reuse them. They are invalidated
+   * once the triangulation the data vectors are defined on changes. Changes
+   * of the mapping can not be detected, so update_mapping() needs to be
+   * called explicitly in that case.
+   */
+  bool
+  is_ready() const;
+
 protected:
   virtual const std::vector<typename DataOutBase::Patch<patch_dim, spacedim>> &
   get_patches() const override;
@@ -576,6 +576,16 @@ namespace DataPostprocessorInputs
  * step-58 provides an example of how this class (or, rather, the derived
  * DataPostprocessorScalar class) is used in a complex-valued situation.
  *
+ * <h3>Matrix-free evaluation</h3>
+ *
+ * DataOut evaluates the solution for the postprocessor with FEValues, one
+ * cell at a time. For large computations with matrix-free operators, the
+ * derived quantities can instead be computed with
+ * MatrixFreeTools::evaluate_derived_quantity(), which evaluates the solution
+ * with FEEvaluation on batches of cells and stores the result in a
+ * discontinuous finite element field that is then passed to DataOut as an
+ * ordinary data vector.
+ *
  * @ingroup output
  */
 template <int dim>
@@ -296,18 +296,17 @@ namespace internal
 
   /**
    * Copy data from the local_face_integrals map of a single ParallelData
-   * object into a global such map. This is the copier stage of a WorkStream
-   * pipeline.
+   * object into a global array indexed by the index of the faces. This is
+   * the copier stage of a WorkStream pipeline.
    */
   template <int dim, int spacedim>
   void
   copy_local_to_global(
     const std::map<typename DoFHandler<dim, spacedim>::face_iterator,
                    std::vector<double>> &local_face_integrals,
-    std::map<typename DoFHandler<dim, spacedim>::face_iterator,
-             std::vector<double>>       &face_integrals)
+    std::vector<std::vector<double>>    &face_integrals)
   {
-    // now copy locally computed elements into the global map
+    // now copy locally computed elements into the global array
     for (typename std::map<typename DoFHandler<dim, spacedim>::face_iterator,
                            std::vector<double>>::const_iterator p =
            local_face_integrals.begin();
@@ -315,9 +314,9 @@ namespace internal
          ++p)
       {
         // double check that the element does not already exists in the
-        // global map
-        Assert(face_integrals.find(p->first) == face_integrals.end(),
-               ExcInternalError());
+        // global array
+        AssertIndexRange(p->first->index(), face_integrals.size());
+        Assert(face_integrals[p->first->index()].empty(), ExcInternalError());
 
         for (unsigned int i = 0; i < p->second.size(); ++i)
           {
@@ -325,7 +324,7 @@ namespace internal
             Assert(p->second[i] >= 0, ExcInternalError());
           }
 
-        face_integrals[p->first] = p->second;
+        face_integrals[p->first->index()] = p->second;
       }
   }
 
@@ -1203,13 +1202,14 @@ KellyErrorEstimator<dim, spacedim>::estimate(
 
   const unsigned int n_solution_vectors = solutions.size();
 
-  // Map of integrals indexed by the corresponding face. In this map we store
-  // the integrated jump of the gradient for each face.  At the end of the
-  // function, we again loop over the cells and collect the contributions of
-  // the different faces of the cell.
-  std::map<typename DoFHandler<dim, spacedim>::face_iterator,
-           std::vector<double>>
-    face_integrals;
+  // Integrals indexed by the index of the corresponding face. In this array
+  // we store the integrated jump of the gradient for each face. At the end
+  // of the function, we again loop over the cells and collect the
+  // contributions of the different faces of the cell. Using the face index
+  // rather than a map keyed by the face iterators makes both the insertion
+  // in the copier and the lookup below constant-time operations.
+  std::vector<std::vector<double>> face_integrals(
+    dof_handler.get_triangulation().n_raw_faces());
 
   // all the data needed in the error estimator by each of the threads is
   // gathered in the following structures
@@ -1276,8 +1276,9 @@ KellyErrorEstimator<dim, spacedim>::estimate(
         // loop over all faces of this cell
         for (const unsigned int face_no : cell->face_indices())
           {
-            Assert(face_integrals.find(cell->face(face_no)) !=
-                     face_integrals.end(),
+            const std::vector<double> &face_integral =
+              face_integrals[cell->face(face_no)->index()];
+            Assert(face_integral.size() == n_solution_vectors,
                    ExcInternalError());
             const double factor = internal::cell_factor<dim, spacedim>(
               cell, face_no, dof_handler, strategy);
@@ -1286,11 +1287,9 @@ KellyErrorEstimator<dim, spacedim>::estimate(
               {
                 // make sure that we have written a meaningful value into this
                 // slot
-                Assert(face_integrals[cell->face(face_no)][n] >= 0,
-                       ExcInternalError());
+                Assert(face_integral[n] >= 0, ExcInternalError());
 
-                (*errors[n])(present_cell) +=
-                  (face_integrals[cell->face(face_no)][n] * factor);
+                (*errors[n])(present_cell) += (face_integral[n] * factor);
               }
           }
 
@@ -18,6 +18,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/function.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/thread_local_storage.h>
@@ -31,6 +32,9 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <deal.II/matrix_free/evaluation_flags.h>
+
+#include <functional>
 #include <optional>
 
 
@@ -42,6 +46,9 @@ namespace VectorTools
 {
   class ExcPointNotAvailableHere;
 }
+
+template <int, int, int, typename>
+class FEPointEvaluation;
 #endif
 
 namespace Functions
@@ -486,6 +493,188 @@ namespace Functions
       const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
       const Point<dim> &point) const;
   };
+
+
+
+  /**
+   * A counterpart of FEFieldFunction for triangulations that are distributed
+   * among several processes. FEFieldFunction searches for the cell around a
+   * point in every call, and can only evaluate the field on the cells that
+   * are available on the current process. This class instead locates a set
+   * of points once, in a collective call to reinit(), using
+   * Utilities::MPI::RemotePointEvaluation. The field is then evaluated on the
+   * processes that own the cells around the points, with one
+   * FEPointEvaluation pass over all points of a cell, and the results are
+   * sent back to the processes that asked for them. Each process can ask
+   * for a different set of points, which do not need to lie in its locally
+   * owned part of the domain.
+   *
+   * As long as neither the points nor the mesh change, the communication
+   * pattern set up by reinit() is reused for all later evaluations, while the
+   * data vector, which is stored by reference, may change between them. A
+   * typical use is the repeated transfer of a field between two meshes that
+   * are distributed independently of each other, for example in a coupled
+   * multi-physics simulation:
+   * @code
+   *   Functions::DistributedFEFieldFunction<dim, VectorType>
+   *     field_function(dof_handler_1, solution_1);
+   *   field_function.reinit(dof_handler_2);
+   *
+   *   // in every time step:
+   *   solution_1.update_ghost_values();
+   *   field_function.interpolate(solution_2);
+   * @endcode
+   *
+   * All functions except the constructor and get_remote_point_evaluation()
+   * are collective operations that need to be called on all processes of the
+   * communicator of the triangulation. The ghost values of the data vector
+   * need to be up to date whenever the field is evaluated. Points that could
+   * not be found on any process get the value zero; whether a point was
+   * found can be queried with
+   * Utilities::MPI::RemotePointEvaluation::point_found() on the object
+   * returned by get_remote_point_evaluation(). If a point lies on the
+   * boundary between several cells, the average of the values computed on
+   * each of these cells is returned.
+   *
+   * @note This class requires deal.II to be configured with MPI, also when
+   * it is run on a single process.
+   *
+   * @ingroup functions
+   */
+  template <int dim, typename VectorType = Vector<double>, int spacedim = dim>
+  class DistributedFEFieldFunction
+  {
+  public:
+    /**
+     * The scalar type of the data vector.
+     */
+    using number = typename VectorType::value_type;
+
+    /**
+     * Constructor. A smart pointer to the DoFHandler and references to the
+     * data vector and the mapping are stored, so these objects must live
+     * longer than this object. The mapping is used to locate the points in
+     * the cells of @p dof_handler and to evaluate the field there.
+     */
+    DistributedFEFieldFunction(
+      const DoFHandler<dim, spacedim> &dof_handler,
+      const VectorType                &data_vector,
+      const Mapping<dim, spacedim>    &mapping =
+        StaticMappingQ1<dim, spacedim>::mapping);
+
+    /**
+     * Locate the given @p points, which may differ on each process, in the
+     * distributed triangulation. This function has to be called again
+     * whenever the points or the triangulation change.
+     */
+    void
+    reinit(const std::vector<Point<spacedim>> &points);
+
+    /**
+     * Set up the evaluation at the support points of the locally owned
+     * degrees of freedom of @p target_dof_handler, which may be defined on a
+     * different triangulation than the one of this object, as a
+     * preparation for interpolate(). The finite element of
+     * @p target_dof_handler needs to be primitive, have support points, and
+     * have the same number of vector components as the one of this object.
+     * The support points are computed with @p target_mapping.
+     */
+    void
+    reinit(const DoFHandler<dim, spacedim> &target_dof_handler,
+           const Mapping<dim, spacedim>    &target_mapping =
+             StaticMappingQ1<dim, spacedim>::mapping);
+
+    /**
+     * Evaluate all vector components of the field at the points passed to
+     * the last call of reinit() on the current process.
+     */
+    void
+    vector_value_list(std::vector<Vector<number>> &values) const;
+
+    /**
+     * Evaluate the gradients of all vector components of the field at the
+     * points passed to the last call of reinit() on the current process.
+     */
+    void
+    vector_gradient_list(
+      std::vector<std::vector<Tensor<1, spacedim, number>>> &gradients) const;
+
+    /**
+     * Interpolate the field into @p target, which is a vector for the
+     * DoFHandler passed to the last call of reinit(), by evaluating the field
+     * at the support points of the locally owned degrees of freedom of that
+     * DoFHandler.
+     */
+    void
+    interpolate(VectorType &target) const;
+
+    /**
+     * Return the object used to locate the points and to communicate the
+     * results.
+     */
+    const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &
+    get_remote_point_evaluation() const;
+
+  private:
+    /**
+     * Evaluate the field with the flags @p evaluation_flags on all cells in
+     * @p cell_data, one vector component after the other, and pass the
+     * evaluator, the vector component, the index of the point within the
+     * cell, and the index of the point within @p cell_data to
+     * @p process_point.
+     */
+    void
+    evaluate_cells(
+      const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+        CellData                                   &cell_data,
+      const EvaluationFlags::EvaluationFlags        evaluation_flags,
+      const std::function<void(
+        const FEPointEvaluation<1, dim, spacedim, number> &,
+        const unsigned int,
+        const unsigned int,
+        const unsigned int)>                       &process_point) const;
+
+    /**
+     * Pointer to the DoFHandler.
+     */
+    SmartPointer<const DoFHandler<dim, spacedim>,
+                 DistributedFEFieldFunction<dim, VectorType, spacedim>>
+      dof_handler;
+
+    /**
+     * A reference to the data vector.
+     */
+    const VectorType &data_vector;
+
+    /**
+     * A reference to the mapping.
+     */
+    const Mapping<dim, spacedim> &mapping;
+
+    /**
+     * The object storing the cells around the points and the communication
+     * pattern.
+     */
+    Utilities::MPI::RemotePointEvaluation<dim, spacedim>
+      remote_point_evaluation;
+
+    /**
+     * The number of points passed to the last call of reinit().
+     */
+    unsigned int n_points;
+
+    /**
+     * The degrees of freedom of the target DoFHandler passed to reinit(),
+     * one for each point.
+     */
+    std::vector<types::global_dof_index> target_dof_indices;
+
+    /**
+     * The vector components of the degrees of freedom in
+     * target_dof_indices.
+     */
+    std::vector<unsigned int> target_components;
+  };
 } // namespace Functions
 
 
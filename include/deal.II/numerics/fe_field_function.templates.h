@@ -28,6 +28,10 @@
 #include <deal.II/hp/mapping_collection.h>
 #include <deal.II/hp/q_collection.h>
 
+#include <deal.II/lac/vector_element_access.h>
+
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
 #include <deal.II/numerics/fe_field_function.h>
 #include <deal.II/numerics/vector_tools_common.h>
 
@@ -567,6 +571,290 @@ namespace Functions
       }
   }
 
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::
+    DistributedFEFieldFunction(const DoFHandler<dim, spacedim> &dof_handler,
+                               const VectorType                &data_vector,
+                               const Mapping<dim, spacedim>    &mapping)
+    : dof_handler(&dof_handler, "DistributedFEFieldFunction")
+    , data_vector(data_vector)
+    , mapping(mapping)
+    , n_points(0)
+  {}
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  void
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::reinit(
+    const std::vector<Point<spacedim>> &points)
+  {
+    remote_point_evaluation.reinit(points,
+                                   dof_handler->get_triangulation(),
+                                   mapping);
+    n_points = points.size();
+    target_dof_indices.clear();
+    target_components.clear();
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  void
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::reinit(
+    const DoFHandler<dim, spacedim> &target_dof_handler,
+    const Mapping<dim, spacedim>    &target_mapping)
+  {
+    const hp::FECollection<dim, spacedim> &fe_collection =
+      target_dof_handler.get_fe_collection();
+    AssertDimension(fe_collection.n_components(),
+                    dof_handler->get_fe_collection().n_components());
+
+    // Collect the support point of each locally owned degree of freedom
+    // once, on the first cell it is found on
+    const IndexSet &locally_owned_dofs =
+      target_dof_handler.locally_owned_dofs();
+    std::vector<bool> dof_found(locally_owned_dofs.n_elements(), false);
+    std::vector<Point<spacedim>>         points;
+    std::vector<types::global_dof_index> dof_indices;
+    std::vector<unsigned int>            components;
+    std::vector<types::global_dof_index> local_dof_indices;
+    std::vector<std::unique_ptr<FEValues<dim, spacedim>>> fe_values(
+      fe_collection.size());
+    for (const auto &cell : target_dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          const FiniteElement<dim, spacedim> &fe = cell->get_fe();
+          Assert(fe.has_support_points() && fe.is_primitive(),
+                 ExcMessage("The finite element of the target DoFHandler "
+                            "needs to be primitive and have support "
+                            "points."));
+          if (fe_values[cell->active_fe_index()] == nullptr)
+            fe_values[cell->active_fe_index()] =
+              std::make_unique<FEValues<dim, spacedim>>(
+                target_mapping,
+                fe,
+                Quadrature<dim>(fe.get_unit_support_points()),
+                update_quadrature_points);
+          FEValues<dim, spacedim> &cell_fe_values =
+            *fe_values[cell->active_fe_index()];
+          cell_fe_values.reinit(cell);
+
+          local_dof_indices.resize(fe.n_dofs_per_cell());
+          cell->get_dof_indices(local_dof_indices);
+          for (unsigned int i = 0; i < fe.n_dofs_per_cell(); ++i)
+            if (locally_owned_dofs.is_element(local_dof_indices[i]))
+              {
+                const auto index =
+                  locally_owned_dofs.index_within_set(local_dof_indices[i]);
+                if (dof_found[index] == false)
+                  {
+                    dof_found[index] = true;
+                    points.push_back(cell_fe_values.quadrature_point(i));
+                    dof_indices.push_back(local_dof_indices[i]);
+                    components.push_back(
+                      fe.system_to_component_index(i).first);
+                  }
+              }
+        }
+
+    reinit(points);
+    target_dof_indices = std::move(dof_indices);
+    target_components  = std::move(components);
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  void
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::evaluate_cells(
+    const typename Utilities::MPI::RemotePointEvaluation<dim, spacedim>::
+      CellData                            &cell_data,
+    const EvaluationFlags::EvaluationFlags evaluation_flags,
+    const std::function<
+      void(const FEPointEvaluation<1, dim, spacedim, number> &,
+           const unsigned int,
+           const unsigned int,
+           const unsigned int)>               &process_point) const
+  {
+    const hp::FECollection<dim, spacedim> &fe_collection =
+      dof_handler->get_fe_collection();
+    const unsigned int n_components = fe_collection.n_components();
+
+    // One evaluator for each finite element and vector component, created
+    // on first use
+    std::vector<std::vector<
+      std::unique_ptr<FEPointEvaluation<1, dim, spacedim, number>>>>
+      evaluators(fe_collection.size());
+    std::vector<number> solution_values;
+
+    for (const unsigned int i : cell_data.cell_indices())
+      {
+        const auto cell =
+          cell_data.get_active_cell_iterator(i)->as_dof_handler_iterator(
+            *dof_handler);
+        const ArrayView<const Point<dim>> unit_points =
+          cell_data.get_unit_points(i);
+
+        solution_values.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_values(data_vector,
+                             solution_values.begin(),
+                             solution_values.end());
+
+        auto &cell_evaluators = evaluators[cell->active_fe_index()];
+        if (cell_evaluators.empty())
+          for (unsigned int c = 0; c < n_components; ++c)
+            cell_evaluators.push_back(
+              std::make_unique<FEPointEvaluation<1, dim, spacedim, number>>(
+                mapping,
+                cell->get_fe(),
+                (evaluation_flags & EvaluationFlags::gradients) ?
+                  update_gradients :
+                  update_values,
+                c));
+
+        for (unsigned int c = 0; c < n_components; ++c)
+          {
+            FEPointEvaluation<1, dim, spacedim, number> &evaluator =
+              *cell_evaluators[c];
+            evaluator.reinit(cell, unit_points);
+            evaluator.evaluate(solution_values, evaluation_flags);
+            for (unsigned int q = 0; q < unit_points.size(); ++q)
+              process_point(evaluator,
+                            c,
+                            q,
+                            cell_data.reference_point_ptrs[i] + q);
+          }
+      }
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  void
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::vector_value_list(
+    std::vector<Vector<number>> &values) const
+  {
+    Assert(remote_point_evaluation.is_ready(),
+           ExcMessage("You need to call reinit() first."));
+    const unsigned int n_components =
+      dof_handler->get_fe_collection().n_components();
+
+    std::vector<number> results;
+    std::vector<number> buffer;
+    remote_point_evaluation.template evaluate_and_process<number>(
+      results,
+      buffer,
+      [&](const ArrayView<number> &entries, const auto &cell_data) {
+        evaluate_cells(cell_data,
+                       EvaluationFlags::values,
+                       [&](const auto        &evaluator,
+                           const unsigned int component,
+                           const unsigned int q,
+                           const unsigned int entry) {
+                         entries[entry * n_components + component] =
+                           evaluator.get_value(q);
+                       });
+      },
+      n_components);
+
+    // Average over all cells a point was found in
+    const std::vector<unsigned int> &point_ptrs =
+      remote_point_evaluation.get_point_ptrs();
+    values.resize(n_points);
+    for (unsigned int p = 0; p < n_points; ++p)
+      {
+        values[p].reinit(n_components);
+        if (point_ptrs[p + 1] == point_ptrs[p])
+          continue;
+        for (unsigned int e = point_ptrs[p]; e < point_ptrs[p + 1]; ++e)
+          for (unsigned int c = 0; c < n_components; ++c)
+            values[p][c] += results[e * n_components + c];
+        values[p] /= static_cast<number>(point_ptrs[p + 1] - point_ptrs[p]);
+      }
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  void
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::vector_gradient_list(
+    std::vector<std::vector<Tensor<1, spacedim, number>>> &gradients) const
+  {
+    Assert(remote_point_evaluation.is_ready(),
+           ExcMessage("You need to call reinit() first."));
+    const unsigned int n_components =
+      dof_handler->get_fe_collection().n_components();
+
+    std::vector<Tensor<1, spacedim, number>> results;
+    std::vector<Tensor<1, spacedim, number>> buffer;
+    remote_point_evaluation
+      .template evaluate_and_process<Tensor<1, spacedim, number>>(
+        results,
+        buffer,
+        [&](const ArrayView<Tensor<1, spacedim, number>> &entries,
+            const auto                                   &cell_data) {
+          evaluate_cells(cell_data,
+                         EvaluationFlags::gradients,
+                         [&](const auto        &evaluator,
+                             const unsigned int component,
+                             const unsigned int q,
+                             const unsigned int entry) {
+                           entries[entry * n_components + component] =
+                             evaluator.get_gradient(q);
+                         });
+        },
+        n_components);
+
+    // Average over all cells a point was found in
+    const std::vector<unsigned int> &point_ptrs =
+      remote_point_evaluation.get_point_ptrs();
+    gradients.resize(n_points);
+    for (unsigned int p = 0; p < n_points; ++p)
+      {
+        gradients[p].assign(n_components, Tensor<1, spacedim, number>());
+        if (point_ptrs[p + 1] == point_ptrs[p])
+          continue;
+        for (unsigned int e = point_ptrs[p]; e < point_ptrs[p + 1]; ++e)
+          for (unsigned int c = 0; c < n_components; ++c)
+            gradients[p][c] += results[e * n_components + c];
+        for (unsigned int c = 0; c < n_components; ++c)
+          gradients[p][c] /=
+            static_cast<number>(point_ptrs[p + 1] - point_ptrs[p]);
+      }
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  void
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::interpolate(
+    VectorType &target) const
+  {
+    Assert(target_dof_indices.size() == n_points,
+           ExcMessage("You need to call reinit() with the target DoFHandler "
+                      "first."));
+
+    std::vector<Vector<number>> values;
+    vector_value_list(values);
+    for (unsigned int p = 0; p < n_points; ++p)
+      ::dealii::internal::ElementAccess<VectorType>::set(
+        values[p][target_components[p]], target_dof_indices[p], target);
+    target.compress(VectorOperation::insert);
+  }
+
+
+
+  template <int dim, typename VectorType, int spacedim>
+  const Utilities::MPI::RemotePointEvaluation<dim, spacedim> &
+  DistributedFEFieldFunction<dim, VectorType, spacedim>::
+    get_remote_point_evaluation() const
+  {
+    return remote_point_evaluation;
+  }
 } // namespace Functions
 
 DEAL_II_NAMESPACE_CLOSE
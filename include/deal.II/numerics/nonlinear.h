@@ -16,12 +16,17 @@
 
 #include <deal.II/base/exceptions.h>
 
+#include <deal.II/lac/linear_operator.h>
 #include <deal.II/lac/petsc_snes.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
 
 #include <deal.II/sundials/kinsol.h>
 
 #include <deal.II/trilinos/nox.h>
 
+#include <cmath>
+#include <limits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -33,7 +38,8 @@ DEAL_II_NAMESPACE_OPEN
  * NOX is part of Trilinos and SNES is part of PETSc, respectively.
  * If no solver is manually specified, this class will automaticlaly
  * choose one of the available solvers depending on the enabled
- * dependencies.
+ * dependencies. If none of these packages is available, the inexact
+ * Newton-Krylov solver implemented in this class is used, see below.
  *
  * By calling the @p solve function of this @p
  * NonlinearSolverSelector, it selects the @p solve function of that
@@ -70,6 +76,40 @@ DEAL_II_NAMESPACE_OPEN
  * // Calling the @p solve function with an initial guess.
  * nonlinear_solver.solve(current_solution);
  * @endcode
+ *
+ * <h3>The built-in Newton-Krylov solver</h3>
+ * The solver type AdditionalData::SolverType::newton_krylov does not rely
+ * on any external package and works with every vector type. It is an
+ * inexact Newton method: in the $k$th iteration, the linear system
+ * $J(u_k) \delta u_k = -F(u_k)$ is only solved up to the tolerance
+ * $\eta_k \|F(u_k)\|$, where the forcing term $\eta_k$ is chosen with the
+ * second strategy of Eisenstat and Walker,
+ * @f[
+ *   \eta_k = \min\left(\eta_\text{max},
+ *     \left(\frac{\|F(u_k)\|}{\|F(u_{k-1})\|}\right)^{(1+\sqrt{5})/2}
+ *   \right),
+ * @f]
+ * together with the usual safeguards. Far away from the solution, the
+ * linear systems are thus solved only coarsely, whereas the fast local
+ * convergence of Newton's method is retained close to the solution.
+ *
+ * Since the assembly of the Jacobian is often the most expensive part of a
+ * Newton step, setup_jacobian() is only called every
+ * AdditionalData::jacobian_update_frequency iterations, and
+ * solve_with_jacobian() is then used with an outdated Jacobian. If
+ * AdditionalData::matrix_free_jacobian is set, the action of the exact
+ * Jacobian on a vector is instead approximated by a finite difference of
+ * the residual,
+ * @f[
+ *   J(u) v \approx \frac{F(u + h v) - F(u)}{h},
+ * @f]
+ * and the linear systems are solved with SolverFGMRES, using
+ * solve_with_jacobian() (with a possibly outdated Jacobian) as
+ * preconditioner if it is provided. In this case, no matrix needs to be
+ * assembled at all, and the residual can be evaluated with a matrix-free
+ * operator such as the ones based on the MatrixFree class. The
+ * preconditioner can then be built from a cheaper, e.g. linearized or
+ * lower order, operator in setup_jacobian().
  */
 template <typename VectorType = Vector<double>>
 class NonlinearSolverSelector
@@ -123,7 +163,12 @@ public:
       /*
        * Use the PETSc SNES solver.
        */
-      petsc_snes
+      petsc_snes,
+      /**
+       * Use the inexact Newton-Krylov solver implemented in this class,
+       * which is always available.
+       */
+      newton_krylov
     };
 
     /**
@@ -151,7 +196,8 @@ public:
     /**
      * The type of nonlinear solver to use. If the default 'automatic' is used,
      * it will choose the first available package in the order KINSOL, NOX, or
-     * SNES.
+     * SNES, and the built-in Newton-Krylov solver if none of them is
+     * available.
      */
     SolverType solver_type;
 
@@ -199,6 +245,39 @@ public:
      * If you set this to 0, no acceleration is used.
      */
     unsigned int anderson_subspace_size;
+
+    /**
+     * The largest forcing term $\eta_\text{max}$ used by the Newton-Krylov
+     * solver, i.e., the largest relative tolerance with which the linear
+     * systems are solved. Only used with SolverType::newton_krylov.
+     */
+    double maximum_forcing_term = 0.9;
+
+    /**
+     * The number of nonlinear iterations after which setup_jacobian() is
+     * called again by the Newton-Krylov solver. The default of one updates
+     * the Jacobian in every iteration. For SolutionStrategy::picard, the
+     * Jacobian is only set up once. Only used with
+     * SolverType::newton_krylov.
+     */
+    unsigned int jacobian_update_frequency = 1;
+
+    /**
+     * Whether the Newton-Krylov solver approximates the action of the
+     * Jacobian by finite differences of the residual and solves the linear
+     * systems with SolverFGMRES, using solve_with_jacobian() as
+     * preconditioner if it is provided. Only used with
+     * SolverType::newton_krylov.
+     */
+    bool matrix_free_jacobian = false;
+
+    /**
+     * The maximum number of iterations of SolverFGMRES per nonlinear
+     * iteration if matrix_free_jacobian is set. If the forcing term is not
+     * reached within these iterations, the Newton-Krylov solver continues
+     * with the approximate update.
+     */
+    unsigned int maximum_linear_iterations = 100;
   };
 
   /**
@@ -395,6 +474,12 @@ private:
    */
   void
   solve_with_petsc(VectorType &initial_guess_and_solution);
+
+  /**
+   * Solve with the built-in inexact Newton-Krylov solver.
+   */
+  void
+  solve_with_newton_krylov(VectorType &initial_guess_and_solution);
 };
 
 
@@ -604,6 +689,161 @@ NonlinearSolverSelector<PETScWrappers::MPI::Vector>::solve_with_petsc(
 
 
 
+template <typename VectorType>
+void
+NonlinearSolverSelector<VectorType>::solve_with_newton_krylov(
+  VectorType &initial_guess_and_solution)
+{
+  AssertThrow(residual, ExcMessage("The residual function must be set."));
+  AssertThrow(additional_data.matrix_free_jacobian || solve_with_jacobian,
+              ExcMessage("The Newton-Krylov solver needs either "
+                         "solve_with_jacobian() or a matrix-free Jacobian."));
+  AssertThrow(additional_data.jacobian_update_frequency > 0,
+              ExcMessage("The Jacobian update frequency must be positive."));
+
+  VectorType &u = initial_guess_and_solution;
+
+  const auto reinit = [&](VectorType &v) {
+    if (reinit_vector)
+      reinit_vector(v);
+    else
+      v.reinit(u);
+  };
+
+  VectorType f, f_trial, u_trial, update;
+  reinit(f);
+  reinit(f_trial);
+  reinit(u_trial);
+  reinit(update);
+
+  residual(u, f);
+  double       f_norm    = f.l2_norm();
+  const double tolerance =
+    std::max(additional_data.function_tolerance,
+             additional_data.relative_tolerance * f_norm);
+
+  const bool is_picard =
+    additional_data.strategy == AdditionalData::SolutionStrategy::picard;
+  const bool use_matrix_free_jacobian =
+    additional_data.matrix_free_jacobian && !is_picard;
+
+  // Parameters of the second choice of the forcing term by Eisenstat and
+  // Walker, and the threshold below which the safeguard is not applied
+  const double alpha           = 0.5 * (1. + std::sqrt(5.));
+  const double eta_max         = additional_data.maximum_forcing_term;
+  const double eta_safeguarded = 0.1;
+  double       eta             = std::min(0.5, eta_max);
+
+  // Vector used in the finite-difference approximation of the Jacobian
+  VectorType u_perturbed;
+  if (use_matrix_free_jacobian)
+    reinit(u_perturbed);
+
+  LinearOperator<VectorType> jacobian;
+  jacobian.reinit_range_vector  = [&](VectorType &v, const bool) { reinit(v); };
+  jacobian.reinit_domain_vector = jacobian.reinit_range_vector;
+  jacobian.vmult = [&](VectorType &dst, const VectorType &src) {
+    const double src_norm = src.l2_norm();
+    if (src_norm == 0.)
+      {
+        dst = 0.;
+        return;
+      }
+    const double h = std::sqrt(std::numeric_limits<double>::epsilon()) *
+                     (1. + u.l2_norm()) / src_norm;
+    u_perturbed = u;
+    u_perturbed.add(h, src);
+    residual(u_perturbed, dst);
+    dst.add(-1., f);
+    dst /= h;
+  };
+
+  LinearOperator<VectorType> preconditioner;
+  preconditioner.reinit_range_vector  = jacobian.reinit_range_vector;
+  preconditioner.reinit_domain_vector = jacobian.reinit_range_vector;
+  preconditioner.vmult = [&](VectorType &dst, const VectorType &src) {
+    if (solve_with_jacobian)
+      solve_with_jacobian(src, dst, eta * src.l2_norm());
+    else
+      dst = src;
+  };
+
+  unsigned int iteration = 0;
+  while (f_norm > tolerance)
+    {
+      AssertThrow(iteration < additional_data.maximum_non_linear_iterations,
+                  SolverControl::NoConvergence(iteration, f_norm));
+
+      if (setup_jacobian &&
+          (iteration == 0 ||
+           (!is_picard &&
+            iteration % additional_data.jacobian_update_frequency == 0)))
+        setup_jacobian(u);
+
+      // Solve J update = F(u) inexactly. If the forcing term cannot be
+      // reached by FGMRES, continue with the approximate update as long as
+      // it is a descent direction, which is checked by the line search.
+      update = 0.;
+      if (use_matrix_free_jacobian)
+        {
+          SolverControl solver_control(
+            additional_data.maximum_linear_iterations,
+            eta * f_norm,
+            false,
+            false);
+          SolverFGMRES<VectorType> solver(solver_control);
+          try
+            {
+              solver.solve(jacobian, update, f, preconditioner);
+            }
+          catch (const SolverControl::NoConvergence &)
+            {}
+        }
+      else
+        solve_with_jacobian(f, update, eta * f_norm);
+
+      // Apply the update, with a backtracking line search that enforces a
+      // sufficient decrease of the residual norm if requested
+      double step = 1.;
+      u_trial     = u;
+      u_trial.add(-step, update);
+      residual(u_trial, f_trial);
+      double f_trial_norm = f_trial.l2_norm();
+      if (additional_data.strategy ==
+          AdditionalData::SolutionStrategy::linesearch)
+        for (unsigned int i = 0;
+             i < 20 && !(f_trial_norm <= (1. - 1e-4 * step) * f_norm);
+             ++i)
+          {
+            step *= 0.5;
+            u_trial = u;
+            u_trial.add(-step, update);
+            residual(u_trial, f_trial);
+            f_trial_norm = f_trial.l2_norm();
+          }
+
+      u.swap(u_trial);
+      f.swap(f_trial);
+      ++iteration;
+
+      // Choose the next forcing term, but avoid oversolving in the last
+      // iteration by not asking for more than the nonlinear tolerance
+      const double eta_previous = eta;
+      eta = std::min(eta_max, std::pow(f_trial_norm / f_norm, alpha));
+      if (std::pow(eta_previous, alpha) > eta_safeguarded)
+        eta = std::min(eta_max, std::max(eta, std::pow(eta_previous, alpha)));
+      if (f_trial_norm > 0.)
+        eta = std::min(eta_max, std::max(eta, 0.5 * tolerance / f_trial_norm));
+      f_norm = f_trial_norm;
+
+      if (additional_data.step_tolerance > 0. &&
+          step * update.l2_norm() <= additional_data.step_tolerance)
+        break;
+    }
+}
+
+
+
 template <typename VectorType>
 void
 NonlinearSolverSelector<VectorType>::solve(
@@ -623,9 +863,11 @@ NonlinearSolverSelector<VectorType>::solve(
       additional_data.solver_type = AdditionalData::SolverType::kinsol;
 #endif
 
-      // If "auto" is still the solver type we cannot solve the problem
+      // If "auto" is still the solver type, none of the external packages
+      // is available and we fall back to our own Newton-Krylov solver
       if (additional_data.solver_type == AdditionalData::SolverType::automatic)
-        AssertThrow(false, ExcMessage("No valid solver type."));
+        additional_data.solver_type =
+          AdditionalData::SolverType::newton_krylov;
     }
 
   if (additional_data.solver_type == AdditionalData::SolverType::kinsol)
@@ -681,9 +923,15 @@ NonlinearSolverSelector<VectorType>::solve(
       // non-supported vector types:
       solve_with_petsc(initial_guess_and_solution);
     }
+  else if (additional_data.solver_type ==
+           AdditionalData::SolverType::newton_krylov)
+    {
+      solve_with_newton_krylov(initial_guess_and_solution);
+    }
   else
     {
       const std::string solvers =
+        "newton_krylov\n"
 #ifdef DEAL_II_WITH_SUNDIALS
         "kinsol\n"
 #endif
@@ -19,6 +19,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi_remote_point_evaluation.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/smartpointer.h>
@@ -377,10 +378,17 @@ public:
    * Extract values at the points actually requested from the VectorType
    * supplied and add them to the new dataset in vector_name. Unlike the other
    * evaluate_field methods this method does not care if the dof_handler has
-   * been modified because it uses calls to @p VectorTools::point_value to
-   * extract there data. Therefore, if only this method is used, the class is
-   * fully compatible with adaptive refinement. The component_mask supplied
-   * when the field was added is used to select components to extract. If a @p
+   * been modified: the cells around the requested points are located the
+   * first time this method is called after the triangulation has changed, and
+   * all points within one cell are then evaluated together with a single
+   * FEValues object. Therefore, if only this method is used, the class is
+   * fully compatible with adaptive refinement. If the triangulation is
+   * distributed among several processes, the points are located and evaluated
+   * with Utilities::MPI::RemotePointEvaluation on the processes owning the
+   * cells around them, and every process stores the values of all points. In
+   * that case, this is a collective operation, and the ghost values of @p
+   * solution have to be up to date. The component_mask supplied when the
+   * field was added is used to select components to extract. If a @p
    * DoFHandler is used, one (and only one) evaluate_field method must be
    * called for each dataset (time step, iteration, etc) for each vector_name,
    * otherwise a @p ExcDataLostSync error can occur.
@@ -655,6 +663,45 @@ private:
    */
   boost::signals2::connection tria_listener;
 
+  /**
+   * The locally owned cells around the requested locations, used by
+   * evaluate_field_at_requested_location(). The reference coordinates and
+   * the indices of the points in the cell
+   * <tt>evaluation_cells[i]</tt> are the entries
+   * <tt>evaluation_point_ptrs[i]</tt> to
+   * <tt>evaluation_point_ptrs[i+1]</tt> of evaluation_unit_points and
+   * evaluation_point_indices. These arrays are filled when they are first
+   * needed and cleared whenever the triangulation changes.
+   */
+  std::vector<typename DoFHandler<dim>::active_cell_iterator> evaluation_cells;
+
+  /**
+   * Offsets into evaluation_unit_points and evaluation_point_indices for
+   * each of the evaluation_cells.
+   */
+  std::vector<unsigned int> evaluation_point_ptrs;
+
+  /**
+   * The requested locations in the coordinate system of the reference cell,
+   * sorted by the cells they are in.
+   */
+  std::vector<Point<dim>> evaluation_unit_points;
+
+  /**
+   * The indices into point_geometry_data of the points in
+   * evaluation_unit_points.
+   */
+  std::vector<unsigned int> evaluation_point_indices;
+
+  /**
+   * The object used by evaluate_field_at_requested_location() to locate and
+   * evaluate the requested locations if the triangulation is distributed
+   * among more than one process. This object is reset whenever the
+   * triangulation changes.
+   */
+  std::shared_ptr<Utilities::MPI::RemotePointEvaluation<dim>>
+    remote_point_evaluation;
+
   /**
    * Stores the number of independent variables requested.
    */
@@ -64,6 +64,11 @@ namespace hp
  * singular, has kinks in some derivative, or is otherwise not particularly
  * smooth. All of these strategies rely on a way to identify how "smooth" a
  * function is on a given cell.
+ *
+ * The functions in this namespace process the cells in parallel using
+ * multiple threads. The FESeries objects they are given compute their
+ * transformation matrices on first use and keep them, so it pays off to
+ * create these objects once and reuse them over all refinement cycles.
  */
 namespace SmoothnessEstimator
 {
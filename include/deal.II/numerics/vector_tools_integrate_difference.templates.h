@@ -17,6 +17,8 @@
 #define dealii_vector_tools_integrate_difference_templates_h
 
 
+#include <deal.II/base/work_stream.h>
+
 #include <deal.II/hp/fe_values.h>
 
 #include <deal.II/lac/block_vector.h>
@@ -511,37 +513,61 @@ namespace VectorTools
                                                 q,
                                                 update_flags);
 
-      // loop over all cells
-      for (const auto &cell : dof.active_cell_iterators())
-        if (cell->is_locally_owned())
-          {
-            // initialize for this cell
-            data.x_fe_values.reinit(cell);
-
-            const dealii::FEValues<dim, spacedim> &fe_values =
-              data.x_fe_values.get_present_fe_values();
-            const unsigned int n_q_points = fe_values.n_quadrature_points;
-            data.resize_vectors(n_q_points, n_components);
-
-            if (update_flags & update_values)
-              fe_values.get_function_values(fe_function, data.function_values);
-            if (update_flags & update_gradients)
-              fe_values.get_function_gradients(fe_function,
-                                               data.function_grads);
-
-            difference(cell->active_cell_index()) =
-              integrate_difference_inner<dim, spacedim, Number>(exact_solution,
-                                                                norm,
-                                                                weight,
-                                                                update_flags,
-                                                                exponent,
-                                                                n_components,
-                                                                data);
-          }
-        else
-          // the cell is a ghost cell or is artificial. write a zero into the
-          // corresponding value of the returned vector
-          difference(cell->active_cell_index()) = 0;
+      // loop over all cells. the cells are independent of each other, so
+      // the work is distributed to several threads; the copier only writes
+      // the result of each cell into the output vector
+      using CellIterator =
+        typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+      const auto worker =
+        [&](const CellIterator                   &cell,
+            IDScratchData<dim, spacedim, Number> &data,
+            std::pair<unsigned int, double>      &cell_result) {
+          cell_result.first = cell->active_cell_index();
+
+          if (cell->is_locally_owned())
+            {
+              // initialize for this cell
+              data.x_fe_values.reinit(cell);
+
+              const dealii::FEValues<dim, spacedim> &fe_values =
+                data.x_fe_values.get_present_fe_values();
+              const unsigned int n_q_points = fe_values.n_quadrature_points;
+              data.resize_vectors(n_q_points, n_components);
+
+              if (update_flags & update_values)
+                fe_values.get_function_values(fe_function,
+                                              data.function_values);
+              if (update_flags & update_gradients)
+                fe_values.get_function_gradients(fe_function,
+                                                 data.function_grads);
+
+              cell_result.second =
+                integrate_difference_inner<dim, spacedim, Number>(
+                  exact_solution,
+                  norm,
+                  weight,
+                  update_flags,
+                  exponent,
+                  n_components,
+                  data);
+            }
+          else
+            // the cell is a ghost cell or is artificial. write a zero into the
+            // corresponding value of the returned vector
+            cell_result.second = 0;
+        };
+
+      const auto copier = [&](const std::pair<unsigned int, double> &result) {
+        difference(result.first) = result.second;
+      };
+
+      WorkStream::run(dof.begin_active(),
+                      CellIterator(dof.end()),
+                      worker,
+                      copier,
+                      data,
+                      std::pair<unsigned int, double>());
     }
 
   } // namespace internal
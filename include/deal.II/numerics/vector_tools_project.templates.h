@@ -183,6 +183,65 @@ namespace VectorTools
       AssertDimension(dof.get_fe(0).n_components(), function.n_components);
       AssertDimension(dof.get_fe(0).n_components(), components);
 
+      // For discontinuous tensor-product elements, the mass matrix is block
+      // diagonal and each block can be inverted by sum factorization if the
+      // integrals are computed with a Gauss formula on degree+1 points per
+      // direction. In that case, compute the projection cell by cell from
+      // the function values in the quadrature points, which avoids the
+      // right hand side assembly and the iterative solver.
+      const FiniteElement<dim, spacedim> &fe = dof.get_fe(0);
+      if (fe.reference_cell() == ReferenceCells::get_hypercube<dim>() &&
+          fe.n_dofs_per_face(0) == 0 &&
+          fe.n_dofs_per_cell() ==
+            components * Utilities::pow(fe.degree + 1, dim) &&
+          constraints.n_constraints() == 0 &&
+          quadrature == QGauss<dim>(fe.degree + 1))
+        {
+          typename MatrixFree<dim, Number>::AdditionalData additional_data;
+          additional_data.tasks_parallel_scheme =
+            MatrixFree<dim, Number>::AdditionalData::none;
+          additional_data.mapping_update_flags = update_quadrature_points;
+          MatrixFree<dim, Number> matrix_free;
+          matrix_free.reinit(mapping,
+                             dof,
+                             constraints,
+                             QGauss<dim>(fe.degree + 1),
+                             additional_data);
+          matrix_free.initialize_dof_vector(work_result);
+
+          FEEvaluation<dim, -1, 0, components, Number> phi(matrix_free);
+          MatrixFreeOperators::
+            CellwiseInverseMassMatrix<dim, -1, components, Number>
+              inverse_mass(phi);
+          AlignedVector<VectorizedArray<Number>> values(phi.n_q_points *
+                                                        components);
+          for (unsigned int cell = 0; cell < matrix_free.n_cell_batches();
+               ++cell)
+            {
+              phi.reinit(cell);
+              for (unsigned int q = 0; q < phi.n_q_points; ++q)
+                {
+                  const Point<dim, VectorizedArray<Number>> point_batch =
+                    phi.quadrature_point(q);
+                  for (unsigned int v = 0;
+                       v < matrix_free.n_active_entries_per_cell_batch(cell);
+                       ++v)
+                    {
+                      Point<spacedim> point;
+                      for (unsigned int d = 0; d < dim; ++d)
+                        point[d] = point_batch[d][v];
+                      for (unsigned int c = 0; c < components; ++c)
+                        values[c * phi.n_q_points + q][v] =
+                          function.value(point, c);
+                    }
+                }
+              inverse_mass.transform_from_q_points_to_basis(
+                components, values.data(), phi.begin_dof_values());
+              phi.set_dof_values_plain(work_result);
+            }
+          return;
+        }
+
       Quadrature<dim> quadrature_mf;
 
       if (dof.get_fe(0).reference_cell() ==
@@ -20,6 +20,8 @@
 
 #ifdef DEAL_II_WITH_OPENCASCADE
 
+#  include <deal.II/base/mutex.h>
+
 #  include <deal.II/grid/manifold.h>
 
 #  include <deal.II/opencascade/utilities.h>
@@ -33,6 +35,9 @@
 #  include <BRepAdaptor_Curve.hxx>
 #  undef HAVE_CONFIG_H
 
+#  include <map>
+#  include <vector>
+
 DEAL_II_NAMESPACE_OPEN
 
 /**
@@ -42,6 +47,69 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace OpenCASCADE
 {
+  namespace internal
+  {
+    /**
+     * A thread-safe cache of the results of projections onto a CAD shape,
+     * keyed by the coordinates of the points that define the projection.
+     * Queries to the CAD kernel are very expensive, and the same projections
+     * are typically requested many times: by the refinement of the
+     * triangulation, by MappingQ or MappingQCache when computing the support
+     * points of the cells, and by GridOut. Since the shapes of the manifolds
+     * below never change, the results can be kept for the lifetime of the
+     * manifold. To bound the memory consumption, the cache is emptied
+     * whenever it holds more than a fixed number of entries.
+     */
+    template <int spacedim>
+    class ProjectionCache
+    {
+    public:
+      /**
+       * Return the result for the given @p key. If there is none in the
+       * cache, it is computed by calling @p compute, without holding a lock,
+       * so that several threads can query the CAD kernel concurrently.
+       */
+      template <typename ComputeFunction>
+      Point<spacedim>
+      get_or_compute(const std::vector<double> &key,
+                     const ComputeFunction     &compute) const
+      {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          const auto                  it = cache.find(key);
+          if (it != cache.end())
+            return it->second;
+        }
+
+        const Point<spacedim> result = compute();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (cache.size() >= max_n_entries)
+          cache.clear();
+        cache.emplace(key, result);
+        return result;
+      }
+
+    private:
+      /**
+       * The number of entries at which the cache is emptied.
+       */
+      static constexpr std::size_t max_n_entries = 1000000;
+
+      /**
+       * The cached results.
+       */
+      mutable std::map<std::vector<double>, Point<spacedim>> cache;
+
+      /**
+       * A mutex guarding the cache.
+       */
+      mutable Threads::Mutex mutex;
+    };
+  } // namespace internal
+
+
+
   /**
    * A Manifold object based on OpenCASCADE TopoDS_Shape where new points are
    * first computed by averaging the surrounding points in the same way as
@@ -89,6 +157,11 @@ namespace OpenCASCADE
      *
      * The projected point is computed using OpenCASCADE normal projection
      * algorithms.
+     *
+     * The projected points are cached, so that projecting the same point
+     * again, e.g., when the support points of a MappingQ are computed after
+     * refinement, does not query the CAD kernel again. This function can be
+     * called concurrently from several threads.
      */
     virtual Point<spacedim>
     project_to_manifold(
@@ -109,6 +182,12 @@ namespace OpenCASCADE
      * Relative tolerance used by this class to compute distances.
      */
     const double tolerance;
+
+  private:
+    /**
+     * A cache of the points computed by project_to_manifold().
+     */
+    internal::ProjectionCache<spacedim> projection_cache;
   };
 
   /**
@@ -156,6 +235,11 @@ namespace OpenCASCADE
      *
      * The projected point is computed using OpenCASCADE directional
      * projection algorithms.
+     *
+     * The projected points are cached, so that projecting the same point
+     * again, e.g., when the support points of a MappingQ are computed after
+     * refinement, does not query the CAD kernel again. This function can be
+     * called concurrently from several threads.
      */
     virtual Point<spacedim>
     project_to_manifold(
@@ -180,6 +264,12 @@ namespace OpenCASCADE
      * Relative tolerance used by this class to compute distances.
      */
     const double tolerance;
+
+  private:
+    /**
+     * A cache of the points computed by project_to_manifold().
+     */
+    internal::ProjectionCache<spacedim> projection_cache;
   };
 
 
@@ -248,6 +338,11 @@ namespace OpenCASCADE
      * debug mode, checks that each of the @p surrounding_points is within
      * tolerance from the given TopoDS_Shape. If this is not the case, an
      * exception is thrown.
+     *
+     * The projected points are cached, so that projecting the same point
+     * again, e.g., when the support points of a MappingQ are computed after
+     * refinement, does not query the CAD kernel again. This function can be
+     * called concurrently from several threads.
      */
     virtual Point<spacedim>
     project_to_manifold(
@@ -267,6 +362,12 @@ namespace OpenCASCADE
      * Relative tolerance used by this class to compute distances.
      */
     const double tolerance;
+
+  private:
+    /**
+     * A cache of the points computed by project_to_manifold().
+     */
+    internal::ProjectionCache<spacedim> projection_cache;
   };
 
   /**
@@ -17,6 +17,7 @@
 #include <deal.II/base/config.h>
 
 #include <deal.II/base/data_out_base.h>
+#include <deal.II/base/mpi_stub.h>
 
 #include <deal.II/numerics/data_component_interpretation.h>
 
@@ -78,6 +79,55 @@ namespace Particles
                     DataComponentInterpretation::DataComponentInterpretation>
                     &data_component_interpretations = {});
 
+    /**
+     * Write the locations, ids, and properties of the locally owned particles
+     * of all processes in @p comm into the single HDF5 file @p filename,
+     * using the VTKHDF format for unstructured grids in which every particle
+     * is a vertex cell. Files in this format can be opened directly in
+     * ParaView.
+     *
+     * Unlike calling build_patches() followed by one of the functions of the
+     * base class, this function does not build any patches: it reads the
+     * particle data directly from the PropertyPool of @p particles and
+     * writes one dataset after the other, so that the only additional memory
+     * it needs is a buffer for a single dataset. It works with either
+     * PropertyPool::PropertyLayout, but gathering the values of a property
+     * is cheaper in PropertyPool::PropertyLayout::property_major layout. If
+     * deal.II is configured with MPI and a parallel HDF5 library, all
+     * processes write into the file collectively at the offsets given by the
+     * number of particles written by the processes of lower rank.
+     *
+     * @param [in] particles The particle handler whose particles are written.
+     * @param [in] filename The name of the file, typically with the extension
+     * <tt>.vtkhdf</tt>.
+     * @param [in] comm The communicator of the processes that write into the
+     * file. This function has to be called on all of its processes.
+     * @param [in] data_component_names An optional vector of strings that
+     * describe the properties of each particle, with the same meaning as in
+     * build_patches(). Particle properties will only be written if this
+     * vector is provided. The names of the written datasets have to be
+     * unique.
+     * @param [in] data_component_interpretations An optional vector that
+     * controls if the particle properties are interpreted as scalars,
+     * vectors, or tensors. Vectors and tensors are written as datasets with
+     * three and nine components, respectively, padded with zeros if
+     * <tt>spacedim</tt> is less than three.
+     * @param [in] subsampling_stride Only write every
+     * <tt>subsampling_stride</tt>-th of the locally owned particles of each
+     * process, in the order in which the particle handler iterates over
+     * them. This allows to write a representative subset of very large
+     * particle sets.
+     */
+    void
+    write_vtkhdf(const Particles::ParticleHandler<dim, spacedim> &particles,
+                 const std::string                               &filename,
+                 const MPI_Comm                                   comm,
+                 const std::vector<std::string> &data_component_names = {},
+                 const std::vector<
+                   DataComponentInterpretation::DataComponentInterpretation>
+                   &data_component_interpretations = {},
+                 const unsigned int subsampling_stride = 1) const;
+
   protected:
     /**
      * Returns the patches built by the data_out class which was previously
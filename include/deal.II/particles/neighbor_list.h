@@ -0,0 +1,286 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_neighbor_list_h
+#define dealii_particles_neighbor_list_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/point.h>
+#include <deal.II/base/smartpointer.h>
+
+#include <deal.II/grid/grid_tools_cache.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <utility>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  /**
+   * A list of all pairs of particles whose distance is smaller than a given
+   * cutoff radius, as needed for short-range particle-particle interactions
+   * in methods like the discrete element method (DEM) or smoothed particle
+   * hydrodynamics (SPH).
+   *
+   * The list is built with the mesh as a cell-linked list: the partners of
+   * a particle are only searched among the particles of its own cell and of
+   * the cells that share a vertex with it. This requires the cutoff radius
+   * (plus the skin, see below) not to exceed the size of the cells. The
+   * particles of ghost cells are included, so that interactions across the
+   * boundary of the locally owned domain are found if the ghost particles
+   * have been exchanged by ParticleHandler::exchange_ghost_particles() before
+   * calling reinit(). Each pair is listed once; a pair of a locally owned
+   * and a ghost particle is listed on both processes.
+   *
+   * The particles are numbered consecutively in the order of the cells, and
+   * the pairs are stored as two arrays of such indices, along with an array
+   * of the locations of all particles. This layout allows loops over the
+   * pairs to gather the data of several pairs at once, e.g., into
+   * VectorizedArray objects:
+   * @code
+   * NeighborList<dim> neighbor_list;
+   * neighbor_list.reinit(cache, particle_handler, cutoff_radius);
+   * const auto &locations = neighbor_list.get_locations();
+   * for (unsigned int p = 0; p < neighbor_list.n_pairs(); ++p)
+   *   {
+   *     const unsigned int i = neighbor_list.get_first_indices()[p];
+   *     const unsigned int j = neighbor_list.get_second_indices()[p];
+   *     const Tensor<1, dim> r = locations[j] - locations[i];
+   *     ... compute the interaction of neighbor_list.get_particle(i) and
+   *         neighbor_list.get_particle(j) ...
+   *   }
+   * @endcode
+   *
+   * <h3>Incremental updates</h3>
+   *
+   * If the particles move by small distances between time steps, the list
+   * can be updated without searching the cells again: reinit() collects all
+   * pairs closer than the cutoff radius plus a @p skin as candidates, and
+   * update() merely selects the candidates that are closer than the cutoff
+   * radius at the current locations of the particles. The result is exact as
+   * long as no particle has moved by more than half the skin since the last
+   * call to reinit(), which update() checks and reports in its return value.
+   *
+   * The list stores iterators to the particles. Hence, reinit() needs to be
+   * called again after particles have been inserted or removed, after
+   * ParticleHandler::sort_particles_into_subdomains_and_cells(), and after
+   * ParticleHandler::exchange_ghost_particles(). Updating the ghost
+   * particles with ParticleHandler::update_ghost_particles() keeps the list
+   * valid.
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim = dim>
+  class NeighborList
+  {
+  public:
+    /**
+     * A type that can be used to iterate over all particles in the domain.
+     */
+    using particle_iterator = ParticleIterator<dim, spacedim>;
+
+    /**
+     * Default constructor. Call reinit() before using the object.
+     */
+    NeighborList();
+
+    /**
+     * Build the list of pairs of particles of @p particle_handler whose
+     * distance is smaller than @p cutoff_radius. Pairs closer than
+     * @p cutoff_radius plus @p skin are stored as candidates for update().
+     * The connectivity of the cells is taken from @p cache, which must
+     * describe the triangulation of @p particle_handler.
+     */
+    void
+    reinit(const GridTools::Cache<dim, spacedim> &cache,
+           const ParticleHandler<dim, spacedim>  &particle_handler,
+           const double                           cutoff_radius,
+           const double                           skin = 0.);
+
+    /**
+     * Re-read the locations of the particles and select the pairs whose
+     * distance is smaller than the cutoff radius among the candidates found
+     * by the last call to reinit(). Return whether the result is exact,
+     * i.e., whether all particles have moved by at most half the skin since
+     * the last call to reinit(). If not, the caller needs to call reinit(),
+     * possibly after sorting the particles into their new cells.
+     */
+    bool
+    update();
+
+    /**
+     * Return the number of particles in the list, including ghost particles.
+     */
+    unsigned int
+    n_particles() const;
+
+    /**
+     * Return the particle with index @p index in the numbering used by this
+     * class.
+     */
+    const particle_iterator &
+    get_particle(const unsigned int index) const;
+
+    /**
+     * Return the locations of all particles, as read during the last call to
+     * reinit() or update().
+     */
+    const std::vector<Point<spacedim>> &
+    get_locations() const;
+
+    /**
+     * Return the number of pairs of particles closer than the cutoff radius.
+     */
+    unsigned int
+    n_pairs() const;
+
+    /**
+     * Return the index of the first particle of each pair. The first
+     * particle of a pair is always locally owned.
+     */
+    const std::vector<unsigned int> &
+    get_first_indices() const;
+
+    /**
+     * Return the index of the second particle of each pair.
+     */
+    const std::vector<unsigned int> &
+    get_second_indices() const;
+
+  private:
+    /**
+     * Select the pairs closer than the cutoff radius among the candidates.
+     */
+    void
+    select_pairs();
+
+    /**
+     * The particle handler the list was built for.
+     */
+    SmartPointer<const ParticleHandler<dim, spacedim>,
+                 NeighborList<dim, spacedim>>
+      particle_handler;
+
+    /**
+     * The cutoff radius.
+     */
+    double cutoff_radius;
+
+    /**
+     * The additional distance up to which candidates are collected.
+     */
+    double skin;
+
+    /**
+     * The particles, numbered cell by cell.
+     */
+    std::vector<particle_iterator> particles;
+
+    /**
+     * The current locations of the particles.
+     */
+    std::vector<Point<spacedim>> locations;
+
+    /**
+     * The locations of the particles at the time the candidates were
+     * collected.
+     */
+    std::vector<Point<spacedim>> locations_at_reinit;
+
+    /**
+     * The indices of the candidate pairs.
+     */
+    std::vector<unsigned int> candidate_first;
+
+    /**
+     * See candidate_first.
+     */
+    std::vector<unsigned int> candidate_second;
+
+    /**
+     * The indices of the pairs closer than the cutoff radius.
+     */
+    std::vector<unsigned int> pair_first;
+
+    /**
+     * See pair_first.
+     */
+    std::vector<unsigned int> pair_second;
+  };
+
+
+
+  /* ---------------------- inline functions --------------------------- */
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  NeighborList<dim, spacedim>::n_particles() const
+  {
+    return particles.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const typename NeighborList<dim, spacedim>::particle_iterator &
+  NeighborList<dim, spacedim>::get_particle(const unsigned int index) const
+  {
+    AssertIndexRange(index, particles.size());
+    return particles[index];
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const std::vector<Point<spacedim>> &
+  NeighborList<dim, spacedim>::get_locations() const
+  {
+    return locations;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  NeighborList<dim, spacedim>::n_pairs() const
+  {
+    return pair_first.size();
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const std::vector<unsigned int> &
+  NeighborList<dim, spacedim>::get_first_indices() const
+  {
+    return pair_first;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline const std::vector<unsigned int> &
+  NeighborList<dim, spacedim>::get_second_indices() const
+  {
+    return pair_second;
+  }
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
@@ -35,6 +35,10 @@ namespace Particles
   class ParticleIterator;
   template <int, int>
   class ParticleHandler;
+  template <int, int>
+  class DataOut;
+  template <int, int>
+  class PortableParticleData;
 #endif
 
   /**
@@ -485,6 +489,10 @@ namespace Particles
     friend class ParticleIterator;
     template <int, int>
     friend class ParticleHandler;
+    template <int, int>
+    friend class DataOut;
+    template <int, int>
+    friend class PortableParticleData;
   };
 
 
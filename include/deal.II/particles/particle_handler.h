@@ -308,6 +308,30 @@ namespace Particles
       const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
       const ArrayView<const double> &properties = {});
 
+    /**
+     * Insert a number of particles that are all located in the same @p cell.
+     * This function does the same as calling insert_particle() for each of
+     * the particles, but it registers all of them with the PropertyPool at
+     * once, see PropertyPool::register_particles(). Like insert_particle(),
+     * it does not update the cached numbers of particles, so
+     * update_cached_numbers() has to be called once all particles have been
+     * inserted.
+     *
+     * @param[in] cell The cell in which the particles are located.
+     * @param[in] positions Initial positions of the particles in real space.
+     * @param[in] reference_positions Initial positions of the particles
+     * in the coordinate system of the reference cell. Has to be of the same
+     * size as @p positions.
+     * @param[in] first_particle_index The identifier of the first particle.
+     * The following particles are numbered consecutively.
+     */
+    void
+    insert_particles_in_cell(
+      const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
+      const ArrayView<const Point<spacedim>> &positions,
+      const ArrayView<const Point<dim>>      &reference_positions,
+      const types::particle_index             first_particle_index);
+
     /**
      * Insert a number of particles into the collection of particles.
      * This function involves a copy of the particles and their properties.
@@ -716,6 +740,78 @@ namespace Particles
     void
     sort_particles_into_subdomains_and_cells();
 
+    /**
+     * Start a particle exchange, i.e., the first half of
+     * sort_particles_into_subdomains_and_cells(). This function finds the
+     * new cells of all locally owned particles, moves the particles that
+     * stay on the current process into their new cells, serializes the
+     * particles that moved to other processes, and starts sending them with
+     * non-blocking MPI calls. The exchange is completed by
+     * finish_particle_exchange().
+     *
+     * Calling these two functions instead of
+     * sort_particles_into_subdomains_and_cells() allows to overlap the
+     * transport of particles with other work, e.g., the solution of a linear
+     * system:
+     * @code
+     * particle_handler.start_particle_exchange();
+     * solver.solve(system_matrix, solution, system_rhs, preconditioner);
+     * particle_handler.finish_particle_exchange();
+     * @endcode
+     * In between, the particles of this object must neither be accessed nor
+     * modified, since the particles that left their cell are only removed
+     * in finish_particle_exchange(). In particular, no other
+     * function of this class that exchanges particles may be called.
+     */
+    void
+    start_particle_exchange();
+
+    /**
+     * Finish the particle exchange started by start_particle_exchange():
+     * wait for the particles sent by other processes, insert them into their
+     * cells, remove the particles that left their old cell, and update the
+     * cached numbers.
+     */
+    void
+    finish_particle_exchange();
+
+    /**
+     * Reorder the data in the property pool such that the particles are
+     * stored in the order in which they are visited by the particle
+     * iterators, i.e., the particles of each cell occupy consecutive memory
+     * slots and the cells follow each other in the order of their active cell
+     * index. Unused slots left behind by removed particles are released.
+     * Loops over all particles then access the locations and properties in
+     * a streaming fashion.
+     *
+     * The handles of all particles change, but existing particle iterators
+     * stay valid. The function returns immediately if the data is already
+     * sorted. It is called at the end of
+     * sort_particles_into_subdomains_and_cells(), and also by the functions
+     * that insert or remove many particles at once if
+     * memory_fragmentation() exceeds ten percent.
+     */
+    void
+    sort_particles_for_locality();
+
+    /**
+     * Return the fraction of the slots of the property pool that are not in
+     * the order of particle iteration, i.e., that are unused or whose
+     * particle does not directly follow the previous particle in memory. The
+     * value is zero after a call to sort_particles_for_locality() and
+     * approaches one if the particle data is scattered randomly.
+     */
+    double
+    memory_fragmentation() const;
+
+    /**
+     * Return an estimate for the memory consumption (in bytes) of this
+     * object on the current process, including the particle data stored in
+     * the property pool.
+     */
+    std::size_t
+    memory_consumption() const;
+
     /**
      * Exchange all particles that live in cells that are ghost cells to
      * other processes. Clears and re-populates the ghost_neighbors
@@ -901,6 +997,14 @@ namespace Particles
     void
     reset_particle_container(particle_container &particles);
 
+    /**
+     * Call sort_particles_for_locality() if memory_fragmentation() exceeds a
+     * threshold. This function is called at the end of the functions that
+     * insert or remove many particles at once.
+     */
+    void
+    sort_particles_for_locality_if_fragmented();
+
     /**
      * Address of the triangulation to work on.
      */
@@ -1071,6 +1175,30 @@ namespace Particles
             typename Triangulation<dim, spacedim>::active_cell_iterator>>(),
       const bool enable_cache = false);
 
+    /**
+     * Serialize the particles in @p particles_to_send and start their
+     * transfer with non-blocking MPI calls. The arguments are the same as
+     * for send_recv_particles(), which is equivalent to this function
+     * followed by send_recv_particles_finish().
+     */
+    void
+    send_recv_particles_start(
+      const std::map<types::subdomain_id, std::vector<particle_iterator>>
+        &particles_to_send,
+      const std::map<
+        types::subdomain_id,
+        std::vector<
+          typename Triangulation<dim, spacedim>::active_cell_iterator>>
+                &new_cells_for_particles,
+      const bool enable_cache);
+
+    /**
+     * Wait for the transfer started by send_recv_particles_start() and
+     * insert the received particles.
+     */
+    void
+    send_recv_particles_finish();
+
     /**
      * Transfer ghost particles' position and properties assuming that the
      * particles have not changed cells. This routine uses the
@@ -1097,6 +1225,12 @@ namespace Particles
      */
     internal::GhostParticlePartitioner<dim, spacedim> ghost_particles_cache;
 
+    /**
+     * The state of a particle exchange between the calls to
+     * start_particle_exchange() and finish_particle_exchange().
+     */
+    internal::ParticleExchangeData<dim, spacedim> particle_exchange_data;
+
     /**
      * Connect the particle handler to the relevant triangulation signals to
      * appropriately react to changes in the underlying triangulation.
@@ -17,6 +17,8 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi_stub.h>
+
 #include <deal.II/particles/particle_iterator.h>
 
 DEAL_II_NAMESPACE_OPEN
@@ -111,6 +113,78 @@ namespace Particles
        */
       std::vector<char> recv_data;
     };
+
+
+
+    /**
+     * Structure that holds the state of a particle exchange between the
+     * calls to ParticleHandler::start_particle_exchange() and
+     * ParticleHandler::finish_particle_exchange(), i.e., the serialized data
+     * of the outgoing particles, the MPI requests that are in flight, and the
+     * particles that need to be removed locally once the exchange is done.
+     */
+    template <int dim, int spacedim>
+    struct ParticleExchangeData
+    {
+      /**
+       * A type that can be used to iterate over all particles in the domain.
+       */
+      using particle_iterator = ParticleIterator<dim, spacedim>;
+
+      /**
+       * Indicates if an exchange has been started and not yet finished.
+       */
+      bool in_progress = false;
+
+      /**
+       * Whether the exchange should set up the GhostParticlePartitioner.
+       */
+      bool build_cache = false;
+
+      /**
+       * Vector of the subdomain id of all possible neighbors of the current
+       * subdomain.
+       */
+      std::vector<types::subdomain_id> neighbors;
+
+      /**
+       * Number of particles sent to and received from each of the neighbors.
+       */
+      std::vector<unsigned int> n_send_data;
+
+      /**
+       * See n_send_data.
+       */
+      std::vector<unsigned int> n_recv_data;
+
+      /**
+       * Offsets into send_data of the data for each neighbor.
+       */
+      std::vector<unsigned int> send_offsets;
+
+      /**
+       * The serialized data of the particles to be sent, including their
+       * new cells.
+       */
+      std::vector<char> send_data;
+
+      /**
+       * The requests of the exchange of the number of particles.
+       */
+      std::vector<MPI_Request> n_requests;
+
+      /**
+       * The requests of the sends of the particle data.
+       */
+      std::vector<MPI_Request> send_requests;
+
+      /**
+       * The particles that have left their cell and have been either
+       * re-inserted locally or sent away, and need to be removed from their
+       * old cell.
+       */
+      std::vector<particle_iterator> particles_to_remove;
+    };
   } // namespace internal
 
 } // namespace Particles
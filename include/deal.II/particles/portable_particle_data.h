@@ -0,0 +1,222 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_particles_portable_particle_data_h
+#define dealii_particles_portable_particle_data_h
+
+#include <deal.II/base/config.h>
+
+#include <deal.II/base/memory_space.h>
+#include <deal.II/base/partitioner.h>
+#include <deal.II/base/types.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <memory>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  // Forward declaration
+#ifndef DOXYGEN
+  template <int, int>
+  class ParticleHandler;
+#endif
+
+  /**
+   * A copy of the locally owned particles of a ParticleHandler in the memory
+   * space MemorySpace::Default, which is the memory of the device if deal.II
+   * is configured with Kokkos support for a GPU. The data of the particles is
+   * stored in Kokkos::View objects that can be used directly in device
+   * kernels, for example to move the particles:
+   * @code
+   *   const auto locations = particle_data.locations;
+   *   const auto velocities = ...;
+   *   Kokkos::parallel_for(
+   *     Kokkos::RangePolicy<
+   *       MemorySpace::Default::kokkos_space::execution_space>(
+   *       0, particle_data.n_particles()),
+   *     KOKKOS_LAMBDA(const int p) {
+   *       for (unsigned int d = 0; d < dim; ++d)
+   *         locations(p, d) += time_step * velocities(p, d);
+   *     });
+   * @endcode
+   *
+   * The particles are copied from and to the host only when the particle
+   * handler needs them, typically when the particles have moved so far that
+   * they have to be sorted into new cells or sent to other processes:
+   * @code
+   *   particle_data.copy_to_host(particle_handler);
+   *   particle_handler.sort_particles_into_subdomains_and_cells();
+   *   particle_data.copy_from_host(particle_handler);
+   * @endcode
+   * Between these two calls, the particle handler must not be changed. The
+   * reference locations and cells stored in this object are those of the
+   * last call to copy_from_host(), and are the ones used by
+   * PortableFieldInterpolation.
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim = dim>
+  class PortableParticleData
+  {
+  public:
+    using kokkos_space = MemorySpace::Default::kokkos_space;
+
+    /**
+     * Copy the data of the locally owned particles of @p particle_handler
+     * into the views of this object, resizing them as necessary. The
+     * particles are stored in the order in which @p particle_handler
+     * iterates over them.
+     */
+    void
+    copy_from_host(const ParticleHandler<dim, spacedim> &particle_handler);
+
+    /**
+     * Copy the locations and properties of the particles back into
+     * @p particle_handler, which must hold the same particles as in the last
+     * call to copy_from_host(). The ids, reference locations, and cells of
+     * the particles are not copied back.
+     */
+    void
+    copy_to_host(ParticleHandler<dim, spacedim> &particle_handler) const;
+
+    /**
+     * Return the number of particles stored in this object.
+     */
+    unsigned int
+    n_particles() const;
+
+    /**
+     * The locations of the particles in real space.
+     */
+    Kokkos::View<double *[spacedim], kokkos_space> locations;
+
+    /**
+     * The locations of the particles in the coordinate system of the
+     * reference cell of their cells.
+     */
+    Kokkos::View<double *[dim], kokkos_space> reference_locations;
+
+    /**
+     * The ids of the particles.
+     */
+    Kokkos::View<types::particle_index *, kokkos_space> ids;
+
+    /**
+     * The active cell indices of the cells the particles are in.
+     */
+    Kokkos::View<unsigned int *, kokkos_space> cell_indices;
+
+    /**
+     * The properties of the particles, with one row per particle. The values
+     * of a single property are contiguous in memory.
+     */
+    Kokkos::View<double **, Kokkos::LayoutLeft, kokkos_space> properties;
+  };
+
+
+
+  /**
+   * Interpolation of a finite element field to the locations of particles
+   * stored in a PortableParticleData object, in the memory space
+   * MemorySpace::Default. This class does for particles on the device what
+   * FEPointEvaluation does on the host for values, using the reference
+   * locations of the particles and the degrees of freedom of their cells.
+   *
+   * The finite element has to be a tensor product element of Lagrange type
+   * such as FE_Q or FE_DGQ, or an FESystem of copies of such an element. The
+   * shape functions are evaluated inside the device kernel from the 1d
+   * support points of the element.
+   *
+   * @ingroup Particle
+   */
+  template <int dim, int spacedim = dim, typename Number = double>
+  class PortableFieldInterpolation
+  {
+  public:
+    using kokkos_space = MemorySpace::Default::kokkos_space;
+
+    /**
+     * The largest number of 1d shape functions supported.
+     */
+    static constexpr unsigned int max_n_shape_functions_1d = 16;
+
+    /**
+     * Copy the degrees of freedom of the locally owned cells of
+     * @p dof_handler and the 1d support points of its finite element to the
+     * device. The degrees of freedom are stored as indices into vectors with
+     * the layout given by @p partitioner.
+     */
+    void
+    reinit(
+      const DoFHandler<dim, spacedim>                          &dof_handler,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner);
+
+    /**
+     * Evaluate the finite element field @p field at the locations of the
+     * particles in @p particle_data, and store the result in @p values, with
+     * one row per particle and one column per vector component. The view is
+     * resized if necessary. The ghost values of @p field have to be up to
+     * date.
+     */
+    void
+    interpolate(
+      const PortableParticleData<dim, spacedim>                 &particle_data,
+      const LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+                                                                &field,
+      Kokkos::View<Number **, Kokkos::LayoutLeft, kokkos_space> &values) const;
+
+  private:
+    /**
+     * The number of vector components of the finite element.
+     */
+    unsigned int n_components;
+
+    /**
+     * The 1d support points of the finite element.
+     */
+    Kokkos::View<Number *, kokkos_space> support_points_1d;
+
+    /**
+     * The inverses of the denominators of the 1d Lagrange polynomials.
+     */
+    Kokkos::View<Number *, kokkos_space> lagrange_weights_1d;
+
+    /**
+     * The degrees of freedom of all active cells in lexicographic order, as
+     * indices into the locally owned and ghost entries of a vector. The
+     * entries of cells that are not locally owned are not set.
+     */
+    Kokkos::View<unsigned int **, kokkos_space> dof_indices;
+  };
+
+
+
+  template <int dim, int spacedim>
+  inline unsigned int
+  PortableParticleData<dim, spacedim>::n_particles() const
+  {
+    return ids.extent(0);
+  }
+} // namespace Particles
+
+DEAL_II_NAMESPACE_CLOSE
+
+#endif
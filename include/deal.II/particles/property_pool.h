@@ -19,6 +19,10 @@
 
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+#include <algorithm>
+#include <vector>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -96,11 +100,46 @@ namespace Particles
    * course the PropertyType could contain a pointer to dynamically allocated
    * memory with varying sizes per particle (this memory would not be managed by
    * this class).
+   *
+   * <h3>Memory layout of properties</h3>
+   *
+   * By default, the properties of each particle are stored next to each
+   * other, which allows get_properties() to return a contiguous view of the
+   * properties of one particle. Algorithms that update one property of all
+   * particles at a time, on the other hand, then access memory with a stride
+   * of n_properties_per_slot(). For such algorithms, the properties can be
+   * rearranged via set_property_layout() such that all values of one property
+   * are stored contiguously, see get_property_values(). Since the functions
+   * of the Particle, ParticleAccessor, and ParticleHandler classes access the
+   * properties of single particles, the default layout has to be restored
+   * before any of them are used.
+   *
+   * Independently of the layout, apply_to_particle_batches() runs a function
+   * on the locations and properties of several particles at once, with each
+   * particle in one lane of a VectorizedArray.
    */
   template <int dim, int spacedim = dim>
   class PropertyPool
   {
   public:
+    /**
+     * The ways in which the properties of all particles can be arranged in
+     * memory.
+     */
+    enum class PropertyLayout
+    {
+      /**
+       * The properties of each particle are stored contiguously. This is the
+       * default.
+       */
+      particle_major,
+      /**
+       * The values of each property for all particles are stored
+       * contiguously.
+       */
+      property_major
+    };
+
     /**
      * Typedef for the handle that is returned to the particles, and that
      * uniquely identifies the slot of memory that is reserved for this
@@ -142,6 +181,17 @@ namespace Particles
     Handle
     register_particle();
 
+    /**
+     * Register as many particles as @p handles has entries and store their
+     * handles in @p handles. The result is the same as calling
+     * register_particle() for each of them, but the memory for all new slots
+     * is allocated at once. In PropertyLayout::property_major layout, this
+     * also means that the values of the existing slots are moved only once,
+     * rather than once per new particle.
+     */
+    void
+    register_particles(const ArrayView<Handle> &handles);
+
     /**
      * Return a handle obtained by register_particle() and mark the memory
      * allocated for storing the particle's data as free for re-use.
@@ -201,10 +251,67 @@ namespace Particles
     /**
      * Return an ArrayView to the properties that correspond to the given
      * handle @p handle.
+     *
+     * @note This function can only be called if the properties are stored
+     * in PropertyLayout::particle_major layout.
      */
     ArrayView<double>
     get_properties(const Handle handle);
 
+    /**
+     * Change the arrangement of the properties in memory to the given
+     * @p layout. This function copies all properties and is therefore
+     * only worth calling if many operations follow that benefit from the new
+     * layout.
+     */
+    void
+    set_property_layout(const PropertyLayout layout);
+
+    /**
+     * Return the current arrangement of the properties in memory.
+     */
+    PropertyLayout
+    get_property_layout() const;
+
+    /**
+     * Return an ArrayView to the values of the property with index
+     * @p property_index for all slots in the pool, indexed by handle. The
+     * view has n_slots() entries, including those of unregistered slots.
+     *
+     * @note This function can only be called if the properties are stored
+     * in PropertyLayout::property_major layout.
+     */
+    ArrayView<double>
+    get_property_values(const unsigned int property_index);
+
+    /**
+     * Run the given @p function on batches of VectorizedArray<double>::size()
+     * slots of the pool at a time. For each batch, the locations and
+     * properties of the particles are loaded into the lanes of vectorized
+     * arrays, passed to the function, and written back to the pool
+     * afterwards. The function is called as
+     * @code
+     *   function(locations, properties, n_filled_lanes);
+     * @endcode
+     * where `locations` is of type
+     * `Point<spacedim, VectorizedArray<double>> &`, `properties` is an
+     * `ArrayView<VectorizedArray<double>>` with n_properties_per_slot()
+     * entries, and `n_filled_lanes` is the number of lanes that correspond to
+     * a slot, which is less than the vector width for the last batch only.
+     *
+     * The loop also runs over slots that are not registered. Their locations
+     * and properties are set to zero before the loop, so that the function
+     * does not operate on undefined data, and any values written to them are
+     * discarded when the slot is registered again.
+     *
+     * This function works with either property layout, but only avoids
+     * strided memory access for the properties in
+     * PropertyLayout::property_major layout.
+     */
+    template <typename Function>
+    void
+    apply_to_particle_batches(const Function &function);
+
     /**
      * Reserve the dynamic memory needed for storing the properties of
      * @p size particles.
@@ -242,12 +349,32 @@ namespace Particles
     void
     sort_memory_slots(const std::vector<Handle> &handles_to_sort);
 
+    /**
+     * Return an estimate for the memory consumption (in bytes) of this
+     * object.
+     */
+    std::size_t
+    memory_consumption() const;
+
   private:
+    /**
+     * Return the position of the property with index @p property_index of
+     * the particle identified by @p handle in the `properties` array.
+     */
+    std::size_t
+    property_position(const Handle       handle,
+                      const unsigned int property_index) const;
+
     /**
      * The number of properties that are reserved per particle.
      */
     const unsigned int n_properties;
 
+    /**
+     * The arrangement of the values in the `properties` array.
+     */
+    PropertyLayout property_layout;
+
     /**
      * A vector that stores the locations of particles. It is indexed in the
      * same way as the `reference_locations` and `properties` arrays, i.e., via
@@ -272,7 +399,8 @@ namespace Particles
     /**
      * The currently allocated properties (whether assigned to
      * a particle or available for assignment). It is indexed the same way as
-     * the `locations` and `reference_locations` arrays via handles.
+     * the `locations` and `reference_locations` arrays via handles, with the
+     * arrangement given by `property_layout`.
      */
     std::vector<double> properties;
 
@@ -472,12 +600,163 @@ namespace Particles
            ExcMessage("Invalid property handle. This can happen if the "
                       "handle was duplicated and then one copy was deallocated "
                       "before trying to access the properties."));
+    Assert(property_layout == PropertyLayout::particle_major,
+           ExcMessage("The properties of a single particle can only be "
+                      "accessed in the particle-major property layout."));
 
     return ArrayView<double>(properties.data() + data_index, n_properties);
   }
 
 
 
+  template <int dim, int spacedim>
+  inline typename PropertyPool<dim, spacedim>::PropertyLayout
+  PropertyPool<dim, spacedim>::get_property_layout() const
+  {
+    return property_layout;
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline ArrayView<double>
+  PropertyPool<dim, spacedim>::get_property_values(
+    const unsigned int property_index)
+  {
+    AssertIndexRange(property_index, n_properties);
+    Assert(property_layout == PropertyLayout::property_major,
+           ExcMessage("The values of a single property can only be "
+                      "accessed in the property-major property layout."));
+
+    return ArrayView<double>(properties.data() +
+                               property_index * locations.size(),
+                             locations.size());
+  }
+
+
+
+  template <int dim, int spacedim>
+  inline std::size_t
+  PropertyPool<dim, spacedim>::property_position(
+    const Handle       handle,
+    const unsigned int property_index) const
+  {
+    if (property_layout == PropertyLayout::particle_major)
+      return static_cast<std::size_t>(handle) * n_properties + property_index;
+    else
+      return static_cast<std::size_t>(property_index) * locations.size() +
+             handle;
+  }
+
+
+
+  template <int dim, int spacedim>
+  template <typename Function>
+  inline void
+  PropertyPool<dim, spacedim>::apply_to_particle_batches(
+    const Function &function)
+  {
+    using VectorizedArrayType = VectorizedArray<double>;
+
+    constexpr unsigned int n_lanes       = VectorizedArrayType::size();
+    const std::size_t      n_all_slots   = locations.size();
+    const bool             is_contiguous =
+      property_layout == PropertyLayout::property_major;
+
+    // give unregistered slots well-defined values, see the documentation
+    for (const Handle handle : currently_available_handles)
+      {
+        locations[handle] = Point<spacedim>();
+        for (unsigned int p = 0; p < n_properties; ++p)
+          properties[property_position(handle, p)] = 0.;
+      }
+
+    // offsets of the lanes for the transposition of the locations and, in
+    // particle-major layout, of the properties
+    unsigned int location_offsets[n_lanes];
+    unsigned int property_offsets[n_lanes];
+    for (unsigned int v = 0; v < n_lanes; ++v)
+      {
+        location_offsets[v] = v * spacedim;
+        property_offsets[v] = v * n_properties;
+      }
+
+    Point<spacedim, VectorizedArrayType> batch_locations;
+    std::vector<VectorizedArrayType>     batch_properties(n_properties);
+
+    for (std::size_t first = 0; first < n_all_slots; first += n_lanes)
+      {
+        const unsigned int n_filled_lanes =
+          std::min<std::size_t>(n_lanes, n_all_slots - first);
+
+        if (n_filled_lanes == n_lanes)
+          {
+            vectorized_load_and_transpose(spacedim,
+                                          &locations[first][0],
+                                          location_offsets,
+                                          &batch_locations[0]);
+            if (is_contiguous)
+              for (unsigned int p = 0; p < n_properties; ++p)
+                batch_properties[p].load(
+                  &properties[property_position(first, p)]);
+            else if (n_properties > 0)
+              vectorized_load_and_transpose(n_properties,
+                                            &properties[first * n_properties],
+                                            property_offsets,
+                                            batch_properties.data());
+          }
+        else
+          {
+            batch_locations = Point<spacedim, VectorizedArrayType>();
+            std::fill(batch_properties.begin(),
+                      batch_properties.end(),
+                      VectorizedArrayType());
+            for (unsigned int v = 0; v < n_filled_lanes; ++v)
+              {
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  batch_locations[d][v] = locations[first + v][d];
+                for (unsigned int p = 0; p < n_properties; ++p)
+                  batch_properties[p][v] =
+                    properties[property_position(first + v, p)];
+              }
+          }
+
+        function(batch_locations,
+                 make_array_view(batch_properties),
+                 n_filled_lanes);
+
+        if (n_filled_lanes == n_lanes)
+          {
+            vectorized_transpose_and_store(false,
+                                           spacedim,
+                                           &batch_locations[0],
+                                           location_offsets,
+                                           &locations[first][0]);
+            if (is_contiguous)
+              for (unsigned int p = 0; p < n_properties; ++p)
+                batch_properties[p].store(
+                  &properties[property_position(first, p)]);
+            else if (n_properties > 0)
+              vectorized_transpose_and_store(false,
+                                             n_properties,
+                                             batch_properties.data(),
+                                             property_offsets,
+                                             &properties[first * n_properties]);
+          }
+        else
+          for (unsigned int v = 0; v < n_filled_lanes; ++v)
+            {
+              for (unsigned int d = 0; d < spacedim; ++d)
+                locations[first + v][d] = batch_locations[d][v];
+              for (unsigned int p = 0; p < n_properties; ++p)
+                properties[property_position(first + v, p)] =
+                  batch_properties[p][v];
+            }
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   inline unsigned int
   PropertyPool<dim, spacedim>::n_slots() const
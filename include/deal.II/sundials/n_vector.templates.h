@@ -288,10 +288,68 @@ namespace SUNDIALS
       int
       linear_combination(int nv, realtype *c, N_Vector *x, N_Vector z);
 
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
+          * = nullptr>
+      int
+      scale_add_multi(int       nv,
+                      realtype *a,
+                      N_Vector  x,
+                      N_Vector *Y,
+                      N_Vector *Z);
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
+          * = nullptr>
+      int
+      linear_sum_vector_array(int       nv,
+                              realtype  a,
+                              N_Vector *X,
+                              realtype  b,
+                              N_Vector *Y,
+                              N_Vector *Z);
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
+          * = nullptr>
+      int
+      scale_vector_array(int nv, realtype *c, N_Vector *X, N_Vector *Z);
+
       template <typename VectorType>
       SUNDIALS::realtype
       dot_product(N_Vector x, N_Vector y);
 
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
+          * = nullptr>
+      SUNDIALS::realtype
+      dot_product_local(N_Vector x, N_Vector y);
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
+          * = nullptr>
+      SUNDIALS::realtype
+      max_norm_local(N_Vector x);
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
+          * = nullptr>
+      SUNDIALS::realtype
+      weighted_square_sum_local(N_Vector x, N_Vector w);
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
+          * = nullptr>
+      SUNDIALS::realtype
+      weighted_square_sum_mask_local(N_Vector x, N_Vector w, N_Vector mask);
+
       template <
         typename VectorType,
         std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>>
@@ -840,6 +898,95 @@ namespace SUNDIALS
 
 
 
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>> *>
+      int
+      scale_add_multi(int       nv,
+                      realtype *a,
+                      N_Vector  x,
+                      N_Vector *Y,
+                      N_Vector *Z)
+      {
+        const VectorType *x_dealii = unwrap_nvector_const<VectorType>(x);
+        std::vector<const VectorType *> y_dealii(nv);
+        std::vector<VectorType *>       z_dealii(nv);
+        for (int i = 0; i < nv; ++i)
+          {
+            y_dealii[i] = unwrap_nvector_const<VectorType>(Y[i]);
+            z_dealii[i] = unwrap_nvector<VectorType>(Z[i]);
+          }
+
+        // Read each entry of x only once for all vectors. N.B. Z[i] may alias
+        // with Y[i].
+        for (unsigned int b = 0; b < n_blocks(*x_dealii); ++b)
+          for (unsigned int j = 0; j < block(*x_dealii, b).locally_owned_size();
+               ++j)
+            {
+              const double x_j = block(*x_dealii, b).local_element(j);
+              for (int i = 0; i < nv; ++i)
+                block(*z_dealii[i], b).local_element(j) =
+                  a[i] * x_j + block(*y_dealii[i], b).local_element(j);
+            }
+
+        return 0;
+      }
+
+
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>> *>
+      int
+      linear_sum_vector_array(int       nv,
+                              realtype  a,
+                              N_Vector *X,
+                              realtype  b,
+                              N_Vector *Y,
+                              N_Vector *Z)
+      {
+        for (int i = 0; i < nv; ++i)
+          {
+            const VectorType *x_dealii = unwrap_nvector_const<VectorType>(X[i]);
+            const VectorType *y_dealii = unwrap_nvector_const<VectorType>(Y[i]);
+            VectorType       *z_dealii = unwrap_nvector<VectorType>(Z[i]);
+
+            // N.B. Z[i] may alias with X[i] or Y[i].
+            for (unsigned int bl = 0; bl < n_blocks(*z_dealii); ++bl)
+              for (unsigned int j = 0;
+                   j < block(*z_dealii, bl).locally_owned_size();
+                   ++j)
+                block(*z_dealii, bl).local_element(j) =
+                  a * block(*x_dealii, bl).local_element(j) +
+                  b * block(*y_dealii, bl).local_element(j);
+          }
+
+        return 0;
+      }
+
+
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>> *>
+      int
+      scale_vector_array(int nv, realtype *c, N_Vector *X, N_Vector *Z)
+      {
+        for (int i = 0; i < nv; ++i)
+          {
+            const VectorType *x_dealii = unwrap_nvector_const<VectorType>(X[i]);
+            VectorType       *z_dealii = unwrap_nvector<VectorType>(Z[i]);
+            if (x_dealii == z_dealii)
+              *z_dealii *= c[i];
+            else
+              z_dealii->equ(c[i], *x_dealii);
+          }
+
+        return 0;
+      }
+
+
+
       template <typename VectorType>
       SUNDIALS::realtype
       dot_product(N_Vector x, N_Vector y)
@@ -906,11 +1053,104 @@ namespace SUNDIALS
 
 
 
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>> *>
+      SUNDIALS::realtype
+      dot_product_local(N_Vector x, N_Vector y)
+      {
+        const VectorType *x_dealii = unwrap_nvector_const<VectorType>(x);
+        const VectorType *y_dealii = unwrap_nvector_const<VectorType>(y);
+
+        SUNDIALS::realtype result = 0.;
+        for (unsigned int b = 0; b < n_blocks(*x_dealii); ++b)
+          for (unsigned int j = 0; j < block(*x_dealii, b).locally_owned_size();
+               ++j)
+            result += block(*x_dealii, b).local_element(j) *
+                      block(*y_dealii, b).local_element(j);
+        return result;
+      }
+
+
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>> *>
+      SUNDIALS::realtype
+      max_norm_local(N_Vector x)
+      {
+        const VectorType *x_dealii = unwrap_nvector_const<VectorType>(x);
+
+        SUNDIALS::realtype result = 0.;
+        for (unsigned int b = 0; b < n_blocks(*x_dealii); ++b)
+          for (unsigned int j = 0; j < block(*x_dealii, b).locally_owned_size();
+               ++j)
+            result = std::max<SUNDIALS::realtype>(
+              result, std::abs(block(*x_dealii, b).local_element(j)));
+        return result;
+      }
+
+
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>> *>
+      SUNDIALS::realtype
+      weighted_square_sum_local(N_Vector x, N_Vector w)
+      {
+        const VectorType *x_dealii = unwrap_nvector_const<VectorType>(x);
+        const VectorType *w_dealii = unwrap_nvector_const<VectorType>(w);
+
+        SUNDIALS::realtype result = 0.;
+        for (unsigned int b = 0; b < n_blocks(*x_dealii); ++b)
+          for (unsigned int j = 0; j < block(*x_dealii, b).locally_owned_size();
+               ++j)
+            {
+              const SUNDIALS::realtype product =
+                block(*x_dealii, b).local_element(j) *
+                block(*w_dealii, b).local_element(j);
+              result += product * product;
+            }
+        return result;
+      }
+
+
+
+      template <
+        typename VectorType,
+        std::enable_if_t<is_dealii_compatible_distributed_vector<VectorType>> *>
+      SUNDIALS::realtype
+      weighted_square_sum_mask_local(N_Vector x, N_Vector w, N_Vector mask)
+      {
+        const VectorType *x_dealii    = unwrap_nvector_const<VectorType>(x);
+        const VectorType *w_dealii    = unwrap_nvector_const<VectorType>(w);
+        const VectorType *mask_dealii = unwrap_nvector_const<VectorType>(mask);
+
+        SUNDIALS::realtype result = 0.;
+        for (unsigned int b = 0; b < n_blocks(*x_dealii); ++b)
+          for (unsigned int j = 0; j < block(*x_dealii, b).locally_owned_size();
+               ++j)
+            {
+              const SUNDIALS::realtype product =
+                block(*x_dealii, b).local_element(j) *
+                block(*w_dealii, b).local_element(j) *
+                block(*mask_dealii, b).local_element(j);
+              result += product * product;
+            }
+        return result;
+      }
+
+
+
       template <typename VectorType>
       SUNDIALS::realtype
       weighted_l2_norm(N_Vector x, N_Vector w)
       {
-        // TODO copy can be avoided by a custom kernel
+        if constexpr (is_dealii_compatible_distributed_vector<VectorType>)
+          return std::sqrt(
+            Utilities::MPI::sum(weighted_square_sum_local<VectorType>(x, w),
+                                get_communicator<VectorType>(x)));
+
         VectorType tmp      = *unwrap_nvector_const<VectorType>(x);
         auto      *w_dealii = unwrap_nvector_const<VectorType>(w);
         tmp.scale(*w_dealii);
@@ -980,7 +1220,12 @@ namespace SUNDIALS
       SUNDIALS::realtype
       weighted_rms_norm(N_Vector x, N_Vector w)
       {
-        // TODO copy can be avoided by a custom kernel
+        if constexpr (is_dealii_compatible_distributed_vector<VectorType>)
+          return std::sqrt(
+            Utilities::MPI::sum(weighted_square_sum_local<VectorType>(x, w),
+                                get_communicator<VectorType>(x)) /
+            unwrap_nvector_const<VectorType>(x)->size());
+
         VectorType tmp      = *unwrap_nvector_const<VectorType>(x);
         auto      *w_dealii = unwrap_nvector_const<VectorType>(w);
         const auto n        = tmp.size();
@@ -994,7 +1239,14 @@ namespace SUNDIALS
       SUNDIALS::realtype
       weighted_rms_norm_mask(N_Vector x, N_Vector w, N_Vector mask)
       {
-        // TODO copy can be avoided by a custom kernel
+        if constexpr (is_dealii_compatible_distributed_vector<VectorType>)
+          return std::sqrt(Utilities::MPI::sum(
+                             weighted_square_sum_mask_local<VectorType>(x,
+                                                                        w,
+                                                                        mask),
+                             get_communicator<VectorType>(x)) /
+                           unwrap_nvector_const<VectorType>(x)->size());
+
         VectorType tmp         = *unwrap_nvector_const<VectorType>(x);
         auto      *w_dealii    = unwrap_nvector_const<VectorType>(w);
         auto      *mask_dealii = unwrap_nvector_const<VectorType>(mask);
@@ -1325,11 +1577,25 @@ namespace SUNDIALS
           v->ops->nvdotprodmulti      = nullptr;
         }
 
-      v->ops->nvscaleaddmulti = nullptr;
+      if constexpr (is_dealii_compatible_distributed_vector<VectorType>)
+        v->ops->nvscaleaddmulti =
+          &NVectorOperations::scale_add_multi<VectorType>;
+      else
+        v->ops->nvscaleaddmulti = nullptr;
 
       /* OPTIONAL vector array operations */
-      v->ops->nvlinearsumvectorarray         = nullptr;
-      v->ops->nvscalevectorarray             = nullptr;
+      if constexpr (is_dealii_compatible_distributed_vector<VectorType>)
+        {
+          v->ops->nvlinearsumvectorarray =
+            &NVectorOperations::linear_sum_vector_array<VectorType>;
+          v->ops->nvscalevectorarray =
+            &NVectorOperations::scale_vector_array<VectorType>;
+        }
+      else
+        {
+          v->ops->nvlinearsumvectorarray = nullptr;
+          v->ops->nvscalevectorarray     = nullptr;
+        }
       v->ops->nvconstvectorarray             = nullptr;
       v->ops->nvwrmsnormvectorarray          = nullptr;
       v->ops->nvwrmsnormmaskvectorarray      = nullptr;
@@ -1337,15 +1603,29 @@ namespace SUNDIALS
       v->ops->nvlinearcombinationvectorarray = nullptr;
 
       /* Local reduction kernels (no parallel communication) */
-      v->ops->nvdotprodlocal     = nullptr;
-      v->ops->nvmaxnormlocal     = nullptr;
+      if constexpr (is_dealii_compatible_distributed_vector<VectorType>)
+        {
+          v->ops->nvdotprodlocal =
+            &NVectorOperations::dot_product_local<VectorType>;
+          v->ops->nvmaxnormlocal =
+            &NVectorOperations::max_norm_local<VectorType>;
+          v->ops->nvwsqrsumlocal =
+            &NVectorOperations::weighted_square_sum_local<VectorType>;
+          v->ops->nvwsqrsummasklocal =
+            &NVectorOperations::weighted_square_sum_mask_local<VectorType>;
+        }
+      else
+        {
+          v->ops->nvdotprodlocal     = nullptr;
+          v->ops->nvmaxnormlocal     = nullptr;
+          v->ops->nvwsqrsumlocal     = nullptr;
+          v->ops->nvwsqrsummasklocal = nullptr;
+        }
       v->ops->nvminlocal         = nullptr;
       v->ops->nvl1normlocal      = nullptr;
       v->ops->nvinvtestlocal     = nullptr;
       v->ops->nvconstrmasklocal  = nullptr;
       v->ops->nvminquotientlocal = nullptr;
-      v->ops->nvwsqrsumlocal     = nullptr;
-      v->ops->nvwsqrsummasklocal = nullptr;
 
 #  if DEAL_II_SUNDIALS_VERSION_GTE(6, 0, 0)
       /* Single buffer reduction operations */
@@ -17,8 +17,10 @@
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/mpi_large_count.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/thread_management.h>
+#include <deal.II/base/trace.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/numerics/data_component_interpretation.h>
@@ -32,6 +34,7 @@
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <sstream>
 #include <vector>
@@ -129,6 +132,11 @@ namespace
   /**
    * Do a zlib compression followed by a base64 encoding of the given data. The
    * result is then returned as a string object.
+   *
+   * The data is split into blocks of a fixed size that are compressed
+   * independently and in parallel, using the multi-block header layout of
+   * VTK's vtkZLibDataCompressor. This keeps the compression of large data
+   * arrays from being the serial bottleneck of writing VTU files.
    */
   template <typename T>
   std::string
@@ -140,49 +148,88 @@ namespace
       {
         const std::size_t uncompressed_size = (data.size() * sizeof(T));
 
-        // While zlib's compress2 uses unsigned long (which is 64bits
-        // on Linux), the vtu compression header stores the block size
-        // as an std::uint32_t (see below). While we could implement
-        // writing several smaller blocks, we haven't done that. Let's
-        // trigger an error for the user instead:
-        AssertThrow(uncompressed_size <=
-                      std::numeric_limits<std::uint32_t>::max(),
-                    ExcNotImplemented());
-
-        // allocate a buffer for compressing data and do so
-        auto compressed_data_length = compressBound(uncompressed_size);
-        AssertThrow(compressed_data_length <=
-                      std::numeric_limits<std::uint32_t>::max(),
+        // The vtu compression header stores the block sizes as
+        // std::uint32_t, which the block size below satisfies by
+        // construction. Blocks of one MiB are large enough for zlib to
+        // achieve its usual compression ratio and small enough to give
+        // enough parallelism for large arrays.
+        const std::size_t block_size = std::size_t(1) << 20;
+        const std::size_t n_blocks =
+          (uncompressed_size + block_size - 1) / block_size;
+        AssertThrow(n_blocks <= std::numeric_limits<std::uint32_t>::max(),
                     ExcNotImplemented());
-
-        std::vector<unsigned char> compressed_data(compressed_data_length);
-
-        int err = compress2(&compressed_data[0],
-                            &compressed_data_length,
-                            reinterpret_cast<const Bytef *>(data.data()),
-                            uncompressed_size,
-                            get_zlib_compression_level(compression_level));
-        (void)err;
-        Assert(err == Z_OK, ExcInternalError());
-
-        // Discard the unnecessary bytes
-        compressed_data.resize(compressed_data_length);
-
-        // now encode the compression header
-        const std::uint32_t compression_header[4] = {
-          1,                                             /* number of blocks */
-          static_cast<std::uint32_t>(uncompressed_size), /* size of block */
-          static_cast<std::uint32_t>(
-            uncompressed_size), /* size of last block */
-          static_cast<std::uint32_t>(
-            compressed_data_length)}; /* list of compressed sizes of blocks */
+        const std::size_t last_block_size =
+          uncompressed_size - (n_blocks - 1) * block_size;
+
+        const Bytef *const uncompressed_data =
+          reinterpret_cast<const Bytef *>(data.data());
+        const int zlib_compression_level =
+          get_zlib_compression_level(compression_level);
+
+        // compress all blocks into separate buffers
+        std::vector<std::vector<unsigned char>> compressed_blocks(n_blocks);
+        dealii::parallel::apply_to_subranges(
+          std::size_t(0),
+          n_blocks,
+          [&](const std::size_t begin, const std::size_t end) {
+            for (std::size_t b = begin; b < end; ++b)
+              {
+                const std::size_t size =
+                  (b == n_blocks - 1 ? last_block_size : block_size);
+
+                auto compressed_data_length = compressBound(size);
+                compressed_blocks[b].resize(compressed_data_length);
+
+                int err = compress2(compressed_blocks[b].data(),
+                                    &compressed_data_length,
+                                    uncompressed_data + b * block_size,
+                                    size,
+                                    zlib_compression_level);
+                (void)err;
+                Assert(err == Z_OK, ExcInternalError());
+
+                // Discard the unnecessary bytes
+                compressed_blocks[b].resize(compressed_data_length);
+              }
+          },
+          1);
+
+        // now encode the compression header, consisting of the number of
+        // blocks, the size of the blocks and of the last block, and the
+        // list of compressed sizes of all blocks
+        std::vector<std::uint32_t> compression_header(3 + n_blocks);
+        compression_header[0] = static_cast<std::uint32_t>(n_blocks);
+        compression_header[1] = static_cast<std::uint32_t>(
+          n_blocks == 1 ? last_block_size : block_size);
+        compression_header[2] = static_cast<std::uint32_t>(last_block_size);
+        std::size_t total_compressed_size = 0;
+        for (std::size_t b = 0; b < n_blocks; ++b)
+          {
+            compression_header[3 + b] =
+              static_cast<std::uint32_t>(compressed_blocks[b].size());
+            total_compressed_size += compressed_blocks[b].size();
+          }
 
         const auto *const header_start =
-          reinterpret_cast<const unsigned char *>(&compression_header[0]);
+          reinterpret_cast<const unsigned char *>(compression_header.data());
 
-        return (Utilities::encode_base64(
-                  {header_start, header_start + 4 * sizeof(std::uint32_t)}) +
-                Utilities::encode_base64(compressed_data));
+        // concatenate the compressed blocks, and release the memory of
+        // each block as soon as it has been copied
+        std::vector<unsigned char> compressed_data;
+        compressed_data.reserve(total_compressed_size);
+        for (auto &block : compressed_blocks)
+          {
+            compressed_data.insert(compressed_data.end(),
+                                   block.begin(),
+                                   block.end());
+            std::vector<unsigned char>().swap(block);
+          }
+
+        std::string result = Utilities::encode_base64(
+          {header_start,
+           header_start + compression_header.size() * sizeof(std::uint32_t)});
+        result += Utilities::encode_base64(compressed_data);
+        return result;
       }
     else
       return {};
@@ -444,21 +491,26 @@ namespace DataOutBase
     for (unsigned int d = 0; d < dim; ++d)
       int_pt[d] = p[d];
 
-    const Map3DPoint::const_iterator it = existing_points.find(int_pt);
-    unsigned int                     internal_ind;
+    unsigned int internal_ind = points.size();
 
-    // If the point isn't in the set, or we're not filtering duplicate points,
-    // add it
-    if (it == existing_points.end() || !flags.filter_duplicate_vertices)
+    // If we're filtering duplicate points, only add the point if it isn't
+    // in the set yet. Otherwise, simply record it with the next free index
+    // and avoid the lookup altogether
+    if (flags.filter_duplicate_vertices)
       {
-        internal_ind = existing_points.size();
-        existing_points.insert(std::make_pair(int_pt, internal_ind));
+        const auto [it, inserted] =
+          existing_points.insert(std::make_pair(int_pt, internal_ind));
+        if (inserted)
+          points.push_back(int_pt);
+        else
+          internal_ind = it->second;
       }
     else
-      {
-        internal_ind = it->second;
-      }
+      points.push_back(int_pt);
+
     // Now add the index to the list of filtered points
+    if (index >= filtered_points.size())
+      filtered_points.resize(index + 1, numbers::invalid_unsigned_int);
     filtered_points[index] = internal_ind;
   }
 
@@ -468,6 +520,9 @@ namespace DataOutBase
   DataOutFilter::internal_add_cell(const unsigned int cell_index,
                                    const unsigned int pt_index)
   {
+    AssertIndexRange(pt_index, filtered_points.size());
+    if (cell_index >= filtered_cells.size())
+      filtered_cells.resize(cell_index + 1, 0);
     filtered_cells[cell_index] = filtered_points[pt_index];
 
     // (Re)-initialize counter at any first call to this method.
@@ -480,14 +535,11 @@ namespace DataOutBase
   void
   DataOutFilter::fill_node_data(std::vector<double> &node_data) const
   {
-    node_data.resize(existing_points.size() * node_dim);
+    node_data.resize(points.size() * node_dim);
 
-    for (const auto &existing_point : existing_points)
-      {
-        for (unsigned int d = 0; d < node_dim; ++d)
-          node_data[node_dim * existing_point.second + d] =
-            existing_point.first[d];
-      }
+    for (unsigned int i = 0; i < points.size(); ++i)
+      for (unsigned int d = 0; d < node_dim; ++d)
+        node_data[node_dim * i + d] = points[i][d];
   }
 
 
@@ -498,11 +550,8 @@ namespace DataOutBase
   {
     cell_data.resize(filtered_cells.size());
 
-    for (const auto &filtered_cell : filtered_cells)
-      {
-        cell_data[filtered_cell.first] =
-          filtered_cell.second + local_node_offset;
-      }
+    for (unsigned int i = 0; i < filtered_cells.size(); ++i)
+      cell_data[i] = filtered_cells[i] + local_node_offset;
   }
 
 
@@ -534,7 +583,7 @@ namespace DataOutBase
   unsigned int
   DataOutFilter::n_nodes() const
   {
-    return existing_points.size();
+    return points.size();
   }
 
 
@@ -670,7 +719,7 @@ namespace DataOutBase
     // Record the data set name, dimension, and allocate space for it
     data_set_names.push_back(name);
     data_set_dims.push_back(new_dim);
-    data_sets.emplace_back(new_dim * existing_points.size());
+    data_sets.emplace_back(new_dim * points.size());
 
     // TODO: averaging, min/max, etc for merged vertices
     for (unsigned int i = 0; i < filtered_points.size(); ++i)
@@ -2424,13 +2473,15 @@ namespace DataOutBase
                      const bool             print_date_and_time,
                      const CompressionLevel compression_level,
                      const bool             write_higher_order_cells,
-                     const std::map<std::string, std::string> &physical_units)
+                     const std::map<std::string, std::string> &physical_units,
+                     const bool merge_duplicate_vertices)
     : time(time)
     , cycle(cycle)
     , print_date_and_time(print_date_and_time)
     , compression_level(compression_level)
     , write_higher_order_cells(write_higher_order_cells)
     , physical_units(physical_units)
+    , merge_duplicate_vertices(merge_duplicate_vertices)
   {}
 
 
@@ -2598,6 +2649,67 @@ namespace DataOutBase
   }
 
 
+
+  /**
+   * Identify the nodes at the given positions that coincide when converted
+   * to single precision. Return for each node the index of the merged node
+   * it belongs to, and for each merged node the first of the original nodes
+   * it consists of. The merged nodes are numbered in the order of their
+   * first occurrence.
+   */
+  template <int spacedim>
+  std::pair<std::vector<unsigned int>, std::vector<unsigned int>>
+  merge_duplicate_nodes(const std::vector<Point<spacedim>> &node_positions)
+  {
+    const auto same_location = [&node_positions](const unsigned int a,
+                                                 const unsigned int b) {
+      for (unsigned int d = 0; d < spacedim; ++d)
+        if (static_cast<float>(node_positions[a][d]) !=
+            static_cast<float>(node_positions[b][d]))
+          return false;
+      return true;
+    };
+
+    // sort the nodes lexicographically by their position, using the index
+    // of the node as tie breaker so that the first node of each group of
+    // coinciding nodes is the one with the smallest index
+    std::vector<unsigned int> permutation(node_positions.size());
+    std::iota(permutation.begin(), permutation.end(), 0U);
+    std::sort(permutation.begin(),
+              permutation.end(),
+              [&node_positions](const unsigned int a, const unsigned int b) {
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  if (static_cast<float>(node_positions[a][d]) !=
+                      static_cast<float>(node_positions[b][d]))
+                    return static_cast<float>(node_positions[a][d]) <
+                           static_cast<float>(node_positions[b][d]);
+                return a < b;
+              });
+
+    std::vector<unsigned int> first_coinciding_node(node_positions.size());
+    for (unsigned int i = 0; i < permutation.size(); ++i)
+      first_coinciding_node[permutation[i]] =
+        (i > 0 && same_location(permutation[i], permutation[i - 1])) ?
+          first_coinciding_node[permutation[i - 1]] :
+          permutation[i];
+
+    std::vector<unsigned int> merged_node_index(node_positions.size());
+    std::vector<unsigned int> representatives;
+    for (unsigned int node = 0; node < node_positions.size(); ++node)
+      if (first_coinciding_node[node] == node)
+        {
+          merged_node_index[node] = representatives.size();
+          representatives.push_back(node);
+        }
+      else
+        merged_node_index[node] =
+          merged_node_index[first_coinciding_node[node]];
+
+    return {std::move(merged_node_index), std::move(representatives)};
+  }
+
+
+
   template <int dim, int spacedim, typename StreamType>
   void
   write_nodes(const std::vector<Patch<dim, spacedim>> &patches, StreamType &out)
@@ -5393,6 +5505,20 @@ namespace DataOutBase
     std::tie(n_nodes, n_cells, std::ignore) =
       count_nodes_and_cells_and_points(patches, flags.write_higher_order_cells);
 
+    // if requested, identify the nodes of different patches at the same
+    // location, and from here on only count the merged nodes
+    std::vector<unsigned int> merged_node_index;
+    std::vector<unsigned int> merged_node_representative;
+    if (flags.merge_duplicate_vertices)
+      {
+        std::tie(merged_node_index, merged_node_representative) =
+          merge_duplicate_nodes(get_node_positions(patches));
+        n_nodes = merged_node_representative.size();
+      }
+    const auto node_index = [&merged_node_index](const unsigned int node) {
+      return merged_node_index.empty() ? node : merged_node_index[node];
+    };
+
     // -----------------
     // In the following, let us first set up a number of lambda functions that
     // will be used in building the different parts of the VTU file. We will
@@ -5400,6 +5526,7 @@ namespace DataOutBase
     // first make up a list of used vertices along with their coordinates
     const auto stringize_vertex_information = [&patches,
                                                &flags,
+                                               &merged_node_representative,
                                                output_precision =
                                                  out.precision(),
                                                ascii_or_binary]() {
@@ -5414,14 +5541,19 @@ namespace DataOutBase
       // in 1d or 2d. So pad node positions with zeros as appropriate.
       std::vector<float> node_coordinates_3d;
       node_coordinates_3d.reserve(node_positions.size() * 3);
-      for (const auto &node_position : node_positions)
-        {
-          for (unsigned int d = 0; d < 3; ++d)
-            if (d < spacedim)
-              node_coordinates_3d.emplace_back(node_position[d]);
-            else
-              node_coordinates_3d.emplace_back(0.0f);
-        }
+      const auto add_node = [&](const Point<spacedim> &node_position) {
+        for (unsigned int d = 0; d < 3; ++d)
+          if (d < spacedim)
+            node_coordinates_3d.emplace_back(node_position[d]);
+          else
+            node_coordinates_3d.emplace_back(0.0f);
+      };
+      if (flags.merge_duplicate_vertices)
+        for (const unsigned int node : merged_node_representative)
+          add_node(node_positions[node]);
+      else
+        for (const auto &node_position : node_positions)
+          add_node(node_position);
       o << vtu_stringize_array(node_coordinates_3d,
                                flags.compression_level,
                                output_precision)
@@ -5438,6 +5570,7 @@ namespace DataOutBase
     // build cells.
     const auto stringize_cell_to_vertex_information = [&patches,
                                                        &flags,
+                                                       &node_index,
                                                        ascii_or_binary,
                                                        output_precision =
                                                          out.precision()]() {
@@ -5474,12 +5607,12 @@ namespace DataOutBase
                    DataOutBase::CompressionLevel::plain_text))
                 {
                   for (unsigned int i = 0; i < n_points; ++i)
-                    cells.push_back(first_vertex_of_patch + i);
+                    cells.push_back(node_index(first_vertex_of_patch + i));
                 }
               else
                 {
                   for (unsigned int i = 0; i < n_points; ++i)
-                    o << '\t' << first_vertex_of_patch + i;
+                    o << '\t' << node_index(first_vertex_of_patch + i);
                   o << '\n';
                 }
 
@@ -5499,16 +5632,17 @@ namespace DataOutBase
                    DataOutBase::CompressionLevel::plain_text))
                 {
                   for (unsigned int i = 0; i < n_points; ++i)
-                    cells.push_back(
+                    cells.push_back(node_index(
                       first_vertex_of_patch +
-                      patch.reference_cell.vtk_vertex_to_deal_vertex(i));
+                      patch.reference_cell.vtk_vertex_to_deal_vertex(i)));
                 }
               else
                 {
                   for (unsigned int i = 0; i < n_points; ++i)
                     o << '\t'
-                      << (first_vertex_of_patch +
-                          patch.reference_cell.vtk_vertex_to_deal_vertex(i));
+                      << node_index(
+                           first_vertex_of_patch +
+                           patch.reference_cell.vtk_vertex_to_deal_vertex(i));
                   o << '\n';
                 }
 
@@ -5526,6 +5660,7 @@ namespace DataOutBase
               const auto flush_current_cell = [&flags,
                                                &o,
                                                &cells,
+                                               &node_index,
                                                first_vertex_of_patch,
                                                &local_vertex_order]() {
                 if (deal_ii_with_zlib &&
@@ -5533,12 +5668,12 @@ namespace DataOutBase
                      DataOutBase::CompressionLevel::plain_text))
                   {
                     for (const auto &c : local_vertex_order)
-                      cells.push_back(first_vertex_of_patch + c);
+                      cells.push_back(node_index(first_vertex_of_patch + c));
                   }
                 else
                   {
                     for (const auto &c : local_vertex_order)
-                      o << '\t' << first_vertex_of_patch + c;
+                      o << '\t' << node_index(first_vertex_of_patch + c);
                     o << '\n';
                   }
 
@@ -6034,9 +6169,26 @@ namespace DataOutBase
     // so do this on a separate task and when wanting to write out the
     // data, we wait for that task to finish.
     Threads::Task<std::unique_ptr<Table<2, float>>>
-      create_global_data_table_task = Threads::new_task([&patches]() {
-        return create_global_data_table<dim, spacedim, float>(patches);
-      });
+      create_global_data_table_task =
+        Threads::new_task([&patches, &merged_node_representative]() {
+          std::unique_ptr<Table<2, float>> data_vectors =
+            create_global_data_table<dim, spacedim, float>(patches);
+
+          // only keep the columns of the nodes that are actually written
+          if (merged_node_representative.size() > 0)
+            {
+              auto merged_data_vectors = std::make_unique<Table<2, float>>(
+                data_vectors->n_rows(), merged_node_representative.size());
+              for (unsigned int i = 0; i < data_vectors->n_rows(); ++i)
+                for (unsigned int n = 0; n < merged_node_representative.size();
+                     ++n)
+                  (*merged_data_vectors)(i, n) =
+                    (*data_vectors)(i, merged_node_representative[n]);
+              data_vectors = std::move(merged_data_vectors);
+            }
+
+          return data_vectors;
+        });
 
     // -----------------------------
     // Now finally get around to actually doing anything. Let's start with
@@ -6099,6 +6251,137 @@ namespace DataOutBase
 
 
 
+  template <int dim, int spacedim>
+  void
+  write_vtu_in_parallel(
+    const std::vector<Patch<dim, spacedim>> &patches,
+    const std::vector<std::string>          &data_names,
+    const std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>
+                      &nonscalar_data_ranges,
+    const VtkFlags    &flags,
+    const std::string &filename,
+    const MPI_Comm     comm)
+  {
+#ifndef DEAL_II_WITH_MPI
+    // without MPI fall back to the normal way to write a vtu file:
+    (void)comm;
+
+    std::ofstream f(filename);
+    AssertThrow(f, ExcFileNotOpen(filename));
+    write_vtu(patches, data_names, nonscalar_data_ranges, flags, f);
+#else
+
+    const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
+    const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+    MPI_Info           info;
+    int                ierr = MPI_Info_create(&info);
+    AssertThrowMPI(ierr);
+    MPI_File fh;
+    ierr = MPI_File_open(
+      comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fh);
+    AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(filename));
+
+    ierr = MPI_File_set_size(fh, 0); // delete the file contents
+    AssertThrowMPI(ierr);
+    // this barrier is necessary, because otherwise others might already write
+    // while one core is still setting the size to zero.
+    ierr = MPI_Barrier(comm);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Info_free(&info);
+    AssertThrowMPI(ierr);
+
+    // Define header size so we can broadcast later.
+    unsigned int  header_size;
+    std::uint64_t footer_offset;
+
+    // write header
+    if (myrank == 0)
+      {
+        std::stringstream ss;
+        write_vtu_header(ss, flags);
+        header_size = ss.str().size();
+        // Write the header on rank 0 at the start of a file, i.e., offset 0.
+        ierr = Utilities::MPI::LargeCount::File_write_at_c(
+          fh, 0, ss.str().c_str(), header_size, MPI_CHAR, MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+
+    ierr = MPI_Bcast(&header_size, 1, MPI_UNSIGNED, 0, comm);
+    AssertThrowMPI(ierr);
+
+    {
+      const types::global_dof_index my_n_patches = patches.size();
+      const types::global_dof_index global_n_patches =
+        Utilities::MPI::sum(my_n_patches, comm);
+
+      // Do not write pieces with 0 cells as this will crash paraview if this
+      // is the first piece written. But if nobody has any pieces to write
+      // (file is empty), let processor 0 write their empty data, otherwise
+      // the vtk file is invalid.
+      std::stringstream ss;
+      if (my_n_patches > 0 || (global_n_patches == 0 && myrank == 0))
+        write_vtu_main(patches, data_names, nonscalar_data_ranges, flags, ss);
+
+      // Use prefix sum to find specific offset to write at.
+      const std::uint64_t size_on_proc = ss.str().size();
+      std::uint64_t       prefix_sum   = 0;
+      ierr =
+        MPI_Exscan(&size_on_proc, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, comm);
+      AssertThrowMPI(ierr);
+
+      // Locate specific offset for each processor.
+      const MPI_Offset offset =
+        static_cast<MPI_Offset>(header_size) + prefix_sum;
+
+      ierr =
+        Utilities::MPI::LargeCount::File_write_at_all_c(fh,
+                                                        offset,
+                                                        ss.str().c_str(),
+                                                        ss.str().size(),
+                                                        MPI_CHAR,
+                                                        MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      if (myrank == n_ranks - 1)
+        {
+          // Locating Footer with offset on last rank.
+          footer_offset = size_on_proc + offset;
+
+          std::stringstream ss;
+          write_vtu_footer(ss);
+          const unsigned int footer_size = ss.str().size();
+
+          // Writing footer:
+          ierr =
+            Utilities::MPI::LargeCount::File_write_at_c(fh,
+                                                        footer_offset,
+                                                        ss.str().c_str(),
+                                                        footer_size,
+                                                        MPI_CHAR,
+                                                        MPI_STATUS_IGNORE);
+          AssertThrowMPI(ierr);
+        }
+    }
+
+    // Make sure we sync to disk. As written in the standard,
+    // MPI_File_close() actually already implies a sync but there seems
+    // to be a bug on at least one configuration (running with multiple
+    // nodes using OpenMPI 4.1) that requires it. Without this call, the
+    // footer is sometimes missing.
+    ierr = MPI_File_sync(fh);
+    AssertThrowMPI(ierr);
+
+    ierr = MPI_File_close(&fh);
+    AssertThrowMPI(ierr);
+#endif
+  }
+
+
+
   void
   write_pvtu_record(
     std::ostream                   &out,
@@ -7698,6 +7981,63 @@ DataOutInterface<dim, spacedim>::write_vtu(std::ostream &out) const
                          out);
 }
 
+template <int dim, int spacedim>
+void
+DataOutInterface<dim, spacedim>::write_vtu_in_pieces(
+  std::ostream                                             &out,
+  const std::function<void(const std::function<void()> &)> &generate_pieces)
+  const
+{
+  DataOutBase::write_vtu_header(out, vtk_flags);
+
+  // the time and cycle of the simulation may only be attached to the first
+  // piece
+  DataOutBase::VtkFlags piece_flags = vtk_flags;
+  generate_pieces([&]() {
+    DataOutBase::write_vtu_main(get_patches(),
+                                get_dataset_names(),
+                                get_nonscalar_data_ranges(),
+                                piece_flags,
+                                out);
+    piece_flags.time  = std::numeric_limits<double>::min();
+    piece_flags.cycle = std::numeric_limits<unsigned int>::min();
+  });
+
+  DataOutBase::write_vtu_footer(out);
+}
+
+
+
+template <int dim, int spacedim>
+Threads::Task<>
+DataOutInterface<dim, spacedim>::write_vtu_in_background(
+  const std::string &filename) const
+{
+  // take a snapshot of all data needed for writing, so that this object may
+  // change while the task runs
+  auto patches = std::make_shared<std::vector<DataOutBase::Patch<dim, spacedim>>>(
+    get_patches());
+  auto dataset_names =
+    std::make_shared<std::vector<std::string>>(get_dataset_names());
+  auto nonscalar_data_ranges = std::make_shared<std::vector<
+    std::tuple<unsigned int,
+               unsigned int,
+               std::string,
+               DataComponentInterpretation::DataComponentInterpretation>>>(
+    get_nonscalar_data_ranges());
+  const DataOutBase::VtkFlags flags = vtk_flags;
+
+  return Threads::new_task(
+    [filename, patches, dataset_names, nonscalar_data_ranges, flags]() {
+      std::ofstream out(filename);
+      AssertThrow(out, ExcFileNotOpen(filename));
+      DataOutBase::write_vtu(
+        *patches, *dataset_names, *nonscalar_data_ranges, flags, out);
+    });
+}
+
+
+
 template <int dim, int spacedim>
 void
 DataOutInterface<dim, spacedim>::write_svg(std::ostream &out) const
@@ -7716,120 +8056,14 @@ DataOutInterface<dim, spacedim>::write_vtu_in_parallel(
   const std::string &filename,
   const MPI_Comm     comm) const
 {
-#ifndef DEAL_II_WITH_MPI
-  // without MPI fall back to the normal way to write a vtu file:
-  (void)comm;
-
-  std::ofstream f(filename);
-  AssertThrow(f, ExcFileNotOpen(filename));
-  write_vtu(f);
-#else
-
-  const unsigned int myrank  = Utilities::MPI::this_mpi_process(comm);
-  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
-  MPI_Info           info;
-  int                ierr = MPI_Info_create(&info);
-  AssertThrowMPI(ierr);
-  MPI_File fh;
-  ierr = MPI_File_open(
-    comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, info, &fh);
-  AssertThrow(ierr == MPI_SUCCESS, ExcFileNotOpen(filename));
-
-  ierr = MPI_File_set_size(fh, 0); // delete the file contents
-  AssertThrowMPI(ierr);
-  // this barrier is necessary, because otherwise others might already write
-  // while one core is still setting the size to zero.
-  ierr = MPI_Barrier(comm);
-  AssertThrowMPI(ierr);
-  ierr = MPI_Info_free(&info);
-  AssertThrowMPI(ierr);
-
-  // Define header size so we can broadcast later.
-  unsigned int  header_size;
-  std::uint64_t footer_offset;
-
-  // write header
-  if (myrank == 0)
-    {
-      std::stringstream ss;
-      DataOutBase::write_vtu_header(ss, vtk_flags);
-      header_size = ss.str().size();
-      // Write the header on rank 0 at the start of a file, i.e., offset 0.
-      ierr = Utilities::MPI::LargeCount::File_write_at_c(
-        fh, 0, ss.str().c_str(), header_size, MPI_CHAR, MPI_STATUS_IGNORE);
-      AssertThrowMPI(ierr);
-    }
-
-  ierr = MPI_Bcast(&header_size, 1, MPI_UNSIGNED, 0, comm);
-  AssertThrowMPI(ierr);
-
-  {
-    const auto                   &patches      = get_patches();
-    const types::global_dof_index my_n_patches = patches.size();
-    const types::global_dof_index global_n_patches =
-      Utilities::MPI::sum(my_n_patches, comm);
-
-    // Do not write pieces with 0 cells as this will crash paraview if this is
-    // the first piece written. But if nobody has any pieces to write (file is
-    // empty), let processor 0 write their empty data, otherwise the vtk file is
-    // invalid.
-    std::stringstream ss;
-    if (my_n_patches > 0 || (global_n_patches == 0 && myrank == 0))
-      DataOutBase::write_vtu_main(patches,
-                                  get_dataset_names(),
-                                  get_nonscalar_data_ranges(),
-                                  vtk_flags,
-                                  ss);
-
-    // Use prefix sum to find specific offset to write at.
-    const std::uint64_t size_on_proc = ss.str().size();
-    std::uint64_t       prefix_sum   = 0;
-    ierr =
-      MPI_Exscan(&size_on_proc, &prefix_sum, 1, MPI_UINT64_T, MPI_SUM, comm);
-    AssertThrowMPI(ierr);
-
-    // Locate specific offset for each processor.
-    const MPI_Offset offset = static_cast<MPI_Offset>(header_size) + prefix_sum;
-
-    ierr = Utilities::MPI::LargeCount::File_write_at_all_c(fh,
-                                                           offset,
-                                                           ss.str().c_str(),
-                                                           ss.str().size(),
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
-    AssertThrowMPI(ierr);
-
-    if (myrank == n_ranks - 1)
-      {
-        // Locating Footer with offset on last rank.
-        footer_offset = size_on_proc + offset;
-
-        std::stringstream ss;
-        DataOutBase::write_vtu_footer(ss);
-        const unsigned int footer_size = ss.str().size();
-
-        // Writing footer:
-        ierr = Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                           footer_offset,
-                                                           ss.str().c_str(),
-                                                           footer_size,
-                                                           MPI_CHAR,
-                                                           MPI_STATUS_IGNORE);
-        AssertThrowMPI(ierr);
-      }
-  }
-
-  // Make sure we sync to disk. As written in the standard,
-  // MPI_File_close() actually already implies a sync but there seems
-  // to be a bug on at least one configuration (running with multiple
-  // nodes using OpenMPI 4.1) that requires it. Without this call, the
-  // footer is sometimes missing.
-  ierr = MPI_File_sync(fh);
-  AssertThrowMPI(ierr);
-
-  ierr = MPI_File_close(&fh);
-  AssertThrowMPI(ierr);
-#endif
+  const Trace::Scope trace_scope("DataOutInterface::write_vtu_in_parallel");
+
+  DataOutBase::write_vtu_in_parallel(get_patches(),
+                                     get_dataset_names(),
+                                     get_nonscalar_data_ranges(),
+                                     vtk_flags,
+                                     filename,
+                                     comm);
 }
 
 
@@ -18,6 +18,7 @@
 #include <deal.II/base/point.h>
 #include <deal.II/base/std_cxx17/cmath.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
 
 #include <deal.II/lac/vector.h>
 
@@ -36,6 +37,16 @@ namespace Functions
   }
 
 
+  template <int dim>
+  VectorizedArray<double>
+  SquareFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    return p.square();
+  }
+
+
   template <int dim>
   void
   SquareFunction<dim>::vector_value(const Point<dim> &p,
@@ -133,6 +144,18 @@ namespace Functions
 
 
 
+  template <int dim>
+  VectorizedArray<double>
+  Q1WedgeFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    Assert(dim >= 2, ExcInternalError());
+    return p[0] * p[1];
+  }
+
+
+
   template <int dim>
   void
   Q1WedgeFunction<dim>::value_list(const std::vector<Point<dim>> &points,
@@ -274,6 +297,19 @@ namespace Functions
     return 0.;
   }
 
+
+  template <int dim>
+  VectorizedArray<double>
+  PillowFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    VectorizedArray<double> result = 1.;
+    for (unsigned int d = 0; d < dim; ++d)
+      result *= 1. - p[d] * p[d];
+    return result + offset;
+  }
+
   template <int dim>
   void
   PillowFunction<dim>::value_list(const std::vector<Point<dim>> &points,
@@ -448,6 +484,19 @@ namespace Functions
     return 0.;
   }
 
+
+  template <int dim>
+  VectorizedArray<double>
+  CosineFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    VectorizedArray<double> result = 1.;
+    for (unsigned int d = 0; d < dim; ++d)
+      result *= std::cos(numbers::PI_2 * p[d]);
+    return result;
+  }
+
   template <int dim>
   void
   CosineFunction<dim>::value_list(const std::vector<Point<dim>> &points,
@@ -1031,6 +1080,19 @@ namespace Functions
     return 0.;
   }
 
+
+  template <int dim>
+  VectorizedArray<double>
+  ExpFunction<dim>::vectorized_value(
+    const Point<dim, VectorizedArray<double>> &p,
+    const unsigned int) const
+  {
+    VectorizedArray<double> result = 1.;
+    for (unsigned int d = 0; d < dim; ++d)
+      result *= std::exp(p[d]);
+    return result;
+  }
+
   template <int dim>
   void
   ExpFunction<dim>::value_list(const std::vector<Point<dim>> &points,
@@ -98,6 +98,16 @@ FunctionParser<dim>::initialize(const std::string                   &vars,
 
 
 
+template <int dim>
+bool
+FunctionParser<dim>::compile_expressions()
+{
+  return internal::FunctionParser::ParserImplementation<dim, double>::
+    compile_expressions();
+}
+
+
+
 template <int dim>
 double
 FunctionParser<dim>::value(const Point<dim>  &p,
@@ -18,6 +18,7 @@
 
 #include <deal.II/lac/exceptions.h>
 
+#include <algorithm>
 #include <vector>
 
 #ifdef DEAL_II_WITH_TRILINOS
@@ -245,9 +246,11 @@ IndexSet::operator&(const IndexSet &is) const
                    ((r2->begin <= r1->begin) && (r2->end > r1->begin)),
                  ExcInternalError());
 
-          // add the overlapping range to the result
-          result.add_range(std::max(r1->begin, r2->begin),
-                           std::min(r1->end, r2->end));
+          // add the overlapping range to the result. the overlaps are
+          // found in ascending order and are disjoint, so we can append
+          // them directly rather than going through add_range()
+          result.ranges.emplace_back(std::max(r1->begin, r2->begin),
+                                     std::min(r1->end, r2->end));
 
           // now move that iterator that ends earlier one up. note that it has
           // to be this one because a subsequent range may still have a chance
@@ -259,6 +262,7 @@ IndexSet::operator&(const IndexSet &is) const
         }
     }
 
+  result.is_compressed = false;
   result.compress();
   return result;
 }
@@ -523,12 +527,15 @@ IndexSet::subtract_set(const IndexSet &other)
   for (; own_it != ranges.end(); ++own_it)
     new_ranges.push_back(*own_it);
 
-  ranges.clear();
-
-  // done, now add the temporary ranges
-  const std::vector<Range>::iterator end = new_ranges.end();
-  for (std::vector<Range>::iterator it = new_ranges.begin(); it != end; ++it)
-    add_range(it->begin, it->end);
+  // done. the new ranges are sorted and disjoint, but some of them may have
+  // been shrunk to empty ones above; drop those and take over the rest
+  new_ranges.erase(std::remove_if(new_ranges.begin(),
+                                  new_ranges.end(),
+                                  [](const Range &range) {
+                                    return range.begin == range.end;
+                                  }),
+                   new_ranges.end());
+  ranges.swap(new_ranges);
 
   compress();
 }
@@ -709,16 +716,26 @@ IndexSet::is_subset_of(const IndexSet &other) const
                     std::to_string(size()) + " and " +
                     std::to_string(other.size()) + "."));
 
-  // See whether there are indices in the current set that are not in 'other'.
-  // If so, then this is clearly not a subset of 'other'.
-  IndexSet A_minus_B = *this;
-  A_minus_B.subtract_set(other);
-  if (A_minus_B.n_elements() > 0)
-    return false;
-  else
-    // Else, every index in 'this' is also in 'other', since we ended up
-    // with an empty set upon subtraction. This means that we have a subset:
-    return true;
+  compress();
+  other.compress();
+
+  // Walk through the ranges of both sets simultaneously, rather than
+  // computing the difference of the two sets, which would need to allocate
+  // memory. Since the ranges of a compressed set are maximal, every range of
+  // the current set needs to be contained in a single range of 'other' if
+  // this is a subset of 'other'.
+  std::vector<Range>::const_iterator other_range = other.ranges.begin();
+  for (const Range &range : ranges)
+    {
+      while (other_range != other.ranges.end() &&
+             other_range->end <= range.begin)
+        ++other_range;
+
+      if (other_range == other.ranges.end() ||
+          other_range->begin > range.begin || other_range->end < range.end)
+        return false;
+    }
+  return true;
 }
 
 
@@ -0,0 +1,126 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_report.h>
+#include <deal.II/base/mpi.h>
+
+#include <iomanip>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+MemoryReport::MemoryReport(const MPI_Comm mpi_communicator)
+  : mpi_communicator(mpi_communicator)
+  , n_dofs(0)
+{}
+
+
+
+void
+MemoryReport::add_bytes(const std::string &name, const std::size_t bytes)
+{
+  components.emplace_back(name, bytes);
+}
+
+
+
+void
+MemoryReport::set_n_dofs(const types::global_dof_index n_dofs)
+{
+  this->n_dofs = n_dofs;
+}
+
+
+
+const std::vector<std::pair<std::string, std::size_t>> &
+MemoryReport::get_components() const
+{
+  return components;
+}
+
+
+
+std::size_t
+MemoryReport::get_local_total() const
+{
+  std::size_t total = 0;
+  for (const auto &component : components)
+    total += component.second;
+  return total;
+}
+
+
+
+void
+MemoryReport::print(std::ostream &out) const
+{
+  AssertDimension(Utilities::MPI::max(components.size(), mpi_communicator),
+                  components.size());
+
+  std::vector<double> local_bytes;
+  local_bytes.reserve(components.size() + 1);
+  for (const auto &component : components)
+    local_bytes.push_back(component.second);
+  local_bytes.push_back(get_local_total());
+
+  const std::vector<Utilities::MPI::MinMaxAvg> statistics =
+    Utilities::MPI::min_max_avg(local_bytes, mpi_communicator);
+
+  if (Utilities::MPI::this_mpi_process(mpi_communicator) != 0)
+    return;
+
+  std::size_t name_width = 9;
+  for (const auto &component : components)
+    name_width = std::max(name_width, component.first.size());
+  name_width += 2;
+
+  // save the state of the stream
+  const std::ios_base::fmtflags old_flags     = out.flags();
+  const std::streamsize         old_precision = out.precision();
+
+  out << std::fixed << std::setprecision(3);
+  out << std::left << std::setw(name_width) << "component" << std::right
+      << std::setw(11) << "min [MB]" << std::setw(11) << "avg [MB]"
+      << std::setw(11) << "max [MB]" << std::setw(12) << "total [MB]";
+  if (n_dofs > 0)
+    out << std::setw(11) << "bytes/DoF";
+  out << std::endl;
+
+  for (unsigned int i = 0; i < statistics.size(); ++i)
+    {
+      const Utilities::MPI::MinMaxAvg &data = statistics[i];
+      out << std::left << std::setw(name_width)
+          << (i < components.size() ? components[i].first : "total")
+          << std::right << std::setw(11) << 1e-6 * data.min << std::setw(11)
+          << 1e-6 * data.avg << std::setw(11) << 1e-6 * data.max
+          << std::setw(12) << 1e-6 * data.sum;
+      if (n_dofs > 0)
+        out << std::setw(11) << data.sum / n_dofs;
+      out << std::endl;
+    }
+
+  // restore the state of the stream
+  out.flags(old_flags);
+  out.precision(old_precision);
+}
+
+
+
+void
+MemoryReport::clear()
+{
+  components.clear();
+}
+
+DEAL_II_NAMESPACE_CLOSE
@@ -47,6 +47,55 @@ namespace Utilities
 
 
 
+#ifdef DEAL_II_WITH_MPI
+    NoncontiguousPartitioner::PersistentRequests::PersistentRequests(
+      const PersistentRequests &)
+    {}
+
+
+
+    NoncontiguousPartitioner::PersistentRequests &
+    NoncontiguousPartitioner::PersistentRequests::operator=(
+      const PersistentRequests &)
+    {
+      clear();
+      return *this;
+    }
+
+
+
+    NoncontiguousPartitioner::PersistentRequests::~PersistentRequests()
+    {
+      clear();
+    }
+
+
+
+    void
+    NoncontiguousPartitioner::PersistentRequests::clear()
+    {
+      // The requests can not be freed any more once MPI has been finalized,
+      // which might happen before objects with static storage duration are
+      // destroyed.
+      int finalized = 0;
+      MPI_Finalized(&finalized);
+      if (finalized == 0)
+        for (MPI_Request &request : requests)
+          if (request != MPI_REQUEST_NULL)
+            {
+              const int ierr = MPI_Request_free(&request);
+              (void)ierr;
+              AssertNothrow(ierr == MPI_SUCCESS, ExcMPI(ierr));
+            }
+
+      requests.clear();
+      datatype = MPI_DATATYPE_NULL;
+      buffer   = nullptr;
+    }
+#endif
+
+
+
     std::pair<unsigned int, unsigned int>
     NoncontiguousPartitioner::n_targets() const
     {
@@ -102,6 +151,10 @@ namespace Utilities
       recv_indices.clear();
       buffers.clear();
       requests.clear();
+#ifdef DEAL_II_WITH_MPI
+      persistent_export_requests.clear();
+      persistent_import_requests.clear();
+#endif
 
       // set up communication pattern
       std::vector<unsigned int> owning_ranks_of_ghosts(
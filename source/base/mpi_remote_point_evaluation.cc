@@ -266,6 +266,79 @@ namespace Utilities
 
 
 
+    template <int dim, int spacedim>
+    unsigned int
+    RemotePointEvaluation<dim, spacedim>::update_points(
+      const GridTools::Cache<dim, spacedim> &cache,
+      const std::vector<Point<spacedim>>    &points)
+    {
+#ifndef DEAL_II_WITH_MPI
+      Assert(false, ExcNeedsMPI());
+      (void)cache;
+      (void)points;
+      return 0;
+#else
+      const MPI_Comm comm = cache.get_triangulation().get_communicator();
+
+      // the fast path is only possible if the communication pattern is still
+      // valid for the given points on all processes
+      const bool pattern_is_valid =
+        ready_flag && all_points_found_flag &&
+        (&cache.get_triangulation() == &*tria) &&
+        (points.size() + 1 == point_ptrs.size());
+      if (Utilities::MPI::min(pattern_is_valid ? 1U : 0U, comm) == 0)
+        {
+          this->reinit(cache, points);
+          return Utilities::MPI::sum(static_cast<unsigned int>(points.size()),
+                                     comm);
+        }
+
+      // send the new positions to the processes evaluating the points and
+      // compute the new reference points in the previous cells there
+      const Mapping<dim, spacedim> &mapping = cache.get_mapping();
+      std::vector<Point<dim>>       new_reference_points(
+        cell_data->reference_point_values.size());
+      unsigned int n_points_left_cell = 0;
+
+      this->process_and_evaluate<Point<spacedim>>(
+        points,
+        [&](const ArrayView<const Point<spacedim>> &real_points,
+            const CellData                         &cell_data) {
+          for (const auto cell : cell_data.cell_indices())
+            {
+              const auto cell_iterator =
+                cell_data.get_active_cell_iterator(cell);
+              const auto cell_real_points =
+                cell_data.get_data_view(cell, real_points);
+              const ArrayView<Point<dim>> cell_reference_points(
+                new_reference_points.data() +
+                  cell_data.reference_point_ptrs[cell],
+                cell_real_points.size());
+
+              mapping.transform_points_real_to_unit_cell(
+                cell_iterator, cell_real_points, cell_reference_points);
+
+              for (const Point<dim> &p : cell_reference_points)
+                if (p[0] == std::numeric_limits<double>::infinity() ||
+                    !cell_iterator->reference_cell().contains_point(
+                      p, additional_data.tolerance))
+                  ++n_points_left_cell;
+            }
+        });
+
+      n_points_left_cell = Utilities::MPI::sum(n_points_left_cell, comm);
+
+      if (n_points_left_cell == 0)
+        cell_data->reference_point_values = std::move(new_reference_points);
+      else
+        this->reinit(cache, points);
+
+      return n_points_left_cell;
+#endif
+    }
+
+
+
     template <int dim, int spacedim>
     RemotePointEvaluation<dim, spacedim>::CellData::CellData(
       const Triangulation<dim, spacedim> &triangulation)
@@ -16,6 +16,7 @@
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
+#include <array>
 #include <cmath>
 #include <ctime>
 #include <limits>
@@ -28,6 +29,13 @@
 #  include <muParser.h>
 #endif
 
+#if defined(DEAL_II_WITH_SYMENGINE) && defined(DEAL_II_SYMENGINE_WITH_LLVM)
+#  include <deal.II/differentiation/sd/symengine_number_types.h>
+#  include <deal.II/differentiation/sd/symengine_scalar_operations.h>
+
+#  include <symengine/llvm_double.h>
+#endif
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace internal
@@ -257,6 +265,70 @@ namespace internal
 
 
 
+#if defined(DEAL_II_WITH_SYMENGINE) && defined(DEAL_II_SYMENGINE_WITH_LLVM)
+    /**
+     * The expressions compiled to native code by SymEngine's LLVM JIT
+     * compiler, one function per component.
+     */
+    class LLVMCompiledExpressions : public CompiledExpressionsBase
+    {
+    public:
+      /**
+       * Constructor. Parse the expressions with SymEngine, substitute the
+       * constants, and compile the results. Throws an exception if an
+       * expression can not be parsed or compiled, e.g., because it uses a
+       * function only defined by muParser.
+       */
+      LLVMCompiledExpressions(const std::vector<std::string>      &var_names,
+                              const std::vector<std::string>      &expressions,
+                              const std::map<std::string, double> &constants)
+      {
+        SymEngine::vec_basic symbols;
+        for (const auto &name : var_names)
+          symbols.push_back(Differentiation::SD::make_symbol(name).get_RCP());
+
+        Differentiation::SD::types::substitution_map constant_values;
+        for (const auto &constant : constants)
+          Differentiation::SD::add_to_substitution_map(
+            constant_values,
+            Differentiation::SD::make_symbol(constant.first),
+            Differentiation::SD::Expression(constant.second));
+
+        for (const auto &expression : expressions)
+          {
+            const Differentiation::SD::Expression function =
+              Differentiation::SD::substitute(
+                Differentiation::SD::Expression(expression, true),
+                constant_values);
+            functions.emplace_back(
+              std::make_unique<SymEngine::LLVMDoubleVisitor>());
+            functions.back()->init(symbols,
+                                   *function.get_RCP(),
+                                   /*symbolic_cse = */ true,
+                                   /*opt_level = */ 2);
+          }
+      }
+
+      virtual double
+      evaluate(const unsigned int component,
+               const double      *variables) const override
+      {
+        AssertIndexRange(component, functions.size());
+        double value;
+        functions[component]->call(&value, variables);
+        return value;
+      }
+
+    private:
+      /**
+       * The compiled functions.
+       */
+      std::vector<std::unique_ptr<SymEngine::LLVMDoubleVisitor>> functions;
+    };
+#endif
+
+
+
     template <int dim, typename Number>
     ParserImplementation<dim, Number>::ParserImplementation()
       : initialized(false)
@@ -274,6 +346,7 @@ namespace internal
       const bool                           time_dependent)
     {
       this->parser_data.clear(); // this will reset all thread-local objects
+      this->compiled_expressions.reset();
 
       this->constants   = constants;
       this->var_names   = Utilities::split_string_list(variables, ',');
@@ -407,6 +480,33 @@ namespace internal
 #endif
     }
 
+    template <int dim, typename Number>
+    bool
+    ParserImplementation<dim, Number>::compile_expressions()
+    {
+      Assert(this->initialized == true, ExcNotInitialized());
+
+#if defined(DEAL_II_WITH_SYMENGINE) && defined(DEAL_II_SYMENGINE_WITH_LLVM)
+      try
+        {
+          this->compiled_expressions =
+            std::make_unique<LLVMCompiledExpressions>(this->var_names,
+                                                      this->expressions,
+                                                      this->constants);
+        }
+      catch (const std::exception &)
+        {
+          // the expressions use a syntax or functions that SymEngine does
+          // not understand, keep evaluating them with muParser
+          this->compiled_expressions.reset();
+        }
+#endif
+
+      return this->compiled_expressions != nullptr;
+    }
+
+
+
     template <int dim, typename Number>
     Number
     ParserImplementation<dim, Number>::do_value(const Point<dim> &p,
@@ -416,6 +516,15 @@ namespace internal
 #ifdef DEAL_II_WITH_MUPARSER
       Assert(this->initialized == true, ExcNotInitialized());
 
+      if (this->compiled_expressions != nullptr)
+        {
+          std::array<double, dim + 1> vars;
+          for (unsigned int i = 0; i < dim; ++i)
+            vars[i] = p[i];
+          vars[dim] = time;
+          return this->compiled_expressions->evaluate(component, vars.data());
+        }
+
       // initialize the parser if that hasn't happened yet on the current
       // thread
       internal::FunctionParser::ParserData &data = this->parser_data.get();
@@ -464,6 +573,20 @@ namespace internal
 #ifdef DEAL_II_WITH_MUPARSER
       Assert(this->initialized == true, ExcNotInitialized());
 
+      if (this->compiled_expressions != nullptr)
+        {
+          std::array<double, dim + 1> vars;
+          for (unsigned int i = 0; i < dim; ++i)
+            vars[i] = p[i];
+          vars[dim] = time;
+          AssertDimension(values.size(), this->expressions.size());
+          for (unsigned int component = 0; component < values.size();
+               ++component)
+            values[component] =
+              this->compiled_expressions->evaluate(component, vars.data());
+          return;
+        }
+
       // initialize the parser if that hasn't happened yet on the current
       // thread
       internal::FunctionParser::ParserData &data = this->parser_data.get();
@@ -26,6 +26,14 @@
 #  else
 #    include <tbb/task_scheduler_init.h>
 #  endif
+#  include <tbb/task_scheduler_observer.h>
+#endif
+
+#if defined(DEAL_II_WITH_TBB) && defined(__linux__)
+#  include <sched.h>
+
+#  include <atomic>
+#  include <vector>
 #endif
 
 
@@ -160,6 +168,64 @@ MultithreadInfo::initialize_multithreading()
 
 
 
+#if defined(DEAL_II_WITH_TBB) && defined(__linux__)
+namespace
+{
+  /**
+   * An observer that pins every thread entering the TBB scheduler to the
+   * next core in the affinity mask of the process.
+   */
+  class ThreadPinningObserver : public tbb::task_scheduler_observer
+  {
+  public:
+    ThreadPinningObserver()
+      : next_slot(0)
+    {
+      cpu_set_t mask;
+      CPU_ZERO(&mask);
+      if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+          if (CPU_ISSET(cpu, &mask))
+            cpus.push_back(cpu);
+    }
+
+    void
+    on_scheduler_entry(bool) override
+    {
+      if (cpus.empty() || pinned_thread)
+        return;
+
+      cpu_set_t mask;
+      CPU_ZERO(&mask);
+      CPU_SET(cpus[next_slot++ % cpus.size()], &mask);
+      sched_setaffinity(0, sizeof(mask), &mask);
+      pinned_thread = true;
+    }
+
+  private:
+    std::vector<int>          cpus;
+    std::atomic<unsigned int> next_slot;
+
+    static thread_local bool pinned_thread;
+  };
+
+  thread_local bool ThreadPinningObserver::pinned_thread = false;
+} // namespace
+#endif
+
+
+
+void
+MultithreadInfo::pin_threads()
+{
+#if defined(DEAL_II_WITH_TBB) && defined(__linux__)
+  static ThreadPinningObserver observer;
+  observer.observe(true);
+#endif
+}
+
+
+
 #ifdef DEAL_II_WITH_TASKFLOW
 tf::Executor &
 MultithreadInfo::get_taskflow_executor()
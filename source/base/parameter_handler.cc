@@ -29,13 +29,16 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <type_traits>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -608,15 +611,24 @@ namespace
   // (i.e. we have just read an XML file that has entries that weren't
   // declared in the ParameterHandler object); if so, copy the value of these
   // nodes into the destination object
+  //
+  // The names of the nodes in the 'source' tree are mangled if
+  // 'names_are_mangled' is true (as in XML files written by
+  // ParameterHandler::print_parameters()), and plain otherwise.
   void
   read_xml_recursively(
     const boost::property_tree::ptree &source,
     const std::string                 &current_path,
     const char                         path_separator,
     const std::vector<std::unique_ptr<const Patterns::PatternBase>> &patterns,
+    const bool        names_are_mangled,
     const bool        skip_undefined,
     ParameterHandler &prm)
   {
+    const auto plain_name = [names_are_mangled](const std::string &s) {
+      return names_are_mangled ? demangle(s) : s;
+    };
+
     for (const auto &p : source)
       {
         // a sub-tree must either be a parameter node or a subsection
@@ -627,7 +639,7 @@ namespace
               {
                 try
                   {
-                    prm.set(demangle(p.first), p.second.data());
+                    prm.set(plain_name(p.first), p.second.data());
                   }
                 catch (const ParameterHandler::ExcEntryUndeclared &)
                   {
@@ -635,7 +647,7 @@ namespace
                   }
               }
             else
-              prm.set(demangle(p.first), p.second.data());
+              prm.set(plain_name(p.first), p.second.data());
           }
         else if (p.second.get_optional<std::string>("value"))
           {
@@ -644,7 +656,7 @@ namespace
               {
                 try
                   {
-                    prm.set(demangle(p.first),
+                    prm.set(plain_name(p.first),
                             p.second.get<std::string>("value"));
                   }
                 catch (const ParameterHandler::ExcEntryUndeclared &)
@@ -653,7 +665,7 @@ namespace
                   }
               }
             else
-              prm.set(demangle(p.first), p.second.get<std::string>("value"));
+              prm.set(plain_name(p.first), p.second.get<std::string>("value"));
 
             // this node might have sub-nodes in addition to "value", such as
             // "default_value", "documentation", etc. we might at some point
@@ -671,7 +683,7 @@ namespace
             try
               {
                 // it must be a subsection
-                prm.enter_subsection(demangle(p.first), !skip_undefined);
+                prm.enter_subsection(plain_name(p.first), !skip_undefined);
                 read_xml_recursively(p.second,
                                      (current_path.empty() ?
                                         p.first :
@@ -679,6 +691,7 @@ namespace
                                           p.first),
                                      path_separator,
                                      patterns,
+                                     names_are_mangled,
                                      skip_undefined,
                                      prm);
                 prm.leave_subsection();
@@ -790,8 +803,13 @@ ParameterHandler::parse_input_from_xml(std::istream &in,
   const boost::property_tree::ptree &my_entries =
     single_node_tree.get_child("ParameterHandler");
 
-  read_xml_recursively(
-    my_entries, "", path_separator, patterns, skip_undefined, *this);
+  read_xml_recursively(my_entries,
+                       "",
+                       path_separator,
+                       patterns,
+                       true /*names_are_mangled*/,
+                       skip_undefined,
+                       *this);
 }
 
 
@@ -819,14 +837,15 @@ ParameterHandler::parse_input_from_json(std::istream &in,
     }
 
   // The xml function is reused to read in the xml into the parameter file.
-  // This function can only read mangled files. Therefore, we create a mangeled
-  // tree first.
-  boost::property_tree::ptree node_tree_mangled;
-  recursively_mangle_or_demangle(node_tree,
-                                 node_tree_mangled,
-                                 true /*do_mangle*/);
-  read_xml_recursively(
-    node_tree_mangled, "", path_separator, patterns, skip_undefined, *this);
+  // The names in a JSON file are not mangled, so we let the function use
+  // them as they are rather than creating a mangled copy of the whole tree.
+  read_xml_recursively(node_tree,
+                       "",
+                       path_separator,
+                       patterns,
+                       false /*names_are_mangled*/,
+                       skip_undefined,
+                       *this);
 }
 
 
@@ -1208,34 +1227,182 @@ ParameterHandler::get_bool(
 
 
 
+ParameterHandler::Snapshot
+ParameterHandler::create_snapshot() const
+{
+  return Snapshot(*this);
+}
+
+
+
+namespace
+{
+  // Convert the string @p s, apart from leading and trailing spaces, to a
+  // number in the same way as Utilities::string_to_int() and
+  // Utilities::string_to_double() do, but return whether the conversion
+  // succeeded instead of throwing an exception.
+  template <typename NumberType>
+  bool
+  convert_to_number(const std::string &s, NumberType &value)
+  {
+    const std::size_t begin = s.find_first_not_of(' ');
+    if (begin == std::string::npos)
+      return false;
+    const std::string trimmed =
+      s.substr(begin, s.find_last_not_of(' ') + 1 - begin);
+
+    char *end;
+    errno = 0;
+    if constexpr (std::is_integral_v<NumberType>)
+      value = static_cast<int>(std::strtol(trimmed.c_str(), &end, 10));
+    else
+      value = std::strtod(trimmed.c_str(), &end);
+    return errno == 0 && *end == '\0';
+  }
+} // namespace
+
+
+
+ParameterHandler::Snapshot::Snapshot(const ParameterHandler &prm)
+{
+  // Collect all entries of the tree, and the aliases together with the
+  // paths of the entries they refer to
+  std::vector<std::pair<std::string, std::string>> aliases;
+  const std::function<void(const boost::property_tree::ptree &,
+                           const std::string &)>
+    collect_entries = [&](const boost::property_tree::ptree &tree,
+                          const std::string                 &path) {
+      for (const auto &p : tree)
+        {
+          const std::string prefix = path.empty() ? "" : path + path_separator;
+          if (is_parameter_node(p.second))
+            {
+              Entry entry;
+              entry.name  = demangle(prefix + p.first);
+              entry.value = p.second.get<std::string>("value");
+              entry.is_integer =
+                convert_to_number(entry.value, entry.integer_value);
+              entry.is_double =
+                convert_to_number(entry.value, entry.double_value);
+              entry.is_bool =
+                (entry.value == "true" || entry.value == "yes" ||
+                 entry.value == "false" || entry.value == "no");
+              entry.bool_value =
+                (entry.value == "true" || entry.value == "yes");
+
+              entry_indices.emplace(prefix + p.first, entries.size());
+              entries.push_back(std::move(entry));
+            }
+          else if (is_alias_node(p.second))
+            aliases.emplace_back(prefix + p.first,
+                                 prefix +
+                                   mangle(p.second.get<std::string>("alias")));
+          else
+            collect_entries(p.second, prefix + p.first);
+        }
+    };
+  collect_entries(*prm.entries, "");
+
+  for (const auto &alias : aliases)
+    {
+      const auto entry = entry_indices.find(alias.second);
+      if (entry != entry_indices.end())
+        entry_indices.emplace(alias.first, entry->second);
+    }
+}
+
+
+
+unsigned int
+ParameterHandler::Snapshot::entry_index(
+  const std::vector<std::string> &entry_subsection_path,
+  const std::string              &entry_string) const
+{
+  std::string path = collate_path_string(path_separator, entry_subsection_path);
+  if (path.empty() == false)
+    path += path_separator;
+  path += mangle(entry_string);
+
+  const auto entry = entry_indices.find(path);
+  AssertThrow(entry != entry_indices.end(),
+              ExcEntryUndeclared(demangle(path)));
+  return entry->second;
+}
+
+
+
+const std::string &
+ParameterHandler::Snapshot::get(
+  const std::vector<std::string> &entry_subsection_path,
+  const std::string              &entry_string) const
+{
+  return get(entry_index(entry_subsection_path, entry_string));
+}
+
+
+
+long int
+ParameterHandler::Snapshot::get_integer(
+  const std::vector<std::string> &entry_subsection_path,
+  const std::string              &entry_string) const
+{
+  return get_integer(entry_index(entry_subsection_path, entry_string));
+}
+
+
+
+double
+ParameterHandler::Snapshot::get_double(
+  const std::vector<std::string> &entry_subsection_path,
+  const std::string              &entry_string) const
+{
+  return get_double(entry_index(entry_subsection_path, entry_string));
+}
+
+
+
+bool
+ParameterHandler::Snapshot::get_bool(
+  const std::vector<std::string> &entry_subsection_path,
+  const std::string              &entry_string) const
+{
+  return get_bool(entry_index(entry_subsection_path, entry_string));
+}
+
+
+
 void
 ParameterHandler::set(const std::string &entry_string,
                       const std::string &new_value)
 {
-  // resolve aliases before looking up the correct entry
+  // resolve aliases before looking up the correct entry. we look up the
+  // node of the entry only once and then access its children directly,
+  // rather than walking down the full path for every one of them
   std::string path = get_current_full_path(entry_string);
-  if (entries->get_optional<std::string>(path + path_separator + "alias"))
-    path = get_current_full_path(
-      entries->get<std::string>(path + path_separator + "alias"));
+  boost::optional<boost::property_tree::ptree &> node =
+    entries->get_child_optional(path);
+  if (node && node->get_optional<std::string>("alias"))
+    {
+      path = get_current_full_path(node->get<std::string>("alias"));
+      node = entries->get_child_optional(path);
+    }
 
-  // get the node for the entry. if it doesn't exist, then we end up
-  // in the else-branch below, which asserts that the entry is indeed
-  // declared
-  if (entries->get_optional<std::string>(path + path_separator + "value"))
+  // if the node for the entry doesn't exist, then we end up in the
+  // else-branch below, which asserts that the entry is indeed declared
+  if (node && node->get_optional<std::string>("value"))
     {
+      boost::property_tree::ptree &entry = *node;
+
       // verify that the new value satisfies the provided pattern
-      const unsigned int pattern_index =
-        entries->get<unsigned int>(path + path_separator + "pattern");
+      const unsigned int pattern_index = entry.get<unsigned int>("pattern");
       AssertThrow(patterns[pattern_index]->match(new_value),
-                  ExcValueDoesNotMatchPattern(new_value,
-                                              entries->get<std::string>(
-                                                path + path_separator +
-                                                "pattern_description")));
+                  ExcValueDoesNotMatchPattern(
+                    new_value, entry.get<std::string>("pattern_description")));
 
       // then also execute the actions associated with this
       // parameter (if any have been provided)
       const boost::optional<std::string> action_indices_as_string =
-        entries->get_optional<std::string>(path + path_separator + "actions");
+        entry.get_optional<std::string>("actions");
       if (action_indices_as_string)
         {
           std::vector<int> action_indices = Utilities::string_to_int(
@@ -1246,7 +1413,7 @@ ParameterHandler::set(const std::string &entry_string,
         }
 
       // finally write the new value into the database
-      entries->put(path + path_separator + "value", new_value);
+      entry.put("value", new_value);
 
       auto map_iter = entries_set_status.find(path);
       if (map_iter != entries_set_status.end())
@@ -160,6 +160,15 @@ namespace Functions
 
 
 
+  template <int dim>
+  bool
+  ParsedFunction<dim>::compile_expressions()
+  {
+    return function_object.compile_expressions();
+  }
+
+
+
   template <int dim>
   void
   ParsedFunction<dim>::vector_value(const Point<dim> &p,
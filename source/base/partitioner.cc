@@ -183,6 +183,32 @@ namespace Utilities
     void
     Partitioner::set_ghost_indices(const IndexSet &ghost_indices_in,
                                    const IndexSet &larger_ghost_index_set)
+    {
+      set_ghost_indices_and_owners(ghost_indices_in,
+                                   nullptr,
+                                   larger_ghost_index_set);
+    }
+
+
+
+    void
+    Partitioner::set_ghost_indices(
+      const IndexSet                  &ghost_indices_in,
+      const std::vector<unsigned int> &ghost_owners,
+      const IndexSet                  &larger_ghost_index_set)
+    {
+      set_ghost_indices_and_owners(ghost_indices_in,
+                                   &ghost_owners,
+                                   larger_ghost_index_set);
+    }
+
+
+
+    void
+    Partitioner::set_ghost_indices_and_owners(
+      const IndexSet                  &ghost_indices_in,
+      const std::vector<unsigned int> *ghost_owners,
+      const IndexSet                  &larger_ghost_index_set)
     {
       // Set ghost indices from input. To be sure that no entries from the
       // locally owned range are present, subtract the locally owned indices
@@ -265,23 +291,80 @@ namespace Utilities
       std::vector<unsigned int> owning_ranks_of_ghosts(
         ghost_indices_data.n_elements());
 
-      // set up dictionary
-      internal::ComputeIndexOwner::ConsensusAlgorithmsPayload process(
-        locally_owned_range_data,
-        ghost_indices_data,
-        communicator,
-        owning_ranks_of_ghosts,
-        /* track origins of ghosts*/ true);
-
-      // read dictionary by communicating with the process who owns the index
-      // in the static partition (i.e. in the dictionary). This process
-      // returns the actual owner of the index.
-      ConsensusAlgorithms::Selector<
-        std::vector<
-          std::pair<types::global_dof_index, types::global_dof_index>>,
-        std::vector<unsigned int>>
-        consensus_algorithm;
-      consensus_algorithm.run(process, communicator);
+      // the indices of the locally owned range that other processes want to
+      // import from us, sorted by the requesting process
+      std::map<unsigned int, IndexSet> import_data;
+
+      if (ghost_owners == nullptr)
+        {
+          // set up dictionary
+          internal::ComputeIndexOwner::ConsensusAlgorithmsPayload process(
+            locally_owned_range_data,
+            ghost_indices_data,
+            communicator,
+            owning_ranks_of_ghosts,
+            /* track origins of ghosts*/ true);
+
+          // read dictionary by communicating with the process who owns the
+          // index in the static partition (i.e. in the dictionary). This
+          // process returns the actual owner of the index.
+          ConsensusAlgorithms::Selector<
+            std::vector<
+              std::pair<types::global_dof_index, types::global_dof_index>>,
+            std::vector<unsigned int>>
+            consensus_algorithm;
+          consensus_algorithm.run(process, communicator);
+
+          // find how much the individual processes that want import from me
+          import_data = process.get_requesters();
+        }
+      else
+        {
+          AssertDimension(ghost_owners->size(),
+                          ghost_indices_data.n_elements());
+          owning_ranks_of_ghosts = *ghost_owners;
+
+          // The owners are known, so we only need to send the ghost indices
+          // to their owners, collected as ranges of consecutive indices, to
+          // inform them about the indices they need to send to us.
+          using RequestType = std::vector<
+            std::pair<types::global_dof_index, types::global_dof_index>>;
+          std::map<unsigned int, RequestType> requests;
+          {
+            unsigned int i = 0;
+            for (const types::global_dof_index index : ghost_indices_data)
+              {
+                const unsigned int owner = owning_ranks_of_ghosts[i++];
+                AssertIndexRange(owner, n_procs);
+                Assert(owner != my_pid, ExcInternalError());
+
+                RequestType &ranges = requests[owner];
+                if (ranges.empty() == false && ranges.back().second == index)
+                  ++ranges.back().second;
+                else
+                  ranges.emplace_back(index, index + 1);
+              }
+          }
+
+          std::vector<unsigned int> targets;
+          targets.reserve(requests.size());
+          for (const auto &rank_and_ranges : requests)
+            targets.push_back(rank_and_ranges.first);
+
+          ConsensusAlgorithms::selector<RequestType>(
+            targets,
+            [&](const unsigned int other_rank) {
+              return requests[other_rank];
+            },
+            [&](const unsigned int other_rank, const RequestType &ranges) {
+              IndexSet &indices = import_data[other_rank];
+              indices.set_size(locally_owned_range_data.size());
+              for (const auto &range : ranges)
+                indices.add_range(range.first, range.second);
+              indices.compress();
+            },
+            communicator);
+        }
 
       {
         ghost_targets_data = {};
@@ -303,9 +386,6 @@ namespace Utilities
           }
       }
 
-      // find how much the individual processes that want import from me
-      std::map<unsigned int, IndexSet> import_data = process.get_requesters();
-
       // count import requests and set up the compressed indices
       n_import_indices_data = 0;
       import_targets_data   = {};
@@ -389,6 +469,8 @@ namespace Utilities
 
 #    endif
 
+#  else
+      (void)ghost_owners;
 #  endif // #ifdef DEAL_II_WITH_MPI
 
       if (larger_ghost_index_set.size() == 0)
@@ -513,6 +595,8 @@ namespace Utilities
       memory += sizeof(import_indices_plain_dev) +
                 sizeof(*import_indices_plain_dev.begin()) *
                   import_indices_plain_dev.capacity();
+      memory += sizeof(import_indices_all_plain_dev) +
+                sizeof(unsigned int) * import_indices_all_plain_dev.size();
       memory += MemoryConsumption::memory_consumption(n_import_indices_data);
       memory += MemoryConsumption::memory_consumption(import_targets_data);
       memory += MemoryConsumption::memory_consumption(
@@ -537,6 +621,8 @@ namespace Utilities
     {
       const unsigned int n_import_targets = import_targets_data.size();
       import_indices_plain_dev.reserve(n_import_targets);
+      std::vector<unsigned int> import_indices_all_plain_host;
+      import_indices_all_plain_host.reserve(n_import_indices_data);
       for (unsigned int i = 0; i < n_import_targets; ++i)
         {
           // Expand the indices on the host
@@ -562,7 +648,21 @@ namespace Utilities
           Kokkos::deep_copy(import_indices_plain_dev.back(),
                             Kokkos::View<unsigned int *, Kokkos::HostSpace>(
                               import_indices_plain_host.data(), chunk_size));
+          import_indices_all_plain_host.insert(
+            import_indices_all_plain_host.end(),
+            import_indices_plain_host.begin(),
+            import_indices_plain_host.end());
         }
+
+      AssertDimension(import_indices_all_plain_host.size(),
+                      n_import_indices_data);
+      import_indices_all_plain_dev =
+        Kokkos::View<unsigned int *, MemorySpace::Default::kokkos_space>(
+          "import_indices_all_plain_dev", import_indices_all_plain_host.size());
+      Kokkos::deep_copy(import_indices_all_plain_dev,
+                        Kokkos::View<unsigned int *, Kokkos::HostSpace>(
+                          import_indices_all_plain_host.data(),
+                          import_indices_all_plain_host.size()));
     }
 
   } // namespace MPI
@@ -14,6 +14,7 @@
 
 #include <deal.II/base/derivative_form.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/lazy.h>
 #include <deal.II/base/polynomials_barycentric.h>
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/tensor_product_polynomials.h>
@@ -21,6 +22,9 @@
 #include <deal.II/grid/reference_cell.h>
 #include <deal.II/grid/tria_orientation.h>
 
+#include <utility>
+#include <vector>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -332,6 +336,33 @@ namespace internal
 
         return std::make_pair(final_subface_no, final_ref_case);
       }
+
+
+
+      // Key into the tables of projected quadrature formulas: the kind of the
+      // reference cell, together with the number of points, the coordinates
+      // of all points, and the weights of all quadrature formulas in the
+      // collection.
+      using ProjectionKey = std::pair<unsigned int, std::vector<double>>;
+
+      template <int dim>
+      ProjectionKey
+      make_projection_key(const ReferenceCell        &reference_cell,
+                          const hp::QCollection<dim> &quadrature)
+      {
+        std::vector<double> data;
+        for (unsigned int i = 0; i < quadrature.size(); ++i)
+          {
+            data.push_back(quadrature[i].size());
+            for (unsigned int q = 0; q < quadrature[i].size(); ++q)
+              {
+                for (unsigned int d = 0; d < dim; ++d)
+                  data.push_back(quadrature[i].point(q)[d]);
+                data.push_back(quadrature[i].weight(q));
+              }
+          }
+        return {static_cast<std::uint8_t>(reference_cell), std::move(data)};
+      }
     } // namespace
   }   // namespace QProjector
 } // namespace internal
@@ -1711,6 +1742,37 @@ QProjector<dim>::project_to_subface(const ReferenceCell &reference_cell,
 }
 
 
+template <int dim>
+std::shared_ptr<const Quadrature<dim>>
+QProjector<dim>::project_to_all_faces_shared(
+  const ReferenceCell            &reference_cell,
+  const hp::QCollection<dim - 1> &quadrature)
+{
+  static LazyRegistry<internal::QProjector::ProjectionKey, Quadrature<dim>>
+    registry(/* release_unused_objects = */ true);
+  return registry.get_or_create(
+    internal::QProjector::make_projection_key(reference_cell, quadrature),
+    [&]() { return project_to_all_faces(reference_cell, quadrature); });
+}
+
+
+
+template <int dim>
+std::shared_ptr<const Quadrature<dim>>
+QProjector<dim>::project_to_all_subfaces_shared(
+  const ReferenceCell &reference_cell,
+  const SubQuadrature &quadrature)
+{
+  static LazyRegistry<internal::QProjector::ProjectionKey, Quadrature<dim>>
+    registry(/* release_unused_objects = */ true);
+  return registry.get_or_create(
+    internal::QProjector::make_projection_key(
+      reference_cell, hp::QCollection<dim - 1>(quadrature)),
+    [&]() { return project_to_all_subfaces(reference_cell, quadrature); });
+}
+
+
+
 // explicit instantiations; note: we need them all for all dimensions
 template class QProjector<1>;
 template class QProjector<2>;
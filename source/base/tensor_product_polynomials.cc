@@ -632,6 +632,81 @@ TensorProductPolynomials<dim, PolynomialType>::evaluate(
 
 
 
+template <int dim, typename PolynomialType>
+void
+TensorProductPolynomials<dim, PolynomialType>::vectorized_evaluate(
+  const Point<dim, VectorizedArray<double>>            &p,
+  std::vector<VectorizedArray<double>>                 &values,
+  std::vector<Tensor<1, dim, VectorizedArray<double>>> &grads) const
+{
+  Assert(values.size() == this->n() || values.empty(),
+         ExcDimensionMismatch2(values.size(), this->n(), 0));
+  Assert(grads.size() == this->n() || grads.empty(),
+         ExcDimensionMismatch2(grads.size(), this->n(), 0));
+
+  const bool         update_values = (values.size() == this->n());
+  const bool         update_grads  = (grads.size() == this->n());
+  const unsigned int n_derivatives = update_grads ? 1 : 0;
+  if (update_values == false && update_grads == false)
+    return;
+
+  // Compute the values and first derivatives of all 1d polynomials at the
+  // batch of points. For the polynomials in Lagrange product form or with
+  // plain coefficients, values_of_array() evaluates all dimensions and
+  // lanes at once with SIMD arithmetic; other polynomial types get
+  // evaluated lane by lane.
+  using VectorizedArrayType = VectorizedArray<double>;
+  const unsigned int n_polynomials = polynomials.size();
+  boost::container::small_vector<ndarray<VectorizedArrayType, 2, dim>, 10>
+    values_1d(n_polynomials);
+  if constexpr (std::is_same_v<PolynomialType,
+                               dealii::Polynomials::Polynomial<double>>)
+    {
+      std::array<VectorizedArrayType, dim> point_array;
+      for (unsigned int d = 0; d < dim; ++d)
+        point_array[d] = p[d];
+      for (unsigned int i = 0; i < n_polynomials; ++i)
+        polynomials[i].values_of_array(point_array,
+                                       n_derivatives,
+                                       values_1d[i].data());
+    }
+  else
+    for (unsigned int i = 0; i < n_polynomials; ++i)
+      for (unsigned int d = 0; d < dim; ++d)
+        for (unsigned int v = 0; v < VectorizedArrayType::size(); ++v)
+          {
+            std::array<double, 2> derivatives;
+            polynomials[i].value(p[d][v], n_derivatives, derivatives.data());
+            for (unsigned int j = 0; j <= n_derivatives; ++j)
+              values_1d[i][j][d][v] = derivatives[j];
+          }
+
+  std::array<unsigned int, dim> indices;
+  for (unsigned int i = 0; i < this->n(); ++i)
+    {
+      compute_index(i, indices);
+
+      if (update_values)
+        {
+          VectorizedArrayType value = 1.;
+          for (unsigned int d = 0; d < dim; ++d)
+            value *= values_1d[indices[d]][0][d];
+          values[i] = value;
+        }
+
+      if (update_grads)
+        for (unsigned int d = 0; d < dim; ++d)
+          {
+            VectorizedArrayType grad = 1.;
+            for (unsigned int e = 0; e < dim; ++e)
+              grad *= values_1d[indices[e]][(d == e) ? 1 : 0][e];
+            grads[i][d] = grad;
+          }
+    }
+}
+
+
+
 template <>
 void
 TensorProductPolynomials<0, Polynomials::Polynomial<double>>::evaluate(
@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/time_stepping.templates.h>
 
 #include <deal.II/lac/block_vector.h>
@@ -29,5 +30,39 @@ DEAL_II_NAMESPACE_OPEN
 namespace TimeStepping
 {
 #include "time_stepping.inst"
-}
+
+
+  std::pair<MPI_Comm, MPI_Comm>
+  split_communicator_for_parallel_in_time(const MPI_Comm     communicator,
+                                          const unsigned int n_time_slices)
+  {
+#ifdef DEAL_II_WITH_MPI
+    const unsigned int n_processes =
+      Utilities::MPI::n_mpi_processes(communicator);
+    const unsigned int rank = Utilities::MPI::this_mpi_process(communicator);
+    AssertThrow(n_time_slices > 0 && n_processes % n_time_slices == 0,
+                ExcMessage("The number of processes must be divisible by the "
+                           "number of time slices."));
+    const unsigned int n_processes_per_slice = n_processes / n_time_slices;
+
+    MPI_Comm space_communicator, time_communicator;
+
+    int ierr = MPI_Comm_split(communicator,
+                              rank / n_processes_per_slice,
+                              rank,
+                              &space_communicator);
+    AssertThrowMPI(ierr);
+    ierr = MPI_Comm_split(communicator,
+                          rank % n_processes_per_slice,
+                          rank,
+                          &time_communicator);
+    AssertThrowMPI(ierr);
+
+    return {space_communicator, time_communicator};
+#else
+    AssertDimension(n_time_slices, 1);
+    return {communicator, communicator};
+#endif
+  }
+} // namespace TimeStepping
 DEAL_II_NAMESPACE_CLOSE
@@ -37,6 +37,10 @@
 #  include <windows.h>
 #endif
 
+#ifdef DEAL_II_WITH_PAPI
+#  include <papi.h>
+#endif
+
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -100,6 +104,44 @@ namespace internal
         data.min_index = numbers::invalid_unsigned_int;
         data.max_index = numbers::invalid_unsigned_int;
       }
+
+      /**
+       * Read the current values of the hardware counters of the given PAPI
+       * event set.
+       */
+      void
+      read_hardware_counters(const int                   event_set,
+                             std::vector<long long int> &values)
+      {
+#ifdef DEAL_II_WITH_PAPI
+        const int ierr = PAPI_read(event_set, values.data());
+        AssertThrow(ierr == PAPI_OK,
+                    ExcMessage(std::string("Reading the hardware counters "
+                                           "failed with the PAPI error: ") +
+                               PAPI_strerror(ierr)));
+#else
+        (void)event_set;
+        (void)values;
+        DEAL_II_ASSERT_UNREACHABLE();
+#endif
+      }
+
+#ifdef DEAL_II_WITH_PAPI
+      /**
+       * Stop and destroy the given PAPI event set, if any.
+       */
+      void
+      destroy_event_set(int &event_set)
+      {
+        if (event_set != PAPI_NULL)
+          {
+            PAPI_stop(event_set, nullptr);
+            PAPI_cleanup_eventset(event_set);
+            PAPI_destroy_eventset(&event_set);
+            event_set = PAPI_NULL;
+          }
+      }
+#endif
     } // namespace
   }   // namespace TimerImplementation
 } // namespace internal
@@ -304,6 +346,7 @@ TimerOutput::TimerOutput(std::ostream         &stream,
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
+  , hardware_counter_event_set(-1)
 {}
 
 
@@ -316,6 +359,7 @@ TimerOutput::TimerOutput(ConditionalOStream   &stream,
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(MPI_COMM_SELF)
+  , hardware_counter_event_set(-1)
 {}
 
 
@@ -329,6 +373,7 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
   , out_stream(stream, true)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
+  , hardware_counter_event_set(-1)
 {}
 
 
@@ -342,6 +387,7 @@ TimerOutput::TimerOutput(const MPI_Comm        mpi_communicator,
   , out_stream(stream)
   , output_is_enabled(true)
   , mpi_communicator(mpi_communicator)
+  , hardware_counter_event_set(-1)
 {}
 
 
@@ -393,6 +439,10 @@ TimerOutput::~TimerOutput()
 #else
   do_exit();
 #endif
+
+#ifdef DEAL_II_WITH_PAPI
+  internal::TimerImplementation::destroy_event_set(hardware_counter_event_set);
+#endif
 }
 
 
@@ -434,6 +484,15 @@ TimerOutput::enter_subsection(const std::string &section_name)
   sections[section_name].timer.start();
   ++sections[section_name].n_calls;
 
+  if (hardware_counter_names.empty() == false)
+    {
+      Section &section = sections[section_name];
+      section.counter_start.resize(hardware_counter_names.size());
+      section.total_counters.resize(hardware_counter_names.size(), 0);
+      internal::TimerImplementation::read_hardware_counters(
+        hardware_counter_event_set, section.counter_start);
+    }
+
   active_sections.push_back(section_name);
 }
 
@@ -466,6 +525,16 @@ TimerOutput::leave_subsection(const std::string &section_name)
   sections[actual_section_name].total_wall_time +=
     sections[actual_section_name].timer.last_wall_time();
 
+  if (hardware_counter_names.empty() == false)
+    {
+      Section                   &section = sections[actual_section_name];
+      std::vector<long long int> counters(hardware_counter_names.size());
+      internal::TimerImplementation::read_hardware_counters(
+        hardware_counter_event_set, counters);
+      for (unsigned int c = 0; c < counters.size(); ++c)
+        section.total_counters[c] += counters[c] - section.counter_start[c];
+    }
+
   // Get cpu time. On MPI systems, if constructed with an mpi_communicator
   // like MPI_COMM_WORLD, then the Timer will sum up the CPU time between
   // processors among the provided mpi_communicator. Therefore, no
@@ -1010,6 +1079,131 @@ TimerOutput::print_wall_time_statistics(const MPI_Comm mpi_comm,
                << (n_ranks > 1 && quantile > 0. ? time_rank_column : "")
                << time_rank_column << '\n';
   }
+
+  // in case we want to write out the hardware counters
+  if (hardware_counter_names.empty() == false)
+    {
+      AssertDimension(hardware_counter_names.size(),
+                      Utilities::MPI::max(hardware_counter_names.size(),
+                                          mpi_comm));
+
+      const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(mpi_comm);
+
+      unsigned int counter_width = 16;
+      for (const auto &name : hardware_counter_names)
+        counter_width =
+          std::max(counter_width, static_cast<unsigned int>(name.size()));
+
+      const std::string separator =
+        "+" + std::string(max_width + 1, '-') + "+" +
+        std::string(counter_width + 2, '-') +
+        "+------------------+------------+------------------+------------+\n";
+
+      const auto print_count = [&](const double value) {
+        out_stream << std::setw(10) << std::setprecision(4) << std::right
+                   << value;
+      };
+      const auto print_rank = [&](const unsigned int rank) {
+        out_stream << std::setw(5) << std::right << rank
+                   << (n_ranks > 99999 ? "" : " ") << "|";
+      };
+
+      out_stream << '\n'
+                 << separator << "| Section" << std::string(max_width - 7, ' ')
+                 << "| Hardware counter" << std::string(counter_width - 16, ' ')
+                 << " |   min count rank |  avg count |   max count rank "
+                 << "| avg rate/s |\n"
+                 << separator;
+      for (const auto &i : sections)
+        for (unsigned int c = 0; c < hardware_counter_names.size(); ++c)
+          {
+            std::string name_out = c == 0 ? i.first : std::string();
+
+            unsigned int pos_non_space = name_out.find_first_not_of(' ');
+            name_out.erase(0, pos_non_space);
+            name_out.resize(max_width, ' ');
+            std::string counter_out = hardware_counter_names[c];
+            counter_out.resize(counter_width, ' ');
+            out_stream << "| " << name_out << "| " << counter_out << " |";
+
+            const double count =
+              i.second.total_counters.empty() ?
+                0. :
+                static_cast<double>(i.second.total_counters[c]);
+            const Utilities::MPI::MinMaxAvg data =
+              Utilities::MPI::min_max_avg(count, mpi_comm);
+            const double rate =
+              Utilities::MPI::sum(i.second.total_wall_time > 0. ?
+                                    count / i.second.total_wall_time :
+                                    0.,
+                                  mpi_comm) /
+              n_ranks;
+
+            print_count(data.min);
+            out_stream << " ";
+            print_rank(data.min_index);
+            print_count(data.avg);
+            out_stream << "  |";
+            print_count(data.max);
+            out_stream << " ";
+            print_rank(data.max_index);
+            print_count(rate);
+            out_stream << "  |\n";
+          }
+      out_stream << separator;
+    }
+}
+
+
+
+void
+TimerOutput::enable_hardware_counters(
+  const std::vector<std::string> &event_names)
+{
+#ifdef DEAL_II_WITH_PAPI
+  std::lock_guard<std::mutex> lock(mutex);
+
+  Assert(active_sections.empty(),
+         ExcMessage("Hardware counters cannot be enabled while sections "
+                    "are active."));
+
+  if (PAPI_is_initialized() == PAPI_NOT_INITED)
+    {
+      const int version = PAPI_library_init(PAPI_VER_CURRENT);
+      AssertThrow(version == PAPI_VER_CURRENT,
+                  ExcMessage("The PAPI library could not be initialized."));
+    }
+
+  internal::TimerImplementation::destroy_event_set(hardware_counter_event_set);
+  hardware_counter_names.clear();
+
+  int ierr = PAPI_create_eventset(&hardware_counter_event_set);
+  AssertThrow(ierr == PAPI_OK,
+              ExcMessage(std::string("Creating the PAPI event set failed: ") +
+                         PAPI_strerror(ierr)));
+  for (const std::string &name : event_names)
+    {
+      ierr = PAPI_add_named_event(hardware_counter_event_set, name.c_str());
+      AssertThrow(ierr == PAPI_OK,
+                  ExcMessage("The hardware counter <" + name +
+                             "> could not be added: " + PAPI_strerror(ierr)));
+    }
+  ierr = PAPI_start(hardware_counter_event_set);
+  AssertThrow(ierr == PAPI_OK,
+              ExcMessage(std::string("Starting the hardware counters "
+                                     "failed: ") +
+                         PAPI_strerror(ierr)));
+
+  hardware_counter_names = event_names;
+  for (auto &section : sections)
+    {
+      section.second.counter_start.resize(event_names.size());
+      section.second.total_counters.assign(event_names.size(), 0);
+    }
+#else
+  (void)event_names;
+  AssertThrow(false, ExcNeedsPAPI());
+#endif
 }
 
 
@@ -0,0 +1,210 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/trace.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace internal
+{
+  namespace Trace
+  {
+    std::atomic<bool> enabled(false);
+
+    namespace
+    {
+      /**
+       * A recorded event.
+       */
+      struct Event
+      {
+        const char   *name;
+        std::uint64_t start_time;
+        std::uint64_t end_time;
+        bool          is_instant;
+      };
+
+      /**
+       * The ring buffer of the events of one thread.
+       */
+      struct Buffer
+      {
+        Buffer(const unsigned int size)
+          : events(size)
+          , n_recorded(0)
+        {}
+
+        std::vector<Event> events;
+        std::uint64_t      n_recorded;
+      };
+
+      /**
+       * The buffers of all threads that have recorded events, along with
+       * the data needed to set them up.
+       */
+      struct Registry
+      {
+        std::mutex                           mutex;
+        std::vector<std::unique_ptr<Buffer>> buffers;
+        unsigned int                         buffer_size = 65536;
+        std::uint64_t                        start_time  = 0;
+
+        /**
+         * A counter increased whenever the buffers are discarded, so that
+         * the threads know that they need to register a new buffer.
+         */
+        std::atomic<unsigned int> generation{0};
+      };
+
+      Registry &
+      get_registry()
+      {
+        static Registry registry;
+        return registry;
+      }
+    } // namespace
+
+
+
+    void
+    record(const char         *name,
+           const std::uint64_t start_time,
+           const std::uint64_t end_time,
+           const bool          is_instant)
+    {
+      thread_local Buffer      *buffer            = nullptr;
+      thread_local unsigned int buffer_generation = 0;
+
+      Registry &registry = get_registry();
+      if (buffer == nullptr || buffer_generation != registry.generation.load())
+        {
+          std::lock_guard<std::mutex> lock(registry.mutex);
+          registry.buffers.push_back(
+            std::make_unique<Buffer>(registry.buffer_size));
+          buffer            = registry.buffers.back().get();
+          buffer_generation = registry.generation.load();
+        }
+
+      Event &event = buffer->events[buffer->n_recorded % buffer->events.size()];
+      event        = {name, start_time, end_time, is_instant};
+      ++buffer->n_recorded;
+    }
+  } // namespace Trace
+} // namespace internal
+
+
+
+namespace Trace
+{
+  void
+  enable(const unsigned int buffer_size)
+  {
+    Assert(buffer_size > 0, ExcMessage("The buffer size must be positive."));
+
+    auto &registry = internal::Trace::get_registry();
+    {
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      registry.buffers.clear();
+      registry.buffer_size = buffer_size;
+      registry.start_time  = internal::Trace::now();
+      ++registry.generation;
+    }
+    internal::Trace::enabled = true;
+  }
+
+
+
+  void
+  disable()
+  {
+    internal::Trace::enabled = false;
+  }
+
+
+
+  void
+  clear()
+  {
+    auto                       &registry = internal::Trace::get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffers.clear();
+    ++registry.generation;
+  }
+
+
+
+  void
+  write_chrome_trace(std::ostream &out, const unsigned int process_id)
+  {
+    auto                       &registry = internal::Trace::get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    const std::ios_base::fmtflags old_flags     = out.flags();
+    const std::streamsize         old_precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    // the trace event format expects times in microseconds
+    const auto to_microseconds = [&](const std::uint64_t time) {
+      return 1e-3 *
+             static_cast<double>(static_cast<std::int64_t>(
+               time - registry.start_time));
+    };
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (unsigned int t = 0; t < registry.buffers.size(); ++t)
+      {
+        const auto &buffer = *registry.buffers[t];
+        const std::uint64_t n_events =
+          std::min<std::uint64_t>(buffer.n_recorded, buffer.events.size());
+        for (std::uint64_t e = buffer.n_recorded - n_events;
+             e < buffer.n_recorded;
+             ++e)
+          {
+            const auto &event = buffer.events[e % buffer.events.size()];
+
+            out << (first ? "\n" : ",\n") << "{\"name\":\"";
+            for (const char *c = event.name; *c != '\0'; ++c)
+              {
+                if (*c == '"' || *c == '\\')
+                  out << '\\';
+                out << *c;
+              }
+            out << "\",\"ph\":\"" << (event.is_instant ? "i" : "X")
+                << "\",\"ts\":" << to_microseconds(event.start_time);
+            if (event.is_instant)
+              out << ",\"s\":\"t\"";
+            else
+              out << ",\"dur\":"
+                  << 1e-3 * static_cast<double>(event.end_time -
+                                                event.start_time);
+            out << ",\"pid\":" << process_id << ",\"tid\":" << t << "}";
+            first = false;
+          }
+      }
+    out << "\n]}\n";
+
+    out.flags(old_flags);
+    out.precision(old_precision);
+  }
+} // namespace Trace
+
+DEAL_II_NAMESPACE_CLOSE
@@ -948,9 +948,17 @@ namespace Utilities
             return "SSE2";
 #endif
           case 256:
+#ifdef __ARM_FEATURE_SVE_BITS
+            return "SVE256";
+#else
             return "AVX";
+#endif
           case 512:
+#ifdef __ARM_FEATURE_SVE_BITS
+            return "SVE512";
+#else
             return "AVX512";
+#endif
           default:
             AssertThrow(false,
                         ExcInternalError(
@@ -960,6 +968,26 @@ namespace Utilities
     }
 
 
+
+    unsigned int
+    get_supported_vectorization_width_in_bits()
+    {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f"))
+        return 512;
+      else if (__builtin_cpu_supports("avx"))
+        return 256;
+      else if (__builtin_cpu_supports("sse2"))
+        return 128;
+      else
+        return 0;
+#else
+      return DEAL_II_VECTORIZATION_WIDTH_IN_BITS;
+#endif
+    }
+
+
     void
     get_memory_stats(MemoryStats &stats)
     {
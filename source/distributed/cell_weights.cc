@@ -122,6 +122,52 @@ namespace parallel
 
 
 
+  template <int dim, int spacedim>
+  typename CellWeights<dim, spacedim>::WeightingFunction
+  CellWeights<dim, spacedim>::measured_cost_weighting(
+    const Vector<float> &cost_per_active_cell,
+    const float          factor)
+  {
+    return [cost_per_active_cell, factor](
+             const typename DoFHandler<dim, spacedim>::cell_iterator &cell,
+             const FiniteElement<dim, spacedim> &future_fe) -> unsigned int {
+      // Scale the measured cost of an active cell by the change of the
+      // number of degrees of freedom on it.
+      const auto scaled_cost = [&](const auto &active_cell) -> float {
+        AssertIndexRange(active_cell->active_cell_index(),
+                         cost_per_active_cell.size());
+        const unsigned int n_dofs_per_cell =
+          active_cell->get_fe().n_dofs_per_cell();
+        return (n_dofs_per_cell > 0) ?
+                 cost_per_active_cell[active_cell->active_cell_index()] *
+                   future_fe.n_dofs_per_cell() / n_dofs_per_cell :
+                 0.f;
+      };
+
+      float result = 0;
+      if (cell->is_active())
+        {
+          result = scaled_cost(cell);
+          if (cell->refine_flag_set())
+            result /= cell->reference_cell().n_isotropic_children();
+        }
+      else
+        for (const auto &child : cell->child_iterators())
+          result += scaled_cost(child);
+      result = std::trunc(factor * result);
+
+      Assert(result >= 0. &&
+               result <=
+                 static_cast<float>(std::numeric_limits<unsigned int>::max()),
+             ExcMessage(
+               "Cannot cast determined weight for this cell to unsigned int!"));
+
+      return static_cast<unsigned int>(result);
+    };
+  }
+
+
+
   // ---------- handling callback functions ----------
 
   template <int dim, int spacedim>
@@ -569,7 +569,7 @@ namespace parallel
           mpisize * sizeof(std::uint64_t) + offset;
 
         // Write buffers to file.
-        ierr = dealii::Utilities::MPI::LargeCount::File_write_at_c(
+        ierr = dealii::Utilities::MPI::LargeCount::File_write_at_all_c(
           fh,
           global_position,
           buffer.data(),
@@ -670,7 +670,7 @@ namespace parallel
 
         // Read buffers from file.
         std::vector<char> buffer(buffer_size);
-        ierr = dealii::Utilities::MPI::LargeCount::File_read_at_c(
+        ierr = dealii::Utilities::MPI::LargeCount::File_read_at_all_c(
           fh,
           global_position,
           buffer.data(),
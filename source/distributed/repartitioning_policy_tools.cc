@@ -22,6 +22,11 @@
 #include <deal.II/grid/cell_id_translator.h>
 #include <deal.II/grid/filtered_iterator.h>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -323,6 +328,159 @@ namespace RepartitioningPolicyTools
   }
 
 
+
+  template <int dim, int spacedim>
+  HilbertCurvePolicy<dim, spacedim>::HilbertCurvePolicy(
+    const std::function<
+      unsigned int(const typename Triangulation<dim, spacedim>::cell_iterator &,
+                   const CellStatus)> &weighting_function)
+    : weighting_function(weighting_function)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  LinearAlgebra::distributed::Vector<double>
+  HilbertCurvePolicy<dim, spacedim>::partition(
+    const Triangulation<dim, spacedim> &tria_in) const
+  {
+#ifndef DEAL_II_WITH_MPI
+    (void)tria_in;
+    return {};
+#else
+
+    const auto tria =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria_in);
+
+    Assert(tria, ExcNotImplemented());
+
+    const auto partitioner =
+      tria->global_active_cell_index_partitioner().lock();
+
+    const auto mpi_communicator = tria_in.get_communicator();
+    const auto n_subdomains = Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+    // collect centers and weights of the locally owned cells
+    std::vector<Point<spacedim>> centers(partitioner->locally_owned_size());
+    std::vector<unsigned int>    weights(partitioner->locally_owned_size(), 1);
+    for (const auto &cell :
+         tria->active_cell_iterators() | IteratorFilters::LocallyOwnedCell())
+      {
+        const unsigned int i =
+          partitioner->global_to_local(cell->global_active_cell_index());
+        centers[i] = cell->center();
+        if (weighting_function)
+          weights[i] = weighting_function(cell, CellStatus::cell_will_persist);
+      }
+
+    // determine the global bounding box, and from it a box with equal
+    // extent in all directions
+    std::vector<double> lower(spacedim, std::numeric_limits<double>::max());
+    std::vector<double> upper(spacedim, std::numeric_limits<double>::lowest());
+    for (const auto &p : centers)
+      for (unsigned int d = 0; d < spacedim; ++d)
+        {
+          lower[d] = std::min(lower[d], p[d]);
+          upper[d] = std::max(upper[d], p[d]);
+        }
+    Utilities::MPI::min(lower, mpi_communicator, lower);
+    Utilities::MPI::max(upper, mpi_communicator, upper);
+
+    double extent = 0;
+    for (unsigned int d = 0; d < spacedim; ++d)
+      extent = std::max(extent, upper[d] - lower[d]);
+
+    // convert the centers to integer coordinates and compute their index
+    // along the Hilbert curve, packed into a single integer
+    const int           bits_per_dim = 63 / spacedim;
+    const std::uint64_t max_int      = (std::uint64_t(1) << bits_per_dim) - 1;
+
+    std::vector<std::array<std::uint64_t, spacedim>> int_points(
+      centers.size());
+    for (unsigned int i = 0; i < centers.size(); ++i)
+      for (unsigned int d = 0; d < spacedim; ++d)
+        int_points[i][d] =
+          (extent > 0) ?
+            std::min(max_int,
+                     static_cast<std::uint64_t>((centers[i][d] - lower[d]) /
+                                                extent * max_int)) :
+            0;
+
+    const std::vector<std::array<std::uint64_t, spacedim>> hilbert_indices =
+      Utilities::inverse_Hilbert_space_filling_curve<spacedim>(int_points,
+                                                               bits_per_dim);
+
+    std::vector<std::pair<std::uint64_t, unsigned int>> keys(centers.size());
+    for (unsigned int i = 0; i < centers.size(); ++i)
+      keys[i] = {Utilities::pack_integers<spacedim>(hilbert_indices[i],
+                                                    bits_per_dim),
+                 i};
+    std::sort(keys.begin(), keys.end());
+
+    // prefix sums of the weights in the order of the local keys, such that
+    // the local weight of all cells with key less than k is given by the
+    // entry at the position of std::lower_bound(k)
+    std::vector<std::uint64_t> weight_before(keys.size() + 1, 0);
+    for (unsigned int i = 0; i < keys.size(); ++i)
+      weight_before[i + 1] = weight_before[i] + weights[keys[i].second];
+
+    const std::uint64_t total_weight =
+      Utilities::MPI::sum(weight_before.back(), mpi_communicator);
+
+    LinearAlgebra::distributed::Vector<double> partition(partitioner);
+
+    if (total_weight == 0 || n_subdomains == 1)
+      return partition;
+
+    const auto local_weight_before = [&](const std::uint64_t key) {
+      return weight_before[std::lower_bound(
+                             keys.begin(),
+                             keys.end(),
+                             std::pair<std::uint64_t, unsigned int>(key, 0)) -
+                           keys.begin()];
+    };
+
+    // Find for each process boundary k the smallest key t_k such that the
+    // weight of all cells with smaller key reaches k/n_subdomains of the
+    // total weight. Like in CellWeightPolicy, a cell then goes to the process
+    // given by its preceding weight along the curve. The bisection is done
+    // for all boundaries at once, with one reduction per step. All processes
+    // see the same bounds, so they perform the same number of steps.
+    const std::uint64_t max_key =
+      Utilities::MPI::max(keys.empty() ? std::uint64_t(0) : keys.back().first,
+                          mpi_communicator);
+    std::vector<std::uint64_t> lower_keys(n_subdomains - 1, 0);
+    std::vector<std::uint64_t> upper_keys(n_subdomains - 1, max_key + 1);
+    std::vector<std::uint64_t> weights_below(n_subdomains - 1);
+    while (lower_keys != upper_keys)
+      {
+        for (unsigned int k = 0; k < n_subdomains - 1; ++k)
+          weights_below[k] =
+            local_weight_before(lower_keys[k] +
+                                (upper_keys[k] - lower_keys[k]) / 2);
+        Utilities::MPI::sum(weights_below, mpi_communicator, weights_below);
+
+        for (unsigned int k = 0; k < n_subdomains - 1; ++k)
+          {
+            const std::uint64_t mid =
+              lower_keys[k] + (upper_keys[k] - lower_keys[k]) / 2;
+            if (weights_below[k] * n_subdomains >= (k + 1) * total_weight)
+              upper_keys[k] = mid;
+            else
+              lower_keys[k] = mid + 1;
+          }
+      }
+
+    for (const auto &[key, i] : keys)
+      partition.local_element(i) = static_cast<double>(
+        std::upper_bound(lower_keys.begin(), lower_keys.end(), key) -
+        lower_keys.begin());
+
+    return partition;
+#endif
+  }
+
 } // namespace RepartitioningPolicyTools
 
 
@@ -359,12 +359,77 @@ namespace parallel
       if (dofs_per_cell == 0)
         return std::vector<char>(); // nothing to do for FE_Nothing
 
-      auto it_input  = input_vectors.cbegin();
-      auto it_output = dof_values.begin();
-      for (; it_input != input_vectors.cend(); ++it_input, ++it_output)
+      if (status == CellStatus::children_will_be_coarsened &&
+          dof_handler->has_hp_capabilities() == false &&
+          input_vectors.size() > 1)
         {
-          it_output->reinit(dofs_per_cell);
-          cell->get_interpolated_dof_values(*(*it_input), *it_output, fe_index);
+          // The children are restricted to the parent cell in the same way
+          // as in DoFCellAccessor::get_interpolated_dof_values(), but for
+          // all vectors at once: the values of all vectors are interleaved,
+          // so that each entry of the restriction matrices is loaded once
+          // and applied to all vectors in the innermost loop, which the
+          // compiler can vectorize.
+          using Number = typename VectorType::value_type;
+
+          const FiniteElement<dim, spacedim> &fe        = dof_handler->get_fe();
+          const unsigned int                  n_vectors = input_vectors.size();
+
+          ::dealii::Vector<Number> local_values(dofs_per_cell);
+          std::vector<Number>      child_values(dofs_per_cell * n_vectors);
+          std::vector<Number>      restricted_values(dofs_per_cell * n_vectors);
+
+          for (auto &values : dof_values)
+            values.reinit(dofs_per_cell);
+
+          for (unsigned int child = 0; child < cell->n_children(); ++child)
+            {
+              for (unsigned int v = 0; v < n_vectors; ++v)
+                {
+                  cell->child(child)->get_dof_values(*input_vectors[v],
+                                                     local_values);
+                  for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                    child_values[i * n_vectors + v] = local_values(i);
+                }
+
+              const FullMatrix<double> &restriction =
+                fe.get_restriction_matrix(child, cell->refinement_case());
+              std::fill(restricted_values.begin(),
+                        restricted_values.end(),
+                        Number());
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                for (unsigned int j = 0; j < dofs_per_cell; ++j)
+                  {
+                    const double weight = restriction(i, j);
+                    if (weight != 0.)
+                      for (unsigned int v = 0; v < n_vectors; ++v)
+                        restricted_values[i * n_vectors + v] +=
+                          weight * child_values[j * n_vectors + v];
+                  }
+
+              // add up or set the values, see the discussion in
+              // DoFCellAccessor::get_interpolated_dof_values()
+              for (unsigned int i = 0; i < dofs_per_cell; ++i)
+                for (unsigned int v = 0; v < n_vectors; ++v)
+                  {
+                    const Number value = restricted_values[i * n_vectors + v];
+                    if (fe.restriction_is_additive(i))
+                      dof_values[v](i) += value;
+                    else if (value != Number())
+                      dof_values[v](i) = value;
+                  }
+            }
+        }
+      else
+        {
+          auto it_input  = input_vectors.cbegin();
+          auto it_output = dof_values.begin();
+          for (; it_input != input_vectors.cend(); ++it_input, ++it_output)
+            {
+              it_output->reinit(dofs_per_cell);
+              cell->get_interpolated_dof_values(*(*it_input),
+                                                *it_output,
+                                                fe_index);
+            }
         }
 
       return pack_dof_values<typename VectorType::value_type>(dof_values,
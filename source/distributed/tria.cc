@@ -1766,6 +1766,10 @@ namespace parallel
       , triangulation_has_content(false)
       , connectivity(nullptr)
       , parallel_forest(nullptr)
+      , repartitioning_threshold(0.)
+      , measured_work_per_cell(-1.)
+      , transfer_context_fixed(nullptr)
+      , transfer_context_sizes(nullptr)
     {
       parallel_ghost = nullptr;
     }
@@ -1924,9 +1928,26 @@ namespace parallel
         *parallel_forest,
       const typename dealii::internal::p4est::types<dim>::gloidx
         *previous_global_first_quadrant)
+    {
+      begin_transfer(parallel_forest, previous_global_first_quadrant);
+      end_transfer(parallel_forest, previous_global_first_quadrant);
+    }
+
+
+
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim, spacedim>::begin_transfer(
+      const typename dealii::internal::p4est::types<dim>::forest
+        *parallel_forest,
+      const typename dealii::internal::p4est::types<dim>::gloidx
+        *previous_global_first_quadrant)
     {
       Assert(this->data_serializer.sizes_fixed_cumulative.size() > 0,
              ExcMessage("No data has been packed!"));
+      Assert(transfer_context_fixed == nullptr &&
+               transfer_context_sizes == nullptr,
+             ExcMessage("A transfer is already in progress."));
 
       // Resize memory according to the data that we will receive.
       this->data_serializer.dest_data_fixed.resize(
@@ -1934,9 +1955,7 @@ namespace parallel
         this->data_serializer.sizes_fixed_cumulative.back());
 
       // Execute non-blocking fixed size transfer.
-      typename dealii::internal::p4est::types<dim>::transfer_context
-        *tf_context;
-      tf_context =
+      transfer_context_fixed =
         dealii::internal::p4est::functions<dim>::transfer_fixed_begin(
           parallel_forest->global_first_quadrant,
           previous_global_first_quadrant,
@@ -1952,19 +1971,36 @@ namespace parallel
           this->data_serializer.dest_sizes_variable.resize(
             parallel_forest->local_num_quadrants);
 
-          // Execute fixed size transfer of data sizes for variable size
-          // transfer.
-          dealii::internal::p4est::functions<dim>::transfer_fixed(
-            parallel_forest->global_first_quadrant,
-            previous_global_first_quadrant,
-            parallel_forest->mpicomm,
-            1,
-            this->data_serializer.dest_sizes_variable.data(),
-            this->data_serializer.src_sizes_variable.data(),
-            sizeof(unsigned int));
+          // Execute non-blocking fixed size transfer of data sizes for
+          // variable size transfer.
+          transfer_context_sizes =
+            dealii::internal::p4est::functions<dim>::transfer_fixed_begin(
+              parallel_forest->global_first_quadrant,
+              previous_global_first_quadrant,
+              parallel_forest->mpicomm,
+              1,
+              this->data_serializer.dest_sizes_variable.data(),
+              this->data_serializer.src_sizes_variable.data(),
+              sizeof(unsigned int));
         }
+    }
 
-      dealii::internal::p4est::functions<dim>::transfer_fixed_end(tf_context);
+
+
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim, spacedim>::end_transfer(
+      const typename dealii::internal::p4est::types<dim>::forest
+        *parallel_forest,
+      const typename dealii::internal::p4est::types<dim>::gloidx
+        *previous_global_first_quadrant)
+    {
+      Assert(transfer_context_fixed != nullptr,
+             ExcMessage("No transfer has been started!"));
+
+      dealii::internal::p4est::functions<dim>::transfer_fixed_end(
+        transfer_context_fixed);
+      transfer_context_fixed = nullptr;
 
       // Release memory of previously packed data.
       this->data_serializer.src_data_fixed.clear();
@@ -1972,6 +2008,11 @@ namespace parallel
 
       if (this->data_serializer.variable_size_data_stored)
         {
+          Assert(transfer_context_sizes != nullptr, ExcInternalError());
+          dealii::internal::p4est::functions<dim>::transfer_fixed_end(
+            transfer_context_sizes);
+          transfer_context_sizes = nullptr;
+
           // Resize memory according to the data that we will receive.
           this->data_serializer.dest_data_variable.resize(
             std::accumulate(this->data_serializer.dest_sizes_variable.begin(),
@@ -3421,7 +3462,16 @@ namespace parallel
                         (parallel_forest->mpisize + 1));
         }
 
-      if (!(settings & no_automatic_repartitioning))
+      // get cell weights for a weighted repartitioning, which are also
+      // needed to decide whether repartitioning is worth it.
+      const std::vector<unsigned int> cell_weights =
+        (!(settings & no_automatic_repartitioning) &&
+         !this->signals.weight.empty()) ?
+          get_cell_weights() :
+          std::vector<unsigned int>();
+
+      if (!(settings & no_automatic_repartitioning) &&
+          is_repartitioning_needed(cell_weights))
         {
           // partition the new mesh between all processors. If cell weights
           // have not been given balance the number of cells.
@@ -3432,8 +3482,6 @@ namespace parallel
               /* weight_callback */ nullptr);
           else
             {
-              // get cell weights for a weighted repartitioning.
-              const std::vector<unsigned int> cell_weights = get_cell_weights();
 
               // verify that the global sum of weights is larger than 0
               Assert(Utilities::MPI::sum(std::accumulate(cell_weights.begin(),
@@ -3475,6 +3523,13 @@ namespace parallel
             this->get_communicator());
         }
 
+      // start to send the data to the new owners of the cells, which only
+      // depends on the forest, and let the messages travel while the deal.II
+      // triangulation is rebuilt below
+      if (this->cell_attached_data.n_attached_data_sets > 0)
+        this->begin_transfer(parallel_forest,
+                             previous_global_first_quadrant.data());
+
       // finally copy back from local part of tree to deal.II
       // triangulation. before doing so, make sure there are no refine or
       // coarsen flags pending
@@ -3495,11 +3550,11 @@ namespace parallel
           DEAL_II_ASSERT_UNREACHABLE();
         }
 
-      // transfer data after triangulation got updated
+      // complete the data transfer after triangulation got updated
       if (this->cell_attached_data.n_attached_data_sets > 0)
         {
-          this->execute_transfer(parallel_forest,
-                                 previous_global_first_quadrant.data());
+          this->end_transfer(parallel_forest,
+                             previous_global_first_quadrant.data());
 
           // also update the CellStatus information on the new mesh
           this->data_serializer.unpack_cell_status(this->local_cell_relations);
@@ -4104,6 +4159,75 @@ namespace parallel
 
 
 
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim, spacedim>::set_repartitioning_threshold(
+      const double imbalance_threshold)
+    {
+      Assert(imbalance_threshold == 0. || imbalance_threshold >= 1.,
+             ExcMessage("The imbalance threshold is the ratio of the maximal "
+                        "to the average load and can hence not be smaller "
+                        "than one, except for zero to always repartition."));
+      repartitioning_threshold = imbalance_threshold;
+    }
+
+
+
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    void Triangulation<dim, spacedim>::set_measured_work(
+      const double local_work)
+    {
+      if (local_work < 0.)
+        measured_work_per_cell = -1.;
+      else
+        measured_work_per_cell =
+          local_work /
+          std::max<double>(this->n_locally_owned_active_cells(), 1.);
+    }
+
+
+
+    template <int dim, int spacedim>
+    DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+    bool Triangulation<dim, spacedim>::is_repartitioning_needed(
+      const std::vector<unsigned int> &cell_weights) const
+    {
+      if (repartitioning_threshold == 0.)
+        return true;
+
+      double local_load =
+        cell_weights.empty() ?
+          static_cast<double>(parallel_forest->local_num_quadrants) :
+          static_cast<double>(std::accumulate(cell_weights.begin(),
+                                              cell_weights.end(),
+                                              std::uint64_t(0)));
+
+      // scale the load by the measured work per cell relative to the average
+      // over the processes that have provided a measurement. processes
+      // without a measurement, e.g., because they did not own any cells,
+      // are assumed to work at the average rate.
+      const double has_measurement = (measured_work_per_cell >= 0.) ? 1. : 0.;
+      const double n_measurements =
+        Utilities::MPI::sum(has_measurement, this->mpi_communicator);
+      if (n_measurements > 0)
+        {
+          const double average_work_per_cell =
+            Utilities::MPI::sum(has_measurement * measured_work_per_cell,
+                                this->mpi_communicator) /
+            n_measurements;
+          if (measured_work_per_cell >= 0. && average_work_per_cell > 0.)
+            local_load *= measured_work_per_cell / average_work_per_cell;
+        }
+
+      const Utilities::MPI::MinMaxAvg load =
+        Utilities::MPI::min_max_avg(local_load, this->mpi_communicator);
+
+      return load.avg > 0. && load.max > repartitioning_threshold * load.avg;
+    }
+
+
+
     template <int dim, int spacedim>
     DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
     std::vector<unsigned int> Triangulation<dim, spacedim>::get_cell_weights()
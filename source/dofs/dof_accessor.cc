@@ -263,6 +263,10 @@ namespace internal
       boost::container::small_vector<types::global_dof_index, 27> &dof_indices,
       const unsigned int                                           fe_index)
     {
+      if (fe_index == accessor.active_fe_index() &&
+          Implementation::get_cached_cell_dof_indices(accessor, dof_indices))
+        return;
+
       Implementation::process_dof_indices(
         accessor,
         dof_indices,
@@ -287,6 +291,10 @@ DoFCellAccessor<dimension_, space_dimension_, level_dof_access>::
          ExcMessage("Can't ask for DoF indices on artificial cells."));
   AssertDimension(dof_indices.size(), this->get_fe().n_dofs_per_cell());
 
+  if (dealii::internal::DoFAccessorImplementation::Implementation::
+        get_cached_cell_dof_indices(*this, dof_indices))
+    return;
+
   dealii::internal::DoFAccessorImplementation::Implementation::get_dof_indices(
     *this, dof_indices, this->active_fe_index());
 }
@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <unordered_set>
 
@@ -1721,6 +1722,7 @@ DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 DoFHandler<dim, spacedim>::DoFHandler()
   : hp_capability_enabled(true)
   , tria(nullptr, typeid(*this).name())
+  , cell_dof_cache_enabled(false)
   , mg_faces(nullptr)
 {}
 
@@ -2104,6 +2106,8 @@ std::size_t DoFHandler<dim, spacedim>::memory_consumption() const
 
   mem += MemoryConsumption::memory_consumption(object_dof_indices) +
          MemoryConsumption::memory_consumption(object_dof_ptr) +
+         MemoryConsumption::memory_consumption(cell_dof_cache_indices) +
+         MemoryConsumption::memory_consumption(cell_dof_cache_ptr) +
          MemoryConsumption::memory_consumption(hp_object_fe_indices) +
          MemoryConsumption::memory_consumption(hp_object_fe_ptr) +
          MemoryConsumption::memory_consumption(hp_cell_active_fe_indices) +
@@ -2261,8 +2265,12 @@ void DoFHandler<dim, spacedim>::distribute_dofs(
       internal::DoFHandlerImplementation::Implementation::reserve_space(*this);
   }
 
-  // hand the actual work over to the policy
+  // hand the actual work over to the policy. the policy reads the DoF
+  // indices of cells while it works, so the cache must not be used
+  this->cell_dof_cache_indices.clear();
+  this->cell_dof_cache_ptr.clear();
   this->number_cache = this->policy->distribute_dofs();
+  this->update_cell_dof_indices_cache();
 
   // do some housekeeping: compress indices
   // if(hp_capability_enabled)
@@ -2372,6 +2380,9 @@ void DoFHandler<dim, spacedim>::clear_space()
 
   object_dof_ptr.clear();
 
+  cell_dof_cache_indices.clear();
+  cell_dof_cache_ptr.clear();
+
   this->number_cache.clear();
 
   this->hp_cell_active_fe_indices.clear();
@@ -2396,11 +2407,63 @@ void DoFHandler<dim, spacedim>::clear_mg_space()
 
 
 
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::set_cell_dof_indices_caching(const bool enable)
+{
+  this->cell_dof_cache_enabled = enable;
+  this->update_cell_dof_indices_cache();
+}
+
+
+
+template <int dim, int spacedim>
+DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
+void DoFHandler<dim, spacedim>::update_cell_dof_indices_cache()
+{
+  this->cell_dof_cache_indices.clear();
+  this->cell_dof_cache_ptr.clear();
+
+  if (this->cell_dof_cache_enabled == false || this->tria == nullptr ||
+      this->object_dof_indices.empty() || this->fe_collection.size() == 0)
+    return;
+
+  // collect the indices into local arrays first: while the member arrays
+  // are empty, the accessors read the indices from the geometric objects
+  std::vector<offset_type> ptr(this->tria->n_active_cells() + 1, 0);
+  for (const auto &cell : this->active_cell_iterators())
+    if (cell->is_artificial() == false)
+      ptr[cell->active_cell_index() + 1] = cell->get_fe().n_dofs_per_cell();
+  std::partial_sum(ptr.begin(), ptr.end(), ptr.begin());
+
+  std::vector<types::global_dof_index> indices(ptr.back());
+  std::vector<types::global_dof_index> dof_indices;
+  for (const auto &cell : this->active_cell_iterators())
+    if (cell->is_artificial() == false)
+      {
+        dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dof_indices);
+        std::copy(dof_indices.begin(),
+                  dof_indices.end(),
+                  indices.begin() + ptr[cell->active_cell_index()]);
+      }
+
+  this->cell_dof_cache_indices = std::move(indices);
+  this->cell_dof_cache_ptr     = std::move(ptr);
+}
+
+
+
 template <int dim, int spacedim>
 DEAL_II_CXX20_REQUIRES((concepts::is_valid_dim_spacedim<dim, spacedim>))
 void DoFHandler<dim, spacedim>::renumber_dofs(
   const std::vector<types::global_dof_index> &new_numbers)
 {
+  // the cached indices become invalid while the policy renumbers the DoF
+  // indices stored on the geometric objects
+  this->cell_dof_cache_indices.clear();
+  this->cell_dof_cache_ptr.clear();
+
   if (hp_capability_enabled)
     {
       Assert(this->hp_cell_future_fe_indices.size() > 0,
@@ -2504,6 +2567,8 @@ void DoFHandler<dim, spacedim>::renumber_dofs(
 
       this->number_cache = this->policy->renumber_dofs(new_numbers);
     }
+
+  this->update_cell_dof_indices_cache();
 }
 
 
@@ -2717,6 +2782,14 @@ void DoFHandler<dim, spacedim>::connect_to_triangulation_signals()
   this->tria_listeners.push_back(
     this->tria->signals.clear.connect([this]() { this->clear(); }));
 
+  // the cached DoF indices of active cells refer to the active cell index,
+  // which changes with any change of the mesh
+  this->tria_listeners.push_back(
+    this->tria->signals.any_change.connect([this]() {
+      this->cell_dof_cache_indices.clear();
+      this->cell_dof_cache_ptr.clear();
+    }));
+
   // attach corresponding callback functions dealing with the transfer of
   // active FE indices depending on the type of triangulation
   if (dynamic_cast<
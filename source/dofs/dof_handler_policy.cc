@@ -15,6 +15,7 @@
 
 #include <deal.II/base/geometry_info.h>
 #include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/types.h>
@@ -1796,6 +1797,39 @@ namespace internal
         /* --------------------- renumber_dofs functionality ---------------- */
 
 
+        /**
+         * Replace every valid index in the array @p dof_indices by its new
+         * number. This is the kernel of the renumber_*_dofs() functions
+         * below for the case without hp-capabilities, where the indices of
+         * all objects of one kind are stored contiguously. Since every entry
+         * is touched exactly once, the work is split into chunks that are
+         * processed in parallel.
+         */
+        static void
+        renumber_dof_index_array(
+          std::vector<types::global_dof_index>       &dof_indices,
+          const std::vector<types::global_dof_index> &new_numbers,
+          const IndexSet                             &indices_we_care_about)
+        {
+          dealii::parallel::apply_to_subranges(
+            0,
+            dof_indices.size(),
+            [&](const std::size_t begin, const std::size_t end) {
+              for (std::size_t k = begin; k < end; ++k)
+                {
+                  types::global_dof_index &i = dof_indices[k];
+                  if (i != numbers::invalid_dof_index)
+                    i = ((indices_we_care_about.size() == 0) ?
+                           new_numbers[i] :
+                           new_numbers[indices_we_care_about.index_within_set(
+                             i)]);
+                }
+            },
+            4096);
+        }
+
+
+
         /**
          * The part of the renumber_dofs() functionality that operates on faces.
          * This part is dimension dependent and so needs to be implemented in
@@ -1811,11 +1845,9 @@ namespace internal
           DoFHandler<dim, spacedim>                  &dof_handler)
         {
           for (unsigned int d = 1; d < dim; ++d)
-            for (auto &i : dof_handler.object_dof_indices[0][d])
-              if (i != numbers::invalid_dof_index)
-                i = ((indices_we_care_about.size() == 0) ?
-                       new_numbers[i] :
-                       new_numbers[indices_we_care_about.index_within_set(i)]);
+            renumber_dof_index_array(dof_handler.object_dof_indices[0][d],
+                                     new_numbers,
+                                     indices_we_care_about);
         }
 
 
@@ -1836,22 +1868,24 @@ namespace internal
               // correct but also faster; note, however, that dof numbers
               // may be invalid_dof_index, namely when the appropriate
               // vertex/line/etc is unused
-              for (std::vector<types::global_dof_index>::iterator i =
-                     dof_handler.object_dof_indices[0][0].begin();
-                   i != dof_handler.object_dof_indices[0][0].end();
-                   ++i)
-                if (*i != numbers::invalid_dof_index)
-                  *i =
-                    (indices_we_care_about.size() == 0) ?
-                      (new_numbers[*i]) :
-                      (new_numbers[indices_we_care_about.index_within_set(*i)]);
-                else if (check_validity)
-                  // if index is invalid_dof_index: check if this one
-                  // really is unused
-                  Assert(dof_handler.get_triangulation().vertex_used(
-                           (i - dof_handler.object_dof_indices[0][0].begin()) /
-                           dof_handler.get_fe().n_dofs_per_vertex()) == false,
-                         ExcInternalError());
+              renumber_dof_index_array(dof_handler.object_dof_indices[0][0],
+                                       new_numbers,
+                                       indices_we_care_about);
+
+#ifdef DEBUG
+              // if an index is invalid_dof_index: check if this one
+              // really is unused
+              if (check_validity)
+                for (std::size_t i = 0;
+                     i < dof_handler.object_dof_indices[0][0].size();
+                     ++i)
+                  if (dof_handler.object_dof_indices[0][0][i] ==
+                      numbers::invalid_dof_index)
+                    Assert(dof_handler.get_triangulation().vertex_used(
+                             i / dof_handler.get_fe().n_dofs_per_vertex()) ==
+                             false,
+                           ExcInternalError());
+#endif
               return;
             }
 
@@ -1989,12 +2023,10 @@ namespace internal
               for (unsigned int level = 0;
                    level < dof_handler.object_dof_indices.size();
                    ++level)
-                for (auto &i : dof_handler.object_dof_indices[level][dim])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(
+                  dof_handler.object_dof_indices[level][dim],
+                  new_numbers,
+                  indices_we_care_about);
               return;
             }
 
@@ -2075,12 +2107,9 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(dof_handler.object_dof_indices[0][d],
+                                         new_numbers,
+                                         indices_we_care_about);
               return;
             }
 
@@ -2170,12 +2199,9 @@ namespace internal
           if (dof_handler.hp_capability_enabled == false)
             {
               for (unsigned int d = 1; d < dim; ++d)
-                for (auto &i : dof_handler.object_dof_indices[0][d])
-                  if (i != numbers::invalid_dof_index)
-                    i = ((indices_we_care_about.size() == 0) ?
-                           new_numbers[i] :
-                           new_numbers[indices_we_care_about.index_within_set(
-                             i)]);
+                renumber_dof_index_array(dof_handler.object_dof_indices[0][d],
+                                         new_numbers,
+                                         indices_we_care_about);
               return;
             }
 
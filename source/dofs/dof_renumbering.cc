@@ -2895,6 +2895,62 @@ namespace DoFRenumbering
     return new_global_numbers;
   }
 
+
+
+  template <int dim,
+            int spacedim,
+            typename Number,
+            typename VectorizedArrayType>
+  double
+  compute_matrix_free_index_spread(
+    const DoFHandler<dim, spacedim>                    &dof_handler,
+    const MatrixFree<dim, Number, VectorizedArrayType> &matrix_free)
+  {
+    Assert(matrix_free.indices_initialized(),
+           ExcMessage("You need to set up indices in MatrixFree "
+                      "to be able to compute the index spread!"));
+
+    unsigned int component = 0;
+    for (; component < matrix_free.n_components(); ++component)
+      if (&matrix_free.get_dof_handler(component) == &dof_handler)
+        break;
+
+    Assert(component < matrix_free.n_components(),
+           ExcMessage("Could not locate the given DoFHandler in MatrixFree"));
+
+    const dealii::internal::MatrixFreeFunctions::DoFInfo &dof_info =
+      matrix_free.get_dof_info(component);
+    const unsigned int n_owned_dofs =
+      dof_info.vector_partitioner->locally_owned_size();
+
+    // the indices returned by DoFInfo are in the MPI-local numbering, where
+    // the locally owned indices come first and the ghosts follow
+    std::vector<unsigned int> dof_indices;
+    double                    sum_spread = 0;
+    unsigned int              n_batches  = 0;
+    for (unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+      {
+        dof_info.get_dof_indices_on_cell_batch(dof_indices, cell);
+
+        unsigned int min_index = numbers::invalid_unsigned_int;
+        unsigned int max_index = 0;
+        for (const unsigned int i : dof_indices)
+          if (i < n_owned_dofs)
+            {
+              min_index = std::min(min_index, i);
+              max_index = std::max(max_index, i);
+            }
+
+        if (min_index != numbers::invalid_unsigned_int)
+          {
+            sum_spread += max_index - min_index + 1;
+            ++n_batches;
+          }
+      }
+
+    return n_batches > 0 ? sum_spread / n_batches : 0.;
+  }
+
 } // namespace DoFRenumbering
 
 
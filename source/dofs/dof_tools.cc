@@ -2188,6 +2188,56 @@ namespace DoFTools
 
 
 
+  template <int dim, int spacedim>
+  unsigned int
+  compute_node_block_size(const DoFHandler<dim, spacedim> &dof_handler)
+  {
+    const dealii::hp::FECollection<dim, spacedim> &fe_collection =
+      dof_handler.get_fe_collection();
+    const unsigned int n_components = fe_collection.n_components();
+
+    // only elements consisting of n_components copies of a single scalar
+    // element have nodes with one degree of freedom per component
+    bool is_node_blocked = n_components > 1;
+    for (unsigned int f = 0; f < fe_collection.size(); ++f)
+      if (fe_collection[f].n_base_elements() != 1 ||
+          fe_collection[f].element_multiplicity(0) != n_components)
+        is_node_blocked = false;
+
+    // check that the degrees of freedom of each node are numbered
+    // consecutively in the order of the components, starting at a multiple
+    // of the number of components
+    std::vector<types::global_dof_index> dof_indices;
+    if (is_node_blocked)
+      for (const auto &cell : dof_handler.active_cell_iterators())
+        if (cell->is_locally_owned())
+          {
+            const FiniteElement<dim, spacedim> &fe = cell->get_fe();
+            dof_indices.resize(fe.n_dofs_per_cell());
+            cell->get_dof_indices(dof_indices);
+            for (unsigned int i = 0; i < dof_indices.size(); ++i)
+              {
+                const auto [component, base_index] =
+                  fe.system_to_component_index(i);
+                const types::global_dof_index first_index =
+                  dof_indices[fe.component_to_system_index(0, base_index)];
+                if (first_index % n_components != 0 ||
+                    dof_indices[i] != first_index + component)
+                  {
+                    is_node_blocked = false;
+                    break;
+                  }
+              }
+            if (!is_node_blocked)
+              break;
+          }
+
+    return Utilities::MPI::min(is_node_blocked ? n_components : 1U,
+                               dof_handler.get_communicator());
+  }
+
+
+
   template <int dim, int spacedim>
   void
   map_dof_to_boundary_indices(const DoFHandler<dim, spacedim>      &dof_handler,
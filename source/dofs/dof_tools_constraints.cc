@@ -44,6 +44,7 @@
 #include <algorithm>
 #include <array>
 #include <memory>
+#include <mutex>
 #include <numeric>
 
 DEAL_II_NAMESPACE_OPEN
@@ -313,8 +314,11 @@ namespace DoFTools
         const FiniteElement<dim, spacedim> &fe1,
         const FiniteElement<dim, spacedim> &fe2,
         const FullMatrix<double>           &face_interpolation_matrix,
-        std::unique_ptr<std::vector<bool>> &primary_dof_mask)
+        std::unique_ptr<std::vector<bool>> &primary_dof_mask,
+        std::mutex                         &cache_mutex)
       {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
         // TODO: the implementation makes the assumption that all faces have the
         // same number of dofs
         AssertDimension(fe1.n_unique_faces(), 1);
@@ -344,8 +348,11 @@ namespace DoFTools
       ensure_existence_of_face_matrix(
         const FiniteElement<dim, spacedim>  &fe1,
         const FiniteElement<dim, spacedim>  &fe2,
-        std::unique_ptr<FullMatrix<double>> &matrix)
+        std::unique_ptr<FullMatrix<double>> &matrix,
+        std::mutex                          &cache_mutex)
       {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
         // TODO: the implementation makes the assumption that all faces have the
         // same number of dofs
         AssertDimension(fe1.n_unique_faces(), 1);
@@ -371,8 +378,11 @@ namespace DoFTools
         const FiniteElement<dim, spacedim>  &fe1,
         const FiniteElement<dim, spacedim>  &fe2,
         const unsigned int                   subface,
-        std::unique_ptr<FullMatrix<double>> &matrix)
+        std::unique_ptr<FullMatrix<double>> &matrix,
+        std::mutex                          &cache_mutex)
       {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
         // TODO: the implementation makes the assumption that all faces have the
         // same number of dofs
         AssertDimension(fe1.n_unique_faces(), 1);
@@ -402,8 +412,11 @@ namespace DoFTools
         const FullMatrix<double> &face_interpolation_matrix,
         const std::vector<bool>  &primary_dof_mask,
         std::unique_ptr<std::pair<FullMatrix<double>, FullMatrix<double>>>
-          &split_matrix)
+                   &split_matrix,
+        std::mutex &cache_mutex)
       {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+
         AssertDimension(primary_dof_mask.size(), face_interpolation_matrix.m());
         Assert(std::count(primary_dof_mask.begin(),
                           primary_dof_mask.end(),
@@ -455,6 +468,42 @@ namespace DoFTools
       }
 
 
+      /**
+       * Scratch arrays used by make_hp_hanging_node_constraints(), kept
+       * per thread to avoid the repeated allocation of memory.
+       */
+      struct HangingNodeScratchData
+      {
+        /**
+         * A matrix to be used for the constraints of a face.
+         */
+        FullMatrix<double> constraint_matrix;
+
+        /**
+         * Arrays for the primary and dependent dof numbers, as well as a
+         * scratch array needed for the complicated cases.
+         */
+        std::vector<types::global_dof_index> primary_dofs;
+        std::vector<types::global_dof_index> dependent_dofs;
+        std::vector<types::global_dof_index> scratch_dofs;
+      };
+
+
+
+      /**
+       * The constraints of the dependent dofs on a face in terms of the
+       * primary dofs, computed by make_hp_hanging_node_constraints() for a
+       * cell and handed to filter_constraints() afterwards.
+       */
+      struct HangingFaceConstraints
+      {
+        std::vector<types::global_dof_index> primary_dofs;
+        std::vector<types::global_dof_index> dependent_dofs;
+        FullMatrix<double>                   matrix;
+      };
+
+
+
       /**
        * A function that returns how many different finite elements a dof
        * handler uses. This is one for non-hp-DoFHandlers and
@@ -2323,19 +2372,12 @@ namespace DoFTools
       // on here
 
 
-      // a matrix to be used for constraints below. declared here and simply
-      // resized down below to avoid permanent re-allocation of memory
-      FullMatrix<double> constraint_matrix;
-
-      // similarly have arrays that will hold primary and dependent dof numbers,
-      // as well as a scratch array needed for the complicated case below
-      std::vector<types::global_dof_index> primary_dofs;
-      std::vector<types::global_dof_index> dependent_dofs;
-      std::vector<types::global_dof_index> scratch_dofs;
-
       // caches for the face and subface interpolation matrices between
       // different (or the same) finite elements. we compute them only once,
-      // namely the first time they are needed, and then just reuse them
+      // namely the first time they are needed, and then just reuse them. the
+      // cells are worked on in parallel, so the creation of the matrices is
+      // guarded by a mutex
+      std::mutex cache_mutex;
       Table<2, std::unique_ptr<FullMatrix<double>>> face_interpolation_matrices(
         n_finite_elements(dof_handler), n_finite_elements(dof_handler));
       Table<3, std::unique_ptr<FullMatrix<double>>>
@@ -2365,12 +2407,39 @@ namespace DoFTools
       // note that even though we may visit a face twice if the neighboring
       // cells are equally refined, we can only visit each face with hanging
       // nodes once
-      for (const auto &cell : dof_handler.active_cell_iterators())
-        {
+      //
+      // the cells are worked on in parallel. the workers only compute the
+      // constraints of the faces of a cell, and the copier enters them into
+      // the AffineConstraints object in the order of the cells, so that the
+      // result is the same as that of a sequential loop
+      using CellIterator =
+        typename DoFHandler<dim, spacedim>::active_cell_iterator;
+      const auto worker =
+        [&](const CellIterator                  &cell,
+            HangingNodeScratchData              &scratch_data,
+            std::vector<HangingFaceConstraints> &copy_data) {
+          copy_data.clear();
+
           // artificial cells can at best neighbor ghost cells, but we're not
           // interested in these interfaces
           if (cell->is_artificial())
-            continue;
+            return;
+
+          FullMatrix<double> &constraint_matrix =
+            scratch_data.constraint_matrix;
+          std::vector<types::global_dof_index> &primary_dofs =
+            scratch_data.primary_dofs;
+          std::vector<types::global_dof_index> &dependent_dofs =
+            scratch_data.dependent_dofs;
+          std::vector<types::global_dof_index> &scratch_dofs =
+            scratch_data.scratch_dofs;
+
+          const auto record_constraints =
+            [&copy_data](const std::vector<types::global_dof_index> &primary,
+                         const std::vector<types::global_dof_index> &dependent,
+                         const FullMatrix<double> &face_constraints) {
+              copy_data.push_back({primary, dependent, face_constraints});
+            };
 
           for (const unsigned int face : cell->face_indices())
             if (cell->face(face)->has_children())
@@ -2537,16 +2606,16 @@ namespace DoFTools
                               subface->get_fe(subface_fe_index),
                               c,
                               subface_interpolation_matrices
-                                [cell->active_fe_index()][subface_fe_index][c]);
+                                [cell->active_fe_index()][subface_fe_index][c],
+                              cache_mutex);
 
                             // Add constraints to global AffineConstraints
                             // object.
-                            filter_constraints(primary_dofs,
+                            record_constraints(primary_dofs,
                                                dependent_dofs,
                                                *(subface_interpolation_matrices
                                                    [cell->active_fe_index()]
-                                                   [subface_fe_index][c]),
-                                               constraints);
+                                                   [subface_fe_index][c]));
                           } // loop over subfaces
 
                         break;
@@ -2617,7 +2686,8 @@ namespace DoFTools
                           dominating_fe,
                           cell->get_fe(),
                           face_interpolation_matrices[dominating_fe_index]
-                                                     [cell->active_fe_index()]);
+                                                     [cell->active_fe_index()],
+                          cache_mutex);
 
                         // split this matrix into primary and dependent
                         // components. invert the primary component
@@ -2627,7 +2697,8 @@ namespace DoFTools
                           (*face_interpolation_matrices
                              [dominating_fe_index][cell->active_fe_index()]),
                           primary_dof_masks[dominating_fe_index]
-                                           [cell->active_fe_index()]);
+                                           [cell->active_fe_index()],
+                          cache_mutex);
 
                         ensure_existence_of_split_face_matrix(
                           *face_interpolation_matrices[dominating_fe_index]
@@ -2635,7 +2706,8 @@ namespace DoFTools
                           (*primary_dof_masks[dominating_fe_index]
                                              [cell->active_fe_index()]),
                           split_face_interpolation_matrices
-                            [dominating_fe_index][cell->active_fe_index()]);
+                            [dominating_fe_index][cell->active_fe_index()],
+                          cache_mutex);
 
                         const FullMatrix<double>
                           &restrict_mother_to_virtual_primary_inv =
@@ -2686,10 +2758,9 @@ namespace DoFTools
                                         cell->get_fe().n_dofs_per_face(face) -
                                           dominating_fe.n_dofs_per_face(face));
 
-                        filter_constraints(primary_dofs,
+                        record_constraints(primary_dofs,
                                            dependent_dofs,
-                                           constraint_matrix,
-                                           constraints);
+                                           constraint_matrix);
 
 
 
@@ -2729,7 +2800,8 @@ namespace DoFTools
                               subface_fe,
                               sf,
                               subface_interpolation_matrices
-                                [dominating_fe_index][subface_fe_index][sf]);
+                                [dominating_fe_index][subface_fe_index][sf],
+                              cache_mutex);
 
                             const FullMatrix<double>
                               &restrict_subface_to_virtual = *(
@@ -2749,10 +2821,9 @@ namespace DoFTools
                             cell->face(face)->child(sf)->get_dof_indices(
                               dependent_dofs, subface_fe_index);
 
-                            filter_constraints(primary_dofs,
+                            record_constraints(primary_dofs,
                                                dependent_dofs,
-                                               constraint_matrix,
-                                               constraints);
+                                               constraint_matrix);
                           } // loop over subfaces
 
                         break;
@@ -2829,16 +2900,16 @@ namespace DoFTools
                               neighbor->get_fe(),
                               face_interpolation_matrices
                                 [cell->active_fe_index()]
-                                [neighbor->active_fe_index()]);
+                                [neighbor->active_fe_index()],
+                              cache_mutex);
 
                             // Add constraints to global constraint matrix.
-                            filter_constraints(
+                            record_constraints(
                               primary_dofs,
                               dependent_dofs,
                               *(face_interpolation_matrices
                                   [cell->active_fe_index()]
-                                  [neighbor->active_fe_index()]),
-                              constraints);
+                                  [neighbor->active_fe_index()]));
 
                             break;
                           }
@@ -2933,7 +3004,8 @@ namespace DoFTools
                               dominating_fe,
                               cell->get_fe(),
                               face_interpolation_matrices
-                                [dominating_fe_index][cell->active_fe_index()]);
+                                [dominating_fe_index][cell->active_fe_index()],
+                              cache_mutex);
 
                             // split this matrix into primary and dependent
                             // components. invert the primary component
@@ -2944,7 +3016,8 @@ namespace DoFTools
                                  [dominating_fe_index]
                                  [cell->active_fe_index()]),
                               primary_dof_masks[dominating_fe_index]
-                                               [cell->active_fe_index()]);
+                                               [cell->active_fe_index()],
+                              cache_mutex);
 
                             ensure_existence_of_split_face_matrix(
                               *face_interpolation_matrices
@@ -2952,7 +3025,8 @@ namespace DoFTools
                               (*primary_dof_masks[dominating_fe_index]
                                                  [cell->active_fe_index()]),
                               split_face_interpolation_matrices
-                                [dominating_fe_index][cell->active_fe_index()]);
+                                [dominating_fe_index][cell->active_fe_index()],
+                              cache_mutex);
 
                             const FullMatrix<
                               double> &restrict_mother_to_virtual_primary_inv =
@@ -3004,10 +3078,9 @@ namespace DoFTools
                               cell->get_fe().n_dofs_per_face(face) -
                                 dominating_fe.n_dofs_per_face(face));
 
-                            filter_constraints(primary_dofs,
+                            record_constraints(primary_dofs,
                                                dependent_dofs,
-                                               constraint_matrix,
-                                               constraints);
+                                               constraint_matrix);
 
                             // now do the same for another FE this is pretty
                             // much the same we do above to resolve h-refinement
@@ -3021,7 +3094,8 @@ namespace DoFTools
                               neighbor->get_fe(),
                               face_interpolation_matrices
                                 [dominating_fe_index]
-                                [neighbor->active_fe_index()]);
+                                [neighbor->active_fe_index()],
+                              cache_mutex);
 
                             const FullMatrix<double>
                               &restrict_secondface_to_virtual =
@@ -3042,10 +3116,9 @@ namespace DoFTools
                             cell->face(face)->get_dof_indices(
                               dependent_dofs, neighbor->active_fe_index());
 
-                            filter_constraints(primary_dofs,
+                            record_constraints(primary_dofs,
                                                dependent_dofs,
-                                               constraint_matrix,
-                                               constraints);
+                                               constraint_matrix);
 
                             break;
                           }
@@ -3062,7 +3135,22 @@ namespace DoFTools
                       }
                   }
               }
-        }
+        };
+
+      const auto copier =
+        [&](const std::vector<HangingFaceConstraints> &copy_data) {
+          for (const HangingFaceConstraints &face_constraints : copy_data)
+            filter_constraints(face_constraints.primary_dofs,
+                               face_constraints.dependent_dofs,
+                               face_constraints.matrix,
+                               constraints);
+        };
+
+      WorkStream::run(dof_handler.active_cell_iterators(),
+                      worker,
+                      copier,
+                      HangingNodeScratchData(),
+                      std::vector<HangingFaceConstraints>());
     }
   } // namespace internal
 
@@ -12,10 +12,12 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/quadrature_lib.h>
 #include <deal.II/base/table.h>
 #include <deal.II/base/template_constraints.h>
 #include <deal.II/base/utilities.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria_base.h>
@@ -39,6 +41,8 @@
 #include <deal.II/hp/q_collection.h>
 
 #include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/chunk_sparsity_pattern.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/sparsity_pattern_base.h>
 #include <deal.II/lac/vector.h>
 
@@ -51,6 +55,74 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace DoFTools
 {
+  namespace
+  {
+    /**
+     * A sparsity pattern that does not store a pattern, but records the
+     * rows added to it in compressed form, so that they can later be added
+     * to another sparsity pattern. This allows to compute the entries of a
+     * cell, including the resolution of constraints, on a worker thread,
+     * and to only insert them into the actual sparsity pattern, which is
+     * not thread-safe, on the thread that runs the copier.
+     */
+    class SparsityPatternRecorder : public SparsityPatternBase
+    {
+    public:
+      SparsityPatternRecorder(const size_type n_rows, const size_type n_cols)
+        : SparsityPatternBase(n_rows, n_cols)
+        , row_starts(1, 0)
+      {}
+
+      virtual void
+      add_row_entries(const size_type                  &row,
+                      const ArrayView<const size_type> &columns,
+                      const bool indices_are_sorted = false) override
+      {
+        rows.push_back(row);
+        rows_are_sorted.push_back(indices_are_sorted);
+        all_columns.insert(all_columns.end(), columns.begin(), columns.end());
+        row_starts.push_back(all_columns.size());
+      }
+
+      using SparsityPatternBase::add_entries;
+
+      /**
+       * Forget all recorded rows.
+       */
+      void
+      clear()
+      {
+        rows.clear();
+        rows_are_sorted.clear();
+        all_columns.clear();
+        row_starts.resize(1);
+      }
+
+      /**
+       * Add all recorded rows to @p sparsity.
+       */
+      void
+      replay(SparsityPatternBase &sparsity) const
+      {
+        for (unsigned int i = 0; i < rows.size(); ++i)
+          sparsity.add_row_entries(rows[i],
+                                   make_array_view(all_columns.begin() +
+                                                     row_starts[i],
+                                                   all_columns.begin() +
+                                                     row_starts[i + 1]),
+                                   rows_are_sorted[i]);
+      }
+
+    private:
+      std::vector<size_type> rows;
+      std::vector<bool>      rows_are_sorted;
+      std::vector<size_type> all_columns;
+      std::vector<size_type> row_starts;
+    };
+  } // namespace
+
+
+
   template <int dim, int spacedim, typename number>
   void
   make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
@@ -82,28 +154,70 @@ namespace DoFTools
                  "locally owned one does not make sense."));
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell;
-    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
+    // The entries of each cell, including the ones that result from
+    // resolving the constraints, are computed in parallel and recorded,
+    // whereas the insertion into the sparsity pattern, which is not
+    // thread-safe, happens in the copier. The copier is called in the order
+    // of the cells, so the result does not depend on the number of threads.
+    using CellIterator =
+      typename DoFHandler<dim, spacedim>::active_cell_iterator;
+
+    std::vector<types::global_dof_index> scratch_dofs;
+    scratch_dofs.reserve(dof.get_fe_collection().max_dofs_per_cell());
+
+    const auto worker =
+      [&](const CellIterator                   &cell,
+          std::vector<types::global_dof_index> &dofs_on_this_cell,
+          SparsityPatternRecorder              &recorder) {
+        recorder.clear();
+
+        // In case we work with a distributed sparsity pattern of Trilinos
+        // type, we only have to do the work if the current cell is owned by
+        // the calling processor. Otherwise, just continue.
+        if (((subdomain_id == numbers::invalid_subdomain_id) ||
+             (subdomain_id == cell->subdomain_id())) &&
+            cell->is_locally_owned())
+          {
+            const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
+            dofs_on_this_cell.resize(dofs_per_cell);
+            cell->get_dof_indices(dofs_on_this_cell);
+
+            // make sparsity pattern for this cell. if no constraints pattern
+            // was given, then the following call acts as if simply no
+            // constraints existed
+            constraints.add_entries_local_to_global(dofs_on_this_cell,
+                                                    recorder,
+                                                    keep_constrained_dofs);
+          }
+      };
+
+    const auto copier = [&](const SparsityPatternRecorder &recorder) {
+      recorder.replay(sparsity);
+    };
+
+    WorkStream::run(dof.begin_active(),
+                    CellIterator(dof.end()),
+                    worker,
+                    copier,
+                    scratch_dofs,
+                    SparsityPatternRecorder(sparsity.n_rows(),
+                                            sparsity.n_cols()));
+  }
 
-    // In case we work with a distributed sparsity pattern of Trilinos
-    // type, we only have to do the work if the current cell is owned by
-    // the calling processor. Otherwise, just continue.
-    for (const auto &cell : dof.active_cell_iterators())
-      if (((subdomain_id == numbers::invalid_subdomain_id) ||
-           (subdomain_id == cell->subdomain_id())) &&
-          cell->is_locally_owned())
-        {
-          const unsigned int dofs_per_cell = cell->get_fe().n_dofs_per_cell();
-          dofs_on_this_cell.resize(dofs_per_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
 
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs);
-        }
+
+  template <int dim, int spacedim, typename number>
+  void
+  make_sparsity_pattern(const DoFHandler<dim, spacedim> &dof,
+                        ChunkSparsityPattern            &sparsity,
+                        const AffineConstraints<number> &constraints,
+                        const bool                       keep_constrained_dofs,
+                        const types::subdomain_id        subdomain_id)
+  {
+    DynamicSparsityPattern dsp(dof.n_dofs(), dof.n_dofs());
+    make_sparsity_pattern(
+      dof, dsp, constraints, keep_constrained_dofs, subdomain_id);
+    sparsity.copy_from(dsp, compute_node_block_size(dof));
   }
 
 
@@ -530,9 +644,6 @@ namespace DoFTools
                              const AffineConstraints<number> &constraints,
                              const bool                keep_constrained_dofs,
                              const types::subdomain_id subdomain_id)
-
-  // TODO: QA: reduce the indentation level of this method..., Maier 2012
-
   {
     const types::global_dof_index n_dofs = dof.n_dofs();
     (void)n_dofs;
@@ -555,139 +666,186 @@ namespace DoFTools
                  "locally owned one does not make sense."));
       }
 
-    std::vector<types::global_dof_index> dofs_on_this_cell;
-    std::vector<types::global_dof_index> dofs_on_other_cell;
-    dofs_on_this_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
-    dofs_on_other_cell.reserve(dof.get_fe_collection().max_dofs_per_cell());
+    // The couplings of one cell: its own degrees of freedom, the union of
+    // the degrees of freedom on all neighbors that this cell adds entries
+    // for, and the neighbors whose rows need to be written from this cell
+    // because nobody else visits the shared face from the other side. The
+    // flag indicates whether the neighbor's own block needs to be added as
+    // well because the neighbor lives in another subdomain.
+    struct CellCouplings
+    {
+      std::vector<types::global_dof_index> dofs_on_this_cell;
+      std::vector<types::global_dof_index> dofs_on_neighbors;
+      std::vector<std::pair<std::vector<types::global_dof_index>, bool>>
+        reverse_couplings;
+    };
 
     // TODO: in an old implementation, we used user flags before to tag
     // faces that were already touched. this way, we could reduce the work
     // a little bit. now, we instead add only data from one side. this
     // should be OK, but we need to actually verify it.
+    const auto collect_couplings =
+      [](const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+         CellCouplings &couplings) {
+        couplings.dofs_on_this_cell.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(couplings.dofs_on_this_cell);
+        couplings.dofs_on_neighbors.clear();
+        couplings.reverse_couplings.clear();
+
+        const auto add_neighbor =
+          [&](const typename DoFHandler<dim, spacedim>::level_cell_iterator
+                        &neighbor,
+              const bool add_reverse,
+              const bool add_neighbor_block) {
+            std::vector<types::global_dof_index> dofs_on_neighbor(
+              neighbor->get_fe().n_dofs_per_cell());
+            neighbor->get_dof_indices(dofs_on_neighbor);
+            couplings.dofs_on_neighbors.insert(
+              couplings.dofs_on_neighbors.end(),
+              dofs_on_neighbor.begin(),
+              dofs_on_neighbor.end());
+            if (add_reverse)
+              couplings.reverse_couplings.emplace_back(
+                std::move(dofs_on_neighbor), add_neighbor_block);
+          };
+
+        for (const unsigned int face : cell->face_indices())
+          {
+            const bool periodic_neighbor = cell->has_periodic_neighbor(face);
+            if (cell->at_boundary(face) && !periodic_neighbor)
+              continue;
+
+            typename DoFHandler<dim, spacedim>::level_cell_iterator neighbor =
+              cell->neighbor_or_periodic_neighbor(face);
+
+            // in 1d, we do not need to worry whether the neighbor might have
+            // children and then loop over those children. rather, we may as
+            // well go straight to the cell behind this particular cell's most
+            // terminal child
+            if (dim == 1)
+              while (neighbor->has_children())
+                neighbor = neighbor->child(face == 0 ? 1 : 0);
+
+            if (neighbor->has_children())
+              {
+                for (unsigned int sub_nr = 0;
+                     sub_nr != cell->face(face)->n_active_descendants();
+                     ++sub_nr)
+                  {
+                    const typename DoFHandler<dim, spacedim>::
+                      level_cell_iterator sub_neighbor =
+                        periodic_neighbor ?
+                          cell->periodic_neighbor_child_on_subface(face,
+                                                                   sub_nr) :
+                          cell->neighbor_child_on_subface(face, sub_nr);
+
+                    // only need to add the neighbor block when the neighbor
+                    // is not owned by the current processor, otherwise we
+                    // add the entries for the neighbor there
+                    add_neighbor(sub_neighbor,
+                                 true,
+                                 sub_neighbor->subdomain_id() !=
+                                   cell->subdomain_id());
+                  }
+              }
+            else
+              {
+                // Refinement edges are taken care of by coarser cells
+                if ((!periodic_neighbor && cell->neighbor_is_coarser(face)) ||
+                    (periodic_neighbor &&
+                     cell->periodic_neighbor_is_coarser(face)))
+                  if (neighbor->subdomain_id() == cell->subdomain_id())
+                    continue;
+
+                // only need to add the reverse couplings in case the neighbor
+                // cell is not locally owned - otherwise, we touch each face
+                // twice and hence put the indices the other way around
+                const bool different_subdomain =
+                  neighbor->subdomain_id() != cell->subdomain_id();
+                add_neighbor(neighbor,
+                             !cell->neighbor_or_periodic_neighbor(face)
+                                 ->is_active() ||
+                               different_subdomain,
+                             different_subdomain);
+              }
+          }
+
+        // neighbors of continuous elements share degrees of freedom, so
+        // remove duplicates before handing the list to the constraints
+        std::sort(couplings.dofs_on_neighbors.begin(),
+                  couplings.dofs_on_neighbors.end());
+        couplings.dofs_on_neighbors.erase(
+          std::unique(couplings.dofs_on_neighbors.begin(),
+                      couplings.dofs_on_neighbors.end()),
+          couplings.dofs_on_neighbors.end());
+      };
 
     // In case we work with a distributed sparsity pattern of Trilinos
     // type, we only have to do the work if the current cell is owned by
     // the calling processor. Otherwise, just continue.
+    std::vector<typename DoFHandler<dim, spacedim>::active_cell_iterator>
+      cells;
     for (const auto &cell : dof.active_cell_iterators())
       if (((subdomain_id == numbers::invalid_subdomain_id) ||
            (subdomain_id == cell->subdomain_id())) &&
           cell->is_locally_owned())
-        {
-          const unsigned int n_dofs_on_this_cell =
-            cell->get_fe().n_dofs_per_cell();
-          dofs_on_this_cell.resize(n_dofs_on_this_cell);
-          cell->get_dof_indices(dofs_on_this_cell);
-
-          // make sparsity pattern for this cell. if no constraints pattern
-          // was given, then the following call acts as if simply no
-          // constraints existed
-          constraints.add_entries_local_to_global(dofs_on_this_cell,
-                                                  sparsity,
-                                                  keep_constrained_dofs);
+        cells.push_back(cell);
+
+    // Collecting the neighbor lists only reads from the mesh and the
+    // DoFHandler and is done in parallel, whereas the sparsity pattern
+    // must be written by one thread. Work in batches of cells to bound the
+    // memory held by the coupling lists.
+    const unsigned int        batch_size = 4096;
+    std::vector<CellCouplings> couplings(std::min<std::size_t>(batch_size,
+                                                               cells.size()));
+    for (std::size_t batch_start = 0; batch_start < cells.size();
+         batch_start += batch_size)
+      {
+        const unsigned int n_cells_in_batch =
+          std::min<std::size_t>(batch_size, cells.size() - batch_start);
+        dealii::parallel::apply_to_subranges(
+          0U,
+          n_cells_in_batch,
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              collect_couplings(cells[batch_start + i], couplings[i]);
+          },
+          64);
+
+        for (unsigned int i = 0; i < n_cells_in_batch; ++i)
+          {
+            const CellCouplings &cell_couplings = couplings[i];
+
+            // make sparsity pattern for this cell. if no constraints
+            // pattern was given, then the following call acts as if simply
+            // no constraints existed
+            constraints.add_entries_local_to_global(
+              cell_couplings.dofs_on_this_cell,
+              sparsity,
+              keep_constrained_dofs);
+
+            // the couplings of this cell with all of its neighbors at once
+            if (!cell_couplings.dofs_on_neighbors.empty())
+              constraints.add_entries_local_to_global(
+                cell_couplings.dofs_on_this_cell,
+                cell_couplings.dofs_on_neighbors,
+                sparsity,
+                keep_constrained_dofs);
 
-          for (const unsigned int face : cell->face_indices())
-            {
-              typename DoFHandler<dim, spacedim>::face_iterator cell_face =
-                cell->face(face);
-              const bool periodic_neighbor = cell->has_periodic_neighbor(face);
-              if (!cell->at_boundary(face) || periodic_neighbor)
-                {
-                  typename DoFHandler<dim, spacedim>::level_cell_iterator
-                    neighbor = cell->neighbor_or_periodic_neighbor(face);
-
-                  // in 1d, we do not need to worry whether the neighbor
-                  // might have children and then loop over those children.
-                  // rather, we may as well go straight to the cell behind
-                  // this particular cell's most terminal child
-                  if (dim == 1)
-                    while (neighbor->has_children())
-                      neighbor = neighbor->child(face == 0 ? 1 : 0);
-
-                  if (neighbor->has_children())
-                    {
-                      for (unsigned int sub_nr = 0;
-                           sub_nr != cell_face->n_active_descendants();
-                           ++sub_nr)
-                        {
-                          const typename DoFHandler<dim, spacedim>::
-                            level_cell_iterator sub_neighbor =
-                              periodic_neighbor ?
-                                cell->periodic_neighbor_child_on_subface(
-                                  face, sub_nr) :
-                                cell->neighbor_child_on_subface(face, sub_nr);
-
-                          const unsigned int n_dofs_on_neighbor =
-                            sub_neighbor->get_fe().n_dofs_per_cell();
-                          dofs_on_other_cell.resize(n_dofs_on_neighbor);
-                          sub_neighbor->get_dof_indices(dofs_on_other_cell);
-
-                          constraints.add_entries_local_to_global(
-                            dofs_on_this_cell,
-                            dofs_on_other_cell,
-                            sparsity,
-                            keep_constrained_dofs);
-                          constraints.add_entries_local_to_global(
-                            dofs_on_other_cell,
-                            dofs_on_this_cell,
-                            sparsity,
-                            keep_constrained_dofs);
-                          // only need to add this when the neighbor is not
-                          // owned by the current processor, otherwise we add
-                          // the entries for the neighbor there
-                          if (sub_neighbor->subdomain_id() !=
-                              cell->subdomain_id())
-                            constraints.add_entries_local_to_global(
-                              dofs_on_other_cell,
-                              sparsity,
-                              keep_constrained_dofs);
-                        }
-                    }
-                  else
-                    {
-                      // Refinement edges are taken care of by coarser
-                      // cells
-                      if ((!periodic_neighbor &&
-                           cell->neighbor_is_coarser(face)) ||
-                          (periodic_neighbor &&
-                           cell->periodic_neighbor_is_coarser(face)))
-                        if (neighbor->subdomain_id() == cell->subdomain_id())
-                          continue;
-
-                      const unsigned int n_dofs_on_neighbor =
-                        neighbor->get_fe().n_dofs_per_cell();
-                      dofs_on_other_cell.resize(n_dofs_on_neighbor);
-
-                      neighbor->get_dof_indices(dofs_on_other_cell);
-
-                      constraints.add_entries_local_to_global(
-                        dofs_on_this_cell,
-                        dofs_on_other_cell,
-                        sparsity,
-                        keep_constrained_dofs);
-
-                      // only need to add these in case the neighbor cell
-                      // is not locally owned - otherwise, we touch each
-                      // face twice and hence put the indices the other way
-                      // around
-                      if (!cell->neighbor_or_periodic_neighbor(face)
-                             ->is_active() ||
-                          (neighbor->subdomain_id() != cell->subdomain_id()))
-                        {
-                          constraints.add_entries_local_to_global(
-                            dofs_on_other_cell,
-                            dofs_on_this_cell,
-                            sparsity,
-                            keep_constrained_dofs);
-                          if (neighbor->subdomain_id() != cell->subdomain_id())
-                            constraints.add_entries_local_to_global(
-                              dofs_on_other_cell,
-                              sparsity,
-                              keep_constrained_dofs);
-                        }
-                    }
-                }
-            }
-        }
+            for (const auto &[dofs_on_neighbor, add_neighbor_block] :
+                 cell_couplings.reverse_couplings)
+              {
+                constraints.add_entries_local_to_global(
+                  dofs_on_neighbor,
+                  cell_couplings.dofs_on_this_cell,
+                  sparsity,
+                  keep_constrained_dofs);
+                if (add_neighbor_block)
+                  constraints.add_entries_local_to_global(
+                    dofs_on_neighbor, sparsity, keep_constrained_dofs);
+              }
+          }
+      }
   }
 
 
@@ -1271,8 +1271,8 @@ FiniteElement<dim, spacedim>::get_face_data(
 {
   return get_data(flags,
                   mapping,
-                  QProjector<dim>::project_to_all_faces(this->reference_cell(),
-                                                        quadrature),
+                  *QProjector<dim>::project_to_all_faces_shared(
+                    this->reference_cell(), quadrature),
                   output_data);
 }
 
@@ -1290,8 +1290,8 @@ FiniteElement<dim, spacedim>::get_face_data(
 {
   return get_data(flags,
                   mapping,
-                  QProjector<dim>::project_to_all_faces(this->reference_cell(),
-                                                        quadrature),
+                  *QProjector<dim>::project_to_all_faces_shared(
+                    this->reference_cell(), quadrature),
                   output_data);
 }
 
@@ -1369,7 +1369,7 @@ FiniteElement<dim, spacedim>::get_subface_data(
 {
   return get_data(flags,
                   mapping,
-                  QProjector<dim>::project_to_all_subfaces(
+                  *QProjector<dim>::project_to_all_subfaces_shared(
                     this->reference_cell(), quadrature),
                   output_data);
 }
@@ -33,8 +33,11 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <deque>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 
 
@@ -55,6 +58,72 @@ namespace internal
         else
           return std::vector<Point<1>>(1, Point<1>(0.5));
       }
+
+
+
+      /**
+       * The maximal number of matrix sets kept by
+       * get_cached_isotropic_matrices().
+       */
+      constexpr unsigned int max_n_cached_matrix_sets = 16;
+
+
+
+      /**
+       * Return the matrices of the isotropic refinement case computed by
+       * @p compute, which are looked up in a cache shared by all elements of
+       * the program. The computation of these matrices with
+       * FETools::compute_embedding_matrices() and
+       * FETools::compute_projection_matrices() involves dense solves that
+       * take seconds for high polynomial degrees in 3d, and programs often
+       * create many equal elements, e.g., in hp::FECollection objects, in
+       * FESystem objects, or for each level of a multigrid hierarchy. The
+       * elements are identified by their name and their support points,
+       * since the name does not specify arbitrary nodes uniquely.
+       *
+       * The cache only saves compute time, not memory: every element still
+       * stores its own copy of the matrices. To bound the memory held by the
+       * cache itself, it keeps at most max_n_cached_matrix_sets sets of
+       * matrices and drops the oldest one when a new one gets added.
+       */
+      template <int dim, int spacedim, typename ComputeFunction>
+      std::vector<FullMatrix<double>>
+      get_cached_isotropic_matrices(const FiniteElement<dim, spacedim> &fe,
+                                    const bool             prolongation,
+                                    const ComputeFunction &compute)
+      {
+        static std::mutex mutex;
+        static std::map<std::string, std::vector<FullMatrix<double>>> cache;
+        static std::deque<std::string> insertion_order;
+
+        std::string key = (prolongation ? "P" : "R") + fe.get_name();
+        for (const Point<dim> &p : fe.get_unit_support_points())
+          key.append(reinterpret_cast<const char *>(p.begin_raw()),
+                     dim * sizeof(double));
+
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          const auto                  it = cache.find(key);
+          if (it != cache.end())
+            return it->second;
+        }
+
+        // compute without holding the lock, so that other elements can be
+        // set up concurrently
+        std::vector<FullMatrix<double>> matrices = compute();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (cache.emplace(key, matrices).second)
+          {
+            insertion_order.push_back(key);
+            if (insertion_order.size() > max_n_cached_matrix_sets)
+              {
+                cache.erase(insertion_order.front());
+                insertion_order.pop_front();
+              }
+          }
+        return matrices;
+      }
     } // namespace
   }   // namespace FE_DGQ
 } // namespace internal
@@ -448,22 +517,25 @@ FE_DGQ<dim, spacedim>::get_prolongation_matrix(
         const_cast<FE_DGQ<dim, spacedim> &>(*this);
       if (refinement_case == RefinementCase<dim>::isotropic_refinement)
         {
-          std::vector<std::vector<FullMatrix<double>>> isotropic_matrices(
-            RefinementCase<dim>::isotropic_refinement);
-          isotropic_matrices.back().resize(
-            GeometryInfo<dim>::n_children(RefinementCase<dim>(refinement_case)),
-            FullMatrix<double>(this->n_dofs_per_cell(),
-                               this->n_dofs_per_cell()));
-          if (dim == spacedim)
-            FETools::compute_embedding_matrices(*this,
-                                                isotropic_matrices,
-                                                true);
-          else
-            FETools::compute_embedding_matrices(FE_DGQ<dim>(this->degree),
-                                                isotropic_matrices,
-                                                true);
           this_nonconst.prolongation[refinement_case - 1] =
-            std::move(isotropic_matrices.back());
+            internal::FE_DGQ::get_cached_isotropic_matrices(*this, true, [&]() {
+              std::vector<std::vector<FullMatrix<double>>> isotropic_matrices(
+                RefinementCase<dim>::isotropic_refinement);
+              isotropic_matrices.back().resize(
+                GeometryInfo<dim>::n_children(
+                  RefinementCase<dim>(refinement_case)),
+                FullMatrix<double>(this->n_dofs_per_cell(),
+                                   this->n_dofs_per_cell()));
+              if (dim == spacedim)
+                FETools::compute_embedding_matrices(*this,
+                                                    isotropic_matrices,
+                                                    true);
+              else
+                FETools::compute_embedding_matrices(FE_DGQ<dim>(this->degree),
+                                                    isotropic_matrices,
+                                                    true);
+              return std::move(isotropic_matrices.back());
+            });
         }
       else
         {
@@ -524,22 +596,25 @@ FE_DGQ<dim, spacedim>::get_restriction_matrix(
         const_cast<FE_DGQ<dim, spacedim> &>(*this);
       if (refinement_case == RefinementCase<dim>::isotropic_refinement)
         {
-          std::vector<std::vector<FullMatrix<double>>> isotropic_matrices(
-            RefinementCase<dim>::isotropic_refinement);
-          isotropic_matrices.back().resize(
-            GeometryInfo<dim>::n_children(RefinementCase<dim>(refinement_case)),
-            FullMatrix<double>(this->n_dofs_per_cell(),
-                               this->n_dofs_per_cell()));
-          if (dim == spacedim)
-            FETools::compute_projection_matrices(*this,
-                                                 isotropic_matrices,
-                                                 true);
-          else
-            FETools::compute_projection_matrices(FE_DGQ<dim>(this->degree),
-                                                 isotropic_matrices,
-                                                 true);
           this_nonconst.restriction[refinement_case - 1] =
-            std::move(isotropic_matrices.back());
+            internal::FE_DGQ::get_cached_isotropic_matrices(
+              *this, false, [&]() {
+                std::vector<std::vector<FullMatrix<double>>>
+                  isotropic_matrices(RefinementCase<dim>::isotropic_refinement);
+                isotropic_matrices.back().resize(
+                  GeometryInfo<dim>::n_children(
+                    RefinementCase<dim>(refinement_case)),
+                  FullMatrix<double>(this->n_dofs_per_cell(),
+                                     this->n_dofs_per_cell()));
+                if (dim == spacedim)
+                  FETools::compute_projection_matrices(*this,
+                                                       isotropic_matrices,
+                                                       true);
+                else
+                  FETools::compute_projection_matrices(
+                    FE_DGQ<dim>(this->degree), isotropic_matrices, true);
+                return std::move(isotropic_matrices.back());
+              });
         }
       else
         {
@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/lazy.h>
 #include <deal.II/base/polynomials_piecewise.h>
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/quadrature.h>
@@ -36,6 +37,9 @@
 
 #include <memory>
 #include <sstream>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
 #include <vector>
 
 DEAL_II_NAMESPACE_OPEN
@@ -75,6 +79,70 @@ namespace internal
               indices[d + 1]++;
             }
       }
+
+
+
+      // Key into the tables of transfer matrices shared by all elements: the
+      // dynamic type of the element, whether it is a prolongation (true) or
+      // restriction (false) matrix, the refinement case, the child, and the
+      // coordinates of the unit support points of the element.
+      using TransferMatrixKey = std::tuple<std::type_index,
+                                           bool,
+                                           unsigned int,
+                                           unsigned int,
+                                           std::vector<double>>;
+
+
+
+      template <int dim, int spacedim>
+      TransferMatrixKey
+      make_transfer_matrix_key(const FiniteElement<dim, spacedim> &fe,
+                               const bool                          prolongation,
+                               const unsigned int                  child,
+                               const RefinementCase<dim> &refinement_case)
+      {
+        const std::vector<Point<dim>> &support_points =
+          fe.get_unit_support_points();
+        std::vector<double> coordinates;
+        coordinates.reserve(support_points.size() * dim);
+        for (const Point<dim> &point : support_points)
+          for (unsigned int d = 0; d < dim; ++d)
+            coordinates.push_back(point[d]);
+
+        return {std::type_index(typeid(fe)),
+                prolongation,
+                static_cast<unsigned int>(refinement_case),
+                child,
+                std::move(coordinates)};
+      }
+
+
+
+      // The prolongation and restriction matrices are expensive to compute
+      // for high polynomial degrees, but only depend on the kind of element
+      // and its support points. Programs often create many identical
+      // elements (e.g., in FECollection objects or in every call of a
+      // function), so compute each matrix only once and share it.
+      LazyRegistry<TransferMatrixKey, FullMatrix<double>> &
+      get_transfer_matrix_registry()
+      {
+        static LazyRegistry<TransferMatrixKey, FullMatrix<double>> registry;
+        return registry;
+      }
+
+
+
+      // The same for the interface constraints, which only depend on the
+      // kind of element and its 1d support points.
+      LazyRegistry<std::pair<std::type_index, std::vector<double>>,
+                   FullMatrix<double>> &
+      get_constraint_matrix_registry()
+      {
+        static LazyRegistry<std::pair<std::type_index, std::vector<double>>,
+                            FullMatrix<double>>
+          registry;
+        return registry;
+      }
     } // namespace
   }   // namespace FE_Q_Base
 } // namespace internal
@@ -1234,7 +1302,19 @@ void
 FE_Q_Base<dim, spacedim>::initialize_constraints(
   const std::vector<Point<1>> &points)
 {
-  Implementation::initialize_constraints(points, *this);
+  // the constraints are the same for all elements of the same kind with the
+  // same support points, so only compute them for the first such element
+  std::vector<double> key_points(points.size());
+  for (unsigned int i = 0; i < points.size(); ++i)
+    key_points[i] = points[i][0];
+
+  this->interface_constraints =
+    *internal::FE_Q_Base::get_constraint_matrix_registry().get_or_create(
+      std::make_pair(std::type_index(typeid(*this)), std::move(key_points)),
+      [&]() {
+        Implementation::initialize_constraints(points, *this);
+        return this->interface_constraints;
+      });
 }
 
 
@@ -1262,174 +1342,185 @@ FE_Q_Base<dim, spacedim>::get_prolongation_matrix(
           this->n_dofs_per_cell())
         return this->prolongation[refinement_case - 1][child];
 
-      // distinguish q/q_dg0 case: only treat Q dofs first
-      const unsigned int q_dofs_per_cell =
-        Utilities::fixed_power<dim>(q_degree + 1);
+      const auto compute_matrix = [&]() {
+        // distinguish q/q_dg0 case: only treat Q dofs first
+        const unsigned int q_dofs_per_cell =
+          Utilities::fixed_power<dim>(q_degree + 1);
 
-      // compute the interpolation matrices in much the same way as we do for
-      // the constraints. it's actually simpler here, since we don't have this
-      // weird renumbering stuff going on. The trick is again that we the
-      // interpolation matrix is formed by a permutation of the indices of the
-      // cell matrix. The value eps is used a threshold to decide when certain
-      // evaluations of the Lagrange polynomials are zero or one.
-      const double eps = 1e-15 * q_degree * dim;
+        // compute the interpolation matrices in much the same way as we do for
+        // the constraints. it's actually simpler here, since we don't have this
+        // weird renumbering stuff going on. The trick is again that we the
+        // interpolation matrix is formed by a permutation of the indices of the
+        // cell matrix. The value eps is used a threshold to decide when certain
+        // evaluations of the Lagrange polynomials are zero or one.
+        const double eps = 1e-15 * q_degree * dim;
 
 #  ifdef DEBUG
-      // in DEBUG mode, check that the evaluation of support points in the
-      // current numbering gives the identity operation
-      for (unsigned int i = 0; i < q_dofs_per_cell; ++i)
-        {
-          Assert(std::fabs(1. - this->poly_space->compute_value(
-                                  i, this->unit_support_points[i])) < eps,
-                 ExcInternalError("The Lagrange polynomial does not evaluate "
-                                  "to one or zero in a nodal point. "
-                                  "This typically indicates that the "
-                                  "polynomial interpolation is "
-                                  "ill-conditioned such that round-off "
-                                  "prevents the sum to be one."));
-          for (unsigned int j = 0; j < q_dofs_per_cell; ++j)
-            if (j != i)
-              Assert(std::fabs(this->poly_space->compute_value(
-                       i, this->unit_support_points[j])) < eps,
-                     ExcInternalError(
-                       "The Lagrange polynomial does not evaluate "
-                       "to one or zero in a nodal point. "
-                       "This typically indicates that the "
-                       "polynomial interpolation is "
-                       "ill-conditioned such that round-off "
-                       "prevents the sum to be one."));
-        }
-#  endif
-
-      // to efficiently evaluate the polynomial at the subcell, make use of
-      // the tensor product structure of this element and only evaluate 1d
-      // information from the polynomial. This makes the cost of this function
-      // almost negligible also for high order elements
-      const unsigned int            dofs1d = q_degree + 1;
-      std::vector<Table<2, double>> subcell_evaluations(
-        dim, Table<2, double>(dofs1d, dofs1d));
-
-      const std::vector<unsigned int> &index_map_inverse =
-        this->get_poly_space_numbering_inverse();
-
-      // helper value: step size how to walk through diagonal and how many
-      // points we have left apart from the first dimension
-      unsigned int step_size_diag = 0;
-      {
-        unsigned int factor = 1;
-        for (unsigned int d = 0; d < dim; ++d)
+        // in DEBUG mode, check that the evaluation of support points in the
+        // current numbering gives the identity operation
+        for (unsigned int i = 0; i < q_dofs_per_cell; ++i)
           {
-            step_size_diag += factor;
-            factor *= dofs1d;
+            Assert(std::fabs(1. - this->poly_space->compute_value(
+                                    i, this->unit_support_points[i])) < eps,
+                   ExcInternalError("The Lagrange polynomial does not evaluate "
+                                    "to one or zero in a nodal point. "
+                                    "This typically indicates that the "
+                                    "polynomial interpolation is "
+                                    "ill-conditioned such that round-off "
+                                    "prevents the sum to be one."));
+            for (unsigned int j = 0; j < q_dofs_per_cell; ++j)
+              if (j != i)
+                Assert(std::fabs(this->poly_space->compute_value(
+                         i, this->unit_support_points[j])) < eps,
+                       ExcInternalError(
+                         "The Lagrange polynomial does not evaluate "
+                         "to one or zero in a nodal point. "
+                         "This typically indicates that the "
+                         "polynomial interpolation is "
+                         "ill-conditioned such that round-off "
+                         "prevents the sum to be one."));
           }
-      }
+#  endif
 
-      FullMatrix<double> prolongate(this->n_dofs_per_cell(),
-                                    this->n_dofs_per_cell());
+        // to efficiently evaluate the polynomial at the subcell, make use of
+        // the tensor product structure of this element and only evaluate 1d
+        // information from the polynomial. This makes the cost of this function
+        // almost negligible also for high order elements
+        const unsigned int            dofs1d = q_degree + 1;
+        std::vector<Table<2, double>> subcell_evaluations(
+          dim, Table<2, double>(dofs1d, dofs1d));
 
-      // go through the points in diagonal to capture variation in all
-      // directions simultaneously
-      for (unsigned int j = 0; j < dofs1d; ++j)
-        {
-          const unsigned int diag_comp = index_map_inverse[j * step_size_diag];
-          const Point<dim>   p_subcell = this->unit_support_points[diag_comp];
-          const Point<dim>   p_cell =
-            GeometryInfo<dim>::child_to_cell_coordinates(p_subcell,
-                                                         child,
-                                                         refinement_case);
-          for (unsigned int i = 0; i < dofs1d; ++i)
-            for (unsigned int d = 0; d < dim; ++d)
-              {
-                // evaluate along line where only x is different from zero
-                Point<dim> point;
-                point[0] = p_cell[d];
-                const double cell_value =
-                  this->poly_space->compute_value(index_map_inverse[i], point);
-
-                // cut off values that are too small. note that we have here
-                // Lagrange interpolation functions, so they should be zero at
-                // almost all points, and one at the others, at least on the
-                // subcells. so set them to their exact values
-                //
-                // the actual cut-off value is somewhat fuzzy, but it works
-                // for 2e-13*degree*dim (see above), which is kind of
-                // reasonable given that we compute the values of the
-                // polynomials via an degree-step recursion and then multiply
-                // the 1d-values. this gives us a linear growth in degree*dim,
-                // times a small constant.
-                //
-                // the embedding matrix is given by applying the inverse of
-                // the subcell matrix on the cell_interpolation matrix. since
-                // the subcell matrix is actually only a permutation vector,
-                // all we need to do is to switch the rows we write the data
-                // into. moreover, cut off very small values here
-                if (std::fabs(cell_value) < eps)
-                  subcell_evaluations[d](j, i) = 0;
-                else
-                  subcell_evaluations[d](j, i) = cell_value;
-              }
-        }
+        const std::vector<unsigned int> &index_map_inverse =
+          this->get_poly_space_numbering_inverse();
 
-      // now expand from 1d info. block innermost dimension (x_0) in order to
-      // avoid difficult checks at innermost loop
-      unsigned int j_indices[dim];
-      internal::FE_Q_Base::zero_indices<dim>(j_indices);
-      for (unsigned int j = 0; j < q_dofs_per_cell; j += dofs1d)
+        // helper value: step size how to walk through diagonal and how many
+        // points we have left apart from the first dimension
+        unsigned int step_size_diag = 0;
         {
-          unsigned int i_indices[dim];
-          internal::FE_Q_Base::zero_indices<dim>(i_indices);
-          for (unsigned int i = 0; i < q_dofs_per_cell; i += dofs1d)
+          unsigned int factor = 1;
+          for (unsigned int d = 0; d < dim; ++d)
             {
-              double val_extra_dim = 1.;
-              for (unsigned int d = 1; d < dim; ++d)
-                val_extra_dim *=
-                  subcell_evaluations[d](j_indices[d - 1], i_indices[d - 1]);
-
-              // innermost sum where we actually compute. the same as
-              // prolongate(j,i) = this->poly_space->compute_value (i, p_cell)
-              for (unsigned int jj = 0; jj < dofs1d; ++jj)
+              step_size_diag += factor;
+              factor *= dofs1d;
+            }
+        }
+
+        FullMatrix<double> prolongate(this->n_dofs_per_cell(),
+                                      this->n_dofs_per_cell());
+
+        // go through the points in diagonal to capture variation in all
+        // directions simultaneously
+        for (unsigned int j = 0; j < dofs1d; ++j)
+          {
+            const unsigned int diag_comp =
+              index_map_inverse[j * step_size_diag];
+            const Point<dim>   p_subcell = this->unit_support_points[diag_comp];
+            const Point<dim>   p_cell =
+              GeometryInfo<dim>::child_to_cell_coordinates(p_subcell,
+                                                           child,
+                                                           refinement_case);
+            for (unsigned int i = 0; i < dofs1d; ++i)
+              for (unsigned int d = 0; d < dim; ++d)
                 {
-                  const unsigned int j_ind = index_map_inverse[j + jj];
-                  for (unsigned int ii = 0; ii < dofs1d; ++ii)
-                    prolongate(j_ind, index_map_inverse[i + ii]) =
-                      val_extra_dim * subcell_evaluations[0](jj, ii);
+                  // evaluate along line where only x is different from zero
+                  Point<dim> point;
+                  point[0] = p_cell[d];
+                  const double cell_value =
+                    this->poly_space->compute_value(index_map_inverse[i],
+                                                    point);
+
+                  // cut off values that are too small. note that we have here
+                  // Lagrange interpolation functions, so they should be zero at
+                  // almost all points, and one at the others, at least on the
+                  // subcells. so set them to their exact values
+                  //
+                  // the actual cut-off value is somewhat fuzzy, but it works
+                  // for 2e-13*degree*dim (see above), which is kind of
+                  // reasonable given that we compute the values of the
+                  // polynomials via an degree-step recursion and then multiply
+                  // the 1d-values. this gives us a linear growth in degree*dim,
+                  // times a small constant.
+                  //
+                  // the embedding matrix is given by applying the inverse of
+                  // the subcell matrix on the cell_interpolation matrix. since
+                  // the subcell matrix is actually only a permutation vector,
+                  // all we need to do is to switch the rows we write the data
+                  // into. moreover, cut off very small values here
+                  if (std::fabs(cell_value) < eps)
+                    subcell_evaluations[d](j, i) = 0;
+                  else
+                    subcell_evaluations[d](j, i) = cell_value;
                 }
+          }
 
-              // update indices that denote the tensor product position. a bit
-              // fuzzy and therefore not done for innermost x_0 direction
-              internal::FE_Q_Base::increment_indices<dim>(i_indices, dofs1d);
-            }
-          Assert(i_indices[dim - 1] == 1, ExcInternalError());
-          internal::FE_Q_Base::increment_indices<dim>(j_indices, dofs1d);
-        }
+        // now expand from 1d info. block innermost dimension (x_0) in order to
+        // avoid difficult checks at innermost loop
+        unsigned int j_indices[dim];
+        internal::FE_Q_Base::zero_indices<dim>(j_indices);
+        for (unsigned int j = 0; j < q_dofs_per_cell; j += dofs1d)
+          {
+            unsigned int i_indices[dim];
+            internal::FE_Q_Base::zero_indices<dim>(i_indices);
+            for (unsigned int i = 0; i < q_dofs_per_cell; i += dofs1d)
+              {
+                double val_extra_dim = 1.;
+                for (unsigned int d = 1; d < dim; ++d)
+                  val_extra_dim *=
+                    subcell_evaluations[d](j_indices[d - 1], i_indices[d - 1]);
+
+                // innermost sum where we actually compute. the same as
+                // prolongate(j,i) = this->poly_space->compute_value (i, p_cell)
+                for (unsigned int jj = 0; jj < dofs1d; ++jj)
+                  {
+                    const unsigned int j_ind = index_map_inverse[j + jj];
+                    for (unsigned int ii = 0; ii < dofs1d; ++ii)
+                      prolongate(j_ind, index_map_inverse[i + ii]) =
+                        val_extra_dim * subcell_evaluations[0](jj, ii);
+                  }
 
-      // the discontinuous node is simply mapped on the discontinuous node on
-      // the child element
-      if (q_dofs_per_cell < this->n_dofs_per_cell())
-        prolongate(q_dofs_per_cell, q_dofs_per_cell) = 1.;
+                // update indices that denote the tensor product position. a bit
+                // fuzzy and therefore not done for innermost x_0 direction
+                internal::FE_Q_Base::increment_indices<dim>(i_indices, dofs1d);
+              }
+            Assert(i_indices[dim - 1] == 1, ExcInternalError());
+            internal::FE_Q_Base::increment_indices<dim>(j_indices, dofs1d);
+          }
+
+        // the discontinuous node is simply mapped on the discontinuous node on
+        // the child element
+        if (q_dofs_per_cell < this->n_dofs_per_cell())
+          prolongate(q_dofs_per_cell, q_dofs_per_cell) = 1.;
 
-        // and make sure that the row sum is 1. this must be so since for this
-        // element, the shape functions add up to one
+          // and make sure that the row sum is 1. this must be so since for this
+          // element, the shape functions add up to one
 #  ifdef DEBUG
-      for (unsigned int row = 0; row < this->n_dofs_per_cell(); ++row)
-        {
-          double sum = 0;
-          for (unsigned int col = 0; col < this->n_dofs_per_cell(); ++col)
-            sum += prolongate(row, col);
-          Assert(std::fabs(sum - 1.) <
-                   std::max(eps, 5e-16 * std::sqrt(this->n_dofs_per_cell())),
-                 ExcInternalError("The entries in a row of the local "
-                                  "prolongation matrix do not add to one. "
-                                  "This typically indicates that the "
-                                  "polynomial interpolation is "
-                                  "ill-conditioned such that round-off "
-                                  "prevents the sum to be one."));
-        }
+        for (unsigned int row = 0; row < this->n_dofs_per_cell(); ++row)
+          {
+            double sum = 0;
+            for (unsigned int col = 0; col < this->n_dofs_per_cell(); ++col)
+              sum += prolongate(row, col);
+            Assert(std::fabs(sum - 1.) <
+                     std::max(eps, 5e-16 * std::sqrt(this->n_dofs_per_cell())),
+                   ExcInternalError("The entries in a row of the local "
+                                    "prolongation matrix do not add to one. "
+                                    "This typically indicates that the "
+                                    "polynomial interpolation is "
+                                    "ill-conditioned such that round-off "
+                                    "prevents the sum to be one."));
+          }
 #  endif
+        return prolongate;
+      };
 
-      // move result into place
+      // the matrix only depends on the kind of element and its support
+      // points, so look it up in (or add it to) the table shared by all
+      // elements, and copy it into place
       const_cast<FullMatrix<double> &>(
-        this->prolongation[refinement_case - 1][child]) = std::move(prolongate);
+        this->prolongation[refinement_case - 1][child]) =
+        *internal::FE_Q_Base::get_transfer_matrix_registry().get_or_create(
+          internal::FE_Q_Base::make_transfer_matrix_key(
+            *this, true, child, refinement_case),
+          compute_matrix);
     }
 
   // finally return the matrix
@@ -1461,116 +1552,124 @@ FE_Q_Base<dim, spacedim>::get_restriction_matrix(
           this->n_dofs_per_cell())
         return this->restriction[refinement_case - 1][child];
 
-      FullMatrix<double> my_restriction(this->n_dofs_per_cell(),
-                                        this->n_dofs_per_cell());
-      // distinguish q/q_dg0 case
-      const unsigned int q_dofs_per_cell =
-        Utilities::fixed_power<dim>(q_degree + 1);
-
-      // for Lagrange interpolation polynomials based on equidistant points,
-      // construction of the restriction matrices is relatively simple. the
-      // reason is that in this case the interpolation points on the mother
-      // cell are always also interpolation points for some shape function on
-      // one or the other child.
-      //
-      // in the general case with non-equidistant points, we need to actually
-      // do an interpolation. thus, we take the interpolation points on the
-      // mother cell and evaluate the shape functions of the child cell on
-      // those points. it does not hurt in the equidistant case because then
-      // simple one shape function evaluates to one and the others to zero.
-      //
-      // this element is non-additive in all its degrees of freedom by
-      // default, which requires care in downstream use. fortunately, even the
-      // interpolation on non-equidistant points is invariant under the
-      // assumption that whenever a row makes a non-zero contribution to the
-      // mother's residual, the correct value is interpolated.
-
-      const double                     eps = 1e-15 * q_degree * dim;
-      const std::vector<unsigned int> &index_map_inverse =
-        this->get_poly_space_numbering_inverse();
-
-      const unsigned int          dofs1d = q_degree + 1;
-      std::vector<Tensor<1, dim>> evaluations1d(dofs1d);
-
-      my_restriction.reinit(this->n_dofs_per_cell(), this->n_dofs_per_cell());
-
-      for (unsigned int i = 0; i < q_dofs_per_cell; ++i)
-        {
-          unsigned int     mother_dof = index_map_inverse[i];
-          const Point<dim> p_cell     = this->unit_support_points[mother_dof];
-
-          // check whether this interpolation point is inside this child cell
-          const Point<dim> p_subcell =
-            GeometryInfo<dim>::cell_to_child_coordinates(p_cell,
-                                                         child,
-                                                         refinement_case);
-          if (GeometryInfo<dim>::is_inside_unit_cell(p_subcell))
-            {
-              // same logic as in initialize_embedding to evaluate the
-              // polynomial faster than from the tensor product: since we
-              // evaluate all polynomials, it is much faster to just compute
-              // the 1d values for all polynomials before and then get the
-              // dim-data.
-              for (unsigned int j = 0; j < dofs1d; ++j)
-                for (unsigned int d = 0; d < dim; ++d)
-                  {
-                    Point<dim> point;
-                    point[0] = p_subcell[d];
-                    evaluations1d[j][d] =
-                      this->poly_space->compute_value(index_map_inverse[j],
-                                                      point);
-                  }
-              unsigned int j_indices[dim];
-              internal::FE_Q_Base::zero_indices<dim>(j_indices);
-              double sum_check = 0;
-              for (unsigned int j = 0; j < q_dofs_per_cell; j += dofs1d)
-                {
-                  double val_extra_dim = 1.;
-                  for (unsigned int d = 1; d < dim; ++d)
-                    val_extra_dim *= evaluations1d[j_indices[d - 1]][d];
-                  for (unsigned int jj = 0; jj < dofs1d; ++jj)
+      const auto compute_matrix = [&]() {
+        FullMatrix<double> my_restriction(this->n_dofs_per_cell(),
+                                          this->n_dofs_per_cell());
+        // distinguish q/q_dg0 case
+        const unsigned int q_dofs_per_cell =
+          Utilities::fixed_power<dim>(q_degree + 1);
+
+        // for Lagrange interpolation polynomials based on equidistant points,
+        // construction of the restriction matrices is relatively simple. the
+        // reason is that in this case the interpolation points on the mother
+        // cell are always also interpolation points for some shape function on
+        // one or the other child.
+        //
+        // in the general case with non-equidistant points, we need to actually
+        // do an interpolation. thus, we take the interpolation points on the
+        // mother cell and evaluate the shape functions of the child cell on
+        // those points. it does not hurt in the equidistant case because then
+        // simple one shape function evaluates to one and the others to zero.
+        //
+        // this element is non-additive in all its degrees of freedom by
+        // default, which requires care in downstream use. fortunately, even the
+        // interpolation on non-equidistant points is invariant under the
+        // assumption that whenever a row makes a non-zero contribution to the
+        // mother's residual, the correct value is interpolated.
+
+        const double                     eps = 1e-15 * q_degree * dim;
+        const std::vector<unsigned int> &index_map_inverse =
+          this->get_poly_space_numbering_inverse();
+
+        const unsigned int          dofs1d = q_degree + 1;
+        std::vector<Tensor<1, dim>> evaluations1d(dofs1d);
+
+        my_restriction.reinit(this->n_dofs_per_cell(), this->n_dofs_per_cell());
+
+        for (unsigned int i = 0; i < q_dofs_per_cell; ++i)
+          {
+            unsigned int     mother_dof = index_map_inverse[i];
+            const Point<dim> p_cell     = this->unit_support_points[mother_dof];
+
+            // check whether this interpolation point is inside this child cell
+            const Point<dim> p_subcell =
+              GeometryInfo<dim>::cell_to_child_coordinates(p_cell,
+                                                           child,
+                                                           refinement_case);
+            if (GeometryInfo<dim>::is_inside_unit_cell(p_subcell))
+              {
+                // same logic as in initialize_embedding to evaluate the
+                // polynomial faster than from the tensor product: since we
+                // evaluate all polynomials, it is much faster to just compute
+                // the 1d values for all polynomials before and then get the
+                // dim-data.
+                for (unsigned int j = 0; j < dofs1d; ++j)
+                  for (unsigned int d = 0; d < dim; ++d)
                     {
-                      // find the child shape function(s) corresponding to
-                      // this point. Usually this is just one function;
-                      // however, when we use FE_Q on arbitrary nodes a parent
-                      // support point might not be a child support point, and
-                      // then we will get more than one nonzero value per
-                      // row. Still, the values should sum up to 1
-                      const double val = val_extra_dim * evaluations1d[jj][0];
-                      const unsigned int child_dof = index_map_inverse[j + jj];
-                      if (std::fabs(val - 1.) < eps)
-                        my_restriction(mother_dof, child_dof) = 1.;
-                      else if (std::fabs(val) > eps)
-                        my_restriction(mother_dof, child_dof) = val;
-                      sum_check += val;
+                      Point<dim> point;
+                      point[0] = p_subcell[d];
+                      evaluations1d[j][d] =
+                        this->poly_space->compute_value(index_map_inverse[j],
+                                                        point);
                     }
-                  internal::FE_Q_Base::increment_indices<dim>(j_indices,
-                                                              dofs1d);
-                }
-              (void)sum_check;
-              Assert(std::fabs(sum_check - 1.0) <
-                       std::max(eps,
-                                5e-16 * std::sqrt(this->n_dofs_per_cell())),
-                     ExcInternalError("The entries in a row of the local "
-                                      "restriction matrix do not add to one. "
-                                      "This typically indicates that the "
-                                      "polynomial interpolation is "
-                                      "ill-conditioned such that round-off "
-                                      "prevents the sum to be one."));
-            }
+                unsigned int j_indices[dim];
+                internal::FE_Q_Base::zero_indices<dim>(j_indices);
+                double sum_check = 0;
+                for (unsigned int j = 0; j < q_dofs_per_cell; j += dofs1d)
+                  {
+                    double val_extra_dim = 1.;
+                    for (unsigned int d = 1; d < dim; ++d)
+                      val_extra_dim *= evaluations1d[j_indices[d - 1]][d];
+                    for (unsigned int jj = 0; jj < dofs1d; ++jj)
+                      {
+                        // find the child shape function(s) corresponding to
+                        // this point. Usually this is just one function;
+                        // however, when we use FE_Q on arbitrary nodes a parent
+                        // support point might not be a child support point, and
+                        // then we will get more than one nonzero value per
+                        // row. Still, the values should sum up to 1
+                        const double val = val_extra_dim * evaluations1d[jj][0];
+                        const unsigned int child_dof =
+                          index_map_inverse[j + jj];
+                        if (std::fabs(val - 1.) < eps)
+                          my_restriction(mother_dof, child_dof) = 1.;
+                        else if (std::fabs(val) > eps)
+                          my_restriction(mother_dof, child_dof) = val;
+                        sum_check += val;
+                      }
+                    internal::FE_Q_Base::increment_indices<dim>(j_indices,
+                                                                dofs1d);
+                  }
+                (void)sum_check;
+                Assert(std::fabs(sum_check - 1.0) <
+                         std::max(eps,
+                                  5e-16 * std::sqrt(this->n_dofs_per_cell())),
+                       ExcInternalError("The entries in a row of the local "
+                                        "restriction matrix do not add to one. "
+                                        "This typically indicates that the "
+                                        "polynomial interpolation is "
+                                        "ill-conditioned such that round-off "
+                                        "prevents the sum to be one."));
+              }
 
-          // part for FE_Q_DG0
-          if (q_dofs_per_cell < this->n_dofs_per_cell())
-            my_restriction(this->n_dofs_per_cell() - 1,
-                           this->n_dofs_per_cell() - 1) =
-              1. / GeometryInfo<dim>::n_children(
-                     RefinementCase<dim>(refinement_case));
-        }
+            // part for FE_Q_DG0
+            if (q_dofs_per_cell < this->n_dofs_per_cell())
+              my_restriction(this->n_dofs_per_cell() - 1,
+                             this->n_dofs_per_cell() - 1) =
+                1. / GeometryInfo<dim>::n_children(
+                       RefinementCase<dim>(refinement_case));
+          }
+        return my_restriction;
+      };
 
-      // move result into place
+      // same as for the prolongation matrices: share the matrix among all
+      // elements of the same kind
       const_cast<FullMatrix<double> &>(
         this->restriction[refinement_case - 1][child]) =
-        std::move(my_restriction);
+        *internal::FE_Q_Base::get_transfer_matrix_registry().get_or_create(
+          internal::FE_Q_Base::make_transfer_matrix_key(
+            *this, false, child, refinement_case),
+          compute_matrix);
     }
 
   return this->restriction[refinement_case - 1][child];
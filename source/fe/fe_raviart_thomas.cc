@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/lazy.h>
 #include <deal.II/base/polynomial.h>
 #include <deal.II/base/polynomials_raviart_thomas.h>
 #include <deal.II/base/qprojector.h>
@@ -40,6 +41,35 @@
 DEAL_II_NAMESPACE_OPEN
 
 
+namespace
+{
+  // The matrices computed in the constructor of FE_RaviartThomas only depend
+  // on the dimension and the degree of the element. Their computation
+  // involves the inversion of the node matrix and the evaluation of all shape
+  // functions in many points, which dominates the cost of creating an element
+  // of higher degree. We therefore compute them only for the first element of
+  // each degree and share them with all elements created later on.
+  struct RaviartThomasMatrices
+  {
+    FullMatrix<double>                           inverse_node_matrix;
+    std::vector<std::vector<FullMatrix<double>>> prolongation;
+    std::vector<std::vector<FullMatrix<double>>> restriction;
+    FullMatrix<double>                           interface_constraints;
+  };
+
+
+
+  template <int dim>
+  LazyRegistry<unsigned int, RaviartThomasMatrices> &
+  get_matrix_registry()
+  {
+    static LazyRegistry<unsigned int, RaviartThomasMatrices> registry;
+    return registry;
+  }
+} // namespace
+
+
+
 template <int dim>
 FE_RaviartThomas<dim>::FE_RaviartThomas(const unsigned int deg)
   : FE_PolyTensor<dim>(
@@ -65,52 +95,71 @@ FE_RaviartThomas<dim>::FE_RaviartThomas(const unsigned int deg)
   // are required for interpolation.
   initialize_support_points(deg);
 
-  // Now compute the inverse node matrix, generating the correct
-  // basis functions from the raw ones. For a discussion of what
-  // exactly happens here, see FETools::compute_node_matrix.
-  const FullMatrix<double> M = FETools::compute_node_matrix(*this);
-  this->inverse_node_matrix.reinit(n_dofs, n_dofs);
-  this->inverse_node_matrix.invert(M);
-  // From now on, the shape functions provided by FiniteElement::shape_value
-  // and similar functions will be the correct ones, not
-  // the raw shape functions from the polynomial space anymore.
-
   // Reinit the vectors of
   // restriction and prolongation
   // matrices to the right sizes.
   // Restriction only for isotropic
   // refinement
   this->reinit_restriction_and_prolongation_matrices(true);
-  // Fill prolongation matrices with embedding operators
-  FETools::compute_embedding_matrices(*this, this->prolongation);
-  initialize_restriction();
-
-  // TODO: the implementation makes the assumption that all faces have the
-  // same number of dofs
-  AssertDimension(this->n_unique_faces(), 1);
-  const unsigned int face_no = 0;
 
-  // TODO[TL]: for anisotropic refinement we will probably need a table of
-  // submatrices with an array for each refine case
-  FullMatrix<double> face_embeddings[GeometryInfo<dim>::max_children_per_face];
-  for (unsigned int i = 0; i < GeometryInfo<dim>::max_children_per_face; ++i)
-    face_embeddings[i].reinit(this->n_dofs_per_face(face_no),
-                              this->n_dofs_per_face(face_no));
-  FETools::compute_face_embedding_matrices<dim, double>(*this,
-                                                        face_embeddings,
-                                                        0,
-                                                        0);
-  this->interface_constraints.reinit((1 << (dim - 1)) *
-                                       this->n_dofs_per_face(face_no),
-                                     this->n_dofs_per_face(face_no));
-  unsigned int target_row = 0;
-  for (unsigned int d = 0; d < GeometryInfo<dim>::max_children_per_face; ++d)
-    for (unsigned int i = 0; i < face_embeddings[d].m(); ++i)
-      {
-        for (unsigned int j = 0; j < face_embeddings[d].n(); ++j)
-          this->interface_constraints(target_row, j) = face_embeddings[d](i, j);
-        ++target_row;
-      }
+  // Compute the remaining matrices, or get them from an element of the same
+  // degree that has been created before
+  const std::shared_ptr<const RaviartThomasMatrices> matrices =
+    get_matrix_registry<dim>().get_or_create(deg, [&]() {
+      // Now compute the inverse node matrix, generating the correct
+      // basis functions from the raw ones. For a discussion of what
+      // exactly happens here, see FETools::compute_node_matrix.
+      const FullMatrix<double> M = FETools::compute_node_matrix(*this);
+      this->inverse_node_matrix.reinit(n_dofs, n_dofs);
+      this->inverse_node_matrix.invert(M);
+      // From now on, the shape functions provided by
+      // FiniteElement::shape_value and similar functions will be the correct
+      // ones, not the raw shape functions from the polynomial space anymore.
+
+      // Fill prolongation matrices with embedding operators
+      FETools::compute_embedding_matrices(*this, this->prolongation);
+      initialize_restriction();
+
+      // TODO: the implementation makes the assumption that all faces have the
+      // same number of dofs
+      AssertDimension(this->n_unique_faces(), 1);
+      const unsigned int face_no = 0;
+
+      // TODO[TL]: for anisotropic refinement we will probably need a table of
+      // submatrices with an array for each refine case
+      FullMatrix<double>
+        face_embeddings[GeometryInfo<dim>::max_children_per_face];
+      for (unsigned int i = 0; i < GeometryInfo<dim>::max_children_per_face;
+           ++i)
+        face_embeddings[i].reinit(this->n_dofs_per_face(face_no),
+                                  this->n_dofs_per_face(face_no));
+      FETools::compute_face_embedding_matrices<dim, double>(*this,
+                                                            face_embeddings,
+                                                            0,
+                                                            0);
+      this->interface_constraints.reinit((1 << (dim - 1)) *
+                                           this->n_dofs_per_face(face_no),
+                                         this->n_dofs_per_face(face_no));
+      unsigned int target_row = 0;
+      for (unsigned int d = 0; d < GeometryInfo<dim>::max_children_per_face;
+           ++d)
+        for (unsigned int i = 0; i < face_embeddings[d].m(); ++i)
+          {
+            for (unsigned int j = 0; j < face_embeddings[d].n(); ++j)
+              this->interface_constraints(target_row, j) =
+                face_embeddings[d](i, j);
+            ++target_row;
+          }
+
+      return RaviartThomasMatrices{this->inverse_node_matrix,
+                                   this->prolongation,
+                                   this->restriction,
+                                   this->interface_constraints};
+    });
+  this->inverse_node_matrix   = matrices->inverse_node_matrix;
+  this->prolongation          = matrices->prolongation;
+  this->restriction           = matrices->restriction;
+  this->interface_constraints = matrices->interface_constraints;
 
   // We need to initialize the dof permutation table and the one for the sign
   // change.
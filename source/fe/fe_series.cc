@@ -16,6 +16,9 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/tensor_product_polynomials.h>
+
+#include <deal.II/fe/fe_poly.h>
 #include <deal.II/fe/fe_series.h>
 
 #include <iostream>
@@ -64,4 +67,136 @@ namespace FESeries
   }
 } // namespace FESeries
 
+
+
+namespace internal
+{
+  namespace FESeriesImplementation
+  {
+    template <int dim, int spacedim, typename CoefficientType>
+    void
+    compute_transformation_matrix(
+      const FiniteElement<dim, spacedim> &fe,
+      const Quadrature<dim>              &quadrature,
+      const unsigned int                  component,
+      const unsigned int                  n_coefficients_per_direction,
+      const std::function<CoefficientType(const unsigned int, const double)>
+                                  &basis_function,
+      FullMatrix<CoefficientType> &transformation_matrix)
+    {
+      const unsigned int n_dofs = fe.n_dofs_per_cell();
+      const unsigned int n_coefficients =
+        Utilities::pow(n_coefficients_per_direction, dim);
+
+      // Evaluate the shape functions only once per quadrature point rather
+      // than once for every coefficient.
+      FullMatrix<double> shape_values(quadrature.size(), n_dofs);
+      for (unsigned int q = 0; q < quadrature.size(); ++q)
+        for (unsigned int j = 0; j < n_dofs; ++j)
+          shape_values(q, j) =
+            fe.shape_value_component(j, quadrature.point(q), component) *
+            quadrature.weight(q);
+
+      transformation_matrix.reinit(n_coefficients, n_dofs);
+      Table<2, CoefficientType> basis_values_1d(dim,
+                                                n_coefficients_per_direction);
+      for (unsigned int q = 0; q < quadrature.size(); ++q)
+        {
+          for (unsigned int d = 0; d < dim; ++d)
+            for (unsigned int k = 0; k < n_coefficients_per_direction; ++k)
+              basis_values_1d(d, k) =
+                basis_function(k, quadrature.point(q)[d]);
+
+          for (unsigned int k = 0; k < n_coefficients; ++k)
+            {
+              // the last coordinate direction runs fastest in k
+              CoefficientType basis_value = 1.;
+              for (unsigned int d = dim, index = k; d-- > 0;
+                   index /= n_coefficients_per_direction)
+                basis_value *=
+                  basis_values_1d(d, index % n_coefficients_per_direction);
+
+              for (unsigned int j = 0; j < n_dofs; ++j)
+                transformation_matrix(k, j) += basis_value * shape_values(q, j);
+            }
+        }
+    }
+
+
+
+    template <int dim, int spacedim, typename CoefficientType>
+    bool
+    compute_tensor_product_transformation(
+      const FiniteElement<dim, spacedim> &fe,
+      const Quadrature<dim>              &quadrature,
+      const unsigned int                  n_coefficients_per_direction,
+      const std::function<CoefficientType(const unsigned int, const double)>
+                                               &basis_function,
+      std::vector<FullMatrix<CoefficientType>> &matrices_1d,
+      std::vector<unsigned int>                &dof_positions)
+    {
+      if (fe.n_components() != 1 || !quadrature.is_tensor_product())
+        return false;
+
+      const auto *fe_poly = dynamic_cast<const FE_Poly<dim, spacedim> *>(&fe);
+      if (fe_poly == nullptr)
+        return false;
+
+      const auto *poly_space =
+        dynamic_cast<const TensorProductPolynomials<dim> *>(
+          &fe_poly->get_poly_space());
+      if (poly_space == nullptr)
+        return false;
+
+      const std::vector<Polynomials::Polynomial<double>> polynomials =
+        poly_space->get_underlying_polynomials();
+      const unsigned int n_dofs_1d = polynomials.size();
+      AssertDimension(fe.n_dofs_per_cell(), Utilities::pow(n_dofs_1d, dim));
+
+      const auto &quadratures_1d = quadrature.get_tensor_basis();
+      matrices_1d.resize(dim);
+      std::vector<CoefficientType> basis_values(n_coefficients_per_direction);
+      std::vector<double>          polynomial_values(n_dofs_1d);
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          matrices_1d[d].reinit(n_coefficients_per_direction, n_dofs_1d);
+          for (unsigned int q = 0; q < quadratures_1d[d].size(); ++q)
+            {
+              const double x = quadratures_1d[d].point(q)[0];
+              for (unsigned int k = 0; k < n_coefficients_per_direction; ++k)
+                basis_values[k] =
+                  basis_function(k, x) * quadratures_1d[d].weight(q);
+              for (unsigned int i = 0; i < n_dofs_1d; ++i)
+                polynomial_values[i] = polynomials[i].value(x);
+
+              for (unsigned int k = 0; k < n_coefficients_per_direction; ++k)
+                for (unsigned int i = 0; i < n_dofs_1d; ++i)
+                  matrices_1d[d](k, i) +=
+                    basis_values[k] * polynomial_values[i];
+            }
+        }
+
+      // The polynomial space numbers its basis functions lexicographically
+      // with the first direction running fastest, whereas the sum
+      // factorization expects the last direction to run fastest.
+      const std::vector<unsigned int> &numbering = poly_space->get_numbering();
+      dof_positions.resize(numbering.size());
+      for (unsigned int i = 0; i < numbering.size(); ++i)
+        {
+          dof_positions[i] = 0;
+          for (unsigned int d = 0, index = numbering[i]; d < dim;
+               ++d, index /= n_dofs_1d)
+            dof_positions[i] +=
+              (index % n_dofs_1d) * Utilities::pow(n_dofs_1d, dim - 1 - d);
+        }
+
+      return true;
+    }
+  } // namespace FESeriesImplementation
+} // namespace internal
+
+
+// explicit instantiations
+#include "fe_series.inst"
+
 DEAL_II_NAMESPACE_CLOSE
@@ -20,6 +20,7 @@
 #include <deal.II/fe/fe_series.h>
 
 #include <iostream>
+#include <mutex>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -62,123 +63,64 @@ namespace
 
 
 
-  template <int dim, int spacedim>
+  /*
+   * One-dimensional Fourier basis function $\exp(2 \pi i k x)$.
+   */
   std::complex<double>
-  integrate(const FiniteElement<dim, spacedim> &fe,
-            const Quadrature<dim>              &quadrature,
-            const Tensor<1, dim>               &k_vector,
-            const unsigned int                  j,
-            const unsigned int                  component)
+  fourier_basis(const unsigned int k, const double x)
   {
-    std::complex<double> sum = 0;
-    for (unsigned int q = 0; q < quadrature.size(); ++q)
-      {
-        const Point<dim> &x_q = quadrature.point(q);
-        sum += std::exp(std::complex<double>(0, 1) * (k_vector * x_q)) *
-               fe.shape_value_component(j, x_q, component) *
-               quadrature.weight(q);
-      }
-    return sum;
+    return std::exp(std::complex<double>(0, 1) * (2. * numbers::PI * k * x));
   }
 
 
 
   /*
-   * Ensure that the transformation matrix for FiniteElement index
-   * @p fe_index is calculated. If not, calculate it.
+   * Mutex guarding the computation of transformation matrices on demand in
+   * calculate(), which may be called concurrently.
    */
-  template <int spacedim>
-  void
-  ensure_existence(
-    const std::vector<unsigned int>               &n_coefficients_per_direction,
-    const hp::FECollection<1, spacedim>           &fe_collection,
-    const hp::QCollection<1>                      &q_collection,
-    const Table<1, Tensor<1, 1>>                  &k_vectors,
-    const unsigned int                             fe,
-    const unsigned int                             component,
-    std::vector<FullMatrix<std::complex<double>>> &fourier_transform_matrices)
-  {
-    AssertIndexRange(fe, fe_collection.size());
-
-    if (fourier_transform_matrices[fe].m() == 0)
-      {
-        fourier_transform_matrices[fe].reinit(
-          n_coefficients_per_direction[fe],
-          fe_collection[fe].n_dofs_per_cell());
-
-        for (unsigned int k = 0; k < n_coefficients_per_direction[fe]; ++k)
-          for (unsigned int j = 0; j < fe_collection[fe].n_dofs_per_cell(); ++j)
-            fourier_transform_matrices[fe](k, j) = integrate(
-              fe_collection[fe], q_collection[fe], k_vectors(k), j, component);
-      }
-  }
+  std::mutex transformation_mutex;
 
-  template <int spacedim>
-  void
-  ensure_existence(
-    const std::vector<unsigned int>               &n_coefficients_per_direction,
-    const hp::FECollection<2, spacedim>           &fe_collection,
-    const hp::QCollection<2>                      &q_collection,
-    const Table<2, Tensor<1, 2>>                  &k_vectors,
-    const unsigned int                             fe,
-    const unsigned int                             component,
-    std::vector<FullMatrix<std::complex<double>>> &fourier_transform_matrices)
-  {
-    AssertIndexRange(fe, fe_collection.size());
 
-    if (fourier_transform_matrices[fe].m() == 0)
-      {
-        fourier_transform_matrices[fe].reinit(
-          Utilities::fixed_power<2>(n_coefficients_per_direction[fe]),
-          fe_collection[fe].n_dofs_per_cell());
-
-        unsigned int k = 0;
-        for (unsigned int k1 = 0; k1 < n_coefficients_per_direction[fe]; ++k1)
-          for (unsigned int k2 = 0; k2 < n_coefficients_per_direction[fe];
-               ++k2, ++k)
-            for (unsigned int j = 0; j < fe_collection[fe].n_dofs_per_cell();
-                 ++j)
-              fourier_transform_matrices[fe](k, j) =
-                integrate(fe_collection[fe],
-                          q_collection[fe],
-                          k_vectors(k1, k2),
-                          j,
-                          component);
-      }
-  }
 
-  template <int spacedim>
+  /*
+   * Ensure that the transformation matrix for FiniteElement index
+   * @p fe_index is calculated. If not, calculate it.
+   */
+  template <int dim, int spacedim>
   void
   ensure_existence(
-    const std::vector<unsigned int>               &n_coefficients_per_direction,
-    const hp::FECollection<3, spacedim>           &fe_collection,
-    const hp::QCollection<3>                      &q_collection,
-    const Table<3, Tensor<1, 3>>                  &k_vectors,
-    const unsigned int                             fe,
-    const unsigned int                             component,
-    std::vector<FullMatrix<std::complex<double>>> &fourier_transform_matrices)
+    const std::vector<unsigned int>                            &n_coefficients,
+    const hp::FECollection<dim, spacedim>                      &fe_collection,
+    const hp::QCollection<dim>                                 &q_collection,
+    const unsigned int                                          fe,
+    const unsigned int                                          component,
+    std::vector<FullMatrix<std::complex<double>>>              &matrices,
+    std::vector<std::vector<FullMatrix<std::complex<double>>>> &matrices_1d,
+    std::vector<std::vector<unsigned int>>                     &dof_positions)
   {
     AssertIndexRange(fe, fe_collection.size());
 
-    if (fourier_transform_matrices[fe].m() == 0)
+    if (matrices[fe].m() == 0 && matrices_1d[fe].empty())
       {
-        fourier_transform_matrices[fe].reinit(
-          Utilities::fixed_power<3>(n_coefficients_per_direction[fe]),
-          fe_collection[fe].n_dofs_per_cell());
-
-        unsigned int k = 0;
-        for (unsigned int k1 = 0; k1 < n_coefficients_per_direction[fe]; ++k1)
-          for (unsigned int k2 = 0; k2 < n_coefficients_per_direction[fe]; ++k2)
-            for (unsigned int k3 = 0; k3 < n_coefficients_per_direction[fe];
-                 ++k3, ++k)
-              for (unsigned int j = 0; j < fe_collection[fe].n_dofs_per_cell();
-                   ++j)
-                fourier_transform_matrices[fe](k, j) =
-                  integrate(fe_collection[fe],
-                            q_collection[fe],
-                            k_vectors(k1, k2, k3),
-                            j,
-                            component);
+        const std::function<std::complex<double>(const unsigned int,
+                                                 const double)>
+          basis_function = &fourier_basis;
+
+        if (!internal::FESeriesImplementation::
+              compute_tensor_product_transformation(
+                fe_collection[fe],
+                q_collection[fe],
+                n_coefficients[fe],
+                basis_function,
+                matrices_1d[fe],
+                dof_positions[fe]))
+          internal::FESeriesImplementation::compute_transformation_matrix(
+            fe_collection[fe],
+            q_collection[fe],
+            component,
+            n_coefficients[fe],
+            basis_function,
+            matrices[fe]);
       }
   }
 } // namespace
@@ -197,6 +139,8 @@ namespace FESeries
     , fe_collection(&fe_collection)
     , q_collection(q_collection)
     , fourier_transform_matrices(fe_collection.size())
+    , fourier_transform_matrices_1d(fe_collection.size())
+    , tensor_product_dof_positions(fe_collection.size())
     , component(component_ != numbers::invalid_unsigned_int ? component_ : 0)
   {
     Assert(n_coefficients_per_direction.size() == fe_collection.size() &&
@@ -217,9 +161,6 @@ namespace FESeries
       *std::max_element(n_coefficients_per_direction.cbegin(),
                         n_coefficients_per_direction.cend());
     set_k_vectors(k_vectors, max_n_coefficients_per_direction);
-
-    // reserve sufficient memory
-    unrolled_coefficients.reserve(k_vectors.n_elements());
   }
 
 
@@ -250,10 +191,11 @@ namespace FESeries
         ensure_existence(n_coefficients_per_direction,
                          *fe_collection,
                          q_collection,
-                         k_vectors,
                          fe,
                          component,
-                         fourier_transform_matrices);
+                         fourier_transform_matrices,
+                         fourier_transform_matrices_1d,
+                         tensor_product_dof_positions);
       });
 
     task_group.join_all();
@@ -283,33 +225,49 @@ namespace FESeries
       AssertDimension(fourier_coefficients.size(d),
                       n_coefficients_per_direction[cell_active_fe_index]);
 
-    ensure_existence(n_coefficients_per_direction,
-                     *fe_collection,
-                     q_collection,
-                     k_vectors,
-                     cell_active_fe_index,
-                     component,
-                     fourier_transform_matrices);
+    {
+      std::lock_guard<std::mutex> lock(transformation_mutex);
+      ensure_existence(n_coefficients_per_direction,
+                       *fe_collection,
+                       q_collection,
+                       cell_active_fe_index,
+                       component,
+                       fourier_transform_matrices,
+                       fourier_transform_matrices_1d,
+                       tensor_product_dof_positions);
+    }
+
+    std::vector<CoefficientType> &coefficients = unrolled_coefficients.get();
+
+    if (!fourier_transform_matrices_1d[cell_active_fe_index].empty())
+      {
+        internal::FESeriesImplementation::apply_tensor_product_transformation(
+          fourier_transform_matrices_1d[cell_active_fe_index],
+          tensor_product_dof_positions[cell_active_fe_index],
+          local_dof_values,
+          tensor_product_scratch.get(),
+          coefficients);
+        fourier_coefficients.fill(coefficients.begin());
+        return;
+      }
 
     const FullMatrix<CoefficientType> &matrix =
       fourier_transform_matrices[cell_active_fe_index];
 
-    unrolled_coefficients.resize(Utilities::fixed_power<dim>(
+    coefficients.resize(Utilities::fixed_power<dim>(
       n_coefficients_per_direction[cell_active_fe_index]));
-    std::fill(unrolled_coefficients.begin(),
-              unrolled_coefficients.end(),
-              CoefficientType(0.));
+    std::fill(coefficients.begin(), coefficients.end(), CoefficientType(0.));
 
-    Assert(unrolled_coefficients.size() == matrix.m(), ExcInternalError());
+    Assert(coefficients.size() == matrix.m(), ExcInternalError());
 
     Assert(local_dof_values.size() == matrix.n(),
            ExcDimensionMismatch(local_dof_values.size(), matrix.n()));
 
-    for (unsigned int i = 0; i < unrolled_coefficients.size(); ++i)
+    for (unsigned int i = 0; i < coefficients.size(); ++i)
       for (unsigned int j = 0; j < local_dof_values.size(); ++j)
-        unrolled_coefficients[i] += matrix[i][j] * local_dof_values[j];
+        coefficients[i] += matrix[i][j] * local_dof_values[j];
 
-    fourier_coefficients.fill(unrolled_coefficients.begin());
+    fourier_coefficients.fill(coefficients.begin());
   }
 } // namespace FESeries
 
@@ -20,6 +20,7 @@
 #include <deal.II/fe/fe_series.h>
 
 #include <iostream>
+#include <mutex>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -32,60 +33,25 @@ namespace
                  << "x[" << arg1 << "] = " << arg2 << " is not in [0,1]");
 
   /*
-   * dim dimensional Legendre function with indices @p indices
-   * evaluated at @p x_q in [0,1]^dim.
+   * One-dimensional Legendre function of degree @p k, orthonormal on [0,1],
+   * evaluated at @p x and scaled by the multiplier of the Legendre
+   * coefficients.
    */
-  template <int dim>
   double
-  Lh(const Point<dim> &x_q, const TableIndices<dim> &indices)
+  legendre_basis(const unsigned int k, const double x)
   {
-    double res = 1.0;
-    for (unsigned int d = 0; d < dim; ++d)
-      {
-        const double x = 2.0 * (x_q[d] - 0.5);
-        Assert((x_q[d] <= 1.0) && (x_q[d] >= 0.), ExcLegendre(d, x_q[d]));
-        const unsigned int ind = indices[d];
-        res *= std::sqrt(2.0) * std_cxx17::legendre(ind, x);
-      }
-    return res;
+    Assert((x <= 1.0) && (x >= 0.), ExcLegendre(0, x));
+    return (0.5 + k) * std::sqrt(2.0) *
+           std_cxx17::legendre(k, 2.0 * (x - 0.5));
   }
 
 
 
   /*
-   * Multiplier in Legendre coefficients
+   * Mutex guarding the computation of transformation matrices on demand in
+   * calculate(), which may be called concurrently.
    */
-  template <int dim>
-  double
-  multiplier(const TableIndices<dim> &indices)
-  {
-    double res = 1.0;
-    for (unsigned int d = 0; d < dim; ++d)
-      res *= (0.5 + indices[d]);
-
-    return res;
-  }
-
-
-
-  template <int dim, int spacedim>
-  double
-  integrate(const FiniteElement<dim, spacedim> &fe,
-            const Quadrature<dim>              &quadrature,
-            const TableIndices<dim>            &indices,
-            const unsigned int                  dof,
-            const unsigned int                  component)
-  {
-    double sum = 0;
-    for (unsigned int q = 0; q < quadrature.size(); ++q)
-      {
-        const Point<dim> &x_q = quadrature.point(q);
-        sum += Lh(x_q, indices) *
-               fe.shape_value_component(dof, x_q, component) *
-               quadrature.weight(q);
-      }
-    return sum * multiplier(indices);
-  }
+  std::mutex transformation_mutex;
 
 
 
@@ -93,99 +59,40 @@ namespace
    * Ensure that the transformation matrix for FiniteElement index
    * @p fe_index is calculated. If not, calculate it.
    */
-  template <int spacedim>
-  void
-  ensure_existence(
-    const std::vector<unsigned int>     &n_coefficients_per_direction,
-    const hp::FECollection<1, spacedim> &fe_collection,
-    const hp::QCollection<1>            &q_collection,
-    const unsigned int                   fe,
-    const unsigned int                   component,
-    std::vector<FullMatrix<double>>     &legendre_transform_matrices)
-  {
-    AssertIndexRange(fe, fe_collection.size());
-
-    if (legendre_transform_matrices[fe].m() == 0)
-      {
-        legendre_transform_matrices[fe].reinit(
-          n_coefficients_per_direction[fe],
-          fe_collection[fe].n_dofs_per_cell());
-
-        for (unsigned int k = 0; k < n_coefficients_per_direction[fe]; ++k)
-          for (unsigned int j = 0; j < fe_collection[fe].n_dofs_per_cell(); ++j)
-            legendre_transform_matrices[fe](k, j) =
-              integrate(fe_collection[fe],
-                        q_collection[fe],
-                        TableIndices<1>(k),
-                        j,
-                        component);
-      }
-  }
-
-  template <int spacedim>
-  void
-  ensure_existence(
-    const std::vector<unsigned int>     &n_coefficients_per_direction,
-    const hp::FECollection<2, spacedim> &fe_collection,
-    const hp::QCollection<2>            &q_collection,
-    const unsigned int                   fe,
-    const unsigned int                   component,
-    std::vector<FullMatrix<double>>     &legendre_transform_matrices)
-  {
-    AssertIndexRange(fe, fe_collection.size());
-
-    if (legendre_transform_matrices[fe].m() == 0)
-      {
-        legendre_transform_matrices[fe].reinit(
-          Utilities::fixed_power<2>(n_coefficients_per_direction[fe]),
-          fe_collection[fe].n_dofs_per_cell());
-
-        unsigned int k = 0;
-        for (unsigned int k1 = 0; k1 < n_coefficients_per_direction[fe]; ++k1)
-          for (unsigned int k2 = 0; k2 < n_coefficients_per_direction[fe];
-               ++k2, k++)
-            for (unsigned int j = 0; j < fe_collection[fe].n_dofs_per_cell();
-                 ++j)
-              legendre_transform_matrices[fe](k, j) =
-                integrate(fe_collection[fe],
-                          q_collection[fe],
-                          TableIndices<2>(k1, k2),
-                          j,
-                          component);
-      }
-  }
-
-  template <int spacedim>
+  template <int dim, int spacedim>
   void
   ensure_existence(
-    const std::vector<unsigned int>     &n_coefficients_per_direction,
-    const hp::FECollection<3, spacedim> &fe_collection,
-    const hp::QCollection<3>            &q_collection,
-    const unsigned int                   fe,
-    const unsigned int                   component,
-    std::vector<FullMatrix<double>>     &legendre_transform_matrices)
+    const std::vector<unsigned int>              &n_coefficients,
+    const hp::FECollection<dim, spacedim>        &fe_collection,
+    const hp::QCollection<dim>                   &q_collection,
+    const unsigned int                            fe,
+    const unsigned int                            component,
+    std::vector<FullMatrix<double>>              &matrices,
+    std::vector<std::vector<FullMatrix<double>>> &matrices_1d,
+    std::vector<std::vector<unsigned int>>       &dof_positions)
   {
     AssertIndexRange(fe, fe_collection.size());
 
-    if (legendre_transform_matrices[fe].m() == 0)
+    if (matrices[fe].m() == 0 && matrices_1d[fe].empty())
       {
-        legendre_transform_matrices[fe].reinit(
-          Utilities::fixed_power<3>(n_coefficients_per_direction[fe]),
-          fe_collection[fe].n_dofs_per_cell());
-
-        unsigned int k = 0;
-        for (unsigned int k1 = 0; k1 < n_coefficients_per_direction[fe]; ++k1)
-          for (unsigned int k2 = 0; k2 < n_coefficients_per_direction[fe]; ++k2)
-            for (unsigned int k3 = 0; k3 < n_coefficients_per_direction[fe];
-                 ++k3, k++)
-              for (unsigned int j = 0; j < fe_collection[fe].n_dofs_per_cell();
-                   ++j)
-                legendre_transform_matrices[fe](k, j) =
-                  integrate(fe_collection[fe],
-                            q_collection[fe],
-                            TableIndices<3>(k1, k2, k3),
-                            j,
-                            component);
+        const std::function<double(const unsigned int, const double)>
+          basis_function = &legendre_basis;
+
+        if (!internal::FESeriesImplementation::
+              compute_tensor_product_transformation(
+                fe_collection[fe],
+                q_collection[fe],
+                n_coefficients[fe],
+                basis_function,
+                matrices_1d[fe],
+                dof_positions[fe]))
+          internal::FESeriesImplementation::compute_transformation_matrix(
+            fe_collection[fe],
+            q_collection[fe],
+            component,
+            n_coefficients[fe],
+            basis_function,
+            matrices[fe]);
       }
   }
 } // namespace
@@ -204,6 +111,8 @@ namespace FESeries
     , fe_collection(&fe_collection)
     , q_collection(q_collection)
     , legendre_transform_matrices(fe_collection.size())
+    , legendre_transform_matrices_1d(fe_collection.size())
+    , tensor_product_dof_positions(fe_collection.size())
     , component(component_ != numbers::invalid_unsigned_int ? component_ : 0)
   {
     Assert(n_coefficients_per_direction.size() == fe_collection.size() &&
@@ -219,13 +128,6 @@ namespace FESeries
           "by setting the 'component' argument of this constructor."));
 
     AssertIndexRange(component, fe_collection[0].n_components());
-
-    // reserve sufficient memory
-    const unsigned int max_n_coefficients_per_direction =
-      *std::max_element(n_coefficients_per_direction.cbegin(),
-                        n_coefficients_per_direction.cend());
-    unrolled_coefficients.reserve(
-      Utilities::fixed_power<dim>(max_n_coefficients_per_direction));
   }
 
 
@@ -257,7 +159,9 @@ namespace FESeries
                          q_collection,
                          fe,
                          component,
-                         legendre_transform_matrices);
+                         legendre_transform_matrices,
+                         legendre_transform_matrices_1d,
+                         tensor_product_dof_positions);
       });
 
     task_group.join_all();
@@ -287,32 +191,49 @@ namespace FESeries
       AssertDimension(legendre_coefficients.size(d),
                       n_coefficients_per_direction[cell_active_fe_index]);
 
-    ensure_existence(n_coefficients_per_direction,
-                     *fe_collection,
-                     q_collection,
-                     cell_active_fe_index,
-                     component,
-                     legendre_transform_matrices);
+    {
+      std::lock_guard<std::mutex> lock(transformation_mutex);
+      ensure_existence(n_coefficients_per_direction,
+                       *fe_collection,
+                       q_collection,
+                       cell_active_fe_index,
+                       component,
+                       legendre_transform_matrices,
+                       legendre_transform_matrices_1d,
+                       tensor_product_dof_positions);
+    }
+
+    std::vector<CoefficientType> &coefficients = unrolled_coefficients.get();
+
+    if (!legendre_transform_matrices_1d[cell_active_fe_index].empty())
+      {
+        internal::FESeriesImplementation::apply_tensor_product_transformation(
+          legendre_transform_matrices_1d[cell_active_fe_index],
+          tensor_product_dof_positions[cell_active_fe_index],
+          local_dof_values,
+          tensor_product_scratch.get(),
+          coefficients);
+        legendre_coefficients.fill(coefficients.begin());
+        return;
+      }
 
     const FullMatrix<CoefficientType> &matrix =
       legendre_transform_matrices[cell_active_fe_index];
 
-    unrolled_coefficients.resize(Utilities::fixed_power<dim>(
+    coefficients.resize(Utilities::fixed_power<dim>(
       n_coefficients_per_direction[cell_active_fe_index]));
-    std::fill(unrolled_coefficients.begin(),
-              unrolled_coefficients.end(),
-              CoefficientType(0.));
+    std::fill(coefficients.begin(), coefficients.end(), CoefficientType(0.));
 
-    Assert(unrolled_coefficients.size() == matrix.m(), ExcInternalError());
+    Assert(coefficients.size() == matrix.m(), ExcInternalError());
 
     Assert(local_dof_values.size() == matrix.n(),
            ExcDimensionMismatch(local_dof_values.size(), matrix.n()));
 
-    for (unsigned int i = 0; i < unrolled_coefficients.size(); ++i)
+    for (unsigned int i = 0; i < coefficients.size(); ++i)
       for (unsigned int j = 0; j < local_dof_values.size(); ++j)
-        unrolled_coefficients[i] += matrix[i][j] * local_dof_values[j];
+        coefficients[i] += matrix[i][j] * local_dof_values[j];
 
-    legendre_coefficients.fill(unrolled_coefficients.begin());
+    legendre_coefficients.fill(coefficients.begin());
   }
 } // namespace FESeries
 
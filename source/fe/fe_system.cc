@@ -18,6 +18,7 @@
 
 #include <deal.II/dofs/dof_accessor.h>
 
+#include <deal.II/fe/fe_poly.h>
 #include <deal.II/fe/fe_system.h>
 #include <deal.II/fe/fe_tools.h>
 #include <deal.II/fe/fe_values.h>
@@ -1433,6 +1434,17 @@ FESystem<dim, spacedim>::compute_fill(
                                          base_fe_data,
                                          base_data);
 
+        // elements derived from FE_Poly compute their shape values only once
+        // and do not transform the derivatives on cells that are translations
+        // of the previous cell. their output is then the same as on the
+        // previous cell, which we have already copied into our own output
+        // object
+        if ((face_no == invalid_face_number) &&
+            (cell_similarity == CellSimilarity::translation) &&
+            (dynamic_cast<const FE_Poly<dim, spacedim> *>(&base_fe) !=
+             nullptr))
+          continue;
+
         // now data has been generated, so copy it. This procedure is different
         // for primitive and non-primitive base elements, so at this point we
         // dispatch to helper functions.
@@ -361,6 +361,15 @@ FEValues<dim, spacedim>::do_reinit()
 
 
 
+template <int dim, int spacedim>
+bool
+FEValues<dim, spacedim>::enable_tensor_product_evaluation(const bool enable)
+{
+  return this->initialize_tensor_product_evaluator(quadrature, enable);
+}
+
+
+
 template <int dim, int spacedim>
 std::size_t
 FEValues<dim, spacedim>::memory_consumption() const
@@ -583,13 +592,16 @@ FEFaceValues<dim, spacedim>::reinit(
 
   AssertIndexRange(face_no, GeometryInfo<dim>::faces_per_cell);
 
+  const bool data_is_current = is_present_face(cell, face_no);
+
   this->maybe_invalidate_previous_present_cell(cell);
   this->present_cell = {cell};
 
   // this was the part of the work that is dependent on the actual
   // data type of the iterator. now pass on to the function doing
   // the real work.
-  do_reinit(face_no);
+  if (!data_is_current)
+    do_reinit(face_no);
 }
 
 
@@ -615,13 +627,16 @@ FEFaceValues<dim, spacedim>::reinit(
 {
   AssertIndexRange(face_no, GeometryInfo<dim>::faces_per_cell);
 
+  const bool data_is_current = is_present_face(cell, face_no);
+
   this->maybe_invalidate_previous_present_cell(cell);
   this->present_cell = {cell};
 
   // this was the part of the work that is dependent on the actual
   // data type of the iterator. now pass on to the function doing
   // the real work.
-  do_reinit(face_no);
+  if (!data_is_current)
+    do_reinit(face_no);
 }
 
 
@@ -638,6 +653,28 @@ FEFaceValues<dim, spacedim>::reinit(
 
 
 
+template <int dim, int spacedim>
+bool
+FEFaceValues<dim, spacedim>::is_present_face(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  const unsigned int                                          face_no) const
+{
+  // the present cell is invalidated by any change of the triangulation,
+  // including a movement of its vertices
+  if (this->present_cell.is_initialized() == false ||
+      face_no != this->present_face_no ||
+      this->get_mapping().preserves_vertex_locations() == false)
+    return false;
+
+  const typename Triangulation<dim, spacedim>::cell_iterator &present_cell =
+    this->present_cell;
+  return &cell->get_triangulation() == &present_cell->get_triangulation() &&
+         cell->level() == present_cell->level() &&
+         cell->index() == present_cell->index();
+}
+
+
+
 template <int dim, int spacedim>
 void
 FEFaceValues<dim, spacedim>::do_reinit(const unsigned int face_no)
@@ -33,6 +33,9 @@
 
 #include <deal.II/lac/vector.h>
 
+#include <deal.II/matrix_free/shape_info.h>
+#include <deal.II/matrix_free/tensor_product_kernels.h>
+
 #include <boost/container/small_vector.hpp>
 
 #include <iomanip>
@@ -102,6 +105,249 @@ namespace internal
       }
     };
   } // namespace
+
+
+
+  namespace FEValuesImplementation
+  {
+    /**
+     * A class that evaluates scalar finite element functions at the points
+     * of a tensor product quadrature formula with sum factorization, using
+     * the kernels of the matrix-free framework.
+     */
+    template <int dim, int spacedim>
+    class TensorProductEvaluator
+    {
+    public:
+      /**
+       * Constructor. The finite element must be supported according to
+       * is_supported().
+       */
+      TensorProductEvaluator(const FiniteElement<dim, spacedim> &fe,
+                             const Quadrature<dim>              &quadrature);
+
+      /**
+       * Return whether the given finite element and quadrature formula
+       * can be evaluated with sum factorization.
+       */
+      static bool
+      is_supported(const FiniteElement<dim, spacedim> &fe,
+                   const Quadrature<dim>              &quadrature);
+
+      /**
+       * Compute the values in the quadrature points of the function with
+       * the coefficients @p dof_values, given in the numbering of the
+       * finite element.
+       */
+      void
+      evaluate_values(const ArrayView<const double> &dof_values,
+                      std::vector<double>           &values) const;
+
+      /**
+       * Compute the gradients in the quadrature points of the function with
+       * the coefficients @p dof_values, using the covariant transformation
+       * of @p mapping for the cell @p mapping_data has been filled for.
+       */
+      void
+      evaluate_gradients(
+        const ArrayView<const double>                           &dof_values,
+        const Mapping<dim, spacedim>                            &mapping,
+        const typename Mapping<dim, spacedim>::InternalDataBase &mapping_data,
+        std::vector<Tensor<1, spacedim>> &gradients) const;
+
+    private:
+      /**
+       * Copy @p dof_values to the beginning of the scratch array, in
+       * lexicographic numbering.
+       */
+      void
+      read_dof_values(const ArrayView<const double> &dof_values) const;
+
+      /**
+       * Interpolate the lexicographic coefficients at the beginning of the
+       * scratch array to the quadrature points and write the result into
+       * @p out. In direction @p derivative_direction, the derivatives of the
+       * one-dimensional shape functions are used instead of their values.
+       */
+      void
+      interpolate(const unsigned int derivative_direction, double *out) const;
+
+      /**
+       * The one-dimensional shape functions and the lexicographic numbering.
+       */
+      MatrixFreeFunctions::ShapeInfo<double> shape_info;
+
+      /**
+       * The number of coefficients and quadrature points per direction.
+       */
+      unsigned int n_dofs_1d;
+      unsigned int n_q_points_1d;
+
+      /**
+       * The number of coefficients or quadrature points of the largest
+       * intermediate result of the sum factorization.
+       */
+      unsigned int n_scratch;
+
+      /**
+       * Scratch memory for the coefficients, two intermediate results, and
+       * the output of one component.
+       */
+      mutable AlignedVector<double> scratch;
+
+      /**
+       * The gradients on the unit cell.
+       */
+      mutable std::vector<Tensor<1, dim>> unit_gradients;
+    };
+
+
+
+    template <int dim, int spacedim>
+    TensorProductEvaluator<dim, spacedim>::TensorProductEvaluator(
+      const FiniteElement<dim, spacedim> &fe,
+      const Quadrature<dim>              &quadrature)
+      : shape_info(quadrature.get_tensor_basis()[0], fe)
+      , n_dofs_1d(shape_info.data.front().fe_degree + 1)
+      , n_q_points_1d(shape_info.data.front().n_q_points_1d)
+      , n_scratch(Utilities::fixed_power<dim>(std::max(n_dofs_1d,
+                                                       n_q_points_1d)))
+      , scratch(4 * n_scratch)
+      , unit_gradients(quadrature.size())
+    {
+      AssertDimension(shape_info.lexicographic_numbering.size(),
+                      fe.n_dofs_per_cell());
+      AssertDimension(Utilities::fixed_power<dim>(n_q_points_1d),
+                      quadrature.size());
+    }
+
+
+
+    template <int dim, int spacedim>
+    bool
+    TensorProductEvaluator<dim, spacedim>::is_supported(
+      const FiniteElement<dim, spacedim> &fe,
+      const Quadrature<dim>              &quadrature)
+    {
+      if (fe.n_components() != 1 ||
+          fe.reference_cell().is_hyper_cube() == false ||
+          MatrixFreeFunctions::ShapeInfo<double>::is_supported(fe) == false ||
+          quadrature.is_tensor_product() == false)
+        return false;
+
+      // we use the same one-dimensional formula in all directions
+      const auto &basis = quadrature.get_tensor_basis();
+      for (unsigned int d = 1; d < dim; ++d)
+        if (basis[d].get_points() != basis[0].get_points())
+          return false;
+
+      // the element needs to be the tensor product of the same polynomials
+      // in each direction, without additional shape functions
+      const MatrixFreeFunctions::ShapeInfo<double> shape_info(basis[0], fe);
+      return shape_info.element_type <=
+               MatrixFreeFunctions::tensor_symmetric_no_collocation &&
+             Utilities::fixed_power<dim>(shape_info.data.front().fe_degree +
+                                         1) == fe.n_dofs_per_cell();
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    TensorProductEvaluator<dim, spacedim>::read_dof_values(
+      const ArrayView<const double> &dof_values) const
+    {
+      AssertDimension(dof_values.size(),
+                      shape_info.lexicographic_numbering.size());
+      for (unsigned int i = 0; i < dof_values.size(); ++i)
+        scratch[i] = dof_values[shape_info.lexicographic_numbering[i]];
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    TensorProductEvaluator<dim, spacedim>::interpolate(
+      const unsigned int derivative_direction,
+      double            *out) const
+    {
+      const auto &data = shape_info.data.front();
+      const EvaluatorTensorProduct<evaluate_general, dim, 0, 0, double, double>
+        eval(data.shape_values.begin(),
+             data.shape_gradients.begin(),
+             nullptr,
+             n_dofs_1d,
+             n_q_points_1d);
+
+      const auto sweep = [&](const auto direction,
+                             const double *in,
+                             double       *result) {
+        constexpr int d = decltype(direction)::value;
+        if (derivative_direction == d)
+          eval.template gradients<d, true, false>(in, result);
+        else
+          eval.template values<d, true, false>(in, result);
+      };
+
+      const double *in   = scratch.begin();
+      double       *tmp0 = scratch.begin() + n_scratch;
+      double       *tmp1 = scratch.begin() + 2 * n_scratch;
+      if constexpr (dim == 1)
+        sweep(std::integral_constant<int, 0>(), in, out);
+      else if constexpr (dim == 2)
+        {
+          sweep(std::integral_constant<int, 0>(), in, tmp0);
+          sweep(std::integral_constant<int, 1>(), tmp0, out);
+        }
+      else
+        {
+          static_assert(dim == 3, "Only implemented for dim <= 3.");
+          sweep(std::integral_constant<int, 0>(), in, tmp0);
+          sweep(std::integral_constant<int, 1>(), tmp0, tmp1);
+          sweep(std::integral_constant<int, 2>(), tmp1, out);
+        }
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    TensorProductEvaluator<dim, spacedim>::evaluate_values(
+      const ArrayView<const double> &dof_values,
+      std::vector<double>           &values) const
+    {
+      AssertDimension(values.size(), unit_gradients.size());
+      read_dof_values(dof_values);
+      interpolate(numbers::invalid_unsigned_int, values.data());
+    }
+
+
+
+    template <int dim, int spacedim>
+    void
+    TensorProductEvaluator<dim, spacedim>::evaluate_gradients(
+      const ArrayView<const double>                           &dof_values,
+      const Mapping<dim, spacedim>                            &mapping,
+      const typename Mapping<dim, spacedim>::InternalDataBase &mapping_data,
+      std::vector<Tensor<1, spacedim>>                        &gradients) const
+    {
+      AssertDimension(gradients.size(), unit_gradients.size());
+      read_dof_values(dof_values);
+
+      double *out = scratch.begin() + 3 * n_scratch;
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          interpolate(d, out);
+          for (unsigned int q = 0; q < unit_gradients.size(); ++q)
+            unit_gradients[q][d] = out[q];
+        }
+
+      mapping.transform(make_array_view(unit_gradients),
+                        mapping_covariant,
+                        mapping_data,
+                        make_array_view(gradients));
+    }
+  } // namespace FEValuesImplementation
 } // namespace internal
 
 /* ------------ FEValuesBase<dim,spacedim>::CellIteratorWrapper ----------- */
@@ -252,6 +498,25 @@ FEValuesBase<dim, spacedim>::always_allow_check_for_cell_similarity(
 
 
 
+template <int dim, int spacedim>
+bool
+FEValuesBase<dim, spacedim>::initialize_tensor_product_evaluator(
+  const Quadrature<dim> &quadrature,
+  const bool             enable)
+{
+  using Evaluator =
+    internal::FEValuesImplementation::TensorProductEvaluator<dim, spacedim>;
+
+  if (enable && Evaluator::is_supported(*fe, quadrature))
+    tensor_product_evaluator = std::make_unique<Evaluator>(*fe, quadrature);
+  else
+    tensor_product_evaluator.reset();
+
+  return tensor_product_evaluator != nullptr;
+}
+
+
+
 namespace internal
 {
   // put shape function part of get_function_xxx methods into separate
@@ -726,6 +991,13 @@ FEValuesBase<dim, spacedim>::get_function_values(
   // get function values of dofs on this cell
   Vector<Number> dof_values(dofs_per_cell);
   present_cell.get_interpolated_dof_values(fe_function, dof_values);
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_evaluator)
+      {
+        tensor_product_evaluator->evaluate_values(
+          make_array_view(dof_values.begin(), dof_values.end()), values);
+        return;
+      }
   internal::do_function_values(make_array_view(dof_values.begin(),
                                                dof_values.end()),
                                this->finite_element_output.shape_values,
@@ -750,6 +1022,12 @@ FEValuesBase<dim, spacedim>::get_function_values(
   boost::container::small_vector<Number, 200> dof_values(dofs_per_cell);
   auto view = make_array_view(dof_values.begin(), dof_values.end());
   fe_function.extract_subvector_to(indices, view);
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_evaluator)
+      {
+        tensor_product_evaluator->evaluate_values(view, values);
+        return;
+      }
   internal::do_function_values(view,
                                this->finite_element_output.shape_values,
                                values);
@@ -861,6 +1139,16 @@ FEValuesBase<dim, spacedim>::get_function_gradients(
   // get function values of dofs on this cell
   Vector<Number> dof_values(dofs_per_cell);
   present_cell.get_interpolated_dof_values(fe_function, dof_values);
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_evaluator)
+      {
+        tensor_product_evaluator->evaluate_gradients(
+          make_array_view(dof_values.begin(), dof_values.end()),
+          *mapping,
+          *mapping_data,
+          gradients);
+        return;
+      }
   internal::do_function_derivatives(make_array_view(dof_values.begin(),
                                                     dof_values.end()),
                                     this->finite_element_output.shape_gradients,
@@ -885,6 +1173,15 @@ FEValuesBase<dim, spacedim>::get_function_gradients(
   boost::container::small_vector<Number, 200> dof_values(dofs_per_cell);
   auto view = make_array_view(dof_values.begin(), dof_values.end());
   fe_function.extract_subvector_to(indices, view);
+  if constexpr (std::is_same_v<Number, double>)
+    if (tensor_product_evaluator)
+      {
+        tensor_product_evaluator->evaluate_gradients(view,
+                                                     *mapping,
+                                                     *mapping_data,
+                                                     gradients);
+        return;
+      }
   internal::do_function_derivatives(view,
                                     this->finite_element_output.shape_gradients,
                                     gradients);
@@ -1397,7 +1694,7 @@ FEValuesBase<dim, spacedim>::maybe_invalidate_previous_present_cell(
       // at least subscribe to the triangulation to get notified of
       // changes
       tria_listener_refinement =
-        cell->get_triangulation().signals.post_refinement.connect(
+        cell->get_triangulation().signals.any_change.connect(
           [this]() { this->invalidate_present_cell(); });
       tria_listener_mesh_transform =
         cell->get_triangulation().signals.mesh_movement.connect(
@@ -126,6 +126,20 @@ Mapping<dim, spacedim>::fill_fe_immersed_surface_values(
 
 
 
+template <int dim, int spacedim>
+void
+Mapping<dim, spacedim>::transform_points_unit_to_real_cell(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  const ArrayView<const Point<dim>>                          &unit_points,
+  const ArrayView<Point<spacedim>>                           &real_points) const
+{
+  AssertDimension(unit_points.size(), real_points.size());
+  for (unsigned int i = 0; i < unit_points.size(); ++i)
+    real_points[i] = transform_unit_to_real_cell(cell, unit_points[i]);
+}
+
+
+
 template <int dim, int spacedim>
 void
 Mapping<dim, spacedim>::transform_points_real_to_unit_cell(
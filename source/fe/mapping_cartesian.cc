@@ -90,10 +90,19 @@ is_cartesian(const CellType &cell)
 template <int dim, int spacedim>
 MappingCartesian<dim, spacedim>::InternalData::InternalData(
   const Quadrature<dim> &q)
+  : InternalData(std::make_shared<const Quadrature<dim>>(q))
+{}
+
+
+
+template <int dim, int spacedim>
+MappingCartesian<dim, spacedim>::InternalData::InternalData(
+  const std::shared_ptr<const Quadrature<dim>> &q)
   : cell_extents(numbers::signaling_nan<Tensor<1, dim>>())
   , inverse_cell_extents(numbers::signaling_nan<Tensor<1, dim>>())
   , volume_element(numbers::signaling_nan<double>())
-  , quadrature_points(q.get_points())
+  , quadrature_points(make_array_view(q->get_points()))
+  , face_quadrature(q)
 {}
 
 
@@ -192,8 +201,9 @@ MappingCartesian<dim, spacedim>::get_face_data(
   AssertDimension(quadrature.size(), 1);
 
   std::unique_ptr<typename Mapping<dim, spacedim>::InternalDataBase> data_ptr =
-    std::make_unique<InternalData>(QProjector<dim>::project_to_all_faces(
-      ReferenceCells::get_hypercube<dim>(), quadrature[0]));
+    std::make_unique<InternalData>(
+      QProjector<dim>::project_to_all_faces_shared(
+        ReferenceCells::get_hypercube<dim>(), quadrature[0]));
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
 
   // verify that we have computed the transitive hull of the required
@@ -217,8 +227,9 @@ MappingCartesian<dim, spacedim>::get_subface_data(
   const Quadrature<dim - 1> &quadrature) const
 {
   std::unique_ptr<typename Mapping<dim, spacedim>::InternalDataBase> data_ptr =
-    std::make_unique<InternalData>(QProjector<dim>::project_to_all_subfaces(
-      ReferenceCells::get_hypercube<dim>(), quadrature));
+    std::make_unique<InternalData>(
+      QProjector<dim>::project_to_all_subfaces_shared(
+        ReferenceCells::get_hypercube<dim>(), quadrature));
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
 
   // verify that we have computed the transitive hull of the required
@@ -326,7 +337,7 @@ MappingCartesian<dim, spacedim>::maybe_update_face_quadrature_points(
 
       transform_quadrature_points(cell->vertex(0),
                                   data.cell_extents,
-                                  make_array_view(data.quadrature_points),
+                                  data.quadrature_points,
                                   offset,
                                   quadrature_points);
     }
@@ -362,7 +373,7 @@ MappingCartesian<dim, spacedim>::maybe_update_subface_quadrature_points(
 
       transform_quadrature_points(cell->vertex(0),
                                   data.cell_extents,
-                                  make_array_view(data.quadrature_points),
+                                  data.quadrature_points,
                                   offset,
                                   quadrature_points);
     }
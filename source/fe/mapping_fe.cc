@@ -39,6 +39,7 @@
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <typeinfo>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -1074,7 +1075,7 @@ MappingFE<dim, spacedim>::get_face_data(
     std::make_unique<InternalData>(*this->fe);
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
   data.initialize_face(this->requires_update_flags(update_flags),
-                       QProjector<dim>::project_to_all_faces(
+                       *QProjector<dim>::project_to_all_faces_shared(
                          this->fe->reference_cell(), quadrature),
                        quadrature.max_n_quadrature_points());
 
@@ -1093,7 +1094,7 @@ MappingFE<dim, spacedim>::get_subface_data(
     std::make_unique<InternalData>(*this->fe);
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
   data.initialize_face(this->requires_update_flags(update_flags),
-                       QProjector<dim>::project_to_all_subfaces(
+                       *QProjector<dim>::project_to_all_subfaces_shared(
                          this->fe->reference_cell(), quadrature),
                        quadrature.size());
 
@@ -1129,7 +1130,7 @@ MappingFE<dim, spacedim>::fill_fe_values(
   // object attached to the cell and all of its bounding faces/edges,
   // etc. to reliably test that the "cell" we are on is, therefore,
   // not easily done
-  data.mapping_support_points = this->compute_mapping_support_points(cell);
+  fill_mapping_support_points(cell, data.mapping_support_points);
   data.cell_of_current_support_points = cell;
 
   // if the order of the mapping is greater than 1, then do not reuse any cell
@@ -1602,7 +1603,7 @@ MappingFE<dim, spacedim>::fill_fe_face_values(
        &data.cell_of_current_support_points->get_triangulation()) ||
       (cell != data.cell_of_current_support_points))
     {
-      data.mapping_support_points = this->compute_mapping_support_points(cell);
+      fill_mapping_support_points(cell, data.mapping_support_points);
       data.cell_of_current_support_points = cell;
     }
 
@@ -1648,7 +1649,7 @@ MappingFE<dim, spacedim>::fill_fe_subface_values(
        &data.cell_of_current_support_points->get_triangulation()) ||
       (cell != data.cell_of_current_support_points))
     {
-      data.mapping_support_points = this->compute_mapping_support_points(cell);
+      fill_mapping_support_points(cell, data.mapping_support_points);
       data.cell_of_current_support_points = cell;
     }
 
@@ -2269,25 +2270,55 @@ template <int dim, int spacedim>
 std::vector<Point<spacedim>>
 MappingFE<dim, spacedim>::compute_mapping_support_points(
   const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
+{
+  std::vector<Point<spacedim>> mapping_support_points;
+  do_compute_mapping_support_points(cell, mapping_support_points);
+  return mapping_support_points;
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingFE<dim, spacedim>::fill_mapping_support_points(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  std::vector<Point<spacedim>>                               &points) const
+{
+  // derived classes may compute the support points differently by
+  // overriding compute_mapping_support_points(), so we can only write into
+  // the existing memory if we know that this is not the case
+  if (typeid(*this) == typeid(MappingFE<dim, spacedim>))
+    do_compute_mapping_support_points(cell, points);
+  else
+    points = this->compute_mapping_support_points(cell);
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingFE<dim, spacedim>::do_compute_mapping_support_points(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  std::vector<Point<spacedim>> &mapping_support_points) const
 {
   Assert(
     check_all_manifold_ids_identical(cell),
     ExcMessage(
       "All entities of a cell need to have the same manifold id as the cell has."));
 
-  std::vector<Point<spacedim>> vertices(cell->n_vertices());
+  boost::container::small_vector<Point<spacedim>,
+                                 GeometryInfo<dim>::vertices_per_cell>
+    vertices(cell->n_vertices());
 
   for (const unsigned int i : cell->vertex_indices())
     vertices[i] = cell->vertex(i);
 
-  std::vector<Point<spacedim>> mapping_support_points(
-    fe->get_unit_support_points().size());
+  mapping_support_points.resize(fe->get_unit_support_points().size());
 
-  cell->get_manifold().get_new_points(vertices,
-                                      mapping_support_point_weights,
-                                      mapping_support_points);
-
-  return mapping_support_points;
+  cell->get_manifold().get_new_points(
+    ArrayView<const Point<spacedim>>(vertices.data(), vertices.size()),
+    mapping_support_point_weights,
+    make_array_view(mapping_support_points));
 }
 
 
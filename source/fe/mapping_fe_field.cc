@@ -634,9 +634,9 @@ MappingFEField<dim, spacedim, VectorType>::get_face_data(
     std::make_unique<InternalData>(euler_dof_handler->get_fe(), fe_mask);
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
 
-  const Quadrature<dim> q(
-    QProjector<dim>::project_to_all_faces(reference_cell, quadrature[0]));
-  data.reinit(requires_update_flags(update_flags), q);
+  data.reinit(requires_update_flags(update_flags),
+              *QProjector<dim>::project_to_all_faces_shared(reference_cell,
+                                                            quadrature[0]));
   this->compute_face_data(quadrature[0].size(), data);
 
   return data_ptr;
@@ -653,9 +653,9 @@ MappingFEField<dim, spacedim, VectorType>::get_subface_data(
     std::make_unique<InternalData>(euler_dof_handler->get_fe(), fe_mask);
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
 
-  const Quadrature<dim> q(
-    QProjector<dim>::project_to_all_subfaces(reference_cell, quadrature));
-  data.reinit(requires_update_flags(update_flags), q);
+  data.reinit(requires_update_flags(update_flags),
+              *QProjector<dim>::project_to_all_subfaces_shared(reference_cell,
+                                                               quadrature));
   this->compute_face_data(quadrature.size(), data);
 
   return data_ptr;
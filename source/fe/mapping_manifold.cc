@@ -334,7 +334,7 @@ MappingManifold<dim, spacedim>::get_face_data(
     std::make_unique<InternalData>();
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
   data.initialize_face(this->requires_update_flags(update_flags),
-                       QProjector<dim>::project_to_all_faces(
+                       *QProjector<dim>::project_to_all_faces_shared(
                          ReferenceCells::get_hypercube<dim>(), quadrature[0]),
                        quadrature[0].size());
 
@@ -353,7 +353,7 @@ MappingManifold<dim, spacedim>::get_subface_data(
     std::make_unique<InternalData>();
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
   data.initialize_face(this->requires_update_flags(update_flags),
-                       QProjector<dim>::project_to_all_subfaces(
+                       *QProjector<dim>::project_to_all_subfaces_shared(
                          ReferenceCells::get_hypercube<dim>(), quadrature),
                        quadrature.size());
 
@@ -15,6 +15,7 @@
 
 #include <deal.II/base/array_view.h>
 #include <deal.II/base/derivative_form.h>
+#include <deal.II/base/lazy.h>
 #include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/qprojector.h>
 #include <deal.II/base/quadrature.h>
@@ -41,6 +42,8 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <typeinfo>
+#include <utility>
 
 
 DEAL_II_NAMESPACE_OPEN
@@ -64,7 +67,6 @@ MappingQ<dim, spacedim>::InternalData::memory_consumption() const
 {
   return (
     Mapping<dim, spacedim>::InternalDataBase::memory_consumption() +
-    MemoryConsumption::memory_consumption(quadrature_points) +
     MemoryConsumption::memory_consumption(unit_tangentials) +
     MemoryConsumption::memory_consumption(aux) +
     MemoryConsumption::memory_consumption(mapping_support_points) +
@@ -161,15 +163,30 @@ MappingQ<dim, spacedim>::InternalData::initialize_face(
   const Quadrature<dim> &quadrature,
   const unsigned int     n_original_q_points)
 {
-  reinit(update_flags, quadrature);
+  initialize_face(update_flags,
+                  std::make_shared<const Quadrature<dim>>(quadrature),
+                  n_original_q_points);
+}
+
 
-  quadrature_points = quadrature.get_points();
+
+template <int dim, int spacedim>
+void
+MappingQ<dim, spacedim>::InternalData::initialize_face(
+  const UpdateFlags                             update_flags,
+  const std::shared_ptr<const Quadrature<dim>> &quadrature,
+  const unsigned int                            n_original_q_points)
+{
+  reinit(update_flags, *quadrature);
+
+  face_quadrature   = quadrature;
+  quadrature_points = make_array_view(face_quadrature->get_points());
 
   if (dim > 1 && tensor_product_quadrature)
     {
       constexpr unsigned int facedim = dim - 1;
       const FE_DGQ<1>        fe(polynomial_degree);
-      shape_info.reinit(quadrature.get_tensor_basis()[0], fe);
+      shape_info.reinit(face_quadrature->get_tensor_basis()[0], fe);
       shape_info.lexicographic_numbering =
         FETools::lexicographic_to_hierarchic_numbering<facedim>(
           polynomial_degree);
@@ -213,6 +230,42 @@ MappingQ<dim, spacedim>::InternalData::initialize_face(
 
 
 
+namespace
+{
+  // The weights to compute interior support points from the perimeter only
+  // depend on the polynomial degree and the dimension, but are expensive to
+  // compute for high degrees. Programs often create many mappings of the same
+  // degree, so compute them only once and share them among all mappings.
+  std::shared_ptr<const std::vector<Table<2, double>>>
+  get_support_point_weights_perimeter_to_interior(const unsigned int degree,
+                                                  const unsigned int dim)
+  {
+    static LazyRegistry<std::pair<unsigned int, unsigned int>,
+                        std::vector<Table<2, double>>>
+      registry;
+    return registry.get_or_create(std::make_pair(degree, dim), [&]() {
+      return internal::MappingQImplementation::
+        compute_support_point_weights_perimeter_to_interior(degree, dim);
+    });
+  }
+
+
+
+  // Same for the weights of the cell interior
+  template <int dim>
+  std::shared_ptr<const Table<2, double>>
+  get_support_point_weights_cell(const unsigned int degree)
+  {
+    static LazyRegistry<unsigned int, Table<2, double>> registry;
+    return registry.get_or_create(degree, [&]() {
+      return internal::MappingQImplementation::
+        compute_support_point_weights_cell<dim>(degree);
+    });
+  }
+} // namespace
+
+
+
 template <int dim, int spacedim>
 MappingQ<dim, spacedim>::MappingQ(const unsigned int p)
   : polynomial_degree(p)
@@ -227,13 +280,10 @@ MappingQ<dim, spacedim>::MappingQ(const unsigned int p)
         line_support_points,
         renumber_lexicographic_to_hierarchic))
   , support_point_weights_perimeter_to_interior(
-      internal::MappingQImplementation::
-        compute_support_point_weights_perimeter_to_interior(
-          this->polynomial_degree,
-          dim))
+      *get_support_point_weights_perimeter_to_interior(this->polynomial_degree,
+                                                       dim))
   , support_point_weights_cell(
-      internal::MappingQImplementation::compute_support_point_weights_cell<dim>(
-        this->polynomial_degree))
+      *get_support_point_weights_cell<dim>(this->polynomial_degree))
 {
   Assert(p >= 1,
          ExcMessage("It only makes sense to create polynomial mappings "
@@ -304,6 +354,60 @@ MappingQ<dim, spacedim>::transform_unit_to_real_cell(
 }
 
 
+template <int dim, int spacedim>
+void
+MappingQ<dim, spacedim>::transform_points_unit_to_real_cell(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  const ArrayView<const Point<dim>>                          &unit_points,
+  const ArrayView<Point<spacedim>>                           &real_points) const
+{
+  AssertDimension(unit_points.size(), real_points.size());
+  std::vector<Point<spacedim>> support_points_higher_order;
+  boost::container::small_vector<Point<spacedim>,
+                                 GeometryInfo<dim>::vertices_per_cell>
+    vertices;
+  if (polynomial_degree == 1)
+    vertices = this->get_vertices(cell);
+  else
+    support_points_higher_order = this->compute_mapping_support_points(cell);
+  const ArrayView<const Point<spacedim>> support_points(
+    polynomial_degree == 1 ? vertices.data() :
+                             support_points_higher_order.data(),
+    Utilities::pow(polynomial_degree + 1, dim));
+
+  const unsigned int n_points = unit_points.size();
+  const unsigned int n_lanes  = VectorizedArray<double>::size();
+
+  // Evaluate the mapping for n_lanes points at a time, filling the unused
+  // lanes of the last batch with the last point
+  for (unsigned int i = 0; i < n_points; i += n_lanes)
+    {
+      const unsigned int n_filled_lanes = std::min(n_lanes, n_points - i);
+
+      Point<dim, VectorizedArray<double>> p_vec;
+      for (unsigned int j = 0; j < n_lanes; ++j)
+        for (unsigned int d = 0; d < dim; ++d)
+          p_vec[d][j] = unit_points[i + std::min(j, n_filled_lanes - 1)][d];
+
+      const auto real_point =
+        (polynomial_degree == 1 ?
+           internal::evaluate_tensor_product_value_linear(
+             support_points.data(), p_vec) :
+           internal::evaluate_tensor_product_value(
+             polynomials_1d,
+             support_points,
+             p_vec,
+             false,
+             renumber_lexicographic_to_hierarchic));
+
+      for (unsigned int j = 0; j < n_filled_lanes; ++j)
+        for (unsigned int d = 0; d < spacedim; ++d)
+          real_points[i + j][d] = real_point[d][j];
+    }
+}
+
+
+
 // In the code below, GCC tries to instantiate MappingQ<3,4> when
 // seeing which of the overloaded versions of
 // do_transform_real_to_unit_cell_internal() to call. This leads to bad
@@ -801,7 +905,7 @@ MappingQ<dim, spacedim>::get_face_data(
     std::make_unique<InternalData>(polynomial_degree);
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
   data.initialize_face(this->requires_update_flags(update_flags),
-                       QProjector<dim>::project_to_all_faces(
+                       QProjector<dim>::project_to_all_faces_shared(
                          ReferenceCells::get_hypercube<dim>(), quadrature[0]),
                        quadrature[0].size());
 
@@ -820,7 +924,7 @@ MappingQ<dim, spacedim>::get_subface_data(
     std::make_unique<InternalData>(polynomial_degree);
   auto &data = dynamic_cast<InternalData &>(*data_ptr);
   data.initialize_face(this->requires_update_flags(update_flags),
-                       QProjector<dim>::project_to_all_subfaces(
+                       QProjector<dim>::project_to_all_subfaces_shared(
                          ReferenceCells::get_hypercube<dim>(), quadrature),
                        quadrature.size());
 
@@ -865,7 +969,7 @@ MappingQ<dim, spacedim>::fill_fe_values(
         data.mapping_support_points[i] = vertices[i];
     }
   else
-    data.mapping_support_points = this->compute_mapping_support_points(cell);
+    fill_mapping_support_points(cell, data.mapping_support_points);
 
   data.cell_of_current_support_points = cell;
 
@@ -1094,8 +1198,7 @@ MappingQ<dim, spacedim>::fill_fe_face_values(
             data.mapping_support_points[i] = vertices[i];
         }
       else
-        data.mapping_support_points =
-          this->compute_mapping_support_points(cell);
+        fill_mapping_support_points(cell, data.mapping_support_points);
       data.cell_of_current_support_points = cell;
     }
 
@@ -1156,8 +1259,7 @@ MappingQ<dim, spacedim>::fill_fe_subface_values(
             data.mapping_support_points[i] = vertices[i];
         }
       else
-        data.mapping_support_points =
-          this->compute_mapping_support_points(cell);
+        fill_mapping_support_points(cell, data.mapping_support_points);
       data.cell_of_current_support_points = cell;
     }
 
@@ -1209,7 +1311,7 @@ MappingQ<dim, spacedim>::fill_fe_immersed_surface_values(
         data.mapping_support_points[i] = vertices[i];
     }
   else
-    data.mapping_support_points = this->compute_mapping_support_points(cell);
+    fill_mapping_support_points(cell, data.mapping_support_points);
   data.cell_of_current_support_points = cell;
 
   internal::MappingQImplementation::maybe_update_q_points_Jacobians_generic(
@@ -1354,7 +1456,7 @@ MappingQ<dim, spacedim>::fill_mapping_data_for_generic_points(
         data.mapping_support_points[i] = vertices[i];
     }
   else
-    data.mapping_support_points = this->compute_mapping_support_points(cell);
+    fill_mapping_support_points(cell, data.mapping_support_points);
 
   internal::MappingQImplementation::maybe_update_q_points_Jacobians_generic(
     CellSimilarity::none,
@@ -1395,7 +1497,7 @@ MappingQ<dim, spacedim>::fill_mapping_data_for_face_quadrature(
         data.mapping_support_points[i] = vertices[i];
     }
   else
-    data.mapping_support_points = this->compute_mapping_support_points(cell);
+    fill_mapping_support_points(cell, data.mapping_support_points);
   data.output_data = &output_data;
 
   internal::MappingQImplementation::do_fill_fe_face_values(
@@ -1736,8 +1838,39 @@ std::vector<Point<spacedim>>
 MappingQ<dim, spacedim>::compute_mapping_support_points(
   const typename Triangulation<dim, spacedim>::cell_iterator &cell) const
 {
-  // get the vertices first
   std::vector<Point<spacedim>> a;
+  do_compute_mapping_support_points(cell, a);
+  return a;
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQ<dim, spacedim>::fill_mapping_support_points(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  std::vector<Point<spacedim>>                               &points) const
+{
+  // derived classes may compute the support points differently by
+  // overriding compute_mapping_support_points(), so we can only write into
+  // the existing memory if we know that this is not the case
+  if (typeid(*this) == typeid(MappingQ<dim, spacedim>) ||
+      typeid(*this) == typeid(MappingQ1<dim, spacedim>))
+    do_compute_mapping_support_points(cell, points);
+  else
+    points = this->compute_mapping_support_points(cell);
+}
+
+
+
+template <int dim, int spacedim>
+void
+MappingQ<dim, spacedim>::do_compute_mapping_support_points(
+  const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+  std::vector<Point<spacedim>>                               &a) const
+{
+  // get the vertices first
+  a.clear();
   a.reserve(Utilities::fixed_power<dim>(polynomial_degree + 1));
   for (const unsigned int i : GeometryInfo<dim>::vertex_indices())
     a.push_back(cell->vertex(i));
@@ -1824,8 +1957,6 @@ MappingQ<dim, spacedim>::compute_mapping_support_points(
               break;
           }
     }
-
-  return a;
 }
 
 
@@ -695,6 +695,85 @@ MappingQCache<dim, spacedim>::initialize(
 
 
 
+template <int dim, int spacedim>
+template <typename VectorType>
+void
+MappingQCache<dim, spacedim>::add_displacement(
+  const DoFHandler<dim, spacedim> &dof_handler,
+  const VectorType                &displacement)
+{
+  Assert(support_point_cache.get() != nullptr,
+         ExcMessage("Must call MappingQCache::initialize() before "
+                    "calling add_displacement()!"));
+  AssertDimension(support_point_cache->size(),
+                  dof_handler.get_triangulation().n_levels());
+
+  AssertDimension(dof_handler.get_fe_collection().size(), 1);
+  const FiniteElement<dim, spacedim> &fe = dof_handler.get_fe();
+  AssertDimension(fe.n_base_elements(), 1);
+  AssertDimension(fe.element_multiplicity(0), spacedim);
+
+  const unsigned int is_fe_q =
+    dynamic_cast<const FE_Q<dim, spacedim> *>(&fe.base_element(0)) != nullptr;
+  const unsigned int is_fe_dgq =
+    dynamic_cast<const FE_DGQ<dim, spacedim> *>(&fe.base_element(0)) != nullptr;
+  AssertThrow((is_fe_q || is_fe_dgq) && fe.degree == this->get_degree(),
+              ExcMessage("The displacement must be given by FE_Q or FE_DGQ "
+                         "elements of the same degree as the mapping."));
+
+  const auto lexicographic_to_hierarchic_numbering =
+    Utilities::invert_permutation(
+      FETools::hierarchic_to_lexicographic_numbering<spacedim>(
+        this->get_degree()));
+
+  // copy global vector so that the ghost values are such that the cache can
+  // be updated for all ghost cells
+  LinearAlgebra::distributed::Vector<typename VectorType::value_type>
+                 vector_ghosted;
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler);
+  vector_ghosted.reinit(dof_handler.locally_owned_dofs(),
+                        locally_relevant_dofs,
+                        dof_handler.get_communicator());
+  copy_locally_owned_data_from(displacement, vector_ghosted);
+  vector_ghosted.update_ghost_values();
+
+  WorkStream::run(
+    dof_handler.begin_active(),
+    typename DoFHandler<dim, spacedim>::active_cell_iterator(
+      dof_handler.end()),
+    [&](const typename DoFHandler<dim, spacedim>::active_cell_iterator &cell,
+        void *,
+        void *) {
+      if (cell->is_artificial())
+        return;
+
+      std::vector<Point<spacedim>> &points =
+        (*support_point_cache)[cell->level()][cell->index()];
+
+      std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+      cell->get_dof_indices(dof_indices);
+
+      for (unsigned int i = 0; i < dof_indices.size(); ++i)
+        {
+          const auto id = fe.system_to_component_index(i);
+          const unsigned int point =
+            is_fe_q ? id.second :
+                      lexicographic_to_hierarchic_numbering[id.second];
+          points[point][id.first] += vector_ghosted(dof_indices[i]);
+        }
+    },
+    /* copier */ std::function<void(void *)>(),
+    /* scratch_data */ nullptr,
+    /* copy_data */ nullptr,
+    2 * MultithreadInfo::n_threads(),
+    /* chunk_size = */ 1);
+
+  uses_level_info = false;
+}
+
+
+
 template <int dim, int spacedim>
 std::size_t
 MappingQCache<dim, spacedim>::memory_consumption() const
@@ -14,6 +14,7 @@
 
 
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/path_search.h>
 #include <deal.II/base/patterns.h>
 #include <deal.II/base/utilities.h>
@@ -103,6 +104,58 @@ namespace
     Assert(dim != 1, ExcInternalError());
   }
 
+  /**
+   * A map from the numbers that a gmsh file assigns to its vertices to their
+   * indices in the list of vertices that is read from the file. Gmsh usually
+   * numbers vertices contiguously, in which case the map is stored as a
+   * vector indexed by the vertex numbers, and in a std::map otherwise.
+   */
+  class GmshVertexNumbering
+  {
+  public:
+    /**
+     * Constructor. The argument contains the number of each vertex in the
+     * file, in the order in which the vertices were read.
+     */
+    explicit GmshVertexNumbering(
+      const std::vector<std::size_t> &vertex_numbers)
+    {
+      const std::size_t max_number =
+        vertex_numbers.empty() ?
+          0 :
+          *std::max_element(vertex_numbers.begin(), vertex_numbers.end());
+      if (max_number <= 2 * vertex_numbers.size())
+        {
+          dense_indices.resize(max_number + 1, numbers::invalid_unsigned_int);
+          for (unsigned int i = 0; i < vertex_numbers.size(); ++i)
+            dense_indices[vertex_numbers[i]] = i;
+        }
+      else
+        for (unsigned int i = 0; i < vertex_numbers.size(); ++i)
+          sparse_indices[vertex_numbers[i]] = i;
+    }
+
+    /**
+     * Return the index of the vertex with the given number, or
+     * numbers::invalid_unsigned_int if the file has no such vertex.
+     */
+    unsigned int
+    operator()(const std::size_t number) const
+    {
+      if (!dense_indices.empty())
+        return number < dense_indices.size() ? dense_indices[number] :
+                                               numbers::invalid_unsigned_int;
+
+      const auto it = sparse_indices.find(number);
+      return it != sparse_indices.end() ? it->second :
+                                          numbers::invalid_unsigned_int;
+    }
+
+  private:
+    std::vector<unsigned int>           dense_indices;
+    std::map<std::size_t, unsigned int> sparse_indices;
+  };
+
   /**
    * Apply each of the grid fixup routines in the correct sequence.
    */
@@ -2017,6 +2070,23 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
   // assign boundary ids.
   std::array<std::map<int, int>, 4> tag_maps;
 
+  // Gmsh 4.1 files may store the data of their sections in binary form, in
+  // which case integer entries are stored as int or size_t depending on their
+  // meaning. The following functions read entries of the given types from
+  // either kind of file, and skip the newline that separates a section
+  // marker from its binary data.
+  bool       binary       = false;
+  const auto read_entries = [&in, &binary](auto &...values) {
+    if (binary)
+      (in.read(reinterpret_cast<char *>(&values), sizeof(values)), ...);
+    else
+      (in >> ... >> values);
+  };
+  const auto start_binary_data = [&in, &binary]() {
+    if (binary)
+      in.get();
+  };
+
   in >> line;
 
   // first determine file format
@@ -2040,9 +2110,25 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
       Assert((version >= 2.0) && (version <= 4.1), ExcNotImplemented());
       gmsh_file_format = static_cast<unsigned int>(version * 10);
 
-      Assert(file_type == 0, ExcNotImplemented());
+      AssertThrow(file_type == 0 || (file_type == 1 && gmsh_file_format == 41),
+                  ExcMessage("Binary gmsh files can only be read in the "
+                             "format version 4.1."));
       Assert(data_size == sizeof(double), ExcNotImplemented());
 
+      // binary files store the integer 1 after the header line, from which
+      // the endianness of the file can be determined
+      binary = (file_type == 1);
+      if (binary)
+        {
+          AssertThrow(data_size == sizeof(std::size_t), ExcNotImplemented());
+          int one = 0;
+          start_binary_data();
+          read_entries(one);
+          AssertThrow(one == 1,
+                      ExcMessage("Binary gmsh files written on a machine with "
+                                 "a different endianness are not supported."));
+        }
+
       // read the end of the header and the first line of the nodes
       // description to synch ourselves with the format 1 handling above
       in >> line;
@@ -2063,22 +2149,23 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
       // if the next block is of kind $Entities, parse it
       if (line == "$Entities")
         {
-          unsigned long n_points, n_curves, n_surfaces, n_volumes;
+          start_binary_data();
+          std::size_t n_points, n_curves, n_surfaces, n_volumes;
 
-          in >> n_points >> n_curves >> n_surfaces >> n_volumes;
+          read_entries(n_points, n_curves, n_surfaces, n_volumes);
           for (unsigned int i = 0; i < n_points; ++i)
             {
               // parse point ids
-              int          tag;
-              unsigned int n_physicals;
+              int         tag;
+              std::size_t n_physicals;
               double box_min_x, box_min_y, box_min_z, box_max_x, box_max_y,
                 box_max_z;
 
               // we only care for 'tag' as key for tag_maps[0]
               if (gmsh_file_format > 40)
                 {
-                  in >> tag >> box_min_x >> box_min_y >> box_min_z >>
-                    n_physicals;
+                  read_entries(
+                    tag, box_min_x, box_min_y, box_min_z, n_physicals);
                   box_max_x = box_min_x;
                   box_max_y = box_min_y;
                   box_max_z = box_min_z;
@@ -2095,20 +2182,26 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
               // if there is no physical tag, use 0 as default
               int physical_tag = 0;
               for (unsigned int j = 0; j < n_physicals; ++j)
-                in >> physical_tag;
+                read_entries(physical_tag);
               tag_maps[0][tag] = physical_tag;
             }
           for (unsigned int i = 0; i < n_curves; ++i)
             {
               // parse curve ids
-              int          tag;
-              unsigned int n_physicals;
+              int         tag;
+              std::size_t n_physicals;
               double box_min_x, box_min_y, box_min_z, box_max_x, box_max_y,
                 box_max_z;
 
               // we only care for 'tag' as key for tag_maps[1]
-              in >> tag >> box_min_x >> box_min_y >> box_min_z >> box_max_x >>
-                box_max_y >> box_max_z >> n_physicals;
+              read_entries(tag,
+                           box_min_x,
+                           box_min_y,
+                           box_min_z,
+                           box_max_x,
+                           box_max_y,
+                           box_max_z,
+                           n_physicals);
               // if there is a physical tag, we will use it as boundary id
               // below
               AssertThrow(n_physicals < 2,
@@ -2116,27 +2209,33 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
               // if there is no physical tag, use 0 as default
               int physical_tag = 0;
               for (unsigned int j = 0; j < n_physicals; ++j)
-                in >> physical_tag;
+                read_entries(physical_tag);
               tag_maps[1][tag] = physical_tag;
               // we don't care about the points associated to a curve, but
               // have to parse them anyway because their format is
               // unstructured
-              in >> n_points;
+              read_entries(n_points);
               for (unsigned int j = 0; j < n_points; ++j)
-                in >> tag;
+                read_entries(tag);
             }
 
           for (unsigned int i = 0; i < n_surfaces; ++i)
             {
               // parse surface ids
-              int          tag;
-              unsigned int n_physicals;
+              int         tag;
+              std::size_t n_physicals;
               double box_min_x, box_min_y, box_min_z, box_max_x, box_max_y,
                 box_max_z;
 
               // we only care for 'tag' as key for tag_maps[2]
-              in >> tag >> box_min_x >> box_min_y >> box_min_z >> box_max_x >>
-                box_max_y >> box_max_z >> n_physicals;
+              read_entries(tag,
+                           box_min_x,
+                           box_min_y,
+                           box_min_z,
+                           box_max_x,
+                           box_max_y,
+                           box_max_z,
+                           n_physicals);
               // if there is a physical tag, we will use it as boundary id
               // below
               AssertThrow(n_physicals < 2,
@@ -2144,26 +2243,32 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
               // if there is no physical tag, use 0 as default
               int physical_tag = 0;
               for (unsigned int j = 0; j < n_physicals; ++j)
-                in >> physical_tag;
+                read_entries(physical_tag);
               tag_maps[2][tag] = physical_tag;
               // we don't care about the curves associated to a surface, but
               // have to parse them anyway because their format is
               // unstructured
-              in >> n_curves;
+              read_entries(n_curves);
               for (unsigned int j = 0; j < n_curves; ++j)
-                in >> tag;
+                read_entries(tag);
             }
           for (unsigned int i = 0; i < n_volumes; ++i)
             {
               // parse volume ids
-              int          tag;
-              unsigned int n_physicals;
+              int         tag;
+              std::size_t n_physicals;
               double box_min_x, box_min_y, box_min_z, box_max_x, box_max_y,
                 box_max_z;
 
               // we only care for 'tag' as key for tag_maps[3]
-              in >> tag >> box_min_x >> box_min_y >> box_min_z >> box_max_x >>
-                box_max_y >> box_max_z >> n_physicals;
+              read_entries(tag,
+                           box_min_x,
+                           box_min_y,
+                           box_min_z,
+                           box_max_x,
+                           box_max_y,
+                           box_max_z,
+                           n_physicals);
               // if there is a physical tag, we will use it as boundary id
               // below
               AssertThrow(n_physicals < 2,
@@ -2171,14 +2276,14 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
               // if there is no physical tag, use 0 as default
               int physical_tag = 0;
               for (unsigned int j = 0; j < n_physicals; ++j)
-                in >> physical_tag;
+                read_entries(physical_tag);
               tag_maps[3][tag] = physical_tag;
               // we don't care about the surfaces associated to a volume, but
               // have to parse them anyway because their format is
               // unstructured
-              in >> n_surfaces;
+              read_entries(n_surfaces);
               for (unsigned int j = 0; j < n_surfaces; ++j)
-                in >> tag;
+                read_entries(tag);
             }
           in >> line;
           AssertThrow(line == "$EndEntities", ExcInvalidGMSHInput(line));
@@ -2206,9 +2311,11 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
   int n_entity_blocks = 1;
   if (gmsh_file_format > 40)
     {
-      int min_node_tag;
-      int max_node_tag;
-      in >> n_entity_blocks >> n_vertices >> min_node_tag >> max_node_tag;
+      start_binary_data();
+      std::size_t n_blocks, n_nodes, min_node_tag, max_node_tag;
+      read_entries(n_blocks, n_nodes, min_node_tag, max_node_tag);
+      n_entity_blocks = n_blocks;
+      n_vertices      = n_nodes;
     }
   else if (gmsh_file_format == 40)
     {
@@ -2217,17 +2324,16 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
   else
     in >> n_vertices;
   std::vector<Point<spacedim>> vertices(n_vertices);
-  // set up mapping between numbering
-  // in msh-file (nod) and in the
-  // vertices vector
-  std::map<int, int> vertex_indices;
+  // the number of each vertex in the msh-file (nod), from which we set up
+  // the mapping to the index in the vertices vector below
+  std::vector<std::size_t> vertex_numbers(n_vertices);
 
   {
     unsigned int global_vertex = 0;
     for (int entity_block = 0; entity_block < n_entity_blocks; ++entity_block)
       {
-        int           parametric;
-        unsigned long numNodes;
+        int         parametric;
+        std::size_t numNodes;
 
         if (gmsh_file_format < 40)
           {
@@ -2239,54 +2345,77 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
             // for gmsh_file_format 4.1 the order of tag and dim is reversed,
             // but we are ignoring both anyway.
             int tagEntity, dimEntity;
-            in >> tagEntity >> dimEntity >> parametric >> numNodes;
+            read_entries(tagEntity, dimEntity, parametric, numNodes);
           }
+        AssertThrow(global_vertex + numNodes <= n_vertices, ExcIO());
 
-        std::vector<int> vertex_numbers;
-        int              vertex_number;
-        if (gmsh_file_format > 40)
-          for (unsigned long vertex_per_entity = 0;
-               vertex_per_entity < numNodes;
-               ++vertex_per_entity)
-            {
-              in >> vertex_number;
-              vertex_numbers.push_back(vertex_number);
-            }
+        // we ignore the parametric coordinates u and v that may follow the
+        // coordinates of each vertex
+        const unsigned int n_values_per_vertex = (parametric != 0) ? 5 : 3;
 
-        for (unsigned long vertex_per_entity = 0; vertex_per_entity < numNodes;
-             ++vertex_per_entity, ++global_vertex)
+        if (binary)
+          {
+            // a binary block stores the numbers of all of its vertices
+            // followed by their coordinates, so read both at once and convert
+            // the coordinates in parallel
+            in.read(reinterpret_cast<char *>(&vertex_numbers[global_vertex]),
+                    numNodes * sizeof(std::size_t));
+            std::vector<double> values(numNodes * n_values_per_vertex);
+            in.read(reinterpret_cast<char *>(values.data()),
+                    values.size() * sizeof(double));
+
+            parallel::apply_to_subranges(
+              std::size_t(0),
+              numNodes,
+              [&](const std::size_t begin, const std::size_t end) {
+                for (std::size_t v = begin; v < end; ++v)
+                  for (unsigned int d = 0; d < spacedim; ++d)
+                    vertices[global_vertex + v][d] =
+                      values[v * n_values_per_vertex + d];
+              },
+              4096);
+            global_vertex += numNodes;
+          }
+        else
           {
-            int    vertex_number;
-            double x[3];
-
-            // read vertex
             if (gmsh_file_format > 40)
+              for (std::size_t vertex_per_entity = 0;
+                   vertex_per_entity < numNodes;
+                   ++vertex_per_entity)
+                in >> vertex_numbers[global_vertex + vertex_per_entity];
+
+            for (std::size_t vertex_per_entity = 0;
+                 vertex_per_entity < numNodes;
+                 ++vertex_per_entity, ++global_vertex)
               {
-                vertex_number = vertex_numbers[vertex_per_entity];
-                in >> x[0] >> x[1] >> x[2];
-              }
-            else
-              in >> vertex_number >> x[0] >> x[1] >> x[2];
+                double x[3];
 
-            for (unsigned int d = 0; d < spacedim; ++d)
-              vertices[global_vertex][d] = x[d];
-            // store mapping
-            vertex_indices[vertex_number] = global_vertex;
+                // read vertex
+                if (gmsh_file_format > 40)
+                  in >> x[0] >> x[1] >> x[2];
+                else
+                  in >> vertex_numbers[global_vertex] >> x[0] >> x[1] >> x[2];
 
-            // ignore parametric coordinates
-            if (parametric != 0)
-              {
-                double u = 0.;
-                double v = 0.;
-                in >> u >> v;
-                (void)u;
-                (void)v;
+                for (unsigned int d = 0; d < spacedim; ++d)
+                  vertices[global_vertex][d] = x[d];
+
+                // ignore parametric coordinates
+                for (unsigned int i = 3; i < n_values_per_vertex; ++i)
+                  {
+                    double u = 0.;
+                    in >> u;
+                    (void)u;
+                  }
               }
           }
       }
     AssertDimension(global_vertex, n_vertices);
   }
 
+  // set up mapping between numbering in msh-file (nod) and in the vertices
+  // vector
+  const GmshVertexNumbering vertex_indices(vertex_numbers);
+
   // Assert we reached the end of the block
   in >> line;
   static const std::string end_nodes_marker[] = {"$ENDNOD", "$EndNodes"};
@@ -2300,11 +2429,13 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
               ExcInvalidGMSHInput(line));
 
   // now read the cell list
+  start_binary_data();
   if (gmsh_file_format > 40)
     {
-      int min_node_tag;
-      int max_node_tag;
-      in >> n_entity_blocks >> n_cells >> min_node_tag >> max_node_tag;
+      std::size_t n_blocks, n_elements, min_element_tag, max_element_tag;
+      read_entries(n_blocks, n_elements, min_element_tag, max_element_tag);
+      n_entity_blocks = n_blocks;
+      n_cells         = n_elements;
     }
   else if (gmsh_file_format == 40)
     {
@@ -2332,12 +2463,18 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
   {
     static constexpr std::array<unsigned int, 8> local_vertex_numbering = {
       {0, 1, 5, 4, 2, 3, 7, 6}};
+    // the vertices of elements are stored as size_t in binary files
+    const auto read_vertex_number = [&read_entries]() {
+      std::size_t vertex_number;
+      read_entries(vertex_number);
+      return static_cast<unsigned int>(vertex_number);
+    };
     unsigned int global_cell = 0;
     for (int entity_block = 0; entity_block < n_entity_blocks; ++entity_block)
       {
-        unsigned int  material_id;
-        unsigned long numElements;
-        int           cell_type;
+        unsigned int material_id;
+        std::size_t  numElements;
+        int          cell_type;
 
         if (gmsh_file_format < 40)
           {
@@ -2355,11 +2492,11 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
           {
             // for gmsh_file_format 4.1 the order of tag and dim is reversed,
             int tagEntity, dimEntity;
-            in >> dimEntity >> tagEntity >> cell_type >> numElements;
+            read_entries(dimEntity, tagEntity, cell_type, numElements);
             material_id = tag_maps[dimEntity][tagEntity];
           }
 
-        for (unsigned int cell_per_entity = 0; cell_per_entity < numElements;
+        for (std::size_t cell_per_entity = 0; cell_per_entity < numElements;
              ++cell_per_entity, ++global_cell)
           {
             // note that since in the input
@@ -2432,8 +2569,8 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
             else // file format version 4.0 and later
               {
                 // ignore tag
-                int tag;
-                in >> tag;
+                std::size_t tag;
+                read_entries(tag);
 
                 if (cell_type == 1) // line
                   nod_num = 2;
@@ -2502,11 +2639,12 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                     // hypercube cells need to be reordered
                     if (vertices_per_cell ==
                         GeometryInfo<dim>::vertices_per_cell)
-                      in >> cell.vertices[dim == 3 ?
-                                            local_vertex_numbering[i] :
-                                            GeometryInfo<dim>::ucd_to_deal[i]];
+                      cell.vertices[dim == 3 ?
+                                      local_vertex_numbering[i] :
+                                      GeometryInfo<dim>::ucd_to_deal[i]] =
+                        read_vertex_number();
                     else
-                      in >> cell.vertices[i];
+                      cell.vertices[i] = read_vertex_number();
                   }
 
                 // to make sure that the cast won't fail
@@ -2525,13 +2663,13 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                 // transform from gmsh to consecutive numbering
                 for (unsigned int i = 0; i < vertices_per_cell; ++i)
                   {
-                    AssertThrow(vertex_indices.find(cell.vertices[i]) !=
-                                  vertex_indices.end(),
+                    const unsigned int vertex =
+                      vertex_indices(cell.vertices[i]);
+                    AssertThrow(vertex != numbers::invalid_unsigned_int,
                                 ExcInvalidVertexIndexGmsh(cell_per_entity,
                                                           elm_number,
                                                           cell.vertices[i]));
 
-                    const auto vertex = vertex_indices[cell.vertices[i]];
                     if (dim == 1)
                       vertex_counts[vertex] += 1u;
                     cell.vertices[i] = vertex;
@@ -2542,8 +2680,9 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
               // boundary info
               {
                 subcelldata.boundary_lines.emplace_back();
-                in >> subcelldata.boundary_lines.back().vertices[0] >>
-                  subcelldata.boundary_lines.back().vertices[1];
+                for (unsigned int &vertex :
+                     subcelldata.boundary_lines.back().vertices)
+                  vertex = read_vertex_number();
 
                 // to make sure that the cast won't fail
                 Assert(material_id <=
@@ -2564,17 +2703,14 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                 // consecutive numbering
                 for (unsigned int &vertex :
                      subcelldata.boundary_lines.back().vertices)
-                  if (vertex_indices.find(vertex) != vertex_indices.end())
-                    // vertex with this index exists
-                    vertex = vertex_indices[vertex];
-                  else
-                    {
-                      // no such vertex index
-                      AssertThrow(false,
-                                  ExcInvalidVertexIndex(cell_per_entity,
-                                                        vertex));
-                      vertex = numbers::invalid_unsigned_int;
-                    }
+                  {
+                    // make sure that a vertex with this index exists
+                    AssertThrow(vertex_indices(vertex) !=
+                                  numbers::invalid_unsigned_int,
+                                ExcInvalidVertexIndex(cell_per_entity,
+                                                      vertex));
+                    vertex = vertex_indices(vertex);
+                  }
               }
             else if ((cell_type == 2 || cell_type == 3) &&
                      (dim == 3)) // a triangle or a quad in 3d
@@ -2594,7 +2730,8 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                   vertices_per_cell);
                 // for loop
                 for (unsigned int i = 0; i < vertices_per_cell; ++i)
-                  in >> subcelldata.boundary_quads.back().vertices[i];
+                  subcelldata.boundary_quads.back().vertices[i] =
+                    read_vertex_number();
 
                 // to make sure that the cast won't fail
                 Assert(material_id <=
@@ -2615,16 +2752,13 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                 // consecutive numbering
                 for (unsigned int &vertex :
                      subcelldata.boundary_quads.back().vertices)
-                  if (vertex_indices.find(vertex) != vertex_indices.end())
-                    // vertex with this index exists
-                    vertex = vertex_indices[vertex];
-                  else
-                    {
-                      // no such vertex index
-                      Assert(false,
-                             ExcInvalidVertexIndex(cell_per_entity, vertex));
-                      vertex = numbers::invalid_unsigned_int;
-                    }
+                  {
+                    // make sure that a vertex with this index exists
+                    Assert(vertex_indices(vertex) !=
+                             numbers::invalid_unsigned_int,
+                           ExcInvalidVertexIndex(cell_per_entity, vertex));
+                    vertex = vertex_indices(vertex);
+                  }
               }
             else if (cell_type == 15)
               {
@@ -2635,18 +2769,18 @@ GridIn<dim, spacedim>::read_msh(std::istream &in)
                     // For points (cell_type==15), we can only ever
                     // list one node index.
                     AssertThrow(nod_num == 1, ExcInternalError());
-                    in >> node_index;
+                    node_index = read_vertex_number();
                   }
                 else
                   {
-                    in >> node_index;
+                    node_index = read_vertex_number();
                   }
 
                 // we only care about boundary indicators assigned to
                 // individual vertices in 1d (because otherwise the vertices
                 // are not faces)
                 if (dim == 1)
-                  boundary_ids_1d[vertex_indices[node_index]] = material_id;
+                  boundary_ids_1d[vertex_indices(node_index)] = material_id;
               }
             else
               {
@@ -14,6 +14,8 @@
 
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/parameter_handler.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/qprojector.h>
@@ -3112,48 +3114,56 @@ GridOut::write_mathgl(const Triangulation<dim, spacedim> &tria,
 namespace
 {
   /**
-   * A function that is able to convert each cell of a triangulation into
-   * a patch that can then be output by the functions in DataOutBase.
-   * This is made particularly simple because the patch only needs to
-   * contain geometry info and additional properties of cells
+   * A function that is able to convert each of the given cells of a
+   * triangulation into a patch that can then be output by the functions in
+   * DataOutBase. This is made particularly simple because the patch only
+   * needs to contain geometry info and additional properties of cells. The
+   * cells are independent of each other, so the patches are filled in
+   * parallel.
    */
-  template <int dim, int spacedim, typename ITERATOR, typename END>
-  void
+  template <int dim, int spacedim>
+  std::vector<DataOutBase::Patch<dim, spacedim>>
   generate_triangulation_patches(
-    std::vector<DataOutBase::Patch<dim, spacedim>> &patches,
-    ITERATOR                                        cell,
-    END                                             end)
+    const std::vector<
+      typename Triangulation<dim, spacedim>::active_cell_iterator> &cells)
   {
-    // convert each of the active cells into a patch
-    for (; cell != end; ++cell)
-      {
-        DataOutBase::Patch<dim, spacedim> patch;
-        patch.reference_cell = cell->reference_cell();
-        patch.n_subdivisions = 1;
-        patch.data.reinit(5, cell->n_vertices());
+    std::vector<DataOutBase::Patch<dim, spacedim>> patches(cells.size());
 
-        for (const unsigned int v : cell->vertex_indices())
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
           {
-            patch.vertices[v] = cell->vertex(v);
-            patch.data(0, v)  = cell->level();
-            patch.data(1, v) =
-              static_cast<std::make_signed_t<types::manifold_id>>(
-                cell->manifold_id());
-            patch.data(2, v) =
-              static_cast<std::make_signed_t<types::material_id>>(
-                cell->material_id());
-            if (cell->is_active())
-              patch.data(3, v) =
-                static_cast<std::make_signed_t<types::subdomain_id>>(
-                  cell->subdomain_id());
-            else
-              patch.data(3, v) = -1;
-            patch.data(4, v) =
-              static_cast<std::make_signed_t<types::subdomain_id>>(
-                cell->level_subdomain_id());
+            const auto &cell = cells[i];
+
+            DataOutBase::Patch<dim, spacedim> &patch = patches[i];
+            patch.reference_cell = cell->reference_cell();
+            patch.n_subdivisions = 1;
+            patch.data.reinit(5, cell->n_vertices());
+
+            for (const unsigned int v : cell->vertex_indices())
+              {
+                patch.vertices[v] = cell->vertex(v);
+                patch.data(0, v)  = cell->level();
+                patch.data(1, v) =
+                  static_cast<std::make_signed_t<types::manifold_id>>(
+                    cell->manifold_id());
+                patch.data(2, v) =
+                  static_cast<std::make_signed_t<types::material_id>>(
+                    cell->material_id());
+                patch.data(3, v) =
+                  static_cast<std::make_signed_t<types::subdomain_id>>(
+                    cell->subdomain_id());
+                patch.data(4, v) =
+                  static_cast<std::make_signed_t<types::subdomain_id>>(
+                    cell->level_subdomain_id());
+              }
           }
-        patches.push_back(patch);
-      }
+      },
+      256);
+
+    return patches;
   }
 
 
@@ -3550,9 +3560,13 @@ GridOut::write_vtu(const Triangulation<dim, spacedim> &tria,
   // and then have them output. since there is no data attached to
   // the geometry, we also do not have to provide any names, identifying
   // information, etc.
-  std::vector<DataOutBase::Patch<dim, spacedim>> patches;
-  patches.reserve(tria.n_active_cells());
-  generate_triangulation_patches(patches, tria.begin_active(), tria.end());
+  std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+    cells;
+  cells.reserve(tria.n_active_cells());
+  for (const auto &cell : tria.active_cell_iterators())
+    cells.push_back(cell);
+  const std::vector<DataOutBase::Patch<dim, spacedim>> patches =
+    generate_triangulation_patches<dim, spacedim>(cells);
 
   DataOutBase::write_vtu_header(out, vtu_flags);
   DataOutBase::write_vtu_main(
@@ -3586,6 +3600,58 @@ GridOut::write_vtu(const Triangulation<dim, spacedim> &tria,
 
 
 
+template <int dim, int spacedim>
+void
+GridOut::write_vtu_in_parallel(const Triangulation<dim, spacedim> &tria,
+                               const std::string                  &filename,
+                               const MPI_Comm                      comm) const
+{
+  AssertThrow(vtu_flags.serialize_triangulation == false,
+              ExcMessage("Serializing the triangulation into the output "
+                         "file is not supported when writing in parallel."));
+
+  // every process converts its share of the cells into patches: the locally
+  // owned ones for parallel triangulations, and a contiguous range of the
+  // active cells otherwise
+  std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+    cells;
+  if (dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &tria) != nullptr)
+    {
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->is_locally_owned())
+          cells.push_back(cell);
+    }
+  else
+    {
+      const unsigned int  my_rank = Utilities::MPI::this_mpi_process(comm);
+      const unsigned int  n_ranks = Utilities::MPI::n_mpi_processes(comm);
+      const std::uint64_t n_cells = tria.n_active_cells();
+      const unsigned int  begin   = n_cells * my_rank / n_ranks;
+      const unsigned int  end     = n_cells * (my_rank + 1) / n_ranks;
+
+      cells.reserve(end - begin);
+      for (const auto &cell : tria.active_cell_iterators())
+        if (cell->active_cell_index() >= begin &&
+            cell->active_cell_index() < end)
+          cells.push_back(cell);
+    }
+
+  DataOutBase::write_vtu_in_parallel(
+    generate_triangulation_patches<dim, spacedim>(cells),
+    triangulation_patch_data_names(),
+    std::vector<
+      std::tuple<unsigned int,
+                 unsigned int,
+                 std::string,
+                 DataComponentInterpretation::DataComponentInterpretation>>(),
+    vtu_flags,
+    filename,
+    comm);
+}
+
+
+
 template <int dim, int spacedim>
 void
 GridOut::write_mesh_per_processor_as_vtu(
@@ -3409,19 +3409,20 @@ namespace GridTools
 
     // check if the given cell was already in the vector of cells before. If so,
     // insert in the corresponding vectors the reference point and the id.
-    // Otherwise append a new entry to all vectors.
+    // Otherwise append a new entry to all vectors. The position of each cell
+    // in the output vectors is looked up through its active cell index.
+    std::unordered_map<unsigned int, unsigned int> cell_to_output_index;
     const auto store_cell_point_and_id =
       [&](
         const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
         const Point<dim>   &ref_point,
         const unsigned int &id) {
-        const auto it = std::find(cells_out.rbegin(), cells_out.rend(), cell);
-        if (it != cells_out.rend())
+        const auto [it, inserted] = cell_to_output_index.emplace(
+          cell->active_cell_index(), cells_out.size());
+        if (!inserted)
           {
-            const auto cell_id =
-              (cells_out.size() - 1 - (it - cells_out.rbegin()));
-            qpoints_out[cell_id].emplace_back(ref_point);
-            maps_out[cell_id].emplace_back(id);
+            qpoints_out[it->second].emplace_back(ref_point);
+            maps_out[it->second].emplace_back(id);
           }
         else
           {
@@ -3431,6 +3432,11 @@ namespace GridTools
           }
       };
 
+    // Scratch arrays for the points inside a box
+    std::vector<unsigned int>    candidate_ids;
+    std::vector<Point<spacedim>> candidate_points;
+    std::vector<Point<dim>>      candidate_ref_points;
+
     // Check all points within a given pair of box and cell
     const auto check_all_points_within_box = [&](const auto &leaf) {
       const double                relative_tolerance = 1e-12;
@@ -3438,22 +3444,51 @@ namespace GridTools
         leaf.first.create_extended_relative(relative_tolerance);
       const auto &cell_hint = leaf.second;
 
+      candidate_ids.clear();
+      candidate_points.clear();
       for (const auto &point_and_id :
            p_tree | bgi::adaptors::queried(!bgi::satisfies(already_found) &&
                                            bgi::intersects(box)))
         {
-          const auto id = point_and_id.second;
-          const auto cell_and_ref =
-            GridTools::find_active_cell_around_point(cache,
-                                                     points[id],
-                                                     cell_hint);
-          const auto &cell      = cell_and_ref.first;
-          const auto &ref_point = cell_and_ref.second;
-
-          if (cell.state() == IteratorState::valid)
-            store_cell_point_and_id(cell, ref_point, id);
+          candidate_ids.push_back(point_and_id.second);
+          candidate_points.push_back(point_and_id.first);
+        }
+
+      // Invert the mapping on the cell of the box for all points at once,
+      // which is much cheaper than one inversion per point for mappings
+      // like MappingQ that vectorize over several points. Points that turn
+      // out not to be inside the cell are searched for individually.
+      candidate_ref_points.resize(candidate_points.size());
+      if (!cell_hint->is_artificial())
+        mapping.transform_points_real_to_unit_cell(
+          cell_hint,
+          make_array_view(candidate_points),
+          make_array_view(candidate_ref_points));
+
+      for (unsigned int i = 0; i < candidate_ids.size(); ++i)
+        {
+          const auto id = candidate_ids[i];
+
+          if (!cell_hint->is_artificial() &&
+              candidate_ref_points[i][0] !=
+                std::numeric_limits<double>::infinity() &&
+              cell_hint->reference_cell().contains_point(
+                candidate_ref_points[i], 1e-10))
+            store_cell_point_and_id(cell_hint, candidate_ref_points[i], id);
           else
-            missing_points_out.emplace_back(id);
+            {
+              const auto cell_and_ref =
+                GridTools::find_active_cell_around_point(cache,
+                                                         points[id],
+                                                         cell_hint);
+              const auto &cell      = cell_and_ref.first;
+              const auto &ref_point = cell_and_ref.second;
+
+              if (cell.state() == IteratorState::valid)
+                store_cell_point_and_id(cell, ref_point, id);
+              else
+                missing_points_out.emplace_back(id);
+            }
 
           // Don't look anymore for this point
           found_points[id] = true;
@@ -4022,10 +4057,39 @@ namespace GridTools
           {
             cell_hint = cache.get_triangulation().begin_active();
 
+#ifdef DEAL_II_WITH_ARBORX
+            // Find candidate cells for all requested points with a single
+            // query of the bounding volume hierarchy instead of one RTree
+            // query per point. Points without candidate cells can not be
+            // owned by this process, the others start the search from the
+            // first candidate cell.
+            const auto &[bvh, bvh_cells] =
+              cache.get_locally_owned_cell_bounding_boxes_bvh();
+
+            std::vector<BoundingBox<spacedim>> query_bounding_boxes;
+            query_bounding_boxes.reserve(request.size());
+            for (const auto &index_and_point : request)
+              query_bounding_boxes.emplace_back(
+                BoundingBox<spacedim>(index_and_point.second)
+                  .create_extended(tolerance));
+
+            const ArborXWrappers::BoundingBoxIntersectPredicate bb_intersect(
+              query_bounding_boxes);
+            const auto [candidate_indices, candidate_offsets] =
+              bvh.query(bb_intersect);
+#endif
+
             for (unsigned int i = 0; i < request.size(); ++i)
               {
                 const auto &index_and_point = request[i];
 
+#ifdef DEAL_II_WITH_ARBORX
+                if (candidate_offsets[i] == candidate_offsets[i + 1])
+                  continue;
+
+                cell_hint = bvh_cells[candidate_indices[candidate_offsets[i]]];
+#endif
+
                 const auto cells_and_reference_positions =
                   find_all_locally_owned_active_cells_around_point(
                     cache,
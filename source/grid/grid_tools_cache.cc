@@ -14,6 +14,7 @@
 
 #include <deal.II/base/bounding_box.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 
 #include <deal.II/grid/filtered_iterator.h>
 #include <deal.II/grid/grid_tools.h>
@@ -23,6 +24,34 @@ DEAL_II_NAMESPACE_OPEN
 
 namespace GridTools
 {
+  namespace
+  {
+    /**
+     * Fill the bounding boxes of the given cells, as computed by the
+     * mapping, in parallel. The cells have already been collected, as
+     * iterating over the cells is inherently sequential.
+     */
+    template <int dim, int spacedim>
+    void
+    compute_bounding_boxes(
+      const Mapping<dim, spacedim> &mapping,
+      std::vector<std::pair<
+        BoundingBox<spacedim>,
+        typename Triangulation<dim, spacedim>::active_cell_iterator>> &boxes)
+    {
+      parallel::apply_to_subranges(
+        0U,
+        static_cast<unsigned int>(boxes.size()),
+        [&](const unsigned int begin, const unsigned int end) {
+          for (unsigned int i = begin; i < end; ++i)
+            boxes[i].first = mapping.get_bounding_box(boxes[i].second);
+        },
+        256);
+    }
+  } // namespace
+
+
+
   template <int dim, int spacedim>
   Cache<dim, spacedim>::Cache(const Triangulation<dim, spacedim> &tria,
                               const Mapping<dim, spacedim>       &mapping)
@@ -30,17 +59,28 @@ namespace GridTools
     , tria(&tria)
     , mapping(&mapping)
   {
-    tria_signal =
-      tria.signals.any_change.connect([&]() { mark_for_update(update_all); });
+    // The any_change signal is triggered by the create, post_refinement,
+    // clear, and mesh_movement signals. Connect to these individually, so
+    // that we can keep the objects that only depend on the connectivity of
+    // the mesh if the vertices have merely been moved.
+    tria_signals.push_back(
+      tria.signals.create.connect([&]() { mark_for_update(update_all); }));
+    tria_signals.push_back(tria.signals.post_refinement.connect(
+      [&]() { mark_for_update(update_all); }));
+    tria_signals.push_back(
+      tria.signals.clear.connect([&]() { mark_for_update(update_all); }));
+    tria_signals.push_back(tria.signals.mesh_movement.connect(
+      [&]() { mark_for_update(update_geometry); }));
   }
 
   template <int dim, int spacedim>
   Cache<dim, spacedim>::~Cache()
   {
-    // Make sure that the signal that was attached to the triangulation
-    // is removed here.
-    if (tria_signal.connected())
-      tria_signal.disconnect();
+    // Make sure that the signals that were attached to the triangulation
+    // are removed here.
+    for (auto &connection : tria_signals)
+      if (connection.connected())
+        connection.disconnect();
   }
 
 
@@ -179,7 +219,8 @@ namespace GridTools
           boxes;
         boxes.reserve(tria->n_active_cells());
         for (const auto &cell : tria->active_cell_iterators())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+          boxes.emplace_back(BoundingBox<spacedim>(), cell);
+        compute_bounding_boxes(*mapping, boxes);
 
         cell_bounding_boxes_rtree = pack_rtree(boxes);
 
@@ -220,7 +261,8 @@ namespace GridTools
           boxes.reserve(tria->n_active_cells());
         for (const auto &cell : tria->active_cell_iterators() |
                                   IteratorFilters::LocallyOwnedCell())
-          boxes.emplace_back(mapping->get_bounding_box(cell), cell);
+          boxes.emplace_back(BoundingBox<spacedim>(), cell);
+        compute_bounding_boxes(*mapping, boxes);
 
         locally_owned_cell_bounding_boxes_rtree = pack_rtree(boxes);
 
@@ -233,6 +275,45 @@ namespace GridTools
 
 
 
+#ifdef DEAL_II_WITH_ARBORX
+  template <int dim, int spacedim>
+  std::pair<const ArborXWrappers::BVH &,
+            const std::vector<
+              typename Triangulation<dim, spacedim>::active_cell_iterator> &>
+  Cache<dim, spacedim>::get_locally_owned_cell_bounding_boxes_bvh() const
+  {
+    std::lock_guard<std::mutex> lock(
+      locally_owned_cell_bounding_boxes_bvh_mutex);
+
+    if (update_flags & update_locally_owned_cell_bounding_boxes_bvh ||
+        locally_owned_cell_bounding_boxes_bvh == nullptr)
+      {
+        // reuse the bounding boxes already computed for the RTree
+        const auto &rtree = get_locally_owned_cell_bounding_boxes_rtree();
+
+        std::vector<BoundingBox<spacedim>> boxes;
+        boxes.reserve(rtree.size());
+        locally_owned_cells_in_bvh.clear();
+        locally_owned_cells_in_bvh.reserve(rtree.size());
+        for (const auto &box_and_cell : rtree)
+          {
+            boxes.push_back(box_and_cell.first);
+            locally_owned_cells_in_bvh.push_back(box_and_cell.second);
+          }
+
+        locally_owned_cell_bounding_boxes_bvh =
+          std::make_unique<ArborXWrappers::BVH>(boxes);
+
+        // Atomically clear the flag that indicates that this data member
+        // needs to be updated:
+        update_flags &= ~update_locally_owned_cell_bounding_boxes_bvh;
+      }
+    return {*locally_owned_cell_bounding_boxes_bvh, locally_owned_cells_in_bvh};
+  }
+#endif
+
+
+
   template <int dim, int spacedim>
   const RTree<std::pair<BoundingBox<spacedim>, unsigned int>> &
   Cache<dim, spacedim>::get_covering_rtree(const unsigned int level) const
@@ -329,6 +410,74 @@ namespace GridTools
     return vertices_with_ghost_neighbors;
   }
 
+
+
+  template <int dim, int spacedim>
+  const ActiveCellData<dim, spacedim> &
+  Cache<dim, spacedim>::get_active_cell_data() const
+  {
+    // In the following, we will first check whether the data structure
+    // in question needs to be updated (in which case we update it, and
+    // reset the flag that indices that this needs to happen to zero), and
+    // then return it. Make this thread-safe by using a mutex to guard
+    // all of this:
+    std::lock_guard<std::mutex> lock(active_cell_data_mutex);
+
+    if (update_flags & update_active_cell_data)
+      {
+        ActiveCellData<dim, spacedim> &data = active_cell_data;
+
+        const unsigned int n_cells = tria->n_active_cells();
+        data.triangulation         = &*tria;
+        data.levels.resize(n_cells);
+        data.indices.resize(n_cells);
+        data.material_ids.resize(n_cells);
+        data.manifold_ids.resize(n_cells);
+        data.subdomain_ids.resize(n_cells);
+        data.vertex_offsets.resize(n_cells + 1);
+        data.face_offsets.resize(n_cells + 1);
+        data.vertex_indices.clear();
+        data.neighbor_indices.clear();
+        data.vertex_indices.reserve(n_cells *
+                                    GeometryInfo<dim>::vertices_per_cell);
+        data.neighbor_indices.reserve(n_cells *
+                                      GeometryInfo<dim>::faces_per_cell);
+
+        // fill the arrays in the order of the active cell index, i.e., in
+        // the order the cells are traversed by the iterators
+        for (const auto &cell : tria->active_cell_iterators())
+          {
+            const unsigned int c = cell->active_cell_index();
+            AssertIndexRange(c, n_cells);
+            data.levels[c]        = cell->level();
+            data.indices[c]       = cell->index();
+            data.material_ids[c]  = cell->material_id();
+            data.manifold_ids[c]  = cell->manifold_id();
+            data.subdomain_ids[c] = cell->subdomain_id();
+
+            data.vertex_offsets[c] = data.vertex_indices.size();
+            for (const unsigned int v : cell->vertex_indices())
+              data.vertex_indices.push_back(cell->vertex_index(v));
+
+            data.face_offsets[c] = data.neighbor_indices.size();
+            for (const unsigned int f : cell->face_indices())
+              if (cell->at_boundary(f) || !cell->neighbor(f)->is_active())
+                data.neighbor_indices.push_back(numbers::invalid_unsigned_int);
+              else
+                data.neighbor_indices.push_back(
+                  cell->neighbor(f)->active_cell_index());
+          }
+        data.vertex_offsets[n_cells] = data.vertex_indices.size();
+        data.face_offsets[n_cells]   = data.neighbor_indices.size();
+
+        // Atomically clear the flag that indicates that this data member
+        // needs to be updated:
+        update_flags &= ~update_active_cell_data;
+      }
+
+    return active_cell_data;
+  }
+
 #include "grid_tools_cache.inst"
 
 } // namespace GridTools
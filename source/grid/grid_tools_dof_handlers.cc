@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 #include <deal.II/base/geometry_info.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
 
@@ -2129,7 +2130,6 @@ namespace GridTools
     const FullMatrix<double> &matrix)
   {
     static const int space_dim = CellIterator::AccessorType::space_dimension;
-    (void)space_dim;
     AssertIndexRange(direction, space_dim);
 
 #ifdef DEBUG
@@ -2153,40 +2153,134 @@ namespace GridTools
     }
 #endif
 
-    unsigned int n_matches = 0;
-
-    // Match with a complexity of O(n^2). This could be improved...
-    using PairIterator =
-      typename std::set<std::pair<CellIterator, unsigned int>>::const_iterator;
-    for (PairIterator it1 = pairs1.begin(); it1 != pairs1.end(); ++it1)
-      {
-        for (PairIterator it2 = pairs2.begin(); it2 != pairs2.end(); ++it2)
+    using FacePair = std::pair<CellIterator, unsigned int>;
+    const std::vector<FacePair> faces1(pairs1.begin(), pairs1.end());
+    const std::vector<FacePair> faces2(pairs2.begin(), pairs2.end());
+
+    // Rather than comparing all faces of pairs1 with all faces of pairs2, we
+    // sort the faces of pairs2 by the position of the average of their
+    // vertices, projected onto the plane orthogonal to the given direction
+    // and rounded to a grid that is coarser than the tolerance used in
+    // orthogonal_equality(). The candidates for the partner of a face of
+    // pairs1 are then the faces in the same or a neighboring grid cell as its
+    // transformed vertex average. Storing the rounded coordinates as double
+    // values avoids overflow for large coordinates, where neighboring grid
+    // cells simply merge.
+    using GridKey            = std::array<double, space_dim>;
+    const double grid_size   = 1e-9;
+    const auto   compute_key = [&](const Point<space_dim> &point) {
+      GridKey key;
+      for (unsigned int d = 0; d < space_dim; ++d)
+        key[d] = (d == direction) ? 0. : std::floor(point[d] / grid_size);
+      return key;
+    };
+    const auto vertex_average = [](const auto &face) {
+      Point<space_dim> average;
+      for (const unsigned int v : face->vertex_indices())
+        average += face->vertex(v);
+      return average / face->n_vertices();
+    };
+
+    std::vector<std::pair<GridKey, unsigned int>> keys2(faces2.size());
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(faces2.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int j = begin; j < end; ++j)
+          keys2[j] = {compute_key(vertex_average(
+                        faces2[j].first->face(faces2[j].second))),
+                      j};
+      },
+      256);
+    std::sort(keys2.begin(), keys2.end());
+
+    const auto compare_keys = [](const std::pair<GridKey, unsigned int> &a,
+                                 const std::pair<GridKey, unsigned int> &b) {
+      return a.first < b.first;
+    };
+
+    // find the partner of each face of pairs1 and its orientation, which can
+    // be done independently for each face
+    std::vector<std::pair<unsigned int, unsigned char>> partners(
+      faces1.size(), {numbers::invalid_unsigned_int, 0});
+    parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(faces1.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        for (unsigned int i = begin; i < end; ++i)
           {
-            const CellIterator cell1     = it1->first;
-            const CellIterator cell2     = it2->first;
-            const unsigned int face_idx1 = it1->second;
-            const unsigned int face_idx2 = it2->second;
-            if (const std::optional<unsigned char> orientation =
-                  GridTools::orthogonal_equality(cell1->face(face_idx1),
-                                                 cell2->face(face_idx2),
-                                                 direction,
-                                                 offset,
-                                                 matrix))
+            const auto face1 = faces1[i].first->face(faces1[i].second);
+
+            const Point<space_dim> average = vertex_average(face1);
+            Point<space_dim>       transformed_average;
+            if (matrix.m() == space_dim)
+              for (unsigned int d = 0; d < space_dim; ++d)
+                for (unsigned int e = 0; e < space_dim; ++e)
+                  transformed_average[d] += matrix(d, e) * average[e];
+            else
+              transformed_average = average;
+            const GridKey key = compute_key(transformed_average + offset);
+
+            // loop over the 3^(space_dim-1) grid cells around the key in the
+            // plane orthogonal to the given direction
+            const unsigned int n_neighbors = Utilities::pow(3, space_dim - 1);
+            for (unsigned int n = 0;
+                 n < n_neighbors &&
+                 partners[i].first == numbers::invalid_unsigned_int;
+                 ++n)
               {
-                // We have a match, so insert the matching pairs and
-                // remove the matched cell in pairs2 to speed up the
-                // matching:
-                const PeriodicFacePair<CellIterator> matched_face = {
-                  {cell1, cell2},
-                  {face_idx1, face_idx2},
-                  orientation.value(),
-                  matrix};
-                matched_pairs.push_back(matched_face);
-                pairs2.erase(it2);
-                ++n_matches;
-                break;
+                std::pair<GridKey, unsigned int> neighbor_key = {key, 0};
+                for (unsigned int d = 0, digits = n; d < space_dim; ++d)
+                  if (d != direction)
+                    {
+                      neighbor_key.first[d] += static_cast<double>(digits % 3);
+                      neighbor_key.first[d] -= 1.;
+                      digits /= 3;
+                    }
+
+                const auto range = std::equal_range(keys2.begin(),
+                                                    keys2.end(),
+                                                    neighbor_key,
+                                                    compare_keys);
+                for (auto it = range.first; it != range.second; ++it)
+                  {
+                    const FacePair &pair2 = faces2[it->second];
+                    if (const std::optional<unsigned char> orientation =
+                          GridTools::orthogonal_equality(
+                            face1,
+                            pair2.first->face(pair2.second),
+                            direction,
+                            offset,
+                            matrix))
+                      {
+                        partners[i] = {it->second, orientation.value()};
+                        break;
+                      }
+                  }
               }
           }
+      },
+      64);
+
+    // insert the matching pairs in the order of pairs1 and remove the matched
+    // faces from pairs2
+    unsigned int      n_matches = 0;
+    std::vector<bool> matched2(faces2.size(), false);
+    for (unsigned int i = 0; i < faces1.size(); ++i)
+      {
+        const unsigned int j = partners[i].first;
+        if (j == numbers::invalid_unsigned_int || matched2[j])
+          continue;
+        matched2[j] = true;
+
+        const PeriodicFacePair<CellIterator> matched_face = {
+          {faces1[i].first, faces2[j].first},
+          {faces1[i].second, faces2[j].second},
+          partners[i].second,
+          matrix};
+        matched_pairs.push_back(matched_face);
+        pairs2.erase(faces2[j]);
+        ++n_matches;
       }
 
     // Assure that all faces are matched if
@@ -1604,6 +1604,7 @@ TransfiniteInterpolationManifold<dim,
                                  spacedim>::TransfiniteInterpolationManifold()
   : triangulation(nullptr)
   , level_coarse(-1)
+  , cache_chart_points(false)
 {
   AssertThrow(dim > 1, ExcNotImplemented());
 }
@@ -1616,6 +1617,10 @@ TransfiniteInterpolationManifold<dim,
 {
   if (clear_signal.connected())
     clear_signal.disconnect();
+  if (pre_refinement_signal.connected())
+    pre_refinement_signal.disconnect();
+  if (post_refinement_signal.connected())
+    post_refinement_signal.disconnect();
 }
 
 
@@ -1644,6 +1649,24 @@ TransfiniteInterpolationManifold<dim, spacedim>::initialize(
     this->triangulation = nullptr;
     this->level_coarse  = -1;
   });
+
+  // Remember the chart points of new vertices only while the triangulation is
+  // refined, where they are reused as surrounding points of the new vertices
+  // on higher-dimensional objects:
+  pre_refinement_signal.disconnect();
+  pre_refinement_signal =
+    triangulation.signals.pre_refinement.connect([&]() -> void {
+      this->chart_point_cache.clear();
+      this->cache_chart_points = true;
+    });
+  post_refinement_signal.disconnect();
+  post_refinement_signal =
+    triangulation.signals.post_refinement.connect([&]() -> void {
+      this->chart_point_cache.clear();
+      this->cache_chart_points = false;
+    });
+  chart_point_cache.clear();
+  cache_chart_points = false;
   level_coarse = triangulation.last()->level();
   coarse_cell_is_flat.resize(triangulation.n_cells(level_coarse), false);
   quadratic_approximation.clear();
@@ -2413,6 +2436,24 @@ TransfiniteInterpolationManifold<dim, spacedim>::compute_chart_points(
   auto compute_chart_point =
     [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
         const unsigned int point_index) {
+      // points created during the current refinement have their chart point
+      // stored, so there is no need to invert the transfinite interpolation
+      if (cache_chart_points)
+        {
+          std::pair<unsigned int, std::array<double, spacedim>> key;
+          key.first = cell->index();
+          for (unsigned int d = 0; d < spacedim; ++d)
+            key.second[d] = surrounding_points[point_index][d];
+
+          std::lock_guard<std::mutex> lock(chart_point_cache_mutex);
+          const auto it = chart_point_cache.find(key);
+          if (it != chart_point_cache.end())
+            {
+              chart_points[point_index] = it->second;
+              return;
+            }
+        }
+
       Point<dim> guess;
       // an optimization: keep track of whether or not we used the quadratic
       // approximation so that we don't call pull_back with the same
@@ -2558,7 +2599,20 @@ TransfiniteInterpolationManifold<dim, spacedim>::get_new_point(
   const Point<dim> p_chart =
     chart_manifold.get_new_point(chart_points_view, weights);
 
-  return push_forward(cell, p_chart);
+  const Point<spacedim> new_point = push_forward(cell, p_chart);
+
+  if (cache_chart_points)
+    {
+      std::pair<unsigned int, std::array<double, spacedim>> key;
+      key.first = cell->index();
+      for (unsigned int d = 0; d < spacedim; ++d)
+        key.second[d] = new_point[d];
+
+      std::lock_guard<std::mutex> lock(chart_point_cache_mutex);
+      chart_point_cache.emplace(key, p_chart);
+    }
+
+  return new_point;
 }
 
 
@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.templates.h>
 #include <deal.II/base/mpi_large_count.h>
 #include <deal.II/base/mpi_stub.h>
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/thread_management.h>
 #include <deal.II/base/utilities.h>
 
@@ -744,13 +745,13 @@ namespace internal
             size_header +
             static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
 
-          ierr =
-            Utilities::MPI::LargeCount::File_write_at_c(fh,
-                                                        my_global_file_position,
-                                                        src_data_fixed.data(),
-                                                        src_data_fixed.size(),
-                                                        MPI_BYTE,
-                                                        MPI_STATUS_IGNORE);
+          ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
+            fh,
+            my_global_file_position,
+            src_data_fixed.data(),
+            src_data_fixed.size(),
+            MPI_BYTE,
+            MPI_STATUS_IGNORE);
           AssertThrowMPI(ierr);
 
           ierr = MPI_File_close(&fh);
@@ -801,7 +802,7 @@ namespace internal
                               std::numeric_limits<int>::max()),
                           ExcNotImplemented());
 
-              ierr = Utilities::MPI::LargeCount::File_write_at_c(
+              ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
                 fh,
                 my_global_file_position,
                 src_sizes_variable.data(),
@@ -829,7 +830,7 @@ namespace internal
               prefix_sum;
 
             // Write data consecutively into file.
-            ierr = Utilities::MPI::LargeCount::File_write_at_c(
+            ierr = Utilities::MPI::LargeCount::File_write_at_all_c(
               fh,
               my_global_file_position,
               src_data_variable.data(),
@@ -969,13 +970,13 @@ namespace internal
             size_header +
             static_cast<MPI_Offset>(global_first_cell) * bytes_per_cell;
 
-          ierr =
-            Utilities::MPI::LargeCount::File_read_at_c(fh,
-                                                       my_global_file_position,
-                                                       dest_data_fixed.data(),
-                                                       dest_data_fixed.size(),
-                                                       MPI_BYTE,
-                                                       MPI_STATUS_IGNORE);
+          ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
+            fh,
+            my_global_file_position,
+            dest_data_fixed.data(),
+            dest_data_fixed.size(),
+            MPI_BYTE,
+            MPI_STATUS_IGNORE);
           AssertThrowMPI(ierr);
 
 
@@ -1012,7 +1013,7 @@ namespace internal
             const MPI_Offset my_global_file_position_sizes =
               static_cast<MPI_Offset>(global_first_cell) * sizeof(unsigned int);
 
-            ierr = Utilities::MPI::LargeCount::File_read_at_c(
+            ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
               fh,
               my_global_file_position_sizes,
               dest_sizes_variable.data(),
@@ -1044,7 +1045,7 @@ namespace internal
 
             dest_data_variable.resize(size_on_proc);
 
-            ierr = Utilities::MPI::LargeCount::File_read_at_c(
+            ierr = Utilities::MPI::LargeCount::File_read_at_all_c(
               fh,
               my_global_file_position,
               dest_data_variable.data(),
@@ -4912,6 +4913,41 @@ namespace internal
 
 
 
+      /**
+       * Compute the locations of the new vertices created during refinement
+       * at the centers of the given objects (lines, quads or hexes). The
+       * first entry of each pair is the index of the vertex to be set.
+       *
+       * The refinement functions below first create the topology of all
+       * objects of one dimension and only record which new vertex sits at
+       * the center of which object. The locations are then computed here in
+       * parallel, since evaluating the manifold is often the most expensive
+       * part of refinement and the locations on objects of the same
+       * dimension are independent of each other. Note that the locations on
+       * quads and hexes are interpolated from the vertices on their lines
+       * and faces, so the objects must be processed in the order of
+       * increasing dimension.
+       */
+      template <int spacedim, typename IteratorType>
+      static void
+      compute_new_vertex_locations(
+        std::vector<Point<spacedim>>                             &vertices,
+        const std::vector<std::pair<unsigned int, IteratorType>> &new_vertices,
+        const bool use_interpolation)
+      {
+        dealii::parallel::apply_to_subranges(
+          0U,
+          static_cast<unsigned int>(new_vertices.size()),
+          [&](const unsigned int begin, const unsigned int end) {
+            for (unsigned int i = begin; i < end; ++i)
+              vertices[new_vertices[i].first] =
+                new_vertices[i].second->center(true, use_interpolation);
+          },
+          64);
+      }
+
+
+
       template <int dim, int spacedim>
       static typename Triangulation<dim, spacedim>::DistortedCellList
       execute_refinement_isotropic(Triangulation<dim, spacedim> &triangulation,
@@ -5028,6 +5064,11 @@ namespace internal
           typename Triangulation<dim, spacedim>::raw_line_iterator
             next_unused_line = triangulation.begin_raw_line();
 
+          std::vector<
+            std::pair<unsigned int,
+                      typename Triangulation<dim, spacedim>::line_iterator>>
+            new_line_vertices;
+
           for (; line != endl; ++line)
             if (line->user_flag_set())
               {
@@ -5043,7 +5084,7 @@ namespace internal
                          "enough."));
                 triangulation.vertices_used[next_unused_vertex] = true;
 
-                triangulation.vertices[next_unused_vertex] = line->center(true);
+                new_line_vertices.emplace_back(next_unused_vertex, line);
 
                 bool pair_found = false;
                 (void)pair_found;
@@ -5084,6 +5125,10 @@ namespace internal
 
                 line->clear_user_flag();
               }
+
+          compute_new_vertex_locations(triangulation.vertices,
+                                       new_line_vertices,
+                                       false);
         }
 
         reserve_space(triangulation.faces->lines, 0, n_single_lines);
@@ -5094,11 +5139,17 @@ namespace internal
         typename Triangulation<dim, spacedim>::raw_line_iterator
           next_unused_line = triangulation.begin_raw_line();
 
-        const auto create_children = [](auto         &triangulation,
-                                        unsigned int &next_unused_vertex,
-                                        auto         &next_unused_line,
-                                        auto         &next_unused_cell,
-                                        const auto   &cell) {
+        std::vector<
+          std::pair<unsigned int,
+                    typename Triangulation<dim, spacedim>::cell_iterator>>
+          new_cell_vertices;
+
+        const auto create_children = [&new_cell_vertices](
+                                       auto         &triangulation,
+                                       unsigned int &next_unused_vertex,
+                                       auto         &next_unused_line,
+                                       auto         &next_unused_cell,
+                                       const auto   &cell) {
           const auto ref_case = cell->refine_flag_set();
           cell->clear_refine_flag();
 
@@ -5135,8 +5186,7 @@ namespace internal
 
               new_vertices[8] = next_unused_vertex;
 
-              triangulation.vertices[next_unused_vertex] =
-                cell->center(true, true);
+              new_cell_vertices.emplace_back(next_unused_vertex, cell);
             }
 
           std::array<typename Triangulation<dim, spacedim>::raw_line_iterator,
@@ -5335,6 +5385,9 @@ namespace internal
               cell->child(c)->set_direction_flag(cell->direction_flag());
         };
 
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+          refined_cells;
+
         for (int level = 0;
              level < static_cast<int>(triangulation.levels.size()) - 1;
              ++level)
@@ -5351,15 +5404,24 @@ namespace internal
                                   next_unused_line,
                                   next_unused_cell,
                                   cell);
+                  refined_cells.push_back(cell);
+                }
+          }
 
-                  if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
-                      check_for_distorted_cells &&
-                      has_distorted_children<dim, spacedim>(cell))
-                    cells_with_distorted_children.distorted_cells.push_back(
-                      cell);
+        compute_new_vertex_locations(triangulation.vertices,
+                                     new_cell_vertices,
+                                     true);
 
-                  triangulation.signals.post_refinement_on_cell(cell);
-                }
+        // now that all vertices are in place, check the new cells and notify
+        // the listeners in the order the cells have been refined
+        for (const auto &cell : refined_cells)
+          {
+            if (cell->reference_cell() == ReferenceCells::Quadrilateral &&
+                check_for_distorted_cells &&
+                has_distorted_children<dim, spacedim>(cell))
+              cells_with_distorted_children.distorted_cells.push_back(cell);
+
+            triangulation.signals.post_refinement_on_cell(cell);
           }
 
         return cells_with_distorted_children;
@@ -6150,6 +6212,11 @@ namespace internal
             endl = triangulation.end_line();
           raw_line_iterator next_unused_line = triangulation.begin_raw_line();
 
+          std::vector<
+            std::pair<unsigned int,
+                      typename Triangulation<dim, spacedim>::line_iterator>>
+            new_line_vertices;
+
           for (; line != endl; ++line)
             {
               if (line->user_flag_set() == false)
@@ -6175,7 +6242,7 @@ namespace internal
               current_vertex =
                 get_next_unused_vertex(current_vertex,
                                        triangulation.vertices_used);
-              triangulation.vertices[current_vertex] = line->center(true);
+              new_line_vertices.emplace_back(current_vertex, line);
 
               children[0]->set_bounding_object_indices(
                 {line->vertex_index(0), current_vertex});
@@ -6196,6 +6263,10 @@ namespace internal
 
               line->clear_user_flag();
             }
+
+          compute_new_vertex_locations(triangulation.vertices,
+                                       new_line_vertices,
+                                       false);
         }
 
         // QUADS
@@ -6204,6 +6275,11 @@ namespace internal
             quad = triangulation.begin_quad(),
             endq = triangulation.end_quad();
 
+          std::vector<
+            std::pair<unsigned int,
+                      typename Triangulation<dim, spacedim>::quad_iterator>>
+            new_quad_vertices;
+
           for (; quad != endq; ++quad)
             {
               if (quad->user_flag_set() == false)
@@ -6284,8 +6360,7 @@ namespace internal
                                            triangulation.vertices_used);
                   vertex_indices[k++] = current_vertex;
 
-                  triangulation.vertices[current_vertex] =
-                    quad->center(true, true);
+                  new_quad_vertices.emplace_back(current_vertex, quad);
                 }
 
               // 4) set new lines on quads and their properties
@@ -6473,11 +6548,22 @@ namespace internal
 
               quad->clear_user_flag();
             }
+
+          compute_new_vertex_locations(triangulation.vertices,
+                                       new_quad_vertices,
+                                       true);
         }
 
         typename Triangulation<3, spacedim>::DistortedCellList
           cells_with_distorted_children;
 
+        std::vector<
+          std::pair<unsigned int,
+                    typename Triangulation<dim, spacedim>::cell_iterator>>
+          new_hex_vertices;
+        std::vector<typename Triangulation<dim, spacedim>::cell_iterator>
+          refined_hexes;
+
         typename Triangulation<dim, spacedim>::active_hex_iterator hex =
           triangulation.begin_active_hex(0);
         for (unsigned int level = 0; level != triangulation.levels.size() - 1;
@@ -6662,8 +6748,7 @@ namespace internal
                                                  triangulation.vertices_used);
                         vertex_indices[k++] = current_vertex;
 
-                        triangulation.vertices[current_vertex] =
-                          hex->center(true, true);
+                        new_hex_vertices.emplace_back(current_vertex, hex);
                       }
                   }
 
@@ -7092,14 +7177,25 @@ namespace internal
                   }
                 }
 
-                if (check_for_distorted_cells &&
-                    has_distorted_children<dim, spacedim>(hex))
-                  cells_with_distorted_children.distorted_cells.push_back(hex);
-
-                triangulation.signals.post_refinement_on_cell(hex);
+                refined_hexes.push_back(hex);
               }
           }
 
+        compute_new_vertex_locations(triangulation.vertices,
+                                     new_hex_vertices,
+                                     true);
+
+        // now that all vertices are in place, check the new cells and notify
+        // the listeners in the order the cells have been refined
+        for (const auto &hex : refined_hexes)
+          {
+            if (check_for_distorted_cells &&
+                has_distorted_children<dim, spacedim>(hex))
+              cells_with_distorted_children.distorted_cells.push_back(hex);
+
+            triangulation.signals.post_refinement_on_cell(hex);
+          }
+
         triangulation.faces->quads.clear_user_data();
 
         return cells_with_distorted_children;
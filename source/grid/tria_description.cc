@@ -27,6 +27,11 @@
 #include <deal.II/grid/tria.h>
 #include <deal.II/grid/tria_description.h>
 
+#include <algorithm>
+#include <array>
+#include <map>
+#include <set>
+
 DEAL_II_NAMESPACE_OPEN
 
 
@@ -1165,6 +1170,275 @@ namespace TriangulationDescription
                                         settings);
     }
 
+
+
+    namespace
+    {
+      /**
+       * The data of a coarse cell exchanged between the processes in
+       * create_description_from_distributed_cells().
+       */
+      template <int dim>
+      struct CoarseCellRecord
+      {
+        /**
+         * Serialization function for packing and unpacking the content of this
+         * class.
+         */
+        template <class Archive>
+        void
+        serialize(Archive &ar, const unsigned int /*version*/)
+        {
+          ar &id;
+          ar &owner;
+          ar &cell;
+          ar &boundary_ids;
+        }
+
+        types::coarse_cell_id id;
+
+        types::subdomain_id owner;
+
+        dealii::CellData<dim> cell;
+
+        std::vector<std::pair<unsigned int, types::boundary_id>> boundary_ids;
+      };
+    } // namespace
+
+
+
+    template <int dim, int spacedim>
+    Description<dim, spacedim>
+    create_description_from_distributed_cells(
+      const std::vector<Point<spacedim>>       &local_vertices,
+      const std::vector<dealii::CellData<dim>> &local_cells,
+      const MPI_Comm                            comm,
+      const std::vector<std::vector<std::pair<unsigned int, types::boundary_id>>>
+                                      &local_boundary_ids,
+      const std::vector<unsigned int> &local_cell_owners,
+      const typename Triangulation<dim, spacedim>::MeshSmoothing smoothing,
+      const TriangulationDescription::Settings                   settings)
+    {
+      Assert(local_boundary_ids.empty() ||
+               local_boundary_ids.size() == local_cells.size(),
+             ExcDimensionMismatch(local_boundary_ids.size(),
+                                  local_cells.size()));
+      Assert(local_cell_owners.empty() ||
+               local_cell_owners.size() == local_cells.size(),
+             ExcDimensionMismatch(local_cell_owners.size(),
+                                  local_cells.size()));
+
+      const unsigned int my_rank =
+        dealii::Utilities::MPI::this_mpi_process(comm);
+
+      // 1) the vertices and cells are numbered globally in the order of the
+      //    ranks, so the owner of a vertex follows from the offsets
+      const auto [vertex_offset, n_global_vertices] =
+        dealii::Utilities::MPI::partial_and_total_sum(
+          static_cast<types::global_vertex_index>(local_vertices.size()),
+          comm);
+      AssertThrow(n_global_vertices < numbers::invalid_unsigned_int,
+                  ExcMessage("The number of vertices exceeds the range of "
+                             "the vertex indices in CellData."));
+      const types::coarse_cell_id cell_offset =
+        std::get<0>(dealii::Utilities::MPI::partial_and_total_sum(
+          static_cast<types::coarse_cell_id>(local_cells.size()), comm));
+
+      const std::vector<types::global_vertex_index> vertex_offsets =
+        dealii::Utilities::MPI::all_gather(comm, vertex_offset);
+      const auto vertex_owner = [&vertex_offsets](const unsigned int v) {
+        return static_cast<unsigned int>(
+          std::upper_bound(vertex_offsets.begin(),
+                           vertex_offsets.end(),
+                           static_cast<types::global_vertex_index>(v)) -
+          vertex_offsets.begin() - 1);
+      };
+
+      // 2) send the cells to their owners
+      std::vector<CoarseCellRecord<dim>> owned_cells;
+      {
+        std::map<unsigned int, std::vector<CoarseCellRecord<dim>>>
+          cells_to_send;
+        for (unsigned int i = 0; i < local_cells.size(); ++i)
+          {
+            CoarseCellRecord<dim> record;
+            record.id = cell_offset + i;
+            record.owner =
+              local_cell_owners.empty() ? my_rank : local_cell_owners[i];
+            record.cell = local_cells[i];
+            if (local_boundary_ids.empty() == false)
+              record.boundary_ids = local_boundary_ids[i];
+            AssertIndexRange(record.owner,
+                             dealii::Utilities::MPI::n_mpi_processes(comm));
+            cells_to_send[record.owner].push_back(record);
+          }
+
+        for (const auto &[rank, cells] :
+             dealii::Utilities::MPI::some_to_some(comm, cells_to_send))
+          owned_cells.insert(owned_cells.end(), cells.begin(), cells.end());
+
+        std::sort(owned_cells.begin(),
+                  owned_cells.end(),
+                  [](const auto &a, const auto &b) { return a.id < b.id; });
+      }
+
+      // 3) tell the owner of each vertex which cells use it, given as
+      //    triplets of vertex index, cell id, and owner of the cell
+      std::map<types::global_vertex_index,
+               std::vector<std::pair<types::coarse_cell_id, unsigned int>>>
+        cells_at_vertex;
+      {
+        std::map<unsigned int,
+                 std::vector<std::array<types::global_vertex_index, 3>>>
+          vertex_users;
+        for (const auto &record : owned_cells)
+          for (const unsigned int v : record.cell.vertices)
+            vertex_users[vertex_owner(v)].push_back({{v, record.id, my_rank}});
+
+        for (const auto &[rank, users] :
+             dealii::Utilities::MPI::some_to_some(comm, vertex_users))
+          for (const auto &user : users)
+            cells_at_vertex[user[0]].emplace_back(user[1], user[2]);
+      }
+
+      // 4) the owner of a vertex sends the cells around it to all processes
+      //    owning one of these cells, which gives them their ghost cells
+      std::map<types::coarse_cell_id, unsigned int> ghost_cells;
+      {
+        std::map<unsigned int,
+                 std::vector<std::pair<types::coarse_cell_id, unsigned int>>>
+          cells_around_vertices;
+        for (const auto &[v, cells] : cells_at_vertex)
+          {
+            std::set<unsigned int> ranks;
+            for (const auto &cell : cells)
+              ranks.insert(cell.second);
+
+            if (ranks.size() > 1)
+              for (const unsigned int rank : ranks)
+                for (const auto &cell : cells)
+                  if (cell.second != rank)
+                    cells_around_vertices[rank].push_back(cell);
+          }
+        cells_at_vertex.clear();
+
+        for (const auto &[rank, cells] :
+             dealii::Utilities::MPI::some_to_some(comm, cells_around_vertices))
+          for (const auto &cell : cells)
+            ghost_cells.insert(cell);
+      }
+
+      // 5) request the ghost cells from their owners
+      std::vector<CoarseCellRecord<dim>> relevant_cells = owned_cells;
+      {
+        std::map<unsigned int, std::vector<types::coarse_cell_id>>
+          ghost_requests;
+        for (const auto &[id, owner] : ghost_cells)
+          ghost_requests[owner].push_back(id);
+
+        std::map<unsigned int, std::vector<CoarseCellRecord<dim>>>
+          ghost_answers;
+        for (const auto &[rank, ids] :
+             dealii::Utilities::MPI::some_to_some(comm, ghost_requests))
+          for (const types::coarse_cell_id id : ids)
+            {
+              const auto it =
+                std::lower_bound(owned_cells.begin(),
+                                 owned_cells.end(),
+                                 id,
+                                 [](const auto &record, const auto &id) {
+                                   return record.id < id;
+                                 });
+              Assert(it != owned_cells.end() && it->id == id,
+                     ExcInternalError());
+              ghost_answers[rank].push_back(*it);
+            }
+
+        for (const auto &[rank, cells] :
+             dealii::Utilities::MPI::some_to_some(comm, ghost_answers))
+          relevant_cells.insert(relevant_cells.end(),
+                                cells.begin(),
+                                cells.end());
+
+        std::sort(relevant_cells.begin(),
+                  relevant_cells.end(),
+                  [](const auto &a, const auto &b) { return a.id < b.id; });
+      }
+
+      // 6) fetch the coordinates of the vertices of all relevant cells
+      std::vector<unsigned int> relevant_vertices;
+      for (const auto &record : relevant_cells)
+        relevant_vertices.insert(relevant_vertices.end(),
+                                 record.cell.vertices.begin(),
+                                 record.cell.vertices.end());
+      std::sort(relevant_vertices.begin(), relevant_vertices.end());
+      relevant_vertices.erase(std::unique(relevant_vertices.begin(),
+                                          relevant_vertices.end()),
+                              relevant_vertices.end());
+
+      const auto local_vertex_index = [&relevant_vertices](
+                                        const unsigned int v) {
+        return static_cast<unsigned int>(
+          std::lower_bound(relevant_vertices.begin(),
+                           relevant_vertices.end(),
+                           v) -
+          relevant_vertices.begin());
+      };
+
+      Description<dim, spacedim> description;
+      description.comm      = comm;
+      description.smoothing = smoothing;
+      description.settings  = settings;
+      description.coarse_cell_vertices.resize(relevant_vertices.size());
+      {
+        std::map<unsigned int, std::vector<unsigned int>> vertex_requests;
+        for (const unsigned int v : relevant_vertices)
+          vertex_requests[vertex_owner(v)].push_back(v);
+
+        std::map<unsigned int, std::vector<Point<spacedim>>> vertex_answers;
+        for (const auto &[rank, vertices] :
+             dealii::Utilities::MPI::some_to_some(comm, vertex_requests))
+          for (const unsigned int v : vertices)
+            {
+              AssertIndexRange(v - vertex_offset, local_vertices.size());
+              vertex_answers[rank].push_back(local_vertices[v - vertex_offset]);
+            }
+
+        for (const auto &[rank, points] :
+             dealii::Utilities::MPI::some_to_some(comm, vertex_answers))
+          {
+            const std::vector<unsigned int> &vertices =
+              vertex_requests.at(rank);
+            AssertDimension(points.size(), vertices.size());
+            for (unsigned int i = 0; i < vertices.size(); ++i)
+              description.coarse_cell_vertices[local_vertex_index(
+                vertices[i])] = points[i];
+          }
+      }
+
+      // 7) set up the coarse cells with local vertex indices, all of them
+      //    being active, so only a single level is present
+      description.cell_infos.resize(1);
+      for (const auto &record : relevant_cells)
+        {
+          dealii::CellData<dim> cell = record.cell;
+          for (unsigned int &v : cell.vertices)
+            v = local_vertex_index(v);
+          description.coarse_cells.push_back(cell);
+          description.coarse_cell_index_to_coarse_cell_id.push_back(record.id);
+
+          CellData<dim> cell_info;
+          cell_info.id = CellId(record.id, std::vector<std::uint8_t>())
+                           .template to_binary<dim>();
+          cell_info.subdomain_id       = record.owner;
+          cell_info.level_subdomain_id = record.owner;
+          cell_info.manifold_id        = record.cell.manifold_id;
+          cell_info.boundary_ids       = record.boundary_ids;
+          description.cell_infos[0].push_back(cell_info);
+        }
+
+      return description;
+    }
   } // namespace Utilities
 } // namespace TriangulationDescription
 
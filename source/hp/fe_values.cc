@@ -144,6 +144,8 @@ namespace hp
                       other.fe_values_table.size(2))
     , present_fe_values_index(other.present_fe_values_index)
     , update_flags(other.update_flags)
+    , check_for_cell_similarity_allowed(
+        other.check_for_cell_similarity_allowed)
   {
     // We've already resized the `fe_values_table` correctly above, but right
     // now it just contains nullptrs. Create copies of the objects that
@@ -159,10 +161,7 @@ namespace hp
               nullptr)
             task_group += Threads::new_task([&, fe_index, m_index, q_index]() {
               fe_values_table[fe_index][m_index][q_index] =
-                std::make_unique<FEValuesType>((*mapping_collection)[m_index],
-                                               (*fe_collection)[fe_index],
-                                               q_collections[q_index],
-                                               update_flags);
+                create_fe_values(fe_index, m_index, q_index);
             });
 
     task_group.join_all();
@@ -170,6 +169,46 @@ namespace hp
 
 
 
+  template <int dim, int q_dim, typename FEValuesType>
+  void
+  FEValuesBase<dim, q_dim, FEValuesType>::
+    always_allow_check_for_cell_similarity(const bool allow)
+  {
+    check_for_cell_similarity_allowed = allow;
+
+    for (unsigned int fe_index = 0; fe_index < fe_values_table.size(0);
+         ++fe_index)
+      for (unsigned int m_index = 0; m_index < fe_values_table.size(1);
+           ++m_index)
+        for (unsigned int q_index = 0; q_index < fe_values_table.size(2);
+             ++q_index)
+          if (fe_values_table[fe_index][m_index][q_index].get() != nullptr)
+            fe_values_table[fe_index][m_index][q_index]
+              ->always_allow_check_for_cell_similarity(allow);
+  }
+
+
+
+  template <int dim, int q_dim, typename FEValuesType>
+  std::unique_ptr<FEValuesType>
+  FEValuesBase<dim, q_dim, FEValuesType>::create_fe_values(
+    const unsigned int fe_index,
+    const unsigned int mapping_index,
+    const unsigned int q_index) const
+  {
+    auto fe_values =
+      std::make_unique<FEValuesType>((*mapping_collection)[mapping_index],
+                                     (*fe_collection)[fe_index],
+                                     q_collections[q_index],
+                                     update_flags);
+    if (check_for_cell_similarity_allowed.has_value())
+      fe_values->always_allow_check_for_cell_similarity(
+        *check_for_cell_similarity_allowed);
+    return fe_values;
+  }
+
+
+
   template <int dim, int q_dim, typename FEValuesType>
   FEValuesType &
   FEValuesBase<dim, q_dim, FEValuesType>::select_fe_values(
@@ -189,10 +228,7 @@ namespace hp
     // combination of indices
     if (fe_values_table(present_fe_values_index).get() == nullptr)
       fe_values_table(present_fe_values_index) =
-        std::make_unique<FEValuesType>((*mapping_collection)[mapping_index],
-                                       (*fe_collection)[fe_index],
-                                       q_collections[q_index],
-                                       update_flags);
+        create_fe_values(fe_index, mapping_index, q_index);
 
     // now there definitely is one!
     return *fe_values_table(present_fe_values_index);
@@ -224,11 +260,7 @@ namespace hp
         task_group +=
           Threads::new_task([&, fe_index, mapping_index, q_index]() {
             fe_values_table[fe_index][mapping_index][q_index] =
-              std::make_unique<FEValuesType>(
-                (*mapping_collection)[mapping_index],
-                (*fe_collection)[fe_index],
-                q_collections[q_index],
-                update_flags);
+              create_fe_values(fe_index, mapping_index, q_index);
           });
       }
 
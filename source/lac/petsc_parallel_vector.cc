@@ -14,6 +14,7 @@
 
 #include <deal.II/base/mpi.h>
 
+#include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/petsc_vector.h>
 
 #ifdef DEAL_II_WITH_PETSC
@@ -242,6 +243,30 @@ namespace PETScWrappers
       create_vector(comm, local.size(), local.n_elements());
     }
 
+    void
+    Vector::reinit_as_view(
+      LinearAlgebra::distributed::Vector<PetscScalar,
+                                         ::dealii::MemorySpace::Host> &v)
+    {
+      Vec            view;
+      PetscErrorCode ierr =
+        VecCreateMPIWithArray(v.get_mpi_communicator(),
+                              1,
+                              static_cast<PetscInt>(v.locally_owned_size()),
+                              static_cast<PetscInt>(v.size()),
+                              v.begin(),
+                              &view);
+      AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+      ierr = VecDestroy(&vector);
+      AssertThrow(ierr == 0, ExcPETScError(ierr));
+
+      vector  = view;
+      ghosted = false;
+      ghost_indices.clear();
+      last_action = VectorOperation::unknown;
+    }
+
     void
     Vector::reinit(
       const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
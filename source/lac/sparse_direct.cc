@@ -253,6 +253,17 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
 {
   Assert(matrix.m() == matrix.n(), ExcNotQuadratic());
 
+  // keep the symbolic factorization and the pattern of a previous call
+  // around: if the sparsity pattern has not changed, only the numeric
+  // factorization needs to be recomputed
+  void *previous_symbolic_decomposition = symbolic_decomposition;
+  symbolic_decomposition                = nullptr;
+  const bool previous_is_complex        = (Az.empty() == false);
+  std::vector<types::suitesparse_index> previous_Ap;
+  std::vector<types::suitesparse_index> previous_Ai;
+  previous_Ap.swap(Ap);
+  previous_Ai.swap(Ai);
+
   clear();
 
   using number = typename Matrix::value_type;
@@ -325,28 +336,38 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
   // different function
   sort_arrays(matrix);
 
+  if (previous_symbolic_decomposition != nullptr &&
+      previous_is_complex == numbers::NumberTraits<number>::is_complex &&
+      previous_Ap == Ap && previous_Ai == Ai)
+    symbolic_decomposition = previous_symbolic_decomposition;
+  else if (previous_symbolic_decomposition != nullptr)
+    umfpack_dl_free_symbolic(&previous_symbolic_decomposition);
+
   int status;
-  if (numbers::NumberTraits<number>::is_complex == false)
-    status = umfpack_dl_symbolic(N,
-                                 N,
-                                 Ap.data(),
-                                 Ai.data(),
-                                 Ax.data(),
-                                 &symbolic_decomposition,
-                                 control.data(),
-                                 nullptr);
-  else
-    status = umfpack_zl_symbolic(N,
-                                 N,
-                                 Ap.data(),
-                                 Ai.data(),
-                                 Ax.data(),
-                                 Az.data(),
-                                 &symbolic_decomposition,
-                                 control.data(),
-                                 nullptr);
-  AssertThrow(status == UMFPACK_OK,
-              ExcUMFPACKError("umfpack_dl_symbolic", status));
+  if (symbolic_decomposition == nullptr)
+    {
+      if (numbers::NumberTraits<number>::is_complex == false)
+        status = umfpack_dl_symbolic(N,
+                                     N,
+                                     Ap.data(),
+                                     Ai.data(),
+                                     Ax.data(),
+                                     &symbolic_decomposition,
+                                     control.data(),
+                                     nullptr);
+      else
+        status = umfpack_zl_symbolic(N,
+                                     N,
+                                     Ap.data(),
+                                     Ai.data(),
+                                     Ax.data(),
+                                     Az.data(),
+                                     &symbolic_decomposition,
+                                     control.data(),
+                                     nullptr);
+      AssertThrow(status == UMFPACK_OK,
+                  ExcUMFPACKError("umfpack_dl_symbolic", status));
+    }
 
   if (numbers::NumberTraits<number>::is_complex == false)
     status = umfpack_dl_numeric(Ap.data(),
@@ -367,8 +388,6 @@ SparseDirectUMFPACK::factorize(const Matrix &matrix)
                                 nullptr);
   AssertThrow(status == UMFPACK_OK,
               ExcUMFPACKError("umfpack_dl_numeric", status));
-
-  umfpack_dl_free_symbolic(&symbolic_decomposition);
 }
 
 
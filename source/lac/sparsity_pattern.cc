@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/parallel.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
@@ -271,11 +272,12 @@ SparsityPattern::reinit(const size_type                      m,
       rowstart = std::make_unique<std::size_t[]>(max_dim + 1);
     }
 
-  // allocate memory for the column numbers if necessary
+  // allocate memory for the column numbers if necessary. do not initialize
+  // the memory here, see below
   if (vec_len > max_vec_len)
     {
       max_vec_len = vec_len;
-      colnums     = std::make_unique<size_type[]>(max_vec_len);
+      colnums.reset(new size_type[max_vec_len]);
     }
 
   // set the rowstart array
@@ -291,14 +293,30 @@ SparsityPattern::reinit(const size_type                      m,
            ((vec_len == 1) && (rowstart[rows] == 0)),
          ExcInternalError());
 
-  // preset the column numbers by a value indicating it is not in use
-  std::fill_n(colnums.get(), vec_len, invalid_entry);
-
-  // if diagonal elements are special: let the first entry in each row be the
-  // diagonal value
-  if (store_diagonal_first_in_row)
-    for (size_type i = 0; i < n_rows(); ++i)
-      colnums[rowstart[i]] = i;
+  // preset the column numbers by a value indicating it is not in use, and if
+  // diagonal elements are special, let the first entry in each row be the
+  // diagonal value. on NUMA systems, memory pages are placed close to the
+  // thread that first accesses them, so do this in parallel with the same
+  // assignment of rows to threads as used by the matrix-vector products of
+  // SparseMatrix
+  thread_loop_partitioner =
+    std::make_shared<parallel::internal::TBBPartitioner>();
+  parallel::internal::apply_to_subranges_with_affinity(
+    0,
+    rows,
+    [this](const size_type begin_row, const size_type end_row) {
+      std::fill(colnums.get() + rowstart[begin_row],
+                colnums.get() + rowstart[end_row],
+                invalid_entry);
+      if (store_diagonal_first_in_row)
+        for (size_type i = begin_row; i < end_row; ++i)
+          colnums[rowstart[i]] = i;
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size,
+    thread_loop_partitioner);
+  std::fill(colnums.get() + rowstart[rows],
+            colnums.get() + vec_len,
+            invalid_entry);
 
   compressed = false;
 }
@@ -341,83 +359,84 @@ SparsityPattern::compress()
   if (compressed)
     return;
 
-  size_type next_free_entry = 0, next_row_start = 0, row_length = 0;
-
-  // first find out how many non-zero elements there are, in order to allocate
-  // the right amount of memory
-  const std::size_t nonzero_elements =
-    std::count_if(&colnums[rowstart[0]],
-                  &colnums[rowstart[rows]],
-                  [](const size_type col) { return col != invalid_entry; });
-  // now allocate the respective memory
+  // first find out how many non-zero elements there are in each row, in
+  // order to allocate the right amount of memory. the used entries of a row
+  // are all at its beginning
+  std::vector<std::size_t> new_rowstart(rows + 1);
+  parallel::internal::apply_to_subranges_with_affinity(
+    0,
+    rows,
+    [this, &new_rowstart](const size_type begin_row, const size_type end_row) {
+      for (size_type line = begin_row; line < end_row; ++line)
+        new_rowstart[line + 1] =
+          std::find(&colnums[rowstart[line]],
+                    &colnums[rowstart[line + 1]],
+                    invalid_entry) -
+          &colnums[rowstart[line]];
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size,
+    thread_loop_partitioner);
+  for (size_type line = 0; line < rows; ++line)
+    new_rowstart[line + 1] += new_rowstart[line];
+  const std::size_t nonzero_elements = new_rowstart[rows];
+
+  // now allocate the respective memory. do not initialize it here, but fill
+  // it with the same assignment of rows to threads as used in reinit(), so
+  // that the memory pages of the compressed pattern are again placed close
+  // to the threads working on the respective rows on NUMA systems
   std::unique_ptr<size_type[]> new_colnums(new size_type[nonzero_elements]);
 
-
-  // reserve temporary storage to store the entries of one row
-  std::vector<size_type> tmp_entries(max_row_length);
-
   // Traverse all rows
-  for (size_type line = 0; line < n_rows(); ++line)
-    {
-      // copy used entries, break if first unused entry is reached
-      row_length = 0;
-      for (size_type j = rowstart[line]; j < rowstart[line + 1];
-           ++j, ++row_length)
-        if (colnums[j] != invalid_entry)
-          tmp_entries[row_length] = colnums[j];
-        else
-          break;
-      // now @p{rowstart} is the number of entries in this line
-
-      // Sort only beginning at the second entry, if optimized storage of
-      // diagonal entries is on.
-
-      // if this line is empty or has only one entry, don't sort
-      if (row_length > 1)
-        std::sort((store_diagonal_first_in_row) ? tmp_entries.begin() + 1 :
-                                                  tmp_entries.begin(),
-                  tmp_entries.begin() + row_length);
-
-      // insert column numbers into the new field
-      for (size_type j = 0; j < row_length; ++j)
-        new_colnums[next_free_entry++] = tmp_entries[j];
-
-      // note new start of this and the next row
-      rowstart[line] = next_row_start;
-      next_row_start = next_free_entry;
-
-      // some internal checks: either the matrix is not quadratic, or if it
-      // is, then the first element of this row must be the diagonal element
-      // (i.e. with column index==line number)
-      // this test only makes sense if we have written to the index
-      // rowstart_line in new_colnums which is the case if row_length is not 0,
-      // so check this first
-      Assert((!store_diagonal_first_in_row) ||
-               (row_length != 0 && new_colnums[rowstart[line]] == line),
-             ExcInternalError());
-      // assert that the first entry does not show up in the remaining ones
-      // and that the remaining ones are unique among themselves (this handles
-      // both cases, quadratic and rectangular matrices)
-      //
-      // the only exception here is if the row contains no entries at all
-      Assert((rowstart[line] == next_row_start) ||
-               (std::find(&new_colnums[rowstart[line] + 1],
-                          &new_colnums[next_row_start],
-                          new_colnums[rowstart[line]]) ==
-                &new_colnums[next_row_start]),
-             ExcInternalError());
-      Assert((rowstart[line] == next_row_start) ||
-               (std::adjacent_find(&new_colnums[rowstart[line] + 1],
-                                   &new_colnums[next_row_start]) ==
-                &new_colnums[next_row_start]),
-             ExcInternalError());
-    }
-
-  // assert that we have used all allocated space, no more and no less
-  Assert(next_free_entry == nonzero_elements, ExcInternalError());
+  parallel::internal::apply_to_subranges_with_affinity(
+    0,
+    rows,
+    [this, &new_rowstart, &new_colnums](const size_type begin_row,
+                                        const size_type end_row) {
+      for (size_type line = begin_row; line < end_row; ++line)
+        {
+          // copy the used entries
+          size_type *const new_row_begin = &new_colnums[new_rowstart[line]];
+          size_type *const new_row_end   = &new_colnums[new_rowstart[line + 1]];
+          std::copy(&colnums[rowstart[line]],
+                    &colnums[rowstart[line]] + (new_row_end - new_row_begin),
+                    new_row_begin);
+
+          // Sort only beginning at the second entry, if optimized storage of
+          // diagonal entries is on.
+
+          // if this line is empty or has only one entry, don't sort
+          if (new_row_end - new_row_begin > 1)
+            std::sort((store_diagonal_first_in_row) ? new_row_begin + 1 :
+                                                      new_row_begin,
+                      new_row_end);
+
+          // some internal checks: either the matrix is not quadratic, or if
+          // it is, then the first element of this row must be the diagonal
+          // element (i.e. with column index==line number)
+          Assert((!store_diagonal_first_in_row) ||
+                   (new_row_end != new_row_begin && *new_row_begin == line),
+                 ExcInternalError());
+          // assert that the first entry does not show up in the remaining
+          // ones and that the remaining ones are unique among themselves
+          // (this handles both cases, quadratic and rectangular matrices)
+          //
+          // the only exception here is if the row contains no entries at all
+          Assert((new_row_begin == new_row_end) ||
+                   (std::find(new_row_begin + 1,
+                              new_row_end,
+                              *new_row_begin) == new_row_end),
+                 ExcInternalError());
+          Assert((new_row_begin == new_row_end) ||
+                   (std::adjacent_find(new_row_begin + 1, new_row_end) ==
+                    new_row_end),
+                 ExcInternalError());
+        }
+    },
+    internal::SparseMatrixImplementation::minimum_parallel_grain_size,
+    thread_loop_partitioner);
 
-  // set iterator-past-the-end
-  rowstart[rows] = next_row_start;
+  // note the new start of each row
+  std::copy(new_rowstart.begin(), new_rowstart.end(), rowstart.get());
 
   // set colnums to the newly allocated array and delete previous content
   // in the process
@@ -518,18 +537,27 @@ SparsityPattern::copy_from(const DynamicSparsityPattern &dsp)
     }
   reinit(dsp.n_rows(), dsp.n_cols(), row_lengths);
 
+  // the rows are written to disjoint parts of colnums, so we can fill them
+  // in parallel
   if (n_rows() != 0 && n_cols() != 0)
-    for (size_type row = 0; row < dsp.n_rows(); ++row)
-      {
-        size_type *cols = &colnums[rowstart[row]] + (do_diag_optimize ? 1 : 0);
-        const unsigned int row_length = dsp.row_length(row);
-        for (unsigned int index = 0; index < row_length; ++index)
+    parallel::apply_to_subranges(
+      size_type(0),
+      dsp.n_rows(),
+      [&](const size_type begin, const size_type end) {
+        for (size_type row = begin; row < end; ++row)
           {
-            const size_type col = dsp.column_number(row, index);
-            if ((col != row) || !do_diag_optimize)
-              *cols++ = col;
+            size_type *cols =
+              &colnums[rowstart[row]] + (do_diag_optimize ? 1 : 0);
+            const unsigned int row_length = dsp.row_length(row);
+            for (unsigned int index = 0; index < row_length; ++index)
+              {
+                const size_type col = dsp.column_number(row, index);
+                if ((col != row) || !do_diag_optimize)
+                  *cols++ = col;
+              }
           }
-      }
+      },
+      /* grainsize = */ 1000);
 
   // do not need to compress the sparsity pattern since we already have
   // allocated the right amount of data, and the SparsityPatternType data is
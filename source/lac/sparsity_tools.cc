@@ -26,6 +26,7 @@
 
 #ifdef DEAL_II_WITH_MPI
 #  include <deal.II/base/mpi.h>
+#  include <deal.II/base/mpi_consensus_algorithms.h>
 #  include <deal.II/base/utilities.h>
 
 #  include <deal.II/lac/block_sparsity_pattern.h>
@@ -902,6 +903,111 @@ namespace SparsityTools
 
 #ifdef DEAL_II_WITH_MPI
 
+  namespace
+  {
+    /**
+     * Send the rows of @p dsp that are not locally owned to their owners and
+     * add the rows received from other processes to @p dsp.
+     *
+     * The owners are determined with a consensus algorithm, and the rows are
+     * exchanged with a second consensus algorithm in which the owners do not
+     * need to know from which processes they receive data, so that no
+     * separate step to determine the communication pattern is needed. Each
+     * received message is added to @p dsp as soon as it arrives, overlapping
+     * the insertion with the remaining communication.
+     *
+     * Since the columns of a row are sorted and typically come in long runs
+     * of consecutive indices, the rows are encoded as the row index, the
+     * number of runs, and the first column and length of each run.
+     */
+    template <typename SparsityPatternType>
+    void
+    send_and_add_nonlocal_rows(SparsityPatternType &dsp,
+                               const IndexSet      &locally_owned_rows,
+                               const MPI_Comm       mpi_comm,
+                               const IndexSet      &locally_relevant_rows)
+    {
+      using size_type = typename SparsityPatternType::size_type;
+
+      IndexSet requested_rows(locally_relevant_rows);
+      requested_rows.subtract_set(locally_owned_rows);
+
+      const std::vector<unsigned int> index_owner =
+        Utilities::MPI::compute_index_owner(locally_owned_rows,
+                                            requested_rows,
+                                            mpi_comm);
+
+      std::map<unsigned int, std::vector<size_type>> send_data;
+      {
+        unsigned int i = 0;
+        for (auto row = requested_rows.begin(); row != requested_rows.end();
+             ++row, ++i)
+          {
+            const size_type rlen = dsp.row_length(*row);
+
+            // skip empty lines
+            if (rlen == 0)
+              continue;
+
+            std::vector<size_type> &dst = send_data[index_owner[i]];
+            dst.push_back(*row);
+            const std::size_t n_runs_position = dst.size();
+            dst.push_back(0);
+            for (size_type c = 0; c < rlen; ++c)
+              {
+                const size_type column = dsp.column_number(*row, c);
+                if (dst[n_runs_position] > 0 &&
+                    dst[dst.size() - 2] + dst.back() == column)
+                  ++dst.back();
+                else
+                  {
+                    dst.push_back(column);
+                    dst.push_back(1);
+                    ++dst[n_runs_position];
+                  }
+              }
+          }
+      }
+
+      std::vector<unsigned int> targets;
+      targets.reserve(send_data.size());
+      for (const auto &data : send_data)
+        targets.push_back(data.first);
+
+      std::vector<size_type> columns;
+      Utilities::MPI::ConsensusAlgorithms::selector<std::vector<size_type>>(
+        targets,
+        [&](const unsigned int target_rank) {
+          return send_data[target_rank];
+        },
+        [&](const unsigned int, const std::vector<size_type> &recv_buf) {
+          auto       ptr = recv_buf.begin();
+          const auto end = recv_buf.end();
+          while (ptr != end)
+            {
+              const size_type row = *(ptr++);
+              Assert(ptr != end, ExcInternalError());
+              const size_type n_runs = *(ptr++);
+              Assert(n_runs > 0, ExcInternalError());
+
+              columns.clear();
+              for (size_type r = 0; r < n_runs; ++r)
+                {
+                  Assert(ptr + 1 < end, ExcInternalError());
+                  const size_type first_column = *(ptr++);
+                  const size_type run_length   = *(ptr++);
+                  for (size_type c = 0; c < run_length; ++c)
+                    columns.push_back(first_column + c);
+                }
+              dsp.add_entries(row, columns.begin(), columns.end(), true);
+            }
+        },
+        mpi_comm);
+    }
+  } // namespace
+
+
+
   void
   gather_sparsity_pattern(DynamicSparsityPattern &dsp,
                           const IndexSet         &locally_owned_rows,
@@ -1027,63 +1133,10 @@ namespace SparsityTools
       ExcMessage(
         "The DynamicSparsityPattern must be initialized with an IndexSet that contains locally relevant indices."));
 
-    IndexSet requested_rows(locally_relevant_rows);
-    requested_rows.subtract_set(locally_owned_rows);
-
-    std::vector<unsigned int> index_owner =
-      Utilities::MPI::compute_index_owner(locally_owned_rows,
-                                          requested_rows,
-                                          mpi_comm);
-
-    using map_vec_t =
-      std::map<unsigned int, std::vector<DynamicSparsityPattern::size_type>>;
-
-    map_vec_t send_data;
-
-    for (DynamicSparsityPattern::size_type i = 0;
-         i < requested_rows.n_elements();
-         ++i)
-      {
-        const DynamicSparsityPattern::size_type row =
-          requested_rows.nth_index_in_set(i);
-
-        const auto rlen = dsp.row_length(row);
-
-        // skip empty lines
-        if (rlen == 0)
-          continue;
-
-        // save entries
-        send_data[index_owner[i]].push_back(row);  // row index
-        send_data[index_owner[i]].push_back(rlen); // number of entries
-        for (DynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-          {
-            // columns
-            const auto column = dsp.column_number(row, c);
-            send_data[index_owner[i]].push_back(column);
-          }
-      }
-
-    const auto receive_data = Utilities::MPI::some_to_some(mpi_comm, send_data);
-
-    // add what we received
-    for (const auto &data : receive_data)
-      {
-        const auto &recv_buf = data.second;
-        auto        ptr      = recv_buf.begin();
-        const auto  end      = recv_buf.end();
-        while (ptr != end)
-          {
-            const auto row = *(ptr++);
-            Assert(ptr != end, ExcInternalError());
-            const auto n_entries = *(ptr++);
-
-            Assert(ptr + (n_entries - 1) != end, ExcInternalError());
-            dsp.add_entries(row, ptr, ptr + n_entries, true);
-            ptr += n_entries;
-          }
-        Assert(ptr == end, ExcInternalError());
-      }
+    send_and_add_nonlocal_rows(dsp,
+                               locally_owned_rows,
+                               mpi_comm,
+                               locally_relevant_rows);
   }
 
 
@@ -1109,135 +1162,10 @@ namespace SparsityTools
                               const MPI_Comm               mpi_comm,
                               const IndexSet &locally_relevant_rows)
   {
-    using map_vec_t =
-      std::map<BlockDynamicSparsityPattern::size_type,
-               std::vector<BlockDynamicSparsityPattern::size_type>>;
-    map_vec_t send_data;
-
-    IndexSet requested_rows(locally_relevant_rows);
-    requested_rows.subtract_set(locally_owned_rows);
-
-    std::vector<unsigned int> index_owner =
-      Utilities::MPI::compute_index_owner(locally_owned_rows,
-                                          requested_rows,
-                                          mpi_comm);
-
-    for (DynamicSparsityPattern::size_type i = 0;
-         i < requested_rows.n_elements();
-         ++i)
-      {
-        const DynamicSparsityPattern::size_type row =
-          requested_rows.nth_index_in_set(i);
-
-        BlockDynamicSparsityPattern::size_type rlen = dsp.row_length(row);
-
-        // skip empty lines
-        if (rlen == 0)
-          continue;
-
-        // save entries
-        std::vector<BlockDynamicSparsityPattern::size_type> &dst =
-          send_data[index_owner[i]];
-
-        dst.push_back(rlen); // number of entries
-        dst.push_back(row);  // row index
-        for (BlockDynamicSparsityPattern::size_type c = 0; c < rlen; ++c)
-          {
-            // columns
-            BlockDynamicSparsityPattern::size_type column =
-              dsp.column_number(row, c);
-            dst.push_back(column);
-          }
-      }
-
-    unsigned int num_receive = 0;
-    {
-      std::vector<unsigned int> send_to;
-      send_to.reserve(send_data.size());
-      for (const auto &sparsity_line : send_data)
-        send_to.push_back(sparsity_line.first);
-
-      num_receive =
-        Utilities::MPI::compute_n_point_to_point_communications(mpi_comm,
-                                                                send_to);
-    }
-
-    std::vector<MPI_Request> requests(send_data.size());
-
-
-    // send data
-
-    static Utilities::MPI::CollectiveMutex      mutex;
-    Utilities::MPI::CollectiveMutex::ScopedLock lock(mutex, mpi_comm);
-
-    const int mpi_tag = Utilities::MPI::internal::Tags::
-      sparsity_tools_distribute_sparsity_pattern;
-
-    {
-      unsigned int idx = 0;
-      for (const auto &sparsity_line : send_data)
-        {
-          const int ierr = MPI_Isend(sparsity_line.second.data(),
-                                     sparsity_line.second.size(),
-                                     DEAL_II_DOF_INDEX_MPI_TYPE,
-                                     sparsity_line.first,
-                                     mpi_tag,
-                                     mpi_comm,
-                                     &requests[idx++]);
-          AssertThrowMPI(ierr);
-        }
-    }
-
-    {
-      // receive
-      std::vector<BlockDynamicSparsityPattern::size_type> recv_buf;
-      for (unsigned int index = 0; index < num_receive; ++index)
-        {
-          MPI_Status status;
-          int ierr = MPI_Probe(MPI_ANY_SOURCE, mpi_tag, mpi_comm, &status);
-          AssertThrowMPI(ierr);
-
-          int len;
-          ierr = MPI_Get_count(&status, DEAL_II_DOF_INDEX_MPI_TYPE, &len);
-          AssertThrowMPI(ierr);
-
-          recv_buf.resize(len);
-          ierr = MPI_Recv(recv_buf.data(),
-                          len,
-                          DEAL_II_DOF_INDEX_MPI_TYPE,
-                          status.MPI_SOURCE,
-                          status.MPI_TAG,
-                          mpi_comm,
-                          &status);
-          AssertThrowMPI(ierr);
-
-          std::vector<BlockDynamicSparsityPattern::size_type>::const_iterator
-            ptr = recv_buf.begin();
-          std::vector<BlockDynamicSparsityPattern::size_type>::const_iterator
-            end = recv_buf.end();
-          while (ptr != end)
-            {
-              BlockDynamicSparsityPattern::size_type num = *(ptr++);
-              Assert(ptr != end, ExcInternalError());
-              BlockDynamicSparsityPattern::size_type row = *(ptr++);
-              for (unsigned int c = 0; c < num; ++c)
-                {
-                  Assert(ptr != end, ExcInternalError());
-                  dsp.add(row, *ptr);
-                  ++ptr;
-                }
-            }
-          Assert(ptr == end, ExcInternalError());
-        }
-    }
-
-    // complete all sends, so that we can safely destroy the buffers.
-    if (requests.size() > 0)
-      {
-        const int ierr =
-          MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
-        AssertThrowMPI(ierr);
-      }
+    send_and_add_nonlocal_rows(dsp,
+                               locally_owned_rows,
+                               mpi_comm,
+                               locally_relevant_rows);
   }
 #endif
 } // namespace SparsityTools
@@ -14,10 +14,20 @@
 
 #include <deal.II/base/config.h>
 
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi.templates.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/lapack_full_matrix.h>
 #include <deal.II/lac/lapack_templates.h>
 #include <deal.II/lac/utilities.h>
 
+#include <algorithm>
 #include <complex>
+#include <limits>
+#include <random>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -85,4 +95,323 @@ namespace internal
 
 
 
+namespace
+{
+  /**
+   * Compute the upper triangular factor of the QR factorization of the
+   * column-major @p n_rows x @p n_columns matrix @p matrix, which is
+   * overwritten. The factor is returned as a column-major square matrix of
+   * size @p n_columns, whose rows beyond @p n_rows are zero.
+   */
+  template <typename Number>
+  std::vector<Number>
+  compute_r_factor(std::vector<Number> &matrix,
+                   const unsigned int   n_rows,
+                   const unsigned int   n_columns)
+  {
+    std::vector<Number> r(n_columns * n_columns);
+    if (n_rows == 0 || n_columns == 0)
+      return r;
+
+    const types::blas_int m = n_rows;
+    const types::blas_int n = n_columns;
+    types::blas_int       info;
+    std::vector<Number>   tau(std::min(n_rows, n_columns));
+
+    // query the optimal size of the workspace first
+    types::blas_int lwork = -1;
+    Number          optimal_lwork;
+    geqrf(&m, &n, matrix.data(), &m, tau.data(), &optimal_lwork, &lwork, &info);
+    lwork = std::max<types::blas_int>(1, static_cast<types::blas_int>(
+                                           std::abs(optimal_lwork)));
+    std::vector<Number> work(lwork);
+    geqrf(&m, &n, matrix.data(), &m, tau.data(), work.data(), &lwork, &info);
+    AssertThrow(info == 0, LAPACKSupport::ExcErrorCode("geqrf", info));
+
+    for (unsigned int j = 0; j < n_columns; ++j)
+      for (unsigned int i = 0; i <= std::min(j, n_rows - 1); ++i)
+        r[i + j * n_columns] = matrix[i + j * n_rows];
+
+    return r;
+  }
+
+
+
+  /**
+   * Replace, on each locally owned row, the entries of the first
+   * transformation.m() vectors in @p vectors by their linear combinations
+   * with the columns of @p transformation, storing the result in the first
+   * transformation.n() vectors.
+   */
+  template <typename Number>
+  void
+  transform_in_place(
+    std::vector<LinearAlgebra::distributed::Vector<Number>> &vectors,
+    const FullMatrix<Number>                                &transformation)
+  {
+    const unsigned int  n_local = vectors[0].locally_owned_size();
+    std::vector<Number> row(transformation.m());
+    for (unsigned int l = 0; l < n_local; ++l)
+      {
+        for (unsigned int c = 0; c < transformation.m(); ++c)
+          row[c] = vectors[c].local_element(l);
+        for (unsigned int i = 0; i < transformation.n(); ++i)
+          {
+            Number sum = 0;
+            for (unsigned int c = 0; c < transformation.m(); ++c)
+              sum += row[c] * transformation(c, i);
+            vectors[i].local_element(l) = sum;
+          }
+      }
+  }
+
+
+
+  /**
+   * Replace the first @p n_columns vectors in @p vectors by an orthonormal
+   * basis of their span and return its dimension. The basis is computed
+   * from the triangular factor $R$ of a tall-skinny QR factorization (TSQR),
+   * in which each process factorizes its locally owned rows and the local
+   * factors are combined by a reduction over all processes. With the
+   * singular value decomposition $R = W \Sigma V^T$, the basis is
+   * $Y V \Sigma^{-1}$. Directions whose singular values are negligible
+   * compared to the largest one are dropped.
+   */
+  template <typename Number>
+  unsigned int
+  orthonormalize(
+    std::vector<LinearAlgebra::distributed::Vector<Number>> &vectors,
+    const unsigned int                                       n_columns)
+  {
+    if (n_columns == 0)
+      return 0;
+
+    const unsigned int  n_local = vectors[0].locally_owned_size();
+    std::vector<Number> local_matrix(n_local * n_columns);
+    for (unsigned int c = 0; c < n_columns; ++c)
+      std::copy(vectors[c].begin(),
+                vectors[c].begin() + n_local,
+                local_matrix.begin() + c * n_local);
+    const std::vector<Number> local_r =
+      compute_r_factor(local_matrix, n_local, n_columns);
+    local_matrix.clear();
+
+    const std::vector<Number> r = Utilities::MPI::all_reduce<
+      std::vector<Number>>(
+      local_r,
+      vectors[0].get_mpi_communicator(),
+      [n_columns](const std::vector<Number> &a, const std::vector<Number> &b) {
+        std::vector<Number> stacked(2 * n_columns * n_columns);
+        for (unsigned int c = 0; c < n_columns; ++c)
+          {
+            std::copy(a.begin() + c * n_columns,
+                      a.begin() + (c + 1) * n_columns,
+                      stacked.begin() + 2 * c * n_columns);
+            std::copy(b.begin() + c * n_columns,
+                      b.begin() + (c + 1) * n_columns,
+                      stacked.begin() + (2 * c + 1) * n_columns);
+          }
+        return compute_r_factor(stacked, 2 * n_columns, n_columns);
+      });
+
+    LAPACKFullMatrix<Number> r_matrix(n_columns, n_columns);
+    for (unsigned int i = 0; i < n_columns; ++i)
+      for (unsigned int j = i; j < n_columns; ++j)
+        r_matrix(i, j) = r[i + j * n_columns];
+    r_matrix.compute_svd();
+
+    const Number tolerance = r_matrix.singular_value(0) * n_columns *
+                             std::numeric_limits<Number>::epsilon();
+    unsigned int n_kept = 0;
+    while (n_kept < n_columns && r_matrix.singular_value(n_kept) > tolerance)
+      ++n_kept;
+
+    const LAPACKFullMatrix<Number> &vt = r_matrix.get_svd_vt();
+    FullMatrix<Number>              transformation(n_columns, n_kept);
+    for (unsigned int c = 0; c < n_columns; ++c)
+      for (unsigned int i = 0; i < n_kept; ++i)
+        transformation(c, i) = vt(i, c) / r_matrix.singular_value(i);
+    transform_in_place(vectors, transformation);
+
+    return n_kept;
+  }
+} // namespace
+
+
+
+namespace Utilities
+{
+  namespace LinearAlgebra
+  {
+    template <typename Number>
+    void
+    randomized_svd(
+      const std::function<
+        void(const unsigned int,
+             dealii::LinearAlgebra::distributed::Vector<Number,
+                                                         MemorySpace::Host> &)>
+                                                               &get_snapshot,
+      const unsigned int                                        n_snapshots,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner,
+      const unsigned int                                        rank,
+      std::vector<
+        dealii::LinearAlgebra::distributed::Vector<Number, MemorySpace::Host>>
+                          &left_singular_vectors,
+      std::vector<Number> &singular_values,
+      const unsigned int   oversampling,
+      const unsigned int   n_power_iterations)
+    {
+      using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+      AssertIndexRange(rank, n_snapshots + 1);
+      const unsigned int n_samples = std::min(rank + oversampling, n_snapshots);
+
+      std::vector<VectorType> basis(n_samples);
+      for (VectorType &vector : basis)
+        vector.reinit(partitioner);
+      VectorType         snapshot(partitioner);
+      const unsigned int n_local = partitioner->locally_owned_size();
+
+      // Compute basis = A * coefficients for the first n_columns vectors in
+      // basis, where the coefficients are given row by row.
+      const auto multiply = [&](const std::vector<Number> &coefficients,
+                                const unsigned int         n_columns) {
+        for (unsigned int c = 0; c < n_columns; ++c)
+          basis[c] = Number();
+        for (unsigned int j = 0; j < n_snapshots; ++j)
+          {
+            get_snapshot(j, snapshot);
+            AssertDimension(snapshot.locally_owned_size(), n_local);
+            for (unsigned int c = 0; c < n_columns; ++c)
+              basis[c].add(coefficients[j * n_columns + c], snapshot);
+          }
+      };
+
+      // Compute A^T * basis for the first n_columns vectors in basis, row
+      // by row, with a single reduction over all processes.
+      const auto multiply_transpose = [&](const unsigned int n_columns) {
+        std::vector<Number> result(n_snapshots * n_columns);
+        for (unsigned int j = 0; j < n_snapshots; ++j)
+          {
+            get_snapshot(j, snapshot);
+            AssertDimension(snapshot.locally_owned_size(), n_local);
+            for (unsigned int c = 0; c < n_columns; ++c)
+              {
+                Number sum = 0;
+                for (unsigned int l = 0; l < n_local; ++l)
+                  sum += basis[c].local_element(l) * snapshot.local_element(l);
+                result[j * n_columns + c] = sum;
+              }
+          }
+        Utilities::MPI::sum(ArrayView<const Number>(result),
+                            partitioner->get_mpi_communicator(),
+                            make_array_view(result));
+        return result;
+      };
+
+      // Sample the range of A with a Gaussian random matrix. All processes
+      // use the same seed and thus generate the same matrix.
+      std::mt19937                     generator(1);
+      std::normal_distribution<double> distribution;
+      std::vector<Number>              random_matrix(n_snapshots * n_samples);
+      for (Number &entry : random_matrix)
+        entry = distribution(generator);
+      multiply(random_matrix, n_samples);
+      random_matrix.clear();
+
+      // Orthonormalize twice to make the basis orthonormal to machine
+      // accuracy, then apply the power iterations.
+      unsigned int n_basis = orthonormalize(basis, n_samples);
+      n_basis              = orthonormalize(basis, n_basis);
+      for (unsigned int it = 0; it < n_power_iterations && n_basis > 0; ++it)
+        {
+          multiply(multiply_transpose(n_basis), n_basis);
+          n_basis = orthonormalize(basis, n_basis);
+          n_basis = orthonormalize(basis, n_basis);
+        }
+
+      left_singular_vectors.clear();
+      singular_values.clear();
+      if (n_basis == 0)
+        return;
+
+      // Compute the singular value decomposition of the small matrix
+      // B = Q^T A through the QR factorization B^T = Q_2 R_2, such that the
+      // singular values and left singular vectors of B are those of R_2^T.
+      const std::vector<Number> bt = multiply_transpose(n_basis);
+      std::vector<Number>       bt_column_major(bt.size());
+      for (unsigned int j = 0; j < n_snapshots; ++j)
+        for (unsigned int c = 0; c < n_basis; ++c)
+          bt_column_major[j + c * n_snapshots] = bt[j * n_basis + c];
+      const std::vector<Number> r =
+        compute_r_factor(bt_column_major, n_snapshots, n_basis);
+
+      LAPACKFullMatrix<Number> rt(n_basis, n_basis);
+      for (unsigned int i = 0; i < n_basis; ++i)
+        for (unsigned int j = i; j < n_basis; ++j)
+          rt(j, i) = r[i + j * n_basis];
+      rt.compute_svd();
+
+      const Number tolerance = rt.singular_value(0) * n_basis *
+                               std::numeric_limits<Number>::epsilon();
+      unsigned int n_values  = 0;
+      while (n_values < std::min(rank, n_basis) &&
+             rt.singular_value(n_values) > tolerance)
+        ++n_values;
+
+      // The left singular vectors of A are Q times those of B.
+      const LAPACKFullMatrix<Number> &u = rt.get_svd_u();
+      FullMatrix<Number>              transformation(n_basis, n_values);
+      for (unsigned int c = 0; c < n_basis; ++c)
+        for (unsigned int i = 0; i < n_values; ++i)
+          transformation(c, i) = u(c, i);
+      transform_in_place(basis, transformation);
+
+      singular_values.resize(n_values);
+      left_singular_vectors.resize(n_values);
+      for (unsigned int i = 0; i < n_values; ++i)
+        {
+          singular_values[i] = rt.singular_value(i);
+          left_singular_vectors[i].swap(basis[i]);
+        }
+    }
+
+    template void
+    randomized_svd<float>(
+      const std::function<
+        void(const unsigned int,
+             dealii::LinearAlgebra::distributed::Vector<float,
+                                                         MemorySpace::Host> &)>
+        &,
+      const unsigned int,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &,
+      const unsigned int,
+      std::vector<
+        dealii::LinearAlgebra::distributed::Vector<float, MemorySpace::Host>>
+        &,
+      std::vector<float> &,
+      const unsigned int,
+      const unsigned int);
+
+    template void
+    randomized_svd<double>(
+      const std::function<
+        void(const unsigned int,
+             dealii::LinearAlgebra::distributed::Vector<double,
+                                                         MemorySpace::Host> &)>
+        &,
+      const unsigned int,
+      const std::shared_ptr<const Utilities::MPI::Partitioner> &,
+      const unsigned int,
+      std::vector<
+        dealii::LinearAlgebra::distributed::Vector<double, MemorySpace::Host>>
+        &,
+      std::vector<double> &,
+      const unsigned int,
+      const unsigned int);
+  } // namespace LinearAlgebra
+} // namespace Utilities
+
+
+
 DEAL_II_NAMESPACE_CLOSE
@@ -24,6 +24,7 @@
 #include <deal.II/matrix_free/vector_data_exchange.h>
 
 #include <iostream>
+#include <limits>
 
 DEAL_II_NAMESPACE_OPEN
 
@@ -63,6 +64,8 @@ namespace internal
       row_starts_plain_indices.clear();
       plain_dof_indices.clear();
       dof_indices_interleaved.clear();
+      dof_indices_interleaved_base.clear();
+      dof_indices_interleaved_offsets.clear();
       for (unsigned int i = 0; i < 3; ++i)
         {
           index_storage_variants[i].clear();
@@ -70,7 +73,8 @@ namespace internal
           dof_indices_interleave_strides[i].clear();
           n_vectorization_lanes_filled[i].clear();
         }
-      store_plain_indices = false;
+      store_plain_indices  = false;
+      compress_dof_indices = false;
       cell_active_fe_index.clear();
       max_fe_index = 0;
       fe_index_conversion.clear();
@@ -95,6 +99,15 @@ namespace internal
       const unsigned int n_vectorization_actual =
         n_vectorization_lanes_filled[dof_access_index][cell];
 
+      // the hanging-node constraints are resolved in the stored indices if
+      // any component of the element is handled by the fast algorithm, which
+      // need not be the first one for systems of different elements
+      const bool element_has_fast_hanging_nodes =
+        hanging_node_constraint_masks_comp.size() != 0 &&
+        std::find(hanging_node_constraint_masks_comp[fe_index].begin(),
+                  hanging_node_constraint_masks_comp[fe_index].end(),
+                  true) != hanging_node_constraint_masks_comp[fe_index].end();
+
       // we might have constraints, so the final number
       // of indices is not known a priori.
       // conservatively reserve the maximum without constraints
@@ -113,10 +126,9 @@ namespace internal
           // one
           const bool has_constraints =
             (hanging_node_constraint_masks.size() != 0 &&
-             hanging_node_constraint_masks_comp.size() != 0 &&
+             element_has_fast_hanging_nodes &&
              hanging_node_constraint_masks[cell * n_vectorization + v] !=
-               unconstrained_compressed_constraint_kind &&
-             hanging_node_constraint_masks_comp[fe_index][0 /*TODO*/]) ||
+               unconstrained_compressed_constraint_kind) ||
             (row_starts[ib].second != row_starts[ib + n_fe_components].second);
 
           auto do_copy = [&](const unsigned int *begin,
@@ -887,10 +899,127 @@ namespace internal
                   *interleaved_dof_indices = *my_dof_indices;
               }
           }
+
+      // Step 5: Compress the interleaved indices to a base index per cell
+      // and 16-bit offsets if requested
+      if (compress_dof_indices)
+        {
+          dof_indices_interleaved_base.resize(irregular_cells.size() *
+                                                vectorization_length,
+                                              numbers::invalid_unsigned_int);
+          dof_indices_interleaved_offsets.resize(
+            dof_indices_interleaved.size());
+
+          std::vector<unsigned int> base_indices(vectorization_length);
+          bool                      all_compressed = true;
+          bool                      any_compressed = false;
+          for (unsigned int i = 0; i < irregular_cells.size(); ++i)
+            if (index_storage_variants[dof_access_cell][i] ==
+                IndexStorageVariants::interleaved)
+              {
+                const unsigned int ndofs =
+                  dofs_per_cell[have_hp ? cell_active_fe_index[i] : 0];
+                const unsigned int start =
+                  row_starts[i * vectorization_length * n_components].first;
+                const unsigned int *interleaved_dof_indices =
+                  this->dof_indices_interleaved.data() + start;
+
+                bool fits_into_offsets = true;
+                for (unsigned int v = 0; v < vectorization_length; ++v)
+                  {
+                    unsigned int min_index = numbers::invalid_unsigned_int;
+                    unsigned int max_index = 0;
+                    for (unsigned int k = 0; k < ndofs; ++k)
+                      {
+                        const unsigned int index =
+                          interleaved_dof_indices[k * vectorization_length +
+                                                  v];
+                        min_index = std::min(min_index, index);
+                        max_index = std::max(max_index, index);
+                      }
+                    if (ndofs > 0 &&
+                        max_index - min_index >
+                          std::numeric_limits<unsigned short>::max())
+                      fits_into_offsets = false;
+                    base_indices[v] = min_index;
+                  }
+
+                if (fits_into_offsets == false)
+                  {
+                    all_compressed = false;
+                    continue;
+                  }
+
+                for (unsigned int v = 0; v < vectorization_length; ++v)
+                  dof_indices_interleaved_base[i * vectorization_length + v] =
+                    base_indices[v];
+                for (unsigned int k = 0; k < ndofs * vectorization_length; ++k)
+                  dof_indices_interleaved_offsets[start + k] =
+                    interleaved_dof_indices[k] -
+                    base_indices[k % vectorization_length];
+                any_compressed = true;
+              }
+
+          // The full interleaved indices are only needed for the batches
+          // that could not be compressed
+          if (any_compressed == false)
+            {
+              dof_indices_interleaved_base.clear();
+              dof_indices_interleaved_offsets.clear();
+            }
+          else if (all_compressed)
+            std::vector<unsigned int>().swap(dof_indices_interleaved);
+        }
     }
 
 
 
+    namespace
+    {
+      /**
+       * Create a partitioner with the locally owned range of @p part and
+       * the given ghost indices, which must be a subset of the ghost indices
+       * of @p part. The owners of the ghost indices are taken from @p part,
+       * which avoids looking them up again in
+       * Utilities::MPI::Partitioner::set_ghost_indices().
+       */
+      std::shared_ptr<const Utilities::MPI::Partitioner>
+      create_partitioner_with_ghost_subset(
+        const Utilities::MPI::Partitioner &part,
+        const IndexSet                    &ghost_indices)
+      {
+        const auto &ghost_targets = part.ghost_targets();
+
+        std::vector<unsigned int> ghost_owners;
+        ghost_owners.reserve(ghost_indices.n_elements());
+        unsigned int            target        = 0;
+        types::global_dof_index end_of_target = 0;
+        for (const types::global_dof_index index : ghost_indices)
+          {
+            const types::global_dof_index position =
+              part.ghost_indices().index_within_set(index);
+            Assert(position != numbers::invalid_dof_index,
+                   ExcInternalError());
+            while (position >= end_of_target)
+              {
+                AssertIndexRange(target, ghost_targets.size());
+                end_of_target += ghost_targets[target].second;
+                ++target;
+              }
+            ghost_owners.push_back(ghost_targets[target - 1].first);
+          }
+
+        const auto partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+          part.locally_owned_range(), part.get_mpi_communicator());
+        partitioner->set_ghost_indices(ghost_indices,
+                                       ghost_owners,
+                                       part.ghost_indices());
+        return partitioner;
+      }
+    } // namespace
+
+
+
     void
     DoFInfo::compute_tight_partitioners(
       const Table<2, ShapeInfo<double>>        &shape_info,
@@ -945,10 +1074,7 @@ namespace internal
           temp_0 = vector_partitioner;
         else
           {
-            temp_0 = std::make_shared<Utilities::MPI::Partitioner>(
-              part.locally_owned_range(), part.get_mpi_communicator());
-            const_cast<Utilities::MPI::Partitioner *>(temp_0.get())
-              ->set_ghost_indices(compressed_set, part.ghost_indices());
+            temp_0 = create_partitioner_with_ghost_subset(part, compressed_set);
           }
 
         if (use_vector_data_exchanger_full == false)
@@ -1095,11 +1221,7 @@ namespace internal
               else
                 {
                   vector_partitioner_values =
-                    std::make_shared<Utilities::MPI::Partitioner>(
-                      part.locally_owned_range(), part.get_mpi_communicator());
-                  const_cast<Utilities::MPI::Partitioner *>(
-                    vector_partitioner_values.get())
-                    ->set_ghost_indices(compressed_set, part.ghost_indices());
+                    create_partitioner_with_ghost_subset(part, compressed_set);
                 }
             }
         };
@@ -1169,11 +1291,7 @@ namespace internal
               else
                 {
                   vector_partitioner_gradients =
-                    std::make_shared<Utilities::MPI::Partitioner>(
-                      part.locally_owned_range(), part.get_mpi_communicator());
-                  const_cast<Utilities::MPI::Partitioner *>(
-                    vector_partitioner_gradients.get())
-                    ->set_ghost_indices(compressed_set, part.ghost_indices());
+                    create_partitioner_with_ghost_subset(part, compressed_set);
                 }
             }
         };
@@ -1530,6 +1648,11 @@ namespace internal
       memory +=
         (row_starts.capacity() * sizeof(std::pair<unsigned int, unsigned int>));
       memory += MemoryConsumption::memory_consumption(dof_indices);
+      memory += MemoryConsumption::memory_consumption(dof_indices_interleaved);
+      memory +=
+        MemoryConsumption::memory_consumption(dof_indices_interleaved_base);
+      memory +=
+        MemoryConsumption::memory_consumption(dof_indices_interleaved_offsets);
       memory +=
         MemoryConsumption::memory_consumption(hanging_node_constraint_masks);
       memory += MemoryConsumption::memory_consumption(row_starts_plain_indices);
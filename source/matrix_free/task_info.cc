@@ -18,6 +18,7 @@
 #include <deal.II/base/mpi.h>
 #include <deal.II/base/multithread_info.h>
 #include <deal.II/base/parallel.h>
+#include <deal.II/base/trace.h>
 #include <deal.II/base/utilities.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
@@ -35,6 +36,7 @@
 #  endif
 #endif
 
+#include <chrono>
 #include <iostream>
 #include <set>
 
@@ -299,8 +301,13 @@ namespace internal
              task_info.cell_partition_data[partition] + task_info.block_size -
              1) /
             task_info.block_size;
+          std::shared_ptr<tbb::affinity_partitioner> partitioner =
+            task_info.color_partitioners[partition]->acquire_one_partitioner();
           parallel_for(tbb::blocked_range<unsigned int>(0, n_chunks, 1),
-                       CellWork(worker, task_info, partition));
+                       CellWork(worker, task_info, partition),
+                       *partitioner);
+          task_info.color_partitioners[partition]->release_one_partitioner(
+            partitioner);
           if (is_blocked == true)
             tbb::empty_task::spawn(*dummy);
           return nullptr;
@@ -349,6 +356,8 @@ namespace internal
     void
     TaskInfo::loop(MFWorkerInterface &funct) const
     {
+      const ::dealii::Trace::Scope trace_scope("MatrixFree::loop");
+
       // If we use thread parallelism, we do not currently support to schedule
       // pieces of updates within the loop, so this index will collect all
       // calls in that case and work like a single complete loop over all
@@ -359,6 +368,14 @@ namespace internal
         funct.cell_loop_pre_range(
           partition_row_index[partition_row_index.size() - 2]);
 
+      // when requested, test the state of the ghost exchange in the serial
+      // loop and record how much of it overlaps with computations
+      const bool poll_ghost_exchange =
+        poll_communication_progress && scheme == none && n_procs > 1;
+      std::chrono::steady_clock::time_point ghost_exchange_start_time;
+      if (poll_ghost_exchange)
+        ghost_exchange_start_time = std::chrono::steady_clock::now();
+
       funct.vector_update_ghosts_start();
 
 #if defined(DEAL_II_WITH_TBB) && !defined(DEAL_II_TBB_WITH_ONEAPI)
@@ -436,6 +453,14 @@ namespace internal
             }
           else // end of partition-partition, start of partition-color
             {
+              if (color_partitioners.size() != cell_partition_data.size() - 1)
+                {
+                  color_partitioners.resize(cell_partition_data.size() - 1);
+                  for (auto &partitioner : color_partitioners)
+                    partitioner = std::make_shared<
+                      dealii::parallel::internal::TBBPartitioner>();
+                }
+
               // check whether there is only one partition. if not, build up the
               // tree of partitions
               if (odds > 0)
@@ -605,10 +630,36 @@ namespace internal
         // serial loop, go through up to three times and do the MPI transfer at
         // the beginning/end of the second part
         {
+          bool ghost_exchange_completed = false;
           for (unsigned int part = 0; part < partition_row_index.size() - 2;
                ++part)
             {
-              if (part == 1)
+              if (part == 1 && poll_ghost_exchange)
+                {
+                  const auto wait_start_time = std::chrono::steady_clock::now();
+                  if (!ghost_exchange_completed)
+                    {
+                      ghost_exchange_completed =
+                        funct.vector_update_ghosts_test();
+                      ++ghost_exchange_statistics.n_progress_tests;
+                    }
+                  funct.vector_update_ghosts_finish();
+                  const auto wait_end_time = std::chrono::steady_clock::now();
+
+                  ++ghost_exchange_statistics.n_loops;
+                  if (ghost_exchange_completed)
+                    ++ghost_exchange_statistics
+                        .n_loops_completed_during_computation;
+                  ghost_exchange_statistics.overlap_time +=
+                    std::chrono::duration<double>(wait_start_time -
+                                                  ghost_exchange_start_time)
+                      .count();
+                  ghost_exchange_statistics.wait_time +=
+                    std::chrono::duration<double>(wait_end_time -
+                                                  wait_start_time)
+                      .count();
+                }
+              else if (part == 1)
                 funct.vector_update_ghosts_finish();
 
               for (unsigned int i = partition_row_index[part];
@@ -632,6 +683,14 @@ namespace internal
                         funct.boundary(i);
                     }
                   funct.cell_loop_post_range(i);
+
+                  if (part == 0 && poll_ghost_exchange &&
+                      !ghost_exchange_completed)
+                    {
+                      ghost_exchange_completed =
+                        funct.vector_update_ghosts_test();
+                      ++ghost_exchange_statistics.n_progress_tests;
+                    }
                 }
 
               if (part == 1)
@@ -681,6 +740,10 @@ namespace internal
       communicator = MPI_COMM_SELF;
       my_pid       = 0;
       n_procs      = 1;
+
+      poll_communication_progress = false;
+      ghost_exchange_statistics   = GhostExchangeStatistics();
+      color_partitioners.clear();
     }
 
 
@@ -28,6 +28,19 @@
 DEAL_II_NAMESPACE_OPEN
 
 
+template <typename VectorType>
+void
+MGMatrixBase<VectorType>::residual(const unsigned int level,
+                                   VectorType        &dst,
+                                   const VectorType  &src,
+                                   const VectorType  &rhs) const
+{
+  vmult(level, dst, src);
+  dst.sadd(-1., 1., rhs);
+}
+
+
+
 template <typename VectorType>
 void
 MGSmootherBase<VectorType>::apply(const unsigned int level,
@@ -59,4 +72,21 @@ MGTransferBase<VectorType>::prolongate_and_add(const unsigned int to_level,
 
 #include "mg_base.inst"
 
+template class MGTransferBase<
+  LinearAlgebra::distributed::Vector<float, MemorySpace::Default>>;
+template class MGTransferBase<
+  LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
+template class MGMatrixBase<
+  LinearAlgebra::distributed::Vector<float, MemorySpace::Default>>;
+template class MGMatrixBase<
+  LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
+template class MGSmootherBase<
+  LinearAlgebra::distributed::Vector<float, MemorySpace::Default>>;
+template class MGSmootherBase<
+  LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
+template class MGCoarseGridBase<
+  LinearAlgebra::distributed::Vector<float, MemorySpace::Default>>;
+template class MGCoarseGridBase<
+  LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
+
 DEAL_II_NAMESPACE_CLOSE
@@ -0,0 +1,247 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/multigrid/mg_timer.h>
+
+#include <iomanip>
+
+DEAL_II_NAMESPACE_OPEN
+
+
+namespace
+{
+  bool
+  is_level_phase(const MGTimer::Phase phase)
+  {
+    return phase != MGTimer::Phase::transfer_to_mg &&
+           phase != MGTimer::Phase::transfer_to_global;
+  }
+} // namespace
+
+
+
+MGTimer::~MGTimer()
+{
+  detach();
+}
+
+
+
+void
+MGTimer::detach()
+{
+  for (auto &connection : connections)
+    connection.disconnect();
+  connections.clear();
+}
+
+
+
+void
+MGTimer::reset()
+{
+  for (auto &level_data : data)
+    for (auto &phase_data : level_data)
+      {
+        phase_data.time    = 0.;
+        phase_data.n_calls = 0;
+      }
+}
+
+
+
+void
+MGTimer::set_work_estimate(const unsigned int level,
+                           const Phase        phase,
+                           const double       bytes,
+                           const double       flops)
+{
+  Data &phase_data = get_data(level, phase);
+  phase_data.bytes = bytes;
+  phase_data.flops = flops;
+}
+
+
+
+double
+MGTimer::get_time(const unsigned int level, const Phase phase) const
+{
+  const unsigned int l = is_level_phase(phase) ? level : 0;
+  return l < data.size() ? data[l][static_cast<unsigned int>(phase)].time : 0.;
+}
+
+
+
+unsigned long int
+MGTimer::get_n_calls(const unsigned int level, const Phase phase) const
+{
+  const unsigned int l = is_level_phase(phase) ? level : 0;
+  return l < data.size() ? data[l][static_cast<unsigned int>(phase)].n_calls :
+                           0;
+}
+
+
+
+double
+MGTimer::get_total_time() const
+{
+  double total_time = 0.;
+  for (const auto &level_data : data)
+    for (const auto &phase_data : level_data)
+      total_time += phase_data.time;
+  return total_time;
+}
+
+
+
+void
+MGTimer::print_summary(std::ostream &out, const MPI_Comm mpi_communicator) const
+{
+  const bool is_root = Utilities::MPI::this_mpi_process(mpi_communicator) == 0;
+
+  // save the state of the stream
+  const std::ios_base::fmtflags old_flags     = out.flags();
+  const std::streamsize         old_precision = out.precision();
+
+  out << std::fixed << std::setprecision(3);
+  out << std::left << std::setw(7) << "level" << std::setw(20) << "phase"
+      << std::right << std::setw(10) << "calls" << std::setw(11) << "min [s]"
+      << std::setw(11) << "avg [s]" << std::setw(11) << "max [s]"
+      << std::setw(10) << "GB/s" << std::setw(10) << "GFlop/s" << std::endl;
+
+  const double total_time =
+    Utilities::MPI::max(get_total_time(), mpi_communicator);
+
+  // processes that have not seen the finest levels contribute empty data
+  const Data         empty_data;
+  const unsigned int n_levels =
+    Utilities::MPI::max(static_cast<unsigned int>(data.size()),
+                        mpi_communicator);
+
+  for (unsigned int level = n_levels; level-- > 0;)
+    for (unsigned int p = 0; p < n_phases; ++p)
+      {
+        const Data &phase_data =
+          level < data.size() ? data[level][p] : empty_data;
+        const unsigned long int n_calls =
+          Utilities::MPI::max(phase_data.n_calls, mpi_communicator);
+        if (n_calls == 0)
+          continue;
+
+        const Utilities::MPI::MinMaxAvg time =
+          Utilities::MPI::min_max_avg(phase_data.time, mpi_communicator);
+        const double bytes =
+          Utilities::MPI::sum(phase_data.bytes * phase_data.n_calls,
+                              mpi_communicator);
+        const double flops =
+          Utilities::MPI::sum(phase_data.flops * phase_data.n_calls,
+                              mpi_communicator);
+
+        if (is_root == false)
+          continue;
+
+        const Phase phase = static_cast<Phase>(p);
+        if (is_level_phase(phase))
+          out << std::left << std::setw(7) << level;
+        else
+          out << std::left << std::setw(7) << "-";
+        out << std::setw(20) << get_phase_name(phase) << std::right
+            << std::setw(10) << n_calls << std::setw(11)
+            << time.min << std::setw(11) << time.avg << std::setw(11)
+            << time.max;
+        if (bytes > 0. && time.max > 0.)
+          out << std::setw(10) << 1e-9 * bytes / time.max;
+        else
+          out << std::setw(10) << "-";
+        if (flops > 0. && time.max > 0.)
+          out << std::setw(10) << 1e-9 * flops / time.max;
+        else
+          out << std::setw(10) << "-";
+        out << std::endl;
+      }
+
+  if (is_root)
+    out << std::left << std::setw(27) << "total" << std::right
+        << std::setw(43) << total_time << std::endl;
+
+  // restore the state of the stream
+  out.flags(old_flags);
+  out.precision(old_precision);
+}
+
+
+
+const char *
+MGTimer::get_phase_name(const Phase phase)
+{
+  switch (phase)
+    {
+      case Phase::pre_smoothing:
+        return "pre_smoothing";
+      case Phase::residual:
+        return "residual";
+      case Phase::restriction:
+        return "restriction";
+      case Phase::coarse_solve:
+        return "coarse_solve";
+      case Phase::prolongation:
+        return "prolongation";
+      case Phase::edge_prolongation:
+        return "edge_prolongation";
+      case Phase::post_smoothing:
+        return "post_smoothing";
+      case Phase::transfer_to_mg:
+        return "transfer_to_mg";
+      case Phase::transfer_to_global:
+        return "transfer_to_global";
+      default:
+        DEAL_II_ASSERT_UNREACHABLE();
+        return "";
+    }
+}
+
+
+
+void
+MGTimer::measure(const bool         before,
+                 const unsigned int level,
+                 const Phase        phase)
+{
+  Data &phase_data = get_data(level, phase);
+  if (before)
+    phase_data.start_time = std::chrono::steady_clock::now();
+  else
+    {
+      phase_data.time += std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() -
+                           phase_data.start_time)
+                           .count();
+      ++phase_data.n_calls;
+    }
+}
+
+
+
+MGTimer::Data &
+MGTimer::get_data(const unsigned int level, const Phase phase)
+{
+  const unsigned int l = is_level_phase(phase) ? level : 0;
+  if (l >= data.size())
+    data.resize(l + 1);
+  return data[l][static_cast<unsigned int>(phase)];
+}
+
+DEAL_II_NAMESPACE_CLOSE
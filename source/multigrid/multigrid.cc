@@ -302,6 +302,11 @@ MGTransferBlockSelect<number>::restrict_and_add(const unsigned int from_level,
 
 #include "multigrid.inst"
 
+template class Multigrid<
+  LinearAlgebra::distributed::Vector<float, MemorySpace::Default>>;
+template class Multigrid<
+  LinearAlgebra::distributed::Vector<double, MemorySpace::Default>>;
+
 template class MGTransferBlock<float>;
 template class MGTransferBlock<double>;
 template class MGTransferSelect<float>;
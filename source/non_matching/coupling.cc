@@ -15,6 +15,7 @@
 #include <deal.II/base/exceptions.h>
 #include <deal.II/base/point.h>
 #include <deal.II/base/tensor.h>
+#include <deal.II/base/work_stream.h>
 
 #include <deal.II/distributed/shared_tria.h>
 #include <deal.II/distributed/tria.h>
@@ -417,10 +418,6 @@ namespace NonMatching
     const auto &space_fe    = space_dh.get_fe();
     const auto &immersed_fe = immersed_dh.get_fe();
 
-    // Dof indices
-    std::vector<types::global_dof_index> dofs(immersed_fe.n_dofs_per_cell());
-    std::vector<types::global_dof_index> odofs(space_fe.n_dofs_per_cell());
-
     // Take care of components
     const ComponentMask space_c =
       (space_comps.size() == 0 ? ComponentMask(space_fe.n_components(), true) :
@@ -447,16 +444,6 @@ namespace NonMatching
       if (immersed_c[i])
         immersed_gtl[i] = j++;
 
-    FullMatrix<typename Matrix::value_type> cell_matrix(
-      space_dh.get_fe().n_dofs_per_cell(),
-      immersed_dh.get_fe().n_dofs_per_cell());
-
-    FEValues<dim1, spacedim> fe_v(immersed_mapping,
-                                  immersed_dh.get_fe(),
-                                  quad,
-                                  update_JxW_values | update_quadrature_points |
-                                    update_values);
-
     const unsigned int n_q_points = quad.size();
     const unsigned int n_active_c =
       immersed_dh.get_triangulation().n_active_cells();
@@ -499,64 +486,70 @@ namespace NonMatching
 
             const unsigned int n_pt = all_maps[o][j] % n_q_points;
 
-            // If there are no cells, we just add our data
-            if (cell_container[cell_id].empty())
+            // The outer cells are processed one after the other, so the
+            // current outer cell can only be the last one inserted for
+            // this immersed cell, if any
+            if (cell_container[cell_id].empty() ||
+                cell_container[cell_id].back() != all_cells[o])
               {
                 cell_container[cell_id].emplace_back(all_cells[o]);
-                qpoints_container[cell_id].emplace_back(
-                  std::vector<Point<dim0>>{all_qpoints[o][j]});
-                maps_container[cell_id].emplace_back(
-                  std::vector<unsigned int>{n_pt});
-              }
-            // If there are already cells, we begin by looking
-            // at the last inserted cell, which is more likely:
-            else if (cell_container[cell_id].back() == all_cells[o])
-              {
-                qpoints_container[cell_id].back().emplace_back(
-                  all_qpoints[o][j]);
-                maps_container[cell_id].back().emplace_back(n_pt);
-              }
-            else
-              {
-                // We don't need to check the last element
-                const auto cell_p = std::find(cell_container[cell_id].begin(),
-                                              cell_container[cell_id].end() - 1,
-                                              all_cells[o]);
-
-                if (cell_p == cell_container[cell_id].end() - 1)
-                  {
-                    cell_container[cell_id].emplace_back(all_cells[o]);
-                    qpoints_container[cell_id].emplace_back(
-                      std::vector<Point<dim0>>{all_qpoints[o][j]});
-                    maps_container[cell_id].emplace_back(
-                      std::vector<unsigned int>{n_pt});
-                  }
-                else
-                  {
-                    const unsigned int pos =
-                      cell_p - cell_container[cell_id].begin();
-                    qpoints_container[cell_id][pos].emplace_back(
-                      all_qpoints[o][j]);
-                    maps_container[cell_id][pos].emplace_back(n_pt);
-                  }
+                qpoints_container[cell_id].emplace_back();
+                maps_container[cell_id].emplace_back();
               }
+            qpoints_container[cell_id].back().emplace_back(all_qpoints[o][j]);
+            maps_container[cell_id].back().emplace_back(n_pt);
           }
       }
 
-    typename DoFHandler<dim1, spacedim>::active_cell_iterator
-      cell = immersed_dh.begin_active(),
-      endc = immersed_dh.end();
+    // The local matrices of different immersed cells are independent of
+    // each other, so we compute them in parallel and only add them to the
+    // global matrix sequentially
+    struct ScratchData
+    {
+      ScratchData(const Mapping<dim1, spacedim>       &mapping,
+                  const FiniteElement<dim1, spacedim> &fe,
+                  const Quadrature<dim1>              &quad)
+        : fe_v(mapping, fe, quad, update_JxW_values | update_values)
+      {}
+
+      ScratchData(const ScratchData &scratch)
+        : fe_v(scratch.fe_v.get_mapping(),
+               scratch.fe_v.get_fe(),
+               scratch.fe_v.get_quadrature(),
+               scratch.fe_v.get_update_flags())
+      {}
+
+      FEValues<dim1, spacedim> fe_v;
+    };
 
-    for (unsigned int j = 0; cell != endc; ++cell, ++j)
-      {
-        // Reinitialize the cell and the fe_values
-        fe_v.reinit(cell);
-        cell->get_dof_indices(dofs);
+    struct CopyData
+    {
+      std::vector<types::global_dof_index>                 dofs;
+      std::vector<std::vector<types::global_dof_index>>    odofs;
+      std::vector<FullMatrix<typename Matrix::value_type>> cell_matrices;
+    };
+
+    const auto worker =
+      [&](const typename DoFHandler<dim1, spacedim>::active_cell_iterator
+                      &cell,
+          ScratchData &scratch,
+          CopyData    &copy) {
+        copy.odofs.clear();
+        copy.cell_matrices.clear();
 
         // Get a list of outer cells, qpoints and maps.
-        const auto &cells   = cell_container[j];
-        const auto &qpoints = qpoints_container[j];
-        const auto &maps    = maps_container[j];
+        const unsigned int j       = cell->active_cell_index();
+        const auto        &cells   = cell_container[j];
+        const auto        &qpoints = qpoints_container[j];
+        const auto        &maps    = maps_container[j];
+        if (cells.empty())
+          return;
+
+        // Reinitialize the cell and the fe_values
+        FEValues<dim1, spacedim> &fe_v = scratch.fe_v;
+        fe_v.reinit(cell);
+        copy.dofs.resize(immersed_fe.n_dofs_per_cell());
+        cell->get_dof_indices(copy.dofs);
 
         for (unsigned int c = 0; c < cells.size(); ++c)
           {
@@ -570,29 +563,29 @@ namespace NonMatching
                 const std::vector<unsigned int> &ids = maps[c];
 
                 FEValues<dim0, spacedim> o_fe_v(cache.get_mapping(),
-                                                space_dh.get_fe(),
+                                                space_fe,
                                                 qps,
                                                 update_values);
                 o_fe_v.reinit(ocell);
-                ocell->get_dof_indices(odofs);
+                copy.odofs.emplace_back(space_fe.n_dofs_per_cell());
+                ocell->get_dof_indices(copy.odofs.back());
 
-                // Reset the matrices.
-                cell_matrix = typename Matrix::value_type();
+                copy.cell_matrices.emplace_back(space_fe.n_dofs_per_cell(),
+                                                immersed_fe.n_dofs_per_cell());
+                FullMatrix<typename Matrix::value_type> &cell_matrix =
+                  copy.cell_matrices.back();
 
-                for (unsigned int i = 0;
-                     i < space_dh.get_fe().n_dofs_per_cell();
-                     ++i)
+                for (unsigned int i = 0; i < space_fe.n_dofs_per_cell(); ++i)
                   {
                     const auto comp_i =
-                      space_dh.get_fe().system_to_component_index(i).first;
+                      space_fe.system_to_component_index(i).first;
                     if (space_gtl[comp_i] != numbers::invalid_unsigned_int)
                       for (unsigned int j = 0;
-                           j < immersed_dh.get_fe().n_dofs_per_cell();
+                           j < immersed_fe.n_dofs_per_cell();
                            ++j)
                         {
-                          const auto comp_j = immersed_dh.get_fe()
-                                                .system_to_component_index(j)
-                                                .first;
+                          const auto comp_j =
+                            immersed_fe.system_to_component_index(j).first;
                           if (space_gtl[comp_i] == immersed_gtl[comp_j])
                             for (unsigned int oq = 0;
                                  oq < o_fe_v.n_quadrature_points;
@@ -607,13 +600,26 @@ namespace NonMatching
                               }
                         }
                   }
-
-                // Now assemble the matrices
-                constraints.distribute_local_to_global(
-                  cell_matrix, odofs, immersed_constraints, dofs, matrix);
               }
           }
-      }
+      };
+
+    const auto copier = [&](const CopyData &copy) {
+      // Now assemble the matrices
+      for (unsigned int c = 0; c < copy.cell_matrices.size(); ++c)
+        constraints.distribute_local_to_global(copy.cell_matrices[c],
+                                               copy.odofs[c],
+                                               immersed_constraints,
+                                               copy.dofs,
+                                               matrix);
+    };
+
+    WorkStream::run(immersed_dh.begin_active(),
+                    immersed_dh.end(),
+                    worker,
+                    copier,
+                    ScratchData(immersed_mapping, immersed_fe, quad),
+                    CopyData());
   }
 
   template <int dim0, int dim1, int spacedim, typename Number>
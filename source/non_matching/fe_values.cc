@@ -247,15 +247,33 @@ namespace NonMatching
           }
         case LocationToLevelSet::intersected:
           {
-            quadrature_generator.set_1D_quadrature(q_index_1D);
-            quadrature_generator.generate(cell);
+            // Look up the quadratures in the cache first, if one is set, and
+            // generate them otherwise
+            const typename QuadratureCache<dim>::CellQuadratures *cached =
+              quadrature_cache != nullptr ?
+                quadrature_cache->find(cell, q_index_1D) :
+                nullptr;
+
+            if (cached == nullptr)
+              {
+                quadrature_generator.set_1D_quadrature(q_index_1D);
+                quadrature_generator.generate(cell);
+
+                if (quadrature_cache != nullptr)
+                  cached = &quadrature_cache->insert(cell,
+                                                     q_index_1D,
+                                                     quadrature_generator);
+              }
 
             const Quadrature<dim> &inside_quadrature =
-              quadrature_generator.get_inside_quadrature();
+              cached != nullptr ? cached->inside :
+                                  quadrature_generator.get_inside_quadrature();
             const Quadrature<dim> &outside_quadrature =
-              quadrature_generator.get_outside_quadrature();
+              cached != nullptr ? cached->outside :
+                                  quadrature_generator.get_outside_quadrature();
             const ImmersedSurfaceQuadrature<dim> &surface_quadrature =
-              quadrature_generator.get_surface_quadrature();
+              cached != nullptr ? cached->surface :
+                                  quadrature_generator.get_surface_quadrature();
 
             // Even if a cell is formally intersected the number of created
             // quadrature points can be 0. Avoid creating an FEValues object
@@ -334,6 +352,15 @@ namespace NonMatching
 
 
 
+  template <int dim>
+  void
+  FEValues<dim>::set_quadrature_cache(QuadratureCache<dim> &cache)
+  {
+    quadrature_cache = &cache;
+  }
+
+
+
   template <int dim>
   template <typename VectorType>
   FEInterfaceValues<dim>::FEInterfaceValues(
@@ -488,13 +515,31 @@ namespace NonMatching
 
             AssertIndexRange(q_index, q_collection_1D.size());
 
-            face_quadrature_generator.set_1D_quadrature(q_index);
-            face_quadrature_generator.generate(cell, face_no);
+            const typename QuadratureCache<dim>::FaceQuadratures *cached =
+              quadrature_cache != nullptr ?
+                quadrature_cache->find(cell, face_no, q_index) :
+                nullptr;
+
+            if (cached == nullptr)
+              {
+                face_quadrature_generator.set_1D_quadrature(q_index);
+                face_quadrature_generator.generate(cell, face_no);
+
+                if (quadrature_cache != nullptr)
+                  cached = &quadrature_cache->insert(cell,
+                                                     face_no,
+                                                     q_index,
+                                                     face_quadrature_generator);
+              }
 
             const Quadrature<dim - 1> &inside_quadrature =
-              face_quadrature_generator.get_inside_quadrature();
+              cached != nullptr ?
+                cached->inside :
+                face_quadrature_generator.get_inside_quadrature();
             const Quadrature<dim - 1> &outside_quadrature =
-              face_quadrature_generator.get_outside_quadrature();
+              cached != nullptr ?
+                cached->outside :
+                face_quadrature_generator.get_outside_quadrature();
 
             // Even if a cell is formally intersected the number of created
             // quadrature points can be 0. Avoid creating an FEInterfaceValues
@@ -555,6 +600,15 @@ namespace NonMatching
   }
 
 
+
+  template <int dim>
+  void
+  FEInterfaceValues<dim>::set_quadrature_cache(QuadratureCache<dim> &cache)
+  {
+    quadrature_cache = &cache;
+  }
+
+
 #include "fe_values.inst"
 
 } // namespace NonMatching
@@ -0,0 +1,173 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/memory_consumption.h>
+
+#include <deal.II/non_matching/quadrature_cache.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace NonMatching
+{
+  template <int dim>
+  std::size_t
+  QuadratureCache<dim>::CellQuadratures::memory_consumption() const
+  {
+    return inside.memory_consumption() + outside.memory_consumption() +
+           surface.memory_consumption() +
+           MemoryConsumption::memory_consumption(surface.get_normal_vectors());
+  }
+
+
+
+  template <int dim>
+  std::size_t
+  QuadratureCache<dim>::FaceQuadratures::memory_consumption() const
+  {
+    return inside.memory_consumption() + outside.memory_consumption() +
+           surface.memory_consumption() +
+           MemoryConsumption::memory_consumption(surface.get_normal_vectors());
+  }
+
+
+
+  template <int dim>
+  const typename QuadratureCache<dim>::CellQuadratures *
+  QuadratureCache<dim>::find(
+    const typename Triangulation<dim>::cell_iterator &cell,
+    const unsigned int                                q_index) const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto entry =
+      cell_quadratures.find({cell->active_cell_index(), q_index});
+    return entry != cell_quadratures.end() ? &entry->second : nullptr;
+  }
+
+
+
+  template <int dim>
+  const typename QuadratureCache<dim>::CellQuadratures &
+  QuadratureCache<dim>::insert(
+    const typename Triangulation<dim>::cell_iterator &cell,
+    const unsigned int                                q_index,
+    const QuadratureGenerator<dim>                   &generator)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto [entry, inserted] =
+      cell_quadratures.try_emplace({cell->active_cell_index(), q_index});
+    if (inserted)
+      {
+        entry->second.inside  = generator.get_inside_quadrature();
+        entry->second.outside = generator.get_outside_quadrature();
+        entry->second.surface = generator.get_surface_quadrature();
+      }
+    return entry->second;
+  }
+
+
+
+  template <int dim>
+  const typename QuadratureCache<dim>::FaceQuadratures *
+  QuadratureCache<dim>::find(
+    const typename Triangulation<dim>::cell_iterator &cell,
+    const unsigned int                                face_no,
+    const unsigned int                                q_index) const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto entry = face_quadratures.find(
+      std::make_tuple(cell->active_cell_index(), face_no, q_index));
+    return entry != face_quadratures.end() ? &entry->second : nullptr;
+  }
+
+
+
+  template <int dim>
+  const typename QuadratureCache<dim>::FaceQuadratures &
+  QuadratureCache<dim>::insert(
+    const typename Triangulation<dim>::cell_iterator &cell,
+    const unsigned int                                face_no,
+    const unsigned int                                q_index,
+    const FaceQuadratureGenerator<dim>               &generator)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto [entry, inserted] = face_quadratures.try_emplace(
+      std::make_tuple(cell->active_cell_index(), face_no, q_index));
+    if (inserted)
+      {
+        entry->second.inside  = generator.get_inside_quadrature();
+        entry->second.outside = generator.get_outside_quadrature();
+        entry->second.surface = generator.get_surface_quadrature();
+      }
+    return entry->second;
+  }
+
+
+
+  template <int dim>
+  void
+  QuadratureCache<dim>::clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    cell_quadratures.clear();
+    face_quadratures.clear();
+  }
+
+
+
+  template <int dim>
+  unsigned int
+  QuadratureCache<dim>::n_cells() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cell_quadratures.size();
+  }
+
+
+
+  template <int dim>
+  unsigned int
+  QuadratureCache<dim>::n_faces() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    return face_quadratures.size();
+  }
+
+
+
+  template <int dim>
+  std::size_t
+  QuadratureCache<dim>::memory_consumption() const
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::size_t memory = sizeof(*this);
+    for (const auto &entry : cell_quadratures)
+      memory += sizeof(entry) + entry.second.memory_consumption();
+    for (const auto &entry : face_quadratures)
+      memory += sizeof(entry) + entry.second.memory_consumption();
+    return memory;
+  }
+
+
+
+  template class QuadratureCache<1>;
+  template class QuadratureCache<2>;
+  template class QuadratureCache<3>;
+} // namespace NonMatching
+DEAL_II_NAMESPACE_CLOSE
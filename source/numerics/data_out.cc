@@ -12,6 +12,7 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/trace.h>
 #include <deal.II/base/work_stream.h>
 
 #include <deal.II/dofs/dof_accessor.h>
@@ -96,7 +97,8 @@ DataOut<dim, spacedim>::build_one_patch(
   const std::pair<cell_iterator, unsigned int>                 *cell_and_index,
   internal::DataOutImplementation::ParallelData<dim, spacedim> &scratch_data,
   const unsigned int                                            n_subdivisions,
-  const CurvedCellRegion curved_cell_region)
+  const CurvedCellRegion curved_cell_region,
+  const unsigned int     first_patch_index)
 {
   // first create the output object that we will write into
 
@@ -1046,13 +1048,15 @@ DataOut<dim, spacedim>::build_one_patch(
     (*scratch_data.cell_to_patch_index_map)[cell_and_index->first->level()]
                                            [cell_and_index->first->index()];
   // did we mess up the indices?
-  Assert(patch_idx < this->patches.size(), ExcInternalError());
+  Assert(patch_idx >= first_patch_index &&
+           patch_idx - first_patch_index < this->patches.size(),
+         ExcInternalError());
   patch.patch_index = patch_idx;
 
   // Put the patch into the patches vector. instead of copying the data,
   // simply swap the contents to avoid the penalty of writing into another
   // processor's memory
-  this->patches[patch_idx].swap(patch);
+  this->patches[patch_idx - first_patch_index].swap(patch);
 }
 
 
@@ -1090,6 +1094,56 @@ DataOut<dim, spacedim>::build_patches(
   const hp::MappingCollection<dim, spacedim> &mapping,
   const unsigned int                          n_subdivisions_,
   const CurvedCellRegion                      curved_region)
+{
+  const Trace::Scope trace_scope("DataOut::build_patches");
+
+  build_patches_in_chunks(mapping,
+                          n_subdivisions_,
+                          curved_region,
+                          numbers::invalid_unsigned_int,
+                          std::function<void()>());
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::write_vtu_in_chunks(
+  std::ostream                 &out,
+  const Mapping<dim, spacedim> &mapping,
+  const unsigned int            n_cells_per_chunk,
+  const unsigned int            n_subdivisions,
+  const CurvedCellRegion        curved_region)
+{
+  const Trace::Scope trace_scope("DataOut::write_vtu_in_chunks");
+
+  Assert(n_cells_per_chunk > 0, ExcMessage("Chunks must not be empty."));
+
+  const hp::MappingCollection<dim, spacedim> mapping_collection(mapping);
+  this->write_vtu_in_pieces(
+    out, [&](const std::function<void()> &write_piece) {
+      build_patches_in_chunks(mapping_collection,
+                              n_subdivisions,
+                              curved_region,
+                              n_cells_per_chunk,
+                              write_piece);
+    });
+
+  // release the memory of the last chunk
+  this->patches.clear();
+  this->patches.shrink_to_fit();
+}
+
+
+
+template <int dim, int spacedim>
+void
+DataOut<dim, spacedim>::build_patches_in_chunks(
+  const hp::MappingCollection<dim, spacedim> &mapping,
+  const unsigned int                          n_subdivisions_,
+  const CurvedCellRegion                      curved_region,
+  const unsigned int                          n_cells_per_chunk,
+  const std::function<void()>                &process_chunk)
 {
   // Check consistency of redundant template parameter
   Assert(dim == dim, ExcDimensionMismatch(dim, dim));
@@ -1177,7 +1231,6 @@ DataOut<dim, spacedim>::build_patches(
   }
 
   this->patches.clear();
-  this->patches.resize(all_cells.size());
 
   // Now create a default object for the WorkStream object to work with. The
   // first step is to count how many output data sets there will be. This is,
@@ -1234,36 +1287,53 @@ DataOut<dim, spacedim>::build_patches(
     update_flags,
     cell_to_patch_index_map);
 
-  auto worker = [this, n_subdivisions, curved_cell_region](
-                  const std::pair<cell_iterator, unsigned int> *cell_and_index,
-                  internal::DataOutImplementation::ParallelData<dim, spacedim>
-                    &scratch_data,
-                  // this function doesn't actually need a copy data object --
-                  // it just writes everything right into the output array
-                  int) {
-    this->build_one_patch(cell_and_index,
-                          scratch_data,
-                          n_subdivisions,
-                          curved_cell_region);
-  };
-
-  // now build the patches in parallel
-  if (all_cells.size() > 0)
-    WorkStream::run(all_cells.data(),
-                    all_cells.data() + all_cells.size(),
-                    worker,
-                    // no copy-local-to-global function needed here
-                    std::function<void(const int)>(),
-                    thread_data,
-                    /* dummy CopyData object = */ 0,
-                    // experimenting shows that we can make things run a bit
-                    // faster if we increase the number of cells we work on
-                    // per item (i.e., WorkStream's chunk_size argument,
-                    // about 10% improvement) and the items in flight at any
-                    // given time (another 5% on the testcase discussed in
-                    // @ref workstream_paper, on 32 cores) and if
-                    8 * MultithreadInfo::n_threads(),
-                    64);
+  // now build the patches in parallel, one chunk after the other
+  for (std::size_t first_cell = 0; first_cell < all_cells.size();
+       first_cell += n_cells_per_chunk)
+    {
+      const std::size_t end_cell =
+        std::min<std::size_t>(first_cell + n_cells_per_chunk,
+                              all_cells.size());
+
+      // the patches of the previous chunk are not needed any more
+      this->patches.clear();
+      this->patches.resize(end_cell - first_cell);
+
+      auto worker =
+        [this, n_subdivisions, curved_cell_region, first_cell](
+          const std::pair<cell_iterator, unsigned int> *cell_and_index,
+          internal::DataOutImplementation::ParallelData<dim, spacedim>
+            &scratch_data,
+          // this function doesn't actually need a copy data object --
+          // it just writes everything right into the output array
+          int) {
+          this->build_one_patch(cell_and_index,
+                                scratch_data,
+                                n_subdivisions,
+                                curved_cell_region,
+                                first_cell);
+        };
+
+      WorkStream::run(all_cells.data() + first_cell,
+                      all_cells.data() + end_cell,
+                      worker,
+                      // no copy-local-to-global function needed here
+                      std::function<void(const int)>(),
+                      thread_data,
+                      /* dummy CopyData object = */ 0,
+                      // experimenting shows that we can make things run a
+                      // bit faster if we increase the number of cells we
+                      // work on per item (i.e., WorkStream's chunk_size
+                      // argument, about 10% improvement) and the items in
+                      // flight at any given time (another 5% on the
+                      // testcase discussed in @ref workstream_paper, on 32
+                      // cores) and if
+                      8 * MultithreadInfo::n_threads(),
+                      64);
+
+      if (process_chunk)
+        process_chunk();
+    }
 }
 
 
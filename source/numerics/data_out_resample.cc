@@ -20,6 +20,8 @@
 #include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <deal.II/matrix_free/fe_point_evaluation.h>
+
 #include <deal.II/numerics/data_out_dof_data.templates.h>
 #include <deal.II/numerics/data_out_resample.h>
 #include <deal.II/numerics/vector_tools.h>
@@ -133,12 +135,14 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
       update_mapping(*this->mapping, patch_dof_handler.get_fe().degree);
     }
 
-  std::vector<std::shared_ptr<LinearAlgebra::distributed::Vector<double>>>
-    vectors;
-
   patch_data_out.attach_dof_handler(patch_dof_handler);
 
-  unsigned int counter = 0;
+  // collect the data vectors and the offset of their components within the
+  // values evaluated at each point
+  std::vector<
+    const internal::DataOutImplementation::DataEntry<dim, spacedim, double> *>
+                            data_entries;
+  std::vector<unsigned int> component_offsets = {0};
 
   for (const auto &data : this->dof_data)
     {
@@ -148,10 +152,8 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
 
       Assert(data_ptr, ExcNotImplemented());
 
-      const auto &dh = *data_ptr->dof_handler;
-
 #ifdef DEBUG
-      for (const auto &fe : dh.get_fe_collection())
+      for (const auto &fe : data_ptr->dof_handler->get_fe_collection())
         Assert(
           fe.n_base_elements() == 1,
           ExcMessage(
@@ -159,33 +161,122 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
             "with a single base element."));
 #endif
 
-      for (unsigned int comp = 0; comp < dh.get_fe_collection().n_components();
-           ++comp)
-        {
-          const auto values = VectorTools::point_values<1>(
-            rpe, dh, data_ptr->vector, VectorTools::EvaluationFlags::avg, comp);
+      data_entries.push_back(data_ptr);
+      component_offsets.push_back(
+        component_offsets.back() +
+        data_ptr->dof_handler->get_fe_collection().n_components());
+    }
+
+  const unsigned int n_values = component_offsets.back();
+
+  // evaluate all components of all vectors at once, such that only a single
+  // round of communication is needed
+  const auto evaluation_function = [&](const ArrayView<double> &values,
+                                       const auto              &cell_data) {
+    // one evaluator per component and finite element of each vector
+    std::vector<
+      std::vector<std::unique_ptr<FEPointEvaluation<1, dim, spacedim, double>>>>
+                        evaluators(n_values);
+    std::vector<double> solution_values;
+
+    for (unsigned int i = 0; i < cell_data.cells.size(); ++i)
+      {
+        const ArrayView<const Point<dim>> unit_points(
+          cell_data.reference_point_values.data() +
+            cell_data.reference_point_ptrs[i],
+          cell_data.reference_point_ptrs[i + 1] -
+            cell_data.reference_point_ptrs[i]);
+
+        for (unsigned int e = 0; e < data_entries.size(); ++e)
+          {
+            const DoFHandler<dim, spacedim> &dof_handler =
+              *data_entries[e]->dof_handler;
+
+            const typename DoFHandler<dim, spacedim>::active_cell_iterator
+              cell = {&rpe.get_triangulation(),
+                      cell_data.cells[i].first,
+                      cell_data.cells[i].second,
+                      &dof_handler};
+
+            solution_values.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_values(data_entries[e]->vector,
+                                 solution_values.begin(),
+                                 solution_values.end());
+
+            for (unsigned int comp = 0;
+                 comp < component_offsets[e + 1] - component_offsets[e];
+                 ++comp)
+              {
+                auto &evaluators_of_component =
+                  evaluators[component_offsets[e] + comp];
+                if (evaluators_of_component.empty())
+                  evaluators_of_component.resize(
+                    dof_handler.get_fe_collection().size());
+
+                auto &evaluator =
+                  evaluators_of_component[cell->active_fe_index()];
+                if (evaluator == nullptr)
+                  evaluator = std::make_unique<
+                    FEPointEvaluation<1, dim, spacedim, double>>(
+                    rpe.get_mapping(), cell->get_fe(), update_values, comp);
+
+                evaluator->reinit(cell, unit_points);
+                evaluator->evaluate(solution_values,
+                                    dealii::EvaluationFlags::values);
+
+                for (unsigned int q = 0; q < unit_points.size(); ++q)
+                  values[(q + cell_data.reference_point_ptrs[i]) * n_values +
+                         component_offsets[e] + comp] =
+                    evaluator->get_value(q);
+              }
+          }
+      }
+  };
+
+  std::vector<double> evaluation_point_results;
+  std::vector<double> buffer;
+  rpe.template evaluate_and_process<double>(evaluation_point_results,
+                                            buffer,
+                                            evaluation_function,
+                                            n_values);
+
+  // points found in several cells get the average of the values, while
+  // points not found in any cell get zero
+  const auto &point_ptrs = rpe.get_point_ptrs();
 
-          vectors.emplace_back(
-            std::make_shared<LinearAlgebra::distributed::Vector<double>>(
-              partitioner));
+  std::vector<std::shared_ptr<LinearAlgebra::distributed::Vector<double>>>
+    vectors;
 
-          for (unsigned int j = 0; j < values.size(); ++j)
-            vectors.back()->local_element(point_to_local_vector_indices[j]) =
-              values[j];
+  for (unsigned int v = 0; v < n_values; ++v)
+    {
+      vectors.emplace_back(
+        std::make_shared<LinearAlgebra::distributed::Vector<double>>(
+          partitioner));
 
-          vectors.back()->set_ghost_state(true);
+      for (unsigned int j = 0; j < point_ptrs.size() - 1; ++j)
+        {
+          const unsigned int n_entries = point_ptrs[j + 1] - point_ptrs[j];
+          if (n_entries == 0)
+            continue;
 
-          // we can give the vectors arbitrary names ("temp_*") here, since
-          // these are only used internally (by patch_data_out) but not later on
-          // during the actual output to file
-          patch_data_out.add_data_vector(
-            *vectors.back(),
-            std::string("temp_" + std::to_string(counter)),
-            DataOut_DoFData<patch_dim, patch_dim, spacedim, spacedim>::
-              DataVectorType::type_dof_data);
+          double value = 0.;
+          for (unsigned int k = point_ptrs[j]; k < point_ptrs[j + 1]; ++k)
+            value += evaluation_point_results[k * n_values + v];
 
-          ++counter;
+          vectors.back()->local_element(point_to_local_vector_indices[j]) =
+            value / n_entries;
         }
+
+      vectors.back()->set_ghost_state(true);
+
+      // we can give the vectors arbitrary names ("temp_*") here, since
+      // these are only used internally (by patch_data_out) but not later on
+      // during the actual output to file
+      patch_data_out.add_data_vector(
+        *vectors.back(),
+        std::string("temp_" + std::to_string(v)),
+        DataOut_DoFData<patch_dim, patch_dim, spacedim, spacedim>::
+          DataVectorType::type_dof_data);
     }
 
   patch_data_out.build_patches(*patch_mapping,
@@ -195,6 +286,15 @@ DataOutResample<dim, patch_dim, spacedim>::build_patches(
 
 
 
+template <int dim, int patch_dim, int spacedim>
+bool
+DataOutResample<dim, patch_dim, spacedim>::is_ready() const
+{
+  return rpe.is_ready();
+}
+
+
+
 template <int dim, int patch_dim, int spacedim>
 const std::vector<typename DataOutBase::Patch<patch_dim, spacedim>> &
 DataOutResample<dim, patch_dim, spacedim>::get_patches() const
@@ -111,6 +111,12 @@ PointValueHistory<dim>::PointValueHistory(
   component_names_map = point_value_history.component_names_map;
   point_geometry_data = point_value_history.point_geometry_data;
 
+  evaluation_cells         = point_value_history.evaluation_cells;
+  evaluation_point_ptrs    = point_value_history.evaluation_point_ptrs;
+  evaluation_unit_points   = point_value_history.evaluation_unit_points;
+  evaluation_point_indices = point_value_history.evaluation_point_indices;
+  remote_point_evaluation  = point_value_history.remote_point_evaluation;
+
   closed  = point_value_history.closed;
   cleared = point_value_history.cleared;
 
@@ -144,6 +150,12 @@ PointValueHistory<dim>::operator=(const PointValueHistory &point_value_history)
   component_names_map = point_value_history.component_names_map;
   point_geometry_data = point_value_history.point_geometry_data;
 
+  evaluation_cells         = point_value_history.evaluation_cells;
+  evaluation_point_ptrs    = point_value_history.evaluation_point_ptrs;
+  evaluation_unit_points   = point_value_history.evaluation_unit_points;
+  evaluation_point_indices = point_value_history.evaluation_point_indices;
+  remote_point_evaluation  = point_value_history.remote_point_evaluation;
+
   closed  = point_value_history.closed;
   cleared = point_value_history.cleared;
 
@@ -558,6 +570,12 @@ PointValueHistory<dim>::clear()
   cleared          = true;
   dof_handler      = nullptr;
   have_dof_handler = false;
+
+  evaluation_cells.clear();
+  evaluation_point_ptrs.clear();
+  evaluation_unit_points.clear();
+  evaluation_point_indices.clear();
+  remote_point_evaluation.reset();
 }
 
 // Need to test that the internal data has a full and complete dataset for
@@ -926,35 +944,159 @@ PointValueHistory<dim>::evaluate_field_at_requested_location(
   unsigned int n_stored =
     mask->second.n_selected_components(dof_handler->get_fe(0).n_components());
 
-  typename std::vector<
-    internal::PointValueHistoryImplementation::PointGeometryData<dim>>::iterator
-                 point = point_geometry_data.begin();
-  Vector<number> value(dof_handler->get_fe(0).n_components());
-  for (unsigned int data_store_index = 0; point != point_geometry_data.end();
-       ++point, ++data_store_index)
+  const unsigned int n_components = dof_handler->get_fe(0).n_components();
+  const unsigned int n_points     = point_geometry_data.size();
+  const Mapping<dim> &mapping =
+    get_default_linear_mapping(dof_handler->get_triangulation());
+
+  // Evaluate the solution at all points
+  // within one cell with a single
+  // FEValues object, and store the
+  // values point by point
+  std::vector<Vector<number>> cell_values;
+  const auto evaluate_cell =
+    [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+        const ArrayView<const Point<dim>>                    &unit_points,
+        const std::function<number &(const unsigned int, const unsigned int)>
+          &value) {
+      FEValues<dim> fe_values(mapping,
+                              cell->get_fe(),
+                              Quadrature<dim>(std::vector<Point<dim>>(
+                                unit_points.begin(), unit_points.end())),
+                              update_values);
+      fe_values.reinit(cell);
+      cell_values.resize(unit_points.size(), Vector<number>(n_components));
+      fe_values.get_function_values(solution, cell_values);
+      for (unsigned int q = 0; q < unit_points.size(); ++q)
+        for (unsigned int comp = 0; comp < n_components; ++comp)
+          value(q, comp) = cell_values[q](comp);
+    };
+
+  std::vector<number> values(n_points * n_components);
+
+  if (Utilities::MPI::n_mpi_processes(
+        dof_handler->get_triangulation().get_communicator()) > 1)
     {
-      // Make a Vector <double> for the value
-      // at the point. It will have as many
-      // components as there are in the fe.
-      VectorTools::point_value(*dof_handler,
-                               solution,
-                               point->requested_location,
-                               value);
-
-      // Look up the component_mask and add
-      // in components according to that mask
-      for (unsigned int store_index = 0, comp = 0; comp < mask->second.size();
-           comp++)
+      // Locate the points on the
+      // processes owning the cells around
+      // them and communicate the values
+      // to all processes
+      std::vector<Point<dim>> locations(n_points);
+      for (unsigned int p = 0; p < n_points; ++p)
+        locations[p] = point_geometry_data[p].requested_location;
+      if (remote_point_evaluation == nullptr)
         {
-          if (mask->second[comp])
+          remote_point_evaluation =
+            std::make_shared<Utilities::MPI::RemotePointEvaluation<dim>>();
+          remote_point_evaluation->reinit(locations,
+                                          dof_handler->get_triangulation(),
+                                          mapping);
+        }
+      AssertThrow(remote_point_evaluation->all_points_found(),
+                  ExcMessage("Not all requested locations could be found "
+                             "in the triangulation."));
+
+      std::vector<number> evaluation_results;
+      std::vector<number> buffer;
+      remote_point_evaluation->template evaluate_and_process<number>(
+        evaluation_results,
+        buffer,
+        [&](const ArrayView<number> &results,
+            const typename Utilities::MPI::RemotePointEvaluation<
+              dim>::CellData &cell_data) {
+          for (const auto cell : cell_data.cell_indices())
             {
-              data_store_field
-                ->second[data_store_index * n_stored + store_index]
-                .push_back(value(comp));
-              ++store_index;
+              const unsigned int first =
+                cell_data.reference_point_ptrs[cell];
+              evaluate_cell(
+                cell_data.get_active_cell_iterator(cell)
+                  ->as_dof_handler_iterator(*dof_handler),
+                cell_data.get_unit_points(cell),
+                [&](const unsigned int q,
+                    const unsigned int comp) -> number & {
+                  return results[(first + q) * n_components + comp];
+                });
             }
+        },
+        n_components);
+
+      // A point on the boundary between
+      // cells is found in each of them:
+      // use the first value, as
+      // VectorTools::point_value() does
+      const std::vector<unsigned int> &point_ptrs =
+        remote_point_evaluation->get_point_ptrs();
+      for (unsigned int p = 0; p < n_points; ++p)
+        for (unsigned int comp = 0; comp < n_components; ++comp)
+          values[p * n_components + comp] =
+            evaluation_results[point_ptrs[p] * n_components + comp];
+    }
+  else
+    {
+      if (evaluation_cells.empty() && n_points > 0)
+        {
+          // Locate the cell around each
+          // point once and sort the points
+          // by cell
+          std::map<typename DoFHandler<dim>::active_cell_iterator,
+                   std::vector<std::pair<Point<dim>, unsigned int>>>
+            points_in_cells;
+          for (unsigned int p = 0; p < n_points; ++p)
+            {
+              const auto cell_point =
+                GridTools::find_active_cell_around_point(
+                  mapping,
+                  *dof_handler,
+                  point_geometry_data[p].requested_location);
+              points_in_cells[cell_point.first].emplace_back(
+                cell_point.first->reference_cell().closest_point(
+                  cell_point.second),
+                p);
+            }
+
+          evaluation_point_ptrs.push_back(0);
+          for (const auto &[cell, points] : points_in_cells)
+            {
+              evaluation_cells.push_back(cell);
+              for (const auto &[unit_point, p] : points)
+                {
+                  evaluation_unit_points.push_back(unit_point);
+                  evaluation_point_indices.push_back(p);
+                }
+              evaluation_point_ptrs.push_back(evaluation_unit_points.size());
+            }
+        }
+
+      for (unsigned int i = 0; i < evaluation_cells.size(); ++i)
+        {
+          const unsigned int first = evaluation_point_ptrs[i];
+          evaluate_cell(
+            evaluation_cells[i],
+            make_array_view(evaluation_unit_points.cbegin() + first,
+                            evaluation_unit_points.cbegin() +
+                              evaluation_point_ptrs[i + 1]),
+            [&](const unsigned int q, const unsigned int comp) -> number & {
+              return values[evaluation_point_indices[first + q] *
+                              n_components +
+                            comp];
+            });
         }
     }
+
+  // Look up the component_mask and add
+  // in components according to that mask
+  for (unsigned int data_store_index = 0; data_store_index < n_points;
+       ++data_store_index)
+    for (unsigned int store_index = 0, comp = 0; comp < mask->second.size();
+         comp++)
+      {
+        if (mask->second[comp])
+          {
+            data_store_field->second[data_store_index * n_stored + store_index]
+              .push_back(values[data_store_index * n_components + comp]);
+            ++store_index;
+          }
+      }
 }
 
 
@@ -1498,6 +1640,14 @@ PointValueHistory<dim>::tria_change_listener()
   // this into account next time we
   // evaluate the solution
   triangulation_changed = true;
+
+  // the cells around the requested
+  // locations have to be found again
+  evaluation_cells.clear();
+  evaluation_point_ptrs.clear();
+  evaluation_unit_points.clear();
+  evaluation_point_indices.clear();
+  remote_point_evaluation.reset();
 }
 
 
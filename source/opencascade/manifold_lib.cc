@@ -138,7 +138,9 @@ namespace OpenCASCADE
                std::max(tolerance * surrounding_points[i].norm(), tolerance),
              ExcPointNotOnManifold<spacedim>(surrounding_points[i]));
 #  endif
-    return closest_point(sh, candidate, tolerance);
+    return projection_cache.get_or_compute(
+      std::vector<double>(candidate.begin_raw(), candidate.end_raw()),
+      [&]() { return closest_point(sh, candidate, tolerance); });
   }
 
 
@@ -181,7 +183,9 @@ namespace OpenCASCADE
                std::max(tolerance * surrounding_points[i].norm(), tolerance),
              ExcPointNotOnManifold<spacedim>(surrounding_points[i]));
 #  endif
-    return line_intersection(sh, candidate, direction, tolerance);
+    return projection_cache.get_or_compute(
+      std::vector<double>(candidate.begin_raw(), candidate.end_raw()),
+      [&]() { return line_intersection(sh, candidate, direction, tolerance); });
   }
 
 
@@ -395,10 +399,20 @@ namespace OpenCASCADE
     const ArrayView<const Point<spacedim>> &surrounding_points,
     const Point<spacedim>                  &candidate) const
   {
-    return internal_project_to_manifold(sh,
-                                        tolerance,
-                                        surrounding_points,
-                                        candidate);
+    // the result depends on the surrounding points through the estimated
+    // normal direction, so all of them are part of the key
+    std::vector<double> key;
+    key.reserve((surrounding_points.size() + 1) * spacedim);
+    for (const auto &point : surrounding_points)
+      key.insert(key.end(), point.begin_raw(), point.end_raw());
+    key.insert(key.end(), candidate.begin_raw(), candidate.end_raw());
+
+    return projection_cache.get_or_compute(key, [&]() {
+      return internal_project_to_manifold(sh,
+                                          tolerance,
+                                          surrounding_points,
+                                          candidate);
+    });
   }
 
 
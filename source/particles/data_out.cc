@@ -18,6 +18,10 @@
 // We use some exceptions declared in this header
 #include <deal.II/numerics/data_out_dof_data.h>
 
+#ifdef DEAL_II_WITH_HDF5
+#  include <hdf5.h>
+#endif
+
 DEAL_II_NAMESPACE_OPEN
 
 namespace Particles
@@ -101,6 +105,363 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  DataOut<dim, spacedim>::write_vtkhdf(
+    const Particles::ParticleHandler<dim, spacedim> &particles,
+    const std::string                               &filename,
+    const MPI_Comm                                   comm,
+    const std::vector<std::string>                  &data_component_names,
+    const std::vector<DataComponentInterpretation::DataComponentInterpretation>
+                      &data_component_interpretations_,
+    const unsigned int subsampling_stride) const
+  {
+    Assert(subsampling_stride > 0,
+           ExcMessage("The subsampling stride must be at least one."));
+    Assert(
+      data_component_names.size() == data_component_interpretations_.size(),
+      ExcMessage(
+        "When calling Particles::DataOut::write_vtkhdf with data component "
+        "names and interpretations you need to provide as many data component "
+        "names as interpretations. Provide the same name for components that "
+        "belong to a single vector or tensor."));
+    Assert(data_component_names.empty() ||
+             data_component_names.size() ==
+               particles.get_property_pool().n_properties_per_slot(),
+           ExcMessage(
+             "When calling Particles::DataOut::write_vtkhdf with data "
+             "component names and interpretations you need to provide as "
+             "many data component names as the particles have properties."));
+
+#ifndef DEAL_II_WITH_HDF5
+    // throw an exception, but first make sure the compiler does not warn about
+    // the now unused function arguments
+    (void)particles;
+    (void)filename;
+    (void)comm;
+    (void)data_component_names;
+    (void)data_component_interpretations_;
+    (void)subsampling_stride;
+    AssertThrow(false, ExcNeedsHDF5());
+#else
+    using Handle = typename PropertyPool<dim, spacedim>::Handle;
+
+    PropertyPool<dim, spacedim> &property_pool =
+      particles.get_property_pool();
+
+    // Select the particles to be written by their handles, which is all the
+    // following loops need to read the data from the property pool
+    std::vector<Handle> handles;
+    handles.reserve(
+      (particles.n_locally_owned_particles() + subsampling_stride - 1) /
+      subsampling_stride);
+    {
+      unsigned int index = 0;
+      for (const auto &particle : particles)
+        {
+          if (index % subsampling_stride == 0)
+            handles.push_back(particle.get_handle());
+          ++index;
+        }
+    }
+
+    const std::uint64_t n_local_points = handles.size();
+    const auto [local_offset, n_global_points] =
+      Utilities::MPI::partial_and_total_sum(n_local_points, comm);
+    const bool is_root = Utilities::MPI::this_mpi_process(comm) == 0;
+
+    herr_t status;
+
+    // Create file access properties
+    const hid_t file_plist_id = H5Pcreate(H5P_FILE_ACCESS);
+    AssertThrow(file_plist_id != -1, ExcIO());
+    // If MPI is enabled *and* HDF5 is parallel, we can do parallel output
+#  ifdef DEAL_II_WITH_MPI
+#    ifdef H5_HAVE_PARALLEL
+    status = H5Pset_fapl_mpio(file_plist_id, comm, MPI_INFO_NULL);
+    AssertThrow(status >= 0, ExcIO());
+#    endif
+#  endif
+
+    // Create the property list for a collective write
+    const hid_t plist_id = H5Pcreate(H5P_DATASET_XFER);
+    AssertThrow(plist_id >= 0, ExcIO());
+#  ifdef DEAL_II_WITH_MPI
+#    ifdef H5_HAVE_PARALLEL
+    status = H5Pset_dxpl_mpio(plist_id, H5FD_MPIO_COLLECTIVE);
+    AssertThrow(status >= 0, ExcIO());
+#    endif
+#  endif
+
+    const hid_t file_id =
+      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, file_plist_id);
+    AssertThrow(file_id >= 0, ExcIO());
+
+    // Create a dataset with the given number of rows and columns, where a
+    // single column is written as a one-dimensional dataset, write the
+    // n_rows rows in data to it starting at first_row, and close it again.
+    // Every process has to call this function for every dataset, even if it
+    // has no rows to write, because the writes are collective.
+    const auto write_dataset = [&](const hid_t    location_id,
+                                   const char    *name,
+                                   const hid_t    type_id,
+                                   const hsize_t  n_global_rows,
+                                   const hsize_t  n_columns,
+                                   const hsize_t  first_row,
+                                   const hsize_t  n_rows,
+                                   const void    *data) {
+      const int     rank          = (n_columns > 1 ? 2 : 1);
+      const hsize_t dimensions[2] = {n_global_rows, n_columns};
+      const hsize_t offset[2]     = {first_row, 0};
+      const hsize_t count[2]      = {n_rows, n_columns};
+
+      const hid_t file_dataspace = H5Screate_simple(rank, dimensions, nullptr);
+      AssertThrow(file_dataspace >= 0, ExcIO());
+      const hid_t dataset = H5Dcreate2(location_id,
+                                       name,
+                                       type_id,
+                                       file_dataspace,
+                                       H5P_DEFAULT,
+                                       H5P_DEFAULT,
+                                       H5P_DEFAULT);
+      AssertThrow(dataset >= 0, ExcIO());
+
+      const hid_t memory_dataspace = H5Screate_simple(rank, count, nullptr);
+      AssertThrow(memory_dataspace >= 0, ExcIO());
+      if (n_rows > 0)
+        status = H5Sselect_hyperslab(
+          file_dataspace, H5S_SELECT_SET, offset, nullptr, count, nullptr);
+      else
+        {
+          status = H5Sselect_none(file_dataspace);
+          AssertThrow(status >= 0, ExcIO());
+          status = H5Sselect_none(memory_dataspace);
+        }
+      AssertThrow(status >= 0, ExcIO());
+
+      // HDF5 does not accept a null pointer even if nothing is written
+      const std::uint64_t dummy = 0;
+      status = H5Dwrite(dataset,
+                        type_id,
+                        memory_dataspace,
+                        file_dataspace,
+                        plist_id,
+                        (data != nullptr ? data : &dummy));
+      AssertThrow(status >= 0, ExcIO());
+
+      status = H5Sclose(memory_dataspace);
+      AssertThrow(status >= 0, ExcIO());
+      status = H5Sclose(file_dataspace);
+      AssertThrow(status >= 0, ExcIO());
+      status = H5Dclose(dataset);
+      AssertThrow(status >= 0, ExcIO());
+    };
+
+    // The VTKHDF format stores everything in a group with the attributes
+    // 'Version' and 'Type'
+    const hid_t root_group_id = H5Gcreate2(
+      file_id, "VTKHDF", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    AssertThrow(root_group_id >= 0, ExcIO());
+    {
+      const hsize_t version_dimension = 2;
+      const int     version[2]        = {1, 0};
+      const hid_t   dataspace =
+        H5Screate_simple(1, &version_dimension, nullptr);
+      AssertThrow(dataspace >= 0, ExcIO());
+      const hid_t attribute = H5Acreate2(root_group_id,
+                                         "Version",
+                                         H5T_NATIVE_INT,
+                                         dataspace,
+                                         H5P_DEFAULT,
+                                         H5P_DEFAULT);
+      AssertThrow(attribute >= 0, ExcIO());
+      status = H5Awrite(attribute, H5T_NATIVE_INT, version);
+      AssertThrow(status >= 0, ExcIO());
+      H5Aclose(attribute);
+      H5Sclose(dataspace);
+    }
+    {
+      // VTK expects a fixed-length ASCII string
+      const std::string type = "UnstructuredGrid";
+      const hid_t       string_type = H5Tcopy(H5T_C_S1);
+      AssertThrow(string_type >= 0, ExcIO());
+      H5Tset_size(string_type, type.size());
+      H5Tset_strpad(string_type, H5T_STR_NULLPAD);
+      H5Tset_cset(string_type, H5T_CSET_ASCII);
+      const hid_t dataspace = H5Screate(H5S_SCALAR);
+      AssertThrow(dataspace >= 0, ExcIO());
+      const hid_t attribute = H5Acreate2(root_group_id,
+                                         "Type",
+                                         string_type,
+                                         dataspace,
+                                         H5P_DEFAULT,
+                                         H5P_DEFAULT);
+      AssertThrow(attribute >= 0, ExcIO());
+      status = H5Awrite(attribute, string_type, type.c_str());
+      AssertThrow(status >= 0, ExcIO());
+      H5Aclose(attribute);
+      H5Sclose(dataspace);
+      H5Tclose(string_type);
+    }
+
+    // The file contains a single piece with one vertex cell per particle, so
+    // the number of points, cells, and connectivity entries are all the same
+    {
+      const std::int64_t n_entries = n_global_points;
+      for (const char *name :
+           {"NumberOfPoints", "NumberOfCells", "NumberOfConnectivityIds"})
+        write_dataset(root_group_id,
+                      name,
+                      H5T_NATIVE_INT64,
+                      1,
+                      1,
+                      0,
+                      (is_root ? 1 : 0),
+                      &n_entries);
+    }
+
+    std::vector<double> values(n_local_points * 3, 0.);
+    for (std::uint64_t i = 0; i < n_local_points; ++i)
+      {
+        const Point<spacedim> &location =
+          property_pool.get_location(handles[i]);
+        for (unsigned int d = 0; d < spacedim; ++d)
+          values[i * 3 + d] = location[d];
+      }
+    write_dataset(root_group_id,
+                  "Points",
+                  H5T_NATIVE_DOUBLE,
+                  n_global_points,
+                  3,
+                  local_offset,
+                  n_local_points,
+                  values.data());
+
+    // Cell k consists of point k, and the offsets array has one more entry
+    // than there are cells. The root process writes its first entry.
+    std::vector<std::int64_t> indices(n_local_points + 1);
+    for (std::uint64_t i = 0; i <= n_local_points; ++i)
+      indices[i] = local_offset + i;
+    write_dataset(root_group_id,
+                  "Connectivity",
+                  H5T_NATIVE_INT64,
+                  n_global_points,
+                  1,
+                  local_offset,
+                  n_local_points,
+                  indices.data());
+    write_dataset(root_group_id,
+                  "Offsets",
+                  H5T_NATIVE_INT64,
+                  n_global_points + 1,
+                  1,
+                  (is_root ? 0 : local_offset + 1),
+                  (is_root ? n_local_points + 1 : n_local_points),
+                  (is_root ? indices.data() : indices.data() + 1));
+
+    {
+      // VTK_VERTEX
+      const std::vector<std::uint8_t> types(n_local_points, 1);
+      write_dataset(root_group_id,
+                    "Types",
+                    H5T_NATIVE_UINT8,
+                    n_global_points,
+                    1,
+                    local_offset,
+                    n_local_points,
+                    types.data());
+    }
+
+    const hid_t point_data_group_id = H5Gcreate2(
+      root_group_id, "PointData", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    AssertThrow(point_data_group_id >= 0, ExcIO());
+
+    {
+      std::vector<std::uint64_t> ids(n_local_points);
+      for (std::uint64_t i = 0; i < n_local_points; ++i)
+        ids[i] = property_pool.get_id(handles[i]);
+      write_dataset(point_data_group_id,
+                    "id",
+                    H5T_NATIVE_UINT64,
+                    n_global_points,
+                    1,
+                    local_offset,
+                    n_local_points,
+                    ids.data());
+    }
+
+    // Write the properties one dataset at a time, reusing the buffer. In
+    // property-major layout, the values of each property are read from a
+    // single contiguous array.
+    const bool is_property_major =
+      property_pool.get_property_layout() ==
+      PropertyPool<dim, spacedim>::PropertyLayout::property_major;
+    for (unsigned int i = 0; i < data_component_names.size();)
+      {
+        unsigned int n_components = 1;
+        unsigned int n_columns    = 1;
+        if (data_component_interpretations_[i] ==
+            DataComponentInterpretation::component_is_part_of_vector)
+          {
+            n_components = spacedim;
+            n_columns    = 3;
+          }
+        else if (data_component_interpretations_[i] ==
+                 DataComponentInterpretation::component_is_part_of_tensor)
+          {
+            n_components = spacedim * spacedim;
+            n_columns    = 9;
+          }
+        Assert(i + n_components <= data_component_names.size(),
+               ExcMessage("The property '" + data_component_names[i] +
+                          "' is declared as part of a vector or tensor, but "
+                          "there are not enough properties left for it."));
+
+        values.assign(n_local_points * n_columns, 0.);
+        for (unsigned int c = 0; c < n_components; ++c)
+          {
+            // tensors are padded row by row to 3x3
+            const unsigned int column =
+              (n_columns == 9 ? (c / spacedim) * 3 + c % spacedim : c);
+            if (is_property_major)
+              {
+                const ArrayView<double> property_values =
+                  property_pool.get_property_values(i + c);
+                for (std::uint64_t k = 0; k < n_local_points; ++k)
+                  values[k * n_columns + column] = property_values[handles[k]];
+              }
+            else
+              for (std::uint64_t k = 0; k < n_local_points; ++k)
+                values[k * n_columns + column] =
+                  property_pool.get_properties(handles[k])[i + c];
+          }
+
+        write_dataset(point_data_group_id,
+                      data_component_names[i].c_str(),
+                      H5T_NATIVE_DOUBLE,
+                      n_global_points,
+                      n_columns,
+                      local_offset,
+                      n_local_points,
+                      values.data());
+        i += n_components;
+      }
+
+    status = H5Gclose(point_data_group_id);
+    AssertThrow(status >= 0, ExcIO());
+    status = H5Gclose(root_group_id);
+    AssertThrow(status >= 0, ExcIO());
+    status = H5Pclose(plist_id);
+    AssertThrow(status >= 0, ExcIO());
+    status = H5Pclose(file_plist_id);
+    AssertThrow(status >= 0, ExcIO());
+    status = H5Fclose(file_id);
+    AssertThrow(status >= 0, ExcIO());
+#endif
+  }
+
+
+
   template <int dim, int spacedim>
   const std::vector<DataOutBase::Patch<0, spacedim>> &
   DataOut<dim, spacedim>::get_patches() const
@@ -173,6 +173,89 @@ namespace Particles
 
         return {position, reference_position};
       }
+
+
+
+      // This function does the same as calling random_location_in_cell()
+      // once for each entry of the output arguments, but it transforms all
+      // candidate points of a cell with a single call to the mapping. The
+      // random numbers are drawn in the same order as by
+      // random_location_in_cell(), so that the same locations are generated
+      // unless the fallback to the reference cell is needed for some
+      // particle.
+      template <int dim, int spacedim>
+      void
+      random_locations_in_cell(
+        const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
+        const Mapping<dim, spacedim>     &mapping,
+        std::mt19937                     &random_number_generator,
+        const ArrayView<Point<spacedim>> &positions,
+        const ArrayView<Point<dim>>      &reference_positions)
+      {
+        Assert(cell->reference_cell().is_hyper_cube() == true,
+               ExcNotImplemented());
+        AssertDimension(positions.size(), reference_positions.size());
+
+        std::uniform_real_distribution<double> uniform_distribution_01(0, 1);
+
+        const BoundingBox<spacedim> cell_bounding_box(cell->bounding_box());
+        const std::pair<Point<spacedim>, Point<spacedim>> &cell_bounds(
+          cell_bounding_box.get_boundary_points());
+
+        const unsigned int n_attempts        = 100;
+        const unsigned int n_locations       = positions.size();
+        unsigned int       n_generated       = 0;
+        unsigned int       n_failed_attempts = 0;
+
+        std::vector<Point<spacedim>> candidates;
+        std::vector<Point<dim>>      reference_candidates;
+        while (n_generated < n_locations)
+          {
+            // Draw as many candidates as locations are missing, which is
+            // the number of random points random_location_in_cell() would
+            // draw at least
+            candidates.resize(n_locations - n_generated);
+            for (Point<spacedim> &position : candidates)
+              for (unsigned int d = 0; d < spacedim; ++d)
+                position[d] = uniform_distribution_01(random_number_generator) *
+                                (cell_bounds.second[d] - cell_bounds.first[d]) +
+                              cell_bounds.first[d];
+
+            reference_candidates.resize(candidates.size());
+            mapping.transform_points_real_to_unit_cell(
+              cell,
+              make_array_view(candidates),
+              make_array_view(reference_candidates));
+
+            for (unsigned int i = 0;
+                 i < candidates.size() && n_generated < n_locations;
+                 ++i)
+              if (cell->reference_cell().contains_point(
+                    reference_candidates[i]))
+                {
+                  positions[n_generated]           = candidates[i];
+                  reference_positions[n_generated] = reference_candidates[i];
+                  ++n_generated;
+                  n_failed_attempts = 0;
+                }
+              else if (++n_failed_attempts == n_attempts)
+                {
+                  // Generate the location in the reference cell instead,
+                  // see random_location_in_cell()
+                  Point<dim> reference_position;
+                  for (unsigned int d = 0; d < dim; ++d)
+                    reference_position[d] =
+                      uniform_distribution_01(random_number_generator);
+
+                  positions[n_generated] =
+                    mapping.transform_unit_to_real_cell(cell,
+                                                        reference_position);
+                  reference_positions[n_generated] = reference_position;
+                  ++n_generated;
+                  n_failed_attempts = 0;
+                }
+          }
+      }
     } // namespace
 
 
@@ -212,20 +295,22 @@ namespace Particles
       particle_handler.reserve(particle_handler.n_locally_owned_particles() +
                                n_particles_to_generate);
 
+      std::vector<Point<spacedim>> positions(
+        particle_reference_locations.size());
       for (const auto &cell : triangulation.active_cell_iterators() |
                                 IteratorFilters::LocallyOwnedCell())
         {
-          for (const auto &reference_location : particle_reference_locations)
-            {
-              const Point<spacedim> position_real =
-                mapping.transform_unit_to_real_cell(cell, reference_location);
-
-              particle_handler.insert_particle(position_real,
-                                               reference_location,
-                                               particle_index,
-                                               cell);
-              ++particle_index;
-            }
+          mapping.transform_points_unit_to_real_cell(
+            cell,
+            make_array_view(particle_reference_locations),
+            make_array_view(positions));
+
+          particle_handler.insert_particles_in_cell(
+            cell,
+            make_array_view(positions),
+            make_array_view(particle_reference_locations),
+            particle_index);
+          particle_index += particle_reference_locations.size();
         }
 
       particle_handler.update_cached_numbers();
@@ -409,23 +494,32 @@ namespace Particles
       {
         particle_handler.reserve(particle_handler.n_locally_owned_particles() +
                                  n_local_particles);
-        unsigned int current_particle_index = start_particle_id;
+        types::particle_index current_particle_index = start_particle_id;
 
+        std::vector<Point<spacedim>> positions;
+        std::vector<Point<dim>>      reference_positions;
         for (const auto &cell : triangulation.active_cell_iterators() |
                                   IteratorFilters::LocallyOwnedCell())
           {
-            for (unsigned int i = 0;
-                 i < particles_per_cell[cell->active_cell_index()];
-                 ++i)
-              {
-                random_particle_in_cell_insert(cell,
-                                               current_particle_index,
-                                               random_number_generator,
-                                               particle_handler,
-                                               mapping);
-
-                ++current_particle_index;
-              }
+            const types::particle_index n_particles_in_cell =
+              particles_per_cell[cell->active_cell_index()];
+            if (n_particles_in_cell == 0)
+              continue;
+
+            positions.resize(n_particles_in_cell);
+            reference_positions.resize(n_particles_in_cell);
+            random_locations_in_cell(cell,
+                                     mapping,
+                                     random_number_generator,
+                                     make_array_view(positions),
+                                     make_array_view(reference_positions));
+
+            particle_handler.insert_particles_in_cell(
+              cell,
+              make_array_view(positions),
+              make_array_view(reference_positions),
+              current_particle_index);
+            current_particle_index += n_particles_in_cell;
           }
 
         particle_handler.update_cached_numbers();
@@ -490,12 +584,14 @@ namespace Particles
       for (const auto &cell : triangulation.active_cell_iterators() |
                                 IteratorFilters::LocallyOwnedCell())
         {
-          for (const auto &reference_location : particle_reference_locations)
-            {
-              const Point<spacedim> position_real =
-                mapping.transform_unit_to_real_cell(cell, reference_location);
-              points_to_generate.push_back(position_real);
-            }
+          const std::size_t n_points_so_far = points_to_generate.size();
+          points_to_generate.resize(n_points_so_far +
+                                    particle_reference_locations.size());
+          mapping.transform_points_unit_to_real_cell(
+            cell,
+            make_array_view(particle_reference_locations),
+            make_array_view(points_to_generate.begin() + n_points_so_far,
+                            points_to_generate.end()));
         }
       particle_handler.insert_global_particles(points_to_generate,
                                                global_bounding_boxes,
@@ -0,0 +1,187 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/particles/neighbor_list.h>
+
+#include <algorithm>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  NeighborList<dim, spacedim>::NeighborList()
+    : cutoff_radius(0.)
+    , skin(0.)
+  {}
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::reinit(
+    const GridTools::Cache<dim, spacedim> &cache,
+    const ParticleHandler<dim, spacedim>  &particle_handler,
+    const double                           cutoff_radius,
+    const double                           skin)
+  {
+    Assert(cutoff_radius > 0.,
+           ExcMessage("The cutoff radius must be positive."));
+    Assert(skin >= 0., ExcMessage("The skin must not be negative."));
+
+    this->particle_handler = &particle_handler;
+    this->cutoff_radius    = cutoff_radius;
+    this->skin             = skin;
+
+    const Triangulation<dim, spacedim> &triangulation =
+      cache.get_triangulation();
+
+    // Number the particles cell by cell, and remember the range of each cell
+    // in this numbering
+    particles.clear();
+    locations.clear();
+    std::vector<std::pair<unsigned int, unsigned int>> cell_particle_ranges(
+      triangulation.n_active_cells(), {0, 0});
+    for (const auto &cell : triangulation.active_cell_iterators())
+      if (!cell->is_artificial())
+        {
+          const unsigned int begin = particles.size();
+          const auto         particles_in_cell =
+            particle_handler.particles_in_cell(cell);
+          for (auto particle = particles_in_cell.begin();
+               particle != particles_in_cell.end();
+               ++particle)
+            {
+              particles.push_back(particle);
+              locations.push_back(particle->get_location());
+            }
+          cell_particle_ranges[cell->active_cell_index()] = {begin,
+                                                             particles.size()};
+        }
+    locations_at_reinit = locations;
+
+    // Collect the candidate pairs in the cell patches of the locally owned
+    // cells. The partners in the same cell are visited with j > i, the ones
+    // in locally owned neighbors only for neighbors with a larger index, and
+    // the ones in ghost cells always.
+    const std::vector<
+      std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
+      &vertex_to_cells = cache.get_vertex_to_cell_map();
+
+    const double candidate_radius_square =
+      (cutoff_radius + skin) * (cutoff_radius + skin);
+
+    candidate_first.clear();
+    candidate_second.clear();
+
+    std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+      neighbors;
+    for (const auto &cell : triangulation.active_cell_iterators())
+      if (cell->is_locally_owned())
+        {
+          const auto &own_range =
+            cell_particle_ranges[cell->active_cell_index()];
+          if (own_range.first == own_range.second)
+            continue;
+
+          Assert(cell->minimum_vertex_distance() >= cutoff_radius + skin,
+                 ExcMessage("The cutoff radius plus the skin must not exceed "
+                            "the size of the cells, since only the particles "
+                            "in the cells sharing a vertex are searched."));
+
+          neighbors.clear();
+          for (const unsigned int v : cell->vertex_indices())
+            for (const auto &neighbor : vertex_to_cells[cell->vertex_index(v)])
+              if (neighbor->is_locally_owned() ?
+                    neighbor->active_cell_index() > cell->active_cell_index() :
+                    !neighbor->is_artificial())
+                neighbors.push_back(neighbor);
+          std::sort(neighbors.begin(), neighbors.end());
+          neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                          neighbors.end());
+
+          for (unsigned int i = own_range.first; i < own_range.second; ++i)
+            {
+              for (unsigned int j = i + 1; j < own_range.second; ++j)
+                if (locations[i].distance_square(locations[j]) <
+                    candidate_radius_square)
+                  {
+                    candidate_first.push_back(i);
+                    candidate_second.push_back(j);
+                  }
+
+              for (const auto &neighbor : neighbors)
+                {
+                  const auto &range =
+                    cell_particle_ranges[neighbor->active_cell_index()];
+                  for (unsigned int j = range.first; j < range.second; ++j)
+                    if (locations[i].distance_square(locations[j]) <
+                        candidate_radius_square)
+                      {
+                        candidate_first.push_back(i);
+                        candidate_second.push_back(j);
+                      }
+                }
+            }
+        }
+
+    select_pairs();
+  }
+
+
+
+  template <int dim, int spacedim>
+  bool
+  NeighborList<dim, spacedim>::update()
+  {
+    Assert(particle_handler != nullptr,
+           ExcMessage("You need to call reinit() before update()."));
+
+    double max_displacement_square = 0.;
+    for (unsigned int i = 0; i < particles.size(); ++i)
+      {
+        locations[i]            = particles[i]->get_location();
+        max_displacement_square = std::max(
+          max_displacement_square,
+          locations[i].distance_square(locations_at_reinit[i]));
+      }
+
+    select_pairs();
+
+    return 4. * max_displacement_square <= skin * skin;
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  NeighborList<dim, spacedim>::select_pairs()
+  {
+    const double cutoff_radius_square = cutoff_radius * cutoff_radius;
+
+    pair_first.clear();
+    pair_second.clear();
+    for (unsigned int p = 0; p < candidate_first.size(); ++p)
+      if (locations[candidate_first[p]].distance_square(
+            locations[candidate_second[p]]) < cutoff_radius_square)
+        {
+          pair_first.push_back(candidate_first[p]);
+          pair_second.push_back(candidate_second[p]);
+        }
+  }
+} // namespace Particles
+
+#include "neighbor_list.inst"
+
+DEAL_II_NAMESPACE_CLOSE
@@ -12,6 +12,9 @@
 //
 // ------------------------------------------------------------------------
 
+#include <deal.II/base/memory_consumption.h>
+#include <deal.II/base/parallel.h>
+
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/grid/grid_tools_cache.h>
 
@@ -19,6 +22,7 @@
 
 #include <deal.II/particles/particle_handler.h>
 
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -569,6 +573,7 @@ namespace Particles
       }
 
     update_cached_numbers();
+    sort_particles_for_locality_if_fragmented();
   }
 
 
@@ -678,6 +683,52 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::insert_particles_in_cell(
+    const typename Triangulation<dim, spacedim>::active_cell_iterator &cell,
+    const ArrayView<const Point<spacedim>> &positions,
+    const ArrayView<const Point<dim>>      &reference_positions,
+    const types::particle_index             first_particle_index)
+  {
+    Assert(triangulation != nullptr, ExcInternalError());
+    Assert(cells_to_particle_cache.size() == triangulation->n_active_cells(),
+           ExcInternalError());
+    Assert(cell.state() == IteratorState::valid, ExcInternalError());
+    Assert(cell->is_locally_owned(),
+           ExcMessage("You tried to insert particles into a cell that is not "
+                      "locally owned. This is not supported."));
+    AssertDimension(positions.size(), reference_positions.size());
+
+    if (positions.empty())
+      return;
+
+    std::vector<typename PropertyPool<dim, spacedim>::Handle> handles(
+      positions.size());
+    property_pool->register_particles(make_array_view(handles));
+    for (unsigned int i = 0; i < handles.size(); ++i)
+      {
+        property_pool->set_location(handles[i], positions[i]);
+        property_pool->set_reference_location(handles[i],
+                                              reference_positions[i]);
+        property_pool->set_id(handles[i], first_particle_index + i);
+      }
+
+    // insert the first particle to create the entry of the cell if
+    // necessary, and append the others to it
+    insert_particle(handles[0], cell);
+    std::vector<typename PropertyPool<dim, spacedim>::Handle>
+      &particles_in_cell =
+        cells_to_particle_cache[cell->active_cell_index()]->particles;
+    particles_in_cell.insert(particles_in_cell.end(),
+                             handles.begin() + 1,
+                             handles.end());
+
+    number_of_locally_owned_particles += positions.size();
+  }
+
+
+
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::insert_particles(
@@ -690,6 +741,7 @@ namespace Particles
       insert_particle(cell_and_particle.second, cell_and_particle.first);
 
     update_cached_numbers();
+    sort_particles_for_locality_if_fragmented();
   }
 
 
@@ -754,6 +806,7 @@ namespace Particles
                         cells[i]);
 
     update_cached_numbers();
+    sort_particles_for_locality_if_fragmented();
   }
 
 
@@ -980,6 +1033,7 @@ namespace Particles
       }
 
     update_cached_numbers();
+    sort_particles_for_locality_if_fragmented();
 
     return original_process_to_local_particle_indices;
   }
@@ -1173,6 +1227,87 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::sort_particles_for_locality()
+  {
+    if (memory_fragmentation() == 0.)
+      return;
+
+    std::vector<typename PropertyPool<dim, spacedim>::Handle> unsorted_handles;
+    unsorted_handles.reserve(property_pool->n_registered_slots());
+
+    typename PropertyPool<dim, spacedim>::Handle sorted_handle = 0;
+    for (auto &particles_in_cell : particles)
+      for (auto &particle : particles_in_cell.particles)
+        {
+          unsorted_handles.push_back(particle);
+          particle = sorted_handle++;
+        }
+
+    property_pool->sort_memory_slots(unsorted_handles);
+  }
+
+
+
+  template <int dim, int spacedim>
+  double
+  ParticleHandler<dim, spacedim>::memory_fragmentation() const
+  {
+    const std::size_t n_slots = property_pool->n_slots();
+    if (n_slots == 0)
+      return 0.;
+
+    // count the particles that are stored directly behind their predecessor
+    // in the order of iteration, starting at slot zero
+    std::size_t n_particles_in_order = 0;
+    typename PropertyPool<dim, spacedim>::Handle expected_handle = 0;
+    for (const auto &particles_in_cell : particles)
+      for (const auto &particle : particles_in_cell.particles)
+        {
+          if (particle == expected_handle)
+            ++n_particles_in_order;
+          expected_handle = particle + 1;
+        }
+
+    return static_cast<double>(n_slots - n_particles_in_order) / n_slots;
+  }
+
+
+
+  template <int dim, int spacedim>
+  std::size_t
+  ParticleHandler<dim, spacedim>::memory_consumption() const
+  {
+    // every entry of the list is a separately allocated node that stores two
+    // pointers besides the entry itself
+    std::size_t particle_memory = 0;
+    for (const auto &particles_in_cell : particles)
+      particle_memory += sizeof(particles_in_cell) + 2 * sizeof(void *) +
+                         MemoryConsumption::memory_consumption(
+                           particles_in_cell.particles);
+
+    return sizeof(*this) + particle_memory +
+           cells_to_particle_cache.capacity() *
+             sizeof(typename particle_container::iterator) +
+           (property_pool ? property_pool->memory_consumption() : 0);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::sort_particles_for_locality_if_fragmented()
+  {
+    // Sorting costs about as much as a loop over all particle data, so only
+    // do it if a significant part of the memory would be accessed out of
+    // order otherwise
+    if (memory_fragmentation() > 0.1)
+      sort_particles_for_locality();
+  }
+
+
+
   namespace
   {
     /**
@@ -1207,8 +1342,21 @@ namespace Particles
   template <int dim, int spacedim>
   void
   ParticleHandler<dim, spacedim>::sort_particles_into_subdomains_and_cells()
+  {
+    start_particle_exchange();
+    finish_particle_exchange();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::start_particle_exchange()
   {
     Assert(triangulation != nullptr, ExcInternalError());
+    Assert(particle_exchange_data.in_progress == false,
+           ExcMessage("You need to call finish_particle_exchange() before "
+                      "starting a new particle exchange."));
     Assert(cells_to_particle_cache.size() == triangulation->n_active_cells(),
            ExcInternalError());
 
@@ -1220,56 +1368,73 @@ namespace Particles
     // TODO: Extend this function to allow keeping particles on other
     // processes around (with an invalid cell).
 
-    std::vector<particle_iterator> particles_out_of_cell;
-
-    // Reserve some space for particles that need sorting to avoid frequent
-    // re-allocation. Guess 25% of particles need sorting. Balance memory
-    // overhead and performance.
-    particles_out_of_cell.reserve(n_locally_owned_particles() / 4);
-
-    // Now update the reference locations of the moved particles
-    std::vector<Point<spacedim>> real_locations;
-    std::vector<Point<dim>>      reference_locations;
-    real_locations.reserve(global_max_particles_per_cell);
-    reference_locations.reserve(global_max_particles_per_cell);
+    // Collect the entries of the particle container that belong to locally
+    // owned cells, together with the position of their first particle in a
+    // consecutive numbering of all owned particles. Particles can be
+    // inserted into arbitrary cells, e.g. if their cell is not known.
+    // However, for artificial cells we can not evaluate the reference
+    // position of particles. Do not sort particles that are not locally
+    // owned, because they will be sorted by the process that owns them.
+    std::vector<typename particle_container::iterator> owned_cells;
+    std::vector<unsigned int>                          particle_offsets;
+    unsigned int                                       n_owned_particles = 0;
+    for (auto it = particle_container_owned_begin();
+         it != particle_container_owned_end();
+         ++it)
+      if (it->cell.state() == IteratorState::valid &&
+          it->cell->is_locally_owned() && !it->particles.empty())
+        {
+          owned_cells.push_back(it);
+          particle_offsets.push_back(n_owned_particles);
+          n_owned_particles += it->particles.size();
+        }
 
-    for (const auto &cell : triangulation->active_cell_iterators())
-      {
-        // Particles can be inserted into arbitrary cells, e.g. if their cell is
-        // not known. However, for artificial cells we can not evaluate
-        // the reference position of particles. Do not sort particles that are
-        // not locally owned, because they will be sorted by the process that
-        // owns them.
-        if (cell->is_locally_owned() == false)
+    // Update the reference locations of all particles in parallel and mark
+    // the particles that left their cell. The marks are stored per particle
+    // rather than in thread-local lists, so that the list of particles out
+    // of their cell collected below has the same order as in a serial run.
+    std::vector<std::uint8_t> is_out_of_cell(n_owned_particles, 0);
+    dealii::parallel::apply_to_subranges(
+      0U,
+      static_cast<unsigned int>(owned_cells.size()),
+      [&](const unsigned int begin, const unsigned int end) {
+        std::vector<Point<spacedim>> real_locations;
+        std::vector<Point<dim>>      reference_locations;
+
+        for (unsigned int c = begin; c < end; ++c)
           {
-            continue;
-          }
-
-        const unsigned int n_pic = n_particles_in_cell(cell);
-        auto               pic   = particles_in_cell(cell);
+            const auto &handles = owned_cells[c]->particles;
 
-        real_locations.clear();
-        for (const auto &particle : pic)
-          real_locations.push_back(particle.get_location());
+            real_locations.clear();
+            for (const auto handle : handles)
+              real_locations.push_back(property_pool->get_location(handle));
 
-        reference_locations.resize(n_pic);
-        mapping->transform_points_real_to_unit_cell(cell,
-                                                    real_locations,
-                                                    reference_locations);
-
-        auto particle = pic.begin();
-        for (const auto &p_unit : reference_locations)
-          {
-            if (numbers::is_finite(p_unit[0]) &&
-                GeometryInfo<dim>::is_inside_unit_cell(p_unit,
-                                                       tolerance_inside_cell))
-              particle->set_reference_location(p_unit);
-            else
-              particles_out_of_cell.push_back(particle);
+            reference_locations.resize(handles.size());
+            mapping->transform_points_real_to_unit_cell(owned_cells[c]->cell,
+                                                        real_locations,
+                                                        reference_locations);
 
-            ++particle;
+            for (unsigned int p = 0; p < handles.size(); ++p)
+              {
+                const Point<dim> &p_unit = reference_locations[p];
+                if (numbers::is_finite(p_unit[0]) &&
+                    GeometryInfo<dim>::is_inside_unit_cell(
+                      p_unit, tolerance_inside_cell))
+                  property_pool->set_reference_location(handles[p], p_unit);
+                else
+                  is_out_of_cell[particle_offsets[c] + p] = 1;
+              }
           }
-      }
+      },
+      16);
+
+    std::vector<particle_iterator> particles_out_of_cell;
+    for (unsigned int c = 0; c < owned_cells.size(); ++c)
+      for (unsigned int p = 0; p < owned_cells[c]->particles.size(); ++p)
+        if (is_out_of_cell[particle_offsets[c] + p] != 0)
+          particles_out_of_cell.emplace_back(owned_cells[c],
+                                             *property_pool,
+                                             p);
 
     // There are three reasons why a particle is not in its old cell:
     // It moved to another cell, to another subdomain or it left the mesh.
@@ -1289,8 +1454,6 @@ namespace Particles
     // approximate sizes for these vectors. If more space is needed an
     // automatic and relatively fast (compared to other parts of this
     // algorithm) re-allocation will happen.
-    using vector_size = typename std::vector<particle_iterator>::size_type;
-
     std::set<types::subdomain_id> ghost_owners;
     if (const auto parallel_triangulation =
           dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
@@ -1305,197 +1468,232 @@ namespace Particles
     for (const auto &ghost_owner : ghost_owners)
       moved_cells[ghost_owner].reserve(particles_out_of_cell.size() / 4);
 
-    {
-      // Create a map from vertices to adjacent cells using grid cache
-      const std::vector<
-        std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
-        &vertex_to_cells = triangulation_cache->get_vertex_to_cell_map();
-
-      // Create a corresponding map of vectors from vertex to cell center
-      // using grid cache
-      const std::vector<std::vector<Tensor<1, spacedim>>>
-        &vertex_to_cell_centers =
-          triangulation_cache->get_vertex_to_cell_centers_directions();
-
-      std::vector<unsigned int> search_order;
-
-      // Reuse these vectors below, but only with a single element.
-      // Avoid resizing for every particle.
-      Point<dim>      invalid_reference_point;
-      Point<spacedim> invalid_point;
-      invalid_reference_point[0] = std::numeric_limits<double>::infinity();
-      invalid_point[0]           = std::numeric_limits<double>::infinity();
-      reference_locations.resize(1, invalid_reference_point);
-      real_locations.resize(1, invalid_point);
-
-      // Find the cells that the particles moved to.
-      for (auto &out_particle : particles_out_of_cell)
-        {
-          // make a copy of the current cell, since we will modify the
-          // variable current_cell below, but we need the original in
-          // the case the particle is not found
-          auto current_cell = out_particle->get_surrounding_cell();
-
-          real_locations[0] = out_particle->get_location();
-
-          // Record if the new cell was found
-          bool found_cell = false;
-
-          // Check if the particle is in one of the old cell's neighbors
-          // that are adjacent to the closest vertex
-          const unsigned int closest_vertex =
-            GridTools::find_closest_vertex_of_cell<dim, spacedim>(
-              current_cell, out_particle->get_location(), *mapping);
-          const unsigned int closest_vertex_index =
-            current_cell->vertex_index(closest_vertex);
-
-          const auto &candidate_cells = vertex_to_cells[closest_vertex_index];
-          const unsigned int n_candidate_cells = candidate_cells.size();
-
-          // The order of searching through the candidate cells matters for
-          // performance reasons. Start with a simple order.
-          search_order.resize(n_candidate_cells);
-          for (unsigned int i = 0; i < n_candidate_cells; ++i)
-            search_order[i] = i;
-
-          // If the particle is not on a vertex, we can do better by
-          // sorting the candidate cells by alignment with
-          // the vertex_to_particle direction.
-          Tensor<1, spacedim> vertex_to_particle =
-            out_particle->get_location() - current_cell->vertex(closest_vertex);
-
-          // Only do this if the particle is not on a vertex, otherwise we
-          // cannot normalize
-          if (vertex_to_particle.norm_square() >
-              1e4 * std::numeric_limits<double>::epsilon() *
-                std::numeric_limits<double>::epsilon() *
-                vertex_to_cell_centers[closest_vertex_index][0].norm_square())
-            {
-              vertex_to_particle /= vertex_to_particle.norm();
-              const auto &vertex_to_cells =
-                vertex_to_cell_centers[closest_vertex_index];
-
-              std::sort(search_order.begin(),
-                        search_order.end(),
-                        [&vertex_to_particle,
-                         &vertex_to_cells](const unsigned int a,
-                                           const unsigned int b) {
-                          return compare_particle_association(
-                            a, b, vertex_to_particle, vertex_to_cells);
-                        });
-            }
+    if (!particles_out_of_cell.empty())
+      {
+        // Create a map from vertices to adjacent cells using grid cache
+        const std::vector<
+          std::set<typename Triangulation<dim, spacedim>::active_cell_iterator>>
+          &vertex_to_cells = triangulation_cache->get_vertex_to_cell_map();
+
+        // Create a corresponding map of vectors from vertex to cell center
+        // using grid cache
+        const std::vector<std::vector<Tensor<1, spacedim>>>
+          &vertex_to_cell_centers =
+            triangulation_cache->get_vertex_to_cell_centers_directions();
+
+        // For some clang-based compilers and boost versions the call to
+        // RTree::query doesn't compile. We use a slower implementation as
+        // workaround.
+        // This is fixed in boost in
+        // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
+#if defined(DEAL_II_WITH_BOOST_BUNDLED) ||                \
+  !(defined(__clang_major__) && __clang_major__ >= 16) || \
+  BOOST_VERSION >= 108100
+        // The cache builds its data structures on first access, which is not
+        // thread-safe, so do this before the parallel search below
+        const auto &used_vertices_rtree =
+          triangulation_cache->get_used_vertices_rtree();
+#endif
 
-          // Search all of the candidate cells according to the determined
-          // order. Most likely we will find the particle in them.
-          for (unsigned int i = 0; i < n_candidate_cells; ++i)
-            {
-              typename std::set<
-                typename Triangulation<dim, spacedim>::active_cell_iterator>::
-                const_iterator candidate_cell = candidate_cells.begin();
-
-              std::advance(candidate_cell, search_order[i]);
-              mapping->transform_points_real_to_unit_cell(*candidate_cell,
-                                                          real_locations,
-                                                          reference_locations);
-
-              if (GeometryInfo<dim>::is_inside_unit_cell(reference_locations[0],
-                                                         tolerance_inside_cell))
-                {
-                  current_cell = *candidate_cell;
-                  found_cell   = true;
-                  break;
-                }
-            }
+        // Find the cells that the particles moved to. The search only reads
+        // from the particles and the mesh, so it can be done in parallel.
+        // The results are stored per particle and applied in a serial loop
+        // below, which also takes care of the signals and of inserting the
+        // particles into their new cells.
+        std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>
+                                new_cells(particles_out_of_cell.size());
+        std::vector<Point<dim>> new_reference_locations(
+          particles_out_of_cell.size());
+
+        dealii::parallel::apply_to_subranges(
+          std::size_t(0),
+          particles_out_of_cell.size(),
+          [&](const std::size_t begin, const std::size_t end) {
+            std::vector<unsigned int> search_order;
+
+            // Reuse these vectors below, but only with a single element.
+            // Avoid resizing for every particle.
+            Point<dim>      invalid_reference_point;
+            Point<spacedim> invalid_point;
+            invalid_reference_point[0] =
+              std::numeric_limits<double>::infinity();
+            invalid_point[0] = std::numeric_limits<double>::infinity();
+            std::vector<Point<dim>> reference_locations(
+              1, invalid_reference_point);
+            std::vector<Point<spacedim>> real_locations(1, invalid_point);
+
+            for (std::size_t i = begin; i < end; ++i)
+              {
+                const particle_iterator &out_particle =
+                  particles_out_of_cell[i];
+                const auto current_cell = out_particle->get_surrounding_cell();
+
+                real_locations[0] = out_particle->get_location();
+
+                // Check if the particle is in one of the old cell's neighbors
+                // that are adjacent to the closest vertex
+                const unsigned int closest_vertex =
+                  GridTools::find_closest_vertex_of_cell<dim, spacedim>(
+                    current_cell, out_particle->get_location(), *mapping);
+                const unsigned int closest_vertex_index =
+                  current_cell->vertex_index(closest_vertex);
+
+                const auto &candidate_cells =
+                  vertex_to_cells[closest_vertex_index];
+                const unsigned int n_candidate_cells = candidate_cells.size();
+
+                // The order of searching through the candidate cells matters
+                // for performance reasons. Start with a simple order.
+                search_order.resize(n_candidate_cells);
+                for (unsigned int j = 0; j < n_candidate_cells; ++j)
+                  search_order[j] = j;
+
+                // If the particle is not on a vertex, we can do better by
+                // sorting the candidate cells by alignment with
+                // the vertex_to_particle direction.
+                Tensor<1, spacedim> vertex_to_particle =
+                  out_particle->get_location() -
+                  current_cell->vertex(closest_vertex);
+
+                // Only do this if the particle is not on a vertex, otherwise
+                // we cannot normalize
+                if (vertex_to_particle.norm_square() >
+                    1e4 * std::numeric_limits<double>::epsilon() *
+                      std::numeric_limits<double>::epsilon() *
+                      vertex_to_cell_centers[closest_vertex_index][0]
+                        .norm_square())
+                  {
+                    vertex_to_particle /= vertex_to_particle.norm();
+                    const auto &vertex_to_cells =
+                      vertex_to_cell_centers[closest_vertex_index];
+
+                    std::sort(search_order.begin(),
+                              search_order.end(),
+                              [&vertex_to_particle,
+                               &vertex_to_cells](const unsigned int a,
+                                                 const unsigned int b) {
+                                return compare_particle_association(
+                                  a, b, vertex_to_particle, vertex_to_cells);
+                              });
+                  }
 
-          // If we did not find a cell the particle is not in a neighbor of
-          // its old cell. Look for the new cell in the whole local domain.
-          // This case should be rare.
-          if (!found_cell)
-            {
-              // For some clang-based compilers and boost versions the call to
-              // RTree::query doesn't compile. We use a slower implementation as
-              // workaround.
-              // This is fixed in boost in
-              // https://github.com/boostorg/numeric_conversion/commit/50a1eae942effb0a9b90724323ef8f2a67e7984a
+                // Search all of the candidate cells according to the
+                // determined order. Most likely we will find the particle in
+                // them.
+                for (unsigned int j = 0; j < n_candidate_cells; ++j)
+                  {
+                    typename std::set<
+                      typename Triangulation<dim, spacedim>::
+                        active_cell_iterator>::const_iterator candidate_cell =
+                      candidate_cells.begin();
+
+                    std::advance(candidate_cell, search_order[j]);
+                    mapping->transform_points_real_to_unit_cell(
+                      *candidate_cell, real_locations, reference_locations);
+
+                    if (GeometryInfo<dim>::is_inside_unit_cell(
+                          reference_locations[0], tolerance_inside_cell))
+                      {
+                        new_cells[i]               = *candidate_cell;
+                        new_reference_locations[i] = reference_locations[0];
+                        break;
+                      }
+                  }
+
+                // If we did not find a cell the particle is not in a neighbor
+                // of its old cell. Look for the new cell in the whole local
+                // domain. This case should be rare.
+                if (new_cells[i].state() != IteratorState::valid)
+                  {
 #if defined(DEAL_II_WITH_BOOST_BUNDLED) ||                \
   !(defined(__clang_major__) && __clang_major__ >= 16) || \
   BOOST_VERSION >= 108100
 
-              std::vector<std::pair<Point<spacedim>, unsigned int>>
-                closest_vertex_in_domain;
-              triangulation_cache->get_used_vertices_rtree().query(
-                boost::geometry::index::nearest(out_particle->get_location(),
-                                                1),
-                std::back_inserter(closest_vertex_in_domain));
-
-              // We should have one and only one result
-              AssertDimension(closest_vertex_in_domain.size(), 1);
-              const unsigned int closest_vertex_index_in_domain =
-                closest_vertex_in_domain[0].second;
+                    std::vector<std::pair<Point<spacedim>, unsigned int>>
+                      closest_vertex_in_domain;
+                    used_vertices_rtree.query(
+                      boost::geometry::index::nearest(
+                        out_particle->get_location(), 1),
+                      std::back_inserter(closest_vertex_in_domain));
+
+                    // We should have one and only one result
+                    AssertDimension(closest_vertex_in_domain.size(), 1);
+                    const unsigned int closest_vertex_index_in_domain =
+                      closest_vertex_in_domain[0].second;
 #else
-              const unsigned int closest_vertex_index_in_domain =
-                GridTools::find_closest_vertex(*mapping,
-                                               *triangulation,
-                                               out_particle->get_location());
+                    const unsigned int closest_vertex_index_in_domain =
+                      GridTools::find_closest_vertex(
+                        *mapping, *triangulation, out_particle->get_location());
 #endif
 
-              // Search all of the cells adjacent to the closest vertex of the
-              // domain. Most likely we will find the particle in them.
-              for (const auto &cell :
-                   vertex_to_cells[closest_vertex_index_in_domain])
-                {
-                  mapping->transform_points_real_to_unit_cell(
-                    cell, real_locations, reference_locations);
-
-                  if (GeometryInfo<dim>::is_inside_unit_cell(
-                        reference_locations[0], tolerance_inside_cell))
-                    {
-                      current_cell = cell;
-                      found_cell   = true;
-                      break;
-                    }
-                }
-            }
+                    // Search all of the cells adjacent to the closest vertex
+                    // of the domain. Most likely we will find the particle in
+                    // them.
+                    for (const auto &cell :
+                         vertex_to_cells[closest_vertex_index_in_domain])
+                      {
+                        mapping->transform_points_real_to_unit_cell(
+                          cell, real_locations, reference_locations);
 
-          if (!found_cell)
-            {
-              // We can find no cell for this particle. It has left the
-              // domain due to an integration error or an open boundary.
-              // Signal the loss and move on.
-              signals.particle_lost(out_particle,
-                                    out_particle->get_surrounding_cell());
-              continue;
-            }
+                        if (GeometryInfo<dim>::is_inside_unit_cell(
+                              reference_locations[0], tolerance_inside_cell))
+                          {
+                            new_cells[i]               = cell;
+                            new_reference_locations[i] = reference_locations[0];
+                            break;
+                          }
+                      }
+                  }
+              }
+          },
+          32);
 
-          // If we are here, we found a cell and reference position for this
-          // particle
-          out_particle->set_reference_location(reference_locations[0]);
+        for (unsigned int i = 0; i < particles_out_of_cell.size(); ++i)
+          {
+            particle_iterator &out_particle = particles_out_of_cell[i];
+            const auto        &current_cell = new_cells[i];
 
-          // Reinsert the particle into our domain if we own its cell.
-          // Mark it for MPI transfer otherwise
-          if (current_cell->is_locally_owned())
-            {
-              typename PropertyPool<dim, spacedim>::Handle &old =
-                out_particle->particles_in_cell
-                  ->particles[out_particle->particle_index_within_cell];
+            if (current_cell.state() != IteratorState::valid)
+              {
+                // We can find no cell for this particle. It has left the
+                // domain due to an integration error or an open boundary.
+                // Signal the loss and move on.
+                signals.particle_lost(out_particle,
+                                      out_particle->get_surrounding_cell());
+                continue;
+              }
 
-              // Avoid deallocating the memory of this particle
-              const auto old_value = old;
-              old = PropertyPool<dim, spacedim>::invalid_handle;
+            // If we are here, we found a cell and reference position for this
+            // particle
+            out_particle->set_reference_location(new_reference_locations[i]);
 
-              // Allocate particle with the old handle
-              insert_particle(old_value, current_cell);
-            }
-          else
-            {
-              moved_particles[current_cell->subdomain_id()].push_back(
-                out_particle);
-              moved_cells[current_cell->subdomain_id()].push_back(current_cell);
-            }
-        }
-    }
+            // Reinsert the particle into our domain if we own its cell.
+            // Mark it for MPI transfer otherwise
+            if (current_cell->is_locally_owned())
+              {
+                typename PropertyPool<dim, spacedim>::Handle &old =
+                  out_particle->particles_in_cell
+                    ->particles[out_particle->particle_index_within_cell];
 
-    // Exchange particles between processors if we have more than one process
+                // Avoid deallocating the memory of this particle
+                const auto old_value = old;
+                old = PropertyPool<dim, spacedim>::invalid_handle;
+
+                // Allocate particle with the old handle
+                insert_particle(old_value, current_cell);
+              }
+            else
+              {
+                moved_particles[current_cell->subdomain_id()].push_back(
+                  out_particle);
+                moved_cells[current_cell->subdomain_id()].push_back(
+                  current_cell);
+              }
+          }
+      }
+
+    // Start to exchange particles between processors if we have more than
+    // one process
 #ifdef DEAL_II_WITH_MPI
     if (const auto parallel_triangulation =
           dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
@@ -1503,28 +1701,44 @@ namespace Particles
       {
         if (dealii::Utilities::MPI::n_mpi_processes(
               parallel_triangulation->get_communicator()) > 1)
-          send_recv_particles(moved_particles, moved_cells);
+          send_recv_particles_start(moved_particles, moved_cells, false);
       }
 #endif
 
-    // remove_particles also calls update_cached_numbers()
-    remove_particles(particles_out_of_cell);
+    particle_exchange_data.particles_to_remove =
+      std::move(particles_out_of_cell);
+    particle_exchange_data.in_progress = true;
+  }
 
-    // now make sure particle data is sorted in order of iteration
-    std::vector<typename PropertyPool<dim, spacedim>::Handle> unsorted_handles;
-    unsorted_handles.reserve(property_pool->n_registered_slots());
 
-    typename PropertyPool<dim, spacedim>::Handle sorted_handle = 0;
-    for (auto &particles_in_cell : particles)
-      for (auto &particle : particles_in_cell.particles)
-        {
-          unsorted_handles.push_back(particle);
-          particle = sorted_handle++;
-        }
 
-    property_pool->sort_memory_slots(unsorted_handles);
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::finish_particle_exchange()
+  {
+    Assert(particle_exchange_data.in_progress,
+           ExcMessage("You need to call start_particle_exchange() before "
+                      "finish_particle_exchange()."));
+
+#ifdef DEAL_II_WITH_MPI
+    if (const auto parallel_triangulation =
+          dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+            &*triangulation))
+      {
+        if (dealii::Utilities::MPI::n_mpi_processes(
+              parallel_triangulation->get_communicator()) > 1)
+          send_recv_particles_finish();
+      }
+#endif
 
-  } // namespace Particles
+    // remove_particles also calls update_cached_numbers()
+    remove_particles(particle_exchange_data.particles_to_remove);
+    particle_exchange_data.particles_to_remove.clear();
+    particle_exchange_data.in_progress = false;
+
+    // now make sure particle data is sorted in order of iteration
+    sort_particles_for_locality();
+  }
 
 
 
@@ -1680,12 +1894,34 @@ namespace Particles
       std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>>
               &send_cells,
     const bool build_cache)
+  {
+    send_recv_particles_start(particles_to_send, send_cells, build_cache);
+    send_recv_particles_finish();
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::send_recv_particles_start(
+    const std::map<types::subdomain_id, std::vector<particle_iterator>>
+      &particles_to_send,
+    const std::map<
+      types::subdomain_id,
+      std::vector<typename Triangulation<dim, spacedim>::active_cell_iterator>>
+              &send_cells,
+    const bool build_cache)
   {
     Assert(triangulation != nullptr, ExcInternalError());
     Assert(cells_to_particle_cache.size() == triangulation->n_active_cells(),
            ExcInternalError());
 
+    auto &exchange = particle_exchange_data;
+    Assert(exchange.n_requests.empty() && exchange.send_requests.empty(),
+           ExcMessage("A particle exchange is already in progress."));
+
     ghost_particles_cache.valid = build_cache;
+    exchange.build_cache        = build_cache;
 
     const auto parallel_triangulation =
       dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
@@ -1697,9 +1933,9 @@ namespace Particles
     // Determine the communication pattern
     const std::set<types::subdomain_id> ghost_owners =
       parallel_triangulation->ghost_owners();
-    const std::vector<types::subdomain_id> neighbors(ghost_owners.begin(),
-                                                     ghost_owners.end());
-    const unsigned int                     n_neighbors = neighbors.size();
+    exchange.neighbors.assign(ghost_owners.begin(), ghost_owners.end());
+    const std::vector<types::subdomain_id> &neighbors   = exchange.neighbors;
+    const unsigned int                      n_neighbors = neighbors.size();
 
     if (send_cells.size() != 0)
       Assert(particles_to_send.size() == send_cells.size(), ExcInternalError());
@@ -1728,9 +1964,12 @@ namespace Particles
 
     // Containers for the amount and offsets of data we will send
     // to other processors and the data itself.
-    std::vector<unsigned int> n_send_data(n_neighbors, 0);
-    std::vector<unsigned int> send_offsets(n_neighbors, 0);
-    std::vector<char>         send_data;
+    std::vector<unsigned int> &n_send_data  = exchange.n_send_data;
+    std::vector<unsigned int> &send_offsets = exchange.send_offsets;
+    std::vector<char>         &send_data    = exchange.send_data;
+    n_send_data.assign(n_neighbors, 0);
+    send_offsets.assign(n_neighbors, 0);
+    send_data.clear();
 
     Particle<dim, spacedim> test_particle;
     test_particle.set_property_pool(*property_pool);
@@ -1797,18 +2036,20 @@ namespace Particles
           }
       }
 
-    // Containers for the data we will receive from other processors
-    std::vector<unsigned int> n_recv_data(n_neighbors);
-    std::vector<unsigned int> recv_offsets(n_neighbors);
-
+    // Post the exchange of the number of particles, and the sends of the
+    // particle data, which do not depend on what we receive. The receives of
+    // the particle data are posted in send_recv_particles_finish() once the
+    // sizes are known.
+    exchange.n_recv_data.assign(n_neighbors, 0);
     {
       const int mpi_tag = Utilities::MPI::internal::Tags::
         particle_handler_send_recv_particles_setup;
 
-      std::vector<MPI_Request> n_requests(2 * n_neighbors);
+      std::vector<MPI_Request> &n_requests = exchange.n_requests;
+      n_requests.resize(2 * n_neighbors);
       for (unsigned int i = 0; i < n_neighbors; ++i)
         {
-          const int ierr = MPI_Irecv(&(n_recv_data[i]),
+          const int ierr = MPI_Irecv(&(exchange.n_recv_data[i]),
                                      1,
                                      MPI_UNSIGNED,
                                      neighbors[i],
@@ -1828,13 +2069,74 @@ namespace Particles
                                      &(n_requests[2 * i + 1]));
           AssertThrowMPI(ierr);
         }
-      const int ierr =
-        MPI_Waitall(2 * n_neighbors, n_requests.data(), MPI_STATUSES_IGNORE);
+    }
+
+    {
+      const int mpi_tag = Utilities::MPI::internal::Tags::
+        particle_handler_send_recv_particles_send;
+
+      exchange.send_requests.clear();
+      for (unsigned int i = 0; i < n_neighbors; ++i)
+        if (n_send_data[i] > 0)
+          {
+            exchange.send_requests.emplace_back();
+            const int ierr =
+              MPI_Isend(&(send_data[send_offsets[i]]),
+                        n_send_data[i] * individual_total_particle_data_size,
+                        MPI_CHAR,
+                        neighbors[i],
+                        mpi_tag,
+                        parallel_triangulation->get_communicator(),
+                        &(exchange.send_requests.back()));
+            AssertThrowMPI(ierr);
+          }
+    }
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  ParticleHandler<dim, spacedim>::send_recv_particles_finish()
+  {
+    auto &exchange = particle_exchange_data;
+
+    const auto parallel_triangulation =
+      dynamic_cast<const parallel::TriangulationBase<dim, spacedim> *>(
+        &*triangulation);
+    Assert(parallel_triangulation,
+           ExcMessage("This function is only implemented for "
+                      "parallel::TriangulationBase objects."));
+
+    const std::vector<types::subdomain_id> &neighbors   = exchange.neighbors;
+    const unsigned int                      n_neighbors = neighbors.size();
+    const std::vector<unsigned int>        &n_send_data = exchange.n_send_data;
+    const std::vector<unsigned int>        &n_recv_data = exchange.n_recv_data;
+    const bool build_cache = exchange.build_cache;
+
+    const unsigned int cellid_size = sizeof(CellId::binary_type);
+
+    Particle<dim, spacedim> test_particle;
+    test_particle.set_property_pool(*property_pool);
+
+    const unsigned int individual_particle_data_size =
+      test_particle.serialized_size_in_bytes() +
+      (size_callback ? size_callback() : 0);
+
+    const unsigned int individual_total_particle_data_size =
+      individual_particle_data_size + cellid_size;
+
+    {
+      const int ierr = MPI_Waitall(exchange.n_requests.size(),
+                                   exchange.n_requests.data(),
+                                   MPI_STATUSES_IGNORE);
       AssertThrowMPI(ierr);
+      exchange.n_requests.clear();
     }
 
     // Determine how many particles and data we will receive
-    unsigned int total_recv_data = 0;
+    std::vector<unsigned int> recv_offsets(n_neighbors);
+    unsigned int              total_recv_data = 0;
     for (unsigned int neighbor_id = 0; neighbor_id < n_neighbors; ++neighbor_id)
       {
         recv_offsets[neighbor_id] = total_recv_data;
@@ -1845,11 +2147,11 @@ namespace Particles
     // Set up the space for the received particle data
     std::vector<char> recv_data(total_recv_data);
 
-    // Exchange the particle data between domains
+    // Receive the particle data and wait for the sends posted in
+    // send_recv_particles_start()
     {
-      std::vector<MPI_Request> requests(2 * n_neighbors);
-      unsigned int             send_ops = 0;
-      unsigned int             recv_ops = 0;
+      std::vector<MPI_Request> requests;
+      requests.reserve(n_neighbors);
 
       const int mpi_tag = Utilities::MPI::internal::Tags::
         particle_handler_send_recv_particles_send;
@@ -1857,6 +2159,7 @@ namespace Particles
       for (unsigned int i = 0; i < n_neighbors; ++i)
         if (n_recv_data[i] > 0)
           {
+            requests.emplace_back();
             const int ierr =
               MPI_Irecv(&(recv_data[recv_offsets[i]]),
                         n_recv_data[i] * individual_total_particle_data_size,
@@ -1864,28 +2167,18 @@ namespace Particles
                         neighbors[i],
                         mpi_tag,
                         parallel_triangulation->get_communicator(),
-                        &(requests[send_ops]));
+                        &(requests.back()));
             AssertThrowMPI(ierr);
-            ++send_ops;
           }
 
-      for (unsigned int i = 0; i < n_neighbors; ++i)
-        if (n_send_data[i] > 0)
-          {
-            const int ierr =
-              MPI_Isend(&(send_data[send_offsets[i]]),
-                        n_send_data[i] * individual_total_particle_data_size,
-                        MPI_CHAR,
-                        neighbors[i],
-                        mpi_tag,
-                        parallel_triangulation->get_communicator(),
-                        &(requests[send_ops + recv_ops]));
-            AssertThrowMPI(ierr);
-            ++recv_ops;
-          }
+      requests.insert(requests.end(),
+                      exchange.send_requests.begin(),
+                      exchange.send_requests.end());
       const int ierr =
-        MPI_Waitall(send_ops + recv_ops, requests.data(), MPI_STATUSES_IGNORE);
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
       AssertThrowMPI(ierr);
+      exchange.send_requests.clear();
+      exchange.send_data.clear();
     }
 
     // Put the received particles into the domain if they are in the
@@ -2299,6 +2592,7 @@ namespace Particles
         // Reset handle and update global numbers.
         handle = numbers::invalid_unsigned_int;
         update_cached_numbers();
+        sort_particles_for_locality_if_fragmented();
       }
   }
 
@@ -0,0 +1,276 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/tensor_product_polynomials.h>
+
+#include <deal.II/fe/fe_poly.h>
+
+#include <deal.II/grid/filtered_iterator.h>
+
+#include <deal.II/matrix_free/shape_info.h>
+
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/portable_particle_data.h>
+
+DEAL_II_NAMESPACE_OPEN
+
+namespace Particles
+{
+  template <int dim, int spacedim>
+  void
+  PortableParticleData<dim, spacedim>::copy_from_host(
+    const ParticleHandler<dim, spacedim> &particle_handler)
+  {
+    const unsigned int n_particles =
+      particle_handler.n_locally_owned_particles();
+    const unsigned int n_properties =
+      particle_handler.n_properties_per_particle();
+
+    Kokkos::realloc(locations, n_particles);
+    Kokkos::realloc(reference_locations, n_particles);
+    Kokkos::realloc(ids, n_particles);
+    Kokkos::realloc(cell_indices, n_particles);
+    Kokkos::realloc(properties, n_particles, n_properties);
+
+    auto locations_host           = Kokkos::create_mirror_view(locations);
+    auto reference_locations_host = Kokkos::create_mirror_view(
+      reference_locations);
+    auto ids_host          = Kokkos::create_mirror_view(ids);
+    auto cell_indices_host = Kokkos::create_mirror_view(cell_indices);
+    auto properties_host   = Kokkos::create_mirror_view(properties);
+
+    PropertyPool<dim, spacedim> &property_pool =
+      particle_handler.get_property_pool();
+    const bool is_property_major =
+      property_pool.get_property_layout() ==
+      PropertyPool<dim, spacedim>::PropertyLayout::property_major;
+
+    unsigned int p = 0;
+    for (const auto &particle : particle_handler)
+      {
+        const Point<spacedim> &location = particle.get_location();
+        for (unsigned int d = 0; d < spacedim; ++d)
+          locations_host(p, d) = location[d];
+        const Point<dim> &reference_location =
+          particle.get_reference_location();
+        for (unsigned int d = 0; d < dim; ++d)
+          reference_locations_host(p, d) = reference_location[d];
+        ids_host(p) = particle.get_id();
+        cell_indices_host(p) =
+          particle.get_surrounding_cell()->active_cell_index();
+
+        const auto handle = particle.get_handle();
+        for (unsigned int i = 0; i < n_properties; ++i)
+          if (is_property_major)
+            properties_host(p, i) =
+              property_pool.get_property_values(i)[handle];
+          else
+            properties_host(p, i) = property_pool.get_properties(handle)[i];
+        ++p;
+      }
+    AssertDimension(p, n_particles);
+
+    Kokkos::deep_copy(locations, locations_host);
+    Kokkos::deep_copy(reference_locations, reference_locations_host);
+    Kokkos::deep_copy(ids, ids_host);
+    Kokkos::deep_copy(cell_indices, cell_indices_host);
+    Kokkos::deep_copy(properties, properties_host);
+  }
+
+
+
+  template <int dim, int spacedim>
+  void
+  PortableParticleData<dim, spacedim>::copy_to_host(
+    ParticleHandler<dim, spacedim> &particle_handler) const
+  {
+    AssertDimension(particle_handler.n_locally_owned_particles(),
+                    n_particles());
+    AssertDimension(particle_handler.n_properties_per_particle(),
+                    properties.extent(1));
+
+    const auto locations_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), locations);
+    const auto properties_host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), properties);
+
+    PropertyPool<dim, spacedim> &property_pool =
+      particle_handler.get_property_pool();
+    const bool is_property_major =
+      property_pool.get_property_layout() ==
+      PropertyPool<dim, spacedim>::PropertyLayout::property_major;
+    const unsigned int n_properties = properties.extent(1);
+
+    unsigned int p = 0;
+    for (auto &particle : particle_handler)
+      {
+        Point<spacedim> location;
+        for (unsigned int d = 0; d < spacedim; ++d)
+          location[d] = locations_host(p, d);
+        particle.set_location(location);
+
+        const auto handle = particle.get_handle();
+        for (unsigned int i = 0; i < n_properties; ++i)
+          if (is_property_major)
+            property_pool.get_property_values(i)[handle] =
+              properties_host(p, i);
+          else
+            property_pool.get_properties(handle)[i] = properties_host(p, i);
+        ++p;
+      }
+  }
+
+
+
+  template <int dim, int spacedim, typename Number>
+  void
+  PortableFieldInterpolation<dim, spacedim, Number>::reinit(
+    const DoFHandler<dim, spacedim>                          &dof_handler,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+  {
+    const FiniteElement<dim, spacedim> &fe = dof_handler.get_fe();
+    Assert(fe.n_base_elements() == 1,
+           ExcMessage("Only finite elements with a single base element are "
+                      "supported."));
+    const auto fe_poly =
+      dynamic_cast<const FE_Poly<dim, spacedim> *>(&fe.base_element(0));
+    AssertThrow(fe_poly != nullptr &&
+                  dynamic_cast<const TensorProductPolynomials<dim> *>(
+                    &fe_poly->get_poly_space()) != nullptr &&
+                  fe.has_support_points(),
+                ExcMessage("Only tensor product elements of Lagrange type are "
+                           "supported."));
+
+    const dealii::internal::MatrixFreeFunctions::ShapeInfo<double>
+      shape_info(QGauss<1>(1), fe);
+    const unsigned int n_shape_functions_1d = shape_info.data[0].fe_degree + 1;
+    AssertIndexRange(n_shape_functions_1d, max_n_shape_functions_1d + 1);
+
+    n_components = fe.n_components();
+
+    // The 1d support points are the first coordinates of the support points
+    // of the first row of degrees of freedom in lexicographic order, and
+    // define the 1d Lagrange polynomials in barycentric form
+    Kokkos::realloc(support_points_1d, n_shape_functions_1d);
+    Kokkos::realloc(lagrange_weights_1d, n_shape_functions_1d);
+    auto support_points_1d_host = Kokkos::create_mirror_view(support_points_1d);
+    auto lagrange_weights_1d_host =
+      Kokkos::create_mirror_view(lagrange_weights_1d);
+    for (unsigned int i = 0; i < n_shape_functions_1d; ++i)
+      support_points_1d_host(i) =
+        fe.unit_support_point(shape_info.lexicographic_numbering[i])[0];
+    for (unsigned int i = 0; i < n_shape_functions_1d; ++i)
+      {
+        double denominator = 1.;
+        for (unsigned int j = 0; j < n_shape_functions_1d; ++j)
+          if (j != i)
+            denominator *=
+              support_points_1d_host(i) - support_points_1d_host(j);
+        lagrange_weights_1d_host(i) = 1. / denominator;
+      }
+    Kokkos::deep_copy(support_points_1d, support_points_1d_host);
+    Kokkos::deep_copy(lagrange_weights_1d, lagrange_weights_1d_host);
+
+    const unsigned int dofs_per_cell = fe.n_dofs_per_cell();
+    Kokkos::realloc(dof_indices,
+                    dof_handler.get_triangulation().n_active_cells(),
+                    dofs_per_cell);
+    auto dof_indices_host = Kokkos::create_mirror_view(dof_indices);
+
+    std::vector<types::global_dof_index> local_dof_indices(dofs_per_cell);
+    for (const auto &cell : dof_handler.active_cell_iterators() |
+                              IteratorFilters::LocallyOwnedCell())
+      {
+        cell->get_dof_indices(local_dof_indices);
+        for (unsigned int i = 0; i < dofs_per_cell; ++i)
+          dof_indices_host(cell->active_cell_index(), i) =
+            partitioner->global_to_local(
+              local_dof_indices[shape_info.lexicographic_numbering[i]]);
+      }
+    Kokkos::deep_copy(dof_indices, dof_indices_host);
+  }
+
+
+
+  template <int dim, int spacedim, typename Number>
+  void
+  PortableFieldInterpolation<dim, spacedim, Number>::interpolate(
+    const PortableParticleData<dim, spacedim> &particle_data,
+    const LinearAlgebra::distributed::Vector<Number, MemorySpace::Default>
+                                                              &field,
+    Kokkos::View<Number **, Kokkos::LayoutLeft, kokkos_space> &values) const
+  {
+    const unsigned int n_particles = particle_data.n_particles();
+    if (values.extent(0) != n_particles || values.extent(1) != n_components)
+      Kokkos::realloc(values, n_particles, n_components);
+
+    const unsigned int n_shape_functions_1d = support_points_1d.extent(0);
+    const unsigned int dofs_per_component =
+      Utilities::pow(n_shape_functions_1d, dim);
+
+    // copy the members used in the kernel so that the lambda does not
+    // capture 'this'
+    const unsigned int n_components        = this->n_components;
+    const auto         support_points_1d   = this->support_points_1d;
+    const auto         lagrange_weights_1d = this->lagrange_weights_1d;
+    const auto         dof_indices         = this->dof_indices;
+    const auto reference_locations = particle_data.reference_locations;
+    const auto cell_indices        = particle_data.cell_indices;
+    const Number *field_values     = field.get_values();
+
+    Kokkos::parallel_for(
+      "dealii::Particles::PortableFieldInterpolation::interpolate",
+      Kokkos::RangePolicy<kokkos_space::execution_space>(0, n_particles),
+      KOKKOS_LAMBDA(const int p) {
+        // values of the 1d Lagrange polynomials in each direction
+        Number shape_values[dim][max_n_shape_functions_1d];
+        for (unsigned int d = 0; d < dim; ++d)
+          for (unsigned int i = 0; i < n_shape_functions_1d; ++i)
+            {
+              Number value = lagrange_weights_1d(i);
+              for (unsigned int j = 0; j < n_shape_functions_1d; ++j)
+                if (j != i)
+                  value *= reference_locations(p, d) - support_points_1d(j);
+              shape_values[d][i] = value;
+            }
+
+        const unsigned int cell = cell_indices(p);
+        for (unsigned int c = 0; c < n_components; ++c)
+          {
+            Number result = 0;
+            for (unsigned int i = 0; i < dofs_per_component; ++i)
+              {
+                Number       shape_value = 1;
+                unsigned int index       = i;
+                for (unsigned int d = 0; d < dim; ++d)
+                  {
+                    shape_value *=
+                      shape_values[d][index % n_shape_functions_1d];
+                    index /= n_shape_functions_1d;
+                  }
+                result +=
+                  shape_value *
+                  field_values[dof_indices(cell, c * dofs_per_component + i)];
+              }
+            values(p, c) = result;
+          }
+      });
+  }
+} // namespace Particles
+
+#include "portable_particle_data.inst"
+
+DEAL_II_NAMESPACE_CLOSE
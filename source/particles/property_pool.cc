@@ -13,6 +13,7 @@
 // ------------------------------------------------------------------------
 
 
+#include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/signaling_nan.h>
 
 #include <deal.II/particles/property_pool.h>
@@ -31,6 +32,7 @@ namespace Particles
   PropertyPool<dim, spacedim>::PropertyPool(
     const unsigned int n_properties_per_slot)
     : n_properties(n_properties_per_slot)
+    , property_layout(PropertyLayout::particle_major)
   {}
 
 
@@ -95,6 +97,15 @@ namespace Particles
         reference_locations.resize(reference_locations.size() + 1);
         ids.resize(ids.size() + 1);
         properties.resize(properties.size() + n_properties);
+
+        // in property-major layout, the values of all properties but the
+        // first one have to be moved to make room for the new slot. start
+        // with the last property so that no values are overwritten.
+        if (property_layout == PropertyLayout::property_major)
+          for (unsigned int p = n_properties; p-- > 1;)
+            std::copy_backward(properties.begin() + p * handle,
+                               properties.begin() + (p + 1) * handle,
+                               properties.begin() + (p + 1) * handle + p);
       }
 
     // Then initialize whatever slot we have taken with invalid locations,
@@ -102,14 +113,64 @@ namespace Particles
     set_location(handle, numbers::signaling_nan<Point<spacedim>>());
     set_reference_location(handle, numbers::signaling_nan<Point<dim>>());
     set_id(handle, numbers::invalid_unsigned_int);
-    for (double &x : get_properties(handle))
-      x = 0;
+    for (unsigned int p = 0; p < n_properties; ++p)
+      properties[property_position(handle, p)] = 0;
 
     return handle;
   }
 
 
 
+  template <int dim, int spacedim>
+  void
+  PropertyPool<dim, spacedim>::register_particles(
+    const ArrayView<Handle> &handles)
+  {
+    // First re-use available handles, in the same order as
+    // register_particle() would
+    const std::size_t n_reused =
+      std::min(handles.size(), currently_available_handles.size());
+    for (std::size_t i = 0; i < n_reused; ++i)
+      {
+        handles[i] = currently_available_handles.back();
+        currently_available_handles.pop_back();
+      }
+
+    // Then append all further slots at once
+    const std::size_t n_new_slots = handles.size() - n_reused;
+    if (n_new_slots > 0)
+      {
+        const std::size_t n_old_slots = locations.size();
+
+        locations.resize(n_old_slots + n_new_slots);
+        reference_locations.resize(n_old_slots + n_new_slots);
+        ids.resize(n_old_slots + n_new_slots);
+        properties.resize(properties.size() + n_new_slots * n_properties);
+
+        // see register_particle() for the property-major layout
+        if (property_layout == PropertyLayout::property_major)
+          for (unsigned int p = n_properties; p-- > 1;)
+            std::copy_backward(properties.begin() + p * n_old_slots,
+                               properties.begin() + (p + 1) * n_old_slots,
+                               properties.begin() + (p + 1) * n_old_slots +
+                                 p * n_new_slots);
+
+        for (std::size_t i = 0; i < n_new_slots; ++i)
+          handles[n_reused + i] = n_old_slots + i;
+      }
+
+    for (const Handle handle : handles)
+      {
+        set_location(handle, numbers::signaling_nan<Point<spacedim>>());
+        set_reference_location(handle, numbers::signaling_nan<Point<dim>>());
+        set_id(handle, numbers::invalid_unsigned_int);
+        for (unsigned int p = 0; p < n_properties; ++p)
+          properties[property_position(handle, p)] = 0;
+      }
+  }
+
+
+
   template <int dim, int spacedim>
   void
   PropertyPool<dim, spacedim>::deregister_particle(Handle &handle)
@@ -156,6 +217,40 @@ namespace Particles
 
 
 
+  template <int dim, int spacedim>
+  void
+  PropertyPool<dim, spacedim>::set_property_layout(const PropertyLayout layout)
+  {
+    if (layout == property_layout)
+      return;
+
+    // transpose in blocks of slots that fit into cache, and keep the
+    // capacity reserved for further particles
+    const std::size_t      n_all_slots = locations.size();
+    constexpr unsigned int block_size  = 256;
+    std::vector<double>    new_properties;
+    new_properties.reserve(properties.capacity());
+    new_properties.resize(properties.size());
+    for (std::size_t block = 0; block < n_all_slots; block += block_size)
+      {
+        const std::size_t end = std::min<std::size_t>(block + block_size,
+                                                      n_all_slots);
+        for (unsigned int p = 0; p < n_properties; ++p)
+          for (std::size_t handle = block; handle < end; ++handle)
+            if (layout == PropertyLayout::property_major)
+              new_properties[p * n_all_slots + handle] =
+                properties[handle * n_properties + p];
+            else
+              new_properties[handle * n_properties + p] =
+                properties[p * n_all_slots + handle];
+      }
+    properties.swap(new_properties);
+
+    property_layout = layout;
+  }
+
+
+
   template <int dim, int spacedim>
   unsigned int
   PropertyPool<dim, spacedim>::n_properties_per_slot() const
@@ -211,10 +306,17 @@ namespace Particles
         sorted_reference_locations.push_back(reference_locations[handle]);
         sorted_ids.push_back(ids[handle]);
 
-        for (unsigned int j = 0; j < n_properties; ++j)
-          sorted_properties.push_back(properties[handle * n_properties + j]);
+        if (property_layout == PropertyLayout::particle_major)
+          for (unsigned int j = 0; j < n_properties; ++j)
+            sorted_properties.push_back(properties[handle * n_properties + j]);
       }
 
+    // in property-major layout, sort the values of one property at a time
+    if (property_layout == PropertyLayout::property_major)
+      for (unsigned int j = 0; j < n_properties; ++j)
+        for (const auto &handle : handles_to_sort)
+          sorted_properties.push_back(properties[property_position(handle, j)]);
+
     Assert(sorted_locations.size() ==
              locations.size() - currently_available_handles.size(),
            ExcMessage("Number of sorted property handles is not equal to "
@@ -232,6 +334,19 @@ namespace Particles
   }
 
 
+
+  template <int dim, int spacedim>
+  std::size_t
+  PropertyPool<dim, spacedim>::memory_consumption() const
+  {
+    return sizeof(*this) + MemoryConsumption::memory_consumption(locations) +
+           MemoryConsumption::memory_consumption(reference_locations) +
+           MemoryConsumption::memory_consumption(ids) +
+           MemoryConsumption::memory_consumption(properties) +
+           MemoryConsumption::memory_consumption(currently_available_handles);
+  }
+
+
   // Instantiate the class for all reasonable template arguments
   template class PropertyPool<1, 1>;
   template class PropertyPool<1, 2>;
@@ -0,0 +1,202 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+#ifndef dealii_performance_test_driver_h
+#define dealii_performance_test_driver_h
+
+// A common driver for the performance tests. Each test provides the two
+// functions
+//
+//   std::tuple<Metric, unsigned int, std::vector<std::string>>
+//   describe_measurements();
+//
+//   Measurement
+//   perform_single_measurement();
+//
+// where the first one returns the metric used, the number of repetitions,
+// and the names of the measured quantities, and the second one performs one
+// repetition and returns one value per name. The driver runs all
+// repetitions and prints a JSON object with the statistics of each quantity
+// on rank 0, which is collected by the script collect_measurements.
+
+#include <deal.II/base/timer.h>
+
+#include "../tests.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#define PERFORMANCE_TEST_STRINGIFY_(x) #x
+#define PERFORMANCE_TEST_STRINGIFY(x) PERFORMANCE_TEST_STRINGIFY_(x)
+
+/**
+ * The size of the problems to run, selected by the TESTING_ENVIRONMENT
+ * variable of the testsuite.
+ */
+enum class TestingEnvironment
+{
+  light,
+  medium,
+  heavy
+};
+
+/**
+ * The metric of the measured quantities.
+ */
+enum class Metric
+{
+  /**
+   * Wall time in seconds.
+   */
+  timing
+};
+
+/**
+ * The values of one repetition, one per measured quantity.
+ */
+using Measurement = std::vector<double>;
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements();
+
+Measurement
+perform_single_measurement();
+
+
+
+TestingEnvironment
+get_testing_environment()
+{
+#ifdef TESTING_ENVIRONMENT
+  const std::string environment =
+    PERFORMANCE_TEST_STRINGIFY(TESTING_ENVIRONMENT);
+#else
+  const std::string environment = "light";
+#endif
+
+  if (environment == "medium")
+    return TestingEnvironment::medium;
+  else if (environment == "heavy")
+    return TestingEnvironment::heavy;
+  else
+    return TestingEnvironment::light;
+}
+
+
+
+/**
+ * Return the number of repetitions appropriate for the testing environment.
+ */
+unsigned int
+default_n_repetitions()
+{
+  switch (get_testing_environment())
+    {
+      case TestingEnvironment::light:
+        return 4;
+      case TestingEnvironment::medium:
+        return 8;
+      case TestingEnvironment::heavy:
+        return 16;
+    }
+  return 4;
+}
+
+
+
+/**
+ * Run @p function @p n_calls times and return the average wall time of a
+ * call, taking the maximum over all processes of @p comm.
+ */
+template <typename Function>
+double
+time_average(const Function    &function,
+             const unsigned int n_calls,
+             const MPI_Comm     comm = MPI_COMM_WORLD)
+{
+  // warm up caches and lazily set up data structures
+  function();
+
+  Timer timer(comm, true);
+  for (unsigned int i = 0; i < n_calls; ++i)
+    function();
+  timer.stop();
+  return timer.get_last_lap_wall_time_data().max / n_calls;
+}
+
+
+
+int
+main(int argc, char **argv)
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(
+    argc, argv, testing_max_num_threads());
+
+  const auto [metric, n_repetitions, names] = describe_measurements();
+  AssertThrow(n_repetitions > 0, ExcInternalError());
+
+  std::vector<Measurement> measurements;
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    {
+      measurements.push_back(perform_single_measurement());
+      AssertDimension(measurements.back().size(), names.size());
+    }
+
+  if (Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) != 0)
+    return 0;
+
+  const std::string environment =
+    get_testing_environment() == TestingEnvironment::light ?
+      "light" :
+      (get_testing_environment() == TestingEnvironment::medium ? "medium" :
+                                                                  "heavy");
+
+  std::cout << std::setprecision(6) << std::scientific;
+  std::cout << "{\n"
+            << "  \"metric\": \""
+            << (metric == Metric::timing ? "timing" : "") << "\",\n"
+            << "  \"environment\": \"" << environment << "\",\n"
+            << "  \"n_mpi_processes\": "
+            << Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD) << ",\n"
+            << "  \"n_threads\": " << MultithreadInfo::n_threads() << ",\n"
+            << "  \"n_repetitions\": " << n_repetitions << ",\n"
+            << "  \"measurements\": [";
+  for (unsigned int i = 0; i < names.size(); ++i)
+    {
+      std::vector<double> values(n_repetitions);
+      for (unsigned int r = 0; r < n_repetitions; ++r)
+        values[r] = measurements[r][i];
+      std::vector<double> sorted_values = values;
+      std::sort(sorted_values.begin(), sorted_values.end());
+
+      std::cout << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << names[i]
+                << "\", \"min\": " << sorted_values.front()
+                << ", \"median\": " << sorted_values[n_repetitions / 2]
+                << ", \"mean\": "
+                << std::accumulate(values.begin(), values.end(), 0.) /
+                     n_repetitions
+                << ", \"max\": " << sorted_values.back() << ", \"values\": [";
+      for (unsigned int r = 0; r < n_repetitions; ++r)
+        std::cout << (r == 0 ? "" : ", ") << values[r];
+      std::cout << "]}";
+    }
+  std::cout << "\n  ]\n}" << std::endl;
+
+  return 0;
+}
+
+#endif
@@ -0,0 +1,88 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Time DataOut::build_patches() and the output of the patches in VTU format
+// for a Q2 solution in 3d, with and without subdivision of the cells.
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/data_out.h>
+
+#include "performance_test_driver.h"
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          default_n_repetitions(),
+          {"build_patches",
+           "write_vtu",
+           "build_patches_subdivided",
+           "write_vtu_subdivided"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  constexpr int dim = 3;
+
+  const unsigned int n_global_refinements =
+    get_testing_environment() == TestingEnvironment::light ?
+      3 :
+      (get_testing_environment() == TestingEnvironment::medium ? 4 : 5);
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_cube(triangulation);
+  triangulation.refine_global(n_global_refinements);
+
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  Vector<double> solution(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < solution.size(); ++i)
+    solution[i] = std::sin(0.1 * i);
+
+  Measurement result;
+  Timer       timer;
+  for (const unsigned int n_subdivisions : {1U, 2U})
+    {
+      DataOut<dim> data_out;
+      data_out.attach_dof_handler(dof_handler);
+      data_out.add_data_vector(solution, "solution");
+
+      timer.restart();
+      data_out.build_patches(n_subdivisions);
+      result.push_back(timer.wall_time());
+
+      std::ostringstream out;
+      timer.restart();
+      data_out.write_vtu(out);
+      result.push_back(timer.wall_time());
+    }
+
+  return result;
+}
@@ -0,0 +1,106 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Time the vector operations of LinearAlgebra::distributed::Vector and the
+// ghost exchange of its Utilities::MPI::Partitioner. Each process owns a
+// contiguous range of indices and has the first and last indices of its
+// neighbors as ghosts, similar to a one-dimensional domain decomposition.
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/partitioner.h>
+
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include "performance_test_driver.h"
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          default_n_repetitions(),
+          {"add",
+           "sadd",
+           "dot",
+           "l2_norm",
+           "add_and_dot",
+           "update_ghost_values",
+           "compress_add"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  const MPI_Comm     comm    = MPI_COMM_WORLD;
+  const unsigned int rank    = Utilities::MPI::this_mpi_process(comm);
+  const unsigned int n_ranks = Utilities::MPI::n_mpi_processes(comm);
+
+  const types::global_dof_index n_local =
+    get_testing_environment() == TestingEnvironment::light ?
+      1000000 :
+      (get_testing_environment() == TestingEnvironment::medium ? 10000000 :
+                                                                  40000000);
+  const types::global_dof_index n_ghosts_per_neighbor = n_local / 100;
+  const types::global_dof_index size                  = n_local * n_ranks;
+
+  IndexSet locally_owned(size);
+  locally_owned.add_range(rank * n_local, (rank + 1) * n_local);
+  IndexSet ghosts(size);
+  if (rank > 0)
+    ghosts.add_range(rank * n_local - n_ghosts_per_neighbor, rank * n_local);
+  if (rank + 1 < n_ranks)
+    ghosts.add_range((rank + 1) * n_local,
+                     (rank + 1) * n_local + n_ghosts_per_neighbor);
+
+  const auto partitioner =
+    std::make_shared<Utilities::MPI::Partitioner>(locally_owned, ghosts, comm);
+
+  LinearAlgebra::distributed::Vector<double> u(partitioner), v(partitioner),
+    w(partitioner);
+  for (unsigned int i = 0; i < u.locally_owned_size(); ++i)
+    {
+      u.local_element(i) = 1. + i % 3;
+      v.local_element(i) = 1. + i % 5;
+      w.local_element(i) = 1. + i % 7;
+    }
+
+  double result = 0.;
+
+  Measurement measurement;
+  measurement.push_back(time_average([&]() { u.add(0.5, v); }, 50));
+  measurement.push_back(time_average([&]() { u.sadd(0.5, 0.5, v); }, 50));
+  measurement.push_back(time_average([&]() { result += u * v; }, 50));
+  measurement.push_back(time_average([&]() { result += u.l2_norm(); }, 50));
+  measurement.push_back(
+    time_average([&]() { result += u.add_and_dot(0.5, v, w); }, 50));
+  measurement.push_back(time_average(
+    [&]() {
+      u.zero_out_ghost_values();
+      u.update_ghost_values();
+    },
+    50));
+  measurement.push_back(time_average(
+    [&]() {
+      for (const auto i : ghosts)
+        u(i) = 1.;
+      u.compress(VectorOperation::add);
+    },
+    50));
+
+  AssertThrow(std::isfinite(result), ExcInternalError());
+
+  return measurement;
+}
@@ -0,0 +1,94 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Time the adaptive refinement of a mesh, the distribution and renumbering
+// of degrees of freedom, and the setup of hanging node constraints for a Q2
+// element in 3d.
+
+#include <deal.II/base/timer.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include "performance_test_driver.h"
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          default_n_repetitions(),
+          {"refine_global",
+           "refine_adaptive",
+           "distribute_dofs",
+           "renumber_cuthill_mckee",
+           "hanging_node_constraints"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  constexpr int dim = 3;
+
+  const unsigned int n_global_refinements =
+    get_testing_environment() == TestingEnvironment::light ?
+      3 :
+      (get_testing_environment() == TestingEnvironment::medium ? 4 : 5);
+
+  Measurement result;
+  Timer       timer;
+
+  Triangulation<dim> triangulation;
+  GridGenerator::hyper_shell(triangulation, Point<dim>(), 0.5, 1., 12);
+  timer.restart();
+  triangulation.refine_global(n_global_refinements);
+  result.push_back(timer.wall_time());
+
+  // refine the cells in an inner layer around the center to obtain
+  // hanging nodes
+  for (const auto &cell : triangulation.active_cell_iterators())
+    if (cell->center().norm() < 0.6)
+      cell->set_refine_flag();
+  timer.restart();
+  triangulation.execute_coarsening_and_refinement();
+  result.push_back(timer.wall_time());
+
+  const FE_Q<dim> fe(2);
+  DoFHandler<dim> dof_handler(triangulation);
+  timer.restart();
+  dof_handler.distribute_dofs(fe);
+  result.push_back(timer.wall_time());
+
+  timer.restart();
+  DoFRenumbering::Cuthill_McKee(dof_handler);
+  result.push_back(timer.wall_time());
+
+  AffineConstraints<double> constraints;
+  timer.restart();
+  DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  constraints.close();
+  result.push_back(timer.wall_time());
+
+  return result;
+}
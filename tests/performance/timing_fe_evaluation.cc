@@ -0,0 +1,130 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Time the application of a Laplace operator with FEEvaluation::evaluate()
+// and FEEvaluation::integrate() in a MatrixFree::cell_loop() for polynomial
+// degrees 1 to 6 in 3d, with roughly the same number of unknowns for all
+// degrees.
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "performance_test_driver.h"
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          default_n_repetitions(),
+          {"laplace_p1",
+           "laplace_p2",
+           "laplace_p3",
+           "laplace_p4",
+           "laplace_p5",
+           "laplace_p6"}};
+}
+
+
+
+template <int dim, int degree>
+double
+time_laplace()
+{
+  const unsigned int target_n_dofs =
+    get_testing_environment() == TestingEnvironment::light ?
+      100000 :
+      (get_testing_environment() == TestingEnvironment::medium ? 1000000 :
+                                                                  8000000);
+
+  // use the subdivisions of a hyper rectangle to hit the target size
+  const unsigned int n_subdivisions = std::max(
+    1,
+    static_cast<int>(
+      std::round(std::pow(target_n_dofs, 1. / dim) / degree)));
+
+  Triangulation<dim> triangulation;
+  GridGenerator::subdivided_hyper_cube(triangulation, n_subdivisions);
+
+  const FE_Q<dim> fe(degree);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_gradients | update_JxW_values;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(degree + 1),
+                     additional_data);
+
+  LinearAlgebra::distributed::Vector<double> src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  for (auto &value : src)
+    value = 1.;
+
+  const std::function<void(const MatrixFree<dim, double> &,
+                           LinearAlgebra::distributed::Vector<double> &,
+                           const LinearAlgebra::distributed::Vector<double> &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    cell_operation = [](const MatrixFree<dim, double>                    &data,
+                        LinearAlgebra::distributed::Vector<double>       &dst,
+                        const LinearAlgebra::distributed::Vector<double> &src,
+                        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, degree> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          phi.evaluate(EvaluationFlags::gradients);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_gradient(phi.get_gradient(q), q);
+          phi.integrate(EvaluationFlags::gradients);
+          phi.distribute_local_to_global(dst);
+        }
+    };
+
+  return time_average(
+    [&]() { matrix_free.cell_loop(cell_operation, dst, src, true); }, 20);
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  return {time_laplace<3, 1>(),
+          time_laplace<3, 2>(),
+          time_laplace<3, 3>(),
+          time_laplace<3, 4>(),
+          time_laplace<3, 5>(),
+          time_laplace<3, 6>()};
+}
@@ -0,0 +1,176 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Time steps of the five-stage, fourth-order low-storage Runge-Kutta method
+// applied to a DG operator with FE_DGQ elements in 3d, comparing the generic
+// path of TimeStepping::LowStorageRungeKutta, which evaluates the operator
+// and then updates the vectors, with the path that merges the vector updates
+// into the cell loop through
+// MatrixFreeTools::perform_low_storage_runge_kutta_stage().
+
+#include <deal.II/base/time_stepping.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q1.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include "performance_test_driver.h"
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          default_n_repetitions(),
+          {"generic_rk_step", "fused_rk_step"}};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  constexpr int      dim    = 3;
+  constexpr int      degree = 3;
+  using VectorType          = LinearAlgebra::distributed::Vector<double>;
+  const unsigned int target_n_dofs =
+    get_testing_environment() == TestingEnvironment::light ?
+      1000000 :
+      (get_testing_environment() == TestingEnvironment::medium ? 8000000 :
+                                                                  27000000);
+
+  const unsigned int n_subdivisions = std::max(
+    1,
+    static_cast<int>(
+      std::round(std::pow(target_n_dofs, 1. / dim) / (degree + 1))));
+
+  Triangulation<dim> triangulation;
+  GridGenerator::subdivided_hyper_cube(triangulation, n_subdivisions);
+
+  const FE_DGQ<dim> fe(degree);
+  DoFHandler<dim>   dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = update_values | update_JxW_values;
+
+  MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(MappingQ1<dim>(),
+                     dof_handler,
+                     constraints,
+                     QGauss<1>(degree + 1),
+                     additional_data);
+
+  // The right-hand side of the ODE du/dt = -a(x) u with a variable
+  // coefficient, computed cell by cell. Dividing by the quadrature weights
+  // stands in for the application of the inverse mass matrix.
+  const std::function<void(const MatrixFree<dim, double> &,
+                           VectorType &,
+                           const VectorType &,
+                           const std::pair<unsigned int, unsigned int> &)>
+    cell_operation = [](const MatrixFree<dim, double>               &data,
+                        VectorType                                  &dst,
+                        const VectorType                            &src,
+                        const std::pair<unsigned int, unsigned int> &range) {
+      FEEvaluation<dim, degree> phi(data);
+      for (unsigned int cell = range.first; cell < range.second; ++cell)
+        {
+          phi.reinit(cell);
+          phi.read_dof_values(src);
+          phi.evaluate(EvaluationFlags::values);
+          for (const unsigned int q : phi.quadrature_point_indices())
+            phi.submit_value(-(1. + phi.quadrature_point(q)[0]) *
+                               phi.get_value(q) / phi.JxW(q),
+                             q);
+          phi.integrate(EvaluationFlags::values);
+          phi.set_dof_values(dst);
+        }
+    };
+
+  VectorType solution, vec_ri, vec_ki;
+  matrix_free.initialize_dof_vector(solution);
+  matrix_free.initialize_dof_vector(vec_ri);
+  matrix_free.initialize_dof_vector(vec_ki);
+
+  TimeStepping::LowStorageRungeKutta<VectorType> integrator(
+    TimeStepping::LOW_STORAGE_RK_STAGE5_ORDER4);
+  const double time_step = 1e-3;
+
+  Measurement result;
+
+  for (auto &value : solution)
+    value = 1.;
+  result.push_back(time_average(
+    [&]() {
+      integrator.evolve_one_time_step(
+        [&](const double, const VectorType &src) {
+          VectorType dst;
+          dst.reinit(src, true);
+          matrix_free.cell_loop(cell_operation, dst, src);
+          return dst;
+        },
+        0.,
+        time_step,
+        solution,
+        vec_ri,
+        vec_ki);
+    },
+    10));
+
+  for (auto &value : solution)
+    value = 1.;
+  result.push_back(time_average(
+    [&]() {
+      integrator.evolve_one_time_step(
+        [&](const double,
+            const double      factor_solution,
+            const double      factor_ai,
+            const VectorType &current_ri,
+            VectorType       &vec_ki,
+            VectorType       &solution,
+            VectorType       &next_ri) {
+          MatrixFreeTools::perform_low_storage_runge_kutta_stage(
+            matrix_free,
+            cell_operation,
+            factor_solution,
+            factor_ai,
+            current_ri,
+            vec_ki,
+            solution,
+            next_ri);
+        },
+        0.,
+        time_step,
+        solution,
+        vec_ri,
+        vec_ki);
+    },
+    10));
+
+  return result;
+}
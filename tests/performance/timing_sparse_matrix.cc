@@ -0,0 +1,95 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Time SparseMatrix::vmult() and SparseMatrix::Tvmult() for the Laplace
+// matrices of Q1 and Q2 elements in 3d.
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include <deal.II/numerics/matrix_creator.h>
+
+#include "performance_test_driver.h"
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          default_n_repetitions(),
+          {"vmult_q1", "Tvmult_q1", "vmult_q2", "Tvmult_q2"}};
+}
+
+
+
+std::pair<double, double>
+time_vmult(const unsigned int degree)
+{
+  constexpr int dim = 3;
+
+  const unsigned int target_n_dofs =
+    get_testing_environment() == TestingEnvironment::light ?
+      100000 :
+      (get_testing_environment() == TestingEnvironment::medium ? 1000000 :
+                                                                  4000000);
+  const unsigned int n_subdivisions = std::max(
+    1,
+    static_cast<int>(std::round(std::cbrt(target_n_dofs) / degree)));
+
+  Triangulation<dim> triangulation;
+  GridGenerator::subdivided_hyper_cube(triangulation, n_subdivisions);
+
+  const FE_Q<dim> fe(degree);
+  DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  DynamicSparsityPattern dsp(dof_handler.n_dofs());
+  DoFTools::make_sparsity_pattern(dof_handler, dsp);
+  SparsityPattern sparsity_pattern;
+  sparsity_pattern.copy_from(dsp);
+
+  SparseMatrix<double> matrix(sparsity_pattern);
+  MatrixCreator::create_laplace_matrix(dof_handler,
+                                       QGauss<dim>(degree + 1),
+                                       matrix);
+
+  Vector<double> src(dof_handler.n_dofs()), dst(dof_handler.n_dofs());
+  for (unsigned int i = 0; i < src.size(); ++i)
+    src[i] = 1. + i % 7;
+
+  return {time_average([&]() { matrix.vmult(dst, src); }, 20),
+          time_average([&]() { matrix.Tvmult(dst, src); }, 20)};
+}
+
+
+
+Measurement
+perform_single_measurement()
+{
+  const auto [vmult_q1, Tvmult_q1] = time_vmult(1);
+  const auto [vmult_q2, Tvmult_q2] = time_vmult(2);
+  return {vmult_q1, Tvmult_q1, vmult_q2, Tvmult_q2};
+}
@@ -0,0 +1,234 @@
+// ------------------------------------------------------------------------
+//
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// Copyright (C) 2024 by the deal.II authors
+//
+// This file is part of the deal.II library.
+//
+// Part of the source code is dual licensed under Apache-2.0 WITH
+// LLVM-exception OR LGPL-2.1-or-later. Detailed license information
+// governing the source code and code contributions can be found in
+// LICENSE.md and CONTRIBUTING.md at the top level directory of deal.II.
+//
+// ------------------------------------------------------------------------
+
+// Time the assembly of the system matrix and right hand side of step-6
+// (Laplace equation with a variable coefficient) and step-8 (linear
+// elasticity) with WorkStream::run() on adaptively refined meshes in 2d.
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/work_stream.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/sparse_matrix.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/vector.h>
+
+#include "performance_test_driver.h"
+
+
+std::tuple<Metric, unsigned int, std::vector<std::string>>
+describe_measurements()
+{
+  return {Metric::timing,
+          default_n_repetitions(),
+          {"assemble_step_6", "assemble_step_8"}};
+}
+
+
+
+template <int dim>
+struct ScratchData
+{
+  ScratchData(const FiniteElement<dim> &fe,
+              const Quadrature<dim>    &quadrature,
+              const UpdateFlags         update_flags)
+    : fe_values(fe, quadrature, update_flags)
+  {}
+
+  ScratchData(const ScratchData &scratch_data)
+    : fe_values(scratch_data.fe_values.get_fe(),
+                scratch_data.fe_values.get_quadrature(),
+                scratch_data.fe_values.get_update_flags())
+  {}
+
+  FEValues<dim> fe_values;
+};
+
+
+
+struct CopyData
+{
+  FullMatrix<double>                   cell_matrix;
+  Vector<double>                       cell_rhs;
+  std::vector<types::global_dof_index> local_dof_indices;
+};
+
+
+
+template <int dim>
+class Assembler
+{
+public:
+  Assembler(const FiniteElement<dim> &fe)
+    : dof_handler(triangulation)
+    , fe(fe)
+  {
+    const unsigned int n_refinements =
+      get_testing_environment() == TestingEnvironment::light ?
+        6 :
+        (get_testing_environment() == TestingEnvironment::medium ? 8 : 9);
+
+    GridGenerator::hyper_shell(triangulation, Point<dim>(), 0.5, 1.);
+    triangulation.refine_global(n_refinements - 2);
+
+    // refine towards the inner boundary to get hanging nodes
+    for (unsigned int step = 0; step < 2; ++step)
+      {
+        for (const auto &cell : triangulation.active_cell_iterators())
+          if (cell->center().norm() < 0.6)
+            cell->set_refine_flag();
+        triangulation.execute_coarsening_and_refinement();
+      }
+
+    dof_handler.distribute_dofs(fe);
+
+    DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+    constraints.close();
+
+    DynamicSparsityPattern dsp(dof_handler.n_dofs());
+    DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+    sparsity_pattern.copy_from(dsp);
+    system_matrix.reinit(sparsity_pattern);
+    system_rhs.reinit(dof_handler.n_dofs());
+  }
+
+  template <typename CellWorker>
+  void
+  assemble(const CellWorker &cell_worker, const UpdateFlags update_flags)
+  {
+    system_matrix = 0.;
+    system_rhs    = 0.;
+
+    const QGauss<dim> quadrature(fe.degree + 1);
+
+    WorkStream::run(
+      dof_handler.begin_active(),
+      dof_handler.end(),
+      [&](const typename DoFHandler<dim>::active_cell_iterator &cell,
+          ScratchData<dim>                                     &scratch_data,
+          CopyData                                             &copy_data) {
+        scratch_data.fe_values.reinit(cell);
+        copy_data.cell_matrix.reinit(fe.n_dofs_per_cell(),
+                                     fe.n_dofs_per_cell());
+        copy_data.cell_rhs.reinit(fe.n_dofs_per_cell());
+        cell_worker(scratch_data.fe_values, copy_data);
+        copy_data.local_dof_indices.resize(fe.n_dofs_per_cell());
+        cell->get_dof_indices(copy_data.local_dof_indices);
+      },
+      [&](const CopyData &copy_data) {
+        constraints.distribute_local_to_global(copy_data.cell_matrix,
+                                               copy_data.cell_rhs,
+                                               copy_data.local_dof_indices,
+                                               system_matrix,
+                                               system_rhs);
+      },
+      ScratchData<dim>(fe, quadrature, update_flags),
+      CopyData());
+  }
+
+  Triangulation<dim>        triangulation;
+  DoFHandler<dim>           dof_handler;
+  const FiniteElement<dim> &fe;
+  AffineConstraints<double> constraints;
+  SparsityPattern           sparsity_pattern;
+  SparseMatrix<double>      system_matrix;
+  Vector<double>            system_rhs;
+};
+
+
+
+Measurement
+perform_single_measurement()
+{
+  constexpr int dim = 2;
+
+  // step-6: Laplace equation with a variable coefficient
+  const FE_Q<dim> fe_laplace(2);
+  Assembler<dim>  laplace(fe_laplace);
+
+  const auto laplace_worker = [](const FEValues<dim> &fe_values,
+                                 CopyData            &copy_data) {
+    for (const unsigned int q : fe_values.quadrature_point_indices())
+      {
+        const double coefficient =
+          fe_values.quadrature_point(q).square() < 0.5 * 0.5 ? 20. : 1.;
+        for (const unsigned int i : fe_values.dof_indices())
+          {
+            for (const unsigned int j : fe_values.dof_indices())
+              copy_data.cell_matrix(i, j) +=
+                coefficient * fe_values.shape_grad(i, q) *
+                fe_values.shape_grad(j, q) * fe_values.JxW(q);
+            copy_data.cell_rhs(i) +=
+              fe_values.shape_value(i, q) * fe_values.JxW(q);
+          }
+      }
+  };
+
+  // step-8: linear elasticity with constant Lame parameters
+  const FESystem<dim> fe_elasticity(FE_Q<dim>(1), dim);
+  Assembler<dim>      elasticity(fe_elasticity);
+
+  const auto elasticity_worker = [](const FEValues<dim> &fe_values,
+                                    CopyData            &copy_data) {
+    const FiniteElement<dim> &fe     = fe_values.get_fe();
+    const double              lambda = 1.;
+    const double              mu     = 1.;
+    for (const unsigned int i : fe_values.dof_indices())
+      {
+        const unsigned int component_i = fe.system_to_component_index(i).first;
+        for (const unsigned int j : fe_values.dof_indices())
+          {
+            const unsigned int component_j =
+              fe.system_to_component_index(j).first;
+            for (const unsigned int q : fe_values.quadrature_point_indices())
+              copy_data.cell_matrix(i, j) +=
+                ((fe_values.shape_grad(i, q)[component_i] *
+                  fe_values.shape_grad(j, q)[component_j] * lambda) +
+                 (fe_values.shape_grad(i, q)[component_j] *
+                  fe_values.shape_grad(j, q)[component_i] * mu) +
+                 ((component_i == component_j) ?
+                    (fe_values.shape_grad(i, q) *
+                     fe_values.shape_grad(j, q) * mu) :
+                    0)) *
+                fe_values.JxW(q);
+          }
+        for (const unsigned int q : fe_values.quadrature_point_indices())
+          copy_data.cell_rhs(i) += fe_values.shape_value(i, q) *
+                                   (component_i == 0 ? 1. : 0.) *
+                                   fe_values.JxW(q);
+      }
+  };
+
+  const UpdateFlags update_flags = update_values | update_gradients |
+                                   update_quadrature_points |
+                                   update_JxW_values;
+
+  return {time_average(
+            [&]() { laplace.assemble(laplace_worker, update_flags); }, 1),
+          time_average(
+            [&]() { elasticity.assemble(elasticity_worker, update_flags); },
+            1)};
+}